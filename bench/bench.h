@@ -0,0 +1,63 @@
+/* bench.h -- https://github.com/takeiteasy/fungl
+
+ fungl puts the fun back into OpenGL
+
+ Copyright (C) 2024  George Watson
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+#ifndef bench_h
+#define bench_h
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct bench_case {
+    const char *name;
+    void(*func)(void);
+    // Operations performed by a single call of `func`
+    uint64_t ops;
+    // Bytes processed by a single call of `func`, 0 if not applicable
+    uint64_t bytes;
+};
+
+struct bench_suite {
+    const char *name;
+    void(*setup)(void);
+    void(*teardown)(void);
+    struct bench_case *cases;
+    size_t count;
+};
+
+/* Every suite defines a `struct bench_suite NAME##_suite` */
+#define BENCH_SUITES \
+    X(glm) \
+    X(glu) \
+    X(texture) \
+    X(sprite) \
+    X(immediate)
+
+#define X(NAME) extern struct bench_suite NAME##_suite;
+BENCH_SUITES
+#undef X
+
+uint64_t bench_now(void);
+
+#if defined(__cplusplus)
+}
+#endif
+#endif /* bench_h */
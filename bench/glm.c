@@ -0,0 +1,147 @@
+/* glm.c -- https://github.com/takeiteasy/fungl
+
+ fungl puts the fun back into OpenGL
+
+ Copyright (C) 2024  George Watson
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+ Micro-benchmarks for glm.c, every case runs over BENCH_COUNT inputs */
+
+#include "bench.h"
+#include "glm.h"
+#include <stdlib.h>
+
+#define BENCH_COUNT 65536
+
+static struct {
+    vec2 v2[BENCH_COUNT];
+    vec3 v3[BENCH_COUNT];
+    vec4 v4[BENCH_COUNT];
+    quat q[BENCH_COUNT];
+    float f[BENCH_COUNT];
+#ifndef GLM_NO_MATRICES
+    mat4 m[BENCH_COUNT];
+#endif
+} data;
+
+static volatile float sink;
+
+static float randf(void) {
+    return (float)rand() / (float)RAND_MAX * 2.f - 1.f;
+}
+
+static void bench_setup(void) {
+    srand(1337);
+    for (int i = 0; i < BENCH_COUNT; i++) {
+        data.v2[i] = Vec2(randf(), randf());
+        data.v3[i] = Vec3(randf(), randf(), randf());
+        data.v4[i] = Vec4(randf(), randf(), randf(), randf());
+        data.q[i] = vec4_normalize(Vec4(randf(), randf(), randf(), randf()));
+        data.f[i] = (randf() + 1.f) * .5f;
+#ifndef GLM_NO_MATRICES
+        data.m[i] = mat4_mul(mat4_translate(data.v3[i]),
+                             mat4_mul(mat4_from_quat(data.q[i]), mat4_scale(Vec3(2.f, 2.f, 2.f))));
+#endif
+    }
+}
+
+#ifndef GLM_NO_MATRICES
+static void bench_mat4_invert(void) {
+    float acc = 0.f;
+    for (int i = 0; i < BENCH_COUNT; i++)
+        acc += MAT_AT(mat4_invert(data.m[i]), 0, 3);
+    sink = acc;
+}
+
+static void bench_mat4_determinant(void) {
+    float acc = 0.f;
+    for (int i = 0; i < BENCH_COUNT; i++)
+        acc += mat4_determinant(data.m[i]);
+    sink = acc;
+}
+
+static void bench_mat4_mul(void) {
+    float acc = 0.f;
+    for (int i = 0; i < BENCH_COUNT; i++)
+        acc += MAT_AT(mat4_mul(data.m[i], data.m[BENCH_COUNT - 1 - i]), 1, 2);
+    sink = acc;
+}
+
+static void bench_vec3_transform(void) {
+    float acc = 0.f;
+    mat4 m = data.m[0];
+    for (int i = 0; i < BENCH_COUNT; i++)
+        acc += vec3_transform(data.v3[i], m)[0];
+    sink = acc;
+}
+
+static void bench_look_at(void) {
+    float acc = 0.f;
+    vec3 up = Vec3(0.f, 1.f, 0.f);
+    for (int i = 0; i < BENCH_COUNT; i++)
+        acc += MAT_AT(look_at(data.v3[i], data.v3[BENCH_COUNT - 1 - i], up), 2, 3);
+    sink = acc;
+}
+#endif
+
+static void bench_quat_mul(void) {
+    quat acc = quat_identity();
+    for (int i = 0; i < BENCH_COUNT; i++)
+        acc = quat_mul(acc, data.q[i]);
+    sink = acc[3];
+}
+
+static void bench_easing(void) {
+    float acc = 0.f;
+    for (int i = 0; i < BENCH_COUNT; i++)
+        acc += easing((enum glm_easing_fn)(i % (GLM_EASING_ELASTIC + 1)),
+                      (enum glm_easing_t)(EASE_IN + i % 3),
+                      data.f[i], 0.f, 1.f, 1.f);
+    sink = acc;
+}
+
+#define X(N)                                           \
+    static void bench_vec##N##_normalize(void)         \
+    {                                                  \
+        float acc = 0.f;                               \
+        for (int i = 0; i < BENCH_COUNT; i++)          \
+            acc += vec##N##_normalize(data.v##N[i])[0]; \
+        sink = acc;                                    \
+    }
+__GLM_TYPES
+#undef X
+
+static struct bench_case cases[] = {
+#ifndef GLM_NO_MATRICES
+    {"mat4_invert", bench_mat4_invert, BENCH_COUNT},
+    {"mat4_determinant", bench_mat4_determinant, BENCH_COUNT},
+    {"mat4_mul", bench_mat4_mul, BENCH_COUNT},
+    {"vec3_transform", bench_vec3_transform, BENCH_COUNT},
+    {"look_at", bench_look_at, BENCH_COUNT},
+#endif
+    {"quat_mul", bench_quat_mul, BENCH_COUNT},
+    {"easing", bench_easing, BENCH_COUNT},
+    {"vec2_normalize", bench_vec2_normalize, BENCH_COUNT},
+    {"vec3_normalize", bench_vec3_normalize, BENCH_COUNT},
+    {"vec4_normalize", bench_vec4_normalize, BENCH_COUNT}
+};
+
+struct bench_suite glm_suite = {
+    .name = "glm",
+    .setup = bench_setup,
+    .teardown = NULL,
+    .cases = cases,
+    .count = sizeof(cases) / sizeof(cases[0])
+};
@@ -0,0 +1,185 @@
+/* glu.c -- https://github.com/takeiteasy/fungl
+
+ fungl puts the fun back into OpenGL
+
+ Copyright (C) 2024  George Watson
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+ Benchmarks for glu.c. The tessellation cases use synthetic map data, a
+ large coastline with lakes and a block of small building footprints. The
+ picking cases treat every label on a map as a small box. */
+
+#include "bench.h"
+#include "glu.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define COASTLINE_VERTICES 100000
+#define COASTLINE_LAKES 256
+#define LAKE_VERTICES 48
+#define BUILDINGS 10000
+#define BUILDING_VERTICES 12
+#define LABELS 1000000
+
+static struct {
+    GLUtesselator *tess;
+    GLfloat *coastline;
+    GLsizei coastline_ends[COASTLINE_LAKES + 1];
+    GLsizei coastline_contours;
+    GLfloat *buildings;
+    GLuint *indices;
+    GLsizei capacity;
+    GLfloat *labels, *points, *projected;
+    GLfloat model[16], proj[16];
+    GLint view[4];
+} data;
+
+static volatile GLsizei sink;
+
+static float randf(void) {
+    return (float)rand() / (float)RAND_MAX;
+}
+
+static void bench_setup(void) {
+    srand(1337);
+    data.tess = gluNewTess();
+
+    // Coastline: a wobbly ring built from a few octaves of noise
+    data.coastline = malloc(sizeof(GLfloat) * 2 * (COASTLINE_VERTICES + COASTLINE_LAKES * LAKE_VERTICES));
+    float phase[8];
+    for (int k = 0; k < 8; k++)
+        phase[k] = randf() * 2.f * (float)PI;
+    for (int i = 0; i < COASTLINE_VERTICES; i++) {
+        float a = 2.f * (float)PI * i / COASTLINE_VERTICES, r = 1000.f;
+        for (int k = 0; k < 8; k++)
+            r += 120.f / (k + 1) * sinf(a * (float)(3 << k) + phase[k]);
+        data.coastline[i * 2] = r * cosf(a);
+        data.coastline[i * 2 + 1] = r * sinf(a);
+    }
+    // Lakes: clockwise circles on a grid well inside the coast
+    GLsizei n = COASTLINE_VERTICES;
+    data.coastline_ends[0] = n;
+    int side = (int)sqrtf((float)COASTLINE_LAKES);
+    for (int lake = 0; lake < COASTLINE_LAKES; lake++) {
+        float cx = ((lake % side) - side * .5f + .5f) * 50.f, cy = ((lake / side) - side * .5f + .5f) * 50.f;
+        float radius = 10.f + randf() * 10.f;
+        for (int j = 0; j < LAKE_VERTICES; j++, n++) {
+            float a = -2.f * (float)PI * j / LAKE_VERTICES;
+            data.coastline[n * 2] = cx + radius * cosf(a);
+            data.coastline[n * 2 + 1] = cy + radius * sinf(a);
+        }
+        data.coastline_ends[lake + 1] = n;
+    }
+    data.coastline_contours = COASTLINE_LAKES + 1;
+
+    // Buildings: small L-shaped and notched footprints
+    data.buildings = malloc(sizeof(GLfloat) * 2 * BUILDINGS * BUILDING_VERTICES);
+    for (int b = 0; b < BUILDINGS; b++) {
+        GLfloat *v = data.buildings + b * BUILDING_VERTICES * 2;
+        float x = (b % 100) * 30.f, y = (b / 100) * 30.f;
+        float w = 10.f + randf() * 15.f, h = 10.f + randf() * 15.f, notch = 2.f + randf() * 4.f;
+        float shape[BUILDING_VERTICES * 2] = {
+            0, 0, w * .5f, 0, w * .5f, notch, w * .5f + notch, notch, w * .5f + notch, 0, w, 0,
+            w, h, w * .5f, h, w * .5f, h * .5f, notch, h * .5f, notch, h, 0, h
+        };
+        for (int i = 0; i < BUILDING_VERTICES; i++) {
+            v[i * 2] = x + shape[i * 2];
+            v[i * 2 + 1] = y + shape[i * 2 + 1];
+        }
+    }
+
+    data.capacity = (n + COASTLINE_LAKES * 2 + 2) * 3;
+    data.indices = malloc(sizeof(GLuint) * data.capacity);
+
+    // Labels: boxes scattered over a map plane, viewed at an angle
+    data.labels = malloc(sizeof(GLfloat) * 6 * LABELS);
+    data.points = malloc(sizeof(GLfloat) * 3 * LABELS);
+    data.projected = malloc(sizeof(GLfloat) * 3 * LABELS);
+    for (int i = 0; i < LABELS; i++) {
+        float x = (randf() - .5f) * 2000.f, y = randf() * 5.f, z = (randf() - .5f) * 2000.f;
+        float w = 1.f + randf() * 4.f, h = .5f + randf();
+        GLfloat box[6] = {x - w, y, z - .1f, x + w, y + h, z + .1f};
+        memcpy(data.labels + i * 6, box, sizeof(box));
+        data.points[i * 3] = x;
+        data.points[i * 3 + 1] = y;
+        data.points[i * 3 + 2] = z;
+    }
+    mat4 model = look_at(Vec3(0.f, 300.f, 600.f), Vec3(0.f, 0.f, 0.f), Vec3(0.f, 1.f, 0.f));
+    mat4 proj = perspective(TO_RADIANS(60.f), 16.f / 9.f, 1.f, 5000.f);
+    for (int c = 0; c < 4; c++)
+        for (int r = 0; r < 4; r++) {
+            data.model[c * 4 + r] = MAT_AT(model, r, c);
+            data.proj[c * 4 + r] = MAT_AT(proj, r, c);
+        }
+    data.view[2] = 1920;
+    data.view[3] = 1080;
+}
+
+static void bench_teardown(void) {
+    gluDeleteTess(data.tess);
+    free(data.coastline);
+    free(data.buildings);
+    free(data.indices);
+    free(data.labels);
+    free(data.points);
+    free(data.projected);
+}
+
+static void bench_tess_coastline(void) {
+    sink = gluTessPolygon2f(data.tess, data.coastline, data.coastline_ends, data.coastline_contours,
+                            data.indices, data.capacity);
+}
+
+static void bench_tess_buildings(void) {
+    GLsizei total = 0, ends[1] = {BUILDING_VERTICES};
+    for (int b = 0; b < BUILDINGS; b++)
+        total += gluTessPolygon2f(data.tess, data.buildings + b * BUILDING_VERTICES * 2, ends, 1,
+                                  data.indices, data.capacity);
+    sink = total;
+}
+
+static void bench_project_array(void) {
+    sink = gluProjectArray(data.points, LABELS, data.model, data.proj, data.view, data.projected);
+}
+
+static void bench_unproject_array(void) {
+    sink = gluUnProjectArray(data.projected, LABELS, data.model, data.proj, data.view, data.points);
+}
+
+static void bench_pick_aabb(void) {
+    GLfloat origin[3], direction[3], distance;
+    static int frame = 0;
+    // Sweep the cursor across the screen like a hovering mouse
+    frame = (frame + 37) % 1920;
+    gluPickRay((GLfloat)frame, 540.f, data.model, data.proj, data.view, origin, direction);
+    sink = gluPickAABB(origin, direction, data.labels, LABELS, &distance);
+}
+
+static struct bench_case cases[] = {
+    {"tess_coastline", bench_tess_coastline, 1, sizeof(GLfloat) * 2 * (COASTLINE_VERTICES + COASTLINE_LAKES * LAKE_VERTICES)},
+    {"tess_buildings", bench_tess_buildings, BUILDINGS, sizeof(GLfloat) * 2 * BUILDINGS * BUILDING_VERTICES},
+    {"project_array", bench_project_array, LABELS, sizeof(GLfloat) * 3 * LABELS},
+    {"unproject_array", bench_unproject_array, LABELS, sizeof(GLfloat) * 3 * LABELS},
+    {"pick_aabb", bench_pick_aabb, 1, sizeof(GLfloat) * 6 * LABELS}
+};
+
+struct bench_suite glu_suite = {
+    .name = "glu",
+    .setup = bench_setup,
+    .teardown = bench_teardown,
+    .cases = cases,
+    .count = sizeof(cases) / sizeof(cases[0])
+};
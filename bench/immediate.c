@@ -0,0 +1,682 @@
+/* immediate.c -- https://github.com/takeiteasy/fungl
+
+ fungl puts the fun back into OpenGL
+
+ Copyright (C) 2024  George Watson
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+ CPU cost of glimmediate.c: a hundred thousand textured quads per frame
+ collected, rewritten as triangle lists and copied into the streaming
+ buffer. The GL entry points it calls are replaced by stubs in setup
+ (buffers are heap blocks, draws are decoded back into vertices), so no
+ context is needed and the numbers leave out the driver and the GPU.
+
+ Setup first checks what reaches the draws: the index lists every
+ primitive mode is rewritten to, which glBegin/glEnd pairs share a batch
+ and where batches are broken, and the path for batches larger than a ring
+ segment. Display lists are compiled under one modelview and color and
+ called under others, checking the vertices, indices, tint and modelview
+ change of every draw, through glCallList, nested lists, glListBase with
+ glCallLists and GL_COMPILE_AND_EXECUTE. Any mismatch fails the run.
+
+ `quads` is a single glBegin(GL_QUADS) block, `translated_quads` one block
+ per quad with a glTranslatef before each, `list_glyphs` a thousand
+ characters of text drawn by glCallLists from one display list per glyph. */
+
+#include "bench.h"
+#include "glimmediate.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define QUADS 100000
+#define GLYPHS 1000
+#define IMMEDIATE_BUFFERS 64
+
+// Uniforms of the immediate program as the stubbed reflection reports them
+static const struct {
+    const char *name;
+    GLenum type;
+} uniforms[] = {
+    {"transform", GL_FLOAT_MAT4},
+    {"tint", GL_FLOAT_VEC4},
+    {"textured", GL_BOOL},
+    {"image", GL_SAMPLER_2D}
+};
+
+#define UNIFORMS (sizeof(uniforms) / sizeof(uniforms[0]))
+
+// A draw decoded back into one vertex per index
+struct immediate_capture {
+    GLenum mode, type;
+    GLsizei count;
+    GLint base_vertex;
+    GLuint buffer;
+    float (*position)[4];
+    float (*uv)[2];
+    unsigned char (*color)[4];
+    unsigned char *inherit;
+    GLuint *index;
+    size_t capacity;
+    float transform[16], tint[4];
+    int textured;
+};
+
+static struct {
+    void *buffers[IMMEDIATE_BUFFERS];
+    GLuint next_buffer, copy_write, array, elements;
+    size_t uploads;
+    // Last vertex attribute pointers, by location
+    struct {
+        GLint size;
+        GLsizei stride;
+        GLuint buffer;
+        uintptr_t offset;
+    } pointers[4];
+    float transform[16], tint[4];
+    int textured;
+    bool capture;
+    struct immediate_capture last;
+    size_t draws;
+    // Display lists of the printable ASCII glyphs, from ' '
+    GLuint font;
+    GLubyte text[GLYPHS];
+} data;
+
+static volatile size_t sink;
+
+static void immediate_expect(bool condition, const char *what) {
+    if (condition)
+        return;
+    fprintf(stderr, "ERROR: immediate check failed: %s\n", what);
+    exit(EXIT_FAILURE);
+}
+
+static void stub_gen(GLsizei n, GLuint *names) {
+    for (GLsizei i = 0; i < n; i++)
+        names[i] = data.next_buffer < IMMEDIATE_BUFFERS - 1 ? ++data.next_buffer : 0;
+}
+
+static void stub_delete(GLsizei n, const GLuint *names) {
+    for (GLsizei i = 0; i < n; i++) {
+        free(data.buffers[names[i]]);
+        data.buffers[names[i]] = NULL;
+    }
+}
+
+static void stub_bind_buffer(GLenum target, GLuint buffer) {
+    switch (target) {
+        case GL_COPY_WRITE_BUFFER:
+            data.copy_write = buffer;
+            break;
+        case GL_ARRAY_BUFFER:
+            data.array = buffer;
+            break;
+        case GL_ELEMENT_ARRAY_BUFFER:
+            data.elements = buffer;
+            break;
+    }
+}
+
+static void stub_buffer_data(GLenum target, GLsizeiptr size, const void *pixels, GLenum usage) {
+    if (target != GL_COPY_WRITE_BUFFER)
+        return;
+    free(data.buffers[data.copy_write]);
+    data.buffers[data.copy_write] = malloc(size);
+    if (pixels)
+        memcpy(data.buffers[data.copy_write], pixels, size);
+}
+
+static void stub_buffer_sub_data(GLenum target, GLintptr offset, GLsizeiptr size, const void *pixels) {
+    if (target != GL_COPY_WRITE_BUFFER)
+        return;
+    memcpy((char*)data.buffers[data.copy_write] + offset, pixels, size);
+    data.uploads++;
+}
+
+static void* stub_map(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+    return (char*)data.buffers[data.copy_write] + offset;
+}
+
+static void stub_flush(GLenum target, GLintptr offset, GLsizeiptr length) {}
+
+static GLboolean stub_unmap(GLenum target) {
+    return GL_TRUE;
+}
+
+static GLsync stub_fence(GLenum condition, GLbitfield flags) {
+    return (GLsync)1;
+}
+
+static GLenum stub_wait(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+    return GL_ALREADY_SIGNALED;
+}
+
+static void stub_delete_sync(GLsync sync) {}
+
+static const GLubyte* stub_string(GLenum name) {
+    return (const GLubyte*)"fungl-bench";
+}
+
+static void stub_integer(GLenum pname, GLint *value) {
+    *value = 0;
+}
+
+static GLuint stub_create(void) {
+    return 1;
+}
+
+static GLuint stub_create_shader(GLenum type) {
+    return 1;
+}
+
+static void stub_source(GLuint shader, GLsizei count, const GLchar *const *strings, const GLint *lengths) {}
+
+static void stub_shader_iv(GLuint shader, GLenum pname, GLint *value) {
+    *value = pname == GL_COMPILE_STATUS;
+}
+
+static void stub_program_iv(GLuint program, GLenum pname, GLint *value) {
+    switch (pname) {
+        case GL_LINK_STATUS:
+            *value = GL_TRUE;
+            break;
+        case GL_ACTIVE_UNIFORMS:
+            *value = (GLint)UNIFORMS;
+            break;
+        case GL_ACTIVE_UNIFORM_MAX_LENGTH:
+            *value = 16;
+            break;
+        default:
+            *value = 0;
+            break;
+    }
+}
+
+static void stub_uniforms_iv(GLuint program, GLsizei count, const GLuint *indices, GLenum pname, GLint *values) {
+    for (GLsizei i = 0; i < count; i++)
+        values[i] = pname == GL_UNIFORM_BLOCK_INDEX ? -1 : 0;
+}
+
+static void stub_active_uniform(GLuint program, GLuint index, GLsizei size, GLsizei *length, GLint *count, GLenum *type, GLchar *name) {
+    *length = (GLsizei)strlen(uniforms[index].name);
+    memcpy(name, uniforms[index].name, *length + 1);
+    *count = 1;
+    *type = uniforms[index].type;
+}
+
+static GLint stub_uniform_location(GLuint program, const GLchar *name) {
+    for (size_t i = 0; i < UNIFORMS; i++)
+        if (!strcmp(name, uniforms[i].name))
+            return (GLint)i;
+    return -1;
+}
+
+static void stub_uniform_int(GLint location, GLint value) {
+    if (location == 2)
+        data.textured = value;
+}
+
+static void stub_uniform_vec4(GLint location, GLsizei count, const GLfloat *value) {
+    if (location == 1)
+        memcpy(data.tint, value, sizeof(data.tint));
+}
+
+static void stub_uniform_mat4(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (location == 0)
+        memcpy(data.transform, value, sizeof(data.transform));
+}
+
+static GLint stub_attrib_location(GLuint program, const GLchar *name) {
+    return !strcmp(name, "position") ? 0 : !strcmp(name, "uv") ? 1 : !strcmp(name, "color") ? 2 : 3;
+}
+
+static void stub_attrib_pointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) {
+    data.pointers[index].size = size;
+    data.pointers[index].stride = stride;
+    data.pointers[index].buffer = data.array;
+    data.pointers[index].offset = (uintptr_t)pointer;
+}
+
+static const void* immediate_attribute(int location, GLuint vertex) {
+    return (const char*)data.buffers[data.pointers[location].buffer] + data.pointers[location].offset +
+           (size_t)vertex * data.pointers[location].stride;
+}
+
+static void stub_draw_base(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint base_vertex) {
+    data.draws++;
+    if (!data.capture)
+        return;
+    struct immediate_capture *last = &data.last;
+    if ((size_t)count > last->capacity) {
+        last->capacity = (size_t)count;
+        last->position = realloc(last->position, count * sizeof(*last->position));
+        last->uv = realloc(last->uv, count * sizeof(*last->uv));
+        last->color = realloc(last->color, count * sizeof(*last->color));
+        last->inherit = realloc(last->inherit, count * sizeof(*last->inherit));
+        last->index = realloc(last->index, count * sizeof(*last->index));
+        immediate_expect(last->position && last->uv && last->color && last->inherit && last->index, "capture alloc");
+    }
+    last->mode = mode;
+    last->type = type;
+    last->count = count;
+    last->base_vertex = base_vertex;
+    last->buffer = data.pointers[0].buffer;
+    const char *source = (const char*)data.buffers[data.elements] + (uintptr_t)indices;
+    for (GLsizei i = 0; i < count; i++) {
+        last->index[i] = type == GL_UNSIGNED_SHORT ? ((const uint16_t*)source)[i] : ((const uint32_t*)source)[i];
+        GLuint vertex = last->index[i] + (GLuint)base_vertex;
+        memcpy(last->position[i], immediate_attribute(0, vertex), sizeof(last->position[i]));
+        memcpy(last->uv[i], immediate_attribute(1, vertex), sizeof(last->uv[i]));
+        memcpy(last->color[i], immediate_attribute(2, vertex), sizeof(last->color[i]));
+        last->inherit[i] = *(const unsigned char*)immediate_attribute(3, vertex);
+    }
+    memcpy(last->transform, data.transform, sizeof(data.transform));
+    memcpy(last->tint, data.tint, sizeof(data.tint));
+    last->textured = data.textured;
+}
+
+static void stub_draw(GLenum mode, GLsizei count, GLenum type, const void *indices) {
+    stub_draw_base(mode, count, type, indices, 0);
+}
+
+static void stub_uint(GLuint value) {}
+static void stub_uint2(GLuint a, GLuint b) {}
+static void stub_enum(GLenum value) {}
+static void stub_enum2(GLenum a, GLenum b) {}
+static void stub_names(GLsizei n, const GLuint *names) {}
+
+static void stub_vertex_arrays(GLsizei n, GLuint *names) {
+    for (GLsizei i = 0; i < n; i++)
+        names[i] = 1;
+}
+
+// Each of the `n` vertices has its number as x, so the drawn x values are
+// the indices the primitive was rewritten to
+static void immediate_numbered(GLenum mode, int n) {
+    immediate_begin(mode);
+    for (int i = 0; i < n; i++)
+        immediate_vertex((float)i, 0.f, 0.f, 1.f);
+    immediate_end();
+}
+
+static void immediate_check_mode(GLenum mode, int n, GLenum drawn, const GLuint *expected, GLsizei count, const char *name) {
+    size_t draws = data.draws;
+    immediate_numbered(mode, n);
+    immediate_flush();
+    immediate_expect(data.draws == draws + 1 && data.last.mode == drawn && data.last.count == count, name);
+    for (GLsizei i = 0; i < count; i++)
+        immediate_expect(data.last.position[i][0] == (float)expected[i], name);
+}
+
+static void immediate_check_modes(void) {
+    static const GLuint points[] = {0, 1, 2};
+    static const GLuint lines[] = {0, 1, 2, 3};
+    static const GLuint strip[] = {0, 1, 1, 2, 2, 3};
+    static const GLuint loop[] = {0, 1, 1, 2, 2, 0};
+    static const GLuint triangles[] = {0, 1, 2, 3, 4, 5};
+    static const GLuint triangle_strip[] = {0, 1, 2, 2, 1, 3, 2, 3, 4};
+    static const GLuint fan[] = {0, 1, 2, 0, 2, 3, 0, 3, 4};
+    static const GLuint quads[] = {0, 1, 2, 2, 3, 0, 4, 5, 6, 6, 7, 4};
+    static const GLuint quad_strip[] = {0, 1, 3, 3, 2, 0, 2, 3, 5, 5, 4, 2};
+#define X(MODE, N, DRAWN, EXPECTED) \
+    immediate_check_mode(MODE, N, DRAWN, EXPECTED, sizeof(EXPECTED) / sizeof(EXPECTED[0]), #MODE)
+    X(GL_POINTS, 3, GL_POINTS, points);
+    // Incomplete trailing primitives are dropped
+    X(GL_LINES, 5, GL_LINES, lines);
+    X(GL_LINE_STRIP, 4, GL_LINES, strip);
+    X(GL_LINE_LOOP, 3, GL_LINES, loop);
+    X(GL_TRIANGLES, 7, GL_TRIANGLES, triangles);
+    X(GL_TRIANGLE_STRIP, 5, GL_TRIANGLES, triangle_strip);
+    X(GL_TRIANGLE_FAN, 5, GL_TRIANGLES, fan);
+    X(GL_QUADS, 9, GL_TRIANGLES, quads);
+    X(GL_QUAD_STRIP, 7, GL_TRIANGLES, quad_strip);
+    X(GL_POLYGON, 5, GL_TRIANGLES, fan);
+#undef X
+    size_t draws = data.draws;
+    immediate_numbered(GL_TRIANGLES, 2);
+    immediate_flush();
+    immediate_expect(data.draws == draws, "a primitive without a whole triangle draws nothing");
+}
+
+static void immediate_check_batches(void) {
+    // Matrix changes between primitives of the same kind keep the batch,
+    // the vertices were already transformed
+    size_t draws = data.draws;
+    immediate_numbered(GL_TRIANGLES, 3);
+    matrix_translate(Vec3(10.f, 0.f, 0.f));
+    immediate_numbered(GL_TRIANGLES, 3);
+    matrix_load_identity();
+    immediate_expect(data.draws == draws, "nothing is drawn before the batch is broken");
+    immediate_flush();
+    immediate_expect(data.draws == draws + 1 && data.last.count == 6, "translated primitives share a batch");
+    immediate_expect(data.last.position[2][0] == 2.f && data.last.position[3][0] == 10.f &&
+                     data.last.position[5][0] == 12.f, "vertices use the matrix current at their glBegin");
+
+    // Another kind of list, texturing or a wrapped state change break it
+    draws = data.draws;
+    immediate_numbered(GL_QUADS, 4);
+    immediate_numbered(GL_LINES, 2);
+    immediate_expect(data.draws == draws + 1 && data.last.mode == GL_TRIANGLES, "a new primitive type flushes");
+    immediate_flush();
+    immediate_expect(data.draws == draws + 2 && data.last.mode == GL_LINES, "the lines are their own batch");
+
+    draws = data.draws;
+    immediate_numbered(GL_TRIANGLES, 3);
+    immediate_texturing(true);
+    immediate_numbered(GL_TRIANGLES, 3);
+    immediate_expect(data.draws == draws + 1 && !data.last.textured, "texturing flushes the untextured batch");
+    immediate_flush();
+    immediate_texturing(false);
+    immediate_expect(data.draws == draws + 2 && data.last.textured, "the textured batch samples");
+
+    draws = data.draws;
+    immediate_numbered(GL_TRIANGLES, 3);
+    immediate_compat_blend_func(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    immediate_expect(data.draws == draws + 1, "a wrapped state change flushes first");
+
+    // A batch is drawn at the end of the primitive that reaches
+    // IMMEDIATE_BATCH_VERTICES, without waiting for a flush
+    draws = data.draws;
+    immediate_numbered(GL_POINTS, IMMEDIATE_BATCH_VERTICES);
+    immediate_expect(data.draws == draws + 1 && data.last.count == IMMEDIATE_BATCH_VERTICES,
+                     "a full batch is drawn at glEnd");
+}
+
+static void immediate_check_overflow(void) {
+    // Every vertex has at least a vec4 position, so this outgrows a segment
+    int n = IMMEDIATE_BUFFER_SIZE / (4 * sizeof(float));
+    size_t draws = data.draws, uploads = data.uploads;
+    immediate_numbered(GL_POINTS, n);
+    immediate_expect(data.draws == draws + 1 && data.last.count == n, "an oversized batch is drawn");
+    immediate_expect(data.uploads == uploads + 2, "an oversized batch is uploaded to a buffer of its own");
+    immediate_expect(data.last.position[0][0] == 0.f && data.last.position[n - 1][0] == (float)(n - 1),
+                     "an oversized batch keeps its vertices");
+}
+
+static void immediate_expect_model(float x, float y, const char *what) {
+    mat4 model = matrix_get(MATRIX_MODEL);
+    immediate_expect(MAT_AT(model, 0, 3) == x && MAT_AT(model, 1, 3) == y && MAT_AT(model, 0, 0) == 1.f &&
+                     MAT_AT(model, 1, 1) == 1.f, what);
+}
+
+// The last draw is the list's quad or triangle from (0, 0) to (1, 1), in
+// list space, under the modelview translated by (`x`, `y`)
+static void immediate_expect_list_draw(GLsizei count, float x, float y, GLubyte inherit, const char *what) {
+    static const GLuint quad[] = {0, 1, 2, 2, 3, 0};
+    static const float corners[][2] = {{0.f, 0.f}, {1.f, 0.f}, {1.f, 1.f}, {0.f, 1.f}};
+    const struct immediate_capture *last = &data.last;
+    immediate_expect(last->mode == GL_TRIANGLES && last->count == count && last->type == GL_UNSIGNED_SHORT, what);
+    immediate_expect(last->transform[12] == x && last->transform[13] == y && last->transform[0] == 1.f, what);
+    for (GLsizei i = 0; i < count; i++) {
+        GLuint index = count == 6 ? quad[i] : (GLuint)i;
+        immediate_expect(last->index[i] == index && last->inherit[i] == inherit &&
+                         last->position[i][0] == corners[index][0] && last->position[i][1] == corners[index][1], what);
+    }
+}
+
+// A quad taking the color of the call and moving the pen along, like a glyph
+static void immediate_glyph(float advance) {
+    immediate_begin(GL_QUADS);
+    immediate_tex_coord(0.f, 0.f);
+    immediate_vertex(0.f, 0.f, 0.f, 1.f);
+    immediate_tex_coord(1.f, 0.f);
+    immediate_vertex(1.f, 0.f, 0.f, 1.f);
+    immediate_tex_coord(1.f, 1.f);
+    immediate_vertex(1.f, 1.f, 0.f, 1.f);
+    immediate_tex_coord(0.f, 1.f);
+    immediate_vertex(0.f, 1.f, 0.f, 1.f);
+    immediate_end();
+    matrix_translate(Vec3(advance, 0.f, 0.f));
+}
+
+static void immediate_triangle(void) {
+    immediate_begin(GL_TRIANGLES);
+    immediate_vertex(0.f, 0.f, 0.f, 1.f);
+    immediate_vertex(1.f, 0.f, 0.f, 1.f);
+    immediate_vertex(1.f, 1.f, 0.f, 1.f);
+    immediate_end();
+}
+
+static void immediate_check_lists(void) {
+    static const float green[] = {0.f, 1.f, 0.f, 1.f};
+    GLuint glyph = immediate_gen_lists(4), colored = glyph + 1, nested = glyph + 2, executed = glyph + 3;
+    immediate_expect(glyph && immediate_is_list(executed), "glGenLists");
+
+    // Compiling draws nothing and leaves the modelview and the color as
+    // they were, whatever matrix the list was compiled under
+    size_t draws = data.draws;
+    matrix_load_identity();
+    matrix_translate(Vec3(100.f, 0.f, 0.f));
+    immediate_color(1.f, 1.f, 1.f, 1.f);
+    immediate_new_list(glyph, GL_COMPILE);
+    immediate_glyph(2.f);
+    immediate_end_list();
+    immediate_new_list(colored, GL_COMPILE);
+    immediate_color(1.f, 0.f, 0.f, 1.f);
+    immediate_triangle();
+    immediate_end_list();
+    immediate_new_list(nested, GL_COMPILE);
+    immediate_call_list(glyph);
+    immediate_triangle();
+    immediate_end_list();
+    immediate_expect(data.draws == draws, "compiling a list draws nothing");
+    immediate_expect_model(100.f, 0.f, "compiling a list keeps the modelview");
+    immediate_numbered(GL_POINTS, 1);
+    immediate_flush();
+    immediate_expect(data.last.color[0][0] == 255 && data.last.color[0][1] == 255,
+                     "compiling a list keeps the current color");
+
+    // Replayed under another modelview and color, the geometry stays in
+    // list space, vertices without a glColor take the color of the call
+    // and the modelview moves on by the list's translation
+    matrix_load_identity();
+    matrix_translate(Vec3(0.f, 5.f, 0.f));
+    immediate_color(green[0], green[1], green[2], green[3]);
+    draws = data.draws;
+    immediate_call_list(glyph);
+    immediate_expect(data.draws == draws + 1, "a list of one batch is one draw");
+    immediate_expect_list_draw(6, 0.f, 5.f, 255, "glCallList of a glyph");
+    immediate_expect(!memcmp(data.last.tint, green, sizeof(green)), "a list is tinted by the current color");
+    immediate_expect_model(2.f, 5.f, "a list applies its modelview change");
+
+    immediate_call_list(colored);
+    immediate_expect(data.draws == draws + 2, "glCallList of a colored triangle");
+    immediate_expect_list_draw(3, 2.f, 5.f, 0, "glCallList of a colored triangle");
+    immediate_expect(data.last.color[0][0] == 255 && data.last.color[0][1] == 0,
+                     "vertices after a glColor in the list keep it");
+
+    // The geometry after a nested call is relative to where the call left
+    // the modelview
+    matrix_load_identity();
+    immediate_call_list(nested);
+    immediate_expect(data.draws == draws + 4, "glCallList of a list calling another");
+    immediate_expect_list_draw(3, 2.f, 0.f, 255, "drawing after a nested glCallList");
+    immediate_expect_model(2.f, 0.f, "a list calling another applies the called list's change");
+
+    // glListBase offsets every name given to glCallLists
+    static const GLubyte names[] = {1, 2, 1};
+    matrix_load_identity();
+    immediate_list_base(glyph - 1);
+    immediate_call_lists(3, GL_UNSIGNED_BYTE, names);
+    immediate_list_base(0);
+    immediate_expect(data.draws == draws + 7, "glCallLists draws every list");
+    immediate_expect_list_draw(6, 2.f, 0.f, 255, "glCallLists with a glListBase");
+    immediate_expect_model(4.f, 0.f, "glCallLists applies the change of every list");
+
+    // GL_COMPILE_AND_EXECUTE draws the list once it's compiled
+    matrix_load_identity();
+    immediate_new_list(executed, GL_COMPILE_AND_EXECUTE);
+    immediate_glyph(3.f);
+    immediate_expect(data.draws == draws + 7, "GL_COMPILE_AND_EXECUTE draws nothing before glEndList");
+    immediate_end_list();
+    immediate_expect(data.draws == draws + 8, "GL_COMPILE_AND_EXECUTE draws at glEndList");
+    immediate_expect_list_draw(6, 0.f, 0.f, 255, "GL_COMPILE_AND_EXECUTE");
+    immediate_expect_model(3.f, 0.f, "GL_COMPILE_AND_EXECUTE applies the modelview change once");
+
+    // Indices are only narrowed to 16 bits while every vertex fits
+    GLuint large = immediate_gen_lists(1);
+    immediate_new_list(large, GL_COMPILE);
+    immediate_numbered(GL_POINTS, 65537);
+    immediate_end_list();
+    matrix_load_identity();
+    immediate_call_list(large);
+    immediate_expect(data.last.type == GL_UNSIGNED_INT && data.last.count == 65537 &&
+                     data.last.index[65536] == 65536 && data.last.position[65536][0] == 65536.f,
+                     "a list of more than 65536 vertices keeps 32 bit indices");
+    immediate_delete_lists(glyph, 4);
+    immediate_delete_lists(large, 1);
+    immediate_expect(!immediate_is_list(glyph) && !immediate_is_list(large), "glDeleteLists");
+    matrix_load_identity();
+}
+
+static size_t immediate_glyphs(void) {
+    size_t draws = data.draws;
+    matrix_load_identity();
+    immediate_list_base(data.font - ' ');
+    immediate_call_lists(GLYPHS, GL_UNSIGNED_BYTE, data.text);
+    immediate_list_base(0);
+    return data.draws - draws;
+}
+
+static size_t immediate_quads(bool translated) {
+    size_t draws = data.draws;
+    matrix_load_identity();
+    if (!translated)
+        immediate_begin(GL_QUADS);
+    for (int i = 0; i < QUADS; i++) {
+        if (translated) {
+            matrix_translate(Vec3(1.f, 0.f, 0.f));
+            immediate_begin(GL_QUADS);
+        }
+        immediate_tex_coord(0.f, 0.f);
+        immediate_vertex(0.f, 0.f, 0.f, 1.f);
+        immediate_tex_coord(1.f, 0.f);
+        immediate_vertex(1.f, 0.f, 0.f, 1.f);
+        immediate_tex_coord(1.f, 1.f);
+        immediate_vertex(1.f, 1.f, 0.f, 1.f);
+        immediate_tex_coord(0.f, 1.f);
+        immediate_vertex(0.f, 1.f, 0.f, 1.f);
+        if (translated)
+            immediate_end();
+    }
+    if (!translated)
+        immediate_end();
+    immediate_flush();
+    sink = immediate_draw_count();
+    return data.draws - draws;
+}
+
+static void bench_setup(void) {
+    glGenBuffers = stub_gen;
+    glDeleteBuffers = stub_delete;
+    glBindBuffer = stub_bind_buffer;
+    glBufferData = stub_buffer_data;
+    glBufferSubData = stub_buffer_sub_data;
+    glMapBufferRange = stub_map;
+    glFlushMappedBufferRange = stub_flush;
+    glUnmapBuffer = stub_unmap;
+    glFenceSync = stub_fence;
+    glClientWaitSync = stub_wait;
+    glDeleteSync = stub_delete_sync;
+    glDrawElements = stub_draw;
+    glDrawElementsBaseVertex = stub_draw_base;
+    glGetString = stub_string;
+    glGetIntegerv = stub_integer;
+    glCreateProgram = stub_create;
+    glCreateShader = stub_create_shader;
+    glShaderSource = stub_source;
+    glCompileShader = stub_uint;
+    glGetShaderiv = stub_shader_iv;
+    glAttachShader = stub_uint2;
+    glDetachShader = stub_uint2;
+    glLinkProgram = stub_uint;
+    glGetProgramiv = stub_program_iv;
+    glGetActiveUniformsiv = stub_uniforms_iv;
+    glGetActiveUniform = stub_active_uniform;
+    glGetUniformLocation = stub_uniform_location;
+    glUniform1i = stub_uniform_int;
+    glUniform4fv = stub_uniform_vec4;
+    glUniformMatrix4fv = stub_uniform_mat4;
+    glDeleteShader = stub_uint;
+    glDeleteProgram = stub_uint;
+    glUseProgram = stub_uint;
+    glGetAttribLocation = stub_attrib_location;
+    glGenVertexArrays = stub_vertex_arrays;
+    glDeleteVertexArrays = stub_names;
+    glBindVertexArray = stub_uint;
+    glEnableVertexAttribArray = stub_uint;
+    glVertexAttribPointer = stub_attrib_pointer;
+    glBlendFunc = stub_enum2;
+    glEnable = stub_enum;
+    glDisable = stub_enum;
+
+    matrix_stack_reset();
+    // Made first so the lists checked below aren't the first names
+    data.font = immediate_gen_lists('~' - ' ' + 1);
+    for (GLuint i = 0; i <= '~' - ' '; i++) {
+        immediate_new_list(data.font + i, GL_COMPILE);
+        immediate_glyph(1.f);
+        immediate_end_list();
+    }
+    for (int i = 0; i < GLYPHS; i++)
+        data.text[i] = (GLubyte)(' ' + i % ('~' - ' ' + 1));
+
+    data.capture = true;
+    immediate_check_modes();
+    immediate_check_batches();
+    immediate_check_overflow();
+    immediate_check_lists();
+    data.capture = false;
+    fprintf(stderr, "immediate draws per frame: quads %zu, translated quads %zu, glyphs %zu\n",
+            immediate_quads(false), immediate_quads(true), immediate_glyphs());
+}
+
+static void bench_teardown(void) {
+    immediate_release();
+    matrix_stack_reset();
+    free(data.last.position);
+    free(data.last.uv);
+    free(data.last.color);
+    free(data.last.inherit);
+    free(data.last.index);
+    memset(&data.last, 0, sizeof(data.last));
+}
+
+static void bench_quads(void) {
+    immediate_quads(false);
+}
+
+static void bench_translated_quads(void) {
+    immediate_quads(true);
+}
+
+static void bench_list_glyphs(void) {
+    immediate_glyphs();
+}
+
+static struct bench_case cases[] = {
+    {"quads", bench_quads, QUADS, 0},
+    {"translated_quads", bench_translated_quads, QUADS, 0},
+    {"list_glyphs", bench_list_glyphs, GLYPHS, 0}
+};
+
+struct bench_suite immediate_suite = {
+    .name = "immediate",
+    .setup = bench_setup,
+    .teardown = bench_teardown,
+    .cases = cases,
+    .count = sizeof(cases) / sizeof(cases[0])
+};
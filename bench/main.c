@@ -0,0 +1,222 @@
+/* main.c -- https://github.com/takeiteasy/fungl
+
+ fungl puts the fun back into OpenGL
+
+ Copyright (C) 2024  George Watson
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+ usage: fungl-bench [-s suite] [-o results.json] [-b baseline.json]
+                    [-t threshold%] [-m min_ms]
+
+ Results are written as JSON (stdout by default). When a baseline is given
+ every case is compared against the matching entry and the exit code is 1
+ if any case is slower than the threshold (default 10%) allows. To record
+ a new baseline write the results over the old baseline file. */
+
+#include "bench.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#define BENCH_SAMPLES 5
+
+struct bench_result {
+    char name[128];
+    double ns_per_op;
+    double ops_per_sec;
+    double mb_per_sec;
+};
+
+static struct bench_suite *suites[] = {
+#define X(NAME) &NAME##_suite,
+    BENCH_SUITES
+#undef X
+};
+
+uint64_t bench_now(void) {
+#ifdef _WIN32
+    static LARGE_INTEGER freq = {0};
+    LARGE_INTEGER now;
+    if (!freq.QuadPart)
+        QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&now);
+    return (uint64_t)((double)now.QuadPart * 1e9 / (double)freq.QuadPart);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+static void bench_run(struct bench_case *bench, uint64_t min_ns, struct bench_result *out) {
+    // Warm up caches and branch predictors before timing
+    bench->func();
+
+    double best = -1.;
+    for (int i = 0; i < BENCH_SAMPLES; i++) {
+        uint64_t runs = 0, start = bench_now(), elapsed = 0;
+        do {
+            bench->func();
+            runs++;
+        } while ((elapsed = bench_now() - start) < min_ns / BENCH_SAMPLES);
+        double ns = (double)elapsed / (double)(runs * bench->ops);
+        if (best < 0. || ns < best)
+            best = ns;
+    }
+    out->ns_per_op = best;
+    out->ops_per_sec = best > 0. ? 1e9 / best : 0.;
+    out->mb_per_sec = bench->bytes && best > 0. ?
+        ((double)bench->bytes / (double)bench->ops) / best * 1e9 / (1024. * 1024.) : 0.;
+}
+
+static char* read_file(const char *path) {
+    FILE *fh = fopen(path, "rb");
+    if (!fh)
+        return NULL;
+    fseek(fh, 0, SEEK_END);
+    long size = ftell(fh);
+    fseek(fh, 0, SEEK_SET);
+    char *result = malloc(size + 1);
+    if (result) {
+        result[fread(result, 1, size, fh)] = '\0';
+    }
+    fclose(fh);
+    return result;
+}
+
+// Baselines are files previously written by this tool, so a simple
+// search for the name and the next "ns_per_op" key is enough
+static double baseline_lookup(const char *json, const char *name) {
+    char key[160];
+    snprintf(key, sizeof(key), "\"name\": \"%s\"", name);
+    const char *found = strstr(json, key);
+    if (!found)
+        return -1.;
+    const char *field = strstr(found, "\"ns_per_op\":");
+    double result = -1.;
+    if (!field || sscanf(field + strlen("\"ns_per_op\":"), "%lf", &result) != 1)
+        return -1.;
+    return result;
+}
+
+static void write_results(FILE *fh, struct bench_result *results, size_t count) {
+    fprintf(fh, "{\n  \"benchmarks\": [\n");
+    for (size_t i = 0; i < count; i++) {
+        fprintf(fh, "    {\"name\": \"%s\", \"ns_per_op\": %.4f, \"ops_per_sec\": %.1f",
+                results[i].name, results[i].ns_per_op, results[i].ops_per_sec);
+        if (results[i].mb_per_sec > 0.)
+            fprintf(fh, ", \"mb_per_sec\": %.2f", results[i].mb_per_sec);
+        fprintf(fh, "}%s\n", i + 1 < count ? "," : "");
+    }
+    fprintf(fh, "  ]\n}\n");
+}
+
+static void usage(const char *name) {
+    fprintf(stderr, "usage: %s [-s suite] [-o results.json] [-b baseline.json] [-t threshold%%] [-m min_ms]\n", name);
+}
+
+int main(int argc, char *argv[]) {
+    const char *suite_filter = NULL, *out_path = NULL, *baseline_path = NULL;
+    double threshold = 10.;
+    uint64_t min_ns = 250000000ull;
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 >= argc || argv[i][0] != '-' || strlen(argv[i]) != 2) {
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        char flag = argv[i][1];
+        const char *value = argv[++i];
+        switch (flag) {
+            case 's':
+                suite_filter = value;
+                break;
+            case 'o':
+                out_path = value;
+                break;
+            case 'b':
+                baseline_path = value;
+                break;
+            case 't':
+                threshold = atof(value);
+                break;
+            case 'm':
+                min_ns = (uint64_t)(atof(value) * 1e6);
+                break;
+            default:
+                usage(argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+
+    size_t total = 0;
+    for (size_t i = 0; i < sizeof(suites) / sizeof(suites[0]); i++)
+        total += suites[i]->count;
+    struct bench_result *results = calloc(total, sizeof(struct bench_result));
+    size_t count = 0;
+    for (size_t i = 0; i < sizeof(suites) / sizeof(suites[0]); i++) {
+        struct bench_suite *suite = suites[i];
+        if (suite_filter && strcmp(suite_filter, suite->name))
+            continue;
+        if (suite->setup)
+            suite->setup();
+        for (size_t j = 0; j < suite->count; j++) {
+            struct bench_result *result = &results[count++];
+            snprintf(result->name, sizeof(result->name), "%s.%s", suite->name, suite->cases[j].name);
+            bench_run(&suite->cases[j], min_ns, result);
+            fprintf(stderr, "%-40s %12.3f ns/op %16.1f ops/s\n", result->name, result->ns_per_op, result->ops_per_sec);
+        }
+        if (suite->teardown)
+            suite->teardown();
+    }
+
+    FILE *out = out_path ? fopen(out_path, "w") : stdout;
+    if (!out) {
+        fprintf(stderr, "ERROR: failed to open \"%s\"\n", out_path);
+        free(results);
+        return EXIT_FAILURE;
+    }
+    write_results(out, results, count);
+    if (out != stdout)
+        fclose(out);
+
+    int regressions = 0;
+    if (baseline_path) {
+        char *baseline = read_file(baseline_path);
+        if (!baseline) {
+            fprintf(stderr, "ERROR: failed to read baseline \"%s\"\n", baseline_path);
+            free(results);
+            return EXIT_FAILURE;
+        }
+        for (size_t i = 0; i < count; i++) {
+            double base = baseline_lookup(baseline, results[i].name);
+            if (base <= 0.) {
+                fprintf(stderr, "%-40s (no baseline)\n", results[i].name);
+                continue;
+            }
+            double delta = (results[i].ns_per_op - base) / base * 100.;
+            int regressed = delta > threshold;
+            regressions += regressed;
+            fprintf(stderr, "%-40s %+8.2f%%%s\n", results[i].name, delta, regressed ? "  REGRESSION" : "");
+        }
+        free(baseline);
+    }
+    free(results);
+    return regressions ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,254 @@
+/* sprite.c -- https://github.com/takeiteasy/fungl
+
+ fungl puts the fun back into OpenGL
+
+ Copyright (C) 2024  George Watson
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+ CPU cost of glsprite.c: a million sprites per frame written into the
+ streaming buffer and split into draws. The GL entry points it calls are
+ replaced by stubs in setup (buffers are heap blocks, draws only count), so
+ no context is needed and the numbers leave out the driver and the GPU.
+
+ `single` draws everything from one texture, `array` from random layers of
+ one texture array, `mixed` from 16 separate textures in random order and
+ `mixed_sorted` the same with SPRITE_SORT_TEXTURE. */
+
+#include "bench.h"
+#include "glsprite.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SPRITES 1000000
+#define SPRITE_TEXTURES 16
+#define SPRITE_BUFFERS 16
+
+static struct {
+    struct sprite_batch *batch, *sorted;
+    struct sprite *single, *array, *mixed;
+    void *buffers[SPRITE_BUFFERS];
+    GLuint next_buffer, copy_write;
+    int draws;
+} data;
+
+static volatile size_t sink;
+
+static void stub_gen(GLsizei n, GLuint *names) {
+    for (GLsizei i = 0; i < n; i++)
+        names[i] = data.next_buffer < SPRITE_BUFFERS - 1 ? ++data.next_buffer : 0;
+}
+
+static void stub_delete(GLsizei n, const GLuint *names) {
+    for (GLsizei i = 0; i < n; i++) {
+        free(data.buffers[names[i]]);
+        data.buffers[names[i]] = NULL;
+    }
+}
+
+static void stub_bind_buffer(GLenum target, GLuint buffer) {
+    if (target == GL_COPY_WRITE_BUFFER)
+        data.copy_write = buffer;
+}
+
+static void stub_buffer_data(GLenum target, GLsizeiptr size, const void *pixels, GLenum usage) {
+    if (target != GL_COPY_WRITE_BUFFER)
+        return;
+    free(data.buffers[data.copy_write]);
+    data.buffers[data.copy_write] = malloc(size);
+}
+
+static void* stub_map(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+    return (char*)data.buffers[data.copy_write] + offset;
+}
+
+static void stub_flush(GLenum target, GLintptr offset, GLsizeiptr length) {}
+
+static GLboolean stub_unmap(GLenum target) {
+    return GL_TRUE;
+}
+
+static GLsync stub_fence(GLenum condition, GLbitfield flags) {
+    return (GLsync)1;
+}
+
+static GLenum stub_wait(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+    return GL_ALREADY_SIGNALED;
+}
+
+static void stub_delete_sync(GLsync sync) {}
+
+static void stub_draw(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint base_vertex) {
+    data.draws++;
+}
+
+static const GLubyte* stub_string(GLenum name) {
+    return (const GLubyte*)"fungl-bench";
+}
+
+static void stub_integer(GLenum pname, GLint *value) {
+    *value = 0;
+}
+
+static GLuint stub_create(void) {
+    return 1;
+}
+
+static GLuint stub_create_shader(GLenum type) {
+    return 1;
+}
+
+static void stub_source(GLuint shader, GLsizei count, const GLchar *const *strings, const GLint *lengths) {}
+
+static void stub_shader_iv(GLuint shader, GLenum pname, GLint *value) {
+    *value = pname == GL_COMPILE_STATUS;
+}
+
+static void stub_program_iv(GLuint program, GLenum pname, GLint *value) {
+    *value = pname == GL_LINK_STATUS;
+}
+
+static GLint stub_attrib_location(GLuint program, const GLchar *name) {
+    return !strcmp(name, "position") ? 0 : !strcmp(name, "uv") ? 1 : !strcmp(name, "color") ? 2 : 3;
+}
+
+static void stub_uint(GLuint value) {}
+static void stub_uint2(GLuint a, GLuint b) {}
+static void stub_enum(GLenum value) {}
+static void stub_enum_uint(GLenum target, GLuint value) {}
+static void stub_names(GLsizei n, const GLuint *names) {}
+static void stub_attrib_pointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) {}
+
+static void stub_vertex_arrays(GLsizei n, GLuint *names) {
+    for (GLsizei i = 0; i < n; i++)
+        names[i] = 1;
+}
+
+static struct sprite* sprite_set(int textures, bool array) {
+    struct sprite *sprites = malloc(SPRITES * sizeof(struct sprite));
+    for (int i = 0; i < SPRITES; i++) {
+        int pick = rand() % textures;
+        sprites[i] = (struct sprite) {
+            .position = Vec2((float)(rand() % 1920), (float)(rand() % 1080)),
+            .size = Vec2(32.f, 32.f),
+            .origin = Vec2(16.f, 16.f),
+            .rotation = i % 4 ? 0.f : (float)(rand() % 628) / 100.f,
+            .uv = Vec4(0.f, 0.f, 1.f, 1.f),
+            .color = Vec4(1.f, 1.f, 1.f, 1.f),
+            .texture = array ? 1 : (GLuint)(1 + pick),
+            .array = array,
+            .layer = array ? pick : 0
+        };
+    }
+    return sprites;
+}
+
+static int sprite_frame(struct sprite_batch *batch, const struct sprite *sprites) {
+    sprite_batch_begin(batch, mat4_identity());
+    for (int i = 0; i < SPRITES; i++)
+        sprite_batch_draw(batch, &sprites[i]);
+    int calls = sprite_batch_end(batch);
+    sink = sprite_batch_count(batch);
+    return calls;
+}
+
+static void bench_setup(void) {
+    glGenBuffers = stub_gen;
+    glDeleteBuffers = stub_delete;
+    glBindBuffer = stub_bind_buffer;
+    glBufferData = stub_buffer_data;
+    glMapBufferRange = stub_map;
+    glFlushMappedBufferRange = stub_flush;
+    glUnmapBuffer = stub_unmap;
+    glFenceSync = stub_fence;
+    glClientWaitSync = stub_wait;
+    glDeleteSync = stub_delete_sync;
+    glDrawElementsBaseVertex = stub_draw;
+    glGetString = stub_string;
+    glGetIntegerv = stub_integer;
+    glCreateProgram = stub_create;
+    glCreateShader = stub_create_shader;
+    glShaderSource = stub_source;
+    glCompileShader = stub_uint;
+    glGetShaderiv = stub_shader_iv;
+    glAttachShader = stub_uint2;
+    glDetachShader = stub_uint2;
+    glLinkProgram = stub_uint;
+    glGetProgramiv = stub_program_iv;
+    glDeleteShader = stub_uint;
+    glDeleteProgram = stub_uint;
+    glUseProgram = stub_uint;
+    glGetAttribLocation = stub_attrib_location;
+    glGenVertexArrays = stub_vertex_arrays;
+    glDeleteVertexArrays = stub_names;
+    glBindVertexArray = stub_uint;
+    glEnableVertexAttribArray = stub_uint;
+    glVertexAttribPointer = stub_attrib_pointer;
+    glActiveTexture = stub_enum;
+    glBindTexture = stub_enum_uint;
+
+    srand(1337);
+    data.single = sprite_set(1, false);
+    data.array = sprite_set(SPRITE_TEXTURES, true);
+    data.mixed = sprite_set(SPRITE_TEXTURES, false);
+    data.batch = sprite_batch_create(65536, 0);
+    data.sorted = sprite_batch_create(65536, SPRITE_SORT_TEXTURE);
+    if (!data.batch || !data.sorted) {
+        fprintf(stderr, "ERROR: sprite_batch_create failed\n");
+        exit(EXIT_FAILURE);
+    }
+    fprintf(stderr, "sprite draws per frame: single %d, array %d, mixed %d, mixed sorted %d\n",
+            sprite_frame(data.batch, data.single), sprite_frame(data.batch, data.array),
+            sprite_frame(data.batch, data.mixed), sprite_frame(data.sorted, data.mixed));
+}
+
+static void bench_teardown(void) {
+    sprite_batch_destroy(data.batch);
+    sprite_batch_destroy(data.sorted);
+    free(data.single);
+    free(data.array);
+    free(data.mixed);
+}
+
+static void bench_single(void) {
+    sprite_frame(data.batch, data.single);
+}
+
+static void bench_array(void) {
+    sprite_frame(data.batch, data.array);
+}
+
+static void bench_mixed(void) {
+    sprite_frame(data.batch, data.mixed);
+}
+
+static void bench_mixed_sorted(void) {
+    sprite_frame(data.sorted, data.mixed);
+}
+
+static struct bench_case cases[] = {
+    {"single", bench_single, SPRITES, 0},
+    {"array", bench_array, SPRITES, 0},
+    {"mixed", bench_mixed, SPRITES, 0},
+    {"mixed_sorted", bench_mixed_sorted, SPRITES, 0}
+};
+
+struct bench_suite sprite_suite = {
+    .name = "sprite",
+    .setup = bench_setup,
+    .teardown = bench_teardown,
+    .cases = cases,
+    .count = sizeof(cases) / sizeof(cases[0])
+};
@@ -0,0 +1,278 @@
+/* texture.c -- https://github.com/takeiteasy/fungl
+
+ fungl puts the fun back into OpenGL
+
+ Copyright (C) 2024  George Watson
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+ Image ingestion for gltexture.c on a set of 4K textures written to the
+ temp directory. The `_stdio` cases are the plain qoi_read/stbi_load path
+ followed by the copy into upload memory, the `_mmap` cases decode from a
+ mapped file (QOI straight into the upload memory). A heap block stands in
+ for the mapped PBO so no context is needed.
+
+ The `qoi_*` codec cases compare gltexture.c's QOI codec against the
+ reference qoi.h on a single in-memory image. Setup round trips the image
+ through every encoder/decoder pairing and exits if any result differs.
+
+ `bc*_encode` block compress the same image on every core, `_single` on
+ one thread. */
+
+#include "bench.h"
+#include "gltexture.h"
+#include "deps/qoi.h"
+#include "deps/stb_image.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEXTURE_SIZE 4096
+#define TEXTURE_SET 4
+#define TEXTURE_BYTES ((size_t)TEXTURE_SIZE * TEXTURE_SIZE * 4)
+
+static struct {
+    char qoi[TEXTURE_SET][256];
+    char tga[TEXTURE_SET][256];
+    unsigned char *upload;
+    unsigned char *image;
+    void *encoded;
+    size_t encoded_size;
+} data;
+
+static volatile unsigned char sink;
+
+// Smooth gradients with a little noise, roughly what QOI sees in albedo maps
+static void texture_fill(unsigned char *pixels, int seed) {
+    srand(seed);
+    for (int y = 0; y < TEXTURE_SIZE; y++)
+        for (int x = 0; x < TEXTURE_SIZE; x++) {
+            unsigned char *px = pixels + ((size_t)y * TEXTURE_SIZE + x) * 4;
+            int noise = rand() & 7;
+            px[0] = (unsigned char)((x >> 4) + seed * 40 + noise);
+            px[1] = (unsigned char)((y >> 4) + noise);
+            px[2] = (unsigned char)(((x + y) >> 5) + (noise >> 1));
+            px[3] = (x >> 8) & 1 ? 255 : 200;
+        }
+}
+
+static void texture_write_tga(const char *path, const unsigned char *pixels) {
+    FILE *fh = fopen(path, "wb");
+    if (!fh)
+        return;
+    // Uncompressed true colour, 32bpp, top-left origin with 8 alpha bits
+    unsigned char header[18] = {0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                                TEXTURE_SIZE & 0xFF, TEXTURE_SIZE >> 8,
+                                TEXTURE_SIZE & 0xFF, TEXTURE_SIZE >> 8, 32, 0x28};
+    fwrite(header, 1, sizeof(header), fh);
+    unsigned char *row = malloc(TEXTURE_SIZE * 4);
+    for (int y = 0; y < TEXTURE_SIZE; y++) {
+        const unsigned char *src = pixels + (size_t)y * TEXTURE_SIZE * 4;
+        for (int x = 0; x < TEXTURE_SIZE; x++) {
+            row[x * 4 + 0] = src[x * 4 + 2];
+            row[x * 4 + 1] = src[x * 4 + 1];
+            row[x * 4 + 2] = src[x * 4 + 0];
+            row[x * 4 + 3] = src[x * 4 + 3];
+        }
+        fwrite(row, 1, TEXTURE_SIZE * 4, fh);
+    }
+    free(row);
+    fclose(fh);
+}
+
+static void texture_verify(const char *name, const unsigned char *pixels) {
+    if (!pixels || memcmp(pixels, data.image, TEXTURE_BYTES)) {
+        fprintf(stderr, "ERROR: QOI round trip through %s doesn't match the source image\n", name);
+        exit(EXIT_FAILURE);
+    }
+}
+
+static void texture_round_trip(void) {
+    qoi_desc desc = {TEXTURE_SIZE, TEXTURE_SIZE, 4, QOI_SRGB}, out;
+    int length;
+    size_t size, parallel_size;
+    unsigned char *reference = qoi_encode(data.image, &desc, &length);
+    unsigned char *encoded = texture_qoi_encode(data.image, TEXTURE_SIZE, TEXTURE_SIZE, 4, TEXTURE_SRGB, &size);
+    unsigned char *parallel = texture_qoi_encode_parallel(data.image, TEXTURE_SIZE, TEXTURE_SIZE, 4, TEXTURE_SRGB, 0, &parallel_size);
+    if (!reference || !encoded || size != (size_t)length || memcmp(reference, encoded, size)) {
+        fprintf(stderr, "ERROR: texture_qoi_encode output differs from the reference encoder\n");
+        exit(EXIT_FAILURE);
+    }
+    unsigned char *decoded = qoi_decode(parallel, (int)parallel_size, &out, 4);
+    texture_verify("texture_qoi_encode_parallel/qoi_decode", decoded);
+    free(decoded);
+    texture_verify("qoi_encode/texture_qoi_decode_into",
+                   texture_qoi_decode_into(reference, length, data.upload, TEXTURE_SIZE, TEXTURE_SIZE, 0) ? data.upload : NULL);
+    texture_verify("texture_qoi_encode_parallel/texture_qoi_decode_into",
+                   texture_qoi_decode_into(parallel, parallel_size, data.upload, TEXTURE_SIZE, TEXTURE_SIZE, 0) ? data.upload : NULL);
+    fprintf(stderr, "qoi round trip ok, %d bytes (parallel bands %+ld)\n", length, (long)parallel_size - length);
+    data.encoded = reference;
+    data.encoded_size = size;
+    free(encoded);
+    free(parallel);
+}
+
+static void bench_setup(void) {
+    const char *tmp = getenv("TMPDIR");
+    if (!tmp || !*tmp)
+        tmp = "/tmp";
+    data.upload = malloc(TEXTURE_BYTES);
+    qoi_desc desc = {TEXTURE_SIZE, TEXTURE_SIZE, 4, QOI_SRGB};
+    for (int i = 0; i < TEXTURE_SET; i++) {
+        texture_fill(data.upload, i);
+        snprintf(data.qoi[i], sizeof(data.qoi[i]), "%s/fungl-bench-%d.qoi", tmp, i);
+        snprintf(data.tga[i], sizeof(data.tga[i]), "%s/fungl-bench-%d.tga", tmp, i);
+        qoi_write(data.qoi[i], data.upload, &desc);
+        texture_write_tga(data.tga[i], data.upload);
+    }
+    data.image = malloc(TEXTURE_BYTES);
+    texture_fill(data.image, TEXTURE_SET);
+    texture_round_trip();
+}
+
+static void bench_teardown(void) {
+    for (int i = 0; i < TEXTURE_SET; i++) {
+        remove(data.qoi[i]);
+        remove(data.tga[i]);
+    }
+    free(data.upload);
+    free(data.image);
+    free(data.encoded);
+}
+
+static void bench_qoi_stdio(void) {
+    for (int i = 0; i < TEXTURE_SET; i++) {
+        qoi_desc desc;
+        unsigned char *pixels = qoi_read(data.qoi[i], &desc, 4);
+        if (!pixels)
+            continue;
+        memcpy(data.upload, pixels, TEXTURE_BYTES);
+        free(pixels);
+    }
+    sink = data.upload[TEXTURE_BYTES / 2];
+}
+
+static void bench_qoi_mmap(void) {
+    for (int i = 0; i < TEXTURE_SET; i++) {
+        size_t size;
+        const void *file = texture_map_file(data.qoi[i], &size);
+        if (!file)
+            continue;
+        texture_qoi_decode_into(file, size, data.upload, TEXTURE_SIZE, TEXTURE_SIZE, 0);
+        texture_unmap_file(file, size);
+    }
+    sink = data.upload[TEXTURE_BYTES / 2];
+}
+
+static void bench_tga_stdio(void) {
+    for (int i = 0; i < TEXTURE_SET; i++) {
+        int w, h, channels;
+        unsigned char *pixels = stbi_load(data.tga[i], &w, &h, &channels, 4);
+        if (!pixels)
+            continue;
+        memcpy(data.upload, pixels, TEXTURE_BYTES);
+        stbi_image_free(pixels);
+    }
+    sink = data.upload[TEXTURE_BYTES / 2];
+}
+
+static void bench_tga_mmap(void) {
+    for (int i = 0; i < TEXTURE_SET; i++) {
+        int w, h;
+        unsigned char *pixels = texture_decode_file(data.tga[i], 0, &w, &h);
+        if (!pixels)
+            continue;
+        memcpy(data.upload, pixels, TEXTURE_BYTES);
+        free(pixels);
+    }
+    sink = data.upload[TEXTURE_BYTES / 2];
+}
+
+static void bench_qoi_decode_reference(void) {
+    qoi_desc desc;
+    unsigned char *pixels = qoi_decode(data.encoded, (int)data.encoded_size, &desc, 4);
+    sink = pixels[TEXTURE_BYTES / 2];
+    free(pixels);
+}
+
+static void bench_qoi_decode(void) {
+    texture_qoi_decode_into(data.encoded, data.encoded_size, data.upload, TEXTURE_SIZE, TEXTURE_SIZE, 0);
+    sink = data.upload[TEXTURE_BYTES / 2];
+}
+
+static void bench_qoi_encode_reference(void) {
+    qoi_desc desc = {TEXTURE_SIZE, TEXTURE_SIZE, 4, QOI_SRGB};
+    int length;
+    unsigned char *encoded = qoi_encode(data.image, &desc, &length);
+    sink = encoded[length / 2];
+    free(encoded);
+}
+
+static void bench_qoi_encode(void) {
+    size_t size;
+    unsigned char *encoded = texture_qoi_encode(data.image, TEXTURE_SIZE, TEXTURE_SIZE, 4, TEXTURE_SRGB, &size);
+    sink = encoded[size / 2];
+    free(encoded);
+}
+
+static void bench_qoi_encode_parallel(void) {
+    size_t size;
+    unsigned char *encoded = texture_qoi_encode_parallel(data.image, TEXTURE_SIZE, TEXTURE_SIZE, 4, TEXTURE_SRGB, 0, &size);
+    sink = encoded[size / 2];
+    free(encoded);
+}
+
+static void bench_bc1_encode_single(void) {
+    size_t size;
+    unsigned char *encoded = texture_bc_encode(data.image, TEXTURE_SIZE, TEXTURE_SIZE, TEXTURE_BC1, 1, &size);
+    sink = encoded[size / 2];
+    free(encoded);
+}
+
+static void bench_bc1_encode(void) {
+    size_t size;
+    unsigned char *encoded = texture_bc_encode(data.image, TEXTURE_SIZE, TEXTURE_SIZE, TEXTURE_BC1, 0, &size);
+    sink = encoded[size / 2];
+    free(encoded);
+}
+
+static void bench_bc3_encode(void) {
+    size_t size;
+    unsigned char *encoded = texture_bc_encode(data.image, TEXTURE_SIZE, TEXTURE_SIZE, TEXTURE_BC3, 0, &size);
+    sink = encoded[size / 2];
+    free(encoded);
+}
+
+static struct bench_case cases[] = {
+    {"qoi_stdio", bench_qoi_stdio, TEXTURE_SET, TEXTURE_SET * TEXTURE_BYTES},
+    {"qoi_mmap", bench_qoi_mmap, TEXTURE_SET, TEXTURE_SET * TEXTURE_BYTES},
+    {"tga_stdio", bench_tga_stdio, TEXTURE_SET, TEXTURE_SET * TEXTURE_BYTES},
+    {"tga_mmap", bench_tga_mmap, TEXTURE_SET, TEXTURE_SET * TEXTURE_BYTES},
+    {"qoi_decode_reference", bench_qoi_decode_reference, 1, TEXTURE_BYTES},
+    {"qoi_decode", bench_qoi_decode, 1, TEXTURE_BYTES},
+    {"qoi_encode_reference", bench_qoi_encode_reference, 1, TEXTURE_BYTES},
+    {"qoi_encode", bench_qoi_encode, 1, TEXTURE_BYTES},
+    {"qoi_encode_parallel", bench_qoi_encode_parallel, 1, TEXTURE_BYTES},
+    {"bc1_encode_single", bench_bc1_encode_single, 1, TEXTURE_BYTES},
+    {"bc1_encode", bench_bc1_encode, 1, TEXTURE_BYTES},
+    {"bc3_encode", bench_bc3_encode, 1, TEXTURE_BYTES}
+};
+
+struct bench_suite texture_suite = {
+    .name = "texture",
+    .setup = bench_setup,
+    .teardown = bench_teardown,
+    .cases = cases,
+    .count = sizeof(cases) / sizeof(cases[0])
+};
@@ -27,6 +27,16 @@ extern "C" {
 #include "glu.h"
 #include "glut.h"
 #include "glm.h"
+#include "glmatrix.h"
+#include "gltexture.h"
+#include "glatlas.h"
+#include "glbuffer.h"
+#include "glshader.h"
+#include "glrender.h"
+#include "glsprite.h"
+#include "glimmediate.h"
+#include "glprofile.h"
+#include "gltrace.h"
 
 #if defined(__cplusplus)
 }
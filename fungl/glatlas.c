@@ -0,0 +1,529 @@
+/* glatlas.c --  https://github.com/takeiteasy/fungl
+
+ fungl puts the fun back into OpenGL
+
+ Copyright (C) 2024  George Watson
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+#include "glatlas.h"
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef MIN
+#define MIN(A, B) ((A) < (B) ? (A) : (B))
+#endif
+#ifndef MAX
+#define MAX(A, B) ((A) > (B) ? (A) : (B))
+#endif
+
+// Top edge of the packed area over [x, x + width)
+struct atlas_node {
+    int x, y, width;
+};
+
+// Freed rect below the skyline, including padding
+struct atlas_hole {
+    int x, y, width, height;
+};
+
+struct atlas_page {
+    GLuint texture;
+    struct atlas_node *nodes;
+    int node_count, node_capacity;
+    struct atlas_hole *holes;
+    int hole_count, hole_capacity;
+    // Padded texels covered by live images
+    size_t used;
+};
+
+struct atlas_entry {
+    // -1 for a free id, `x` then links to the next one
+    int page;
+    int x, y, width, height;
+};
+
+struct atlas {
+    int size, padding, max_pages, flags;
+    struct atlas_page *pages;
+    int page_count;
+    struct atlas_entry *entries;
+    int entry_count, entry_capacity;
+    int free_entry;
+    // Nothing was removed since the last defragment, repacking won't help
+    bool packed;
+    GLuint framebuffers[2];
+};
+
+#define ATLAS_GROW(ARRAY, COUNT, CAPACITY)                                        \
+    do {                                                                          \
+        if ((COUNT) == (CAPACITY)) {                                              \
+            int capacity = (CAPACITY) ? (CAPACITY) * 2 : 16;                      \
+            void *grown = realloc((ARRAY), capacity * sizeof(*(ARRAY)));          \
+            if (!grown)                                                           \
+                abort();                                                          \
+            (ARRAY) = grown;                                                      \
+            (CAPACITY) = capacity;                                                \
+        }                                                                         \
+    } while (0)
+
+static void atlas_page_reset(struct atlas_page *page, int size) {
+    page->node_count = 0;
+    ATLAS_GROW(page->nodes, page->node_count, page->node_capacity);
+    page->nodes[page->node_count++] = (struct atlas_node){0, 0, size};
+    page->hole_count = 0;
+    page->used = 0;
+}
+
+static void atlas_page_free(struct atlas_page *page) {
+    if (page->texture)
+        glDeleteTextures(1, &page->texture);
+    free(page->nodes);
+    free(page->holes);
+}
+
+static void atlas_hole_add(struct atlas_page *page, int x, int y, int width, int height) {
+    if (width <= 0 || height <= 0)
+        return;
+    ATLAS_GROW(page->holes, page->hole_count, page->hole_capacity);
+    page->holes[page->hole_count++] = (struct atlas_hole){x, y, width, height};
+}
+
+// Best area fit among the holes, the remainder is split along the shorter
+// leftover edge so the larger piece stays as square as possible
+static bool atlas_hole_take(struct atlas_page *page, int width, int height, int *x, int *y) {
+    int best = -1;
+    long best_area = 0;
+    for (int i = 0; i < page->hole_count; i++) {
+        struct atlas_hole *hole = &page->holes[i];
+        if (hole->width < width || hole->height < height)
+            continue;
+        long area = (long)hole->width * hole->height;
+        if (best < 0 || area < best_area) {
+            best = i;
+            best_area = area;
+        }
+    }
+    if (best < 0)
+        return false;
+    struct atlas_hole hole = page->holes[best];
+    page->holes[best] = page->holes[--page->hole_count];
+    *x = hole.x;
+    *y = hole.y;
+    int right = hole.width - width, below = hole.height - height;
+    if (right < below) {
+        atlas_hole_add(page, hole.x + width, hole.y, right, height);
+        atlas_hole_add(page, hole.x, hole.y + height, hole.width, below);
+    } else {
+        atlas_hole_add(page, hole.x + width, hole.y, right, hole.height);
+        atlas_hole_add(page, hole.x, hole.y + height, width, below);
+    }
+    return true;
+}
+
+// Lowest y a `width` wide rect can sit at when its left edge is on node `index`
+static int atlas_skyline_fit(const struct atlas_page *page, int index, int width, int height, int size) {
+    int x = page->nodes[index].x;
+    if (x + width > size)
+        return -1;
+    int y = 0, left = width;
+    for (int i = index; left > 0; i++) {
+        y = MAX(y, page->nodes[i].y);
+        if (y + height > size)
+            return -1;
+        left -= page->nodes[i].width;
+    }
+    return y;
+}
+
+// Bottom-left heuristic: lowest top edge, ties go to the narrowest segment
+static bool atlas_skyline_take(struct atlas_page *page, int width, int height, int size, int *x, int *y) {
+    int best = -1, best_bottom = 0, best_width = 0, best_y = 0;
+    for (int i = 0; i < page->node_count; i++) {
+        int fit = atlas_skyline_fit(page, i, width, height, size);
+        if (fit < 0)
+            continue;
+        int bottom = fit + height;
+        if (best < 0 || bottom < best_bottom ||
+            (bottom == best_bottom && page->nodes[i].width < best_width)) {
+            best = i;
+            best_bottom = bottom;
+            best_width = page->nodes[i].width;
+            best_y = fit;
+        }
+    }
+    if (best < 0)
+        return false;
+    *x = page->nodes[best].x;
+    *y = best_y;
+
+    ATLAS_GROW(page->nodes, page->node_count, page->node_capacity);
+    memmove(page->nodes + best + 1, page->nodes + best, (page->node_count - best) * sizeof(struct atlas_node));
+    page->nodes[best] = (struct atlas_node){*x, best_y + height, width};
+    page->node_count++;
+    // Trim or drop the segments now covered by the new one. Whatever was
+    // below the new rect's bottom edge is lost to the skyline, keep it as a hole.
+    int right = *x + width;
+    for (int i = best + 1; i < page->node_count;) {
+        struct atlas_node *node = &page->nodes[i];
+        if (node->x >= right)
+            break;
+        int covered = MIN(node->x + node->width, right) - node->x;
+        atlas_hole_add(page, node->x, node->y, covered, best_y - node->y);
+        if (node->x + node->width <= right) {
+            memmove(node, node + 1, (page->node_count - i - 1) * sizeof(struct atlas_node));
+            page->node_count--;
+        } else {
+            node->width -= covered;
+            node->x = right;
+            break;
+        }
+    }
+    for (int i = 0; i + 1 < page->node_count;) {
+        if (page->nodes[i].y == page->nodes[i + 1].y) {
+            page->nodes[i].width += page->nodes[i + 1].width;
+            memmove(page->nodes + i + 1, page->nodes + i + 2, (page->node_count - i - 2) * sizeof(struct atlas_node));
+            page->node_count--;
+        } else
+            i++;
+    }
+    return true;
+}
+
+static bool atlas_page_add(struct atlas *atlas, struct atlas_page **pages, int *count) {
+    if (atlas->max_pages > 0 && *count >= atlas->max_pages)
+        return false;
+    struct atlas_page *grown = realloc(*pages, (*count + 1) * sizeof(struct atlas_page));
+    if (!grown)
+        return false;
+    *pages = grown;
+    struct atlas_page *page = &grown[(*count)++];
+    memset(page, 0, sizeof(struct atlas_page));
+    atlas_page_reset(page, atlas->size);
+
+    GLint previous;
+    glGetIntegerv(GL_TEXTURE_BINDING_2D, &previous);
+    glGenTextures(1, &page->texture);
+    glBindTexture(GL_TEXTURE_2D, page->texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexImage2D(GL_TEXTURE_2D, 0, atlas->flags & TEXTURE_SRGB ? GL_SRGB8_ALPHA8 : GL_RGBA8,
+                 atlas->size, atlas->size, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    glBindTexture(GL_TEXTURE_2D, previous);
+    return true;
+}
+
+// Holes are tried on every page before the skyline of any page grows, new
+// pages are only created when nothing fits
+static bool atlas_allocate(struct atlas *atlas, struct atlas_page **pages, int *count, bool holes,
+                           int width, int height, int *page, int *x, int *y) {
+    if (width > atlas->size || height > atlas->size)
+        return false;
+    for (int i = 0; holes && i < *count; i++)
+        if (atlas_hole_take(&(*pages)[i], width, height, x, y)) {
+            *page = i;
+            goto found;
+        }
+    for (int i = 0; i < *count; i++)
+        if (atlas_skyline_take(&(*pages)[i], width, height, atlas->size, x, y)) {
+            *page = i;
+            goto found;
+        }
+    if (!atlas_page_add(atlas, pages, count))
+        return false;
+    *page = *count - 1;
+    if (!atlas_skyline_take(&(*pages)[*page], width, height, atlas->size, x, y))
+        return false;
+found:
+    (*pages)[*page].used += (size_t)width * height;
+    return true;
+}
+
+struct atlas* atlas_create(int size, int padding, int max_pages, int flags) {
+    if (size <= 0 || padding < 0 || padding * 2 >= size)
+        return NULL;
+    struct atlas *atlas = calloc(1, sizeof(struct atlas));
+    if (!atlas)
+        return NULL;
+    atlas->size = size;
+    atlas->padding = padding;
+    atlas->max_pages = max_pages;
+    atlas->flags = flags;
+    atlas->free_entry = -1;
+    return atlas;
+}
+
+void atlas_destroy(struct atlas *atlas) {
+    if (!atlas)
+        return;
+    for (int i = 0; i < atlas->page_count; i++)
+        atlas_page_free(&atlas->pages[i]);
+    if (atlas->framebuffers[0])
+        glDeleteFramebuffers(2, atlas->framebuffers);
+    free(atlas->pages);
+    free(atlas->entries);
+    free(atlas);
+}
+
+// Copies the image with its edge texels repeated `padding` times on every side
+static unsigned char* atlas_extrude(const unsigned char *pixels, int width, int height, int padding) {
+    int stride = width + padding * 2, rows = height + padding * 2;
+    unsigned char *padded = malloc((size_t)stride * rows * 4);
+    if (!padded)
+        return NULL;
+    for (int y = 0; y < rows; y++) {
+        int sy = MIN(MAX(y - padding, 0), height - 1);
+        const unsigned char *src = pixels + (size_t)sy * width * 4;
+        unsigned char *dst = padded + (size_t)y * stride * 4;
+        for (int x = 0; x < padding; x++) {
+            memcpy(dst + x * 4, src, 4);
+            memcpy(dst + (padding + width + x) * 4, src + (width - 1) * 4, 4);
+        }
+        memcpy(dst + padding * 4, src, (size_t)width * 4);
+    }
+    return padded;
+}
+
+static bool atlas_upload(struct atlas *atlas, GLuint texture, int x, int y, const unsigned char *pixels, int width, int height) {
+    const unsigned char *data = pixels;
+    unsigned char *padded = NULL;
+    if (atlas->padding) {
+        if (!(padded = atlas_extrude(pixels, width, height, atlas->padding)))
+            return false;
+        data = padded;
+        width += atlas->padding * 2;
+        height += atlas->padding * 2;
+    }
+    GLint previous, unpack;
+    glGetIntegerv(GL_TEXTURE_BINDING_2D, &previous);
+    glGetIntegerv(GL_PIXEL_UNPACK_BUFFER_BINDING, &unpack);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height, GL_RGBA, GL_UNSIGNED_BYTE, data);
+    glBindTexture(GL_TEXTURE_2D, previous);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, unpack);
+    free(padded);
+    return true;
+}
+
+static int atlas_entry_new(struct atlas *atlas) {
+    if (atlas->free_entry >= 0) {
+        int id = atlas->free_entry;
+        atlas->free_entry = atlas->entries[id].x;
+        return id;
+    }
+    ATLAS_GROW(atlas->entries, atlas->entry_count, atlas->entry_capacity);
+    return atlas->entry_count++;
+}
+
+int atlas_add(struct atlas *atlas, const void *pixels, int width, int height) {
+    if (!atlas || !pixels || width <= 0 || height <= 0)
+        return -1;
+    int padded_width = width + atlas->padding * 2;
+    int padded_height = height + atlas->padding * 2;
+    int page, x, y;
+    if (!atlas_allocate(atlas, &atlas->pages, &atlas->page_count, true, padded_width, padded_height, &page, &x, &y)) {
+        // Out of pages, merging the holes is the last resort
+        if (atlas->packed)
+            return -1;
+        atlas_defragment(atlas);
+        if (!atlas_allocate(atlas, &atlas->pages, &atlas->page_count, true, padded_width, padded_height, &page, &x, &y))
+            return -1;
+    }
+    struct atlas_page *target = &atlas->pages[page];
+    if (!atlas_upload(atlas, target->texture, x, y, pixels, width, height)) {
+        target->used -= (size_t)padded_width * padded_height;
+        atlas_hole_add(target, x, y, padded_width, padded_height);
+        return -1;
+    }
+    int id = atlas_entry_new(atlas);
+    atlas->entries[id] = (struct atlas_entry) {
+        .page = page,
+        .x = x + atlas->padding,
+        .y = y + atlas->padding,
+        .width = width,
+        .height = height
+    };
+    return id;
+}
+
+int atlas_add_file(struct atlas *atlas, const char *path, int flags) {
+    int width, height;
+    unsigned char *pixels = texture_decode_file(path, flags & TEXTURE_FLIP_Y, &width, &height);
+    if (!pixels)
+        return -1;
+    int id = atlas_add(atlas, pixels, width, height);
+    free(pixels);
+    return id;
+}
+
+static inline bool atlas_live(const struct atlas *atlas, int id) {
+    return atlas && id >= 0 && id < atlas->entry_count && atlas->entries[id].page >= 0;
+}
+
+void atlas_remove(struct atlas *atlas, int id) {
+    if (!atlas_live(atlas, id))
+        return;
+    struct atlas_entry *entry = &atlas->entries[id];
+    struct atlas_page *page = &atlas->pages[entry->page];
+    int padded_width = entry->width + atlas->padding * 2;
+    int padded_height = entry->height + atlas->padding * 2;
+    page->used -= (size_t)padded_width * padded_height;
+    // An empty page gets its whole skyline back, no defragmenting needed
+    if (!page->used)
+        atlas_page_reset(page, atlas->size);
+    else
+        atlas_hole_add(page, entry->x - atlas->padding, entry->y - atlas->padding, padded_width, padded_height);
+    entry->page = -1;
+    atlas->packed = false;
+    entry->x = atlas->free_entry;
+    atlas->free_entry = id;
+}
+
+bool atlas_rect(const struct atlas *atlas, int id, struct atlas_rect *rect) {
+    if (!atlas_live(atlas, id))
+        return false;
+    const struct atlas_entry *entry = &atlas->entries[id];
+    float scale = 1.f / atlas->size;
+    *rect = (struct atlas_rect) {
+        .page = entry->page,
+        .x = entry->x,
+        .y = entry->y,
+        .width = entry->width,
+        .height = entry->height,
+        .u0 = entry->x * scale,
+        .v0 = entry->y * scale,
+        .u1 = (entry->x + entry->width) * scale,
+        .v1 = (entry->y + entry->height) * scale
+    };
+    return true;
+}
+
+static struct atlas *atlas_sorting;
+
+static int atlas_compare(const void *a, const void *b) {
+    const struct atlas_entry *ea = &atlas_sorting->entries[*(const int*)a];
+    const struct atlas_entry *eb = &atlas_sorting->entries[*(const int*)b];
+    if (ea->height != eb->height)
+        return eb->height - ea->height;
+    if (ea->width != eb->width)
+        return eb->width - ea->width;
+    return *(const int*)a - *(const int*)b;
+}
+
+int atlas_defragment(struct atlas *atlas) {
+    if (!atlas)
+        return 0;
+    int count = 0;
+    int *order = malloc((atlas->entry_count ? atlas->entry_count : 1) * sizeof(int));
+    int *moved = malloc((atlas->entry_count ? atlas->entry_count : 1) * sizeof(int) * 3);
+    if (!order || !moved) {
+        free(order);
+        free(moved);
+        return atlas->page_count;
+    }
+    for (int i = 0; i < atlas->entry_count; i++)
+        if (atlas->entries[i].page >= 0)
+            order[count++] = i;
+    atlas_sorting = atlas;
+    qsort(order, count, sizeof(int), atlas_compare);
+
+    // Pack into a fresh set of pages first, the old ones stay untouched
+    // until everything has found a place
+    struct atlas_page *pages = NULL;
+    int page_count = 0;
+    for (int i = 0; i < count; i++) {
+        struct atlas_entry *entry = &atlas->entries[order[i]];
+        int *to = moved + i * 3;
+        if (!atlas_allocate(atlas, &pages, &page_count, false,
+                            entry->width + atlas->padding * 2, entry->height + atlas->padding * 2,
+                            &to[0], &to[1], &to[2])) {
+            for (int j = 0; j < page_count; j++)
+                atlas_page_free(&pages[j]);
+            free(pages);
+            free(order);
+            free(moved);
+            return atlas->page_count;
+        }
+    }
+
+    GLint read, draw;
+    glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &read);
+    glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &draw);
+    GLboolean scissor = glIsEnabled(GL_SCISSOR_TEST);
+    GLboolean srgb = glIsEnabled(GL_FRAMEBUFFER_SRGB);
+    if (!atlas->framebuffers[0])
+        glGenFramebuffers(2, atlas->framebuffers);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, atlas->framebuffers[0]);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, atlas->framebuffers[1]);
+    glDisable(GL_SCISSOR_TEST);
+    glDisable(GL_FRAMEBUFFER_SRGB);
+    GLuint source = 0, target = 0;
+    for (int i = 0; i < count; i++) {
+        struct atlas_entry *entry = &atlas->entries[order[i]];
+        int *to = moved + i * 3;
+        GLuint from_texture = atlas->pages[entry->page].texture;
+        GLuint to_texture = pages[to[0]].texture;
+        if (from_texture != source)
+            glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, source = from_texture, 0);
+        if (to_texture != target)
+            glFramebufferTexture2D(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, target = to_texture, 0);
+        int x = entry->x - atlas->padding, y = entry->y - atlas->padding;
+        int width = entry->width + atlas->padding * 2, height = entry->height + atlas->padding * 2;
+        glBlitFramebuffer(x, y, x + width, y + height,
+                          to[1], to[2], to[1] + width, to[2] + height,
+                          GL_COLOR_BUFFER_BIT, GL_NEAREST);
+        entry->page = to[0];
+        entry->x = to[1] + atlas->padding;
+        entry->y = to[2] + atlas->padding;
+    }
+    // Detach so the old textures can actually be released
+    glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0, 0);
+    glFramebufferTexture2D(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0, 0);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, read);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, draw);
+    if (scissor)
+        glEnable(GL_SCISSOR_TEST);
+    if (srgb)
+        glEnable(GL_FRAMEBUFFER_SRGB);
+
+    for (int i = 0; i < atlas->page_count; i++)
+        atlas_page_free(&atlas->pages[i]);
+    free(atlas->pages);
+    atlas->pages = pages;
+    atlas->page_count = page_count;
+    atlas->packed = true;
+    free(order);
+    free(moved);
+    return page_count;
+}
+
+int atlas_pages(const struct atlas *atlas) {
+    return atlas ? atlas->page_count : 0;
+}
+
+GLuint atlas_texture(const struct atlas *atlas, int page) {
+    return atlas && page >= 0 && page < atlas->page_count ? atlas->pages[page].texture : 0;
+}
+
+float atlas_occupancy(const struct atlas *atlas) {
+    if (!atlas || !atlas->page_count)
+        return 0.f;
+    size_t used = 0;
+    for (int i = 0; i < atlas->page_count; i++)
+        used += atlas->pages[i].used;
+    return (float)((double)used / ((double)atlas->size * atlas->size * atlas->page_count));
+}
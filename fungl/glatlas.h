@@ -0,0 +1,84 @@
+/* glatlas.h --  https://github.com/takeiteasy/fungl
+
+ fungl puts the fun back into OpenGL
+
+ Copyright (C) 2024  George Watson
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+ Runtime texture atlases. Images are packed into square RGBA8 pages with a
+ skyline allocator, so a UI made of hundreds of icons binds one texture and
+ can be drawn in a single call. Every image is surrounded by `padding`
+ texels of its own extruded edge, which keeps linear filtering from bleeding
+ neighbours in.
+
+    struct atlas *icons = atlas_create(2048, 1, 2, 0);
+    int save = atlas_add_file(icons, "save.png", 0);
+    struct atlas_rect r;
+    atlas_rect(icons, save, &r);
+    glBindTexture(GL_TEXTURE_2D, atlas_texture(icons, r.page));
+
+ Removed images leave holes that later images of the same size or smaller
+ fill again. Holes between them are only merged by atlas_defragment, which
+ repacks every page from scratch and blits the texels over on the GPU, so
+ both sets of pages exist while it runs. Rects (but not ids) change and
+ have to be fetched again afterwards. */
+
+#if !defined(glatlas_h) && !defined(FUNGL_NO_ATLAS)
+#define glatlas_h
+#if defined(__cplusplus)
+extern "C" {
+#endif
+#include "gl.h"
+#if FUNGL_VERSION < GL_VERSION_3_2
+#error "glatlas.h requires FUNGL_VERSION >= GL_VERSION_3_2"
+#endif
+#include "gltexture.h"
+#ifndef gltexture_h
+#error "glatlas.h requires gltexture.h, don't define FUNGL_NO_TEXTURE"
+#endif
+#include <stdbool.h>
+
+struct atlas;
+
+struct atlas_rect {
+    int page;
+    // Texels, excluding the padding
+    int x, y, width, height;
+    float u0, v0, u1, v1;
+};
+
+// `size` is the width and height of each page, at most `max_pages` (<= 0
+// means unlimited) are created. TEXTURE_SRGB in `flags` picks the format.
+struct atlas* atlas_create(int size, int padding, int max_pages, int flags);
+void atlas_destroy(struct atlas *atlas);
+// Packs RGBA8 `pixels` and returns an id >= 0, or -1 when the image doesn't
+// fit even after defragmenting. Ids of removed images are reused.
+int atlas_add(struct atlas *atlas, const void *pixels, int width, int height);
+// Decodes through texture_decode_file, only TEXTURE_FLIP_Y is used
+int atlas_add_file(struct atlas *atlas, const char *path, int flags);
+void atlas_remove(struct atlas *atlas, int id);
+bool atlas_rect(const struct atlas *atlas, int id, struct atlas_rect *rect);
+// Repacks every image, tallest first, and releases pages left empty.
+// Returns the number of pages in use afterwards.
+int atlas_defragment(struct atlas *atlas);
+int atlas_pages(const struct atlas *atlas);
+GLuint atlas_texture(const struct atlas *atlas, int page);
+// Fraction of the allocated pages covered by images (including padding)
+float atlas_occupancy(const struct atlas *atlas);
+
+#if defined(__cplusplus)
+}
+#endif
+#endif /* glatlas_h */
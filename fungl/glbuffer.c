@@ -0,0 +1,680 @@
+/* glbuffer.c --  https://github.com/takeiteasy/fungl
+
+ fungl puts the fun back into OpenGL
+
+ Copyright (C) 2024  George Watson
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+#include "glbuffer.h"
+#include "glut.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if FUNGL_VERSION >= GL_VERSION_4_4
+#define BUFFER_PERSISTENT
+#endif
+
+struct buffer_ring {
+    GLuint buffer;
+    size_t frame_size;
+    int frames;
+    int frame;
+    // Bytes allocated in the current segment
+    size_t head;
+    GLsync fences[BUFFER_RING_MAX_FRAMES];
+    // The whole buffer when persistent, otherwise the window of the current
+    // segment from `mapped_from` to its end
+    unsigned char *mapped;
+    size_t mapped_from;
+};
+
+static void buffer_ring_frame(void *userdata) {
+    buffer_ring_end_frame(userdata);
+}
+
+struct buffer_ring* buffer_ring_create(size_t frame_size, int frames) {
+    if (!frame_size)
+        return NULL;
+    if (frames <= 0)
+        frames = BUFFER_RING_FRAMES;
+    if (frames > BUFFER_RING_MAX_FRAMES)
+        frames = BUFFER_RING_MAX_FRAMES;
+    struct buffer_ring *ring = calloc(1, sizeof(struct buffer_ring));
+    if (!ring)
+        return NULL;
+    // A ring that isn't advanced would hand out memory still in flight, so
+    // none is created once GLUT_MAX_FRAME_FUNCS are taken
+    if (!glutAddFrameFunc(buffer_ring_frame, ring)) {
+        free(ring);
+        return NULL;
+    }
+    ring->frame_size = frame_size;
+    ring->frames = frames;
+    GLsizeiptr size = (GLsizeiptr)(frame_size * frames);
+    glGenBuffers(1, &ring->buffer);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, ring->buffer);
+#ifdef BUFFER_PERSISTENT
+    GLbitfield access = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    glBufferStorage(GL_COPY_WRITE_BUFFER, size, NULL, access);
+    ring->mapped = glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, size, access);
+    if (!ring->mapped) {
+        glutRemoveFrameFunc(buffer_ring_frame, ring);
+        glDeleteBuffers(1, &ring->buffer);
+        free(ring);
+        return NULL;
+    }
+#else
+    glBufferData(GL_COPY_WRITE_BUFFER, size, NULL, GL_STREAM_DRAW);
+#endif
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    return ring;
+}
+
+void buffer_ring_destroy(struct buffer_ring *ring) {
+    if (!ring)
+        return;
+    glutRemoveFrameFunc(buffer_ring_frame, ring);
+    for (int i = 0; i < ring->frames; i++)
+        if (ring->fences[i])
+            glDeleteSync(ring->fences[i]);
+    // Deleting a mapped buffer implicitly unmaps it
+    glDeleteBuffers(1, &ring->buffer);
+    free(ring);
+}
+
+static inline size_t buffer_segment(const struct buffer_ring *ring) {
+    return (size_t)ring->frame * ring->frame_size;
+}
+
+bool buffer_ring_alloc(struct buffer_ring *ring, size_t size, size_t align, struct buffer_alloc *out) {
+    if (!ring || !out)
+        return false;
+    size_t offset = ring->head;
+    if (align > 1)
+        offset = (offset + align - 1) & ~(align - 1);
+    if (offset > ring->frame_size || size > ring->frame_size - offset)
+        return false;
+#ifdef BUFFER_PERSISTENT
+    out->ptr = ring->mapped + buffer_segment(ring) + offset;
+#else
+    if (!ring->mapped) {
+        // The fence wait in buffer_ring_end_frame already made sure the GPU
+        // is done with this segment, no need for the driver to sync again
+        glBindBuffer(GL_COPY_WRITE_BUFFER, ring->buffer);
+        ring->mapped = glMapBufferRange(GL_COPY_WRITE_BUFFER, (GLintptr)(buffer_segment(ring) + offset),
+                                        (GLsizeiptr)(ring->frame_size - offset),
+                                        GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT |
+                                        GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_FLUSH_EXPLICIT_BIT);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+        if (!ring->mapped)
+            return false;
+        ring->mapped_from = offset;
+    }
+    out->ptr = ring->mapped + (offset - ring->mapped_from);
+#endif
+    out->buffer = ring->buffer;
+    out->offset = (GLintptr)(buffer_segment(ring) + offset);
+    ring->head = offset + size;
+    return true;
+}
+
+void buffer_ring_shrink(struct buffer_ring *ring, const struct buffer_alloc *alloc, size_t size) {
+    if (!ring || !alloc || alloc->buffer != ring->buffer || (size_t)alloc->offset < buffer_segment(ring))
+        return;
+    size_t offset = (size_t)alloc->offset - buffer_segment(ring);
+    if (offset <= ring->head && size < ring->head - offset)
+        ring->head = offset + size;
+}
+
+void buffer_ring_flush(struct buffer_ring *ring) {
+#ifndef BUFFER_PERSISTENT
+    if (!ring || !ring->mapped)
+        return;
+    glBindBuffer(GL_COPY_WRITE_BUFFER, ring->buffer);
+    if (ring->head > ring->mapped_from)
+        glFlushMappedBufferRange(GL_COPY_WRITE_BUFFER, 0, (GLsizeiptr)(ring->head - ring->mapped_from));
+    glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    ring->mapped = NULL;
+#else
+    (void)ring;
+#endif
+}
+
+void buffer_ring_end_frame(struct buffer_ring *ring) {
+    if (!ring)
+        return;
+    buffer_ring_flush(ring);
+    if (ring->head)
+        ring->fences[ring->frame] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    ring->frame = (ring->frame + 1) % ring->frames;
+    ring->head = 0;
+    GLsync fence = ring->fences[ring->frame];
+    if (!fence)
+        return;
+    // Only stalls when the CPU is a whole ring of frames ahead
+    GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+    for (;;) {
+        GLenum status = glClientWaitSync(fence, flags, 1000000);
+        if (status != GL_TIMEOUT_EXPIRED)
+            break;
+        flags = 0;
+    }
+    glDeleteSync(fence);
+    ring->fences[ring->frame] = NULL;
+}
+
+GLuint buffer_ring_buffer(const struct buffer_ring *ring) {
+    return ring ? ring->buffer : 0;
+}
+
+size_t buffer_ring_used(const struct buffer_ring *ring) {
+    return ring ? ring->head : 0;
+}
+
+size_t buffer_uniform_alignment(void) {
+    static GLint alignment = 0;
+    if (!alignment)
+        glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+    return alignment > 0 ? (size_t)alignment : 256;
+}
+
+// Block offsets and sizes are multiples of a granule, free blocks are
+// binned TLSF style by the position of their top bit (first level) and the
+// next BUFFER_HEAP_SL_LOG2 bits (second level)
+#define BUFFER_HEAP_GRANULE_LOG2 4
+#define BUFFER_HEAP_GRANULE ((size_t)1 << BUFFER_HEAP_GRANULE_LOG2)
+#define BUFFER_HEAP_SL_LOG2 4
+#define BUFFER_HEAP_SL (1 << BUFFER_HEAP_SL_LOG2)
+// Sizes below this all land in first level 0, one granule per list
+#define BUFFER_HEAP_SMALL ((size_t)1 << (BUFFER_HEAP_SL_LOG2 + BUFFER_HEAP_GRANULE_LOG2))
+#define BUFFER_HEAP_FL 48
+
+#define BUFFER_HEAP_GROW(ARRAY, COUNT, CAPACITY)                                  \
+    do {                                                                          \
+        if ((COUNT) == (CAPACITY)) {                                              \
+            size_t capacity = (CAPACITY) ? (CAPACITY) * 2 : 16;                   \
+            void *grown = realloc((ARRAY), capacity * sizeof(*(ARRAY)));          \
+            if (!grown)                                                           \
+                abort();                                                          \
+            (ARRAY) = grown;                                                      \
+            (CAPACITY) = capacity;                                                \
+        }                                                                         \
+    } while (0)
+
+enum {
+    BUFFER_BLOCK_UNUSED,
+    BUFFER_BLOCK_FREE,
+    BUFFER_BLOCK_USED
+};
+
+struct buffer_heap_block {
+    // The whole block, the allocation starts `pad` bytes in to meet its
+    // alignment and is `used` bytes long
+    size_t offset, size;
+    size_t used, pad, align;
+    int arena;
+    int state;
+    // Neighbours in the same arena by offset, 0 if none
+    uint32_t prev, next;
+    // Free list links, unused slots are chained through `next_free`
+    uint32_t prev_free, next_free;
+};
+
+struct buffer_heap_arena {
+    GLuint buffer;
+    size_t size;
+    uint32_t first;
+};
+
+struct buffer_heap {
+    size_t arena_size;
+    int max_arenas;
+    struct buffer_heap_arena *arenas;
+    size_t arena_count, arena_capacity;
+    // Handles index this, slot 0 is reserved so 0 can mean no block
+    struct buffer_heap_block *blocks;
+    size_t block_count, block_capacity;
+    uint32_t unused;
+    uint64_t fl_bitmap;
+    uint32_t sl_bitmap[BUFFER_HEAP_FL];
+    uint32_t free_lists[BUFFER_HEAP_FL][BUFFER_HEAP_SL];
+    size_t used;
+    // Set by buffer_heap_compact, cleared by the next free
+    bool packed;
+};
+
+static inline size_t buffer_granules(size_t size) {
+    return (size + BUFFER_HEAP_GRANULE - 1) & ~(BUFFER_HEAP_GRANULE - 1);
+}
+
+static inline size_t buffer_pad(size_t offset, size_t align) {
+    return (align - offset % align) % align;
+}
+
+static void buffer_heap_mapping(size_t size, int *fl, int *sl) {
+    if (size < BUFFER_HEAP_SMALL) {
+        *fl = 0;
+        *sl = (int)(size >> BUFFER_HEAP_GRANULE_LOG2);
+    } else {
+        int top = 63 - __builtin_clzll((unsigned long long)size);
+        *sl = (int)(size >> (top - BUFFER_HEAP_SL_LOG2)) ^ BUFFER_HEAP_SL;
+        *fl = top - (BUFFER_HEAP_SL_LOG2 + BUFFER_HEAP_GRANULE_LOG2) + 1;
+    }
+}
+
+static uint32_t buffer_heap_slot(struct buffer_heap *heap) {
+    uint32_t index = heap->unused;
+    if (index)
+        heap->unused = heap->blocks[index].next_free;
+    else {
+        BUFFER_HEAP_GROW(heap->blocks, heap->block_count, heap->block_capacity);
+        index = (uint32_t)heap->block_count++;
+    }
+    memset(&heap->blocks[index], 0, sizeof(struct buffer_heap_block));
+    return index;
+}
+
+static void buffer_heap_release_slot(struct buffer_heap *heap, uint32_t index) {
+    heap->blocks[index].state = BUFFER_BLOCK_UNUSED;
+    heap->blocks[index].next_free = heap->unused;
+    heap->unused = index;
+}
+
+static void buffer_heap_insert(struct buffer_heap *heap, uint32_t index) {
+    struct buffer_heap_block *block = &heap->blocks[index];
+    int fl, sl;
+    buffer_heap_mapping(block->size, &fl, &sl);
+    block->state = BUFFER_BLOCK_FREE;
+    block->prev_free = 0;
+    block->next_free = heap->free_lists[fl][sl];
+    if (block->next_free)
+        heap->blocks[block->next_free].prev_free = index;
+    heap->free_lists[fl][sl] = index;
+    heap->fl_bitmap |= 1ull << fl;
+    heap->sl_bitmap[fl] |= 1u << sl;
+}
+
+static void buffer_heap_unlink(struct buffer_heap *heap, uint32_t index) {
+    struct buffer_heap_block *block = &heap->blocks[index];
+    int fl, sl;
+    buffer_heap_mapping(block->size, &fl, &sl);
+    if (block->prev_free)
+        heap->blocks[block->prev_free].next_free = block->next_free;
+    else {
+        heap->free_lists[fl][sl] = block->next_free;
+        if (!block->next_free) {
+            heap->sl_bitmap[fl] &= ~(1u << sl);
+            if (!heap->sl_bitmap[fl])
+                heap->fl_bitmap &= ~(1ull << fl);
+        }
+    }
+    if (block->next_free)
+        heap->blocks[block->next_free].prev_free = block->prev_free;
+}
+
+// Good fit: every block in the first non-empty list at or above the rounded
+// up size is large enough, so there's no searching within a list
+static uint32_t buffer_heap_find(const struct buffer_heap *heap, size_t size) {
+    if (size >= BUFFER_HEAP_SMALL) {
+        int top = 63 - __builtin_clzll((unsigned long long)size);
+        size += ((size_t)1 << (top - BUFFER_HEAP_SL_LOG2)) - 1;
+    }
+    int fl, sl;
+    buffer_heap_mapping(size, &fl, &sl);
+    if (fl >= BUFFER_HEAP_FL)
+        return 0;
+    uint32_t sl_map = heap->sl_bitmap[fl] & (~0u << sl);
+    if (!sl_map) {
+        uint64_t fl_map = fl + 1 < 64 ? heap->fl_bitmap & (~0ull << (fl + 1)) : 0;
+        if (!fl_map)
+            return 0;
+        fl = __builtin_ctzll(fl_map);
+        sl_map = heap->sl_bitmap[fl];
+    }
+    return heap->free_lists[fl][__builtin_ctz(sl_map)];
+}
+
+static GLuint buffer_heap_new_buffer(size_t size) {
+    GLuint buffer = 0;
+    glGenBuffers(1, &buffer);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+    glBufferData(GL_COPY_WRITE_BUFFER, (GLsizeiptr)size, NULL, GL_STATIC_DRAW);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    return buffer;
+}
+
+// Returns the free block spanning the new arena, 0 if no more are allowed
+static uint32_t buffer_heap_grow(struct buffer_heap *heap, size_t size) {
+    if (heap->max_arenas > 0 && heap->arena_count >= (size_t)heap->max_arenas)
+        return 0;
+    if (size < heap->arena_size)
+        size = heap->arena_size;
+    BUFFER_HEAP_GROW(heap->arenas, heap->arena_count, heap->arena_capacity);
+    uint32_t index = buffer_heap_slot(heap);
+    struct buffer_heap_arena *arena = &heap->arenas[heap->arena_count];
+    arena->buffer = buffer_heap_new_buffer(size);
+    arena->size = size;
+    arena->first = index;
+    heap->blocks[index].size = size;
+    heap->blocks[index].arena = (int)heap->arena_count++;
+    buffer_heap_insert(heap, index);
+    return index;
+}
+
+struct buffer_heap* buffer_heap_create(size_t arena_size, int max_arenas) {
+    if (!arena_size)
+        return NULL;
+    struct buffer_heap *heap = calloc(1, sizeof(struct buffer_heap));
+    if (!heap)
+        return NULL;
+    heap->arena_size = buffer_granules(arena_size);
+    heap->max_arenas = max_arenas;
+    BUFFER_HEAP_GROW(heap->blocks, heap->block_count, heap->block_capacity);
+    heap->block_count = 1;
+    return heap;
+}
+
+void buffer_heap_destroy(struct buffer_heap *heap) {
+    if (!heap)
+        return;
+    for (size_t i = 0; i < heap->arena_count; i++)
+        glDeleteBuffers(1, &heap->arenas[i].buffer);
+    free(heap->arenas);
+    free(heap->blocks);
+    free(heap);
+}
+
+buffer_handle buffer_heap_alloc(struct buffer_heap *heap, size_t size, size_t align, const void *data) {
+    if (!heap || !size)
+        return 0;
+    if (!align)
+        align = 1;
+    // Offsets are already granule aligned, anything else (e.g. a 12 byte
+    // stride) may need up to `align - 1` bytes of padding in front
+    size_t need = size;
+    if (BUFFER_HEAP_GRANULE % align)
+        need += align - 1;
+    need = buffer_granules(need);
+    // The search rounds up to the next size class, which a fresh arena of
+    // exactly `need` bytes can fall short of, so its block is taken directly
+    uint32_t index = buffer_heap_find(heap, need);
+    if (!index && !(index = buffer_heap_grow(heap, need)))
+        return 0;
+    buffer_heap_unlink(heap, index);
+    if (heap->blocks[index].size > need) {
+        uint32_t rest = buffer_heap_slot(heap);
+        struct buffer_heap_block *block = &heap->blocks[index], *tail = &heap->blocks[rest];
+        tail->offset = block->offset + need;
+        tail->size = block->size - need;
+        tail->arena = block->arena;
+        tail->prev = index;
+        tail->next = block->next;
+        if (block->next)
+            heap->blocks[block->next].prev = rest;
+        block->next = rest;
+        block->size = need;
+        buffer_heap_insert(heap, rest);
+    }
+    struct buffer_heap_block *block = &heap->blocks[index];
+    block->state = BUFFER_BLOCK_USED;
+    block->used = size;
+    block->align = align;
+    block->pad = buffer_pad(block->offset, align);
+    heap->used += size;
+    if (data) {
+        glBindBuffer(GL_COPY_WRITE_BUFFER, heap->arenas[block->arena].buffer);
+        glBufferSubData(GL_COPY_WRITE_BUFFER, (GLintptr)(block->offset + block->pad), (GLsizeiptr)size, data);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    }
+    return index;
+}
+
+static inline bool buffer_heap_valid(const struct buffer_heap *heap, buffer_handle handle) {
+    return heap && handle && handle < heap->block_count && heap->blocks[handle].state == BUFFER_BLOCK_USED;
+}
+
+void buffer_heap_free(struct buffer_heap *heap, buffer_handle handle) {
+    if (!buffer_heap_valid(heap, handle))
+        return;
+    uint32_t index = handle;
+    heap->used -= heap->blocks[index].used;
+    heap->packed = false;
+    uint32_t prev = heap->blocks[index].prev;
+    if (prev && heap->blocks[prev].state == BUFFER_BLOCK_FREE) {
+        buffer_heap_unlink(heap, prev);
+        heap->blocks[prev].size += heap->blocks[index].size;
+        heap->blocks[prev].next = heap->blocks[index].next;
+        if (heap->blocks[index].next)
+            heap->blocks[heap->blocks[index].next].prev = prev;
+        buffer_heap_release_slot(heap, index);
+        index = prev;
+    }
+    uint32_t next = heap->blocks[index].next;
+    if (next && heap->blocks[next].state == BUFFER_BLOCK_FREE) {
+        buffer_heap_unlink(heap, next);
+        heap->blocks[index].size += heap->blocks[next].size;
+        heap->blocks[index].next = heap->blocks[next].next;
+        if (heap->blocks[next].next)
+            heap->blocks[heap->blocks[next].next].prev = index;
+        buffer_heap_release_slot(heap, next);
+    }
+    buffer_heap_insert(heap, index);
+}
+
+bool buffer_heap_get(const struct buffer_heap *heap, buffer_handle handle, struct buffer_block *out) {
+    if (!buffer_heap_valid(heap, handle) || !out)
+        return false;
+    const struct buffer_heap_block *block = &heap->blocks[handle];
+    out->buffer = heap->arenas[block->arena].buffer;
+    out->offset = (GLintptr)(block->offset + block->pad);
+    out->size = block->used;
+    return true;
+}
+
+struct buffer_heap_move {
+    uint32_t index;
+    int arena;
+    size_t offset, size, pad;
+};
+
+int buffer_heap_compact(struct buffer_heap *heap) {
+    if (!heap)
+        return 0;
+    if (heap->packed)
+        return (int)heap->arena_count;
+    // Plan first, in arena and offset order, so nothing is touched if the
+    // packed layout would need more arenas than allowed
+    struct buffer_heap_move *moves = NULL;
+    size_t move_count = 0, move_capacity = 0;
+    size_t *sizes = NULL, size_count = 0, size_capacity = 0;
+    size_t cursor = 0;
+    for (size_t i = 0; i < heap->arena_count; i++)
+        for (uint32_t b = heap->arenas[i].first; b; b = heap->blocks[b].next) {
+            const struct buffer_heap_block *block = &heap->blocks[b];
+            if (block->state != BUFFER_BLOCK_USED)
+                continue;
+            size_t pad = buffer_pad(cursor, block->align);
+            size_t need = buffer_granules(pad + block->used);
+            if (!size_count || need > sizes[size_count - 1] - cursor) {
+                pad = 0;
+                need = buffer_granules(block->used);
+                BUFFER_HEAP_GROW(sizes, size_count, size_capacity);
+                sizes[size_count++] = need > heap->arena_size ? need : heap->arena_size;
+                cursor = 0;
+            }
+            BUFFER_HEAP_GROW(moves, move_count, move_capacity);
+            moves[move_count++] = (struct buffer_heap_move) {
+                .index = b,
+                .arena = (int)size_count - 1,
+                .offset = cursor,
+                .size = need,
+                .pad = pad
+            };
+            cursor += need;
+        }
+    if (heap->max_arenas > 0 && size_count > (size_t)heap->max_arenas) {
+        free(moves);
+        free(sizes);
+        return (int)heap->arena_count;
+    }
+
+    struct buffer_heap_arena *arenas = size_count ? calloc(size_count, sizeof(struct buffer_heap_arena)) : NULL;
+    if (size_count && !arenas)
+        abort();
+    for (size_t i = 0; i < size_count; i++) {
+        arenas[i].buffer = buffer_heap_new_buffer(sizes[i]);
+        arenas[i].size = sizes[i];
+    }
+    // Both sets of buffers exist until every allocation has been copied
+    for (size_t i = 0; i < move_count; i++) {
+        const struct buffer_heap_move *move = &moves[i];
+        const struct buffer_heap_block *block = &heap->blocks[move->index];
+        glBindBuffer(GL_COPY_READ_BUFFER, heap->arenas[block->arena].buffer);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, arenas[move->arena].buffer);
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER,
+                            (GLintptr)(block->offset + block->pad),
+                            (GLintptr)(move->offset + move->pad),
+                            (GLsizeiptr)block->used);
+    }
+    glBindBuffer(GL_COPY_READ_BUFFER, 0);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    for (size_t i = 0; i < heap->arena_count; i++)
+        glDeleteBuffers(1, &heap->arenas[i].buffer);
+    free(heap->arenas);
+    heap->arenas = arenas;
+    heap->arena_count = heap->arena_capacity = size_count;
+
+    // Rebuild the block lists, allocated blocks keep their slots (and so
+    // their handles), free blocks are dropped and one remains per arena tail
+    for (size_t i = 1; i < heap->block_count; i++)
+        if (heap->blocks[i].state == BUFFER_BLOCK_FREE)
+            buffer_heap_release_slot(heap, (uint32_t)i);
+    heap->fl_bitmap = 0;
+    memset(heap->sl_bitmap, 0, sizeof(heap->sl_bitmap));
+    memset(heap->free_lists, 0, sizeof(heap->free_lists));
+    uint32_t last = 0;
+    for (size_t i = 0; i < move_count; i++) {
+        const struct buffer_heap_move *move = &moves[i];
+        struct buffer_heap_block *block = &heap->blocks[move->index];
+        bool first = !move->offset;
+        block->offset = move->offset;
+        block->size = move->size;
+        block->pad = move->pad;
+        block->arena = move->arena;
+        block->prev = first ? 0 : last;
+        block->next = 0;
+        if (first)
+            heap->arenas[move->arena].first = move->index;
+        else
+            heap->blocks[last].next = move->index;
+        last = move->index;
+        if (i + 1 == move_count || moves[i + 1].arena != move->arena) {
+            size_t end = move->offset + move->size;
+            size_t arena_size = heap->arenas[move->arena].size;
+            if (end < arena_size) {
+                uint32_t tail = buffer_heap_slot(heap);
+                heap->blocks[tail].offset = end;
+                heap->blocks[tail].size = arena_size - end;
+                heap->blocks[tail].arena = move->arena;
+                heap->blocks[tail].prev = move->index;
+                heap->blocks[move->index].next = tail;
+                buffer_heap_insert(heap, tail);
+            }
+        }
+    }
+    free(moves);
+    free(sizes);
+    heap->packed = true;
+    return (int)heap->arena_count;
+}
+
+size_t buffer_heap_used(const struct buffer_heap *heap) {
+    return heap ? heap->used : 0;
+}
+
+size_t buffer_heap_capacity(const struct buffer_heap *heap) {
+    size_t total = 0;
+    if (heap)
+        for (size_t i = 0; i < heap->arena_count; i++)
+            total += heap->arenas[i].size;
+    return total;
+}
+
+static size_t buffer_index_size(GLenum type) {
+    switch (type) {
+        case GL_UNSIGNED_BYTE:
+            return 1;
+        case GL_UNSIGNED_SHORT:
+            return 2;
+        case GL_UNSIGNED_INT:
+            return 4;
+        default:
+            return 0;
+    }
+}
+
+bool buffer_mesh_create(struct buffer_heap *vertex_heap, struct buffer_heap *index_heap,
+                        const void *vertices, size_t vertex_count, GLsizei stride,
+                        const void *indices, GLsizei index_count, GLenum type, struct buffer_mesh *mesh) {
+    size_t index_size = buffer_index_size(type);
+    if (!vertex_heap || !index_heap || !mesh || !vertex_count || stride <= 0 || index_count <= 0 || !index_size)
+        return false;
+    buffer_handle v = buffer_heap_alloc(vertex_heap, vertex_count * (size_t)stride, (size_t)stride, vertices);
+    if (!v)
+        return false;
+    buffer_handle i = buffer_heap_alloc(index_heap, (size_t)index_count * index_size, index_size, indices);
+    if (!i) {
+        buffer_heap_free(vertex_heap, v);
+        return false;
+    }
+    mesh->vertices = v;
+    mesh->indices = i;
+    mesh->stride = stride;
+    mesh->count = index_count;
+    mesh->type = type;
+    return true;
+}
+
+void buffer_mesh_destroy(struct buffer_heap *vertex_heap, struct buffer_heap *index_heap, struct buffer_mesh *mesh) {
+    if (!mesh)
+        return;
+    buffer_heap_free(vertex_heap, mesh->vertices);
+    buffer_heap_free(index_heap, mesh->indices);
+    memset(mesh, 0, sizeof(struct buffer_mesh));
+}
+
+bool buffer_mesh_draw_args(const struct buffer_heap *vertex_heap, const struct buffer_heap *index_heap,
+                           const struct buffer_mesh *mesh, struct buffer_draw *draw) {
+    struct buffer_block v, i;
+    if (!mesh || !draw ||
+        !buffer_heap_get(vertex_heap, mesh->vertices, &v) ||
+        !buffer_heap_get(index_heap, mesh->indices, &i))
+        return false;
+    draw->vertex_buffer = v.buffer;
+    draw->index_buffer = i.buffer;
+    draw->indices = (const void*)i.offset;
+    draw->base_vertex = (GLint)(v.offset / mesh->stride);
+    draw->count = mesh->count;
+    draw->type = mesh->type;
+    return true;
+}
+
+void buffer_draw(const struct buffer_draw *draw, GLenum mode) {
+    if (!draw || !draw->count)
+        return;
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, draw->index_buffer);
+    glDrawElementsBaseVertex(mode, draw->count, draw->type, draw->indices, draw->base_vertex);
+}
@@ -0,0 +1,167 @@
+/* glbuffer.h --  https://github.com/takeiteasy/fungl
+
+ fungl puts the fun back into OpenGL
+
+ Copyright (C) 2024  George Watson
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+ Buffer management. A ring hands out per-frame scratch memory for dynamic
+ vertices, indices and uniforms: the buffer is split into one segment per
+ frame in flight, allocations bump through the current segment and a fence
+ marks when the GPU is done with it, so nothing ever waits on
+ glBufferSubData.
+
+    struct buffer_ring *ring = buffer_ring_create(4 << 20, 0);
+    struct buffer_alloc a;
+    if (buffer_ring_alloc(ring, sizeof(verts), 16, &a)) {
+        memcpy(a.ptr, verts, sizeof(verts));
+        buffer_ring_flush(ring);
+        glBindBuffer(GL_ARRAY_BUFFER, a.buffer);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, (void*)a.offset);
+    }
+
+ With FUNGL_VERSION >= GL_VERSION_4_4 the buffer is persistently and
+ coherently mapped once and buffer_ring_flush does nothing. Before that each
+ segment is mapped unsynchronized while it is written and buffer_ring_flush
+ unmaps it, which has to happen before drawing from it. Rings are advanced
+ by glutMainLoop, programs with their own loop call buffer_ring_end_frame
+ after submitting each frame.
+
+ A heap carves long lived data (static meshes) out of a few large buffers
+ ("arenas") with a TLSF allocator, so thousands of meshes share a handful
+ of binds. Handles stay valid for the life of an allocation, its buffer and
+ offset change only when buffer_heap_compact repacks the arenas.
+
+    struct buffer_heap *vertices = buffer_heap_create(64 << 20, 0);
+    struct buffer_heap *indices = buffer_heap_create(16 << 20, 0);
+    struct buffer_mesh mesh;
+    buffer_mesh_create(vertices, indices, verts, vert_count, sizeof(struct vertex),
+                       idx, idx_count, GL_UNSIGNED_SHORT, &mesh);
+    ...
+    struct buffer_draw draw;
+    buffer_mesh_draw_args(vertices, indices, &mesh, &draw);
+    // bind the VAO set up for draw.vertex_buffer
+    buffer_draw(&draw, GL_TRIANGLES);
+
+ Uploads, copies and mapping go through the GL_COPY_READ_BUFFER and
+ GL_COPY_WRITE_BUFFER bindings. */
+
+#if !defined(glbuffer_h) && !defined(FUNGL_NO_BUFFER)
+#define glbuffer_h
+#if defined(__cplusplus)
+extern "C" {
+#endif
+#include "gl.h"
+#if FUNGL_VERSION < GL_VERSION_3_2
+#error "glbuffer.h requires FUNGL_VERSION >= GL_VERSION_3_2"
+#endif
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef BUFFER_RING_FRAMES
+#define BUFFER_RING_FRAMES 3
+#endif
+#define BUFFER_RING_MAX_FRAMES 8
+
+struct buffer_ring;
+
+struct buffer_alloc {
+    void *ptr;
+    GLuint buffer;
+    GLintptr offset;
+};
+
+// `frames` <= 0 uses BUFFER_RING_FRAMES, the buffer holds `frame_size`
+// bytes for each of them. Every ring takes one of the GLUT_MAX_FRAME_FUNCS
+// glut frame funcs, NULL is returned when none is left.
+struct buffer_ring* buffer_ring_create(size_t frame_size, int frames);
+void buffer_ring_destroy(struct buffer_ring *ring);
+// `align` must be a power of two (or 0). Returns false when the current
+// frame's segment can't fit `size` more bytes.
+bool buffer_ring_alloc(struct buffer_ring *ring, size_t size, size_t align, struct buffer_alloc *out);
+// Gives back the end of the most recent allocation, keeping its first
+// `size` bytes. For writers that allocate for the worst case up front.
+void buffer_ring_shrink(struct buffer_ring *ring, const struct buffer_alloc *alloc, size_t size);
+// Makes everything allocated so far visible to the GPU
+void buffer_ring_flush(struct buffer_ring *ring);
+// Fences the current segment and moves on to the next, waiting if the GPU
+// is still reading it
+void buffer_ring_end_frame(struct buffer_ring *ring);
+GLuint buffer_ring_buffer(const struct buffer_ring *ring);
+// Bytes allocated in the current frame
+size_t buffer_ring_used(const struct buffer_ring *ring);
+// GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, for uniform blocks bound from a ring
+size_t buffer_uniform_alignment(void);
+
+struct buffer_heap;
+
+// 0 is never a valid handle
+typedef uint32_t buffer_handle;
+
+struct buffer_block {
+    GLuint buffer;
+    GLintptr offset;
+    size_t size;
+};
+
+// New arenas hold `arena_size` bytes (or the allocation that needed them),
+// at most `max_arenas` are created (<= 0 means unlimited)
+struct buffer_heap* buffer_heap_create(size_t arena_size, int max_arenas);
+void buffer_heap_destroy(struct buffer_heap *heap);
+// `align` may be any value (e.g. a vertex stride). `data` is uploaded if
+// not NULL. Returns 0 when out of arenas.
+buffer_handle buffer_heap_alloc(struct buffer_heap *heap, size_t size, size_t align, const void *data);
+void buffer_heap_free(struct buffer_heap *heap, buffer_handle handle);
+bool buffer_heap_get(const struct buffer_heap *heap, buffer_handle handle, struct buffer_block *block);
+// Copies every allocation into freshly packed arenas on the GPU and
+// releases the old ones, returns the number of arenas afterwards
+int buffer_heap_compact(struct buffer_heap *heap);
+size_t buffer_heap_used(const struct buffer_heap *heap);
+size_t buffer_heap_capacity(const struct buffer_heap *heap);
+
+struct buffer_mesh {
+    buffer_handle vertices, indices;
+    GLsizei stride;
+    GLsizei count;
+    GLenum type;
+};
+
+// Everything glDrawElementsBaseVertex needs for a mesh
+struct buffer_draw {
+    GLuint vertex_buffer, index_buffer;
+    const void *indices;
+    GLint base_vertex;
+    GLsizei count;
+    GLenum type;
+};
+
+// Vertices are aligned to `stride` so they can be addressed by base vertex.
+// `type` is GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT or GL_UNSIGNED_INT.
+bool buffer_mesh_create(struct buffer_heap *vertex_heap, struct buffer_heap *index_heap,
+                        const void *vertices, size_t vertex_count, GLsizei stride,
+                        const void *indices, GLsizei index_count, GLenum type, struct buffer_mesh *mesh);
+void buffer_mesh_destroy(struct buffer_heap *vertex_heap, struct buffer_heap *index_heap, struct buffer_mesh *mesh);
+// Resolves the handles, fetch again after buffer_heap_compact
+bool buffer_mesh_draw_args(const struct buffer_heap *vertex_heap, const struct buffer_heap *index_heap,
+                           const struct buffer_mesh *mesh, struct buffer_draw *draw);
+// Binds the index buffer and calls glDrawElementsBaseVertex, the bound
+// vertex array has to source its attributes from `draw->vertex_buffer`
+void buffer_draw(const struct buffer_draw *draw, GLenum mode);
+
+#if defined(__cplusplus)
+}
+#endif
+#endif /* glbuffer_h */
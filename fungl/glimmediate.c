@@ -0,0 +1,900 @@
+/* glimmediate.c --  https://github.com/takeiteasy/fungl
+
+ fungl puts the fun back into OpenGL
+
+ Copyright (C) 2024  George Watson
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+// The wrappers would otherwise route the calls below back in here
+#undef FUNGL_IMMEDIATE_COMPAT
+#include "glimmediate.h"
+#include "glut.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+// Transformed to clip space (or into a display list's space) on the CPU
+struct immediate_vertex {
+    float position[4];
+    float uv[2];
+    unsigned char color[4];
+    // 255 for vertices of a display list that take the color current at
+    // glCallList instead of their own
+    unsigned char inherit, pad[3];
+};
+
+enum immediate_primitive {
+    IMMEDIATE_POINTS = 0,
+    IMMEDIATE_LINES,
+    IMMEDIATE_TRIANGLES
+};
+
+static const GLenum immediate_primitive_modes[] = {GL_POINTS, GL_LINES, GL_TRIANGLES};
+
+enum immediate_op_type {
+    IMMEDIATE_OP_DRAW = 0,
+    IMMEDIATE_OP_CALL,
+    IMMEDIATE_OP_COLOR,
+    IMMEDIATE_OP_TEXTURING,
+    IMMEDIATE_OP_ENABLE,
+    IMMEDIATE_OP_DISABLE,
+    IMMEDIATE_OP_BIND_TEXTURE,
+    IMMEDIATE_OP_BLEND_FUNC,
+    IMMEDIATE_OP_DEPTH_FUNC,
+    IMMEDIATE_OP_DEPTH_MASK,
+    IMMEDIATE_OP_LINE_WIDTH,
+    IMMEDIATE_OP_POINT_SIZE,
+    IMMEDIATE_OP_CLEAR
+};
+
+struct immediate_op {
+    enum immediate_op_type type;
+    union {
+        struct {
+            enum immediate_primitive primitive;
+            // Indices into the list's mesh
+            uint32_t first, count;
+        } draw;
+        // Every other op, whichever fields it needs
+        struct {
+            GLenum a, b;
+            float value;
+            unsigned char color[4];
+        } state;
+        GLuint list;
+    };
+};
+
+struct immediate_display_list {
+    bool used, compiled;
+    struct immediate_op *ops;
+    size_t op_count, op_capacity;
+    struct buffer_mesh mesh;
+    bool has_mesh;
+    // The modelview change a call leaves behind
+    mat4 delta;
+    bool has_delta;
+};
+
+static const struct {
+    const char *name;
+    GLint size;
+    GLenum type;
+    GLboolean normalized;
+    size_t offset;
+} immediate_attributes[] = {
+    {"position", 4, GL_FLOAT, GL_FALSE, offsetof(struct immediate_vertex, position)},
+    {"uv", 2, GL_FLOAT, GL_FALSE, offsetof(struct immediate_vertex, uv)},
+    {"color", 4, GL_UNSIGNED_BYTE, GL_TRUE, offsetof(struct immediate_vertex, color)},
+    {"inherit", 1, GL_UNSIGNED_BYTE, GL_TRUE, offsetof(struct immediate_vertex, inherit)}
+};
+
+#define IMMEDIATE_ATTRIBUTES (sizeof(immediate_attributes) / sizeof(immediate_attributes[0]))
+
+static const char *immediate_vertex_source =
+    "#version 150\n"
+    "in vec4 position;\n"
+    "in vec2 uv;\n"
+    "in vec4 color;\n"
+    "in float inherit;\n"
+    "uniform mat4 transform;\n"
+    "uniform vec4 tint;\n"
+    "out vec2 v_uv;\n"
+    "out vec4 v_color;\n"
+    "void main() {\n"
+    "    gl_Position = transform * position;\n"
+    "    v_uv = uv;\n"
+    "    v_color = mix(color, tint, inherit);\n"
+    "}\n";
+
+static const char *immediate_fragment_source =
+    "#version 150\n"
+    "in vec2 v_uv;\n"
+    "in vec4 v_color;\n"
+    "uniform sampler2D image;\n"
+    "uniform bool textured;\n"
+    "out vec4 fragment;\n"
+    "void main() {\n"
+    "    fragment = textured ? texture(image, v_uv) * v_color : v_color;\n"
+    "}\n";
+
+static struct {
+    // 0 until first used, -1 if setting up failed
+    int initialised;
+    GLuint program, vertex_array, overflow;
+    GLint locations[IMMEDIATE_ATTRIBUTES];
+    // What the vertex array's pointers were last set to
+    GLuint pointer_buffer;
+    GLintptr pointer_offset;
+    struct shader_uniforms *uniforms;
+    struct buffer_ring *ring;
+    // The batch being collected, or the geometry of the list being compiled
+    struct immediate_vertex *vertices;
+    size_t vertex_count, vertex_capacity;
+    uint32_t *indices;
+    size_t index_count, index_capacity;
+    // Where the current batch starts in `indices`
+    size_t batch_first;
+    enum immediate_primitive primitive;
+    bool batch_textured;
+    // Current primitive
+    bool inside;
+    GLenum mode;
+    size_t first;
+    float mvp[16], texture[16];
+    bool texture_identity;
+    // Current attributes
+    float uv[2];
+    unsigned char color[4];
+    bool textured;
+    size_t draws;
+    // Display lists, named by index + 1
+    struct immediate_display_list *lists;
+    size_t list_count, list_capacity;
+    GLuint list_base;
+    struct buffer_heap *vertex_heap, *index_heap;
+    int depth;
+    // The list being compiled, it replaces its name at glEndList so the
+    // old contents stay callable until then
+    struct immediate_display_list compiling, *recording;
+    GLuint recording_name;
+    bool execute;
+    // Modelview at glNewList, and what geometry is recorded relative to:
+    // that with the changes of the lists called so far applied
+    mat4 list_start, list_model, list_inverse;
+    unsigned char saved_color[4];
+    bool saved_textured;
+    // A glColor has been recorded, and one not yet stored as an op
+    bool color_set, color_dirty;
+} state = {
+    .color = {255, 255, 255, 255}
+};
+
+#define IMMEDIATE_GROW(ARRAY, COUNT, CAPACITY, NEEDED)                            \
+    do {                                                                          \
+        if ((COUNT) + (NEEDED) > (CAPACITY)) {                                    \
+            size_t capacity = (CAPACITY) ? (CAPACITY) : 1024;                     \
+            while (capacity < (COUNT) + (NEEDED))                                 \
+                capacity *= 2;                                                    \
+            void *grown = realloc((ARRAY), capacity * sizeof(*(ARRAY)));          \
+            if (!grown)                                                           \
+                abort();                                                          \
+            (ARRAY) = grown;                                                      \
+            (CAPACITY) = capacity;                                                \
+        }                                                                         \
+    } while (0)
+
+static void immediate_swap(void *userdata) {
+    (void)userdata;
+    immediate_flush();
+}
+
+static bool immediate_init(void) {
+    if (state.initialised)
+        return state.initialised > 0;
+    state.initialised = -1;
+    if (!(state.ring = buffer_ring_create(IMMEDIATE_BUFFER_SIZE, 0)))
+        return false;
+    if (!(state.program = shader_program(immediate_vertex_source, immediate_fragment_source, NULL)) ||
+        !(state.uniforms = shader_reflect(state.program))) {
+        immediate_release();
+        state.initialised = -1;
+        return false;
+    }
+    glUseProgram(state.program);
+    shader_set_int(state.uniforms, SHADER_HASH("image"), 0);
+    glGenVertexArrays(1, &state.vertex_array);
+    glBindVertexArray(state.vertex_array);
+    for (size_t i = 0; i < IMMEDIATE_ATTRIBUTES; i++)
+        if ((state.locations[i] = glGetAttribLocation(state.program, immediate_attributes[i].name)) >= 0)
+            glEnableVertexAttribArray((GLuint)state.locations[i]);
+    glBindVertexArray(0);
+    glutAddSwapFunc(immediate_swap, NULL);
+    state.initialised = 1;
+    return true;
+}
+
+static void immediate_list_clear(struct immediate_display_list *list) {
+    if (list->has_mesh)
+        buffer_mesh_destroy(state.vertex_heap, state.index_heap, &list->mesh);
+    free(list->ops);
+    memset(list, 0, sizeof(*list));
+}
+
+void immediate_release(void) {
+    if (state.initialised > 0)
+        glutRemoveSwapFunc(immediate_swap, NULL);
+    for (size_t i = 0; i < state.list_count; i++)
+        immediate_list_clear(&state.lists[i]);
+    immediate_list_clear(&state.compiling);
+    free(state.lists);
+    buffer_heap_destroy(state.vertex_heap);
+    buffer_heap_destroy(state.index_heap);
+    if (state.vertex_array)
+        glDeleteVertexArrays(1, &state.vertex_array);
+    if (state.overflow)
+        glDeleteBuffers(1, &state.overflow);
+    if (state.program)
+        glDeleteProgram(state.program);
+    shader_uniforms_destroy(state.uniforms);
+    buffer_ring_destroy(state.ring);
+    free(state.vertices);
+    free(state.indices);
+    memset(&state, 0, sizeof(state));
+    state.color[0] = state.color[1] = state.color[2] = state.color[3] = 255;
+}
+
+static void immediate_matrix(mat4 mat, float *out) {
+    for (int c = 0; c < 4; c++)
+        for (int r = 0; r < 4; r++)
+            out[c * 4 + r] = MAT_AT(mat, r, c);
+}
+
+static enum immediate_primitive immediate_primitive_of(GLenum mode) {
+    switch (mode) {
+        case GL_POINTS:
+            return IMMEDIATE_POINTS;
+        case GL_LINES:
+        case GL_LINE_LOOP:
+        case GL_LINE_STRIP:
+            return IMMEDIATE_LINES;
+        default:
+            return IMMEDIATE_TRIANGLES;
+    }
+}
+
+static void immediate_pointers(GLuint buffer, GLintptr offset) {
+    if (buffer == state.pointer_buffer && offset == state.pointer_offset)
+        return;
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    for (size_t i = 0; i < IMMEDIATE_ATTRIBUTES; i++)
+        if (state.locations[i] >= 0)
+            glVertexAttribPointer((GLuint)state.locations[i], immediate_attributes[i].size, immediate_attributes[i].type,
+                                  immediate_attributes[i].normalized, sizeof(struct immediate_vertex),
+                                  (const void*)(offset + immediate_attributes[i].offset));
+    state.pointer_buffer = buffer;
+    state.pointer_offset = offset;
+}
+
+static struct immediate_op* immediate_record(enum immediate_op_type type) {
+    struct immediate_display_list *list = state.recording;
+    IMMEDIATE_GROW(list->ops, list->op_count, list->op_capacity, 1);
+    struct immediate_op *op = &list->ops[list->op_count++];
+    memset(op, 0, sizeof(*op));
+    op->type = type;
+    return op;
+}
+
+// Ends the batch of the list being compiled, and stores the current color
+// before anything that could observe it
+static void immediate_record_batch(bool color) {
+    if (state.index_count > state.batch_first) {
+        struct immediate_op *op = immediate_record(IMMEDIATE_OP_DRAW);
+        op->draw.primitive = state.primitive;
+        op->draw.first = (uint32_t)state.batch_first;
+        op->draw.count = (uint32_t)(state.index_count - state.batch_first);
+        state.batch_first = state.index_count;
+    }
+    if (color && state.color_dirty) {
+        memcpy(immediate_record(IMMEDIATE_OP_COLOR)->state.color, state.color, 4);
+        state.color_dirty = false;
+    }
+}
+
+void immediate_begin(GLenum mode) {
+    if (state.inside || mode > GL_POLYGON || !immediate_init())
+        return;
+    enum immediate_primitive primitive = immediate_primitive_of(mode);
+    if (state.index_count > state.batch_first && (primitive != state.primitive || state.textured != state.batch_textured))
+        immediate_flush();
+    state.primitive = primitive;
+    state.batch_textured = state.textured;
+    state.inside = true;
+    state.mode = mode;
+    state.first = state.vertex_count;
+    // The stacks can't change before glEnd, so the vertices of the whole
+    // primitive go through the same matrices
+    if (state.recording)
+        immediate_matrix(mat4_mul(state.list_inverse, matrix_get(MATRIX_MODEL)), state.mvp);
+    else
+        immediate_matrix(matrix_mvp(), state.mvp);
+    mat4 texture = matrix_get(MATRIX_TEXTURE);
+    if (!(state.texture_identity = mat4_is_identity(texture)))
+        immediate_matrix(texture, state.texture);
+}
+
+void immediate_vertex(float x, float y, float z, float w) {
+    if (!state.inside)
+        return;
+    IMMEDIATE_GROW(state.vertices, state.vertex_count, state.vertex_capacity, 1);
+    struct immediate_vertex *v = &state.vertices[state.vertex_count++];
+    const float *m = state.mvp;
+    for (int r = 0; r < 4; r++)
+        v->position[r] = m[r] * x + m[4 + r] * y + m[8 + r] * z + m[12 + r] * w;
+    if (state.texture_identity) {
+        v->uv[0] = state.uv[0];
+        v->uv[1] = state.uv[1];
+    } else {
+        const float *t = state.texture;
+        v->uv[0] = t[0] * state.uv[0] + t[4] * state.uv[1] + t[12];
+        v->uv[1] = t[1] * state.uv[0] + t[5] * state.uv[1] + t[13];
+    }
+    memcpy(v->color, state.color, 4);
+    v->inherit = state.recording && !state.color_set ? 255 : 0;
+    memset(v->pad, 0, sizeof(v->pad));
+}
+
+// Rewrites the primitive as a point, line or triangle list. Incomplete
+// trailing vertices are dropped like GL does.
+void immediate_end(void) {
+    if (!state.inside)
+        return;
+    state.inside = false;
+    uint32_t first = (uint32_t)state.first;
+    size_t n = state.vertex_count - state.first;
+    size_t needed = 0;
+    switch (state.mode) {
+        case GL_POINTS:
+            needed = n;
+            break;
+        case GL_LINES:
+            needed = n & ~(size_t)1;
+            break;
+        case GL_LINE_STRIP:
+            needed = n > 1 ? (n - 1) * 2 : 0;
+            break;
+        case GL_LINE_LOOP:
+            needed = n > 1 ? n * 2 : 0;
+            break;
+        case GL_TRIANGLES:
+            needed = n - n % 3;
+            break;
+        case GL_QUADS:
+            needed = n / 4 * 6;
+            break;
+        case GL_QUAD_STRIP:
+            needed = n > 3 ? (n / 2 - 1) * 6 : 0;
+            break;
+        default: // GL_TRIANGLE_STRIP, GL_TRIANGLE_FAN, GL_POLYGON
+            needed = n > 2 ? (n - 2) * 3 : 0;
+            break;
+    }
+    if (!needed) {
+        state.vertex_count = state.first;
+        return;
+    }
+    IMMEDIATE_GROW(state.indices, state.index_count, state.index_capacity, needed);
+    uint32_t *out = state.indices + state.index_count;
+    state.index_count += needed;
+    switch (state.mode) {
+        case GL_POINTS:
+        case GL_LINES:
+        case GL_TRIANGLES:
+            for (uint32_t i = 0; i < needed; i++)
+                out[i] = first + i;
+            break;
+        case GL_LINE_STRIP:
+        case GL_LINE_LOOP:
+            for (uint32_t i = 0; i + 1 < n; i++) {
+                *out++ = first + i;
+                *out++ = first + i + 1;
+            }
+            if (state.mode == GL_LINE_LOOP) {
+                *out++ = first + (uint32_t)n - 1;
+                *out++ = first;
+            }
+            break;
+        case GL_QUADS:
+            for (uint32_t q = first; q + 3 < first + n; q += 4) {
+                *out++ = q;
+                *out++ = q + 1;
+                *out++ = q + 2;
+                *out++ = q + 2;
+                *out++ = q + 3;
+                *out++ = q;
+            }
+            break;
+        case GL_QUAD_STRIP:
+            for (uint32_t q = first; q + 3 < first + n; q += 2) {
+                *out++ = q;
+                *out++ = q + 1;
+                *out++ = q + 3;
+                *out++ = q + 3;
+                *out++ = q + 2;
+                *out++ = q;
+            }
+            break;
+        case GL_TRIANGLE_STRIP:
+            // Every other triangle swaps its first two vertices to keep the
+            // winding of the strip
+            for (uint32_t i = 0; i + 2 < n; i++) {
+                *out++ = first + i + (i & 1);
+                *out++ = first + i + 1 - (i & 1);
+                *out++ = first + i + 2;
+            }
+            break;
+        default: // GL_TRIANGLE_FAN, GL_POLYGON
+            for (uint32_t i = 1; i + 1 < n; i++) {
+                *out++ = first;
+                *out++ = first + i;
+                *out++ = first + i + 1;
+            }
+            break;
+    }
+    if (!state.recording && state.vertex_count >= IMMEDIATE_BATCH_VERTICES)
+        immediate_flush();
+}
+
+void immediate_color_ub(GLubyte r, GLubyte g, GLubyte b, GLubyte a) {
+    state.color[0] = r;
+    state.color[1] = g;
+    state.color[2] = b;
+    state.color[3] = a;
+    if (state.recording)
+        state.color_set = state.color_dirty = true;
+}
+
+static inline GLubyte immediate_unorm8(float v) {
+    return v <= 0.f ? 0 : v >= 1.f ? 255 : (GLubyte)(v * 255.f + .5f);
+}
+
+void immediate_color(float r, float g, float b, float a) {
+    immediate_color_ub(immediate_unorm8(r), immediate_unorm8(g), immediate_unorm8(b), immediate_unorm8(a));
+}
+
+void immediate_tex_coord(float s, float t) {
+    state.uv[0] = s;
+    state.uv[1] = t;
+}
+
+void immediate_texturing(bool enabled) {
+    if (state.recording && !state.inside) {
+        immediate_record_batch(false);
+        immediate_record(IMMEDIATE_OP_TEXTURING)->state.a = enabled;
+    }
+    state.textured = enabled;
+}
+
+// Sets the uniforms that differ between batches, the program is bound
+static void immediate_uniforms(mat4 transform, bool textured) {
+    shader_set_mat4(state.uniforms, SHADER_HASH("transform"), transform);
+    shader_set_int(state.uniforms, SHADER_HASH("textured"), textured);
+}
+
+void immediate_flush(void) {
+    if (state.inside)
+        return;
+    if (state.recording) {
+        immediate_record_batch(false);
+        return;
+    }
+    if (!state.index_count) {
+        state.vertex_count = 0;
+        return;
+    }
+    size_t vertex_bytes = state.vertex_count * sizeof(struct immediate_vertex);
+    size_t index_bytes = state.index_count * sizeof(uint32_t);
+    GLuint buffer;
+    GLintptr offset;
+    struct buffer_alloc alloc;
+    if (vertex_bytes + index_bytes <= IMMEDIATE_BUFFER_SIZE) {
+        // A batch that doesn't fit what's left of the segment starts the
+        // next one early rather than taking the slow path
+        if (!buffer_ring_alloc(state.ring, vertex_bytes + index_bytes, sizeof(float), &alloc)) {
+            buffer_ring_end_frame(state.ring);
+            if (!buffer_ring_alloc(state.ring, vertex_bytes + index_bytes, sizeof(float), &alloc)) {
+                state.vertex_count = 0;
+                state.index_count = 0;
+                return;
+            }
+        }
+        memcpy(alloc.ptr, state.vertices, vertex_bytes);
+        memcpy((char*)alloc.ptr + vertex_bytes, state.indices, index_bytes);
+        buffer_ring_flush(state.ring);
+        buffer = alloc.buffer;
+        offset = alloc.offset;
+    } else {
+        // Larger than a whole segment, orphan a buffer of its own
+        if (!state.overflow)
+            glGenBuffers(1, &state.overflow);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, state.overflow);
+        glBufferData(GL_COPY_WRITE_BUFFER, vertex_bytes + index_bytes, NULL, GL_STREAM_DRAW);
+        glBufferSubData(GL_COPY_WRITE_BUFFER, 0, vertex_bytes, state.vertices);
+        glBufferSubData(GL_COPY_WRITE_BUFFER, vertex_bytes, index_bytes, state.indices);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+        buffer = state.overflow;
+        offset = 0;
+    }
+
+    glUseProgram(state.program);
+    immediate_uniforms(mat4_identity(), state.batch_textured);
+    glBindVertexArray(state.vertex_array);
+    immediate_pointers(buffer, offset);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer);
+    glDrawElements(immediate_primitive_modes[state.primitive], (GLsizei)state.index_count, GL_UNSIGNED_INT,
+                   (const void*)(offset + vertex_bytes));
+    glBindVertexArray(0);
+    state.draws++;
+    state.vertex_count = 0;
+    state.index_count = 0;
+}
+
+size_t immediate_draw_count(void) {
+    return state.draws;
+}
+
+static struct immediate_display_list* immediate_list(GLuint name) {
+    return name && name <= state.list_count && state.lists[name - 1].used ? &state.lists[name - 1] : NULL;
+}
+
+GLuint immediate_gen_lists(GLsizei range) {
+    if (range <= 0)
+        return 0;
+    // Names are never reused, deleted ones stay empty slots
+    IMMEDIATE_GROW(state.lists, state.list_count, state.list_capacity, (size_t)range);
+    GLuint first = (GLuint)state.list_count + 1;
+    for (GLsizei i = 0; i < range; i++) {
+        struct immediate_display_list *list = &state.lists[state.list_count++];
+        memset(list, 0, sizeof(*list));
+        list->used = true;
+    }
+    return first;
+}
+
+void immediate_new_list(GLuint list, GLenum mode) {
+    if (state.recording || state.inside || !immediate_list(list) || !immediate_init())
+        return;
+    immediate_flush();
+    immediate_list_clear(&state.compiling);
+    state.compiling.used = true;
+    state.recording = &state.compiling;
+    state.recording_name = list;
+    state.execute = mode == GL_COMPILE_AND_EXECUTE;
+    state.list_start = state.list_model = matrix_get(MATRIX_MODEL);
+    state.list_inverse = mat4_invert(state.list_model);
+    memcpy(state.saved_color, state.color, 4);
+    state.saved_textured = state.textured;
+    state.color_set = state.color_dirty = false;
+    state.vertex_count = 0;
+    state.index_count = 0;
+    state.batch_first = 0;
+}
+
+void immediate_end_list(void) {
+    struct immediate_display_list *list = state.recording;
+    if (!list || state.inside)
+        return;
+    immediate_record_batch(true);
+    // Back to how things were before glNewList, the list did nothing yet
+    enum matrix_mode mode = matrix_get_mode();
+    matrix_mode(MATRIX_MODEL);
+    list->delta = mat4_mul(state.list_inverse, matrix_get(MATRIX_MODEL));
+    list->has_delta = !mat4_is_identity(list->delta);
+    matrix_load(state.list_start);
+    matrix_mode(mode);
+    memcpy(state.color, state.saved_color, 4);
+    state.textured = state.saved_textured;
+
+    if (state.vertex_count) {
+        if (!state.vertex_heap) {
+            state.vertex_heap = buffer_heap_create(IMMEDIATE_LIST_ARENA_SIZE, 0);
+            state.index_heap = buffer_heap_create(IMMEDIATE_LIST_ARENA_SIZE / 4, 0);
+        }
+        // Most lists are small enough for 16 bit indices
+        GLenum type = GL_UNSIGNED_INT;
+        if (state.vertex_count <= 65536) {
+            uint16_t *narrow = (uint16_t*)state.indices;
+            for (size_t i = 0; i < state.index_count; i++)
+                narrow[i] = (uint16_t)state.indices[i];
+            type = GL_UNSIGNED_SHORT;
+        }
+        list->has_mesh = state.vertex_heap && state.index_heap &&
+                         buffer_mesh_create(state.vertex_heap, state.index_heap, state.vertices, state.vertex_count,
+                                            sizeof(struct immediate_vertex), state.indices, (GLsizei)state.index_count,
+                                            type, &list->mesh);
+    }
+    list->compiled = true;
+    state.vertex_count = 0;
+    state.index_count = 0;
+    state.batch_first = 0;
+    state.recording = NULL;
+
+    struct immediate_display_list *target = immediate_list(state.recording_name);
+    if (target) {
+        immediate_list_clear(target);
+        *target = *list;
+    } else
+        immediate_list_clear(list);
+    memset(list, 0, sizeof(*list));
+    if (target && state.execute)
+        immediate_call_list(state.recording_name);
+}
+
+static void immediate_apply(const struct immediate_op *op) {
+    switch (op->type) {
+        case IMMEDIATE_OP_COLOR:
+            memcpy(state.color, op->state.color, 4);
+            break;
+        case IMMEDIATE_OP_TEXTURING:
+            state.textured = op->state.a;
+            break;
+        case IMMEDIATE_OP_ENABLE:
+            glEnable(op->state.a);
+            break;
+        case IMMEDIATE_OP_DISABLE:
+            glDisable(op->state.a);
+            break;
+        case IMMEDIATE_OP_BIND_TEXTURE:
+            glBindTexture(op->state.a, op->state.b);
+            break;
+        case IMMEDIATE_OP_BLEND_FUNC:
+            glBlendFunc(op->state.a, op->state.b);
+            break;
+        case IMMEDIATE_OP_DEPTH_FUNC:
+            glDepthFunc(op->state.a);
+            break;
+        case IMMEDIATE_OP_DEPTH_MASK:
+            glDepthMask((GLboolean)op->state.a);
+            break;
+        case IMMEDIATE_OP_LINE_WIDTH:
+            glLineWidth(op->state.value);
+            break;
+        case IMMEDIATE_OP_POINT_SIZE:
+            glPointSize(op->state.value);
+            break;
+        case IMMEDIATE_OP_CLEAR:
+            glClear(op->state.a);
+            break;
+        default:
+            break;
+    }
+}
+
+static void immediate_call(struct immediate_display_list *list) {
+    struct buffer_draw draw;
+    bool drawable = list->has_mesh && buffer_mesh_draw_args(state.vertex_heap, state.index_heap, &list->mesh, &draw);
+    size_t index_size = drawable && draw.type == GL_UNSIGNED_SHORT ? sizeof(uint16_t) : sizeof(uint32_t);
+    bool bound = false;
+    for (size_t i = 0; i < list->op_count; i++) {
+        const struct immediate_op *op = &list->ops[i];
+        switch (op->type) {
+            case IMMEDIATE_OP_DRAW:
+                if (!drawable)
+                    break;
+                if (!bound) {
+                    glUseProgram(state.program);
+                    glBindVertexArray(state.vertex_array);
+                    immediate_pointers(draw.vertex_buffer, 0);
+                    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, draw.index_buffer);
+                    bound = true;
+                }
+                // Fetched for every batch, a called list may have moved it
+                immediate_uniforms(matrix_mvp(), state.textured);
+                shader_set_vec4(state.uniforms, SHADER_HASH("tint"),
+                                Vec4(state.color[0] / 255.f, state.color[1] / 255.f,
+                                     state.color[2] / 255.f, state.color[3] / 255.f));
+                glDrawElementsBaseVertex(immediate_primitive_modes[op->draw.primitive], (GLsizei)op->draw.count, draw.type,
+                                         (const char*)draw.indices + op->draw.first * index_size, draw.base_vertex);
+                state.draws++;
+                break;
+            case IMMEDIATE_OP_CALL:
+                if (bound)
+                    glBindVertexArray(0);
+                bound = false;
+                immediate_call_list(op->list);
+                break;
+            default:
+                immediate_apply(op);
+                break;
+        }
+    }
+    if (bound)
+        glBindVertexArray(0);
+    if (list->has_delta) {
+        enum matrix_mode mode = matrix_get_mode();
+        matrix_mode(MATRIX_MODEL);
+        matrix_mul(list->delta);
+        matrix_mode(mode);
+    }
+}
+
+void immediate_call_list(GLuint name) {
+    struct immediate_display_list *list = immediate_list(name);
+    if (!list || state.inside)
+        return;
+    if (state.recording) {
+        immediate_record_batch(true);
+        immediate_record(IMMEDIATE_OP_CALL)->list = name;
+        // What GL would do to the matrix right now, and what the geometry
+        // after this point will be drawn relative to when replayed
+        if (list->has_delta) {
+            enum matrix_mode mode = matrix_get_mode();
+            matrix_mode(MATRIX_MODEL);
+            matrix_mul(list->delta);
+            matrix_mode(mode);
+            state.list_model = mat4_mul(state.list_model, list->delta);
+            state.list_inverse = mat4_invert(state.list_model);
+        }
+        return;
+    }
+    if (state.depth >= IMMEDIATE_LIST_NESTING)
+        return;
+    // Whatever was batched before the call is drawn first
+    if (!state.depth)
+        immediate_flush();
+    state.depth++;
+    immediate_call(list);
+    state.depth--;
+}
+
+void immediate_call_lists(GLsizei n, GLenum type, const void *lists) {
+    if (!lists)
+        return;
+    for (GLsizei i = 0; i < n; i++) {
+        GLuint name;
+        switch (type) {
+            case GL_BYTE:
+                name = (GLuint)((const GLbyte*)lists)[i];
+                break;
+            case GL_UNSIGNED_BYTE:
+                name = ((const GLubyte*)lists)[i];
+                break;
+            case GL_SHORT:
+                name = (GLuint)((const GLshort*)lists)[i];
+                break;
+            case GL_UNSIGNED_SHORT:
+                name = ((const GLushort*)lists)[i];
+                break;
+            case GL_INT:
+                name = (GLuint)((const GLint*)lists)[i];
+                break;
+            case GL_UNSIGNED_INT:
+                name = ((const GLuint*)lists)[i];
+                break;
+            case GL_FLOAT:
+                name = (GLuint)((const GLfloat*)lists)[i];
+                break;
+            default:
+                return;
+        }
+        immediate_call_list(state.list_base + name);
+    }
+}
+
+void immediate_list_base(GLuint base) {
+    state.list_base = base;
+}
+
+void immediate_delete_lists(GLuint list, GLsizei range) {
+    for (GLsizei i = 0; i < range; i++) {
+        struct immediate_display_list *target = immediate_list(list + (GLuint)i);
+        if (target)
+            immediate_list_clear(target);
+    }
+}
+
+bool immediate_is_list(GLuint list) {
+    return immediate_list(list) != NULL;
+}
+
+// Whether the list already leaves that piece of state at the op's value,
+// as far as can be told without following the lists it calls
+static bool immediate_redundant(const struct immediate_op *op) {
+    const struct immediate_display_list *list = state.recording;
+    for (size_t i = list->op_count; i-- > 0;) {
+        const struct immediate_op *prior = &list->ops[i];
+        switch (prior->type) {
+            case IMMEDIATE_OP_CALL:
+                return false;
+            case IMMEDIATE_OP_ENABLE:
+            case IMMEDIATE_OP_DISABLE:
+                if ((op->type == IMMEDIATE_OP_ENABLE || op->type == IMMEDIATE_OP_DISABLE) && prior->state.a == op->state.a)
+                    return prior->type == op->type;
+                break;
+            case IMMEDIATE_OP_BIND_TEXTURE:
+                if (op->type == prior->type && prior->state.a == op->state.a)
+                    return prior->state.b == op->state.b;
+                break;
+            case IMMEDIATE_OP_BLEND_FUNC:
+            case IMMEDIATE_OP_DEPTH_FUNC:
+            case IMMEDIATE_OP_DEPTH_MASK:
+            case IMMEDIATE_OP_LINE_WIDTH:
+            case IMMEDIATE_OP_POINT_SIZE:
+                if (op->type == prior->type)
+                    return prior->state.a == op->state.a && prior->state.b == op->state.b &&
+                           prior->state.value == op->state.value;
+                break;
+            default:
+                break;
+        }
+    }
+    return false;
+}
+
+static void immediate_state(enum immediate_op_type type, GLenum a, GLenum b, float value) {
+    struct immediate_op op = {.type = type, .state = {.a = a, .b = b, .value = value}};
+    if (state.recording) {
+        if (state.inside)
+            return;
+        immediate_record_batch(type == IMMEDIATE_OP_CLEAR);
+        if (type == IMMEDIATE_OP_CLEAR || !immediate_redundant(&op))
+            *immediate_record(type) = op;
+        return;
+    }
+    immediate_flush();
+    immediate_apply(&op);
+}
+
+void immediate_compat_enable(GLenum cap) {
+    if (cap == GL_TEXTURE_2D)
+        immediate_texturing(true);
+    else
+        immediate_state(IMMEDIATE_OP_ENABLE, cap, 0, 0.f);
+}
+
+void immediate_compat_disable(GLenum cap) {
+    if (cap == GL_TEXTURE_2D)
+        immediate_texturing(false);
+    else
+        immediate_state(IMMEDIATE_OP_DISABLE, cap, 0, 0.f);
+}
+
+void immediate_compat_bind_texture(GLenum target, GLuint texture) {
+    immediate_state(IMMEDIATE_OP_BIND_TEXTURE, target, texture, 0.f);
+}
+
+void immediate_compat_blend_func(GLenum source, GLenum destination) {
+    immediate_state(IMMEDIATE_OP_BLEND_FUNC, source, destination, 0.f);
+}
+
+void immediate_compat_depth_func(GLenum func) {
+    immediate_state(IMMEDIATE_OP_DEPTH_FUNC, func, 0, 0.f);
+}
+
+void immediate_compat_depth_mask(GLboolean flag) {
+    immediate_state(IMMEDIATE_OP_DEPTH_MASK, flag, 0, 0.f);
+}
+
+void immediate_compat_line_width(GLfloat width) {
+    immediate_state(IMMEDIATE_OP_LINE_WIDTH, 0, 0, width);
+}
+
+void immediate_compat_point_size(GLfloat size) {
+    immediate_state(IMMEDIATE_OP_POINT_SIZE, 0, 0, size);
+}
+
+void immediate_compat_clear(GLbitfield mask) {
+    immediate_state(IMMEDIATE_OP_CLEAR, mask, 0, 0.f);
+}
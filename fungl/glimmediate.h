@@ -0,0 +1,240 @@
+/* glimmediate.h --  https://github.com/takeiteasy/fungl
+
+ fungl puts the fun back into OpenGL
+
+ Copyright (C) 2024  George Watson
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+ glBegin/glEnd emulation for core profile contexts (and a faster path on
+ compatibility ones). Vertices are transformed by the glmatrix.h stacks as
+ they are specified and collected on the CPU, primitives are rewritten as
+ point, line or triangle lists, and consecutive glBegin/glEnd pairs that
+ end up with the same kind of list and texturing are drawn together from a
+ buffer ring (see glbuffer.h). A loop of a thousand glBegin(GL_QUADS) blocks
+ under changing glTranslatef calls is a single draw.
+
+ Define `FUNGL_IMMEDIATE_COMPAT` (usually together with FUNGL_MATRIX_COMPAT)
+ before including to route glBegin, glEnd, glVertex*, glColor*, glTexCoord*
+ and a handful of state changes through the emulation:
+
+    #define FUNGL_MATRIX_COMPAT
+    #define FUNGL_IMMEDIATE_COMPAT
+    #include "fungl.h"
+    ...
+    glEnable(GL_TEXTURE_2D);
+    glBindTexture(GL_TEXTURE_2D, logo);
+    glBegin(GL_QUADS);
+    glTexCoord2f(0.f, 0.f); glVertex2f(-1.f, -1.f);
+    ...
+    glEnd();
+
+ Drawing is deferred until the batch has to be broken, so GL state that
+ affects it may only change through the wrapped calls (glEnable, glDisable,
+ glBindTexture, glBlendFunc, glDepthFunc, glDepthMask, glLineWidth,
+ glPointSize, glViewport, glScissor, glClear, glFlush and glFinish flush
+ first) or after an explicit immediate_flush. Batches are also flushed
+ before every glutSwapBuffers. glEnable(GL_TEXTURE_2D) only switches
+ texturing for the emulation, normals are accepted and dropped as there is
+ no lighting.
+
+ Display lists record the same calls instead of drawing them. At
+ glEndList the geometry is packed into one interleaved mesh in a static
+ buffer heap and the wrapped state changes are kept as a short op stream,
+ with repeats of a value the list already set dropped. glCallList replays
+ the ops and issues one glDrawElementsBaseVertex per batch, with the
+ matrices current at the call. Geometry is stored relative to the modelview
+ matrix at glNewList, and the net modelview change the list makes is
+ applied again on every call, so lists ending in a glTranslatef (glyphs of
+ a bitmap font) advance like they do in GL. Vertices without a glColor of
+ their own in the list take the color current at the call.
+
+    GLuint base = glGenLists(1);
+    glNewList(base, GL_COMPILE);
+    draw_gear();
+    glEndList();
+    ...
+    glCallList(base);
+
+ glViewport, glScissor, glFlush and glFinish are not recorded, they still
+ act immediately. Lists should leave the projection matrix and the depth
+ of the stacks as they found them. */
+
+#if !defined(glimmediate_h) && !defined(FUNGL_NO_IMMEDIATE)
+#define glimmediate_h
+#if defined(__cplusplus)
+extern "C" {
+#endif
+#include "gl.h"
+#if FUNGL_VERSION < GL_VERSION_3_2
+#error "glimmediate.h requires FUNGL_VERSION >= GL_VERSION_3_2"
+#endif
+#include "glbuffer.h"
+#ifndef glbuffer_h
+#error "glimmediate.h requires glbuffer.h, don't define FUNGL_NO_BUFFER"
+#endif
+#include "glshader.h"
+#ifndef glshader_h
+#error "glimmediate.h requires glshader.h, don't define FUNGL_NO_SHADER"
+#endif
+#include "glmatrix.h"
+#ifndef glmatrix_h
+#error "glimmediate.h requires glmatrix.h, don't define FUNGL_NO_MATRIX_STACK"
+#endif
+#include <stddef.h>
+#include <stdbool.h>
+
+// Bytes of each arena of the heaps compiled display lists live in
+#ifndef IMMEDIATE_LIST_ARENA_SIZE
+#define IMMEDIATE_LIST_ARENA_SIZE (8 << 20)
+#endif
+// Deepest glCallList nesting, as GL_MAX_LIST_NESTING
+#define IMMEDIATE_LIST_NESTING 64
+// Bytes of the buffer ring per frame in flight
+#ifndef IMMEDIATE_BUFFER_SIZE
+#define IMMEDIATE_BUFFER_SIZE (4 << 20)
+#endif
+// A batch is drawn once it holds this many vertices, at the end of the
+// primitive that crossed it
+#ifndef IMMEDIATE_BATCH_VERTICES
+#define IMMEDIATE_BATCH_VERTICES 65536
+#endif
+
+// Any primitive mode up to GL_POLYGON. Calls between immediate_begin and
+// immediate_end other than vertex attributes are ignored, as in GL.
+void immediate_begin(GLenum mode);
+void immediate_end(void);
+void immediate_vertex(float x, float y, float z, float w);
+void immediate_color(float r, float g, float b, float a);
+void immediate_color_ub(GLubyte r, GLubyte g, GLubyte b, GLubyte a);
+void immediate_tex_coord(float s, float t);
+// Modulate by the texture bound to GL_TEXTURE_2D on the active unit
+void immediate_texturing(bool enabled);
+// Draws everything batched so far (ends the current batch of a list that
+// is being compiled)
+void immediate_flush(void);
+// Draw calls issued so far
+size_t immediate_draw_count(void);
+void immediate_release(void);
+
+// Returns the first of `range` consecutive new list names, 0 on failure
+GLuint immediate_gen_lists(GLsizei range);
+// `mode` is GL_COMPILE or GL_COMPILE_AND_EXECUTE, a list that already
+// exists is replaced once immediate_end_list is reached
+void immediate_new_list(GLuint list, GLenum mode);
+void immediate_end_list(void);
+void immediate_call_list(GLuint list);
+// `type` is one of the integer types, names are offset by immediate_list_base
+void immediate_call_lists(GLsizei n, GLenum type, const void *lists);
+void immediate_list_base(GLuint base);
+void immediate_delete_lists(GLuint list, GLsizei range);
+bool immediate_is_list(GLuint list);
+
+// State changes that flush first and then forward to GL, or are recorded
+// while a display list is being compiled
+void immediate_compat_enable(GLenum cap);
+void immediate_compat_disable(GLenum cap);
+void immediate_compat_bind_texture(GLenum target, GLuint texture);
+void immediate_compat_blend_func(GLenum source, GLenum destination);
+void immediate_compat_depth_func(GLenum func);
+void immediate_compat_depth_mask(GLboolean flag);
+void immediate_compat_line_width(GLfloat width);
+void immediate_compat_point_size(GLfloat size);
+void immediate_compat_clear(GLbitfield mask);
+
+#ifdef FUNGL_IMMEDIATE_COMPAT
+#undef glBegin
+#undef glEnd
+#undef glVertex2f
+#undef glVertex2fv
+#undef glVertex2i
+#undef glVertex3f
+#undef glVertex3fv
+#undef glVertex4f
+#undef glColor3f
+#undef glColor3fv
+#undef glColor4f
+#undef glColor4fv
+#undef glColor3ub
+#undef glColor4ub
+#undef glTexCoord2f
+#undef glTexCoord2fv
+#undef glNormal3f
+#undef glNormal3fv
+#undef glEnable
+#undef glDisable
+#undef glBindTexture
+#undef glBlendFunc
+#undef glDepthFunc
+#undef glDepthMask
+#undef glLineWidth
+#undef glPointSize
+#undef glViewport
+#undef glScissor
+#undef glClear
+#undef glFlush
+#undef glFinish
+#undef glGenLists
+#undef glNewList
+#undef glEndList
+#undef glCallList
+#undef glCallLists
+#undef glListBase
+#undef glDeleteLists
+#undef glIsList
+#define glBegin(MODE) immediate_begin(MODE)
+#define glEnd() immediate_end()
+#define glVertex2f(X, Y) immediate_vertex((X), (Y), 0.f, 1.f)
+#define glVertex2fv(V) immediate_vertex((V)[0], (V)[1], 0.f, 1.f)
+#define glVertex2i(X, Y) immediate_vertex((float)(X), (float)(Y), 0.f, 1.f)
+#define glVertex3f(X, Y, Z) immediate_vertex((X), (Y), (Z), 1.f)
+#define glVertex3fv(V) immediate_vertex((V)[0], (V)[1], (V)[2], 1.f)
+#define glVertex4f(X, Y, Z, W) immediate_vertex((X), (Y), (Z), (W))
+#define glColor3f(R, G, B) immediate_color((R), (G), (B), 1.f)
+#define glColor3fv(V) immediate_color((V)[0], (V)[1], (V)[2], 1.f)
+#define glColor4f(R, G, B, A) immediate_color((R), (G), (B), (A))
+#define glColor4fv(V) immediate_color((V)[0], (V)[1], (V)[2], (V)[3])
+#define glColor3ub(R, G, B) immediate_color_ub((R), (G), (B), 255)
+#define glColor4ub(R, G, B, A) immediate_color_ub((R), (G), (B), (A))
+#define glTexCoord2f(S, T) immediate_tex_coord((S), (T))
+#define glTexCoord2fv(V) immediate_tex_coord((V)[0], (V)[1])
+#define glNormal3f(X, Y, Z) ((void)0)
+#define glNormal3fv(V) ((void)0)
+#define glEnable(CAP) immediate_compat_enable(CAP)
+#define glDisable(CAP) immediate_compat_disable(CAP)
+#define glBindTexture(TARGET, TEXTURE) immediate_compat_bind_texture((TARGET), (TEXTURE))
+#define glBlendFunc(S, D) immediate_compat_blend_func((S), (D))
+#define glDepthFunc(F) immediate_compat_depth_func(F)
+#define glDepthMask(F) immediate_compat_depth_mask(F)
+#define glLineWidth(W) immediate_compat_line_width(W)
+#define glPointSize(S) immediate_compat_point_size(S)
+#define glViewport(X, Y, W, H) (immediate_flush(), __glViewport((X), (Y), (W), (H)))
+#define glScissor(X, Y, W, H) (immediate_flush(), __glScissor((X), (Y), (W), (H)))
+#define glClear(MASK) immediate_compat_clear(MASK)
+#define glFlush() (immediate_flush(), __glFlush())
+#define glFinish() (immediate_flush(), __glFinish())
+#define glGenLists(RANGE) immediate_gen_lists(RANGE)
+#define glNewList(LIST, MODE) immediate_new_list((LIST), (MODE))
+#define glEndList() immediate_end_list()
+#define glCallList(LIST) immediate_call_list(LIST)
+#define glCallLists(N, TYPE, LISTS) immediate_call_lists((N), (TYPE), (LISTS))
+#define glListBase(BASE) immediate_list_base(BASE)
+#define glDeleteLists(LIST, RANGE) immediate_delete_lists((LIST), (RANGE))
+#define glIsList(LIST) ((GLboolean)immediate_is_list(LIST))
+#endif
+
+#if defined(__cplusplus)
+}
+#endif
+#endif /* glimmediate_h */
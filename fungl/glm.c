@@ -18,7 +18,9 @@
  along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
  Functionality relies on Clang + GCC extensions.
- When building `-fenable-matrix` for Matrix support.
+ When building `-fenable-matrix` matrices use Clang's `matrix_type`,
+ otherwise they are plain structs with SSE/NEON kernels (see glm.h).
+ To disable SIMD for struct matrices define `GLM_NO_SIMD`
  To disable Matrix support define `GLM_NO_MATRICES`
 
  Acknowledgements:
@@ -27,6 +29,31 @@
 
 #include "glm.h"
 
+#if defined(GLM_STRUCT_MATRICES) && !defined(GLM_NO_SIMD)
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define GLM_SIMD
+typedef __m128 f32x4;
+#define F32X4_LOAD(P) _mm_loadu_ps(P)
+#define F32X4_STORE(P, V) _mm_storeu_ps((P), (V))
+#define F32X4_SPLAT(F) _mm_set1_ps(F)
+// { A[X], A[Y], B[Z], B[W] }
+#define F32X4_SHUFFLE(A, B, X, Y, Z, W) _mm_shuffle_ps((A), (B), _MM_SHUFFLE((W), (Z), (Y), (X)))
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define GLM_SIMD
+typedef float32x4_t f32x4;
+#define F32X4_LOAD(P) vld1q_f32(P)
+#define F32X4_STORE(P, V) vst1q_f32((P), (V))
+#define F32X4_SPLAT(F) vdupq_n_f32(F)
+#if defined(__clang__)
+#define F32X4_SHUFFLE(A, B, X, Y, Z, W) __builtin_shufflevector((A), (B), (X), (Y), (Z) + 4, (W) + 4)
+#else
+#define F32X4_SHUFFLE(A, B, X, Y, Z, W) __builtin_shuffle((A), (B), (uint32x4_t){(X), (Y), (Z) + 4, (W) + 4})
+#endif
+#endif
+#endif
+
 #ifndef GLM_NO_MATRICES
 #define X(N)                                                \
     mat##N Mat##N(void)                                     \
@@ -39,7 +66,7 @@
     {                                                       \
         mat##N mat = Mat##N();                              \
         for (int i = 0; i < N; i++)                         \
-            mat[i][i] = 1.f;                                \
+            MAT_AT(mat, i, i) = 1.f;                        \
         return mat;                                         \
     }                                                       \
     bool mat##N##_is_identity(mat##N mat)                   \
@@ -47,10 +74,10 @@
         for (int y = 0; y < N; y++)                         \
             for (int x = 0; x < N; x++)                     \
                 if (x == y) {                               \
-                    if (mat[y][x] != 1.f)                   \
+                    if (MAT_AT(mat, y, x) != 1.f)           \
                         return false;                       \
                 } else {                                    \
-                    if (mat[y][x] != 0.f)                   \
+                    if (MAT_AT(mat, y, x) != 0.f)           \
                         return false;                       \
                 }                                           \
         return true;                                        \
@@ -59,7 +86,7 @@
     {                                                       \
         for (int y = 0; y < N; y++)                         \
             for (int x = 0; x < N; x++)                     \
-                if (mat[y][x] != 0.f)                       \
+                if (MAT_AT(mat, y, x) != 0.f)               \
                     return false;                           \
         return true;                                        \
     }                                                       \
@@ -67,15 +94,7 @@
     {                                                       \
         float result = 0.f;                                 \
         for (int i = 0; i < N; i++)                         \
-            result += mat[i][i];                            \
-        return result;                                      \
-    }                                                       \
-    mat##N mat##N##_transpose(mat##N mat)                   \
-    {                                                       \
-        mat##N result = Mat##N();                           \
-        for (int x = 0; x < N; x++)                         \
-            for (int y = 0; y < N; y++)                     \
-                result[x][y] = mat[y][x];                   \
+            result += MAT_AT(mat, i, i);                    \
         return result;                                      \
     }                                                       \
     vec##N mat##N##_column(mat##N mat, unsigned int column) \
@@ -84,7 +103,7 @@
         if (column >= N)                                    \
             return result;                                  \
         for (int i = 0; i < N; i++)                         \
-            result[i] = mat[i][column];                     \
+            result[i] = MAT_AT(mat, i, column);             \
         return result;                                      \
     }                                                       \
     vec##N mat##N##_row(mat##N mat, unsigned int row)       \
@@ -93,11 +112,116 @@
         if (row >= N)                                       \
             return result;                                  \
         for (int i = 0; i < N; i++)                         \
-            result[i] = mat[row][i];                        \
+            result[i] = MAT_AT(mat, row, i);                \
         return result;                                      \
     }
 __GLM_TYPES
 #undef X
+
+#ifdef GLM_SIMD
+#define __GLM_SCALAR_MATRIX_TYPES \
+    X(2)                          \
+    X(3)
+#else
+#define __GLM_SCALAR_MATRIX_TYPES __GLM_TYPES
+#endif
+
+#ifndef GLM_STRUCT_MATRICES
+#define X(N)                                      \
+    mat##N mat##N##_transpose(mat##N mat)         \
+    {                                             \
+        return __builtin_matrix_transpose(mat);   \
+    }                                             \
+    mat##N mat##N##_mul(mat##N a, mat##N b)       \
+    {                                             \
+        return a * b;                             \
+    }
+__GLM_TYPES
+#undef X
+#else
+#define X(N)                                                    \
+    mat##N mat##N##_transpose(mat##N mat)                       \
+    {                                                           \
+        mat##N result;                                          \
+        for (int x = 0; x < N; x++)                             \
+            for (int y = 0; y < N; y++)                         \
+                MAT_AT(result, x, y) = MAT_AT(mat, y, x);       \
+        return result;                                          \
+    }                                                           \
+    mat##N mat##N##_mul(mat##N a, mat##N b)                     \
+    {                                                           \
+        mat##N result;                                          \
+        for (int c = 0; c < N; c++)                             \
+            for (int r = 0; r < N; r++) {                       \
+                float sum = 0.f;                                \
+                for (int k = 0; k < N; k++)                     \
+                    sum += MAT_AT(a, r, k) * MAT_AT(b, k, c);   \
+                MAT_AT(result, r, c) = sum;                     \
+            }                                                   \
+        return result;                                          \
+    }
+__GLM_SCALAR_MATRIX_TYPES
+#undef X
+#endif
+
+#ifdef GLM_SIMD
+mat4 mat4_transpose(mat4 mat) {
+    mat4 result;
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    float32x4x4_t t = vld4q_f32(&mat.m[0][0]);
+    vst1q_f32(result.m[0], t.val[0]);
+    vst1q_f32(result.m[1], t.val[1]);
+    vst1q_f32(result.m[2], t.val[2]);
+    vst1q_f32(result.m[3], t.val[3]);
+#else
+    __m128 c0 = _mm_loadu_ps(mat.m[0]);
+    __m128 c1 = _mm_loadu_ps(mat.m[1]);
+    __m128 c2 = _mm_loadu_ps(mat.m[2]);
+    __m128 c3 = _mm_loadu_ps(mat.m[3]);
+    _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+    _mm_storeu_ps(result.m[0], c0);
+    _mm_storeu_ps(result.m[1], c1);
+    _mm_storeu_ps(result.m[2], c2);
+    _mm_storeu_ps(result.m[3], c3);
+#endif
+    return result;
+}
+
+mat4 mat4_mul(mat4 a, mat4 b) {
+    f32x4 a0 = F32X4_LOAD(a.m[0]);
+    f32x4 a1 = F32X4_LOAD(a.m[1]);
+    f32x4 a2 = F32X4_LOAD(a.m[2]);
+    f32x4 a3 = F32X4_LOAD(a.m[3]);
+    mat4 result;
+    for (int i = 0; i < 4; i++) {
+        // Column i of a*b is a's columns weighted by column i of b
+        f32x4 c = a0 * F32X4_SPLAT(b.m[i][0]);
+        c += a1 * F32X4_SPLAT(b.m[i][1]);
+        c += a2 * F32X4_SPLAT(b.m[i][2]);
+        c += a3 * F32X4_SPLAT(b.m[i][3]);
+        F32X4_STORE(result.m[i], c);
+    }
+    return result;
+}
+
+// 2x2 sub-matrices packed as { m00, m01, m10, m11 }
+static inline f32x4 mat2x2_mul(f32x4 a, f32x4 b) {
+    return a * F32X4_SHUFFLE(b, b, 0, 3, 0, 3) +
+           F32X4_SHUFFLE(a, a, 1, 0, 3, 2) * F32X4_SHUFFLE(b, b, 2, 1, 2, 1);
+}
+
+// adjugate(a) * b
+static inline f32x4 mat2x2_adj_mul(f32x4 a, f32x4 b) {
+    return F32X4_SHUFFLE(a, a, 3, 3, 0, 0) * b -
+           F32X4_SHUFFLE(a, a, 1, 1, 2, 2) * F32X4_SHUFFLE(b, b, 2, 3, 0, 1);
+}
+
+// a * adjugate(b)
+static inline f32x4 mat2x2_mul_adj(f32x4 a, f32x4 b) {
+    return a * F32X4_SHUFFLE(b, b, 3, 0, 3, 0) -
+           F32X4_SHUFFLE(a, a, 1, 0, 3, 2) * F32X4_SHUFFLE(b, b, 2, 1, 2, 1);
+}
+#endif
 #endif // GLM_NO_MATRICES
 
 #define X(N)                                                  \
@@ -110,7 +234,7 @@ __GLM_TYPES
         for (int i = 0; i < N; i++)                           \
             if (vec[i] != 0.f)                                \
                 return false;                                 \
-                return true;                                  \
+        return true;                                          \
     }                                                         \
     float vec##N##_sum(vec##N vec)                            \
     {                                                         \
@@ -179,7 +303,7 @@ __GLM_TYPES
             printf("| ");                   \
             for (int y = 0; y < N; y++)     \
             {                               \
-                printf("%.2f ", mat[y][x]); \
+                printf("%.2f ", MAT_AT(mat, y, x)); \
             }                               \
             puts("|");                      \
         }                                   \
@@ -200,13 +324,13 @@ __GLM_TYPES
 #endif // GLM_NO_PRINT
 
 float vec2_angle(vec2 v1, vec2 v2) {
-    return atan2f(v2.y, v2.x) - atan2f(v1.y, v1.x);
+    return atan2f(v2[1], v2[0]) - atan2f(v1[1], v1[0]);
 }
 
 vec2 vec2_rotate(vec2 v, float angle) {
     float c = cosf(angle);
     float s = sinf(angle);
-    return (vec2) { v.x*c - v.y*s,  v.x*s + v.y*c };
+    return (vec2) { v[0]*c - v[1]*s,  v[0]*s + v[1]*c };
 }
 
 vec2 vec2_move_towards(vec2 v, vec2 target, float maxDistance) {
@@ -223,7 +347,7 @@ vec2 vec2_reflect(vec2 v, vec2 normal) {
 }
 
 float vec2_cross(vec2 a, vec2 b) {
-    return a.x * b.y - a.y * b.x;
+    return a[0] * b[1] - a[1] * b[0];
 }
 
 vec3 vec3_reflect(vec3 v, vec3 normal) {
@@ -231,21 +355,21 @@ vec3 vec3_reflect(vec3 v, vec3 normal) {
 }
 
 vec3 vec3_cross(vec3 v1, vec3 v2) {
-    return (vec3) { v1.y*v2.z - v1.z*v2.y, v1.z*v2.x - v1.x*v2.z, v1.x*v2.y - v1.y*v2.x };
+    return (vec3) { v1[1]*v2[2] - v1[2]*v2[1], v1[2]*v2[0] - v1[0]*v2[2], v1[0]*v2[1] - v1[1]*v2[0] };
 }
 
 vec3 vec3_perpendicular(vec3 v) {
-    float min = (float) fabs(v.x);
+    float min = (float) fabs(v[0]);
     vec3 a = {1.0f, 0.0f, 0.0f};
-    if (fabsf(v.y) < min) {
-        min = (float) fabs(v.y);
+    if (fabsf(v[1]) < min) {
+        min = (float) fabs(v[1]);
         a = (vec3){0.0f, 1.0f, 0.0f};
     }
-    if (fabsf(v.z) < min)
+    if (fabsf(v[2]) < min)
         a = (vec3){0.0f, 0.0f, 1.0f};
-    return (vec3) { v.y*a.z - v.z*a.y,
-                    v.z*a.x - v.x*a.z,
-                    v.x*a.y - v.y*a.x };
+    return (vec3) { v[1]*a[2] - v[2]*a[1],
+                    v[2]*a[0] - v[0]*a[2],
+                    v[0]*a[1] - v[1]*a[0] };
 }
 
 float vec3_angle(vec3 v1, vec3 v2) {
@@ -254,9 +378,9 @@ float vec3_angle(vec3 v1, vec3 v2) {
 
 vec3 quat_rotate_vec3(vec3 v, quat q) {
     return (vec3) {
-        v.x*(q.x*q.x + q.w*q.w - q.y*q.y - q.z*q.z) + v.y*(2*q.x*q.y - 2*q.w*q.z) + v.z*(2*q.x*q.z + 2*q.w*q.y),
-        v.x*(2*q.w*q.z + 2*q.x*q.y) + v.y*(q.w*q.w - q.x*q.x + q.y*q.y - q.z*q.z) + v.z*(-2*q.w*q.x + 2*q.y*q.z),
-        v.x*(-2*q.w*q.y + 2*q.x*q.z) + v.y*(2*q.w*q.x + 2*q.y*q.z)+ v.z*(q.w*q.w - q.x*q.x - q.y*q.y + q.z*q.z)
+        v[0]*(q[0]*q[0] + q[3]*q[3] - q[1]*q[1] - q[2]*q[2]) + v[1]*(2*q[0]*q[1] - 2*q[3]*q[2]) + v[2]*(2*q[0]*q[2] + 2*q[3]*q[1]),
+        v[0]*(2*q[3]*q[2] + 2*q[0]*q[1]) + v[1]*(q[3]*q[3] - q[0]*q[0] + q[1]*q[1] - q[2]*q[2]) + v[2]*(-2*q[3]*q[0] + 2*q[1]*q[2]),
+        v[0]*(-2*q[3]*q[1] + 2*q[0]*q[2]) + v[1]*(2*q[3]*q[0] + 2*q[1]*q[2])+ v[2]*(q[3]*q[3] - q[0]*q[0] - q[1]*q[1] + q[2]*q[2])
     };
 }
 
@@ -302,8 +426,8 @@ quat quat_identity(void) {
 }
 
 quat quat_mul(quat q1, quat q2) {
-    float qax = q1.x, qay = q1.y, qaz = q1.z, qaw = q1.w;
-    float qbx = q2.x, qby = q2.y, qbz = q2.z, qbw = q2.w;
+    float qax = q1[0], qay = q1[1], qaz = q1[2], qaw = q1[3];
+    float qbx = q2[0], qby = q2[1], qbz = q2[2], qbw = q2[3];
     return (quat) {
         qax*qbw + qaw*qbx + qay*qbz - qaz*qby,
         qay*qbw + qaw*qby + qaz*qbx - qax*qbz,
@@ -324,14 +448,15 @@ quat quat_invert(quat q) {
 
 quat quat_to_from_vec3(vec3 from, vec3 to) {
     vec3 cross = vec3_cross(from, to);
-    return vec4_normalize((quat){cross.x, cross.y, cross.z, 1.f + vec3_dot(from, to)});
+    return vec4_normalize((quat){cross[0], cross[1], cross[2], 1.f + vec3_dot(from, to)});
 }
 
+#ifndef GLM_NO_MATRICES
 quat quat_from_mat4(mat4 mat) {
-    float fourWSquaredMinus1 = mat[0][0] + mat[1][1] + mat[2][2];
-    float fourXSquaredMinus1 = mat[0][0] - mat[1][1] - mat[2][2];
-    float fourYSquaredMinus1 = mat[1][1] - mat[0][0] - mat[2][2];
-    float fourZSquaredMinus1 = mat[2][2] - mat[0][0] - mat[1][1];
+    float fourWSquaredMinus1 = MAT_AT(mat, 0, 0) + MAT_AT(mat, 1, 1) + MAT_AT(mat, 2, 2);
+    float fourXSquaredMinus1 = MAT_AT(mat, 0, 0) - MAT_AT(mat, 1, 1) - MAT_AT(mat, 2, 2);
+    float fourYSquaredMinus1 = MAT_AT(mat, 1, 1) - MAT_AT(mat, 0, 0) - MAT_AT(mat, 2, 2);
+    float fourZSquaredMinus1 = MAT_AT(mat, 2, 2) - MAT_AT(mat, 0, 0) - MAT_AT(mat, 1, 1);
 
     int biggestIndex = 0;
     float fourBiggestSquaredMinus1 = fourWSquaredMinus1;
@@ -354,32 +479,32 @@ quat quat_from_mat4(mat4 mat) {
     {
         case 0:
             return (quat) {
-                (mat[2][1] - mat[1][2]) * mult,
-                (mat[0][2] - mat[2][0]) * mult,
-                (mat[1][0] - mat[0][1]) * mult,
+                (MAT_AT(mat, 2, 1) - MAT_AT(mat, 1, 2)) * mult,
+                (MAT_AT(mat, 0, 2) - MAT_AT(mat, 2, 0)) * mult,
+                (MAT_AT(mat, 1, 0) - MAT_AT(mat, 0, 1)) * mult,
                 biggestVal
             };
             break;
         case 1:
             return (quat) {
                 biggestVal,
-                (mat[1][0] + mat[0][1]) * mult,
-                (mat[0][2] + mat[2][0]) * mult,
-                (mat[2][1] - mat[1][2]) * mult
+                (MAT_AT(mat, 1, 0) + MAT_AT(mat, 0, 1)) * mult,
+                (MAT_AT(mat, 0, 2) + MAT_AT(mat, 2, 0)) * mult,
+                (MAT_AT(mat, 2, 1) - MAT_AT(mat, 1, 2)) * mult
             };
         case 2:
             return (quat) {
                 biggestVal,
-                (mat[1][0] + mat[0][1]) * mult,
-                (mat[0][2] + mat[2][0]) * mult,
-                (mat[2][1] - mat[1][2]) * mult
+                (MAT_AT(mat, 1, 0) + MAT_AT(mat, 0, 1)) * mult,
+                (MAT_AT(mat, 0, 2) + MAT_AT(mat, 2, 0)) * mult,
+                (MAT_AT(mat, 2, 1) - MAT_AT(mat, 1, 2)) * mult
             };
         case 3:
             return (quat) {
                 biggestVal,
-                (mat[1][0] + mat[0][1]) * mult,
-                (mat[0][2] + mat[2][0]) * mult,
-                (mat[2][1] - mat[1][2]) * mult
+                (MAT_AT(mat, 1, 0) + MAT_AT(mat, 0, 1)) * mult,
+                (MAT_AT(mat, 0, 2) + MAT_AT(mat, 2, 0)) * mult,
+                (MAT_AT(mat, 2, 1) - MAT_AT(mat, 1, 2)) * mult
             };
         default:
             return quat_zero();
@@ -387,46 +512,45 @@ quat quat_from_mat4(mat4 mat) {
 }
 
 vec3 vec3_unproject(vec3 source, mat4 projection, mat4 view) {
-    quat p = quat_transform((quat){source.x, source.y, source.z, 1.f }, mat4_invert(view * projection));
+    quat p = quat_transform((quat){source[0], source[1], source[2], 1.f }, mat4_invert(mat4_mul(view, projection)));
     return (vec3) {
-        p.x / p.w,
-        p.y / p.w,
-        p.z / p.w
+        p[0] / p[3],
+        p[1] / p[3],
+        p[2] / p[3]
     };
 }
 
-#ifndef GLM_NO_MATRICES
 vec3 vec3_transform(vec3 v, mat4 mat) {
     return (vec3) {
-        mat[0][0]*v.x + mat[0][1]*v.y + mat[0][2]*v.z + mat[0][3],
-        mat[1][0]*v.x + mat[1][1]*v.y + mat[1][2]*v.z + mat[1][3],
-        mat[2][0]*v.x + mat[2][1]*v.y + mat[2][2]*v.z + mat[2][3]
+        MAT_AT(mat, 0, 0)*v[0] + MAT_AT(mat, 0, 1)*v[1] + MAT_AT(mat, 0, 2)*v[2] + MAT_AT(mat, 0, 3),
+        MAT_AT(mat, 1, 0)*v[0] + MAT_AT(mat, 1, 1)*v[1] + MAT_AT(mat, 1, 2)*v[2] + MAT_AT(mat, 1, 3),
+        MAT_AT(mat, 2, 0)*v[0] + MAT_AT(mat, 2, 1)*v[1] + MAT_AT(mat, 2, 2)*v[2] + MAT_AT(mat, 2, 3)
     };
 }
 
 mat4 mat4_from_quat(quat q) {
-    float a2 = q.x*q.x;
-    float b2 = q.y*q.y;
-    float c2 = q.z*q.z;
-    float ac = q.x*q.z;
-    float ab = q.x*q.y;
-    float bc = q.y*q.z;
-    float ad = q.w*q.x;
-    float bd = q.w*q.y;
-    float cd = q.w*q.z;
+    float a2 = q[0]*q[0];
+    float b2 = q[1]*q[1];
+    float c2 = q[2]*q[2];
+    float ac = q[0]*q[2];
+    float ab = q[0]*q[1];
+    float bc = q[1]*q[2];
+    float ad = q[3]*q[0];
+    float bd = q[3]*q[1];
+    float cd = q[3]*q[2];
 
     mat4 result = mat4_identity();
-    result[0][0] = 1 - 2*(b2 + c2);
-    result[1][0] = 2*(ab + cd);
-    result[2][0] = 2*(ac - bd);
+    MAT_AT(result, 0, 0) = 1 - 2*(b2 + c2);
+    MAT_AT(result, 1, 0) = 2*(ab + cd);
+    MAT_AT(result, 2, 0) = 2*(ac - bd);
 
-    result[0][1] = 2*(ab - cd);
-    result[1][1] = 1 - 2*(a2 + c2);
-    result[2][1] = 2*(bc + ad);
+    MAT_AT(result, 0, 1) = 2*(ab - cd);
+    MAT_AT(result, 1, 1) = 1 - 2*(a2 + c2);
+    MAT_AT(result, 2, 1) = 2*(bc + ad);
 
-    result[0][2] = 2*(ac + bd);
-    result[1][2] = 2*(bc - ad);
-    result[2][2] = 1 - 2*(a2 + b2);
+    MAT_AT(result, 0, 2) = 2*(ac + bd);
+    MAT_AT(result, 1, 2) = 2*(bc - ad);
+    MAT_AT(result, 2, 2) = 1 - 2*(a2 + b2);
     return result;
 }
 
@@ -440,19 +564,19 @@ quat quat_from_axis_angle(vec3 axis, float angle) {
     float sinres = sinf(angle);
     float cosres = cosf(angle);
     return (quat) {
-        axis.x*sinres,
-        axis.y*sinres,
-        axis.z*sinres,
+        axis[0]*sinres,
+        axis[1]*sinres,
+        axis[2]*sinres,
         cosres
     };
 }
 
 void quat_to_axis_angle(quat q, vec3 *outAxis, float *outAngle) {
-    if (fabsf(q.w) > 1.0f)
+    if (fabsf(q[3]) > 1.0f)
         q = vec4_normalize(q);
-    float resAngle = 2.0f*acosf(q.w);
-    float den = sqrtf(1.0f - q.w*q.w);
-    vec3 qxyz = (vec3){q.x, q.y, q.z};
+    float resAngle = 2.0f*acosf(q[3]);
+    float den = sqrtf(1.0f - q[3]*q[3]);
+    vec3 qxyz = (vec3){q[0], q[1], q[2]};
     vec3 resAxis = den > EPSILON ? qxyz / den : (vec3){1.f, 0.f, 0.f};
     *outAxis = resAxis;
     *outAngle = resAngle;
@@ -476,15 +600,15 @@ quat quat_from_euler(float pitch, float yaw, float roll) {
 
 vec3 quat_to_euler(quat q) {
     // Roll (x-axis rotation)
-    float x0 = 2.0f*(q.w*q.x + q.y*q.z);
-    float x1 = 1.0f - 2.0f*(q.x*q.x + q.y*q.y);
+    float x0 = 2.0f*(q[3]*q[0] + q[1]*q[2]);
+    float x1 = 1.0f - 2.0f*(q[0]*q[0] + q[1]*q[1]);
     // Pitch (y-axis rotation)
-    float y0 = 2.0f*(q.w*q.y - q.z*q.x);
+    float y0 = 2.0f*(q[3]*q[1] - q[2]*q[0]);
     y0 = y0 > 1.0f ? 1.0f : y0;
     y0 = y0 < -1.0f ? -1.0f : y0;
     // Yaw (z-axis rotation)
-    float z0 = 2.0f*(q.w*q.z + q.x*q.y);
-    float z1 = 1.0f - 2.0f*(q.y*q.y + q.z*q.z);
+    float z0 = 2.0f*(q[3]*q[2] + q[0]*q[1]);
+    float z1 = 1.0f - 2.0f*(q[1]*q[1] + q[2]*q[2]);
     return (vec3) {
         atan2f(x0, x1),
         asinf(y0),
@@ -494,89 +618,140 @@ vec3 quat_to_euler(quat q) {
 
 quat quat_transform(quat q, mat4 mat) {
     return (quat) {
-        mat[0][0]*q.x + mat[0][1]*q.y + mat[0][2]*q.z + mat[0][3]*q.w,
-        mat[1][0]*q.x + mat[1][1]*q.y + mat[1][2]*q.z + mat[1][3]*q.w,
-        mat[2][0]*q.x + mat[2][1]*q.y + mat[2][2]*q.z + mat[2][3]*q.w,
-        mat[3][0]*q.x + mat[3][1]*q.y + mat[3][2]*q.z + mat[3][3]*q.w
+        MAT_AT(mat, 0, 0)*q[0] + MAT_AT(mat, 0, 1)*q[1] + MAT_AT(mat, 0, 2)*q[2] + MAT_AT(mat, 0, 3)*q[3],
+        MAT_AT(mat, 1, 0)*q[0] + MAT_AT(mat, 1, 1)*q[1] + MAT_AT(mat, 1, 2)*q[2] + MAT_AT(mat, 1, 3)*q[3],
+        MAT_AT(mat, 2, 0)*q[0] + MAT_AT(mat, 2, 1)*q[1] + MAT_AT(mat, 2, 2)*q[2] + MAT_AT(mat, 2, 3)*q[3],
+        MAT_AT(mat, 3, 0)*q[0] + MAT_AT(mat, 3, 1)*q[1] + MAT_AT(mat, 3, 2)*q[2] + MAT_AT(mat, 3, 3)*q[3]
     };
 }
 
 int quat_cmp(quat p, quat q) {
-    return (((fabsf(p.x - q.x)) <= (EPSILON*fmaxf(1.0f, fmaxf(fabsf(p.x), fabsf(q.x))))) && ((fabsf(p.y - q.y)) <= (EPSILON*fmaxf(1.0f, fmaxf(fabsf(p.y), fabsf(q.y))))) && ((fabsf(p.z - q.z)) <= (EPSILON*fmaxf(1.0f, fmaxf(fabsf(p.z), fabsf(q.z))))) && ((fabsf(p.w - q.w)) <= (EPSILON*fmaxf(1.0f, fmaxf(fabsf(p.w), fabsf(q.w)))))) || (((fabsf(p.x + q.x)) <= (EPSILON*fmaxf(1.0f, fmaxf(fabsf(p.x), fabsf(q.x))))) && ((fabsf(p.y + q.y)) <= (EPSILON*fmaxf(1.0f, fmaxf(fabsf(p.y), fabsf(q.y))))) && ((fabsf(p.z + q.z)) <= (EPSILON*fmaxf(1.0f, fmaxf(fabsf(p.z), fabsf(q.z))))) && ((fabsf(p.w + q.w)) <= (EPSILON*fmaxf(1.0f, fmaxf(fabsf(p.w), fabsf(q.w))))));
+    return (((fabsf(p[0] - q[0])) <= (EPSILON*fmaxf(1.0f, fmaxf(fabsf(p[0]), fabsf(q[0]))))) && ((fabsf(p[1] - q[1])) <= (EPSILON*fmaxf(1.0f, fmaxf(fabsf(p[1]), fabsf(q[1]))))) && ((fabsf(p[2] - q[2])) <= (EPSILON*fmaxf(1.0f, fmaxf(fabsf(p[2]), fabsf(q[2]))))) && ((fabsf(p[3] - q[3])) <= (EPSILON*fmaxf(1.0f, fmaxf(fabsf(p[3]), fabsf(q[3])))))) || (((fabsf(p[0] + q[0])) <= (EPSILON*fmaxf(1.0f, fmaxf(fabsf(p[0]), fabsf(q[0]))))) && ((fabsf(p[1] + q[1])) <= (EPSILON*fmaxf(1.0f, fmaxf(fabsf(p[1]), fabsf(q[1]))))) && ((fabsf(p[2] + q[2])) <= (EPSILON*fmaxf(1.0f, fmaxf(fabsf(p[2]), fabsf(q[2]))))) && ((fabsf(p[3] + q[3])) <= (EPSILON*fmaxf(1.0f, fmaxf(fabsf(p[3]), fabsf(q[3]))))));
 }
 
 float mat4_determinant(mat4 mat) {
-    return mat[0][3]*mat[1][2]*mat[2][1]*mat[3][0] - mat[0][2]*mat[1][3]*mat[2][1]*mat[3][0] - mat[0][3]*mat[1][1]*mat[2][2]*mat[3][0] + mat[0][1]*mat[1][3]*mat[2][2]*mat[3][0] + mat[0][2]*mat[1][1]*mat[2][3]*mat[3][0] - mat[0][1]*mat[1][2]*mat[2][3]*mat[3][0] - mat[0][3]*mat[1][2]*mat[2][0]*mat[3][1] + mat[0][2]*mat[1][3]*mat[2][0]*mat[3][1] + mat[0][3]*mat[1][0]*mat[2][2]*mat[3][1] - mat[0][0]*mat[1][3]*mat[2][2]*mat[3][1] - mat[0][2]*mat[1][0]*mat[2][3]*mat[3][1] + mat[0][0]*mat[1][2]*mat[2][3]*mat[3][1] + mat[0][3]*mat[1][1]*mat[2][0]*mat[3][2] - mat[0][1]*mat[1][3]*mat[2][0]*mat[3][2] - mat[0][3]*mat[1][0]*mat[2][1]*mat[3][2] + mat[0][0]*mat[1][3]*mat[2][1]*mat[3][2] + mat[0][1]*mat[1][0]*mat[2][3]*mat[3][2] - mat[0][0]*mat[1][1]*mat[2][3]*mat[3][2] - mat[0][2]*mat[1][1]*mat[2][0]*mat[3][3] + mat[0][1]*mat[1][2]*mat[2][0]*mat[3][3] + mat[0][2]*mat[1][0]*mat[2][1]*mat[3][3] - mat[0][0]*mat[1][2]*mat[2][1]*mat[3][3] - mat[0][1]*mat[1][0]*mat[2][2]*mat[3][3] + mat[0][0]*mat[1][1]*mat[2][2]*mat[3][3];
+    return MAT_AT(mat, 0, 3)*MAT_AT(mat, 1, 2)*MAT_AT(mat, 2, 1)*MAT_AT(mat, 3, 0) - MAT_AT(mat, 0, 2)*MAT_AT(mat, 1, 3)*MAT_AT(mat, 2, 1)*MAT_AT(mat, 3, 0) - MAT_AT(mat, 0, 3)*MAT_AT(mat, 1, 1)*MAT_AT(mat, 2, 2)*MAT_AT(mat, 3, 0) + MAT_AT(mat, 0, 1)*MAT_AT(mat, 1, 3)*MAT_AT(mat, 2, 2)*MAT_AT(mat, 3, 0) + MAT_AT(mat, 0, 2)*MAT_AT(mat, 1, 1)*MAT_AT(mat, 2, 3)*MAT_AT(mat, 3, 0) - MAT_AT(mat, 0, 1)*MAT_AT(mat, 1, 2)*MAT_AT(mat, 2, 3)*MAT_AT(mat, 3, 0) - MAT_AT(mat, 0, 3)*MAT_AT(mat, 1, 2)*MAT_AT(mat, 2, 0)*MAT_AT(mat, 3, 1) + MAT_AT(mat, 0, 2)*MAT_AT(mat, 1, 3)*MAT_AT(mat, 2, 0)*MAT_AT(mat, 3, 1) + MAT_AT(mat, 0, 3)*MAT_AT(mat, 1, 0)*MAT_AT(mat, 2, 2)*MAT_AT(mat, 3, 1) - MAT_AT(mat, 0, 0)*MAT_AT(mat, 1, 3)*MAT_AT(mat, 2, 2)*MAT_AT(mat, 3, 1) - MAT_AT(mat, 0, 2)*MAT_AT(mat, 1, 0)*MAT_AT(mat, 2, 3)*MAT_AT(mat, 3, 1) + MAT_AT(mat, 0, 0)*MAT_AT(mat, 1, 2)*MAT_AT(mat, 2, 3)*MAT_AT(mat, 3, 1) + MAT_AT(mat, 0, 3)*MAT_AT(mat, 1, 1)*MAT_AT(mat, 2, 0)*MAT_AT(mat, 3, 2) - MAT_AT(mat, 0, 1)*MAT_AT(mat, 1, 3)*MAT_AT(mat, 2, 0)*MAT_AT(mat, 3, 2) - MAT_AT(mat, 0, 3)*MAT_AT(mat, 1, 0)*MAT_AT(mat, 2, 1)*MAT_AT(mat, 3, 2) + MAT_AT(mat, 0, 0)*MAT_AT(mat, 1, 3)*MAT_AT(mat, 2, 1)*MAT_AT(mat, 3, 2) + MAT_AT(mat, 0, 1)*MAT_AT(mat, 1, 0)*MAT_AT(mat, 2, 3)*MAT_AT(mat, 3, 2) - MAT_AT(mat, 0, 0)*MAT_AT(mat, 1, 1)*MAT_AT(mat, 2, 3)*MAT_AT(mat, 3, 2) - MAT_AT(mat, 0, 2)*MAT_AT(mat, 1, 1)*MAT_AT(mat, 2, 0)*MAT_AT(mat, 3, 3) + MAT_AT(mat, 0, 1)*MAT_AT(mat, 1, 2)*MAT_AT(mat, 2, 0)*MAT_AT(mat, 3, 3) + MAT_AT(mat, 0, 2)*MAT_AT(mat, 1, 0)*MAT_AT(mat, 2, 1)*MAT_AT(mat, 3, 3) - MAT_AT(mat, 0, 0)*MAT_AT(mat, 1, 2)*MAT_AT(mat, 2, 1)*MAT_AT(mat, 3, 3) - MAT_AT(mat, 0, 1)*MAT_AT(mat, 1, 0)*MAT_AT(mat, 2, 2)*MAT_AT(mat, 3, 3) + MAT_AT(mat, 0, 0)*MAT_AT(mat, 1, 1)*MAT_AT(mat, 2, 2)*MAT_AT(mat, 3, 3);
 }
 
+#ifdef GLM_SIMD
+// Block-wise inverse using 2x2 sub-matrices (Cramer's rule on blocks)
+// The algorithm is layout agnostic: inverting the transpose and storing it
+// back transposed is the same as inverting in column-major directly
+mat4 mat4_invert(mat4 mat) {
+    f32x4 c0 = F32X4_LOAD(mat.m[0]);
+    f32x4 c1 = F32X4_LOAD(mat.m[1]);
+    f32x4 c2 = F32X4_LOAD(mat.m[2]);
+    f32x4 c3 = F32X4_LOAD(mat.m[3]);
+
+    f32x4 A = F32X4_SHUFFLE(c0, c1, 0, 1, 0, 1);
+    f32x4 B = F32X4_SHUFFLE(c0, c1, 2, 3, 2, 3);
+    f32x4 C = F32X4_SHUFFLE(c2, c3, 0, 1, 0, 1);
+    f32x4 D = F32X4_SHUFFLE(c2, c3, 2, 3, 2, 3);
+
+    // { |A|, |B|, |C|, |D| }
+    f32x4 det_sub = F32X4_SHUFFLE(c0, c2, 0, 2, 0, 2) * F32X4_SHUFFLE(c1, c3, 1, 3, 1, 3) -
+                    F32X4_SHUFFLE(c0, c2, 1, 3, 1, 3) * F32X4_SHUFFLE(c1, c3, 0, 2, 0, 2);
+    f32x4 det_a = F32X4_SHUFFLE(det_sub, det_sub, 0, 0, 0, 0);
+    f32x4 det_b = F32X4_SHUFFLE(det_sub, det_sub, 1, 1, 1, 1);
+    f32x4 det_c = F32X4_SHUFFLE(det_sub, det_sub, 2, 2, 2, 2);
+    f32x4 det_d = F32X4_SHUFFLE(det_sub, det_sub, 3, 3, 3, 3);
+
+    f32x4 d_c = mat2x2_adj_mul(D, C);
+    f32x4 a_b = mat2x2_adj_mul(A, B);
+    f32x4 x = det_d * A - mat2x2_mul(B, d_c);
+    f32x4 w = det_a * D - mat2x2_mul(C, a_b);
+    f32x4 y = det_b * C - mat2x2_mul_adj(D, a_b);
+    f32x4 z = det_c * B - mat2x2_mul_adj(A, d_c);
+
+    // |M| = |A||D| + |B||C| - tr((A#B)(D#C))
+    f32x4 tr = a_b * F32X4_SHUFFLE(d_c, d_c, 0, 2, 1, 3);
+    tr = tr + F32X4_SHUFFLE(tr, tr, 2, 3, 0, 1);
+    tr = tr + F32X4_SHUFFLE(tr, tr, 1, 0, 3, 2);
+    f32x4 det = det_a * det_d + det_b * det_c - tr;
+    f32x4 sign = {1.f, -1.f, -1.f, 1.f};
+    f32x4 inv_det = sign / det;
+    x *= inv_det;
+    y *= inv_det;
+    z *= inv_det;
+    w *= inv_det;
+
+    mat4 result;
+    F32X4_STORE(result.m[0], F32X4_SHUFFLE(x, y, 3, 1, 3, 1));
+    F32X4_STORE(result.m[1], F32X4_SHUFFLE(x, y, 2, 0, 2, 0));
+    F32X4_STORE(result.m[2], F32X4_SHUFFLE(z, w, 3, 1, 3, 1));
+    F32X4_STORE(result.m[3], F32X4_SHUFFLE(z, w, 2, 0, 2, 0));
+    return result;
+}
+#else
 mat4 mat4_invert(mat4 mat) {
-    float b00 = mat[0][0]*mat[1][1] - mat[1][0]*mat[0][1];
-    float b01 = mat[0][0]*mat[2][1] - mat[2][0]*mat[0][1];
-    float b02 = mat[0][0]*mat[3][1] - mat[3][0]*mat[0][1];
-    float b03 = mat[1][0]*mat[2][1] - mat[2][0]*mat[1][1];
-    float b04 = mat[1][0]*mat[3][1] - mat[3][0]*mat[1][1];
-    float b05 = mat[2][0]*mat[3][1] - mat[3][0]*mat[2][1];
-    float b06 = mat[0][2]*mat[1][3] - mat[1][2]*mat[0][3];
-    float b07 = mat[0][2]*mat[2][3] - mat[2][2]*mat[0][3];
-    float b08 = mat[0][2]*mat[3][3] - mat[3][2]*mat[0][3];
-    float b09 = mat[1][2]*mat[2][3] - mat[2][2]*mat[1][3];
-    float b10 = mat[1][2]*mat[3][3] - mat[3][2]*mat[1][3];
-    float b11 = mat[2][2]*mat[3][3] - mat[3][2]*mat[2][3];
+    float b00 = MAT_AT(mat, 0, 0)*MAT_AT(mat, 1, 1) - MAT_AT(mat, 1, 0)*MAT_AT(mat, 0, 1);
+    float b01 = MAT_AT(mat, 0, 0)*MAT_AT(mat, 2, 1) - MAT_AT(mat, 2, 0)*MAT_AT(mat, 0, 1);
+    float b02 = MAT_AT(mat, 0, 0)*MAT_AT(mat, 3, 1) - MAT_AT(mat, 3, 0)*MAT_AT(mat, 0, 1);
+    float b03 = MAT_AT(mat, 1, 0)*MAT_AT(mat, 2, 1) - MAT_AT(mat, 2, 0)*MAT_AT(mat, 1, 1);
+    float b04 = MAT_AT(mat, 1, 0)*MAT_AT(mat, 3, 1) - MAT_AT(mat, 3, 0)*MAT_AT(mat, 1, 1);
+    float b05 = MAT_AT(mat, 2, 0)*MAT_AT(mat, 3, 1) - MAT_AT(mat, 3, 0)*MAT_AT(mat, 2, 1);
+    float b06 = MAT_AT(mat, 0, 2)*MAT_AT(mat, 1, 3) - MAT_AT(mat, 1, 2)*MAT_AT(mat, 0, 3);
+    float b07 = MAT_AT(mat, 0, 2)*MAT_AT(mat, 2, 3) - MAT_AT(mat, 2, 2)*MAT_AT(mat, 0, 3);
+    float b08 = MAT_AT(mat, 0, 2)*MAT_AT(mat, 3, 3) - MAT_AT(mat, 3, 2)*MAT_AT(mat, 0, 3);
+    float b09 = MAT_AT(mat, 1, 2)*MAT_AT(mat, 2, 3) - MAT_AT(mat, 2, 2)*MAT_AT(mat, 1, 3);
+    float b10 = MAT_AT(mat, 1, 2)*MAT_AT(mat, 3, 3) - MAT_AT(mat, 3, 2)*MAT_AT(mat, 1, 3);
+    float b11 = MAT_AT(mat, 2, 2)*MAT_AT(mat, 3, 3) - MAT_AT(mat, 3, 2)*MAT_AT(mat, 2, 3);
     float invDet = 1.0f/(b00*b11 - b01*b10 + b02*b09 + b03*b08 - b04*b07 + b05*b06);
 
     mat4 result = Mat4();
-    result[0][0] = (mat[1][1]*b11 - mat[2][1]*b10 + mat[3][1]*b09)*invDet;
-    result[1][0] = (-mat[1][0]*b11 + mat[2][0]*b10 - mat[3][0]*b09)*invDet;
-    result[2][0] = (mat[1][3]*b05 - mat[2][3]*b04 + mat[3][3]*b03)*invDet;
-    result[3][0] = (-mat[1][2]*b05 + mat[2][2]*b04 - mat[3][2]*b03)*invDet;
-    result[0][1] = (-mat[0][1]*b11 + mat[2][1]*b08 - mat[3][1]*b07)*invDet;
-    result[1][1] = (mat[0][0]*b11 - mat[2][0]*b08 + mat[3][0]*b07)*invDet;
-    result[2][1] = (-mat[0][3]*b05 + mat[2][3]*b02 - mat[3][3]*b01)*invDet;
-    result[3][1] = (mat[0][2]*b05 - mat[2][2]*b02 + mat[3][2]*b01)*invDet;
-    result[0][2] = (mat[0][1]*b10 - mat[1][1]*b08 + mat[3][1]*b06)*invDet;
-    result[1][2] = (-mat[0][0]*b10 + mat[1][0]*b08 - mat[3][0]*b06)*invDet;
-    result[2][2] = (mat[0][3]*b04 - mat[1][3]*b02 + mat[3][3]*b00)*invDet;
-    result[3][2] = (-mat[0][2]*b04 + mat[1][2]*b02 - mat[3][2]*b00)*invDet;
-    result[0][3] = (-mat[0][1]*b09 + mat[1][1]*b07 - mat[2][1]*b06)*invDet;
-    result[1][3] = (mat[0][0]*b09 - mat[1][0]*b07 + mat[2][0]*b06)*invDet;
-    result[2][3] = (-mat[0][3]*b03 + mat[1][3]*b01 - mat[2][3]*b00)*invDet;
-    result[3][3] = (mat[0][2]*b03 - mat[1][2]*b01 + mat[2][2]*b00)*invDet;
+    MAT_AT(result, 0, 0) = (MAT_AT(mat, 1, 1)*b11 - MAT_AT(mat, 2, 1)*b10 + MAT_AT(mat, 3, 1)*b09)*invDet;
+    MAT_AT(result, 1, 0) = (-MAT_AT(mat, 1, 0)*b11 + MAT_AT(mat, 2, 0)*b10 - MAT_AT(mat, 3, 0)*b09)*invDet;
+    MAT_AT(result, 2, 0) = (MAT_AT(mat, 1, 3)*b05 - MAT_AT(mat, 2, 3)*b04 + MAT_AT(mat, 3, 3)*b03)*invDet;
+    MAT_AT(result, 3, 0) = (-MAT_AT(mat, 1, 2)*b05 + MAT_AT(mat, 2, 2)*b04 - MAT_AT(mat, 3, 2)*b03)*invDet;
+    MAT_AT(result, 0, 1) = (-MAT_AT(mat, 0, 1)*b11 + MAT_AT(mat, 2, 1)*b08 - MAT_AT(mat, 3, 1)*b07)*invDet;
+    MAT_AT(result, 1, 1) = (MAT_AT(mat, 0, 0)*b11 - MAT_AT(mat, 2, 0)*b08 + MAT_AT(mat, 3, 0)*b07)*invDet;
+    MAT_AT(result, 2, 1) = (-MAT_AT(mat, 0, 3)*b05 + MAT_AT(mat, 2, 3)*b02 - MAT_AT(mat, 3, 3)*b01)*invDet;
+    MAT_AT(result, 3, 1) = (MAT_AT(mat, 0, 2)*b05 - MAT_AT(mat, 2, 2)*b02 + MAT_AT(mat, 3, 2)*b01)*invDet;
+    MAT_AT(result, 0, 2) = (MAT_AT(mat, 0, 1)*b10 - MAT_AT(mat, 1, 1)*b08 + MAT_AT(mat, 3, 1)*b06)*invDet;
+    MAT_AT(result, 1, 2) = (-MAT_AT(mat, 0, 0)*b10 + MAT_AT(mat, 1, 0)*b08 - MAT_AT(mat, 3, 0)*b06)*invDet;
+    MAT_AT(result, 2, 2) = (MAT_AT(mat, 0, 3)*b04 - MAT_AT(mat, 1, 3)*b02 + MAT_AT(mat, 3, 3)*b00)*invDet;
+    MAT_AT(result, 3, 2) = (-MAT_AT(mat, 0, 2)*b04 + MAT_AT(mat, 1, 2)*b02 - MAT_AT(mat, 3, 2)*b00)*invDet;
+    MAT_AT(result, 0, 3) = (-MAT_AT(mat, 0, 1)*b09 + MAT_AT(mat, 1, 1)*b07 - MAT_AT(mat, 2, 1)*b06)*invDet;
+    MAT_AT(result, 1, 3) = (MAT_AT(mat, 0, 0)*b09 - MAT_AT(mat, 1, 0)*b07 + MAT_AT(mat, 2, 0)*b06)*invDet;
+    MAT_AT(result, 2, 3) = (-MAT_AT(mat, 0, 3)*b03 + MAT_AT(mat, 1, 3)*b01 - MAT_AT(mat, 2, 3)*b00)*invDet;
+    MAT_AT(result, 3, 3) = (MAT_AT(mat, 0, 2)*b03 - MAT_AT(mat, 1, 2)*b01 + MAT_AT(mat, 2, 2)*b00)*invDet;
     return result;
 }
+#endif
 
 mat4 mat4_translate(vec3 v) {
     mat4 result = mat4_identity();
-    result[0][3] = v.x;
-    result[1][3] = v.y;
-    result[2][3] = v.z;
+    MAT_AT(result, 0, 3) = v[0];
+    MAT_AT(result, 1, 3) = v[1];
+    MAT_AT(result, 2, 3) = v[2];
     return result;
 }
 
 mat4 mat4_rotate(vec3 axis, float angle) {
-    vec3 a = vec3_length_sqr(axis);
+    vec3 a = vec3_normalize(axis);
     float s = sinf(angle);
     float c = cosf(angle);
     float t = 1.f - c;
 
     mat4 result = mat4_identity();
-    result[0][0] = a.x*a.x*t + c;
-    result[1][0] = a.y*a.x*t + a.z*s;
-    result[2][0] = a.z*a.x*t - a.y*s;
-    result[0][1] = a.x*a.y*t - a.z*s;
-    result[1][1] = a.y*a.y*t + c;
-    result[2][1] = a.z*a.y*t + a.x*s;
-    result[0][2] = a.x*a.z*t + a.y*s;
-    result[1][2] = a.y*a.z*t - a.x*s;
-    result[2][2] = a.z*a.z*t + c;
+    MAT_AT(result, 0, 0) = a[0]*a[0]*t + c;
+    MAT_AT(result, 1, 0) = a[1]*a[0]*t + a[2]*s;
+    MAT_AT(result, 2, 0) = a[2]*a[0]*t - a[1]*s;
+    MAT_AT(result, 0, 1) = a[0]*a[1]*t - a[2]*s;
+    MAT_AT(result, 1, 1) = a[1]*a[1]*t + c;
+    MAT_AT(result, 2, 1) = a[2]*a[1]*t + a[0]*s;
+    MAT_AT(result, 0, 2) = a[0]*a[2]*t + a[1]*s;
+    MAT_AT(result, 1, 2) = a[1]*a[2]*t - a[0]*s;
+    MAT_AT(result, 2, 2) = a[2]*a[2]*t + c;
     return result;
 }
 
 mat4 mat4_scale(vec3 scale) {
     mat4 result = Mat4();
-    result[0][0] = scale.x;
-    result[1][1] = scale.y;
-    result[2][2] = scale.z;
-    result[3][3] = 1.f;
+    MAT_AT(result, 0, 0) = scale[0];
+    MAT_AT(result, 1, 1) = scale[1];
+    MAT_AT(result, 2, 2) = scale[2];
+    MAT_AT(result, 3, 3) = 1.f;
     return result;
 }
 
@@ -586,13 +761,13 @@ mat4 frustum(float left, float right, float bottom, float top, float near, float
     float fn = far - near;
 
     mat4 result = Mat4();
-    result[0][0] = (near*2.0f)/rl;
-    result[1][1] = (near*2.0f)/tb;
-    result[0][2] = (right + left)/rl;
-    result[1][2] = (top + bottom)/tb;
-    result[2][2] = -(far + near)/fn;
-    result[3][2] = -1.0f;
-    result[2][3] = -(far*near*2.0f)/fn;
+    MAT_AT(result, 0, 0) = (near*2.0f)/rl;
+    MAT_AT(result, 1, 1) = (near*2.0f)/tb;
+    MAT_AT(result, 0, 2) = (right + left)/rl;
+    MAT_AT(result, 1, 2) = (top + bottom)/tb;
+    MAT_AT(result, 2, 2) = -(far + near)/fn;
+    MAT_AT(result, 3, 2) = -1.0f;
+    MAT_AT(result, 2, 3) = -(far*near*2.0f)/fn;
     return result;
 }
 
@@ -606,13 +781,13 @@ mat4 perspective(float fovY, float aspect, float nearPlane, float farPlane) {
     float fn = farPlane - nearPlane;
 
     mat4 result = Mat4();
-    result[0][0] = (nearPlane*2.0f)/rl;
-    result[1][1] = (nearPlane*2.0f)/tb;
-    result[0][2] = (right + left)/rl;
-    result[1][2] = (top + bottom)/tb;
-    result[2][2] = -(farPlane + nearPlane)/fn;
-    result[3][2] = -1.0f;
-    result[2][3] = -(farPlane*nearPlane*2.0f)/fn;
+    MAT_AT(result, 0, 0) = (nearPlane*2.0f)/rl;
+    MAT_AT(result, 1, 1) = (nearPlane*2.0f)/tb;
+    MAT_AT(result, 0, 2) = (right + left)/rl;
+    MAT_AT(result, 1, 2) = (top + bottom)/tb;
+    MAT_AT(result, 2, 2) = -(farPlane + nearPlane)/fn;
+    MAT_AT(result, 3, 2) = -1.0f;
+    MAT_AT(result, 2, 3) = -(farPlane*nearPlane*2.0f)/fn;
     return result;
 }
 
@@ -622,13 +797,13 @@ mat4 ortho(float left, float right, float bottom, float top, float nearPlane, fl
     float fn = farPlane - nearPlane;
 
     mat4 result = Mat4();
-    result[0][0] = 2.0f/rl;
-    result[1][1] = 2.0f/tb;
-    result[2][2] = -2.0f/fn;
-    result[0][3] = -(left + right)/rl;
-    result[1][3] = -(top + bottom)/tb;
-    result[2][3] = -(farPlane + nearPlane)/fn;
-    result[3][3] = 1.0f;
+    MAT_AT(result, 0, 0) = 2.0f/rl;
+    MAT_AT(result, 1, 1) = 2.0f/tb;
+    MAT_AT(result, 2, 2) = -2.0f/fn;
+    MAT_AT(result, 0, 3) = -(left + right)/rl;
+    MAT_AT(result, 1, 3) = -(top + bottom)/tb;
+    MAT_AT(result, 2, 3) = -(farPlane + nearPlane)/fn;
+    MAT_AT(result, 3, 3) = 1.0f;
     return result;
 }
 
@@ -638,19 +813,19 @@ mat4 look_at(vec3 eye, vec3 target, vec3 up) {
     vec3 vy = vec3_cross(vz, vx);
 
     mat4 result = Mat4();
-    result[0][0] = vx.x;
-    result[1][0] = vy.x;
-    result[2][0] = vz.x;
-    result[0][1] = vx.y;
-    result[1][1] = vy.y;
-    result[2][1] = vz.y;
-    result[0][2] = vx.z;
-    result[1][2] = vy.z;
-    result[2][2] = vz.z;
-    result[0][3] = -vec3_dot(vx, eye);
-    result[1][3] = -vec3_dot(vy, eye);
-    result[2][3] = -vec3_dot(vz, eye);
-    result[3][3] = 1.0f;
+    MAT_AT(result, 0, 0) = vx[0];
+    MAT_AT(result, 1, 0) = vy[0];
+    MAT_AT(result, 2, 0) = vz[0];
+    MAT_AT(result, 0, 1) = vx[1];
+    MAT_AT(result, 1, 1) = vy[1];
+    MAT_AT(result, 2, 1) = vz[1];
+    MAT_AT(result, 0, 2) = vx[2];
+    MAT_AT(result, 1, 2) = vy[2];
+    MAT_AT(result, 2, 2) = vz[2];
+    MAT_AT(result, 0, 3) = -vec3_dot(vx, eye);
+    MAT_AT(result, 1, 3) = -vec3_dot(vy, eye);
+    MAT_AT(result, 2, 3) = -vec3_dot(vz, eye);
+    MAT_AT(result, 3, 3) = 1.0f;
     return result;
 }
 #endif
@@ -865,6 +1040,7 @@ float easing(enum glm_easing_fn fn, enum glm_easing_t type, float t, float b, fl
                 case EASE_INOUT:
                     return ease_linear_inout(t, b, c, d);
             }
+            break;
         case GLM_EASING_SINE:
             switch (type) {
                 case EASE_IN:
@@ -873,7 +1049,8 @@ float easing(enum glm_easing_fn fn, enum glm_easing_t type, float t, float b, fl
                     return ease_sine_out(t, b, c, d);
                 case EASE_INOUT:
                     return ease_sine_inout(t, b, c, d);
-            };
+            }
+            break;
         case GLM_EASING_CIRCULAR:
             switch (type) {
                 case EASE_IN:
@@ -882,7 +1059,8 @@ float easing(enum glm_easing_fn fn, enum glm_easing_t type, float t, float b, fl
                     return ease_circ_out(t, b, c, d);
                 case EASE_INOUT:
                     return ease_circ_inout(t, b, c, d);
-            };
+            }
+            break;
         case GLM_EASING_CUBIC:
             switch (type) {
                 case EASE_IN:
@@ -891,7 +1069,8 @@ float easing(enum glm_easing_fn fn, enum glm_easing_t type, float t, float b, fl
                     return ease_cubic_out(t, b, c, d);
                 case EASE_INOUT:
                     return ease_cubic_inout(t, b, c, d);
-            };
+            }
+            break;
         case GLM_EASING_QUAD:
             switch (type) {
                 case EASE_IN:
@@ -900,7 +1079,8 @@ float easing(enum glm_easing_fn fn, enum glm_easing_t type, float t, float b, fl
                     return ease_quad_out(t, b, c, d);
                 case EASE_INOUT:
                     return ease_quad_inout(t, b, c, d);
-            };
+            }
+            break;
         case GLM_EASING_EXPONENTIAL:
             switch (type) {
                 case EASE_IN:
@@ -909,7 +1089,8 @@ float easing(enum glm_easing_fn fn, enum glm_easing_t type, float t, float b, fl
                     return ease_expo_out(t, b, c, d);
                 case EASE_INOUT:
                     return ease_expo_inout(t, b, c, d);
-            };
+            }
+            break;
         case GLM_EASING_BACK:
             switch (type) {
                 case EASE_IN:
@@ -918,7 +1099,8 @@ float easing(enum glm_easing_fn fn, enum glm_easing_t type, float t, float b, fl
                     return ease_back_out(t, b, c, d);
                 case EASE_INOUT:
                     return ease_back_inout(t, b, c, d);
-            };
+            }
+            break;
         case GLM_EASING_BOUNCE:
             switch (type) {
                 case EASE_IN:
@@ -927,7 +1109,8 @@ float easing(enum glm_easing_fn fn, enum glm_easing_t type, float t, float b, fl
                     return ease_bounce_out(t, b, c, d);
                 case EASE_INOUT:
                     return ease_bounce_inout(t, b, c, d);
-            };
+            }
+            break;
         case GLM_EASING_ELASTIC:
             switch (type) {
                 case EASE_IN:
@@ -936,8 +1119,11 @@ float easing(enum glm_easing_fn fn, enum glm_easing_t type, float t, float b, fl
                     return ease_elastic_out(t, b, c, d);
                 case EASE_INOUT:
                     return ease_elastic_inout(t, b, c, d);
-            };
+            }
+            break;
     }
+    // `type` was out of range
+    return ease_linear_None(t, b, c, d);
 }
 
 bool float_cmp(float a, float b) {
@@ -18,15 +18,30 @@
  along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
  Functionality relies on Clang + GCC extensions.
- When building `-fenable-matrix` for Matrix support.
- To disable Matrix support define `GLM_NO_MATRICES`
+ With Clang the vector types are `ext_vector_type`, elsewhere (or if
+ `GLM_VECTOR_SIZE` is defined) they are GCC `vector_size` vectors. Both
+ support arithmetic and `vec[i]`, but `.x` and swizzles are Clang only, so
+ portable code indexes. `vector_size` needs a power of two lanes, so there
+ vec3 is a vec4 whose `w` is ignored (Clang pads vec3 to 16 bytes as well)
+ and the two can't be told apart by `_Generic`.
+ When building `-fenable-matrix` matrices use Clang's `matrix_type`,
+ otherwise (or if `GLM_STRUCT_MATRICES` is defined) they fall back to
+ plain structs with SSE/NEON implementations of the hot paths.
+ Elements should be accessed through `MAT_AT(mat, row, column)` so code
+ works with either backend. To disable Matrix support define `GLM_NO_MATRICES`
 
  Acknowledgements:
  - A lot of this was hand translated from raylib's raymath.h header
  https://github.com/raysan5/raylib/blob/master/src/raymath.h (Zlib) */
 
-#if !defined(__clang__) && !(defined(__GNUC__) || defined(__GNUG__))
-#define GLM_NO_MATRICES
+#if !defined(GLM_NO_MATRICES) && !defined(GLM_STRUCT_MATRICES)
+#ifdef __has_extension
+#if !__has_extension(matrix_types)
+#define GLM_STRUCT_MATRICES
+#endif
+#else
+#define GLM_STRUCT_MATRICES
+#endif
 #endif
 
 #ifdef __has_extension
@@ -39,6 +54,10 @@
 #endif
 #endif
 
+#if !defined(GLM_VECTOR_SIZE) && !defined(__clang__)
+#define GLM_VECTOR_SIZE
+#endif
+
 #ifndef GLM_HEADER
 #define GLM_HEADER
 #if defined(__cplusplus)
@@ -97,8 +116,17 @@ typedef enum bool { false = 0, true = !false } bool;
     X(3)            \
     X(4)
 
+#ifndef GLM_VECTOR_SIZE
+#define __DEF_GLM_VECTOR(NAME, TYPE, N) \
+    typedef TYPE NAME __attribute__((ext_vector_type(N)));
+#else
+// Lanes rounded up to a power of two, so 3 gets 4
+#define __DEF_GLM_VECTOR(NAME, TYPE, N) \
+    typedef TYPE NAME __attribute__((vector_size(sizeof(TYPE) * ((N) == 3 ? 4 : (N)))));
+#endif
+
 #define X(SZ)                                                   \
-    typedef float vec##SZ __attribute__((ext_vector_type(SZ))); \
+    __DEF_GLM_VECTOR(vec##SZ, float, SZ)                        \
     vec##SZ vec##SZ##_zero(void);                               \
     bool vec##SZ##_is_zero(vec##SZ);                            \
     float vec##SZ##_sum(vec##SZ);                               \
@@ -120,7 +148,7 @@ typedef vec4 color;
 #endif
 
 #define X(N) \
-    typedef int vec##N##i __attribute__((ext_vector_type(N)));
+    __DEF_GLM_VECTOR(vec##N##i, int, N)
 __GLM_TYPES
 #undef X
 
@@ -179,8 +207,16 @@ __GLM_TYPES
 #define Vec4(x, y, z, w) (vec4){x, y, z, w}
 
 #ifndef GLM_NO_MATRICES
+#ifndef GLM_STRUCT_MATRICES
 #define __DEF_GLM_MATRIX(COLUMNS, ROWS) \
     typedef float mat##COLUMNS##ROWS __attribute__((matrix_type((COLUMNS), (ROWS))));
+#define MAT_AT(MAT, ROW, COLUMN) ((MAT)[(ROW)][(COLUMN)])
+#else
+// Stored column-major, same layout as `matrix_type` and glUniformMatrix*fv
+#define __DEF_GLM_MATRIX(COLUMNS, ROWS) \
+    typedef struct { float m[(COLUMNS)][(ROWS)]; } mat##COLUMNS##ROWS;
+#define MAT_AT(MAT, ROW, COLUMN) ((MAT).m[(COLUMN)][(ROW)])
+#endif
 
 #define X(N)                                      \
     __DEF_GLM_MATRIX(N, N)                        \
@@ -191,6 +227,7 @@ __GLM_TYPES
     bool mat##N##_is_zero(mat##N mat);            \
     float mat##N##_trace(mat##N mat);             \
     mat##N mat##N##_transpose(mat##N);            \
+    mat##N mat##N##_mul(mat##N, mat##N);          \
     vec##N mat##N##_column(mat##N, unsigned int); \
     vec##N mat##N##_row(mat##N, unsigned int);
 __GLM_TYPES
@@ -208,10 +245,16 @@ __GLM_TYPES
 #undef X
 
 #ifndef GLM_NO_GENERICS
+#ifndef GLM_VECTOR_SIZE
+#define __GLM_PRINT_VEC3 vec3: vec3_print,
+#else
+// vec3 is vec4 here, so a vec3 prints its padding lane too
+#define __GLM_PRINT_VEC3
+#endif
 #ifndef GLM_NO_MATRICES
 #define glm_print(data) _Generic((data), \
     vec2: vec2_print,                    \
-    vec3: vec3_print,                    \
+    __GLM_PRINT_VEC3                     \
     vec4: vec4_print,                    \
     mat2: mat2_print,                    \
     mat3: mat3_print,                    \
@@ -220,7 +263,7 @@ __GLM_TYPES
 #else
 #define glm_print(data) _Generic((data), \
     vec2: vec2_print,                    \
-    vec3: vec3_print,                    \
+    __GLM_PRINT_VEC3                     \
     vec4: vec4_print,                    \
     default: printf("Unsupported type\n"))(data)
 #endif // GLM_NO_MATRICES
@@ -0,0 +1,257 @@
+/* glmatrix.c --  https://github.com/takeiteasy/fungl
+
+ fungl puts the fun back into OpenGL
+
+ Copyright (C) 2024  George Watson
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+#include "glmatrix.h"
+
+#define MATRIX_DIRTY_DERIVED 1
+#define MATRIX_DIRTY_UPLOAD  2
+
+enum {
+    MATRIX_BLOCK_MODEL = 0,
+    MATRIX_BLOCK_VIEW,
+    MATRIX_BLOCK_PROJECTION,
+    MATRIX_BLOCK_TEXTURE,
+    MATRIX_BLOCK_MODELVIEW,
+    MATRIX_BLOCK_MVP,
+    MATRIX_BLOCK_NORMAL,
+    MATRIX_BLOCK_COUNT
+};
+
+static struct {
+    mat4 stacks[MATRIX_MODE_COUNT][MATRIX_STACK_DEPTH];
+    int top[MATRIX_MODE_COUNT];
+    enum matrix_mode mode;
+    mat4 modelview;
+    mat4 mvp;
+    mat4 normal;
+    int dirty;
+    GLuint ubo;
+    // std140 layout of `fungl_matrices`, 7 tightly packed mat4s
+    float block[MATRIX_BLOCK_COUNT][16];
+    int initialised;
+} state = {
+    .mode = MATRIX_MODEL,
+    .dirty = MATRIX_DIRTY_DERIVED | MATRIX_DIRTY_UPLOAD,
+    .ubo = 0,
+    .initialised = 0
+};
+
+void matrix_stack_reset(void) {
+    for (int i = 0; i < MATRIX_MODE_COUNT; i++) {
+        state.top[i] = 0;
+        state.stacks[i][0] = mat4_identity();
+    }
+    state.mode = MATRIX_MODEL;
+    state.dirty = MATRIX_DIRTY_DERIVED | MATRIX_DIRTY_UPLOAD;
+    state.initialised = 1;
+}
+
+static inline mat4* matrix_top(void) {
+    if (!state.initialised)
+        matrix_stack_reset();
+    return &state.stacks[state.mode][state.top[state.mode]];
+}
+
+static inline void matrix_changed(void) {
+    // The texture matrix doesn't feed into any derived matrix
+    state.dirty |= MATRIX_DIRTY_UPLOAD;
+    if (state.mode != MATRIX_TEXTURE)
+        state.dirty |= MATRIX_DIRTY_DERIVED;
+}
+
+static void matrix_update_derived(void) {
+    if (!state.initialised)
+        matrix_stack_reset();
+    if (!(state.dirty & MATRIX_DIRTY_DERIVED))
+        return;
+    mat4 model = state.stacks[MATRIX_MODEL][state.top[MATRIX_MODEL]];
+    mat4 view = state.stacks[MATRIX_VIEW][state.top[MATRIX_VIEW]];
+    mat4 projection = state.stacks[MATRIX_PROJECTION][state.top[MATRIX_PROJECTION]];
+    state.modelview = mat4_mul(view, model);
+    state.mvp = mat4_mul(projection, state.modelview);
+    state.normal = mat4_transpose(mat4_invert(state.modelview));
+    MAT_AT(state.normal, 0, 3) = 0.f;
+    MAT_AT(state.normal, 1, 3) = 0.f;
+    MAT_AT(state.normal, 2, 3) = 0.f;
+    MAT_AT(state.normal, 3, 0) = 0.f;
+    MAT_AT(state.normal, 3, 1) = 0.f;
+    MAT_AT(state.normal, 3, 2) = 0.f;
+    MAT_AT(state.normal, 3, 3) = 1.f;
+    state.dirty &= ~MATRIX_DIRTY_DERIVED;
+}
+
+void matrix_mode(enum matrix_mode mode) {
+    if (mode >= 0 && mode < MATRIX_MODE_COUNT)
+        state.mode = mode;
+}
+
+enum matrix_mode matrix_get_mode(void) {
+    return state.mode;
+}
+
+bool matrix_push(void) {
+    mat4 *top = matrix_top();
+    if (state.top[state.mode] + 1 >= MATRIX_STACK_DEPTH)
+        return false;
+    top[1] = top[0];
+    state.top[state.mode]++;
+    // Contents are identical so nothing derived changes
+    return true;
+}
+
+bool matrix_pop(void) {
+    matrix_top();
+    if (state.top[state.mode] == 0)
+        return false;
+    state.top[state.mode]--;
+    matrix_changed();
+    return true;
+}
+
+void matrix_load(mat4 mat) {
+    *matrix_top() = mat;
+    matrix_changed();
+}
+
+void matrix_load_identity(void) {
+    matrix_load(mat4_identity());
+}
+
+void matrix_mul(mat4 mat) {
+    mat4 *top = matrix_top();
+    *top = mat4_mul(*top, mat);
+    matrix_changed();
+}
+
+void matrix_translate(vec3 v) {
+    matrix_mul(mat4_translate(v));
+}
+
+void matrix_rotate(vec3 axis, float angle) {
+    matrix_mul(mat4_rotate(axis, angle));
+}
+
+void matrix_scale(vec3 scale) {
+    matrix_mul(mat4_scale(scale));
+}
+
+void matrix_frustum(float left, float right, float bottom, float top, float near, float far) {
+    matrix_mul(frustum(left, right, bottom, top, near, far));
+}
+
+void matrix_perspective(float fovY, float aspect, float nearPlane, float farPlane) {
+    matrix_mul(perspective(fovY, aspect, nearPlane, farPlane));
+}
+
+void matrix_ortho(float left, float right, float bottom, float top, float nearPlane, float farPlane) {
+    matrix_mul(ortho(left, right, bottom, top, nearPlane, farPlane));
+}
+
+void matrix_look_at(vec3 eye, vec3 target, vec3 up) {
+    matrix_mul(look_at(eye, target, up));
+}
+
+mat4 matrix_get(enum matrix_mode mode) {
+    if (!state.initialised)
+        matrix_stack_reset();
+    if (mode < 0 || mode >= MATRIX_MODE_COUNT)
+        return mat4_identity();
+    return state.stacks[mode][state.top[mode]];
+}
+
+mat4 matrix_modelview(void) {
+    matrix_update_derived();
+    return state.modelview;
+}
+
+mat4 matrix_mvp(void) {
+    matrix_update_derived();
+    return state.mvp;
+}
+
+mat4 matrix_normal(void) {
+    matrix_update_derived();
+    return state.normal;
+}
+
+GLuint matrix_upload(void) {
+    matrix_update_derived();
+    if (!state.ubo) {
+        glGenBuffers(1, &state.ubo);
+        state.dirty |= MATRIX_DIRTY_UPLOAD;
+    }
+    glBindBufferBase(GL_UNIFORM_BUFFER, MATRIX_STACK_BINDING, state.ubo);
+    if (!(state.dirty & MATRIX_DIRTY_UPLOAD))
+        return state.ubo;
+
+    for (int i = 0; i < MATRIX_MODE_COUNT; i++)
+        memcpy(state.block[i], &state.stacks[i][state.top[i]], sizeof(float) * 16);
+    memcpy(state.block[MATRIX_BLOCK_MODELVIEW], &state.modelview, sizeof(float) * 16);
+    memcpy(state.block[MATRIX_BLOCK_MVP], &state.mvp, sizeof(float) * 16);
+    memcpy(state.block[MATRIX_BLOCK_NORMAL], &state.normal, sizeof(float) * 16);
+    // Respecifying the whole store orphans the previous one, so the driver
+    // never has to wait on draws still reading the old matrices
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(state.block), state.block, GL_STREAM_DRAW);
+    state.dirty &= ~MATRIX_DIRTY_UPLOAD;
+    return state.ubo;
+}
+
+void matrix_bind_program(GLuint program) {
+    GLuint index = glGetUniformBlockIndex(program, "fungl_matrices");
+    if (index != GL_INVALID_INDEX)
+        glUniformBlockBinding(program, index, MATRIX_STACK_BINDING);
+}
+
+void matrix_stack_release(void) {
+    if (state.ubo) {
+        glDeleteBuffers(1, &state.ubo);
+        state.ubo = 0;
+    }
+    state.dirty |= MATRIX_DIRTY_UPLOAD;
+}
+
+static mat4 matrix_from_floats(const GLfloat *m) {
+    mat4 result;
+    for (int c = 0; c < 4; c++)
+        for (int r = 0; r < 4; r++)
+            MAT_AT(result, r, c) = m[c * 4 + r];
+    return result;
+}
+
+void matrix_compat_mode(GLenum mode) {
+    switch (mode) {
+        case GL_MODELVIEW:
+            matrix_mode(MATRIX_MODEL);
+            break;
+        case GL_PROJECTION:
+            matrix_mode(MATRIX_PROJECTION);
+            break;
+        case GL_TEXTURE:
+            matrix_mode(MATRIX_TEXTURE);
+            break;
+    }
+}
+
+void matrix_compat_load(const GLfloat *m) {
+    matrix_load(matrix_from_floats(m));
+}
+
+void matrix_compat_mul(const GLfloat *m) {
+    matrix_mul(matrix_from_floats(m));
+}
@@ -0,0 +1,134 @@
+/* glmatrix.h --  https://github.com/takeiteasy/fungl
+
+ fungl puts the fun back into OpenGL
+
+ Copyright (C) 2024  George Watson
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+ CPU-side replacement for the fixed-function matrix stacks, usable on
+ core profile contexts. Derived matrices (modelview, mvp, normal) are only
+ recomputed when a stack changes, and the whole set is uploaded to a single
+ uniform buffer at most once per change. Shaders access it via:
+
+    MATRIX_STACK_GLSL  // declares the `fungl_matrices` uniform block
+
+ Define `FUNGL_MATRIX_COMPAT` before including to route glMatrixMode,
+ glPushMatrix, glLoadIdentity, etc. through the emulated stacks. */
+
+#if !defined(glmatrix_h) && !defined(FUNGL_NO_MATRIX_STACK)
+#define glmatrix_h
+#if defined(__cplusplus)
+extern "C" {
+#endif
+#include "gl.h"
+#include "glm.h"
+#if FUNGL_VERSION < GL_VERSION_3_1
+#error "glmatrix.h requires FUNGL_VERSION >= GL_VERSION_3_1"
+#endif
+#ifdef GLM_NO_MATRICES
+#error "glmatrix.h requires glm matrices, GLM_NO_MATRICES is defined"
+#endif
+
+#ifndef MATRIX_STACK_DEPTH
+#define MATRIX_STACK_DEPTH 32
+#endif
+#ifndef MATRIX_STACK_BINDING
+#define MATRIX_STACK_BINDING 0
+#endif
+
+enum matrix_mode {
+    MATRIX_MODEL = 0,
+    MATRIX_VIEW,
+    MATRIX_PROJECTION,
+    MATRIX_TEXTURE,
+    MATRIX_MODE_COUNT
+};
+
+#define MATRIX_STACK_GLSL                          \
+    "layout(std140) uniform fungl_matrices {\n"    \
+    "    mat4 fungl_model;\n"                      \
+    "    mat4 fungl_view;\n"                       \
+    "    mat4 fungl_projection;\n"                 \
+    "    mat4 fungl_texture;\n"                    \
+    "    mat4 fungl_modelview;\n"                  \
+    "    mat4 fungl_mvp;\n"                        \
+    "    mat4 fungl_normal;\n"                     \
+    "};\n"
+
+void matrix_mode(enum matrix_mode mode);
+enum matrix_mode matrix_get_mode(void);
+// Returns false on stack overflow/underflow, the stack is left untouched
+bool matrix_push(void);
+bool matrix_pop(void);
+void matrix_load(mat4 mat);
+void matrix_load_identity(void);
+// Post-multiplies the current matrix, the same as glMultMatrix
+void matrix_mul(mat4 mat);
+void matrix_translate(vec3 v);
+void matrix_rotate(vec3 axis, float angle);
+void matrix_scale(vec3 scale);
+void matrix_frustum(float left, float right, float bottom, float top, float near, float far);
+void matrix_perspective(float fovY, float aspect, float nearPlane, float farPlane);
+void matrix_ortho(float left, float right, float bottom, float top, float nearPlane, float farPlane);
+void matrix_look_at(vec3 eye, vec3 target, vec3 up);
+
+mat4 matrix_get(enum matrix_mode mode);
+mat4 matrix_modelview(void);
+mat4 matrix_mvp(void);
+// Inverse transpose of the modelview (upper 3x3 is meaningful)
+mat4 matrix_normal(void);
+
+// Uploads the uniform block if anything changed since the last upload and
+// binds it to `MATRIX_STACK_BINDING`. Call before drawing.
+GLuint matrix_upload(void);
+// Connects a program's `fungl_matrices` block to `MATRIX_STACK_BINDING`
+void matrix_bind_program(GLuint program);
+void matrix_stack_reset(void);
+void matrix_stack_release(void);
+
+// Fixed-function style entry points (GL enums, column-major float arrays)
+void matrix_compat_mode(GLenum mode);
+void matrix_compat_load(const GLfloat *m);
+void matrix_compat_mul(const GLfloat *m);
+
+#ifdef FUNGL_MATRIX_COMPAT
+#undef glMatrixMode
+#undef glPushMatrix
+#undef glPopMatrix
+#undef glLoadIdentity
+#undef glLoadMatrixf
+#undef glMultMatrixf
+#undef glTranslatef
+#undef glRotatef
+#undef glScalef
+#undef glFrustum
+#undef glOrtho
+#define glMatrixMode(MODE) matrix_compat_mode(MODE)
+#define glPushMatrix() ((void)matrix_push())
+#define glPopMatrix() ((void)matrix_pop())
+#define glLoadIdentity() matrix_load_identity()
+#define glLoadMatrixf(M) matrix_compat_load(M)
+#define glMultMatrixf(M) matrix_compat_mul(M)
+#define glTranslatef(X, Y, Z) matrix_translate(Vec3((X), (Y), (Z)))
+#define glRotatef(ANGLE, X, Y, Z) matrix_rotate(Vec3((X), (Y), (Z)), TO_RADIANS(ANGLE))
+#define glScalef(X, Y, Z) matrix_scale(Vec3((X), (Y), (Z)))
+#define glFrustum(L, R, B, T, N, F) matrix_frustum((L), (R), (B), (T), (N), (F))
+#define glOrtho(L, R, B, T, N, F) matrix_ortho((L), (R), (B), (T), (N), (F))
+#endif
+
+#if defined(__cplusplus)
+}
+#endif
+#endif /* glmatrix_h */
@@ -0,0 +1,395 @@
+/* glprofile.c --  https://github.com/takeiteasy/fungl
+
+ fungl puts the fun back into OpenGL
+
+ Copyright (C) 2024  George Watson
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+#include "glprofile.h"
+#include "glut.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#if FUNGL_VERSION >= GL_VERSION_3_3
+#define PROFILE_GPU
+#endif
+#if FUNGL_VERSION >= GL_VERSION_4_3
+#define PROFILE_DEBUG_GROUPS
+#endif
+
+#define PROFILE_GROW(ARRAY, COUNT, CAPACITY, NEEDED)                              \
+    do {                                                                          \
+        if ((COUNT) + (NEEDED) > (CAPACITY)) {                                    \
+            size_t capacity = (CAPACITY) ? (CAPACITY) : 4096;                     \
+            while (capacity < (COUNT) + (NEEDED))                                 \
+                capacity *= 2;                                                    \
+            void *grown = realloc((ARRAY), capacity * sizeof(*(ARRAY)));          \
+            if (!grown)                                                           \
+                abort();                                                          \
+            (ARRAY) = grown;                                                      \
+            (CAPACITY) = capacity;                                                \
+        }                                                                         \
+    } while (0)
+
+// Milliseconds between two GPU timestamps, and a timestamp on the CPU clock
+#define PROFILE_GPU_MS(BEGIN, END) ((double)((END) - (BEGIN)) / 1e6)
+#define PROFILE_GPU_CPU(TIME) ((uint64_t)((int64_t)(TIME) + state.gpu_offset))
+
+struct profile_record {
+    const char *name;
+    int depth;
+    uint64_t cpu_begin, cpu_end;
+};
+
+// Zone i is bracketed by queries 2i and 2i + 1, the frame itself by the
+// last two
+#define PROFILE_FRAME_QUERY (2 * PROFILE_MAX_ZONES)
+
+struct profile_frame {
+    struct profile_record zones[PROFILE_MAX_ZONES];
+    int count;
+    uint64_t cpu_begin, cpu_end;
+    // Ended and not read back yet
+    bool pending;
+#ifdef PROFILE_GPU
+    GLuint queries[PROFILE_FRAME_QUERY + 2];
+#endif
+};
+
+// Captured zone, GPU zones are converted to the CPU clock
+struct profile_event {
+    const char *name;
+    uint64_t begin, duration;
+    bool gpu;
+};
+
+static struct {
+    bool initialized, registered;
+    struct profile_frame frames[PROFILE_FRAMES];
+    // Counts every frame begun, the current one is frames[frame % PROFILE_FRAMES]
+    uint64_t frame;
+    // Zones currently open as indices into the current frame, -1 for zones
+    // that were dropped
+    int stack[PROFILE_MAX_DEPTH];
+    int depth;
+    // Zones opened past PROFILE_MAX_DEPTH, only counted
+    int overflow;
+    struct profile_zone resolved[PROFILE_MAX_ZONES];
+    int resolved_count;
+    double resolved_cpu, resolved_gpu;
+    bool has_resolved;
+    // CPU time minus GPU time, measured when capturing starts
+    int64_t gpu_offset;
+    bool capturing;
+    uint64_t capture_start;
+    struct profile_event *events;
+    size_t event_count, event_capacity;
+} state;
+
+uint64_t profile_now(void) {
+#ifdef _WIN32
+    static LARGE_INTEGER freq = {0};
+    LARGE_INTEGER now;
+    if (!freq.QuadPart)
+        QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&now);
+    return (uint64_t)((double)now.QuadPart * 1e9 / (double)freq.QuadPart);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+static void profile_calibrate(void) {
+#ifdef PROFILE_GPU
+    GLint64 gpu = 0;
+    glGetInteger64v(GL_TIMESTAMP, &gpu);
+    state.gpu_offset = (int64_t)profile_now() - (int64_t)gpu;
+#endif
+}
+
+static void profile_frame_func(void *userdata) {
+    (void)userdata;
+    profile_frame();
+}
+
+static struct profile_frame* profile_current(void) {
+    return &state.frames[state.frame % PROFILE_FRAMES];
+}
+
+static void profile_start_frame(void) {
+    struct profile_frame *frame = profile_current();
+    frame->count = 0;
+    frame->pending = false;
+    frame->cpu_begin = profile_now();
+#ifdef PROFILE_GPU
+    glQueryCounter(frame->queries[PROFILE_FRAME_QUERY], GL_TIMESTAMP);
+#endif
+}
+
+bool profile_init(void) {
+    if (state.initialized)
+        return true;
+    memset(&state, 0, sizeof(state));
+#ifdef PROFILE_GPU
+    for (int i = 0; i < PROFILE_FRAMES; i++)
+        glGenQueries(PROFILE_FRAME_QUERY + 2, state.frames[i].queries);
+#endif
+    profile_calibrate();
+    state.registered = glutAddFrameFunc(profile_frame_func, NULL);
+    state.initialized = true;
+    profile_start_frame();
+    return true;
+}
+
+void profile_shutdown(void) {
+    if (!state.initialized)
+        return;
+    if (state.registered)
+        glutRemoveFrameFunc(profile_frame_func, NULL);
+#ifdef PROFILE_GPU
+    for (int i = 0; i < PROFILE_FRAMES; i++)
+        glDeleteQueries(PROFILE_FRAME_QUERY + 2, state.frames[i].queries);
+#endif
+    free(state.events);
+    memset(&state, 0, sizeof(state));
+}
+
+void profile_begin(const char *name) {
+    if (!profile_init())
+        return;
+#ifdef PROFILE_DEBUG_GROUPS
+    glPushDebugGroup(GL_DEBUG_SOURCE_APPLICATION, 0, -1, name);
+#endif
+    if (state.depth >= PROFILE_MAX_DEPTH) {
+        state.overflow++;
+        return;
+    }
+    struct profile_frame *frame = profile_current();
+    if (frame->count >= PROFILE_MAX_ZONES) {
+        state.stack[state.depth++] = -1;
+        return;
+    }
+    int index = frame->count++;
+    struct profile_record *zone = &frame->zones[index];
+    zone->name = name;
+    zone->depth = state.depth;
+    state.stack[state.depth++] = index;
+#ifdef PROFILE_GPU
+    glQueryCounter(frame->queries[2 * index], GL_TIMESTAMP);
+#endif
+    zone->cpu_end = zone->cpu_begin = profile_now();
+}
+
+static void profile_close(int index) {
+    if (index < 0)
+        return;
+    struct profile_frame *frame = profile_current();
+    frame->zones[index].cpu_end = profile_now();
+#ifdef PROFILE_GPU
+    glQueryCounter(frame->queries[2 * index + 1], GL_TIMESTAMP);
+#endif
+}
+
+void profile_end(void) {
+    if (!state.initialized || (!state.depth && !state.overflow))
+        return;
+    if (state.overflow)
+        state.overflow--;
+    else
+        profile_close(state.stack[--state.depth]);
+#ifdef PROFILE_DEBUG_GROUPS
+    glPopDebugGroup();
+#endif
+}
+
+static void profile_event(const char *name, uint64_t begin, uint64_t end, bool gpu) {
+    PROFILE_GROW(state.events, state.event_count, state.event_capacity, 1);
+    state.events[state.event_count++] = (struct profile_event) {
+        .name = name,
+        .begin = begin,
+        .duration = end > begin ? end - begin : 0,
+        .gpu = gpu
+    };
+}
+
+// Reads the GPU results of an ended frame, or drops them when `wait` is
+// false and the GPU isn't done with the frame yet
+static void profile_resolve(struct profile_frame *frame, bool wait) {
+#ifdef PROFILE_GPU
+    bool gpu = false;
+    static GLuint64 times[PROFILE_FRAME_QUERY + 2];
+    // Timestamps are written in order, the frame's last one being available
+    // means all of them are
+    GLuint available = GL_TRUE;
+    if (!wait)
+        glGetQueryObjectuiv(frame->queries[PROFILE_FRAME_QUERY + 1], GL_QUERY_RESULT_AVAILABLE, &available);
+    if (available) {
+        for (int i = 0; i < frame->count; i++) {
+            glGetQueryObjectui64v(frame->queries[2 * i], GL_QUERY_RESULT, &times[2 * i]);
+            glGetQueryObjectui64v(frame->queries[2 * i + 1], GL_QUERY_RESULT, &times[2 * i + 1]);
+        }
+        glGetQueryObjectui64v(frame->queries[PROFILE_FRAME_QUERY], GL_QUERY_RESULT, &times[PROFILE_FRAME_QUERY]);
+        glGetQueryObjectui64v(frame->queries[PROFILE_FRAME_QUERY + 1], GL_QUERY_RESULT, &times[PROFILE_FRAME_QUERY + 1]);
+        gpu = true;
+    }
+#else
+    (void)wait;
+#endif
+    frame->pending = false;
+
+    state.resolved_count = frame->count;
+    state.resolved_cpu = (double)(frame->cpu_end - frame->cpu_begin) / 1e6;
+    state.resolved_gpu = -1.;
+    state.has_resolved = true;
+    for (int i = 0; i < frame->count; i++) {
+        struct profile_record *record = &frame->zones[i];
+        struct profile_zone *zone = &state.resolved[i];
+        zone->name = record->name;
+        zone->depth = record->depth;
+        zone->cpu_start = (double)(record->cpu_begin - frame->cpu_begin) / 1e6;
+        zone->cpu_time = (double)(record->cpu_end - record->cpu_begin) / 1e6;
+        zone->gpu_start = zone->gpu_time = -1.;
+#ifdef PROFILE_GPU
+        if (gpu) {
+            zone->gpu_start = PROFILE_GPU_MS(times[PROFILE_FRAME_QUERY], times[2 * i]);
+            zone->gpu_time = PROFILE_GPU_MS(times[2 * i], times[2 * i + 1]);
+        }
+#endif
+    }
+#ifdef PROFILE_GPU
+    if (gpu)
+        state.resolved_gpu = PROFILE_GPU_MS(times[PROFILE_FRAME_QUERY], times[PROFILE_FRAME_QUERY + 1]);
+#endif
+
+    // Frames begun before the capture are left out
+    if (!state.capturing || frame->cpu_begin < state.capture_start)
+        return;
+    profile_event("frame", frame->cpu_begin, frame->cpu_end, false);
+    for (int i = 0; i < frame->count; i++)
+        profile_event(frame->zones[i].name, frame->zones[i].cpu_begin, frame->zones[i].cpu_end, false);
+#ifdef PROFILE_GPU
+    if (!gpu)
+        return;
+    profile_event("frame", PROFILE_GPU_CPU(times[PROFILE_FRAME_QUERY]), PROFILE_GPU_CPU(times[PROFILE_FRAME_QUERY + 1]), true);
+    for (int i = 0; i < frame->count; i++)
+        profile_event(frame->zones[i].name, PROFILE_GPU_CPU(times[2 * i]), PROFILE_GPU_CPU(times[2 * i + 1]), true);
+#endif
+}
+
+void profile_frame(void) {
+    if (!state.initialized) {
+        profile_init();
+        return;
+    }
+    while (state.overflow) {
+        state.overflow--;
+#ifdef PROFILE_DEBUG_GROUPS
+        glPopDebugGroup();
+#endif
+    }
+    while (state.depth) {
+        profile_close(state.stack[--state.depth]);
+#ifdef PROFILE_DEBUG_GROUPS
+        glPopDebugGroup();
+#endif
+    }
+    struct profile_frame *frame = profile_current();
+    frame->cpu_end = profile_now();
+#ifdef PROFILE_GPU
+    glQueryCounter(frame->queries[PROFILE_FRAME_QUERY + 1], GL_TIMESTAMP);
+#endif
+    frame->pending = true;
+
+    state.frame++;
+    frame = profile_current();
+    if (frame->pending)
+        profile_resolve(frame, false);
+    profile_start_frame();
+}
+
+int profile_zones(const struct profile_zone **zones) {
+    if (zones)
+        *zones = state.resolved;
+    return state.resolved_count;
+}
+
+bool profile_frame_time(double *cpu, double *gpu) {
+    if (cpu)
+        *cpu = state.has_resolved ? state.resolved_cpu : 0.;
+    if (gpu)
+        *gpu = state.has_resolved ? state.resolved_gpu : -1.;
+    return state.has_resolved;
+}
+
+void profile_capture(bool enabled) {
+    if (!profile_init())
+        return;
+    if (enabled) {
+        state.event_count = 0;
+        state.capture_start = profile_now();
+        profile_calibrate();
+    }
+    state.capturing = enabled;
+}
+
+static void profile_write_string(FILE *fh, const char *string) {
+    fputc('"', fh);
+    for (const unsigned char *c = (const unsigned char*)string; c && *c; c++) {
+        if (*c == '"' || *c == '\\')
+            fprintf(fh, "\\%c", *c);
+        else if (*c < 0x20)
+            fprintf(fh, "\\u%04x", *c);
+        else
+            fputc(*c, fh);
+    }
+    fputc('"', fh);
+}
+
+bool profile_write_trace(const char *path) {
+    if (!state.initialized)
+        return false;
+    // Oldest first, so the events stay in frame order
+    for (int i = 1; i <= PROFILE_FRAMES; i++) {
+        struct profile_frame *frame = &state.frames[(state.frame + i) % PROFILE_FRAMES];
+        if (frame->pending)
+            profile_resolve(frame, true);
+    }
+    FILE *fh = fopen(path, "w");
+    if (!fh)
+        return false;
+    // Timestamps are microseconds since the capture started
+    fprintf(fh, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n");
+    fprintf(fh, "  {\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": 1, \"args\": {\"name\": \"CPU\"}},\n");
+    fprintf(fh, "  {\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": 2, \"args\": {\"name\": \"GPU\"}}");
+    for (size_t i = 0; i < state.event_count; i++) {
+        struct profile_event *event = &state.events[i];
+        int64_t begin = (int64_t)event->begin - (int64_t)state.capture_start;
+        fprintf(fh, ",\n  {\"name\": ");
+        profile_write_string(fh, event->name);
+        fprintf(fh, ", \"cat\": \"%s\", \"ph\": \"X\", \"pid\": 1, \"tid\": %d, \"ts\": %.3f, \"dur\": %.3f}",
+                event->gpu ? "gpu" : "cpu", event->gpu ? 2 : 1, (double)begin / 1e3, (double)event->duration / 1e3);
+    }
+    fprintf(fh, "\n]}\n");
+    bool result = !ferror(fh);
+    return fclose(fh) == 0 && result;
+}
@@ -0,0 +1,113 @@
+/* glprofile.h --  https://github.com/takeiteasy/fungl
+
+ fungl puts the fun back into OpenGL
+
+ Copyright (C) 2024  George Watson
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+ Frame profiling. Zones are timed on the CPU and, through a pair of
+ glQueryCounter(GL_TIMESTAMP) queries, on the GPU. Every frame has its own
+ set of query objects and a frame's results are only read back once the
+ profiler comes round to its slot again PROFILE_FRAMES frames later, so
+ profiling never waits on the GPU. Frames still unfinished by then just
+ lose their GPU times.
+
+    PROFILE_SCOPE("shadows") {
+        draw_shadow_maps();
+    }
+    profile_begin("scene");
+    draw_scene();
+    profile_end();
+
+ Frames are delimited by glutMainLoop, programs with their own loop call
+ profile_frame at the start of each frame. The zones of the latest frame
+ read back are available from profile_zones, for an on screen overlay.
+ While capturing, every frame read back is also kept so profile_write_trace
+ can write it out as Chrome trace event JSON (chrome://tracing, Perfetto),
+ with the CPU and the GPU timelines as two threads on one clock:
+
+    profile_capture(true);
+    ...
+    profile_write_trace("frames.json");
+
+ With FUNGL_VERSION >= GL_VERSION_4_3 zones are also pushed as debug groups
+ so they show up in RenderDoc and friends. Below GL_VERSION_3_3 there are
+ no timer queries and only CPU times are recorded, which is why the
+ targets in project.yml build with FUNGL_VERSION=3030. Zones must be opened and
+ closed on the thread owning the GL context, within one frame, and names
+ have to stay valid until the frame is read back (string literals). Leaving
+ a PROFILE_SCOPE with break or return skips its profile_end. */
+
+#if !defined(glprofile_h) && !defined(FUNGL_NO_PROFILE)
+#define glprofile_h
+#if defined(__cplusplus)
+extern "C" {
+#endif
+#include "gl.h"
+#if FUNGL_VERSION < GL_VERSION_3_2
+#error "glprofile.h requires FUNGL_VERSION >= GL_VERSION_3_2"
+#endif
+#include <stdint.h>
+#include <stdbool.h>
+
+// Frames in flight, results are read back this many frames late
+#ifndef PROFILE_FRAMES
+#define PROFILE_FRAMES 4
+#endif
+// Zones recorded per frame, any beyond are dropped
+#ifndef PROFILE_MAX_ZONES
+#define PROFILE_MAX_ZONES 512
+#endif
+#define PROFILE_MAX_DEPTH 32
+
+struct profile_zone {
+    const char *name;
+    // 0 for the outermost zones
+    int depth;
+    // Milliseconds, starts are relative to the start of the frame. GPU
+    // times are -1 when they aren't known.
+    double cpu_start, cpu_time;
+    double gpu_start, gpu_time;
+};
+
+// Called implicitly by the first profile_begin or profile_frame, registers
+// profile_frame as a glut frame func
+bool profile_init(void);
+void profile_shutdown(void);
+void profile_begin(const char *name);
+void profile_end(void);
+#define PROFILE_SCOPE(NAME) \
+    for (int profile_scope_ = (profile_begin(NAME), 1); profile_scope_; profile_scope_ = 0, profile_end())
+// Ends the current frame and starts the next. Zones still open are closed.
+void profile_frame(void);
+// Zones of the most recent frame read back, in the order they were opened.
+// Returns the number of zones, 0 until the first frame is read back.
+int profile_zones(const struct profile_zone **zones);
+// Length of the most recent frame read back in milliseconds, `gpu` is -1
+// when it isn't known. Returns false until the first frame is read back.
+bool profile_frame_time(double *cpu, double *gpu);
+// Starts (dropping anything captured before) or stops keeping frames for
+// profile_write_trace
+void profile_capture(bool enabled);
+// Writes everything captured as Chrome trace event JSON. Frames still in
+// flight are read back first, which waits for the GPU to finish them.
+bool profile_write_trace(const char *path);
+// Monotonic CPU clock in nanoseconds, the clock zones are timed with
+uint64_t profile_now(void);
+
+#if defined(__cplusplus)
+}
+#endif
+#endif /* glprofile_h */
@@ -0,0 +1,291 @@
+/* glrender.c --  https://github.com/takeiteasy/fungl
+
+ fungl puts the fun back into OpenGL
+
+ Copyright (C) 2024  George Watson
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+#include "glrender.h"
+#if FUNGL_VERSION >= GL_VERSION_4_3
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+// Sort key layout, most significant first
+#define RENDER_PROGRAM_BITS 12
+#define RENDER_TEXTURE_BITS 12
+#define RENDER_ARRAY_BITS 6
+#define RENDER_MESH_BITS 10
+#define RENDER_DEPTH_BITS 24
+
+struct render_item {
+    uint64_t key;
+    float model[16];
+    struct buffer_draw draw;
+    buffer_handle vertices, indices;
+    GLuint program, texture;
+    int vertex_array;
+};
+
+struct render_sort {
+    uint64_t key;
+    uint32_t index;
+};
+
+// Matches the layout glMultiDrawElementsIndirect reads
+struct render_command {
+    GLuint count;
+    GLuint instance_count;
+    GLuint first_index;
+    GLint base_vertex;
+    GLuint base_instance;
+};
+
+struct render_queue {
+    const struct buffer_heap *vertex_heap, *index_heap;
+    struct render_item *items;
+    struct render_sort *sort, *scratch;
+    size_t count, capacity;
+    struct {
+        GLuint buffer, vertex_array;
+    } arrays[RENDER_MAX_VERTEX_ARRAYS];
+    int array_count;
+    // Instance matrices and indirect commands for a frame
+    struct buffer_ring *ring;
+};
+
+static size_t render_storage_alignment(void) {
+    static GLint alignment = 0;
+    if (!alignment)
+        glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &alignment);
+    return alignment > 0 ? (size_t)alignment : 256;
+}
+
+struct render_queue* render_queue_create(const struct buffer_heap *vertex_heap, const struct buffer_heap *index_heap, size_t capacity) {
+    if (!vertex_heap || !index_heap || !capacity || capacity > UINT32_MAX)
+        return NULL;
+    struct render_queue *queue = calloc(1, sizeof(struct render_queue));
+    if (!queue)
+        return NULL;
+    queue->vertex_heap = vertex_heap;
+    queue->index_heap = index_heap;
+    queue->capacity = capacity;
+    queue->items = malloc(capacity * sizeof(struct render_item));
+    queue->sort = malloc(capacity * sizeof(struct render_sort));
+    queue->scratch = malloc(capacity * sizeof(struct render_sort));
+    // Worst case every draw is its own command, plus padding for alignment
+    size_t frame = capacity * (16 * sizeof(float) + sizeof(struct render_command)) + 2 * render_storage_alignment();
+    queue->ring = buffer_ring_create(frame, 0);
+    if (!queue->items || !queue->sort || !queue->scratch || !queue->ring) {
+        render_queue_destroy(queue);
+        return NULL;
+    }
+    return queue;
+}
+
+void render_queue_destroy(struct render_queue *queue) {
+    if (!queue)
+        return;
+    buffer_ring_destroy(queue->ring);
+    free(queue->items);
+    free(queue->sort);
+    free(queue->scratch);
+    free(queue);
+}
+
+bool render_queue_vertex_array(struct render_queue *queue, GLuint vertex_buffer, GLuint vertex_array) {
+    if (!queue || !vertex_buffer || !vertex_array)
+        return false;
+    int slot = 0;
+    while (slot < queue->array_count && queue->arrays[slot].buffer != vertex_buffer)
+        slot++;
+    if (slot == queue->array_count) {
+        if (queue->array_count == RENDER_MAX_VERTEX_ARRAYS)
+            return false;
+        queue->array_count++;
+    }
+    queue->arrays[slot].buffer = vertex_buffer;
+    queue->arrays[slot].vertex_array = vertex_array;
+    // The format is set once, flushes only rebind the buffer range
+    glBindVertexArray(vertex_array);
+    for (int i = 0; i < 4; i++) {
+        glEnableVertexAttribArray(RENDER_INSTANCE_ATTRIB + i);
+        glVertexAttribFormat(RENDER_INSTANCE_ATTRIB + i, 4, GL_FLOAT, GL_FALSE, i * 4 * sizeof(float));
+        glVertexAttribBinding(RENDER_INSTANCE_ATTRIB + i, RENDER_INSTANCE_BINDING);
+    }
+    glVertexBindingDivisor(RENDER_INSTANCE_BINDING, 1);
+    glBindVertexArray(0);
+    return true;
+}
+
+// Positive floats order the same as their bits, keep the top ones
+static inline uint64_t render_depth_bits(float depth) {
+    if (!(depth > 0.f))
+        return 0;
+    uint32_t bits;
+    memcpy(&bits, &depth, sizeof(bits));
+    return bits >> (31 - RENDER_DEPTH_BITS);
+}
+
+#define RENDER_FIELD(VALUE, BITS) ((uint64_t)(VALUE) & ((1ull << (BITS)) - 1))
+
+bool render_queue_submit(struct render_queue *queue, const struct buffer_mesh *mesh, GLuint program, GLuint texture, mat4 model, float depth) {
+    if (!queue || queue->count == queue->capacity)
+        return false;
+    struct render_item *item = &queue->items[queue->count];
+    if (!buffer_mesh_draw_args(queue->vertex_heap, queue->index_heap, mesh, &item->draw))
+        return false;
+    int array = 0;
+    while (array < queue->array_count && queue->arrays[array].buffer != item->draw.vertex_buffer)
+        array++;
+    if (array == queue->array_count)
+        array = -1;
+    memcpy(item->model, &model, sizeof(item->model));
+    item->vertices = mesh->vertices;
+    item->indices = mesh->indices;
+    item->program = program;
+    item->texture = texture;
+    item->vertex_array = array;
+    // Only an ordering, batches compare the real values. Names that share
+    // their low bits interleave, which costs batches but not correctness.
+    item->key = RENDER_FIELD(program, RENDER_PROGRAM_BITS) << (64 - RENDER_PROGRAM_BITS) |
+                RENDER_FIELD(texture, RENDER_TEXTURE_BITS) << (64 - RENDER_PROGRAM_BITS - RENDER_TEXTURE_BITS) |
+                RENDER_FIELD(array, RENDER_ARRAY_BITS) << (RENDER_MESH_BITS + RENDER_DEPTH_BITS) |
+                RENDER_FIELD(mesh->vertices, RENDER_MESH_BITS) << RENDER_DEPTH_BITS |
+                render_depth_bits(depth);
+    queue->count++;
+    return true;
+}
+
+// LSD radix sort, 8 bits per pass. Passes where every key has the same byte
+// are skipped, which with few programs and textures is most of the upper ones.
+static struct render_sort* render_radix_sort(struct render_sort *keys, struct render_sort *scratch, size_t count) {
+    size_t histogram[8][256];
+    memset(histogram, 0, sizeof(histogram));
+    for (size_t i = 0; i < count; i++)
+        for (int b = 0; b < 8; b++)
+            histogram[b][(keys[i].key >> (b * 8)) & 0xFF]++;
+    for (int b = 0; b < 8; b++) {
+        size_t *h = histogram[b];
+        if (h[(keys[0].key >> (b * 8)) & 0xFF] == count)
+            continue;
+        size_t sum = 0;
+        for (int i = 0; i < 256; i++) {
+            size_t n = h[i];
+            h[i] = sum;
+            sum += n;
+        }
+        for (size_t i = 0; i < count; i++)
+            scratch[h[(keys[i].key >> (b * 8)) & 0xFF]++] = keys[i];
+        struct render_sort *swap = keys;
+        keys = scratch;
+        scratch = swap;
+    }
+    return keys;
+}
+
+static size_t render_index_size(GLenum type) {
+    return type == GL_UNSIGNED_INT ? 4 : type == GL_UNSIGNED_SHORT ? 2 : 1;
+}
+
+static bool render_same_batch(const struct render_item *a, const struct render_item *b) {
+    return a->program == b->program && a->texture == b->texture &&
+           a->vertex_array == b->vertex_array && a->draw.index_buffer == b->draw.index_buffer &&
+           a->draw.type == b->draw.type;
+}
+
+int render_queue_flush(struct render_queue *queue, GLenum mode) {
+    if (!queue || !queue->count)
+        return 0;
+    size_t count = 0;
+    for (size_t i = 0; i < queue->count; i++)
+        if (queue->items[i].vertex_array >= 0) {
+            queue->sort[count].key = queue->items[i].key;
+            queue->sort[count++].index = (uint32_t)i;
+        }
+    queue->count = 0;
+    if (!count)
+        return 0;
+    const struct render_sort *sorted = render_radix_sort(queue->sort, queue->scratch, count);
+
+    struct buffer_alloc instances, commands;
+    if (!buffer_ring_alloc(queue->ring, count * 16 * sizeof(float), render_storage_alignment(), &instances) ||
+        !buffer_ring_alloc(queue->ring, count * sizeof(struct render_command), sizeof(GLuint), &commands))
+        return 0;
+    float *models = instances.ptr;
+    struct render_command *command = commands.ptr;
+    size_t command_count = 0;
+    const struct render_item *last = NULL;
+    for (size_t i = 0; i < count; i++) {
+        const struct render_item *item = &queue->items[sorted[i].index];
+        memcpy(models + i * 16, item->model, sizeof(item->model));
+        // Consecutive draws of the same mesh in the same batch are instances
+        // of one command, their matrices are already next to each other
+        if (last && render_same_batch(last, item) &&
+            last->vertices == item->vertices && last->indices == item->indices) {
+            command[command_count - 1].instance_count++;
+        } else
+            command[command_count++] = (struct render_command) {
+                .count = (GLuint)item->draw.count,
+                .instance_count = 1,
+                .first_index = (GLuint)((uintptr_t)item->draw.indices / render_index_size(item->draw.type)),
+                .base_vertex = item->draw.base_vertex,
+                .base_instance = (GLuint)i
+            };
+        last = item;
+    }
+    buffer_ring_flush(queue->ring);
+
+    glBindBufferRange(GL_SHADER_STORAGE_BUFFER, RENDER_INSTANCE_STORAGE_BINDING, instances.buffer,
+                      instances.offset, (GLsizeiptr)(count * 16 * sizeof(float)));
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, commands.buffer);
+    glActiveTexture(GL_TEXTURE0);
+    bool bound[RENDER_MAX_VERTEX_ARRAYS] = {false};
+    GLuint program = 0, texture = 0;
+    int calls = 0;
+    size_t first = 0;
+    // Walk the commands again, splitting them wherever the batch changes
+    for (size_t c = 0, i = 0; c < command_count; c++) {
+        const struct render_item *item = &queue->items[sorted[i].index];
+        size_t next = i + command[c].instance_count;
+        bool end = c + 1 == command_count || !render_same_batch(item, &queue->items[sorted[next].index]);
+        i = next;
+        if (!end)
+            continue;
+        if (item->program != program)
+            glUseProgram(program = item->program);
+        if (item->texture != texture)
+            glBindTexture(GL_TEXTURE_2D, texture = item->texture);
+        glBindVertexArray(queue->arrays[item->vertex_array].vertex_array);
+        if (!bound[item->vertex_array]) {
+            glBindVertexBuffer(RENDER_INSTANCE_BINDING, instances.buffer, instances.offset, 16 * sizeof(float));
+            bound[item->vertex_array] = true;
+        }
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, item->draw.index_buffer);
+        glMultiDrawElementsIndirect(mode, item->draw.type,
+                                    (const void*)(commands.offset + first * sizeof(struct render_command)),
+                                    (GLsizei)(c + 1 - first), 0);
+        calls++;
+        first = c + 1;
+    }
+    glBindVertexArray(0);
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+    return calls;
+}
+
+size_t render_queue_count(const struct render_queue *queue) {
+    return queue ? queue->count : 0;
+}
+#endif
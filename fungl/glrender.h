@@ -0,0 +1,101 @@
+/* glrender.h --  https://github.com/takeiteasy/fungl
+
+ fungl puts the fun back into OpenGL
+
+ Copyright (C) 2024  George Watson
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+ Batched rendering of meshes from buffer heaps (see glbuffer.h). Draws are
+ queued during the frame, then sorted by a 64 bit key (program, texture,
+ vertex array, mesh, then depth front to back) with a radix sort and
+ turned into one glMultiDrawElementsIndirect per run of equal program,
+ texture and buffers. Repeats of a mesh become instances of a single
+ command, so a scene of tens of thousands of draws ends up as a few dozen
+ calls.
+
+    struct render_queue *queue = render_queue_create(vertices, indices, 65536);
+    render_queue_vertex_array(queue, arena_buffer, arena_vao);
+    ...
+    render_queue_submit(queue, &rock, program, rock_albedo, model, depth);
+    render_queue_flush(queue, GL_TRIANGLES);
+
+ Model matrices are packed into a streaming buffer that is both bound as
+ four vec4 instance attributes from RENDER_INSTANCE_ATTRIB on and as the
+ shader storage block at RENDER_INSTANCE_STORAGE_BINDING, so shaders can use
+ either:
+
+    layout(location = 12) in mat4 model;
+
+ Needs FUNGL_VERSION >= GL_VERSION_4_3, the header declares nothing below
+ that. */
+
+#if !defined(glrender_h) && !defined(FUNGL_NO_RENDER)
+#define glrender_h
+#if defined(__cplusplus)
+extern "C" {
+#endif
+#include "gl.h"
+#if FUNGL_VERSION >= GL_VERSION_4_3
+#include "glm.h"
+#include "glbuffer.h"
+#ifndef glbuffer_h
+#error "glrender.h requires glbuffer.h, don't define FUNGL_NO_BUFFER"
+#endif
+#ifdef GLM_NO_MATRICES
+#error "glrender.h requires glm matrices, GLM_NO_MATRICES is defined"
+#endif
+#include <stddef.h>
+#include <stdbool.h>
+
+// First of the four attribute locations holding the model matrix
+#ifndef RENDER_INSTANCE_ATTRIB
+#define RENDER_INSTANCE_ATTRIB 12
+#endif
+// Vertex buffer binding of the instance data. An attribute set with
+// glVertexAttribPointer implicitly uses the binding of its own index, so this
+// is the index of the last instance attribute, which no mesh attribute has.
+#ifndef RENDER_INSTANCE_BINDING
+#define RENDER_INSTANCE_BINDING (RENDER_INSTANCE_ATTRIB + 3)
+#endif
+// Shader storage binding of the instance data, GL only guarantees 8
+#ifndef RENDER_INSTANCE_STORAGE_BINDING
+#define RENDER_INSTANCE_STORAGE_BINDING 7
+#endif
+#define RENDER_MAX_VERTEX_ARRAYS 64
+
+struct render_queue;
+
+// `capacity` draws can be queued between flushes, meshes are resolved
+// through the two heaps
+struct render_queue* render_queue_create(const struct buffer_heap *vertex_heap, const struct buffer_heap *index_heap, size_t capacity);
+void render_queue_destroy(struct render_queue *queue);
+// The vertex array (with the vertex format of the meshes) used for meshes in
+// `vertex_buffer`, the instance attributes are set up on it. Meshes in
+// buffers without one are dropped at flush.
+bool render_queue_vertex_array(struct render_queue *queue, GLuint vertex_buffer, GLuint vertex_array);
+// `depth` is the view space distance, only used for ordering. Returns false
+// when the queue is full or the mesh doesn't resolve.
+bool render_queue_submit(struct render_queue *queue, const struct buffer_mesh *mesh, GLuint program, GLuint texture, mat4 model, float depth);
+// Sorts and draws everything queued, leaving the queue empty. Returns the
+// number of glMultiDrawElementsIndirect calls made. Instance data lives in a
+// ring with room for `capacity` draws per frame, across all flushes.
+int render_queue_flush(struct render_queue *queue, GLenum mode);
+size_t render_queue_count(const struct render_queue *queue);
+
+#endif
+#if defined(__cplusplus)
+}
+#endif
+#endif /* glrender_h */
@@ -0,0 +1,824 @@
+/* glshader.c --  https://github.com/takeiteasy/fungl
+
+ fungl puts the fun back into OpenGL
+
+ Copyright (C) 2024  George Watson
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+#include "glshader.h"
+#include "glut.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#if FUNGL_VERSION >= GL_VERSION_4_1
+#define SHADER_BINARY
+#endif
+
+// KHR_parallel_shader_compile (and the ARB version, same value)
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
+#define SHADER_CACHE_MAGIC 0x43425046u // "FPBC"
+#define SHADER_CACHE_VERSION 1
+
+struct shader_cache_header {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t key;
+    uint32_t format;
+    uint32_t size;
+};
+
+enum {
+    SHADER_PENDING,
+    SHADER_READY,
+    SHADER_FAILED
+};
+
+struct shader_async {
+    GLuint program, placeholder;
+    GLuint shaders[SHADER_MAX_STAGES];
+    int count;
+    int status;
+    // Binary cache entry to write once linked
+    uint64_t key;
+    bool cached;
+};
+
+static struct {
+    char directory[1024];
+    // Hash of the driver strings, 0 until the first program is built
+    uint64_t driver;
+    bool binaries;
+    // GL_COMPLETION_STATUS_KHR can be queried
+    bool parallel;
+    char log[4096];
+    // Submitted in this order, finished in this order unless the driver
+    // reports completion itself
+    struct shader_async **pending;
+    int pending_count, pending_capacity;
+    bool registered;
+} state;
+
+void shader_cache_directory(const char *path) {
+    if (!path)
+        state.directory[0] = '\0';
+    else
+        snprintf(state.directory, sizeof(state.directory), "%s", path);
+}
+
+const char* shader_log(void) {
+    return state.log;
+}
+
+static uint64_t shader_hash(const void *data, size_t size, uint64_t h) {
+    const unsigned char *bytes = data;
+    for (size_t i = 0; i < size; i++)
+        h = (h ^ bytes[i]) * 0x100000001B3ull;
+    return h;
+}
+
+static uint64_t shader_hash_string(const char *str, uint64_t h) {
+    // The terminator too, so "ab" + "c" and "a" + "bc" differ
+    return str ? shader_hash(str, strlen(str) + 1, h) : shader_hash("", 1, h);
+}
+
+static void shader_driver(void) {
+    if (state.driver)
+        return;
+    uint64_t h = 0xCBF29CE484222325ull;
+    const GLenum names[] = {GL_VENDOR, GL_RENDERER, GL_VERSION, GL_SHADING_LANGUAGE_VERSION};
+    for (int i = 0; i < 4; i++)
+        h = shader_hash_string((const char*)glGetString(names[i]), h);
+    state.driver = h ? h : 1;
+    GLint extensions = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &extensions);
+    for (GLint i = 0; i < extensions && !state.parallel; i++) {
+        const char *name = (const char*)glGetStringi(GL_EXTENSIONS, i);
+        state.parallel = name && (!strcmp(name, "GL_KHR_parallel_shader_compile") ||
+                                  !strcmp(name, "GL_ARB_parallel_shader_compile"));
+    }
+#ifdef SHADER_BINARY
+    GLint formats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+    state.binaries = formats > 0;
+#endif
+}
+
+#ifdef SHADER_BINARY
+static uint64_t shader_key(const struct shader_stage *stages, int count, const char *defines) {
+    uint64_t h = shader_hash(&state.driver, sizeof(state.driver), 0xCBF29CE484222325ull ^ SHADER_CACHE_VERSION);
+    for (int i = 0; i < count; i++) {
+        uint32_t type = stages[i].type;
+        h = shader_hash(&type, sizeof(type), h);
+        h = shader_hash_string(stages[i].source, h);
+    }
+    return shader_hash_string(defines, h);
+}
+#endif
+
+// Only queues the compile, the status is checked once the program has linked
+static GLuint shader_compile(GLenum type, const char *source, const char *defines) {
+    const char *strings[4] = {source};
+    GLint lengths[4] = {-1, -1, -1, -1};
+    GLsizei count = 1;
+    char line[32];
+    if (defines && *defines) {
+        // #version has to stay the first directive, defines go right after it
+        // and #line keeps the compiler's line numbers matching the file
+        const char *body = source;
+        const char *version = strstr(source, "#version");
+        if (version) {
+            const char *eol = strchr(version, '\n');
+            body = eol ? eol + 1 : version + strlen(version);
+        }
+        int lines = 1;
+        for (const char *c = source; c < body; c++)
+            lines += *c == '\n';
+        snprintf(line, sizeof(line), "\n#line %d\n", lines);
+        lengths[0] = (GLint)(body - source);
+        strings[1] = defines;
+        strings[2] = line;
+        strings[3] = body;
+        count = 4;
+    }
+    GLuint shader = glCreateShader(type);
+    glShaderSource(shader, count, strings, lengths);
+    glCompileShader(shader);
+    return shader;
+}
+
+static bool shader_linked(GLuint program) {
+    GLint status = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &status);
+    return status;
+}
+
+#ifdef SHADER_BINARY
+static const void* shader_map_file(const char *path, size_t *size) {
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, 0, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+        return NULL;
+    LARGE_INTEGER length;
+    void *result = NULL;
+    if (GetFileSizeEx(file, &length) && length.QuadPart > 0) {
+        HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (mapping) {
+            if ((result = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0)))
+                *size = (size_t)length.QuadPart;
+            CloseHandle(mapping);
+        }
+    }
+    CloseHandle(file);
+    return result;
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return NULL;
+    struct stat info;
+    void *result = NULL;
+    if (!fstat(fd, &info) && info.st_size > 0) {
+        result = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (result == MAP_FAILED)
+            result = NULL;
+        else
+            *size = (size_t)info.st_size;
+    }
+    close(fd);
+    return result;
+#endif
+}
+
+static void shader_unmap_file(const void *data, size_t size) {
+#ifdef _WIN32
+    UnmapViewOfFile(data);
+#else
+    munmap((void*)data, size);
+#endif
+}
+
+static void shader_cache_path(char *path, size_t length, uint64_t key, const char *suffix) {
+    snprintf(path, length, "%s/%016llx%s", state.directory, (unsigned long long)key, suffix);
+}
+
+static GLuint shader_cache_load(uint64_t key) {
+    char path[sizeof(state.directory) + 32];
+    shader_cache_path(path, sizeof(path), key, ".fpb");
+    size_t size;
+    const unsigned char *file = shader_map_file(path, &size);
+    if (!file)
+        return 0;
+    struct shader_cache_header header;
+    GLuint program = 0;
+    if (size < sizeof(header))
+        goto BAIL;
+    memcpy(&header, file, sizeof(header));
+    if (header.magic != SHADER_CACHE_MAGIC || header.version != SHADER_CACHE_VERSION ||
+        header.key != key || !header.size || header.size != size - sizeof(header))
+        goto BAIL;
+    program = glCreateProgram();
+    glProgramBinary(program, header.format, file + sizeof(header), (GLsizei)header.size);
+    // Drivers may still reject a binary, e.g. after an update that didn't
+    // change the version string
+    if (!shader_linked(program)) {
+        glDeleteProgram(program);
+        program = 0;
+    }
+BAIL:
+    shader_unmap_file(file, size);
+    return program;
+}
+
+static void shader_cache_store(uint64_t key, GLuint program) {
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0)
+        return;
+    void *blob = malloc(length);
+    if (!blob)
+        return;
+    GLenum format = 0;
+    GLsizei written = 0;
+    glGetProgramBinary(program, length, &written, &format, blob);
+    if (written > 0) {
+        struct shader_cache_header header = {
+            .magic = SHADER_CACHE_MAGIC,
+            .version = SHADER_CACHE_VERSION,
+            .key = key,
+            .format = format,
+            .size = (uint32_t)written
+        };
+        // Written under a temporary name and renamed, so a concurrent run
+        // never maps a partial file
+        char path[sizeof(state.directory) + 32], temp[sizeof(state.directory) + 64];
+        shader_cache_path(path, sizeof(path), key, ".fpb");
+        snprintf(temp, sizeof(temp), "%s.%lx.tmp", path, (unsigned long)(uintptr_t)&header);
+        FILE *fh = fopen(temp, "wb");
+        if (fh) {
+            bool ok = fwrite(&header, sizeof(header), 1, fh) == 1 &&
+                      fwrite(blob, 1, (size_t)written, fh) == (size_t)written;
+            if (fclose(fh) || !ok || rename(temp, path))
+                remove(temp);
+        }
+    }
+    free(blob);
+}
+#endif
+
+// Looks the program up in the binary cache or issues every compile and the
+// link without waiting on any of them
+static bool shader_submit(struct shader_async *async, const struct shader_stage *stages, int count, const char *defines) {
+    if (!stages || count <= 0 || count > SHADER_MAX_STAGES)
+        return false;
+    for (int i = 0; i < count; i++)
+        if (!stages[i].source)
+            return false;
+    shader_driver();
+#ifdef SHADER_BINARY
+    if (state.directory[0] && state.binaries) {
+        async->cached = true;
+        async->key = shader_key(stages, count, defines);
+        if ((async->program = shader_cache_load(async->key))) {
+            async->status = SHADER_READY;
+            return true;
+        }
+    }
+#endif
+    async->count = count;
+    for (int i = 0; i < count; i++)
+        async->shaders[i] = shader_compile(stages[i].type, stages[i].source, defines);
+    async->program = glCreateProgram();
+#ifdef SHADER_BINARY
+    if (async->cached)
+        glProgramParameteri(async->program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+#endif
+    for (int i = 0; i < count; i++)
+        glAttachShader(async->program, async->shaders[i]);
+    glLinkProgram(async->program);
+    async->status = SHADER_PENDING;
+    return true;
+}
+
+// Blocks until the link is done (immediately if the driver reported it
+// complete) and releases the shaders
+static void shader_finish(struct shader_async *async) {
+    bool linked = shader_linked(async->program);
+    if (!linked) {
+        // A failed compile names the actual problem, the link log only
+        // says a stage is missing
+        state.log[0] = '\0';
+        for (int i = 0; i < async->count && !state.log[0]; i++) {
+            GLint compiled = GL_FALSE;
+            glGetShaderiv(async->shaders[i], GL_COMPILE_STATUS, &compiled);
+            if (!compiled)
+                glGetShaderInfoLog(async->shaders[i], sizeof(state.log), NULL, state.log);
+        }
+        if (!state.log[0])
+            glGetProgramInfoLog(async->program, sizeof(state.log), NULL, state.log);
+    }
+    // Shaders are only flagged for deletion while attached, detaching them
+    // lets the driver release their sources and objects right away
+    for (int i = 0; i < async->count; i++) {
+        glDetachShader(async->program, async->shaders[i]);
+        glDeleteShader(async->shaders[i]);
+    }
+    async->count = 0;
+    if (!linked) {
+        glDeleteProgram(async->program);
+        async->program = 0;
+        async->status = SHADER_FAILED;
+        return;
+    }
+#ifdef SHADER_BINARY
+    if (async->cached)
+        shader_cache_store(async->key, async->program);
+#endif
+    async->status = SHADER_READY;
+}
+
+GLuint shader_program_stages(const struct shader_stage *stages, int count, const char *defines) {
+    state.log[0] = '\0';
+    struct shader_async async = {0};
+    if (!shader_submit(&async, stages, count, defines))
+        return 0;
+    if (async.status == SHADER_PENDING)
+        shader_finish(&async);
+    return async.program;
+}
+
+static void shader_frame(void *userdata) {
+    (void)userdata;
+    shader_async_poll();
+}
+
+struct shader_async* shader_program_async(const struct shader_stage *stages, int count, const char *defines, GLuint placeholder) {
+    struct shader_async *async = calloc(1, sizeof(struct shader_async));
+    if (!async)
+        return NULL;
+    async->placeholder = placeholder;
+    if (!shader_submit(async, stages, count, defines)) {
+        free(async);
+        return NULL;
+    }
+    if (async->status != SHADER_PENDING)
+        return async;
+    if (state.pending_count == state.pending_capacity) {
+        int capacity = state.pending_capacity ? state.pending_capacity * 2 : 64;
+        void *grown = realloc(state.pending, capacity * sizeof(*state.pending));
+        if (!grown)
+            abort();
+        state.pending = grown;
+        state.pending_capacity = capacity;
+    }
+    state.pending[state.pending_count++] = async;
+    if (!state.registered)
+        state.registered = glutAddFrameFunc(shader_frame, NULL);
+    return async;
+}
+
+static void shader_async_unqueue(struct shader_async *async) {
+    for (int i = 0; i < state.pending_count; i++)
+        if (state.pending[i] == async) {
+            memmove(&state.pending[i], &state.pending[i + 1], (state.pending_count - i - 1) * sizeof(*state.pending));
+            state.pending_count--;
+            return;
+        }
+}
+
+int shader_async_poll(void) {
+    int finished = 0, kept = 0;
+    for (int i = 0; i < state.pending_count; i++) {
+        struct shader_async *async = state.pending[i];
+        bool done;
+        if (state.parallel) {
+            GLint complete = GL_FALSE;
+            glGetProgramiv(async->program, GL_COMPLETION_STATUS_KHR, &complete);
+            done = complete;
+        } else
+            // Every status query blocks, so spread them over frames
+            done = finished < SHADER_ASYNC_LINKS_PER_POLL;
+        if (done) {
+            shader_finish(async);
+            finished++;
+        } else
+            state.pending[kept++] = async;
+    }
+    state.pending_count = kept;
+    return kept;
+}
+
+int shader_async_pending(void) {
+    return state.pending_count;
+}
+
+GLuint shader_async_program(const struct shader_async *async) {
+    if (!async)
+        return 0;
+    return async->status == SHADER_READY ? async->program : async->placeholder;
+}
+
+int shader_async_status(const struct shader_async *async) {
+    if (!async)
+        return -1;
+    return async->status == SHADER_READY ? 1 : async->status == SHADER_FAILED ? -1 : 0;
+}
+
+GLuint shader_async_wait(struct shader_async *async) {
+    if (!async)
+        return 0;
+    if (async->status == SHADER_PENDING) {
+        shader_async_unqueue(async);
+        shader_finish(async);
+    }
+    return async->program;
+}
+
+void shader_async_destroy(struct shader_async *async) {
+    if (!async)
+        return;
+    if (async->status == SHADER_PENDING) {
+        shader_async_unqueue(async);
+        for (int i = 0; i < async->count; i++) {
+            glDetachShader(async->program, async->shaders[i]);
+            glDeleteShader(async->shaders[i]);
+        }
+    }
+    if (async->program)
+        glDeleteProgram(async->program);
+    free(async);
+}
+
+GLuint shader_program(const char *vertex, const char *fragment, const char *defines) {
+    struct shader_stage stages[2] = {
+        {GL_VERTEX_SHADER, vertex},
+        {GL_FRAGMENT_SHADER, fragment}
+    };
+    return shader_program_stages(stages, 2, defines);
+}
+
+static char* shader_read_file(const char *path) {
+    FILE *fh = fopen(path, "rb");
+    if (!fh) {
+        snprintf(state.log, sizeof(state.log), "can't open \"%s\"", path);
+        return NULL;
+    }
+    char *result = NULL;
+    long size;
+    if (!fseek(fh, 0, SEEK_END) && (size = ftell(fh)) >= 0 && !fseek(fh, 0, SEEK_SET) &&
+        (result = malloc((size_t)size + 1))) {
+        if (fread(result, 1, (size_t)size, fh) == (size_t)size)
+            result[size] = '\0';
+        else {
+            free(result);
+            result = NULL;
+        }
+    }
+    fclose(fh);
+    return result;
+}
+
+GLuint shader_program_files(const char *vertex_path, const char *fragment_path, const char *defines) {
+    char *vertex = shader_read_file(vertex_path);
+    char *fragment = vertex ? shader_read_file(fragment_path) : NULL;
+    GLuint program = 0;
+    if (vertex && fragment)
+        program = shader_program(vertex, fragment, defines);
+    free(vertex);
+    free(fragment);
+    return program;
+}
+
+uint32_t shader_hash_name(const char *name) {
+    uint32_t h = SHADER_HASH_BASIS;
+    for (int i = 0; name[i] && i < SHADER_HASH_MAX; i++)
+        h = (h ^ (unsigned char)name[i]) * SHADER_HASH_PRIME;
+    return h;
+}
+
+// Large enough for a mat4, ints are stored in the same space
+#define SHADER_VALUE_FLOATS 16
+
+struct shader_uniforms {
+    GLuint program;
+    struct shader_uniform *uniforms;
+    // Last value sent for each uniform, valid where `set` is true
+    float (*values)[SHADER_VALUE_FLOATS];
+    bool *set;
+    int count;
+    struct shader_block *blocks;
+    int block_count;
+    // Indices into `uniforms` plus one, 0 marks an empty slot
+    int *table;
+    uint32_t mask;
+};
+
+static int shader_table_find(const struct shader_uniforms *uniforms, uint32_t hash) {
+    if (!uniforms || !uniforms->table)
+        return -1;
+    for (uint32_t i = hash & uniforms->mask;; i = (i + 1) & uniforms->mask) {
+        int slot = uniforms->table[i];
+        if (!slot)
+            return -1;
+        if (uniforms->uniforms[slot - 1].hash == hash)
+            return slot - 1;
+    }
+}
+
+static uint32_t shader_reflect_name(char *name, GLsizei length) {
+    // Arrays are reported as "name[0]"
+    if (length > 3 && !strcmp(name + length - 3, "[0]"))
+        name[length - 3] = '\0';
+    return shader_hash_name(name);
+}
+
+struct shader_uniforms* shader_reflect(GLuint program) {
+    if (!program)
+        return NULL;
+    struct shader_uniforms *result = calloc(1, sizeof(struct shader_uniforms));
+    if (!result)
+        return NULL;
+    result->program = program;
+    GLint count = 0, blocks = 0, longest = 0, longest_block = 0;
+    glGetProgramiv(program, GL_ACTIVE_UNIFORMS, &count);
+    glGetProgramiv(program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &longest);
+    glGetProgramiv(program, GL_ACTIVE_UNIFORM_BLOCKS, &blocks);
+    glGetProgramiv(program, GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH, &longest_block);
+    if (longest_block > longest)
+        longest = longest_block;
+    char *name = malloc(longest > 0 ? longest + 1 : 1);
+    if (!name)
+        goto BAIL;
+
+    if (count > 0) {
+        uint32_t capacity = 8;
+        while (capacity < (uint32_t)count * 2)
+            capacity *= 2;
+        result->uniforms = calloc(count, sizeof(struct shader_uniform));
+        result->values = calloc(count, sizeof(*result->values));
+        result->set = calloc(count, sizeof(bool));
+        result->table = calloc(capacity, sizeof(int));
+        result->mask = capacity - 1;
+        if (!result->uniforms || !result->values || !result->set || !result->table)
+            goto BAIL;
+        GLuint *indices = malloc(count * sizeof(GLuint));
+        GLint *properties = malloc(count * sizeof(GLint));
+        if (!indices || !properties) {
+            free(indices);
+            free(properties);
+            goto BAIL;
+        }
+        for (GLint i = 0; i < count; i++)
+            indices[i] = (GLuint)i;
+        // One query per property for all uniforms at once
+        const GLenum pnames[] = {GL_UNIFORM_BLOCK_INDEX, GL_UNIFORM_OFFSET, GL_UNIFORM_ARRAY_STRIDE, GL_UNIFORM_MATRIX_STRIDE};
+        for (int p = 0; p < 4; p++) {
+            glGetActiveUniformsiv(program, count, indices, pnames[p], properties);
+            for (GLint i = 0; i < count; i++) {
+                struct shader_uniform *uniform = &result->uniforms[i];
+                switch (p) {
+                    case 0:
+                        uniform->block = properties[i];
+                        break;
+                    case 1:
+                        uniform->offset = properties[i];
+                        break;
+                    case 2:
+                        uniform->array_stride = properties[i];
+                        break;
+                    case 3:
+                        uniform->matrix_stride = properties[i];
+                        break;
+                }
+            }
+        }
+        free(indices);
+        free(properties);
+        for (GLint i = 0; i < count; i++) {
+            struct shader_uniform *uniform = &result->uniforms[i];
+            GLsizei length = 0;
+            glGetActiveUniform(program, (GLuint)i, longest + 1, &length, &uniform->size, &uniform->type, name);
+            name[length] = '\0';
+            uniform->location = uniform->block < 0 ? glGetUniformLocation(program, name) : -1;
+            uniform->hash = shader_reflect_name(name, length);
+            // A clash of two names keeps the first, the other can still be
+            // reached through glGetUniformLocation
+            uint32_t slot = uniform->hash & result->mask;
+            while (result->table[slot] && result->uniforms[result->table[slot] - 1].hash != uniform->hash)
+                slot = (slot + 1) & result->mask;
+            if (!result->table[slot])
+                result->table[slot] = i + 1;
+        }
+        result->count = count;
+    }
+
+    if (blocks > 0) {
+        if (!(result->blocks = calloc(blocks, sizeof(struct shader_block))))
+            goto BAIL;
+        for (GLint i = 0; i < blocks; i++) {
+            struct shader_block *block = &result->blocks[i];
+            GLsizei length = 0;
+            glGetActiveUniformBlockName(program, (GLuint)i, longest + 1, &length, name);
+            name[length] = '\0';
+            block->hash = shader_reflect_name(name, length);
+            block->index = (GLuint)i;
+            glGetActiveUniformBlockiv(program, (GLuint)i, GL_UNIFORM_BLOCK_DATA_SIZE, &block->size);
+        }
+        result->block_count = blocks;
+    }
+    free(name);
+    return result;
+BAIL:
+    free(name);
+    shader_uniforms_destroy(result);
+    return NULL;
+}
+
+void shader_uniforms_destroy(struct shader_uniforms *uniforms) {
+    if (!uniforms)
+        return;
+    free(uniforms->uniforms);
+    free(uniforms->values);
+    free(uniforms->set);
+    free(uniforms->blocks);
+    free(uniforms->table);
+    free(uniforms);
+}
+
+GLuint shader_uniforms_program(const struct shader_uniforms *uniforms) {
+    return uniforms ? uniforms->program : 0;
+}
+
+const struct shader_uniform* shader_uniform(const struct shader_uniforms *uniforms, uint32_t hash) {
+    int index = shader_table_find(uniforms, hash);
+    return index < 0 ? NULL : &uniforms->uniforms[index];
+}
+
+const struct shader_block* shader_block(const struct shader_uniforms *uniforms, uint32_t hash) {
+    if (uniforms)
+        for (int i = 0; i < uniforms->block_count; i++)
+            if (uniforms->blocks[i].hash == hash)
+                return &uniforms->blocks[i];
+    return NULL;
+}
+
+GLint shader_uniform_location(const struct shader_uniforms *uniforms, uint32_t hash) {
+    int index = shader_table_find(uniforms, hash);
+    return index < 0 ? -1 : uniforms->uniforms[index].location;
+}
+
+void shader_uniforms_reset(struct shader_uniforms *uniforms) {
+    if (uniforms && uniforms->set)
+        memset(uniforms->set, 0, uniforms->count * sizeof(bool));
+}
+
+// The location to upload `value` to, or -1 if there's no such uniform or it
+// already holds that value
+static GLint shader_uniform_update(struct shader_uniforms *uniforms, uint32_t hash, const void *value, size_t size, bool *found) {
+    int index = shader_table_find(uniforms, hash);
+    *found = index >= 0 && uniforms->uniforms[index].location >= 0;
+    if (!*found)
+        return -1;
+    if (uniforms->set[index] && !memcmp(uniforms->values[index], value, size))
+        return -1;
+    memcpy(uniforms->values[index], value, size);
+    uniforms->set[index] = true;
+    return uniforms->uniforms[index].location;
+}
+
+bool shader_set_int(struct shader_uniforms *uniforms, uint32_t hash, int value) {
+    bool found;
+    GLint location = shader_uniform_update(uniforms, hash, &value, sizeof(value), &found);
+    if (location >= 0)
+        glUniform1i(location, value);
+    return found;
+}
+
+bool shader_set_float(struct shader_uniforms *uniforms, uint32_t hash, float value) {
+    bool found;
+    GLint location = shader_uniform_update(uniforms, hash, &value, sizeof(value), &found);
+    if (location >= 0)
+        glUniform1f(location, value);
+    return found;
+}
+
+bool shader_set_vec2(struct shader_uniforms *uniforms, uint32_t hash, vec2 value) {
+    float data[2] = {value[0], value[1]};
+    bool found;
+    GLint location = shader_uniform_update(uniforms, hash, data, sizeof(data), &found);
+    if (location >= 0)
+        glUniform2fv(location, 1, data);
+    return found;
+}
+
+bool shader_set_vec3(struct shader_uniforms *uniforms, uint32_t hash, vec3 value) {
+    float data[3] = {value[0], value[1], value[2]};
+    bool found;
+    GLint location = shader_uniform_update(uniforms, hash, data, sizeof(data), &found);
+    if (location >= 0)
+        glUniform3fv(location, 1, data);
+    return found;
+}
+
+bool shader_set_vec4(struct shader_uniforms *uniforms, uint32_t hash, vec4 value) {
+#ifdef GLM_VECTOR_SIZE
+    // vec3 is vec4 here, so shader_set sends a vec3 uniform's value this way
+    int index = shader_table_find(uniforms, hash);
+    if (index >= 0 && uniforms->uniforms[index].type == GL_FLOAT_VEC3)
+        return shader_set_vec3(uniforms, hash, value);
+#endif
+    float data[4] = {value[0], value[1], value[2], value[3]};
+    bool found;
+    GLint location = shader_uniform_update(uniforms, hash, data, sizeof(data), &found);
+    if (location >= 0)
+        glUniform4fv(location, 1, data);
+    return found;
+}
+
+bool shader_set_vec2i(struct shader_uniforms *uniforms, uint32_t hash, vec2i value) {
+    int data[2] = {value[0], value[1]};
+    bool found;
+    GLint location = shader_uniform_update(uniforms, hash, data, sizeof(data), &found);
+    if (location >= 0)
+        glUniform2iv(location, 1, data);
+    return found;
+}
+
+bool shader_set_vec3i(struct shader_uniforms *uniforms, uint32_t hash, vec3i value) {
+    int data[3] = {value[0], value[1], value[2]};
+    bool found;
+    GLint location = shader_uniform_update(uniforms, hash, data, sizeof(data), &found);
+    if (location >= 0)
+        glUniform3iv(location, 1, data);
+    return found;
+}
+
+bool shader_set_vec4i(struct shader_uniforms *uniforms, uint32_t hash, vec4i value) {
+#ifdef GLM_VECTOR_SIZE
+    int index = shader_table_find(uniforms, hash);
+    if (index >= 0 && uniforms->uniforms[index].type == GL_INT_VEC3)
+        return shader_set_vec3i(uniforms, hash, value);
+#endif
+    int data[4] = {value[0], value[1], value[2], value[3]};
+    bool found;
+    GLint location = shader_uniform_update(uniforms, hash, data, sizeof(data), &found);
+    if (location >= 0)
+        glUniform4iv(location, 1, data);
+    return found;
+}
+
+#ifndef GLM_NO_MATRICES
+// Both matrix backends are column-major floats, as glUniformMatrix*fv wants
+bool shader_set_mat2(struct shader_uniforms *uniforms, uint32_t hash, mat2 value) {
+    float data[4];
+    memcpy(data, &value, sizeof(data));
+    bool found;
+    GLint location = shader_uniform_update(uniforms, hash, data, sizeof(data), &found);
+    if (location >= 0)
+        glUniformMatrix2fv(location, 1, GL_FALSE, data);
+    return found;
+}
+
+bool shader_set_mat3(struct shader_uniforms *uniforms, uint32_t hash, mat3 value) {
+    float data[9];
+    memcpy(data, &value, sizeof(data));
+    bool found;
+    GLint location = shader_uniform_update(uniforms, hash, data, sizeof(data), &found);
+    if (location >= 0)
+        glUniformMatrix3fv(location, 1, GL_FALSE, data);
+    return found;
+}
+
+bool shader_set_mat4(struct shader_uniforms *uniforms, uint32_t hash, mat4 value) {
+    float data[16];
+    memcpy(data, &value, sizeof(data));
+    bool found;
+    GLint location = shader_uniform_update(uniforms, hash, data, sizeof(data), &found);
+    if (location >= 0)
+        glUniformMatrix4fv(location, 1, GL_FALSE, data);
+    return found;
+}
+#endif
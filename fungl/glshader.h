@@ -0,0 +1,221 @@
+/* glshader.h --  https://github.com/takeiteasy/fungl
+
+ fungl puts the fun back into OpenGL
+
+ Copyright (C) 2024  George Watson
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+ Shader programs. Sources are compiled and linked through the usual
+ glCompileShader/glLinkProgram path, optionally with a block of #defines
+ spliced in after the #version line, so one source can produce many
+ variants.
+
+    GLuint lit = shader_program(vs, fs, "#define SHADOWS 1\n#define LIGHTS 4");
+
+ With a cache directory set (and FUNGL_VERSION >= GL_VERSION_4_1) the linked
+ program is stored with glGetProgramBinary under a hash of the sources, the
+ defines and the driver (vendor, renderer and version strings). Later runs
+ map that file and hand it to glProgramBinary without compiling anything.
+ Driver updates change the hash, and a binary the driver refuses anyway is
+ compiled from source again and replaced.
+
+    shader_cache_directory("cache");
+
+ Async programs issue every compile and the link up front and return
+ straight away, drawing with a placeholder until the driver is done. With
+ KHR_parallel_shader_compile (or the ARB version) the driver compiles on
+ its own threads and completion is polled without blocking; without it at
+ most SHADER_ASYNC_LINKS_PER_POLL programs are finished (blocking) per poll,
+ so the cost is spread over several frames. shader_async_poll is called by
+ glutMainLoop, programs with their own loop call it once per frame.
+
+    struct shader_async *water = shader_program_async(stages, 2, NULL, flat);
+    ...
+    glUseProgram(shader_async_program(water));
+
+ Reflection enumerates a program's active uniforms and uniform blocks once
+ into an open addressing table keyed by a hash of their names, so setting a
+ uniform never goes through glGetUniformLocation. SHADER_HASH folds string
+ literals at compile time; names are hashed up to SHADER_HASH_MAX characters
+ and arrays are found by their base name ("lights", not "lights[0]"). The
+ setters remember the last value sent and skip uploads that wouldn't change
+ anything, so they assume every change goes through them and the program is
+ in use (glUseProgram) when they're called.
+
+    struct shader_uniforms *u = shader_reflect(program);
+    glUseProgram(program);
+    shader_set_mat4(u, SHADER_HASH("mvp"), mvp);
+    shader_set(u, SHADER_HASH("tint"), Vec4(1.f, .5f, .5f, 1.f)); */
+
+#if !defined(glshader_h) && !defined(FUNGL_NO_SHADER)
+#define glshader_h
+#if defined(__cplusplus)
+extern "C" {
+#endif
+#include "gl.h"
+#include "glm.h"
+#if FUNGL_VERSION < GL_VERSION_3_2
+#error "glshader.h requires FUNGL_VERSION >= GL_VERSION_3_2"
+#endif
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SHADER_MAX_STAGES 6
+// Programs finished per shader_async_poll when the driver can't report
+// completion, each one blocks until its link is done
+#ifndef SHADER_ASYNC_LINKS_PER_POLL
+#define SHADER_ASYNC_LINKS_PER_POLL 4
+#endif
+
+struct shader_stage {
+    // GL_VERTEX_SHADER, GL_FRAGMENT_SHADER, ...
+    GLenum type;
+    const char *source;
+};
+
+// Where program binaries are cached, NULL (the default) turns the cache off.
+// The directory has to exist. Does nothing before GL 4.1.
+void shader_cache_directory(const char *path);
+// `defines` (may be NULL) is inserted after the #version line of every
+// stage. Returns 0 if a stage fails to compile or the program to link,
+// shader_log has the reason.
+GLuint shader_program_stages(const struct shader_stage *stages, int count, const char *defines);
+GLuint shader_program(const char *vertex, const char *fragment, const char *defines);
+GLuint shader_program_files(const char *vertex_path, const char *fragment_path, const char *defines);
+// Info log of the last failed compile or link
+const char* shader_log(void);
+
+struct shader_async;
+
+// Returns NULL only for invalid arguments, compile and link errors show up
+// as a status of -1 later. Cache hits are ready immediately.
+struct shader_async* shader_program_async(const struct shader_stage *stages, int count, const char *defines, GLuint placeholder);
+// The linked program, or the placeholder while pending and after a failure
+GLuint shader_async_program(const struct shader_async *async);
+// 1 when linked, 0 while pending and -1 if it failed (see shader_log)
+int shader_async_status(const struct shader_async *async);
+// Finishes the program right away, returns 0 if it failed
+GLuint shader_async_wait(struct shader_async *async);
+// Deletes the program (never the placeholder) and the handle
+void shader_async_destroy(struct shader_async *async);
+// Checks on pending programs, returns the number still pending
+int shader_async_poll(void);
+int shader_async_pending(void);
+
+// 32 bit FNV-1a of at most the first SHADER_HASH_MAX characters
+#define SHADER_HASH_MAX 64
+#define SHADER_HASH_BASIS 2166136261u
+#define SHADER_HASH_PRIME 16777619u
+// Steps past the end of the literal xor 0 and multiply by 1, which keeps
+// `H` from appearing twice and the expansion linear
+#define SHADER_HASH_STEP(S, I, H)                                                         \
+    (((H) ^ ((I) < sizeof(S) - 1 ? (uint32_t)(unsigned char)(S)[(I) < sizeof(S) ? (I) : 0] : 0u)) * \
+     ((I) < sizeof(S) - 1 ? SHADER_HASH_PRIME : 1u))
+#define SHADER_HASH_4(S, I, H) \
+    SHADER_HASH_STEP(S, (I) + 3, SHADER_HASH_STEP(S, (I) + 2, SHADER_HASH_STEP(S, (I) + 1, SHADER_HASH_STEP(S, (I), H))))
+#define SHADER_HASH_16(S, I, H) \
+    SHADER_HASH_4(S, (I) + 12, SHADER_HASH_4(S, (I) + 8, SHADER_HASH_4(S, (I) + 4, SHADER_HASH_4(S, (I), H))))
+// String literals only, use shader_hash_name for anything else
+#define SHADER_HASH(S) \
+    ((uint32_t)SHADER_HASH_16(S, 48, SHADER_HASH_16(S, 32, SHADER_HASH_16(S, 16, SHADER_HASH_16(S, 0, SHADER_HASH_BASIS)))))
+
+// Same value as SHADER_HASH, at runtime
+uint32_t shader_hash_name(const char *name);
+
+struct shader_uniform {
+    uint32_t hash;
+    // -1 for members of a uniform block
+    GLint location;
+    GLenum type;
+    // Array length, 1 otherwise
+    GLint size;
+    // Uniform block index and layout inside it, -1 outside of blocks
+    GLint block;
+    GLint offset, array_stride, matrix_stride;
+};
+
+struct shader_block {
+    uint32_t hash;
+    GLuint index;
+    // GL_UNIFORM_BLOCK_DATA_SIZE
+    GLint size;
+};
+
+struct shader_uniforms;
+
+// Enumerates the active uniforms and blocks of a linked program
+struct shader_uniforms* shader_reflect(GLuint program);
+void shader_uniforms_destroy(struct shader_uniforms *uniforms);
+GLuint shader_uniforms_program(const struct shader_uniforms *uniforms);
+// NULL if `hash` names no active uniform (or block)
+const struct shader_uniform* shader_uniform(const struct shader_uniforms *uniforms, uint32_t hash);
+const struct shader_block* shader_block(const struct shader_uniforms *uniforms, uint32_t hash);
+GLint shader_uniform_location(const struct shader_uniforms *uniforms, uint32_t hash);
+// Forgets the remembered values, e.g. after the program was relinked or
+// set through glUniform directly
+void shader_uniforms_reset(struct shader_uniforms *uniforms);
+
+// Return false if there is no such uniform outside of a block
+bool shader_set_int(struct shader_uniforms *uniforms, uint32_t hash, int value);
+bool shader_set_float(struct shader_uniforms *uniforms, uint32_t hash, float value);
+bool shader_set_vec2(struct shader_uniforms *uniforms, uint32_t hash, vec2 value);
+bool shader_set_vec3(struct shader_uniforms *uniforms, uint32_t hash, vec3 value);
+bool shader_set_vec4(struct shader_uniforms *uniforms, uint32_t hash, vec4 value);
+bool shader_set_vec2i(struct shader_uniforms *uniforms, uint32_t hash, vec2i value);
+bool shader_set_vec3i(struct shader_uniforms *uniforms, uint32_t hash, vec3i value);
+bool shader_set_vec4i(struct shader_uniforms *uniforms, uint32_t hash, vec4i value);
+#ifndef GLM_NO_MATRICES
+bool shader_set_mat2(struct shader_uniforms *uniforms, uint32_t hash, mat2 value);
+bool shader_set_mat3(struct shader_uniforms *uniforms, uint32_t hash, mat3 value);
+bool shader_set_mat4(struct shader_uniforms *uniforms, uint32_t hash, mat4 value);
+#endif
+
+#ifndef GLM_NO_GENERICS
+#ifndef GLM_VECTOR_SIZE
+#define __SHADER_SET_VEC3      \
+    vec3: shader_set_vec3,     \
+    vec3i: shader_set_vec3i,
+#else
+// vec3 is vec4 here, shader_set_vec4(i) checks the uniform's type instead
+#define __SHADER_SET_VEC3
+#endif
+#ifndef GLM_NO_MATRICES
+#define shader_set(UNIFORMS, HASH, VALUE) _Generic((VALUE), \
+    int: shader_set_int,                                    \
+    float: shader_set_float,                                \
+    vec2: shader_set_vec2,                                  \
+    __SHADER_SET_VEC3                                       \
+    vec4: shader_set_vec4,                                  \
+    vec2i: shader_set_vec2i,                                \
+    vec4i: shader_set_vec4i,                                \
+    mat2: shader_set_mat2,                                  \
+    mat3: shader_set_mat3,                                  \
+    mat4: shader_set_mat4)((UNIFORMS), (HASH), (VALUE))
+#else
+#define shader_set(UNIFORMS, HASH, VALUE) _Generic((VALUE), \
+    int: shader_set_int,                                    \
+    float: shader_set_float,                                \
+    vec2: shader_set_vec2,                                  \
+    __SHADER_SET_VEC3                                       \
+    vec4: shader_set_vec4,                                  \
+    vec2i: shader_set_vec2i,                                \
+    vec4i: shader_set_vec4i)((UNIFORMS), (HASH), (VALUE))
+#endif // GLM_NO_MATRICES
+#endif // GLM_NO_GENERICS
+
+#if defined(__cplusplus)
+}
+#endif
+#endif /* glshader_h */
@@ -0,0 +1,414 @@
+/* glsprite.c --  https://github.com/takeiteasy/fungl
+
+ fungl puts the fun back into OpenGL
+
+ Copyright (C) 2024  George Watson
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+#include "glsprite.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+
+// 16 bit indices address 65536 vertices, runs longer than this are split
+#define SPRITE_INDEX_SPRITES 16384
+// A partly used segment is only worth continuing in with room for this many
+#define SPRITE_MIN_CHUNK 1024
+
+struct sprite_vertex {
+    float x, y;
+    uint16_t u, v;
+    unsigned char color[4];
+    uint16_t layer, pad;
+};
+
+#define SPRITE_BYTES (4 * sizeof(struct sprite_vertex))
+
+static const struct {
+    const char *name;
+    GLint size;
+    GLenum type;
+    GLboolean normalized;
+    size_t offset;
+} sprite_attributes[] = {
+    {"position", 2, GL_FLOAT, GL_FALSE, offsetof(struct sprite_vertex, x)},
+    {"uv", 2, GL_UNSIGNED_SHORT, GL_TRUE, offsetof(struct sprite_vertex, u)},
+    {"color", 4, GL_UNSIGNED_BYTE, GL_TRUE, offsetof(struct sprite_vertex, color)},
+    {"layer", 1, GL_UNSIGNED_SHORT, GL_FALSE, offsetof(struct sprite_vertex, layer)}
+};
+
+#define SPRITE_ATTRIBUTES (sizeof(sprite_attributes) / sizeof(sprite_attributes[0]))
+
+struct sprite_run {
+    GLuint texture;
+    bool array;
+    // Sprites, relative to the start of the chunk
+    size_t first, count;
+};
+
+struct sprite_batch {
+    size_t capacity;
+    int flags;
+    GLuint program, vertex_array, indices;
+    GLint locations[SPRITE_ATTRIBUTES];
+    struct shader_uniforms *uniforms;
+    struct buffer_ring *ring;
+    size_t frame_size;
+    // Where sprites are written: the ring allocation, or the staging copy
+    // binned by texture when sorting
+    struct buffer_alloc chunk;
+    struct sprite_vertex *vertices;
+    size_t chunk_capacity, count;
+    struct sprite_run *runs;
+    size_t run_count, run_capacity;
+    // SPRITE_SORT_TEXTURE only, the texture slot of every staged sprite
+    struct sprite_vertex *staging;
+    unsigned char *slots;
+    struct {
+        GLuint texture;
+        bool array;
+        size_t count;
+    } textures[SPRITE_MAX_TEXTURES];
+    int texture_count;
+    size_t total;
+    int calls;
+};
+
+static const char *sprite_vertex_source =
+    "#version 150\n"
+    "in vec2 position;\n"
+    "in vec2 uv;\n"
+    "in vec4 color;\n"
+    "in float layer;\n"
+    "uniform mat4 projection;\n"
+    "out vec3 v_uv;\n"
+    "out vec4 v_color;\n"
+    "void main() {\n"
+    "    gl_Position = projection * vec4(position, 0.0, 1.0);\n"
+    "    v_uv = vec3(uv, layer);\n"
+    "    v_color = color;\n"
+    "}\n";
+
+// One program for both kinds of texture, the branch is on a uniform
+static const char *sprite_fragment_source =
+    "#version 150\n"
+    "in vec3 v_uv;\n"
+    "in vec4 v_color;\n"
+    "uniform sampler2D image;\n"
+    "uniform sampler2DArray images;\n"
+    "uniform bool use_array;\n"
+    "out vec4 fragment;\n"
+    "void main() {\n"
+    "    fragment = (use_array ? texture(images, v_uv) : texture(image, v_uv.xy)) * v_color;\n"
+    "}\n";
+
+#define SPRITE_GROW(ARRAY, COUNT, CAPACITY)                                       \
+    do {                                                                          \
+        if ((COUNT) == (CAPACITY)) {                                              \
+            size_t capacity = (CAPACITY) ? (CAPACITY) * 2 : 64;                   \
+            void *grown = realloc((ARRAY), capacity * sizeof(*(ARRAY)));          \
+            if (!grown)                                                           \
+                abort();                                                          \
+            (ARRAY) = grown;                                                      \
+            (CAPACITY) = capacity;                                                \
+        }                                                                         \
+    } while (0)
+
+struct sprite_batch* sprite_batch_create(size_t capacity, int flags) {
+    if (!capacity)
+        return NULL;
+    struct sprite_batch *batch = calloc(1, sizeof(struct sprite_batch));
+    if (!batch)
+        return NULL;
+    batch->capacity = capacity;
+    batch->flags = flags;
+    batch->frame_size = capacity * SPRITE_BYTES;
+    if (!(batch->ring = buffer_ring_create(batch->frame_size, 0)))
+        goto BAIL;
+    if (flags & SPRITE_SORT_TEXTURE &&
+        (!(batch->staging = malloc(batch->frame_size)) || !(batch->slots = malloc(capacity))))
+        goto BAIL;
+    if (!(batch->program = shader_program(sprite_vertex_source, sprite_fragment_source, NULL)) ||
+        !(batch->uniforms = shader_reflect(batch->program)))
+        goto BAIL;
+    glUseProgram(batch->program);
+    shader_set_int(batch->uniforms, SHADER_HASH("image"), 0);
+    shader_set_int(batch->uniforms, SHADER_HASH("images"), 1);
+    glUseProgram(0);
+
+    // Every quad is two triangles over its four corners, the same indices
+    // serve every run through the base vertex
+    uint16_t *indices = malloc(SPRITE_INDEX_SPRITES * 6 * sizeof(uint16_t));
+    if (!indices)
+        goto BAIL;
+    for (int i = 0; i < SPRITE_INDEX_SPRITES; i++) {
+        uint16_t v = (uint16_t)(i * 4);
+        uint16_t *quad = indices + i * 6;
+        quad[0] = v;
+        quad[1] = v + 1;
+        quad[2] = v + 2;
+        quad[3] = v + 2;
+        quad[4] = v + 3;
+        quad[5] = v;
+    }
+    glGenVertexArrays(1, &batch->vertex_array);
+    glBindVertexArray(batch->vertex_array);
+    glGenBuffers(1, &batch->indices);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch->indices);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, SPRITE_INDEX_SPRITES * 6 * sizeof(uint16_t), indices, GL_STATIC_DRAW);
+    free(indices);
+    for (size_t i = 0; i < SPRITE_ATTRIBUTES; i++)
+        if ((batch->locations[i] = glGetAttribLocation(batch->program, sprite_attributes[i].name)) >= 0)
+            glEnableVertexAttribArray((GLuint)batch->locations[i]);
+    glBindVertexArray(0);
+    return batch;
+BAIL:
+    sprite_batch_destroy(batch);
+    return NULL;
+}
+
+void sprite_batch_destroy(struct sprite_batch *batch) {
+    if (!batch)
+        return;
+    if (batch->vertex_array)
+        glDeleteVertexArrays(1, &batch->vertex_array);
+    if (batch->indices)
+        glDeleteBuffers(1, &batch->indices);
+    if (batch->program)
+        glDeleteProgram(batch->program);
+    shader_uniforms_destroy(batch->uniforms);
+    buffer_ring_destroy(batch->ring);
+    free(batch->staging);
+    free(batch->slots);
+    free(batch->runs);
+    free(batch);
+}
+
+void sprite_batch_begin(struct sprite_batch *batch, mat4 projection) {
+    if (!batch)
+        return;
+    batch->total = 0;
+    batch->calls = 0;
+    glUseProgram(batch->program);
+    shader_set_mat4(batch->uniforms, SHADER_HASH("projection"), projection);
+}
+
+// Room for up to `sprites` in the current ring segment, or in the next one
+// when fewer than `required` are left
+static bool sprite_chunk(struct sprite_batch *batch, size_t sprites, size_t required) {
+    size_t left = (batch->frame_size - buffer_ring_used(batch->ring)) / SPRITE_BYTES;
+    if (left < required) {
+        buffer_ring_end_frame(batch->ring);
+        left = batch->capacity;
+    }
+    if (sprites > left)
+        sprites = left;
+    if (!buffer_ring_alloc(batch->ring, sprites * SPRITE_BYTES, sizeof(float), &batch->chunk))
+        return false;
+    batch->chunk_capacity = sprites;
+    return true;
+}
+
+static void sprite_draw_runs(struct sprite_batch *batch) {
+    GLintptr offset = batch->chunk.offset;
+    glBindVertexArray(batch->vertex_array);
+    glBindBuffer(GL_ARRAY_BUFFER, batch->chunk.buffer);
+    // Pointers move with every chunk, runs inside one only change the base
+    // vertex of the draw
+    for (size_t i = 0; i < SPRITE_ATTRIBUTES; i++)
+        if (batch->locations[i] >= 0)
+            glVertexAttribPointer((GLuint)batch->locations[i], sprite_attributes[i].size, sprite_attributes[i].type,
+                                  sprite_attributes[i].normalized, sizeof(struct sprite_vertex),
+                                  (const void*)(offset + sprite_attributes[i].offset));
+    for (size_t r = 0; r < batch->run_count; r++) {
+        const struct sprite_run *run = &batch->runs[r];
+        shader_set_int(batch->uniforms, SHADER_HASH("use_array"), run->array);
+        glActiveTexture(run->array ? GL_TEXTURE1 : GL_TEXTURE0);
+        glBindTexture(run->array ? GL_TEXTURE_2D_ARRAY : GL_TEXTURE_2D, run->texture);
+        for (size_t done = 0; done < run->count; done += SPRITE_INDEX_SPRITES) {
+            size_t n = run->count - done < SPRITE_INDEX_SPRITES ? run->count - done : SPRITE_INDEX_SPRITES;
+            glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)(n * 6), GL_UNSIGNED_SHORT, NULL,
+                                     (GLint)((run->first + done) * 4));
+            batch->calls++;
+        }
+    }
+    glBindVertexArray(0);
+}
+
+static void sprite_flush(struct sprite_batch *batch) {
+    if (!batch->count)
+        return;
+    // The caller may have bound another program since begin, and the
+    // use_array uniform has to land on this one
+    glUseProgram(batch->program);
+    if (batch->flags & SPRITE_SORT_TEXTURE) {
+        // Counting sort by slot straight into the ring, stable so sprites
+        // keep their order within a texture
+        if (!sprite_chunk(batch, batch->count, batch->count))
+            goto DONE;
+        size_t starts[SPRITE_MAX_TEXTURES], first = 0;
+        batch->run_count = 0;
+        for (int t = 0; t < batch->texture_count; t++) {
+            starts[t] = first;
+            SPRITE_GROW(batch->runs, batch->run_count, batch->run_capacity);
+            batch->runs[batch->run_count++] = (struct sprite_run) {
+                .texture = batch->textures[t].texture,
+                .array = batch->textures[t].array,
+                .first = first,
+                .count = batch->textures[t].count
+            };
+            first += batch->textures[t].count;
+        }
+        struct sprite_vertex *out = batch->chunk.ptr;
+        for (size_t i = 0; i < batch->count; i++)
+            memcpy(out + starts[batch->slots[i]]++ * 4, batch->staging + i * 4, SPRITE_BYTES);
+    } else
+        buffer_ring_shrink(batch->ring, &batch->chunk, batch->count * SPRITE_BYTES);
+    buffer_ring_flush(batch->ring);
+    sprite_draw_runs(batch);
+DONE:
+    batch->vertices = NULL;
+    batch->count = 0;
+    batch->run_count = 0;
+    batch->texture_count = 0;
+}
+
+static inline uint16_t sprite_unorm16(float v) {
+    return v <= 0.f ? 0 : v >= 1.f ? 65535 : (uint16_t)(v * 65535.f + .5f);
+}
+
+static inline unsigned char sprite_unorm8(float v) {
+    return v <= 0.f ? 0 : v >= 1.f ? 255 : (unsigned char)(v * 255.f + .5f);
+}
+
+// Staging slot of `texture` for a sorted batch, -1 when all are taken
+static int sprite_slot(struct sprite_batch *batch, GLuint texture, bool array) {
+    for (int t = batch->texture_count - 1; t >= 0; t--)
+        if (batch->textures[t].texture == texture && batch->textures[t].array == array)
+            return t;
+    if (batch->texture_count == SPRITE_MAX_TEXTURES)
+        return -1;
+    int t = batch->texture_count++;
+    batch->textures[t].texture = texture;
+    batch->textures[t].array = array;
+    batch->textures[t].count = 0;
+    return t;
+}
+
+void sprite_batch_draw(struct sprite_batch *batch, const struct sprite *sprite) {
+    if (!batch || !sprite)
+        return;
+    bool array = sprite->array;
+    bool sorted = batch->flags & SPRITE_SORT_TEXTURE;
+    int slot = 0;
+    if (sorted) {
+        if (batch->count == batch->capacity || (slot = sprite_slot(batch, sprite->texture, array)) < 0) {
+            sprite_flush(batch);
+            slot = sprite_slot(batch, sprite->texture, array);
+        }
+        batch->vertices = batch->staging;
+        batch->slots[batch->count] = (unsigned char)slot;
+        batch->textures[slot].count++;
+    } else {
+        if (!batch->vertices || batch->count == batch->chunk_capacity) {
+            sprite_flush(batch);
+            size_t required = batch->capacity < SPRITE_MIN_CHUNK ? batch->capacity : SPRITE_MIN_CHUNK;
+            if (!sprite_chunk(batch, batch->capacity, required))
+                return;
+            batch->vertices = batch->chunk.ptr;
+        }
+        struct sprite_run *run = batch->run_count ? &batch->runs[batch->run_count - 1] : NULL;
+        if (run && run->texture == sprite->texture && run->array == array)
+            run->count++;
+        else {
+            SPRITE_GROW(batch->runs, batch->run_count, batch->run_capacity);
+            batch->runs[batch->run_count++] = (struct sprite_run) {
+                .texture = sprite->texture,
+                .array = array,
+                .first = batch->count,
+                .count = 1
+            };
+        }
+    }
+
+    float x0 = -sprite->origin[0], y0 = -sprite->origin[1];
+    float x1 = x0 + sprite->size[0], y1 = y0 + sprite->size[1];
+    float corners[4][2] = {{x0, y0}, {x1, y0}, {x1, y1}, {x0, y1}};
+    float px = sprite->position[0], py = sprite->position[1];
+    if (sprite->rotation != 0.f) {
+        float c = cosf(sprite->rotation), s = sinf(sprite->rotation);
+        for (int i = 0; i < 4; i++) {
+            float x = corners[i][0], y = corners[i][1];
+            corners[i][0] = x * c - y * s;
+            corners[i][1] = x * s + y * c;
+        }
+    }
+    uint16_t u0 = sprite_unorm16(sprite->uv[0]), v0 = sprite_unorm16(sprite->uv[1]);
+    uint16_t u1 = sprite_unorm16(sprite->uv[2]), v1 = sprite_unorm16(sprite->uv[3]);
+    uint16_t uvs[4][2] = {{u0, v0}, {u1, v0}, {u1, v1}, {u0, v1}};
+    unsigned char rgba[4] = {
+        sprite_unorm8(sprite->color[0]), sprite_unorm8(sprite->color[1]),
+        sprite_unorm8(sprite->color[2]), sprite_unorm8(sprite->color[3])
+    };
+    uint16_t layer = array && sprite->layer > 0 ? (uint16_t)sprite->layer : 0;
+    // Built on the stack and copied out whole, the destination is usually
+    // write-combined mapped memory that shouldn't see partial writes
+    struct sprite_vertex quad[4];
+    for (int i = 0; i < 4; i++) {
+        quad[i].x = px + corners[i][0];
+        quad[i].y = py + corners[i][1];
+        quad[i].u = uvs[i][0];
+        quad[i].v = uvs[i][1];
+        memcpy(quad[i].color, rgba, 4);
+        quad[i].layer = layer;
+        quad[i].pad = 0;
+    }
+    memcpy(batch->vertices + batch->count * 4, quad, sizeof(quad));
+    batch->count++;
+    batch->total++;
+}
+
+int sprite_batch_end(struct sprite_batch *batch) {
+    if (!batch)
+        return 0;
+    sprite_flush(batch);
+    return batch->calls;
+}
+
+size_t sprite_batch_count(const struct sprite_batch *batch) {
+    return batch ? batch->total : 0;
+}
+
+GLuint sprite_texture_array(int width, int height, int layers, const void *const *pixels, bool mipmaps) {
+    if (width <= 0 || height <= 0 || layers <= 0)
+        return 0;
+    GLuint texture = 0;
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, texture);
+    glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, width, height, layers, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    if (pixels)
+        for (int i = 0; i < layers; i++)
+            if (pixels[i])
+                glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, i, width, height, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixels[i]);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, mipmaps ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    if (mipmaps)
+        glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+    return texture;
+}
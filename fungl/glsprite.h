@@ -0,0 +1,114 @@
+/* glsprite.h --  https://github.com/takeiteasy/fungl
+
+ fungl puts the fun back into OpenGL
+
+ Copyright (C) 2024  George Watson
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+ 2D sprite batching. Quads are written straight into a streaming buffer
+ (a buffer ring, see glbuffer.h) as they are drawn and go out with one
+ glDrawElementsBaseVertex per run of sprites sharing a texture. Sprites
+ taken from layers of one GL_TEXTURE_2D_ARRAY never break a run, so a
+ dashboard whose images all live in an array is a single draw.
+
+    struct sprite_batch *batch = sprite_batch_create(65536, 0);
+    GLuint icons = sprite_texture_array(64, 64, count, pixels, false);
+    ...
+    sprite_batch_begin(batch, projection);
+    sprite_batch_draw(batch, &(struct sprite) {
+        .position = Vec2(x, y),
+        .size = Vec2(64.f, 64.f),
+        .uv = Vec4(0.f, 0.f, 1.f, 1.f),
+        .color = Vec4(1.f, 1.f, 1.f, 1.f),
+        .texture = icons,
+        .array = true,
+        .layer = 3
+    });
+    sprite_batch_end(batch);
+
+ Sprites are drawn in order unless SPRITE_SORT_TEXTURE is given, which bins
+ them by texture first (keeping their order within a texture) for scenes
+ where nothing overlaps. A batch holds `capacity` sprites, more than that
+ are drawn in chunks. The buffer has room for `capacity` sprites per frame
+ in flight, a frame that needs more moves on to the next segment early and
+ may wait for the GPU. */
+
+#if !defined(glsprite_h) && !defined(FUNGL_NO_SPRITE)
+#define glsprite_h
+#if defined(__cplusplus)
+extern "C" {
+#endif
+#include "gl.h"
+#if FUNGL_VERSION < GL_VERSION_3_2
+#error "glsprite.h requires FUNGL_VERSION >= GL_VERSION_3_2"
+#endif
+#include "glm.h"
+#include "glbuffer.h"
+#ifndef glbuffer_h
+#error "glsprite.h requires glbuffer.h, don't define FUNGL_NO_BUFFER"
+#endif
+#include "glshader.h"
+#ifndef glshader_h
+#error "glsprite.h requires glshader.h, don't define FUNGL_NO_SHADER"
+#endif
+#ifdef GLM_NO_MATRICES
+#error "glsprite.h requires glm matrices, GLM_NO_MATRICES is defined"
+#endif
+#include <stddef.h>
+#include <stdbool.h>
+
+// Distinct textures a SPRITE_SORT_TEXTURE batch bins before flushing early
+#define SPRITE_MAX_TEXTURES 256
+
+enum sprite_flags {
+    SPRITE_SORT_TEXTURE = 1
+};
+
+struct sprite {
+    // Where `origin` ends up, rotation (in radians) is around it
+    vec2 position;
+    vec2 size;
+    // Offset into the sprite, (0, 0) is the top left corner
+    vec2 origin;
+    float rotation;
+    // u0, v0, u1, v1, packed as 16 bit unorms: clamped to [0, 1], so
+    // repeating a texture across a sprite isn't possible
+    vec4 uv;
+    color color;
+    GLuint texture;
+    // `texture` is a GL_TEXTURE_2D_ARRAY and `layer` the layer to draw,
+    // otherwise (the zero value) it's a GL_TEXTURE_2D
+    bool array;
+    int layer;
+};
+
+struct sprite_batch;
+
+struct sprite_batch* sprite_batch_create(size_t capacity, int flags);
+void sprite_batch_destroy(struct sprite_batch *batch);
+void sprite_batch_begin(struct sprite_batch *batch, mat4 projection);
+void sprite_batch_draw(struct sprite_batch *batch, const struct sprite *sprite);
+// Draws what's left, returns the number of draw calls since begin
+int sprite_batch_end(struct sprite_batch *batch);
+// Sprites drawn since begin
+size_t sprite_batch_count(const struct sprite_batch *batch);
+// RGBA8 texture array of `layers` images of `width`x`height`, `pixels` may
+// be NULL (or hold NULLs) to fill layers later with glTexSubImage3D
+GLuint sprite_texture_array(int width, int height, int layers, const void *const *pixels, bool mipmaps);
+
+#if defined(__cplusplus)
+}
+#endif
+#endif /* glsprite_h */
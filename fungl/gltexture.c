@@ -0,0 +1,1928 @@
+/* gltexture.c --  https://github.com/takeiteasy/fungl
+
+ fungl puts the fun back into OpenGL
+
+ Copyright (C) 2024  George Watson
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+#include "gltexture.h"
+#include "glut.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <stdint.h>
+#include <math.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+#if !defined(_WIN32) && !defined(TEXTURE_NO_THREADS)
+#include <pthread.h>
+#define TEXTURE_THREADS
+#endif
+#define STB_IMAGE_IMPLEMENTATION
+#define STBI_NO_HDR
+#include "deps/stb_image.h"
+#define QOI_IMPLEMENTATION
+#include "deps/qoi.h"
+
+#ifndef MIN
+#define MIN(A, B) ((A) < (B) ? (A) : (B))
+#endif
+#ifndef MAX
+#define MAX(A, B) ((A) > (B) ? (A) : (B))
+#endif
+
+struct texture_pbo {
+    GLuint buffer;
+    GLsizeiptr capacity;
+    GLsync fence;
+    // Handed to a worker which is decoding into it
+    bool mapped;
+};
+
+#define TEXTURE_MAX_LEVELS 16
+
+enum {
+    TEXTURE_ENCODING_RAW = 0,
+    TEXTURE_ENCODING_QOI
+};
+
+// A whole mip chain in its final format, owned or in a mapped cache file
+struct texture_processed {
+    const unsigned char *data;
+    unsigned char *owned;
+    const void *mapping;
+    size_t mapping_size;
+    // Bytes at `data`, and what they expand to when the levels are encoded
+    size_t size, upload_size;
+    size_t level_size[TEXTURE_MAX_LEVELS];
+    GLenum format;
+    int encoding;
+    int width, height, levels, flags;
+};
+
+/* A job visits the workers once or twice. The first visit maps the file:
+   stb_image formats are decoded to the heap right away, QOI files only have
+   their header read. The render thread then maps a PBO for the QOI job and
+   hands it back to the workers to decode straight into the buffer. Jobs
+   that are block compressed or go through the cache come back with their
+   whole mip chain processed (a QOI encoded cache hit also takes the PBO
+   detour), stream jobs decode the whole file and keep a range of its mip
+   levels. */
+struct texture_job {
+    struct texture_job *next;
+    texture_callback callback;
+    void *userdata;
+    int flags;
+    int width, height;
+    unsigned char *pixels;
+    // Bytes counted against TEXTURE_DECODED_LIMIT
+    size_t bytes;
+    struct texture_stream *stream;
+    int first_level, last_level;
+    struct texture_processed processed;
+    const unsigned char *file;
+    size_t file_size;
+    struct texture_pbo *pbo;
+    void *target;
+    bool failed;
+    char path[];
+};
+
+struct texture_queue {
+    struct texture_job *head, *tail;
+};
+
+static struct {
+    struct texture_queue incoming;
+    // QOI jobs holding a mapped PBO, workers take these first
+    struct texture_queue staged;
+    struct texture_queue decoded;
+    // Staged jobs back from the workers, these never wait for a free PBO
+    struct texture_queue filled;
+    size_t decoded_bytes;
+    int pending;
+    struct texture_pbo pbos[TEXTURE_PBO_COUNT];
+    int next_pbo;
+#ifdef TEXTURE_THREADS
+    pthread_t threads[TEXTURE_LOADER_MAX_THREADS];
+    int thread_count;
+    pthread_mutex_t lock;
+    pthread_cond_t work;
+    bool quit;
+#endif
+    bool initialised;
+} state = {
+    .initialised = false
+};
+
+#ifdef TEXTURE_THREADS
+#define TEXTURE_LOCK() pthread_mutex_lock(&state.lock)
+#define TEXTURE_UNLOCK() pthread_mutex_unlock(&state.lock)
+#define TEXTURE_WAKE() pthread_cond_broadcast(&state.work)
+#else
+#define TEXTURE_LOCK()
+#define TEXTURE_UNLOCK()
+#define TEXTURE_WAKE()
+#endif
+
+static void texture_queue_push(struct texture_queue *queue, struct texture_job *job) {
+    job->next = NULL;
+    if (queue->tail)
+        queue->tail->next = job;
+    else
+        queue->head = job;
+    queue->tail = job;
+}
+
+static void texture_queue_push_front(struct texture_queue *queue, struct texture_job *job) {
+    job->next = queue->head;
+    queue->head = job;
+    if (!queue->tail)
+        queue->tail = job;
+}
+
+static struct texture_job* texture_queue_pop(struct texture_queue *queue) {
+    struct texture_job *job = queue->head;
+    if (job) {
+        queue->head = job->next;
+        if (!queue->head)
+            queue->tail = NULL;
+    }
+    return job;
+}
+
+#ifdef TEXTURE_THREADS
+static int texture_core_count(void) {
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n < 1 ? 1 : n > TEXTURE_LOADER_MAX_THREADS ? TEXTURE_LOADER_MAX_THREADS : (int)n;
+}
+#endif
+
+const void* texture_map_file(const char *path, size_t *size) {
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+        return NULL;
+    LARGE_INTEGER length;
+    void *result = NULL;
+    if (GetFileSizeEx(file, &length) && length.QuadPart > 0) {
+        HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (mapping) {
+            // The view keeps the mapping alive after both handles are closed
+            if ((result = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0)))
+                *size = (size_t)length.QuadPart;
+            CloseHandle(mapping);
+        }
+    }
+    CloseHandle(file);
+    return result;
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return NULL;
+    struct stat info;
+    void *result = NULL;
+    if (!fstat(fd, &info) && info.st_size > 0) {
+        result = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (result == MAP_FAILED)
+            result = NULL;
+        else {
+            *size = (size_t)info.st_size;
+#ifdef POSIX_MADV_SEQUENTIAL
+            // Both decoders read front to back exactly once
+            posix_madvise(result, *size, POSIX_MADV_SEQUENTIAL);
+#endif
+        }
+    }
+    close(fd);
+    return result;
+#endif
+}
+
+void texture_unmap_file(const void *data, size_t size) {
+    if (!data)
+        return;
+#ifdef _WIN32
+    UnmapViewOfFile(data);
+#else
+    munmap((void*)data, size);
+#endif
+}
+
+bool texture_qoi_info(const void *data, size_t size, int *width, int *height) {
+    const unsigned char *bytes = data;
+    if (!bytes || size < QOI_HEADER_SIZE + sizeof(qoi_padding))
+        return false;
+    int p = 0;
+    unsigned int magic = qoi_read_32(bytes, &p);
+    unsigned int w = qoi_read_32(bytes, &p);
+    unsigned int h = qoi_read_32(bytes, &p);
+    unsigned char channels = bytes[12], colorspace = bytes[13];
+    if (magic != QOI_MAGIC || !w || !h || channels < 3 || channels > 4 ||
+        colorspace > 1 || h >= QOI_PIXELS_MAX / w)
+        return false;
+    *width = (int)w;
+    *height = (int)h;
+    return true;
+}
+
+/* QOI codec. Pixels are handled as little-endian 32-bit words (r in the low
+   byte) so ops become integer arithmetic: DIFF/LUMA are a bytewise add, the
+   index hash is one multiply and runs are 16 byte stores. */
+
+typedef uint32_t u32x4 __attribute__((vector_size(16)));
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define TEXTURE_LE32(V) __builtin_bswap32(V)
+#else
+#define TEXTURE_LE32(V) (V)
+#endif
+#define TEXTURE_QOI_OPAQUE 0xFF000000u
+
+static inline uint32_t texture_load32(const unsigned char *src) {
+    uint32_t v;
+    memcpy(&v, src, 4);
+    return TEXTURE_LE32(v);
+}
+
+static inline void texture_store32(unsigned char *dst, uint32_t v) {
+    v = TEXTURE_LE32(v);
+    memcpy(dst, &v, 4);
+}
+
+// (r*3 + g*5 + b*7 + a*11) % 64: spreading the channels 16 bits apart
+// keeps every partial product clear of the top byte, which collects the sum
+static inline int texture_qoi_hash(uint32_t px) {
+    uint64_t s = ((uint64_t)(px & 0xFF00FF00u) << 32) | (px & 0x00FF00FFu);
+    return (int)((s * 0x030007000005000Bull) >> 56) & 63;
+}
+
+// Per byte addition modulo 256, the alpha byte of `d` is always 0
+static inline uint32_t texture_add_bytes(uint32_t px, uint32_t d) {
+    return ((px & 0x7F7F7F7Fu) + (d & 0x7F7F7F7Fu)) ^ ((px ^ d) & 0x80808080u);
+}
+
+static inline uint32_t texture_pack_delta(int r, int g, int b) {
+    return (uint32_t)(r & 0xFF) | (uint32_t)(g & 0xFF) << 8 | (uint32_t)(b & 0xFF) << 16;
+}
+
+struct texture_qoi_decoder {
+    const unsigned char *bytes;
+    size_t p, chunks;
+    uint32_t index[64];
+    uint32_t diff[64];
+    uint32_t px;
+    int run;
+};
+
+static void texture_fill32(unsigned char *dst, uint32_t px, int count) {
+    int i = 0;
+    if (count >= 4) {
+        u32x4 splat = {px, px, px, px};
+        for (; i + 4 <= count; i += 4)
+            memcpy(dst + i * 4, &splat, sizeof(splat));
+    }
+    for (; i < count; i++)
+        memcpy(dst + i * 4, &px, 4);
+}
+
+// Decodes the next `count` pixels, state carries across calls so rows can
+// be written in any order
+static void texture_qoi_decode_span(struct texture_qoi_decoder *dec, unsigned char *dst, int count) {
+    const unsigned char *bytes = dec->bytes;
+    size_t p = dec->p;
+    uint32_t px = dec->px;
+    int run = dec->run, i = 0;
+    while (i < count) {
+        if (run) {
+            int n = run < count - i ? run : count - i;
+            texture_fill32(dst + (size_t)i * 4, TEXTURE_LE32(px), n);
+            i += n;
+            run -= n;
+            continue;
+        }
+        if (p >= dec->chunks) {
+            // Truncated stream, the reference decoder repeats the last pixel
+            texture_fill32(dst + (size_t)i * 4, TEXTURE_LE32(px), count - i);
+            break;
+        }
+        int b1 = bytes[p++];
+        switch (b1 >> 6) {
+            case 0:
+                px = dec->index[b1];
+                break;
+            case 1:
+                px = texture_add_bytes(px, dec->diff[b1 & 0x3F]);
+                break;
+            case 2: {
+                int b2 = bytes[p++];
+                int vg = (b1 & 0x3F) - 32;
+                px = texture_add_bytes(px, texture_pack_delta(vg - 8 + (b2 >> 4), vg, vg - 8 + (b2 & 0x0F)));
+                break;
+            }
+            default:
+                if (b1 < QOI_OP_RGB) {
+                    run = (b1 & 0x3F) + 1;
+                    dec->index[texture_qoi_hash(px)] = px;
+                    continue;
+                }
+                if (b1 == QOI_OP_RGB) {
+                    px = (px & TEXTURE_QOI_OPAQUE) | (texture_load32(bytes + p) & 0x00FFFFFFu);
+                    p += 3;
+                } else {
+                    px = texture_load32(bytes + p);
+                    p += 4;
+                }
+        }
+        dec->index[texture_qoi_hash(px)] = px;
+        texture_store32(dst + (size_t)i++ * 4, px);
+    }
+    dec->p = p;
+    dec->px = px;
+    dec->run = run;
+}
+
+bool texture_qoi_decode_into(const void *data, size_t size, void *pixels, int width, int height, int flags) {
+    int w, h;
+    if (!texture_qoi_info(data, size, &w, &h) || w != width || h != height)
+        return false;
+    struct texture_qoi_decoder dec = {
+        .bytes = data,
+        .p = QOI_HEADER_SIZE,
+        .chunks = size - sizeof(qoi_padding),
+        .px = TEXTURE_QOI_OPAQUE,
+        .run = 0
+    };
+    memset(dec.index, 0, sizeof(dec.index));
+    for (int i = 0; i < 64; i++)
+        dec.diff[i] = texture_pack_delta(((i >> 4) & 3) - 2, ((i >> 2) & 3) - 2, (i & 3) - 2);
+    size_t stride = (size_t)w * 4;
+    if (!(flags & TEXTURE_FLIP_Y))
+        for (int y = 0; y < h; y++)
+            texture_qoi_decode_span(&dec, (unsigned char*)pixels + (size_t)y * stride, w);
+    else
+        // Flipping is free here, rows are just written bottom up
+        for (int y = h - 1; y >= 0; y--)
+            texture_qoi_decode_span(&dec, (unsigned char*)pixels + (size_t)y * stride, w);
+    return true;
+}
+
+static inline unsigned char* texture_qoi_emit_rgba(unsigned char *out, uint32_t px) {
+    *out++ = QOI_OP_RGBA;
+    texture_store32(out, px);
+    return out + 4;
+}
+
+/* Encodes `count` pixels. The first band starts from the format's initial
+   state and matches the reference encoder byte for byte. Later bands start
+   with an explicit RGBA op and only index colours they have written
+   themselves, so their output is valid whatever the decoder's state. */
+static size_t texture_qoi_encode_band(const unsigned char *pixels, size_t count, int channels, bool first, unsigned char *out) {
+    unsigned char *start = out;
+    uint32_t index[64], prev = TEXTURE_QOI_OPAQUE;
+    uint64_t known = first ? ~0ull : 0;
+    memset(index, 0, sizeof(index));
+    int run = 0;
+    for (size_t i = 0; i < count; i++) {
+        uint32_t px = channels == 4 ? texture_load32(pixels + i * 4) :
+            TEXTURE_QOI_OPAQUE | pixels[i * 3] | pixels[i * 3 + 1] << 8 | (uint32_t)pixels[i * 3 + 2] << 16;
+        if (!first && !i) {
+            index[texture_qoi_hash(px)] = px;
+            known |= 1ull << texture_qoi_hash(px);
+            out = texture_qoi_emit_rgba(out, px);
+            prev = px;
+            continue;
+        }
+        if (px == prev) {
+            if (++run == 62 || i + 1 == count) {
+                *out++ = QOI_OP_RUN | (run - 1);
+                run = 0;
+            }
+            continue;
+        }
+        if (run) {
+            *out++ = QOI_OP_RUN | (run - 1);
+            run = 0;
+        }
+        int hash = texture_qoi_hash(px);
+        if (index[hash] == px && (known >> hash & 1))
+            *out++ = QOI_OP_INDEX | hash;
+        else {
+            index[hash] = px;
+            known |= 1ull << hash;
+            if ((px ^ prev) >> 24)
+                out = texture_qoi_emit_rgba(out, px);
+            else {
+                signed char vr = (signed char)(px - prev);
+                signed char vg = (signed char)((px >> 8) - (prev >> 8));
+                signed char vb = (signed char)((px >> 16) - (prev >> 16));
+                signed char vg_r = vr - vg, vg_b = vb - vg;
+                if ((unsigned)(vr + 2) < 4 && (unsigned)(vg + 2) < 4 && (unsigned)(vb + 2) < 4)
+                    *out++ = QOI_OP_DIFF | (vr + 2) << 4 | (vg + 2) << 2 | (vb + 2);
+                else if ((unsigned)(vg_r + 8) < 16 && (unsigned)(vg + 32) < 64 && (unsigned)(vg_b + 8) < 16) {
+                    *out++ = QOI_OP_LUMA | (vg + 32);
+                    *out++ = (vg_r + 8) << 4 | (vg_b + 8);
+                } else {
+                    *out++ = QOI_OP_RGB;
+                    *out++ = px & 0xFF;
+                    *out++ = (px >> 8) & 0xFF;
+                    *out++ = (px >> 16) & 0xFF;
+                }
+            }
+        }
+        prev = px;
+    }
+    return out - start;
+}
+
+struct texture_qoi_encoder {
+    const unsigned char *pixels;
+    unsigned char *out;
+    size_t pixel_count, band_pixels, band_capacity;
+    int channels;
+    size_t sizes[TEXTURE_LOADER_MAX_THREADS];
+};
+
+static void texture_qoi_encode_job(struct texture_qoi_encoder *enc, int band) {
+    size_t begin = (size_t)band * enc->band_pixels;
+    size_t count = begin + enc->band_pixels > enc->pixel_count ? enc->pixel_count - begin : enc->band_pixels;
+    enc->sizes[band] = texture_qoi_encode_band(enc->pixels + begin * enc->channels, count, enc->channels,
+                                               band == 0, enc->out + (size_t)band * enc->band_capacity);
+}
+
+#ifdef TEXTURE_THREADS
+struct texture_qoi_thread {
+    struct texture_qoi_encoder *enc;
+    int band;
+};
+
+static void* texture_qoi_thread(void *arg) {
+    struct texture_qoi_thread *job = arg;
+    texture_qoi_encode_job(job->enc, job->band);
+    return NULL;
+}
+#endif
+
+void* texture_qoi_encode_parallel(const void *pixels, int width, int height, int channels, int flags, int threads, size_t *size) {
+    if (!pixels || width <= 0 || height <= 0 || (channels != 3 && channels != 4) ||
+        (unsigned)height >= QOI_PIXELS_MAX / (unsigned)width)
+        return NULL;
+#ifdef TEXTURE_THREADS
+    if (threads <= 0)
+        threads = texture_core_count();
+#endif
+    if (threads > TEXTURE_LOADER_MAX_THREADS)
+        threads = TEXTURE_LOADER_MAX_THREADS;
+    if (threads > height)
+        threads = height;
+    if (threads < 1)
+        threads = 1;
+
+    // Bands are whole rows, each written at its worst case offset and then
+    // packed down behind the previous one
+    struct texture_qoi_encoder enc = {
+        .pixels = pixels,
+        .pixel_count = (size_t)width * height,
+        .band_pixels = (size_t)width * ((height + threads - 1) / threads),
+        .channels = channels
+    };
+    threads = (int)((enc.pixel_count + enc.band_pixels - 1) / enc.band_pixels);
+    enc.band_capacity = enc.band_pixels * (channels + 1) + 1;
+    unsigned char *result = malloc(QOI_HEADER_SIZE + enc.band_capacity * threads + sizeof(qoi_padding));
+    if (!result)
+        return NULL;
+    enc.out = result + QOI_HEADER_SIZE;
+
+#ifdef TEXTURE_THREADS
+    pthread_t handles[TEXTURE_LOADER_MAX_THREADS];
+    struct texture_qoi_thread jobs[TEXTURE_LOADER_MAX_THREADS];
+    bool started[TEXTURE_LOADER_MAX_THREADS];
+    for (int i = 0; i < threads; i++) {
+        jobs[i] = (struct texture_qoi_thread){&enc, i};
+        // The calling thread takes the first band itself
+        started[i] = i > 0 && !pthread_create(&handles[i], NULL, texture_qoi_thread, &jobs[i]);
+    }
+    for (int i = 0; i < threads; i++)
+        if (!started[i])
+            texture_qoi_encode_job(&enc, i);
+    for (int i = 1; i < threads; i++)
+        if (started[i])
+            pthread_join(handles[i], NULL);
+#else
+    for (int i = 0; i < threads; i++)
+        texture_qoi_encode_job(&enc, i);
+#endif
+
+    int p = 0;
+    qoi_write_32(result, &p, QOI_MAGIC);
+    qoi_write_32(result, &p, width);
+    qoi_write_32(result, &p, height);
+    result[p++] = channels;
+    result[p++] = flags & TEXTURE_SRGB ? QOI_SRGB : QOI_LINEAR;
+    size_t length = QOI_HEADER_SIZE + enc.sizes[0];
+    for (int i = 1; i < threads; i++) {
+        memmove(result + length, enc.out + (size_t)i * enc.band_capacity, enc.sizes[i]);
+        length += enc.sizes[i];
+    }
+    memcpy(result + length, qoi_padding, sizeof(qoi_padding));
+    length += sizeof(qoi_padding);
+    *size = length;
+    return result;
+}
+
+void* texture_qoi_encode(const void *pixels, int width, int height, int channels, int flags, size_t *size) {
+    return texture_qoi_encode_parallel(pixels, width, height, channels, flags, 1, size);
+}
+
+static inline int texture_level_dim(int size, int level) {
+    return size >> level ? size >> level : 1;
+}
+
+static size_t texture_level_bytes(int width, int height, int level) {
+    return (size_t)texture_level_dim(width, level) * texture_level_dim(height, level) * 4;
+}
+
+static size_t texture_levels_bytes(int width, int height, int first, int last) {
+    size_t total = 0;
+    for (int i = first; i <= last; i++)
+        total += texture_level_bytes(width, height, i);
+    return total;
+}
+
+// 2x2 box filter, safe in place as every write lands behind the reads
+static void texture_downsample(const unsigned char *src, int width, int height, unsigned char *dst) {
+    int w = texture_level_dim(width, 1), h = texture_level_dim(height, 1);
+    for (int y = 0; y < h; y++) {
+        const unsigned char *r0 = src + (size_t)MIN(y * 2, height - 1) * width * 4;
+        const unsigned char *r1 = src + (size_t)MIN(y * 2 + 1, height - 1) * width * 4;
+        for (int x = 0; x < w; x++) {
+            int x0 = MIN(x * 2, width - 1) * 4, x1 = MIN(x * 2 + 1, width - 1) * 4;
+            for (int c = 0; c < 4; c++)
+                dst[((size_t)y * w + x) * 4 + c] = (r0[x0 + c] + r0[x1 + c] + r1[x0 + c] + r1[x1 + c] + 2) >> 2;
+        }
+    }
+}
+
+static unsigned char* texture_decode_memory(const unsigned char *file, size_t size, int flags, int *width, int *height) {
+    if (texture_qoi_info(file, size, width, height)) {
+        unsigned char *pixels = malloc((size_t)*width * *height * 4);
+        if (pixels && !texture_qoi_decode_into(file, size, pixels, *width, *height, flags)) {
+            free(pixels);
+            pixels = NULL;
+        }
+        return pixels;
+    }
+    if (size > INT_MAX)
+        return NULL;
+    int channels;
+    // The thread local setting leaves other users of stb_image alone
+    stbi_set_flip_vertically_on_load_thread(flags & TEXTURE_FLIP_Y ? 1 : 0);
+    return stbi_load_from_memory(file, (int)size, width, height, &channels, 4);
+}
+
+unsigned char* texture_decode_file(const char *path, int flags, int *width, int *height) {
+    size_t size;
+    const unsigned char *file = texture_map_file(path, &size);
+    if (!file)
+        return NULL;
+    unsigned char *pixels = texture_decode_memory(file, size, flags, width, height);
+    texture_unmap_file(file, size);
+    return pixels;
+}
+
+typedef void(*texture_rows_func)(void *ctx, int begin, int end);
+
+#ifdef TEXTURE_THREADS
+struct texture_rows_job {
+    texture_rows_func func;
+    void *ctx;
+    int begin, end;
+};
+
+static void* texture_rows_thread(void *arg) {
+    struct texture_rows_job *job = arg;
+    job->func(job->ctx, job->begin, job->end);
+    return NULL;
+}
+#endif
+
+static void texture_parallel_rows(int rows, int threads, texture_rows_func func, void *ctx) {
+#ifdef TEXTURE_THREADS
+    if (threads <= 0)
+        threads = texture_core_count();
+    threads = MIN(threads, MIN(rows, TEXTURE_LOADER_MAX_THREADS));
+    if (threads > 1) {
+        pthread_t handles[TEXTURE_LOADER_MAX_THREADS];
+        struct texture_rows_job jobs[TEXTURE_LOADER_MAX_THREADS];
+        bool started[TEXTURE_LOADER_MAX_THREADS];
+        int per = (rows + threads - 1) / threads;
+        for (int i = 0; i < threads; i++) {
+            jobs[i] = (struct texture_rows_job){func, ctx, MIN(i * per, rows), MIN((i + 1) * per, rows)};
+            // The calling thread takes the first slice itself
+            started[i] = i > 0 && !pthread_create(&handles[i], NULL, texture_rows_thread, &jobs[i]);
+        }
+        for (int i = 0; i < threads; i++)
+            if (!started[i])
+                func(ctx, jobs[i].begin, jobs[i].end);
+        for (int i = 1; i < threads; i++)
+            if (started[i])
+                pthread_join(handles[i], NULL);
+        return;
+    }
+#else
+    (void)threads;
+#endif
+    func(ctx, 0, rows);
+}
+
+/* BC1 and BC3. Colour endpoints start at the extremes of the block along its
+   principal axis and get one least squares refinement, every texel then
+   takes the closest of the four palette entries. BC3 alpha spans the
+   block's range in the eight value mode. */
+
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGB_S3TC_DXT1_EXT 0x83F0
+#endif
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+#ifndef GL_COMPRESSED_SRGB_S3TC_DXT1_EXT
+#define GL_COMPRESSED_SRGB_S3TC_DXT1_EXT 0x8C4C
+#endif
+#ifndef GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT 0x8C4F
+#endif
+
+#define TEXTURE_BC_FLAGS (TEXTURE_BC1 | TEXTURE_BC3)
+
+size_t texture_bc_size(int width, int height, int flags) {
+    return (size_t)((width + 3) / 4) * ((height + 3) / 4) * (flags & TEXTURE_BC3 ? 16 : 8);
+}
+
+static GLenum texture_bc_format(int flags) {
+    if (flags & TEXTURE_BC3)
+        return flags & TEXTURE_SRGB ? GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT : GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+    return flags & TEXTURE_SRGB ? GL_COMPRESSED_SRGB_S3TC_DXT1_EXT : GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+}
+
+static inline int texture_quantize(float v, int max) {
+    int q = (int)(v * max / 255.f + .5f);
+    return q < 0 ? 0 : q > max ? max : q;
+}
+
+static inline int texture_pack_565(const float *rgb) {
+    return texture_quantize(rgb[0], 31) << 11 | texture_quantize(rgb[1], 63) << 5 | texture_quantize(rgb[2], 31);
+}
+
+static void texture_bc1_palette(int c0, int c1, int palette[4][3]) {
+    int r0 = c0 >> 11, g0 = c0 >> 5 & 63, b0 = c0 & 31;
+    int r1 = c1 >> 11, g1 = c1 >> 5 & 63, b1 = c1 & 31;
+    palette[0][0] = r0 << 3 | r0 >> 2;
+    palette[0][1] = g0 << 2 | g0 >> 4;
+    palette[0][2] = b0 << 3 | b0 >> 2;
+    palette[1][0] = r1 << 3 | r1 >> 2;
+    palette[1][1] = g1 << 2 | g1 >> 4;
+    palette[1][2] = b1 << 3 | b1 >> 2;
+    for (int c = 0; c < 3; c++) {
+        palette[2][c] = (palette[0][c] * 2 + palette[1][c]) / 3;
+        palette[3][c] = (palette[0][c] + palette[1][c] * 2) / 3;
+    }
+}
+
+// Texels are projected onto the line between the endpoints, which picks the
+// same entry as a nearest search unless the block is far off that line
+static uint32_t texture_bc1_indices(const unsigned char *texels, int c0, int c1, int *error) {
+    static const int order[4] = {0, 2, 3, 1};
+    int palette[4][3];
+    texture_bc1_palette(c0, c1, palette);
+    int dir[3] = {palette[1][0] - palette[0][0], palette[1][1] - palette[0][1], palette[1][2] - palette[0][2]};
+    int length = dir[0] * dir[0] + dir[1] * dir[1] + dir[2] * dir[2];
+    uint32_t indices = 0;
+    *error = 0;
+    for (int i = 0; i < 16; i++) {
+        const unsigned char *t = texels + i * 4;
+        int index = 0;
+        if (length) {
+            int d = (t[0] - palette[0][0]) * dir[0] + (t[1] - palette[0][1]) * dir[1] + (t[2] - palette[0][2]) * dir[2];
+            int step = d <= 0 ? 0 : d >= length ? 3 : (d * 6 + length) / (length * 2);
+            index = order[step];
+        }
+        int dr = t[0] - palette[index][0], dg = t[1] - palette[index][1], db = t[2] - palette[index][2];
+        indices |= (uint32_t)index << (i * 2);
+        *error += dr * dr + dg * dg + db * db;
+    }
+    return indices;
+}
+
+// Endpoints minimising the squared error for fixed indices
+static bool texture_bc1_refine(const unsigned char *texels, uint32_t indices, float *e0, float *e1) {
+    static const float weights[4] = {1.f, 0.f, 2.f / 3.f, 1.f / 3.f};
+    float aa = 0.f, bb = 0.f, ab = 0.f, ax[3] = {0}, bx[3] = {0};
+    for (int i = 0; i < 16; i++) {
+        float a = weights[indices >> (i * 2) & 3], b = 1.f - a;
+        aa += a * a;
+        bb += b * b;
+        ab += a * b;
+        for (int c = 0; c < 3; c++) {
+            ax[c] += a * texels[i * 4 + c];
+            bx[c] += b * texels[i * 4 + c];
+        }
+    }
+    float det = aa * bb - ab * ab;
+    if (det < 1e-4f)
+        return false;
+    for (int c = 0; c < 3; c++) {
+        e0[c] = (ax[c] * bb - bx[c] * ab) / det;
+        e1[c] = (bx[c] * aa - ax[c] * ab) / det;
+    }
+    return true;
+}
+
+static void texture_bc1_block(const unsigned char *texels, unsigned char *out) {
+    float mean[3] = {0}, cov[6] = {0};
+    for (int i = 0; i < 16; i++)
+        for (int c = 0; c < 3; c++)
+            mean[c] += texels[i * 4 + c];
+    for (int c = 0; c < 3; c++)
+        mean[c] /= 16.f;
+    for (int i = 0; i < 16; i++) {
+        float r = texels[i * 4] - mean[0], g = texels[i * 4 + 1] - mean[1], b = texels[i * 4 + 2] - mean[2];
+        cov[0] += r * r;
+        cov[1] += r * g;
+        cov[2] += r * b;
+        cov[3] += g * g;
+        cov[4] += g * b;
+        cov[5] += b * b;
+    }
+    // A few rounds of power iteration are plenty for a 3x3 covariance
+    float axis[3] = {1.f, 1.f, 1.f};
+    for (int i = 0; i < 8; i++) {
+        float x = axis[0] * cov[0] + axis[1] * cov[1] + axis[2] * cov[2];
+        float y = axis[0] * cov[1] + axis[1] * cov[3] + axis[2] * cov[4];
+        float z = axis[0] * cov[2] + axis[1] * cov[4] + axis[2] * cov[5];
+        float m = MAX(fabsf(x), MAX(fabsf(y), fabsf(z)));
+        if (m < 1e-3f)
+            break;
+        axis[0] = x / m;
+        axis[1] = y / m;
+        axis[2] = z / m;
+    }
+    int lo = 0, hi = 0;
+    float lo_dot = INFINITY, hi_dot = -INFINITY;
+    for (int i = 0; i < 16; i++) {
+        float d = texels[i * 4] * axis[0] + texels[i * 4 + 1] * axis[1] + texels[i * 4 + 2] * axis[2];
+        if (d < lo_dot) {
+            lo_dot = d;
+            lo = i;
+        }
+        if (d > hi_dot) {
+            hi_dot = d;
+            hi = i;
+        }
+    }
+    float e0[3], e1[3];
+    for (int c = 0; c < 3; c++) {
+        e0[c] = texels[hi * 4 + c];
+        e1[c] = texels[lo * 4 + c];
+    }
+    int c0 = texture_pack_565(e0), c1 = texture_pack_565(e1), error;
+    uint32_t indices = texture_bc1_indices(texels, c0, c1, &error);
+    if (error && texture_bc1_refine(texels, indices, e0, e1)) {
+        int r0 = texture_pack_565(e0), r1 = texture_pack_565(e1), refined_error;
+        uint32_t refined = texture_bc1_indices(texels, r0, r1, &refined_error);
+        if (refined_error < error) {
+            c0 = r0;
+            c1 = r1;
+            indices = refined;
+        }
+    }
+    // Four colour mode needs c0 > c1, swapping the endpoints swaps 0/1 and 2/3
+    if (c0 < c1) {
+        int swap = c0;
+        c0 = c1;
+        c1 = swap;
+        indices ^= 0x55555555u;
+    } else if (c0 == c1)
+        indices = 0;
+    out[0] = c0 & 0xFF;
+    out[1] = c0 >> 8;
+    out[2] = c1 & 0xFF;
+    out[3] = c1 >> 8;
+    for (int i = 0; i < 4; i++)
+        out[4 + i] = indices >> (i * 8) & 0xFF;
+}
+
+static void texture_bc3_alpha_block(const unsigned char *texels, unsigned char *out) {
+    int lo = 255, hi = 0;
+    for (int i = 0; i < 16; i++) {
+        lo = MIN(lo, texels[i * 4 + 3]);
+        hi = MAX(hi, texels[i * 4 + 3]);
+    }
+    out[0] = hi;
+    out[1] = lo;
+    uint64_t bits = 0;
+    if (hi > lo) {
+        int range = hi - lo;
+        for (int i = 0; i < 16; i++) {
+            // Step 0 is a0 (the max), 7 is a1, steps between map to codes 2..7
+            int step = ((hi - texels[i * 4 + 3]) * 14 + range) / (range * 2);
+            int code = step == 0 ? 0 : step == 7 ? 1 : step + 1;
+            bits |= (uint64_t)code << (i * 3);
+        }
+    }
+    for (int i = 0; i < 6; i++)
+        out[2 + i] = bits >> (i * 8) & 0xFF;
+}
+
+struct texture_bc_job {
+    const unsigned char *pixels;
+    unsigned char *out;
+    int width, height, flags;
+};
+
+static void texture_bc_rows(void *ctx, int begin, int end) {
+    struct texture_bc_job *job = ctx;
+    int blocks = (job->width + 3) / 4, block_size = job->flags & TEXTURE_BC3 ? 16 : 8;
+    unsigned char texels[64];
+    for (int by = begin; by < end; by++) {
+        unsigned char *out = job->out + (size_t)by * blocks * block_size;
+        for (int bx = 0; bx < blocks; bx++, out += block_size) {
+            // Edge blocks repeat the last row and column
+            for (int y = 0; y < 4; y++) {
+                const unsigned char *row = job->pixels + (size_t)MIN(by * 4 + y, job->height - 1) * job->width * 4;
+                if (bx * 4 + 4 <= job->width)
+                    memcpy(texels + y * 16, row + bx * 16, 16);
+                else
+                    for (int x = 0; x < 4; x++)
+                        memcpy(texels + y * 16 + x * 4, row + MIN(bx * 4 + x, job->width - 1) * 4, 4);
+            }
+            if (job->flags & TEXTURE_BC3) {
+                texture_bc3_alpha_block(texels, out);
+                texture_bc1_block(texels, out + 8);
+            } else
+                texture_bc1_block(texels, out);
+        }
+    }
+}
+
+static void texture_bc_encode_level(const unsigned char *pixels, int width, int height, int flags, int threads, unsigned char *out) {
+    struct texture_bc_job job = {pixels, out, width, height, flags};
+    texture_parallel_rows((height + 3) / 4, threads, texture_bc_rows, &job);
+}
+
+void* texture_bc_encode(const void *pixels, int width, int height, int flags, int threads, size_t *size) {
+    if (!pixels || width <= 0 || height <= 0)
+        return NULL;
+    size_t bytes = texture_bc_size(width, height, flags);
+    unsigned char *out = malloc(bytes);
+    if (!out)
+        return NULL;
+    texture_bc_encode_level(pixels, width, height, flags, threads, out);
+    *size = bytes;
+    return out;
+}
+
+/* Processed textures (decoded, mipmapped and maybe block compressed) are
+   cached as a 64 byte header, a table with the stored size of every level
+   and then the levels back to back. A hit maps the file and uploads from the
+   mapping, or with QOI encoded levels decodes them straight into the PBO.
+   The name is a hash of the source file's bytes and the flags that shape
+   the result, so a changed source simply misses. */
+
+#define TEXTURE_CACHE_MAGIC 0x43585446u // "FTXC"
+#define TEXTURE_CACHE_VERSION 2
+
+struct texture_cache_header {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t key;
+    // Bytes of level data after the table
+    uint64_t size;
+    uint32_t format;
+    uint32_t encoding;
+    int32_t width, height, levels, flags;
+    unsigned char reserved[16];
+};
+
+static struct {
+    char directory[1024];
+    bool compress;
+} cache;
+
+void texture_cache_directory(const char *path) {
+    if (!path || strlen(path) >= sizeof(cache.directory) - 32)
+        cache.directory[0] = '\0';
+    else
+        strcpy(cache.directory, path);
+}
+
+void texture_cache_compress(bool enabled) {
+    cache.compress = enabled;
+}
+
+static inline uint64_t texture_rotl64(uint64_t v, int n) {
+    return v << n | v >> (64 - n);
+}
+
+// Not cryptographic, four independent lanes keep it near memory speed
+static uint64_t texture_hash(const unsigned char *data, size_t size, uint64_t seed) {
+    const uint64_t k0 = 0x9E3779B97F4A7C15ull, k1 = 0xC2B2AE3D27D4EB4Full;
+    uint64_t lanes[4] = {seed + k0, seed ^ k1, seed, seed - k0};
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32)
+        for (int l = 0; l < 4; l++) {
+            uint64_t v;
+            memcpy(&v, data + i + l * 8, 8);
+            lanes[l] = texture_rotl64(lanes[l] + v * k1, 31) * k0;
+        }
+    uint64_t h = texture_rotl64(lanes[0], 1) + texture_rotl64(lanes[1], 7) +
+                 texture_rotl64(lanes[2], 12) + texture_rotl64(lanes[3], 18) + size;
+    for (; i < size; i++)
+        h = (h ^ data[i]) * 0x100000001B3ull;
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33;
+    return h;
+}
+
+// Bytes of `level` once decoded, i.e. what goes into the PBO
+static size_t texture_processed_level_bytes(const struct texture_processed *processed, int level) {
+    int w = texture_level_dim(processed->width, level), h = texture_level_dim(processed->height, level);
+    return processed->flags & TEXTURE_BC_FLAGS ? texture_bc_size(w, h, processed->flags) : (size_t)w * h * 4;
+}
+
+static void texture_cache_path(char *path, size_t length, uint64_t key, const char *suffix) {
+    snprintf(path, length, "%s/%016llx%s", cache.directory, (unsigned long long)key, suffix);
+}
+
+static bool texture_cache_open(uint64_t key, struct texture_processed *out) {
+    if (!cache.directory[0])
+        return false;
+    char path[sizeof(cache.directory) + 32];
+    texture_cache_path(path, sizeof(path), key, ".ftc");
+    size_t size;
+    const unsigned char *file = texture_map_file(path, &size);
+    if (!file)
+        return false;
+    struct texture_cache_header header;
+    if (size < sizeof(header))
+        goto BAIL;
+    memcpy(&header, file, sizeof(header));
+    size_t table = (size_t)header.levels * sizeof(uint64_t);
+    if (header.magic != TEXTURE_CACHE_MAGIC || header.version != TEXTURE_CACHE_VERSION ||
+        header.key != key || header.width <= 0 || header.height <= 0 ||
+        header.levels <= 0 || header.levels > TEXTURE_MAX_LEVELS ||
+        header.encoding > TEXTURE_ENCODING_QOI || header.size != size - sizeof(header) - table)
+        goto BAIL;
+    *out = (struct texture_processed) {
+        .data = file + sizeof(header) + table,
+        .mapping = file,
+        .mapping_size = size,
+        .size = header.size,
+        .format = header.format,
+        .encoding = header.encoding,
+        .width = header.width,
+        .height = header.height,
+        .levels = header.levels,
+        .flags = header.flags
+    };
+    uint64_t total = 0;
+    for (int i = 0; i < header.levels; i++) {
+        uint64_t stored;
+        memcpy(&stored, file + sizeof(header) + i * sizeof(uint64_t), sizeof(uint64_t));
+        size_t bytes = texture_processed_level_bytes(out, i);
+        if (header.encoding == TEXTURE_ENCODING_RAW && stored != bytes)
+            goto BAIL;
+        out->level_size[i] = (size_t)stored;
+        out->upload_size += bytes;
+        total += stored;
+    }
+    if (total == header.size)
+        return true;
+BAIL:
+    texture_unmap_file(file, size);
+    memset(out, 0, sizeof(struct texture_processed));
+    return false;
+}
+
+static void texture_cache_write(uint64_t key, const struct texture_processed *in) {
+    if (!cache.directory[0])
+        return;
+    struct texture_cache_header header = {
+        .magic = TEXTURE_CACHE_MAGIC,
+        .version = TEXTURE_CACHE_VERSION,
+        .key = key,
+        .size = in->size,
+        .format = in->format,
+        .encoding = TEXTURE_ENCODING_RAW,
+        .width = in->width,
+        .height = in->height,
+        .levels = in->levels,
+        .flags = in->flags
+    };
+    uint64_t table[TEXTURE_MAX_LEVELS];
+    void *encoded[TEXTURE_MAX_LEVELS] = {NULL};
+    const unsigned char *src = in->data;
+    for (int i = 0; i < in->levels; i++)
+        table[i] = in->level_size[i];
+    // Block compressed levels don't shrink any further
+    if (cache.compress && !(in->flags & TEXTURE_BC_FLAGS)) {
+        header.encoding = TEXTURE_ENCODING_QOI;
+        header.size = 0;
+        for (int i = 0; i < in->levels; i++) {
+            size_t size;
+            if (!(encoded[i] = texture_qoi_encode(src, texture_level_dim(in->width, i), texture_level_dim(in->height, i),
+                                                  4, in->flags, &size)))
+                goto BAIL;
+            src += in->level_size[i];
+            table[i] = size;
+            header.size += size;
+        }
+    }
+
+    // Written under a temporary name and renamed, so other threads or
+    // processes never map a partial file
+    char path[sizeof(cache.directory) + 32], temp[sizeof(cache.directory) + 64];
+    texture_cache_path(path, sizeof(path), key, ".ftc");
+    snprintf(temp, sizeof(temp), "%s.%lx.tmp", path, (unsigned long)(uintptr_t)&header);
+    FILE *fh = fopen(temp, "wb");
+    if (!fh)
+        goto BAIL;
+    bool written = fwrite(&header, sizeof(header), 1, fh) == 1 &&
+                   fwrite(table, sizeof(uint64_t), in->levels, fh) == (size_t)in->levels;
+    if (header.encoding == TEXTURE_ENCODING_QOI)
+        for (int i = 0; written && i < in->levels; i++)
+            written = fwrite(encoded[i], 1, table[i], fh) == table[i];
+    else
+        written = written && fwrite(in->data, 1, in->size, fh) == in->size;
+    if (fclose(fh) || !written || rename(temp, path))
+        remove(temp);
+BAIL:
+    for (int i = 0; i < in->levels; i++)
+        free(encoded[i]);
+}
+
+static void texture_processed_free(struct texture_processed *processed) {
+    free(processed->owned);
+    texture_unmap_file(processed->mapping, processed->mapping_size);
+    memset(processed, 0, sizeof(struct texture_processed));
+}
+
+// Maps the result of an earlier run from the cache, or decodes `file`,
+// builds its mip chain and block compresses it as the flags ask and caches that
+static bool texture_process_memory(const unsigned char *file, size_t size, int flags, int threads, struct texture_processed *out) {
+    memset(out, 0, sizeof(struct texture_processed));
+    flags &= TEXTURE_BC_FLAGS | TEXTURE_MIPMAPS | TEXTURE_SRGB | TEXTURE_FLIP_Y;
+    uint64_t key = texture_hash(file, size, (uint64_t)flags << 32 | TEXTURE_CACHE_VERSION);
+    if (texture_cache_open(key, out))
+        return true;
+
+    int width, height;
+    unsigned char *image = texture_decode_memory(file, size, flags, &width, &height);
+    if (!image)
+        return false;
+    *out = (struct texture_processed) {
+        .format = flags & TEXTURE_BC_FLAGS ? texture_bc_format(flags) : flags & TEXTURE_SRGB ? GL_SRGB8_ALPHA8 : GL_RGBA8,
+        .encoding = TEXTURE_ENCODING_RAW,
+        .width = width,
+        .height = height,
+        .levels = 1,
+        .flags = flags
+    };
+    if (flags & TEXTURE_MIPMAPS)
+        while (out->levels < TEXTURE_MAX_LEVELS && MAX(width, height) >> out->levels)
+            out->levels++;
+    for (int i = 0; i < out->levels; i++)
+        out->size += out->level_size[i] = texture_processed_level_bytes(out, i);
+    out->upload_size = out->size;
+    if (!(out->owned = malloc(out->size))) {
+        free(image);
+        memset(out, 0, sizeof(struct texture_processed));
+        return false;
+    }
+    unsigned char *dst = out->owned;
+    for (int i = 0; i < out->levels; i++) {
+        int w = texture_level_dim(width, i), h = texture_level_dim(height, i);
+        if (i)
+            texture_downsample(image, texture_level_dim(width, i - 1), texture_level_dim(height, i - 1), image);
+        if (flags & TEXTURE_BC_FLAGS)
+            texture_bc_encode_level(image, w, h, flags, threads, dst);
+        else
+            memcpy(dst, image, out->level_size[i]);
+        dst += out->level_size[i];
+    }
+    free(image);
+    out->data = out->owned;
+    texture_cache_write(key, out);
+    return true;
+}
+
+// Expands QOI encoded levels into `pixels`, which holds upload_size bytes
+static bool texture_processed_decode(const struct texture_processed *processed, unsigned char *pixels) {
+    const unsigned char *src = processed->data;
+    for (int i = 0; i < processed->levels; i++) {
+        if (!texture_qoi_decode_into(src, processed->level_size[i], pixels,
+                                     texture_level_dim(processed->width, i), texture_level_dim(processed->height, i), 0))
+            return false;
+        src += processed->level_size[i];
+        pixels += texture_processed_level_bytes(processed, i);
+    }
+    return true;
+}
+
+static size_t texture_job_size(struct texture_job *job) {
+    return job->bytes;
+}
+
+static void texture_stream_process(struct texture_job *job);
+
+// Safe to call from any thread, touches no GL state
+static void texture_process(struct texture_job *job) {
+    if (job->stream) {
+        texture_stream_process(job);
+        return;
+    }
+    if (job->pbo) {
+        if (job->processed.data) {
+            job->failed = !texture_processed_decode(&job->processed, job->target);
+            return;
+        }
+        job->failed = !texture_qoi_decode_into(job->file, job->file_size, job->target, job->width, job->height, job->flags);
+        texture_unmap_file(job->file, job->file_size);
+        job->file = NULL;
+        return;
+    }
+    size_t size;
+    const unsigned char *file = texture_map_file(job->path, &size);
+    if (!file) {
+        job->failed = true;
+        return;
+    }
+    bool qoi = texture_qoi_info(file, size, &job->width, &job->height);
+    // QOI sources decode about as fast as a cache hit, they only go through
+    // the cache to be block compressed
+    if ((job->flags & TEXTURE_BC_FLAGS) || (cache.directory[0] && !qoi)) {
+        // Files are already spread over the workers, so each one compresses
+        // its own on a single thread
+        if (texture_process_memory(file, size, job->flags, 1, &job->processed)) {
+            job->width = job->processed.width;
+            job->height = job->processed.height;
+            job->bytes = job->processed.upload_size;
+        } else {
+            job->width = job->height = 0;
+            job->failed = true;
+        }
+        texture_unmap_file(file, size);
+        return;
+    }
+    if (qoi) {
+        // Keep the mapping until there is a PBO to decode into
+        job->file = file;
+        job->file_size = size;
+        job->bytes = (size_t)job->width * job->height * 4;
+        return;
+    }
+    job->pixels = texture_decode_memory(file, size, job->flags, &job->width, &job->height);
+    texture_unmap_file(file, size);
+    if (job->pixels)
+        job->bytes = (size_t)job->width * job->height * 4;
+    else {
+        job->width = job->height = 0;
+        job->failed = true;
+    }
+}
+
+#ifdef TEXTURE_THREADS
+static void* texture_worker(void *arg) {
+    (void)arg;
+    for (;;) {
+        TEXTURE_LOCK();
+        while (!state.quit && !state.staged.head &&
+               (!state.incoming.head || state.decoded_bytes >= TEXTURE_DECODED_LIMIT))
+            pthread_cond_wait(&state.work, &state.lock);
+        if (state.quit) {
+            TEXTURE_UNLOCK();
+            return NULL;
+        }
+        struct texture_job *job = texture_queue_pop(&state.staged);
+        if (!job)
+            job = texture_queue_pop(&state.incoming);
+        TEXTURE_UNLOCK();
+
+        texture_process(job);
+
+        TEXTURE_LOCK();
+        // Staged jobs were counted on their first visit
+        if (job->pbo)
+            texture_queue_push(&state.filled, job);
+        else {
+            state.decoded_bytes += texture_job_size(job);
+            texture_queue_push(&state.decoded, job);
+        }
+        TEXTURE_UNLOCK();
+    }
+}
+
+#else
+// Without workers the render thread does one step of a job per call
+static void texture_pump(void) {
+    struct texture_job *job = texture_queue_pop(&state.staged);
+    if (!job && !(job = texture_queue_pop(&state.incoming)))
+        return;
+    texture_process(job);
+    if (job->pbo)
+        texture_queue_push(&state.filled, job);
+    else {
+        state.decoded_bytes += texture_job_size(job);
+        texture_queue_push(&state.decoded, job);
+    }
+}
+#endif
+
+static void texture_frame(void *userdata) {
+    (void)userdata;
+    texture_loader_poll();
+}
+
+bool texture_loader_init(int threads) {
+    if (state.initialised)
+        return true;
+    memset(&state, 0, sizeof(state));
+#ifdef TEXTURE_THREADS
+    if (threads <= 0)
+        threads = texture_core_count();
+    if (threads > TEXTURE_LOADER_MAX_THREADS)
+        threads = TEXTURE_LOADER_MAX_THREADS;
+    pthread_mutex_init(&state.lock, NULL);
+    pthread_cond_init(&state.work, NULL);
+    for (int i = 0; i < threads; i++)
+        if (!pthread_create(&state.threads[state.thread_count], NULL, texture_worker, NULL))
+            state.thread_count++;
+    if (!state.thread_count) {
+        pthread_cond_destroy(&state.work);
+        pthread_mutex_destroy(&state.lock);
+        return false;
+    }
+#else
+    (void)threads;
+#endif
+    glutAddFrameFunc(texture_frame, NULL);
+    state.initialised = true;
+    return true;
+}
+
+static void texture_stream_orphan(struct texture_job *job);
+
+static void texture_queue_free(struct texture_queue *queue) {
+    struct texture_job *job;
+    while ((job = texture_queue_pop(queue))) {
+        texture_stream_orphan(job);
+        texture_unmap_file(job->file, job->file_size);
+        texture_processed_free(&job->processed);
+        stbi_image_free(job->pixels);
+        free(job);
+    }
+}
+
+void texture_loader_shutdown(void) {
+    if (!state.initialised)
+        return;
+#ifdef TEXTURE_THREADS
+    TEXTURE_LOCK();
+    state.quit = true;
+    TEXTURE_WAKE();
+    TEXTURE_UNLOCK();
+    for (int i = 0; i < state.thread_count; i++)
+        pthread_join(state.threads[i], NULL);
+    pthread_cond_destroy(&state.work);
+    pthread_mutex_destroy(&state.lock);
+#endif
+    texture_queue_free(&state.incoming);
+    texture_queue_free(&state.staged);
+    texture_queue_free(&state.decoded);
+    texture_queue_free(&state.filled);
+    // Deleting a mapped buffer implicitly unmaps it
+    for (int i = 0; i < TEXTURE_PBO_COUNT; i++) {
+        if (state.pbos[i].fence)
+            glDeleteSync(state.pbos[i].fence);
+        if (state.pbos[i].buffer)
+            glDeleteBuffers(1, &state.pbos[i].buffer);
+    }
+    glutRemoveFrameFunc(texture_frame, NULL);
+    memset(&state, 0, sizeof(state));
+}
+
+static struct texture_job* texture_job_new(const char *path, int flags) {
+    if (!path || (!state.initialised && !texture_loader_init(0)))
+        return NULL;
+    size_t length = strlen(path) + 1;
+    struct texture_job *job = malloc(sizeof(struct texture_job) + length);
+    if (!job)
+        return NULL;
+    memset(job, 0, sizeof(struct texture_job));
+    memcpy(job->path, path, length);
+    job->flags = flags;
+    return job;
+}
+
+static void texture_submit(struct texture_job *job) {
+    TEXTURE_LOCK();
+    texture_queue_push(&state.incoming, job);
+    state.pending++;
+#ifdef TEXTURE_THREADS
+    pthread_cond_signal(&state.work);
+#endif
+    TEXTURE_UNLOCK();
+}
+
+bool texture_load_async(const char *path, int flags, texture_callback callback, void *userdata) {
+    struct texture_job *job = texture_job_new(path, flags);
+    if (!job)
+        return false;
+    job->callback = callback;
+    job->userdata = userdata;
+    texture_submit(job);
+    return true;
+}
+
+int texture_loader_pending(void) {
+    return state.pending;
+}
+
+// Returns a PBO whose previous upload has finished, or NULL if all are busy
+static struct texture_pbo* texture_pbo_acquire(void) {
+    for (int i = 0; i < TEXTURE_PBO_COUNT; i++) {
+        struct texture_pbo *pbo = &state.pbos[(state.next_pbo + i) % TEXTURE_PBO_COUNT];
+        if (pbo->mapped)
+            continue;
+        if (pbo->fence) {
+            GLenum status = glClientWaitSync(pbo->fence, 0, 0);
+            if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+                continue;
+            glDeleteSync(pbo->fence);
+            pbo->fence = NULL;
+        }
+        if (!pbo->buffer)
+            glGenBuffers(1, &pbo->buffer);
+        state.next_pbo = (state.next_pbo + i + 1) % TEXTURE_PBO_COUNT;
+        return pbo;
+    }
+    return NULL;
+}
+
+// Binds `pbo` and maps `size` bytes of it for writing
+static void* texture_pbo_map(struct texture_pbo *pbo, GLsizeiptr size) {
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo->buffer);
+    if (size > pbo->capacity) {
+        glBufferData(GL_PIXEL_UNPACK_BUFFER, size, NULL, GL_STREAM_DRAW);
+        pbo->capacity = size;
+    }
+    // The fence already proved the GPU is done with the old contents
+    return glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size,
+                            GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+}
+
+// `pixels` is either client memory or an offset into the bound unpack buffer
+static GLuint texture_create(const void *pixels, int width, int height, int flags) {
+    GLint previous;
+    GLuint texture;
+    glGetIntegerv(GL_TEXTURE_BINDING_2D, &previous);
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, flags & TEXTURE_MIPMAPS ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexImage2D(GL_TEXTURE_2D, 0, flags & TEXTURE_SRGB ? GL_SRGB8_ALPHA8 : GL_RGBA8,
+                 width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    if (flags & TEXTURE_MIPMAPS)
+        glGenerateMipmap(GL_TEXTURE_2D);
+    glBindTexture(GL_TEXTURE_2D, previous);
+    return texture;
+}
+
+// `data` is client memory holding the expanded levels, or NULL to read
+// them from the bound unpack buffer
+static GLuint texture_create_processed(const struct texture_processed *processed, const unsigned char *data) {
+    GLint previous;
+    GLuint texture;
+    glGetIntegerv(GL_TEXTURE_BINDING_2D, &previous);
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, processed->levels > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, processed->levels - 1);
+    size_t offset = 0;
+    for (int i = 0; i < processed->levels; i++) {
+        int w = texture_level_dim(processed->width, i), h = texture_level_dim(processed->height, i);
+        size_t size = texture_processed_level_bytes(processed, i);
+        const void *pixels = data ? (const void*)(data + offset) : (const void*)offset;
+        if (processed->flags & TEXTURE_BC_FLAGS)
+            glCompressedTexImage2D(GL_TEXTURE_2D, i, processed->format, w, h, 0, (GLsizei)size, pixels);
+        else
+            glTexImage2D(GL_TEXTURE_2D, i, processed->format, w, h, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+        offset += size;
+    }
+    glBindTexture(GL_TEXTURE_2D, previous);
+    return texture;
+}
+
+// Without a PBO, encoded levels are expanded on the heap first
+static GLuint texture_create_processed_client(const struct texture_processed *processed) {
+    if (processed->encoding == TEXTURE_ENCODING_RAW)
+        return texture_create_processed(processed, processed->data);
+    unsigned char *pixels = malloc(processed->upload_size);
+    GLuint texture = 0;
+    if (pixels && texture_processed_decode(processed, pixels))
+        texture = texture_create_processed(processed, pixels);
+    free(pixels);
+    return texture;
+}
+
+// Unmaps the PBO (bound by the caller) and creates the job's texture from it
+static GLuint texture_create_from_pbo(struct texture_pbo *pbo, struct texture_job *job, bool filled) {
+    pbo->mapped = false;
+    GLuint texture = 0;
+    if (glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER) && filled) {
+        if (job->processed.data)
+            texture = texture_create_processed(&job->processed, NULL);
+        else
+            texture = texture_create(NULL, job->width, job->height, job->flags);
+        pbo->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    return texture;
+}
+
+static void texture_job_release(struct texture_job *job) {
+    TEXTURE_LOCK();
+    state.decoded_bytes -= texture_job_size(job);
+    TEXTURE_WAKE();
+    TEXTURE_UNLOCK();
+    state.pending--;
+    texture_unmap_file(job->file, job->file_size);
+    texture_processed_free(&job->processed);
+    stbi_image_free(job->pixels);
+    free(job);
+}
+
+static void texture_complete(struct texture_job *job, GLuint texture) {
+    if (!texture)
+        job->width = job->height = 0;
+    if (job->callback)
+        job->callback(texture, job->width, job->height, job->userdata);
+    texture_job_release(job);
+}
+
+static void texture_stream_update(void);
+static bool texture_stream_complete(struct texture_job *job);
+
+int texture_loader_poll(void) {
+    if (!state.initialised)
+        return 0;
+    texture_stream_update();
+    size_t uploaded = 0;
+    while (uploaded < TEXTURE_UPLOAD_BUDGET) {
+#ifndef TEXTURE_THREADS
+        texture_pump();
+#endif
+        TEXTURE_LOCK();
+        struct texture_job *job = texture_queue_pop(&state.filled);
+        if (!job)
+            job = texture_queue_pop(&state.decoded);
+        TEXTURE_UNLOCK();
+        if (!job)
+            break;
+
+        if (job->stream) {
+            size_t size = texture_job_size(job);
+            if (!texture_stream_complete(job)) {
+                TEXTURE_LOCK();
+                texture_queue_push_front(&state.decoded, job);
+                TEXTURE_UNLOCK();
+                break;
+            }
+            uploaded += size;
+            continue;
+        }
+
+        if (job->pbo) {
+            // Back from the workers with the pixels already in the PBO
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, job->pbo->buffer);
+            GLuint texture = texture_create_from_pbo(job->pbo, job, !job->failed);
+            uploaded += texture_job_size(job);
+            texture_complete(job, texture);
+            continue;
+        }
+        if (job->failed) {
+            texture_complete(job, 0);
+            continue;
+        }
+
+        struct texture_pbo *pbo = texture_pbo_acquire();
+        if (!pbo) {
+            TEXTURE_LOCK();
+            texture_queue_push_front(&state.decoded, job);
+            TEXTURE_UNLOCK();
+            break;
+        }
+        GLsizeiptr size = (GLsizeiptr)texture_job_size(job);
+        void *dst = texture_pbo_map(pbo, size);
+        if (!dst) {
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            if (job->processed.data)
+                texture_complete(job, texture_create_processed_client(&job->processed));
+            else
+                texture_complete(job, job->pixels ? texture_create(job->pixels, job->width, job->height, job->flags) : 0);
+            continue;
+        }
+        if (job->pixels || (job->processed.data && job->processed.encoding == TEXTURE_ENCODING_RAW)) {
+            memcpy(dst, job->pixels ? job->pixels : job->processed.data, size);
+            uploaded += size;
+            texture_complete(job, texture_create_from_pbo(pbo, job, true));
+            continue;
+        }
+        // A QOI header or encoded levels, give the mapped buffer back to the
+        // workers to decode into
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        pbo->mapped = true;
+        job->pbo = pbo;
+        job->target = dst;
+        TEXTURE_LOCK();
+        texture_queue_push(&state.staged, job);
+        TEXTURE_WAKE();
+        TEXTURE_UNLOCK();
+    }
+    return state.pending;
+}
+
+GLuint texture_load(const char *path, int flags, int *width, int *height) {
+    int w = 0, h = 0;
+    GLuint texture = 0;
+    size_t size = 0;
+    const unsigned char *file = texture_map_file(path, &size);
+    if (file && ((flags & TEXTURE_BC_FLAGS) || (cache.directory[0] && !texture_qoi_info(file, size, &w, &h)))) {
+        struct texture_processed processed;
+        if (texture_process_memory(file, size, flags, 0, &processed)) {
+            texture = texture_create_processed_client(&processed);
+            w = processed.width;
+            h = processed.height;
+            texture_processed_free(&processed);
+        }
+    } else if (file) {
+        unsigned char *pixels = texture_decode_memory(file, size, flags, &w, &h);
+        if (pixels)
+            texture = texture_create(pixels, w, h, flags);
+        free(pixels);
+    }
+    texture_unmap_file(file, size);
+    if (width)
+        *width = texture ? w : 0;
+    if (height)
+        *height = texture ? h : 0;
+    return texture;
+}
+
+/* Streaming. Each stream owns a texture whose mip tail (levels no larger
+   than TEXTURE_STREAM_TAIL) stays resident, finer levels are loaded when a
+   frame asks for them and dropped again by GL_TEXTURE_BASE_LEVEL when the
+   budget runs out. Streams sit in a list ordered by their last request, so
+   the ones requested this frame are always at the front and the eviction
+   candidates at the back. */
+
+struct texture_stream {
+    struct texture_stream *prev, *next;
+    GLuint texture;
+    int flags;
+    int width, height;
+    int levels;
+    // First level of the always resident tail
+    int tail;
+    // Finest resident level, `levels` until the tail has arrived
+    int base;
+    // Finest level requested during `frame`
+    int requested;
+    unsigned int frame;
+    // Bytes reserved for the levels being loaded
+    size_t reserved;
+    bool loading;
+    bool destroyed;
+    char path[];
+};
+
+static struct {
+    struct texture_stream *head, *tail;
+    size_t budget;
+    size_t resident;
+    // Bytes of levels being loaded, reserved against the budget
+    size_t loading;
+    unsigned int frame;
+} streams = {
+    .head = NULL,
+    .tail = NULL,
+    .budget = TEXTURE_STREAM_BUDGET,
+    .resident = 0,
+    .loading = 0,
+    .frame = 1
+};
+
+static void texture_stream_process(struct texture_job *job) {
+    int width, height;
+    unsigned char *image = texture_decode_file(job->path, job->flags, &width, &height);
+    if (!image) {
+        job->failed = true;
+        return;
+    }
+    int max = MAX(width, height), levels = 1, tail = 0;
+    while (max >> levels)
+        levels++;
+    while (tail < levels - 1 && MAX(texture_level_dim(width, tail), texture_level_dim(height, tail)) > TEXTURE_STREAM_TAIL)
+        tail++;
+    if (job->first_level < 0) {
+        // First visit, the stream doesn't know its size yet
+        job->first_level = tail;
+        job->last_level = levels - 1;
+    } else if (width != job->width || height != job->height || job->last_level >= levels) {
+        // The file changed underneath the stream
+        stbi_image_free(image);
+        job->failed = true;
+        return;
+    }
+    job->width = width;
+    job->height = height;
+    job->bytes = texture_levels_bytes(width, height, job->first_level, job->last_level);
+    if (!(job->pixels = malloc(job->bytes))) {
+        stbi_image_free(image);
+        job->bytes = 0;
+        job->failed = true;
+        return;
+    }
+    unsigned char *out = job->pixels;
+    for (int i = 0; i <= job->last_level; i++) {
+        if (i)
+            texture_downsample(image, texture_level_dim(width, i - 1), texture_level_dim(height, i - 1), image);
+        if (i >= job->first_level) {
+            size_t size = texture_level_bytes(width, height, i);
+            memcpy(out, image, size);
+            out += size;
+        }
+    }
+    stbi_image_free(image);
+}
+
+static void texture_stream_unlink(struct texture_stream *stream) {
+    if (stream->prev)
+        stream->prev->next = stream->next;
+    else
+        streams.head = stream->next;
+    if (stream->next)
+        stream->next->prev = stream->prev;
+    else
+        streams.tail = stream->prev;
+    stream->prev = stream->next = NULL;
+}
+
+static void texture_stream_link_front(struct texture_stream *stream) {
+    stream->prev = NULL;
+    stream->next = streams.head;
+    if (streams.head)
+        streams.head->prev = stream;
+    else
+        streams.tail = stream;
+    streams.head = stream;
+}
+
+static void texture_stream_link_back(struct texture_stream *stream) {
+    stream->next = NULL;
+    stream->prev = streams.tail;
+    if (streams.tail)
+        streams.tail->next = stream;
+    else
+        streams.head = stream;
+    streams.tail = stream;
+}
+
+static void texture_stream_unreserve(struct texture_stream *stream) {
+    streams.loading -= stream->reserved;
+    stream->reserved = 0;
+    stream->loading = false;
+}
+
+static bool texture_stream_load(struct texture_stream *stream, int first, int last) {
+    struct texture_job *job = texture_job_new(stream->path, stream->flags);
+    if (!job)
+        return false;
+    job->stream = stream;
+    job->width = stream->width;
+    job->height = stream->height;
+    job->first_level = first;
+    job->last_level = last;
+    stream->loading = true;
+    if (first >= 0) {
+        stream->reserved = texture_levels_bytes(stream->width, stream->height, first, last);
+        streams.loading += stream->reserved;
+    }
+    texture_submit(job);
+    return true;
+}
+
+struct texture_stream* texture_stream_create(const char *path, int flags) {
+    if (!path)
+        return NULL;
+    size_t length = strlen(path) + 1;
+    struct texture_stream *stream = malloc(sizeof(struct texture_stream) + length);
+    if (!stream)
+        return NULL;
+    memset(stream, 0, sizeof(struct texture_stream));
+    memcpy(stream->path, path, length);
+    stream->flags = flags & ~TEXTURE_BC_FLAGS;
+    stream->requested = INT_MAX;
+    // Never requested so it goes to the back, the front of the list is
+    // reserved for streams requested this frame
+    texture_stream_link_back(stream);
+    if (!texture_stream_load(stream, -1, -1)) {
+        texture_stream_unlink(stream);
+        free(stream);
+        return NULL;
+    }
+    return stream;
+}
+
+void texture_stream_destroy(struct texture_stream *stream) {
+    if (!stream)
+        return;
+    texture_stream_unlink(stream);
+    if (stream->texture) {
+        glDeleteTextures(1, &stream->texture);
+        streams.resident -= texture_levels_bytes(stream->width, stream->height, stream->base, stream->levels - 1);
+        stream->texture = 0;
+    }
+    streams.loading -= stream->reserved;
+    stream->reserved = 0;
+    // An in flight job still points at the stream, it frees it on completion
+    if (stream->loading)
+        stream->destroyed = true;
+    else
+        free(stream);
+}
+
+void texture_stream_request(struct texture_stream *stream, float lod) {
+    if (!stream)
+        return;
+    int level = lod > 0.f ? (int)lod : 0;
+    if (stream->frame != streams.frame) {
+        stream->frame = streams.frame;
+        stream->requested = level;
+    } else if (level < stream->requested)
+        stream->requested = level;
+    if (stream != streams.head) {
+        texture_stream_unlink(stream);
+        texture_stream_link_front(stream);
+    }
+}
+
+GLuint texture_stream_texture(const struct texture_stream *stream) {
+    return stream ? stream->texture : 0;
+}
+
+int texture_stream_level(const struct texture_stream *stream) {
+    return stream && stream->texture ? stream->base : -1;
+}
+
+void texture_stream_budget(size_t bytes) {
+    streams.budget = bytes;
+}
+
+size_t texture_stream_resident(void) {
+    return streams.resident;
+}
+
+static void texture_stream_set_base(struct texture_stream *stream, int base) {
+    GLint previous;
+    glGetIntegerv(GL_TEXTURE_BINDING_2D, &previous);
+    glBindTexture(GL_TEXTURE_2D, stream->texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, base);
+    // Respecifying a level as 0x0 releases its storage, the levels below
+    // the base don't take part in completeness so the texture stays usable
+    for (int i = stream->base; i < base; i++)
+        glTexImage2D(GL_TEXTURE_2D, i, stream->flags & TEXTURE_SRGB ? GL_SRGB8_ALPHA8 : GL_RGBA8,
+                     0, 0, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    glBindTexture(GL_TEXTURE_2D, previous);
+    if (base > stream->base)
+        streams.resident -= texture_levels_bytes(stream->width, stream->height, stream->base, base - 1);
+    stream->base = base;
+}
+
+// Drops the finest level of the least recently used streams until `need`
+// more bytes fit, streams requested this frame are never touched
+static bool texture_stream_make_room(size_t need) {
+    struct texture_stream *victim = streams.tail;
+    while (streams.resident + streams.loading + need > streams.budget) {
+        while (victim && (victim->frame == streams.frame || victim->loading ||
+                          !victim->texture || victim->base >= victim->tail))
+            victim = victim->prev;
+        if (!victim)
+            return false;
+        texture_stream_set_base(victim, victim->base + 1);
+    }
+    return true;
+}
+
+static void texture_stream_update(void) {
+    for (struct texture_stream *stream = streams.head; stream && stream->frame == streams.frame; stream = stream->next) {
+        if (stream->loading || !stream->texture)
+            continue;
+        int target = MIN(stream->requested, stream->tail);
+        while (target < stream->base &&
+               !texture_stream_make_room(texture_levels_bytes(stream->width, stream->height, target, stream->base - 1)))
+            target++;
+        if (target < stream->base)
+            texture_stream_load(stream, target, stream->base - 1);
+    }
+    streams.frame++;
+}
+
+static bool texture_stream_complete(struct texture_job *job) {
+    struct texture_stream *stream = job->stream;
+    if (stream->destroyed || job->failed) {
+        texture_stream_unreserve(stream);
+        if (stream->destroyed)
+            free(stream);
+        texture_job_release(job);
+        return true;
+    }
+    struct texture_pbo *pbo = texture_pbo_acquire();
+    if (!pbo)
+        return false;
+
+    GLint previous;
+    glGetIntegerv(GL_TEXTURE_BINDING_2D, &previous);
+    if (!stream->texture) {
+        stream->width = job->width;
+        stream->height = job->height;
+        stream->levels = job->last_level + 1;
+        stream->tail = job->first_level;
+        stream->base = stream->levels;
+        glGenTextures(1, &stream->texture);
+        glBindTexture(GL_TEXTURE_2D, stream->texture);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, stream->levels - 1);
+    } else
+        glBindTexture(GL_TEXTURE_2D, stream->texture);
+
+    const unsigned char *source = job->pixels;
+    void *dst = texture_pbo_map(pbo, (GLsizeiptr)job->bytes);
+    if (dst) {
+        memcpy(dst, job->pixels, job->bytes);
+        if (glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER))
+            source = NULL;
+    }
+    if (source)
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    size_t offset = 0;
+    for (int i = job->first_level; i <= job->last_level; i++) {
+        glTexImage2D(GL_TEXTURE_2D, i, stream->flags & TEXTURE_SRGB ? GL_SRGB8_ALPHA8 : GL_RGBA8,
+                     texture_level_dim(stream->width, i), texture_level_dim(stream->height, i), 0,
+                     GL_RGBA, GL_UNSIGNED_BYTE, source ? (const void*)(source + offset) : (const void*)offset);
+        offset += texture_level_bytes(stream->width, stream->height, i);
+    }
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, job->first_level);
+    if (!source)
+        pbo->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    glBindTexture(GL_TEXTURE_2D, previous);
+
+    streams.resident += job->bytes;
+    stream->base = job->first_level;
+    texture_stream_unreserve(stream);
+    texture_job_release(job);
+    return true;
+}
+
+// Jobs dropped by texture_loader_shutdown leave their streams idle
+static void texture_stream_orphan(struct texture_job *job) {
+    struct texture_stream *stream = job->stream;
+    if (!stream)
+        return;
+    texture_stream_unreserve(stream);
+    if (stream->destroyed)
+        free(stream);
+}
@@ -0,0 +1,167 @@
+/* gltexture.h --  https://github.com/takeiteasy/fungl
+
+ fungl puts the fun back into OpenGL
+
+ Copyright (C) 2024  George Watson
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+ Asynchronous texture loading. Files are memory mapped and decoded by a
+ pool of worker threads, so the render thread only hands out a small ring of
+ pixel buffer objects and issues glTexImage2D from them. QOI images are
+ decoded by the workers straight into a mapped PBO; everything else goes
+ through stb_image and is copied in. Uploads are capped at TEXTURE_UPLOAD_BUDGET
+ bytes per frame and completion callbacks run on the render thread from
+ texture_loader_poll, which glutMainLoop calls once per frame. Programs that
+ drive their own loop call texture_loader_poll themselves.
+
+    texture_load_async("grass.png", TEXTURE_MIPMAPS, on_loaded, &material);
+
+ Every image is expanded to RGBA8, unless TEXTURE_BC1 or TEXTURE_BC3 ask for
+ it to be block compressed to an eighth or a quarter of that. With a cache
+ directory set, the processed result of a load (decoded, with its mip chain
+ built on the CPU and compressed if asked for) is written to disk under a
+ hash of the source file. Later runs map that file and upload from it
+ without touching the decoder. QOI sources skip the cache unless they are
+ block compressed, they decode about as fast as a cache hit.
+
+    texture_cache_directory("cache");
+    texture_load_async("rock.png", TEXTURE_BC1 | TEXTURE_MIPMAPS, on_loaded, NULL);
+
+ Streams keep large textures within a memory budget. Only the mip tail
+ (levels up to TEXTURE_STREAM_TAIL texels) stays resident; every frame the
+ renderer reports the finest level it needs and the missing levels are
+ decoded in the background. When the budget is exceeded the finest levels of
+ the least recently requested streams are dropped again.
+
+    struct texture_stream *rock = texture_stream_create("rock.qoi", 0);
+    ...
+    texture_stream_request(rock, lod);  // e.g. from textureQueryLod feedback
+    glBindTexture(GL_TEXTURE_2D, texture_stream_texture(rock)); */
+
+#if !defined(gltexture_h) && !defined(FUNGL_NO_TEXTURE)
+#define gltexture_h
+#if defined(__cplusplus)
+extern "C" {
+#endif
+#include "gl.h"
+#if FUNGL_VERSION < GL_VERSION_3_2
+#error "gltexture.h requires FUNGL_VERSION >= GL_VERSION_3_2"
+#endif
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifndef TEXTURE_LOADER_MAX_THREADS
+#define TEXTURE_LOADER_MAX_THREADS 16
+#endif
+// Pixel buffer objects in flight, a buffer is reused once its fence signals
+#ifndef TEXTURE_PBO_COUNT
+#define TEXTURE_PBO_COUNT 4
+#endif
+// Bytes copied into PBOs per texture_loader_poll, at least one image is
+// always uploaded so larger textures still make progress
+#ifndef TEXTURE_UPLOAD_BUDGET
+#define TEXTURE_UPLOAD_BUDGET (16 << 20)
+#endif
+// Workers stop decoding while this many decoded bytes wait for upload
+#ifndef TEXTURE_DECODED_LIMIT
+#define TEXTURE_DECODED_LIMIT (256 << 20)
+#endif
+
+// Largest mip level (in texels) that is always resident for a stream
+#ifndef TEXTURE_STREAM_TAIL
+#define TEXTURE_STREAM_TAIL 128
+#endif
+// Default for texture_stream_budget
+#ifndef TEXTURE_STREAM_BUDGET
+#define TEXTURE_STREAM_BUDGET (512 << 20)
+#endif
+
+enum texture_flags {
+    TEXTURE_MIPMAPS = 1,
+    TEXTURE_SRGB = 2,
+    TEXTURE_FLIP_Y = 4,
+    // Block compress on load, BC1 drops alpha. Needs EXT_texture_compression_s3tc.
+    TEXTURE_BC1 = 8,
+    TEXTURE_BC3 = 16
+};
+
+// `texture` is 0 (and the size 0x0) if the file couldn't be read or decoded
+typedef void(*texture_callback)(GLuint texture, int width, int height, void *userdata);
+
+// `threads` <= 0 uses one per core. Called implicitly by the first
+// texture_load_async, and registers texture_loader_poll as a glut frame func
+bool texture_loader_init(int threads);
+// Joins the workers and releases the PBOs, outstanding loads are dropped
+// without calling their callbacks
+void texture_loader_shutdown(void);
+// Queues `path` for decoding, the callback is invoked from texture_loader_poll
+bool texture_load_async(const char *path, int flags, texture_callback callback, void *userdata);
+// Uploads finished images and fires their callbacks. Must be called on the
+// thread owning the GL context. Returns the number of loads still pending.
+int texture_loader_poll(void);
+int texture_loader_pending(void);
+// Decodes and uploads on the calling thread, returns 0 on failure
+GLuint texture_load(const char *path, int flags, int *width, int *height);
+
+struct texture_stream;
+
+// The texture is 0 until the mip tail has loaded. TEXTURE_MIPMAPS is implied,
+// streams are always RGBA8 so TEXTURE_BC1/TEXTURE_BC3 are ignored.
+struct texture_stream* texture_stream_create(const char *path, int flags);
+void texture_stream_destroy(struct texture_stream *stream);
+// Reports that `lod` (0 is full resolution) was needed this frame, the
+// finest level requested between two polls is streamed in
+void texture_stream_request(struct texture_stream *stream, float lod);
+GLuint texture_stream_texture(const struct texture_stream *stream);
+// Finest resident level, -1 until the tail has loaded
+int texture_stream_level(const struct texture_stream *stream);
+// Bytes of texture memory all streams together may keep resident, tails
+// are always kept even when they alone exceed it
+void texture_stream_budget(size_t bytes);
+size_t texture_stream_resident(void);
+
+// Read-only mapping of a whole file, NULL if it can't be opened or is empty
+const void* texture_map_file(const char *path, size_t *size);
+void texture_unmap_file(const void *data, size_t size);
+// Decodes a mapped file to RGBA8 without reading it through stdio,
+// release the result with free()
+unsigned char* texture_decode_file(const char *path, int flags, int *width, int *height);
+bool texture_qoi_info(const void *data, size_t size, int *width, int *height);
+// Decodes a QOI image into caller memory (e.g. a mapped PBO) as RGBA8,
+// `width` and `height` must match the header. Only TEXTURE_FLIP_Y is used.
+bool texture_qoi_decode_into(const void *data, size_t size, void *pixels, int width, int height, int flags);
+// Encodes RGB8 or RGBA8 pixels, the output is byte for byte what the
+// reference encoder produces. TEXTURE_SRGB sets the colorspace, release
+// the result with free().
+void* texture_qoi_encode(const void *pixels, int width, int height, int channels, int flags, size_t *size);
+// Encodes bands of rows on `threads` threads (<= 0 uses one per core). The
+// stream is valid QOI for any decoder, each band just costs a few extra bytes.
+void* texture_qoi_encode_parallel(const void *pixels, int width, int height, int channels, int flags, int threads, size_t *size);
+// Bytes of one BC1 or BC3 (picked by `flags`) level
+size_t texture_bc_size(int width, int height, int flags);
+// Block compresses RGBA8 pixels on `threads` threads (<= 0 uses one per
+// core), rows of blocks are split between them. Release with free().
+void* texture_bc_encode(const void *pixels, int width, int height, int flags, int threads, size_t *size);
+// Where processed textures are cached, NULL (the default) turns the cache
+// off. Set it before queueing loads, the directory has to exist.
+void texture_cache_directory(const char *path);
+// Store RGBA8 levels QOI encoded, usually half the size or less for the
+// cost of a decode into the PBO on every hit. Off by default.
+void texture_cache_compress(bool enabled);
+
+#if defined(__cplusplus)
+}
+#endif
+#endif /* gltexture_h */
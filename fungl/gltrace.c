@@ -0,0 +1,1192 @@
+/* gltrace.c --  https://github.com/takeiteasy/fungl
+
+ fungl puts the fun back into OpenGL
+
+ Copyright (C) 2024  George Watson
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+#include "gltrace.h"
+#include "glut.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/* A trace is a header followed by packets. Each starts with a varint id:
+   a zero byte is padding, then come the end of a frame, a write through a
+   mapped buffer and the commands in gltrace_calls.h. Unsigned arguments
+   are LEB128 varints, signed ones zigzag encoded, floats raw. Arrays and
+   strings are a varint tag followed by their bytes, aligned to their
+   element size relative to the start of the file. */
+
+#define TRACE_MAGIC "FGLT"
+#define TRACE_FORMAT 1
+
+enum {
+    TRACE_PACKET_PAD = 0,
+    TRACE_PACKET_FRAME,
+    TRACE_PACKET_MEMORY,
+    TRACE_FIRST_COMMAND
+};
+
+enum trace_name_class {
+    TRACE_NAME_BUFFER,
+    TRACE_NAME_TEXTURE,
+    TRACE_NAME_FRAMEBUFFER,
+    TRACE_NAME_RENDERBUFFER,
+    TRACE_NAME_PROGRAM,
+    TRACE_NAME_QUERY,
+    TRACE_NAME_SAMPLER,
+    TRACE_NAME_VERTEX_ARRAY,
+    TRACE_NAME_TRANSFORM_FEEDBACK,
+    TRACE_NAME_PROGRAM_PIPELINE,
+    TRACE_NAME_DISPLAY_LIST
+};
+
+// Sized to keep what follows 8 byte aligned
+struct trace_header {
+    char magic[4];
+    uint32_t format;
+    uint32_t hash;
+    uint32_t commands;
+    int32_t frames;
+    uint32_t reserved;
+};
+
+#define TRACE_GROW(ARRAY, COUNT, CAPACITY, NEEDED)                                \
+    do {                                                                          \
+        if ((COUNT) + (NEEDED) > (CAPACITY)) {                                    \
+            size_t capacity = (CAPACITY) ? (CAPACITY) : 4096;                     \
+            while (capacity < (COUNT) + (NEEDED))                                 \
+                capacity *= 2;                                                    \
+            void *grown = realloc((ARRAY), capacity * sizeof(*(ARRAY)));          \
+            if (!grown)                                                           \
+                abort();                                                          \
+            (ARRAY) = grown;                                                      \
+            (CAPACITY) = capacity;                                                \
+        }                                                                         \
+    } while (0)
+
+struct trace_buffer {
+    unsigned char *data;
+    size_t size, capacity;
+};
+
+// A buffer range mapped for writing while capturing
+struct trace_mapping {
+    GLuint buffer;
+    GLintptr offset;
+    GLsizeiptr length;
+    GLbitfield access;
+    unsigned char *ptr;
+    // What the trace has of a persistent mapping's contents so far
+    unsigned char *shadow;
+    // Mapped during the current frame
+    bool fresh;
+};
+
+static struct {
+    bool capturing, registered;
+    FILE *file;
+    int frames;
+    // Calls of the current frame, and pages of persistent mappings
+    struct trace_buffer frame, pages;
+    // Where trace_write_* append to
+    struct trace_buffer *out;
+    struct trace_mapping *mappings;
+    size_t mapping_count, mapping_capacity;
+} state;
+
+// Open addressing hash from 64 bit keys (never 0) to 64 bit values
+struct trace_map {
+    uint64_t *keys, *values;
+    size_t count, capacity;
+};
+
+// A buffer range mapped while replaying
+struct trace_replay_mapping {
+    GLuint buffer;
+    GLintptr offset;
+    GLsizeiptr length;
+    unsigned char *ptr;
+};
+
+struct trace_reader {
+    const unsigned char *base, *position, *end;
+    const char *error;
+    // Program in use, uniform locations are remapped per program
+    GLuint program;
+    struct trace_map names, locations, syncs;
+    // Bump allocated memory for one call's arguments, calls that need more
+    // than fits get blocks of their own
+    unsigned char *scratch;
+    size_t scratch_used, scratch_capacity;
+    void **blocks;
+    size_t block_count, block_capacity;
+    struct trace_replay_mapping *mappings;
+    size_t mapping_count, mapping_capacity;
+    char message[128];
+};
+
+struct trace_replay {
+    struct trace_reader reader;
+    const void *file;
+    size_t size;
+    int frames, replayed;
+    size_t calls;
+};
+
+static void trace_reserve(struct trace_buffer *buffer, size_t size) {
+    TRACE_GROW(buffer->data, buffer->size, buffer->capacity, size);
+}
+
+static void trace_put(struct trace_buffer *buffer, const void *data, size_t size) {
+    trace_reserve(buffer, size);
+    memcpy(buffer->data + buffer->size, data, size);
+    buffer->size += size;
+}
+
+static void trace_put_uint(struct trace_buffer *buffer, uint64_t value) {
+    trace_reserve(buffer, 10);
+    unsigned char *p = buffer->data + buffer->size;
+    while (value >= 0x80) {
+        *p++ = (unsigned char)(value | 0x80);
+        value >>= 7;
+    }
+    *p++ = (unsigned char)value;
+    buffer->size = p - buffer->data;
+}
+
+// Buffers are written out at 8 byte aligned offsets, so aligning within a
+// buffer aligns within the file
+static void trace_align(struct trace_buffer *buffer, size_t align) {
+    size_t pad = (align - buffer->size % align) % align;
+    if (!pad)
+        return;
+    trace_reserve(buffer, pad);
+    memset(buffer->data + buffer->size, 0, pad);
+    buffer->size += pad;
+}
+
+static void trace_flush(struct trace_buffer *buffer) {
+    trace_align(buffer, 8);
+    if (buffer->size)
+        fwrite(buffer->data, 1, buffer->size, state.file);
+    buffer->size = 0;
+}
+
+static void trace_command(uint64_t command) {
+    if (state.out == &state.frame && state.frame.size > TRACE_FRAME_BUFFER)
+        trace_flush(&state.frame);
+    trace_put_uint(state.out, command);
+}
+
+static void trace_write_uint(uint64_t value) {
+    trace_put_uint(state.out, value);
+}
+
+static void trace_write_int(int64_t value) {
+    trace_put_uint(state.out, ((uint64_t)value << 1) ^ (uint64_t)(value >> 63));
+}
+
+static void trace_write_float(float value) {
+    trace_put(state.out, &value, sizeof(value));
+}
+
+static void trace_write_double(double value) {
+    trace_put(state.out, &value, sizeof(value));
+}
+
+// The tag holds the byte count (plus one, 0 is NULL) and the log2 of the
+// alignment
+static void trace_write_bytes(const void *data, size_t size, int align) {
+    if (!data || size > INT32_MAX) {
+        trace_put_uint(state.out, 0);
+        return;
+    }
+    trace_put_uint(state.out, (uint64_t)(size + 1) << 2 | align);
+    trace_align(state.out, (size_t)1 << align);
+    trace_put(state.out, data, size);
+}
+
+static void trace_write_array(const void *data, size_t count, size_t size) {
+    trace_write_bytes(data, count * size, size >= 8 ? 3 : size >= 4 ? 2 : size >= 2 ? 1 : 0);
+}
+
+// Strings keep their terminator so the replay can pass them in place
+static void trace_write_string(const GLchar *string, GLsizei length) {
+    if (!string) {
+        trace_put_uint(state.out, 0);
+        return;
+    }
+    size_t size = length < 0 ? strlen(string) : (size_t)length;
+    trace_put_uint(state.out, size + 1);
+    trace_put(state.out, string, size);
+    trace_put(state.out, "", 1);
+}
+
+static void trace_write_strings(const GLchar *const*strings, GLsizei count, const GLint *lengths) {
+    if (!strings || count < 0) {
+        trace_put_uint(state.out, 0);
+        return;
+    }
+    trace_put_uint(state.out, (uint64_t)count + 1);
+    for (GLsizei i = 0; i < count; i++)
+        trace_write_string(strings[i], lengths && lengths[i] >= 0 ? lengths[i] : -1);
+}
+
+static void trace_write_offset(const void *offset) {
+    trace_put_uint(state.out, (uintptr_t)offset);
+}
+
+static void trace_write_offsets(const void *const*offsets, GLsizei count) {
+    if (!offsets || count < 0) {
+        trace_put_uint(state.out, 0);
+        return;
+    }
+    trace_put_uint(state.out, (uint64_t)count + 1);
+    for (GLsizei i = 0; i < count; i++)
+        trace_put_uint(state.out, (uintptr_t)offsets[i]);
+}
+
+static void trace_write_sync(GLsync sync) {
+    trace_put_uint(state.out, (uintptr_t)sync);
+}
+
+static GLint trace_get(GLenum pname) {
+    GLint value = 0;
+    glGetIntegerv(pname, &value);
+    return value;
+}
+
+// Pixel data read from client memory, or an offset into the bound unpack
+// buffer
+static void trace_write_unpack(const void *pixels, size_t size) {
+    if (!pixels) {
+        trace_put_uint(state.out, 0);
+    } else if (trace_get(GL_PIXEL_UNPACK_BUFFER_BINDING)) {
+        trace_put_uint(state.out, 1);
+        trace_put_uint(state.out, (uintptr_t)pixels);
+    } else {
+        trace_put_uint(state.out, 2);
+        trace_write_bytes(pixels, size, 3);
+    }
+}
+
+// Pixels written by the call, to the bound pack buffer or to `size` bytes
+// the replay has to provide
+static void trace_write_pack(void *pixels, size_t size) {
+    if (!pixels) {
+        trace_put_uint(state.out, 0);
+    } else if (trace_get(GL_PIXEL_PACK_BUFFER_BINDING)) {
+        trace_put_uint(state.out, 1);
+        trace_put_uint(state.out, (uintptr_t)pixels);
+    } else {
+        trace_put_uint(state.out, 2);
+        trace_put_uint(state.out, size);
+    }
+}
+
+static size_t trace_type_size(GLenum type) {
+    switch (type) {
+        case GL_UNSIGNED_BYTE:
+        case GL_BYTE:
+        case GL_UNSIGNED_BYTE_3_3_2:
+        case GL_UNSIGNED_BYTE_2_3_3_REV:
+            return 1;
+        case GL_UNSIGNED_SHORT:
+        case GL_SHORT:
+        case GL_HALF_FLOAT:
+        case GL_2_BYTES:
+        case GL_UNSIGNED_SHORT_5_6_5:
+        case GL_UNSIGNED_SHORT_5_6_5_REV:
+        case GL_UNSIGNED_SHORT_4_4_4_4:
+        case GL_UNSIGNED_SHORT_4_4_4_4_REV:
+        case GL_UNSIGNED_SHORT_5_5_5_1:
+        case GL_UNSIGNED_SHORT_1_5_5_5_REV:
+            return 2;
+        case GL_3_BYTES:
+            return 3;
+        case GL_FLOAT_32_UNSIGNED_INT_24_8_REV:
+            return 8;
+        default:
+            return 4;
+    }
+}
+
+static bool trace_packed_type(GLenum type) {
+    switch (type) {
+        case GL_UNSIGNED_BYTE:
+        case GL_BYTE:
+        case GL_UNSIGNED_SHORT:
+        case GL_SHORT:
+        case GL_UNSIGNED_INT:
+        case GL_INT:
+        case GL_HALF_FLOAT:
+        case GL_FLOAT:
+            return false;
+        default:
+            return true;
+    }
+}
+
+static size_t trace_components(GLenum format) {
+    switch (format) {
+        case GL_RG:
+        case GL_RG_INTEGER:
+        case GL_LUMINANCE_ALPHA:
+        case GL_DEPTH_STENCIL:
+            return 2;
+        case GL_RGB:
+        case GL_BGR:
+        case GL_RGB_INTEGER:
+        case GL_BGR_INTEGER:
+            return 3;
+        case GL_RGBA:
+        case GL_BGRA:
+        case GL_RGBA_INTEGER:
+        case GL_BGRA_INTEGER:
+            return 4;
+        default:
+            return 1;
+    }
+}
+
+static size_t trace_pixel_size(GLenum format, GLenum type) {
+    return trace_packed_type(type) ? trace_type_size(type) : trace_components(format) * trace_type_size(type);
+}
+
+// Bytes of client memory a transfer of width x height x depth pixels
+// touches under the current pack or unpack state
+static size_t trace_pixels_span(GLenum format, GLenum type, GLsizei width, GLsizei height, GLsizei depth, bool pack) {
+    if (width <= 0 || height <= 0 || depth <= 0)
+        return 0;
+    size_t alignment = (size_t)trace_get(pack ? GL_PACK_ALIGNMENT : GL_UNPACK_ALIGNMENT);
+    GLint row_length = trace_get(pack ? GL_PACK_ROW_LENGTH : GL_UNPACK_ROW_LENGTH);
+    GLint image_height = trace_get(pack ? GL_PACK_IMAGE_HEIGHT : GL_UNPACK_IMAGE_HEIGHT);
+    size_t skip_pixels = (size_t)trace_get(pack ? GL_PACK_SKIP_PIXELS : GL_UNPACK_SKIP_PIXELS);
+    size_t skip_rows = (size_t)trace_get(pack ? GL_PACK_SKIP_ROWS : GL_UNPACK_SKIP_ROWS);
+    size_t skip_images = (size_t)trace_get(pack ? GL_PACK_SKIP_IMAGES : GL_UNPACK_SKIP_IMAGES);
+    size_t row_pixels = row_length > 0 ? (size_t)row_length : (size_t)width;
+    size_t rows = image_height > 0 ? (size_t)image_height : (size_t)height;
+    if (!alignment)
+        alignment = 1;
+    size_t pixel, row, last_row;
+    if (type == GL_BITMAP) {
+        pixel = 0;
+        row = (row_pixels + 7) / 8;
+        last_row = (skip_pixels + (size_t)width + 7) / 8;
+    } else {
+        pixel = trace_pixel_size(format, type);
+        row = row_pixels * pixel;
+        last_row = (skip_pixels + (size_t)width) * pixel;
+    }
+    row = (row + alignment - 1) / alignment * alignment;
+    size_t image = rows * row;
+    return (skip_images + (size_t)depth - 1) * image + (skip_rows + (size_t)height - 1) * row + last_row;
+}
+
+// Values read through COMPSIZE(pname) pointers
+static size_t trace_pname_count(GLenum pname) {
+    switch (pname) {
+        case GL_TEXTURE_BORDER_COLOR:
+        case GL_TEXTURE_SWIZZLE_RGBA:
+        case GL_PATCH_DEFAULT_OUTER_LEVEL:
+        case GL_AMBIENT:
+        case GL_DIFFUSE:
+        case GL_SPECULAR:
+        case GL_POSITION:
+        case GL_EMISSION:
+        case GL_AMBIENT_AND_DIFFUSE:
+        case GL_FOG_COLOR:
+        case GL_TEXTURE_ENV_COLOR:
+        case GL_LIGHT_MODEL_AMBIENT:
+        case GL_OBJECT_PLANE:
+        case GL_EYE_PLANE:
+            return 4;
+        case GL_SPOT_DIRECTION:
+        case GL_COLOR_INDEXES:
+        case GL_POINT_DISTANCE_ATTENUATION:
+            return 3;
+        case GL_PATCH_DEFAULT_INNER_LEVEL:
+            return 2;
+        default:
+            return 1;
+    }
+}
+
+static size_t trace_clear_count(GLenum buffer) {
+    return buffer == GL_COLOR ? 4 : 1;
+}
+
+static size_t trace_map_components(GLenum target) {
+    switch (target) {
+        case GL_MAP1_INDEX:
+        case GL_MAP2_INDEX:
+        case GL_MAP1_TEXTURE_COORD_1:
+        case GL_MAP2_TEXTURE_COORD_1:
+            return 1;
+        case GL_MAP1_TEXTURE_COORD_2:
+        case GL_MAP2_TEXTURE_COORD_2:
+            return 2;
+        case GL_MAP1_VERTEX_3:
+        case GL_MAP2_VERTEX_3:
+        case GL_MAP1_NORMAL:
+        case GL_MAP2_NORMAL:
+        case GL_MAP1_TEXTURE_COORD_3:
+        case GL_MAP2_TEXTURE_COORD_3:
+            return 3;
+        default:
+            return 4;
+    }
+}
+
+static GLenum trace_binding(GLenum target) {
+    switch (target) {
+        case GL_ARRAY_BUFFER:
+            return GL_ARRAY_BUFFER_BINDING;
+        case GL_ELEMENT_ARRAY_BUFFER:
+            return GL_ELEMENT_ARRAY_BUFFER_BINDING;
+        case GL_COPY_READ_BUFFER:
+            return GL_COPY_READ_BUFFER_BINDING;
+        case GL_COPY_WRITE_BUFFER:
+            return GL_COPY_WRITE_BUFFER_BINDING;
+        case GL_PIXEL_PACK_BUFFER:
+            return GL_PIXEL_PACK_BUFFER_BINDING;
+        case GL_PIXEL_UNPACK_BUFFER:
+            return GL_PIXEL_UNPACK_BUFFER_BINDING;
+        case GL_UNIFORM_BUFFER:
+            return GL_UNIFORM_BUFFER_BINDING;
+        case GL_TEXTURE_BUFFER:
+            return GL_TEXTURE_BUFFER_BINDING;
+        case GL_TRANSFORM_FEEDBACK_BUFFER:
+            return GL_TRANSFORM_FEEDBACK_BUFFER_BINDING;
+        case GL_DRAW_INDIRECT_BUFFER:
+            return GL_DRAW_INDIRECT_BUFFER_BINDING;
+        case GL_DISPATCH_INDIRECT_BUFFER:
+            return GL_DISPATCH_INDIRECT_BUFFER_BINDING;
+        case GL_SHADER_STORAGE_BUFFER:
+            return GL_SHADER_STORAGE_BUFFER_BINDING;
+        case GL_ATOMIC_COUNTER_BUFFER:
+            return GL_ATOMIC_COUNTER_BUFFER_BINDING;
+        case GL_QUERY_BUFFER:
+            return GL_QUERY_BUFFER_BINDING;
+        default:
+            return GL_NONE;
+    }
+}
+
+static GLuint trace_bound(GLenum target) {
+    GLenum binding = trace_binding(target);
+    return binding == GL_NONE ? 0 : (GLuint)trace_get(binding);
+}
+
+static struct trace_mapping* trace_mapping(GLuint buffer) {
+    for (size_t i = 0; i < state.mapping_count; i++)
+        if (state.mappings[i].buffer == buffer)
+            return &state.mappings[i];
+    return NULL;
+}
+
+static void trace_mapping_release(struct trace_mapping *mapping) {
+    free(mapping->shadow);
+    *mapping = state.mappings[--state.mapping_count];
+}
+
+static void trace_mapped(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access, void *ptr) {
+    if (!ptr || !buffer || length <= 0 || !(access & GL_MAP_WRITE_BIT))
+        return;
+    struct trace_mapping *mapping = trace_mapping(buffer);
+    if (mapping)
+        trace_mapping_release(mapping);
+    TRACE_GROW(state.mappings, state.mapping_count, state.mapping_capacity, 1);
+    mapping = &state.mappings[state.mapping_count++];
+    *mapping = (struct trace_mapping) {
+        .buffer = buffer,
+        .offset = offset,
+        .length = length,
+        .access = access,
+        .ptr = ptr,
+        .fresh = true
+    };
+    if ((access & GL_MAP_PERSISTENT_BIT) && !(mapping->shadow = calloc(1, (size_t)length)))
+        abort();
+}
+
+// `offset` and `size` are relative to the mapping
+static void trace_write_memory(struct trace_buffer *out, struct trace_mapping *mapping, size_t offset, size_t size) {
+    if (!size)
+        return;
+    struct trace_buffer *previous = state.out;
+    state.out = out;
+    trace_command(TRACE_PACKET_MEMORY);
+    trace_write_uint(mapping->buffer);
+    trace_write_uint((uint64_t)mapping->offset + offset);
+    trace_write_bytes(mapping->ptr + offset, size, 3);
+    state.out = previous;
+    if (mapping->shadow)
+        memcpy(mapping->shadow + offset, mapping->ptr + offset, size);
+}
+
+// Writes the runs of pages of a persistent mapping that changed since the
+// last time
+static void trace_write_changes(struct trace_buffer *out, struct trace_mapping *mapping) {
+    size_t length = (size_t)mapping->length, start = 0;
+    bool changed = false;
+    for (size_t page = 0; page < length; page += TRACE_PAGE_SIZE) {
+        size_t size = length - page < TRACE_PAGE_SIZE ? length - page : TRACE_PAGE_SIZE;
+        bool differs = memcmp(mapping->ptr + page, mapping->shadow + page, size) != 0;
+        if (differs && !changed)
+            start = page;
+        else if (!differs && changed)
+            trace_write_memory(out, mapping, start, page - start);
+        changed = differs;
+    }
+    if (changed)
+        trace_write_memory(out, mapping, start, length - start);
+}
+
+static void trace_unmapped(GLuint buffer) {
+    struct trace_mapping *mapping = trace_mapping(buffer);
+    if (!mapping)
+        return;
+    if (mapping->shadow)
+        trace_write_changes(state.out, mapping);
+    else if (!(mapping->access & GL_MAP_FLUSH_EXPLICIT_BIT))
+        trace_write_memory(state.out, mapping, 0, (size_t)mapping->length);
+    trace_mapping_release(mapping);
+}
+
+static void trace_flushed(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+    struct trace_mapping *mapping = trace_mapping(buffer);
+    if (mapping && offset >= 0 && length > 0 && offset + length <= mapping->length)
+        trace_write_memory(state.out, mapping, (size_t)offset, (size_t)length);
+}
+
+static void trace_before_glUnmapBuffer(GLenum target) {
+    trace_unmapped(trace_bound(target));
+}
+
+static void trace_before_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+    trace_flushed(trace_bound(target), offset, length);
+}
+
+// Deleting a buffer unmaps it
+static void trace_before_glDeleteBuffers(GLsizei n, const GLuint *buffers) {
+    for (GLsizei i = 0; buffers && i < n; i++) {
+        struct trace_mapping *mapping = trace_mapping(buffers[i]);
+        if (mapping)
+            trace_mapping_release(mapping);
+    }
+}
+
+static void trace_after_glMapBuffer(GLenum target, GLenum access, void *result) {
+    GLint size = 0;
+    if (access == GL_READ_ONLY)
+        return;
+    glGetBufferParameteriv(target, GL_BUFFER_SIZE, &size);
+    trace_mapped(trace_bound(target), 0, size, GL_MAP_WRITE_BIT, result);
+}
+
+static void trace_after_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access, void *result) {
+    trace_mapped(trace_bound(target), offset, length, access, result);
+}
+
+#if FUNGL_VERSION >= GL_VERSION_4_5
+static void trace_before_glUnmapNamedBuffer(GLuint buffer) {
+    trace_unmapped(buffer);
+}
+
+static void trace_before_glFlushMappedNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+    trace_flushed(buffer, offset, length);
+}
+
+static void trace_after_glMapNamedBuffer(GLuint buffer, GLenum access, void *result) {
+    GLint size = 0;
+    if (access == GL_READ_ONLY)
+        return;
+    glGetNamedBufferParameteriv(buffer, GL_BUFFER_SIZE, &size);
+    trace_mapped(buffer, 0, size, GL_MAP_WRITE_BIT, result);
+}
+
+static void trace_after_glMapNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access, void *result) {
+    trace_mapped(buffer, offset, length, access, result);
+}
+#endif
+
+static const char* trace_command_name(int command);
+
+static void trace_fail(struct trace_reader *reader, const char *message) {
+    if (!reader->error) {
+        snprintf(reader->message, sizeof(reader->message), "%s at byte %zu", message,
+                 (size_t)(reader->position - reader->base));
+        reader->error = reader->message;
+    }
+}
+
+static void trace_missing(struct trace_reader *reader, int command) {
+    char message[96];
+    snprintf(message, sizeof(message), "%s is not available", trace_command_name(command));
+    trace_fail(reader, message);
+}
+
+static uint64_t trace_hash_key(uint64_t key) {
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdull;
+    key ^= key >> 33;
+    return key;
+}
+
+static bool trace_map_get(const struct trace_map *map, uint64_t key, uint64_t *value) {
+    if (!map->capacity)
+        return false;
+    for (size_t i = trace_hash_key(key) & (map->capacity - 1);; i = (i + 1) & (map->capacity - 1)) {
+        if (!map->keys[i])
+            return false;
+        if (map->keys[i] == key) {
+            *value = map->values[i];
+            return true;
+        }
+    }
+}
+
+static void trace_map_set(struct trace_map *map, uint64_t key, uint64_t value) {
+    if ((map->count + 1) * 2 > map->capacity) {
+        struct trace_map grown = {
+            .capacity = map->capacity ? map->capacity * 2 : 256
+        };
+        if (!(grown.keys = calloc(grown.capacity, sizeof(uint64_t))) ||
+            !(grown.values = malloc(grown.capacity * sizeof(uint64_t))))
+            abort();
+        for (size_t i = 0; i < map->capacity; i++)
+            if (map->keys[i])
+                trace_map_set(&grown, map->keys[i], map->values[i]);
+        free(map->keys);
+        free(map->values);
+        *map = grown;
+    }
+    size_t i = trace_hash_key(key) & (map->capacity - 1);
+    while (map->keys[i] && map->keys[i] != key)
+        i = (i + 1) & (map->capacity - 1);
+    if (!map->keys[i])
+        map->count++;
+    map->keys[i] = key;
+    map->values[i] = value;
+}
+
+static void trace_map_free(struct trace_map *map) {
+    free(map->keys);
+    free(map->values);
+    memset(map, 0, sizeof(*map));
+}
+
+static void* trace_scratch(struct trace_reader *reader, size_t size) {
+    size = (size + 15) & ~(size_t)15;
+    if (reader->scratch_used + size <= reader->scratch_capacity) {
+        void *result = reader->scratch + reader->scratch_used;
+        reader->scratch_used += size;
+        return result;
+    }
+    if (size > (size_t)(reader->end - reader->base) + (64 << 20)) {
+        trace_fail(reader, "oversized allocation");
+        return NULL;
+    }
+    TRACE_GROW(reader->blocks, reader->block_count, reader->block_capacity, 1);
+    void *result = malloc(size ? size : 1);
+    if (!result)
+        abort();
+    reader->blocks[reader->block_count++] = result;
+    return result;
+}
+
+static void trace_scratch_reset(struct trace_reader *reader) {
+    for (size_t i = 0; i < reader->block_count; i++)
+        free(reader->blocks[i]);
+    reader->block_count = 0;
+    reader->scratch_used = 0;
+}
+
+static uint64_t trace_read_uint(struct trace_reader *reader) {
+    uint64_t value = 0;
+    for (int shift = 0; reader->position < reader->end; shift += 7) {
+        unsigned char byte = *reader->position++;
+        if (shift < 64)
+            value |= (uint64_t)(byte & 0x7f) << shift;
+        if (!(byte & 0x80))
+            return value;
+    }
+    trace_fail(reader, "truncated call");
+    return 0;
+}
+
+static int64_t trace_read_int(struct trace_reader *reader) {
+    uint64_t value = trace_read_uint(reader);
+    return (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+}
+
+static const unsigned char* trace_read_bytes(struct trace_reader *reader, size_t size) {
+    if (size > (size_t)(reader->end - reader->position)) {
+        trace_fail(reader, "truncated call");
+        reader->position = reader->end;
+        return NULL;
+    }
+    const unsigned char *result = reader->position;
+    reader->position += size;
+    return result;
+}
+
+static float trace_read_float(struct trace_reader *reader) {
+    float value = 0.f;
+    const unsigned char *bytes = trace_read_bytes(reader, sizeof(value));
+    if (bytes)
+        memcpy(&value, bytes, sizeof(value));
+    return value;
+}
+
+static double trace_read_double(struct trace_reader *reader) {
+    double value = 0.;
+    const unsigned char *bytes = trace_read_bytes(reader, sizeof(value));
+    if (bytes)
+        memcpy(&value, bytes, sizeof(value));
+    return value;
+}
+
+// Points into the trace itself, `size` is set to the byte count
+static const void* trace_read_sized(struct trace_reader *reader, size_t *size) {
+    uint64_t tag = trace_read_uint(reader);
+    *size = 0;
+    if (!tag)
+        return NULL;
+    size_t align = (size_t)1 << (tag & 3);
+    size_t pad = (align - (size_t)(reader->position - reader->base) % align) % align;
+    if (!trace_read_bytes(reader, pad))
+        return NULL;
+    *size = (size_t)(tag >> 2) - 1;
+    const void *result = trace_read_bytes(reader, *size);
+    if (!result)
+        *size = 0;
+    return result;
+}
+
+static const void* trace_read_array(struct trace_reader *reader) {
+    size_t size;
+    return trace_read_sized(reader, &size);
+}
+
+static const GLchar* trace_read_string(struct trace_reader *reader) {
+    uint64_t size = trace_read_uint(reader);
+    if (!size)
+        return NULL;
+    const GLchar *result = (const GLchar*)trace_read_bytes(reader, size);
+    if (result && result[size - 1]) {
+        trace_fail(reader, "unterminated string");
+        return NULL;
+    }
+    return result;
+}
+
+static const GLchar *const* trace_read_strings(struct trace_reader *reader) {
+    uint64_t count = trace_read_uint(reader);
+    if (!count--)
+        return NULL;
+    if (count > (size_t)(reader->end - reader->position)) {
+        trace_fail(reader, "truncated call");
+        return NULL;
+    }
+    const GLchar **result = trace_scratch(reader, count * sizeof(GLchar*) + 1);
+    for (size_t i = 0; result && i < count; i++)
+        result[i] = trace_read_string(reader);
+    return result;
+}
+
+static const void* trace_read_offset(struct trace_reader *reader) {
+    return (const void*)(uintptr_t)trace_read_uint(reader);
+}
+
+static const void *const* trace_read_offsets(struct trace_reader *reader) {
+    uint64_t count = trace_read_uint(reader);
+    if (!count--)
+        return NULL;
+    if (count > (size_t)(reader->end - reader->position)) {
+        trace_fail(reader, "truncated call");
+        return NULL;
+    }
+    const void **result = trace_scratch(reader, count * sizeof(void*) + 1);
+    for (size_t i = 0; result && i < count; i++)
+        result[i] = trace_read_offset(reader);
+    return result;
+}
+
+static const void* trace_read_unpack(struct trace_reader *reader) {
+    switch (trace_read_uint(reader)) {
+        case 0:
+            return NULL;
+        case 1:
+            return trace_read_offset(reader);
+        default:
+            return trace_read_array(reader);
+    }
+}
+
+static void* trace_read_pack(struct trace_reader *reader) {
+    switch (trace_read_uint(reader)) {
+        case 0:
+            return NULL;
+        case 1:
+            return (void*)trace_read_offset(reader);
+        default:
+            return trace_scratch(reader, (size_t)trace_read_uint(reader));
+    }
+}
+
+#define TRACE_NAME_KEY(CLASS, NAME) ((uint64_t)((CLASS) + 1) << 32 | (NAME))
+#define TRACE_LOCATION_KEY(PROGRAM, LOCATION) ((uint64_t)1 << 63 | (uint64_t)(PROGRAM) << 32 | (uint32_t)(LOCATION))
+
+// Names the replay hasn't seen created (like the default objects) are
+// passed through
+static GLuint trace_name(struct trace_reader *reader, enum trace_name_class class, GLuint name) {
+    uint64_t value;
+    if (name && trace_map_get(&reader->names, TRACE_NAME_KEY(class, name), &value))
+        return (GLuint)value;
+    return name;
+}
+
+static void trace_map_name(struct trace_reader *reader, enum trace_name_class class, GLuint name, GLuint result, GLsizei range) {
+    for (GLsizei i = 0; name && i < range; i++)
+        trace_map_set(&reader->names, TRACE_NAME_KEY(class, name + i), result + i);
+}
+
+static const GLuint* trace_read_names(struct trace_reader *reader, enum trace_name_class class) {
+    size_t size;
+    const GLuint *names = trace_read_sized(reader, &size);
+    if (!names)
+        return NULL;
+    GLuint *result = trace_scratch(reader, size + 1);
+    for (size_t i = 0; result && i < size / sizeof(GLuint); i++)
+        result[i] = trace_name(reader, class, names[i]);
+    return result;
+}
+
+static void trace_map_names(struct trace_reader *reader, enum trace_name_class class, const GLuint *results, size_t count) {
+    size_t size;
+    const GLuint *names = trace_read_sized(reader, &size);
+    if (!names || !results || size != count * sizeof(GLuint))
+        return;
+    for (size_t i = 0; i < count; i++)
+        trace_map_name(reader, class, names[i], results[i], 1);
+}
+
+static GLint trace_location(struct trace_reader *reader, GLuint program, GLint location) {
+    uint64_t value;
+    if (location >= 0 && trace_map_get(&reader->locations, TRACE_LOCATION_KEY(program, location), &value))
+        return (GLint)value;
+    return location;
+}
+
+static void trace_map_location(struct trace_reader *reader, GLuint program, GLint location, GLint result) {
+    if (location >= 0 && location != result)
+        trace_map_set(&reader->locations, TRACE_LOCATION_KEY(program, location), (uint64_t)(int64_t)result);
+}
+
+static GLsync trace_read_sync(struct trace_reader *reader) {
+    uint64_t id = trace_read_uint(reader), value;
+    return id && trace_map_get(&reader->syncs, id, &value) ? (GLsync)(uintptr_t)value : NULL;
+}
+
+static void trace_map_sync(struct trace_reader *reader, uint64_t id, GLsync result) {
+    if (id)
+        trace_map_set(&reader->syncs, id, (uintptr_t)result);
+}
+
+static struct trace_replay_mapping* trace_replay_mapping(struct trace_reader *reader, GLuint buffer) {
+    for (size_t i = 0; i < reader->mapping_count; i++)
+        if (reader->mappings[i].buffer == buffer)
+            return &reader->mappings[i];
+    return NULL;
+}
+
+static void trace_replay_mapped(struct trace_reader *reader, GLuint buffer, GLintptr offset, GLsizeiptr length, void *ptr) {
+    if (!ptr || !buffer)
+        return;
+    struct trace_replay_mapping *mapping = trace_replay_mapping(reader, buffer);
+    if (!mapping) {
+        TRACE_GROW(reader->mappings, reader->mapping_count, reader->mapping_capacity, 1);
+        mapping = &reader->mappings[reader->mapping_count++];
+    }
+    *mapping = (struct trace_replay_mapping) {
+        .buffer = buffer,
+        .offset = offset,
+        .length = length,
+        .ptr = ptr
+    };
+}
+
+static void trace_replay_unmapped(struct trace_reader *reader, GLuint buffer) {
+    struct trace_replay_mapping *mapping = trace_replay_mapping(reader, buffer);
+    if (mapping)
+        *mapping = reader->mappings[--reader->mapping_count];
+}
+
+static GLuint trace_replay_bound(GLenum target) {
+    GLenum binding = trace_binding(target);
+    GLint buffer = 0;
+    if (binding != GL_NONE)
+        glGetIntegerv(binding, &buffer);
+    return (GLuint)buffer;
+}
+
+static void trace_replay_before_glUnmapBuffer(struct trace_reader *reader, GLenum target) {
+    trace_replay_unmapped(reader, trace_replay_bound(target));
+}
+
+static void trace_replay_before_glDeleteBuffers(struct trace_reader *reader, GLsizei n, const GLuint *buffers) {
+    for (GLsizei i = 0; buffers && i < n; i++)
+        trace_replay_unmapped(reader, buffers[i]);
+}
+
+static void trace_replay_after_glMapBuffer(struct trace_reader *reader, GLenum target, GLenum access, void *result) {
+    (void)access;
+    GLint size = 0;
+    glGetBufferParameteriv(target, GL_BUFFER_SIZE, &size);
+    trace_replay_mapped(reader, trace_replay_bound(target), 0, size, result);
+}
+
+static void trace_replay_after_glMapBufferRange(struct trace_reader *reader, GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access, void *result) {
+    (void)access;
+    trace_replay_mapped(reader, trace_replay_bound(target), offset, length, result);
+}
+
+static void trace_replay_after_glUseProgram(struct trace_reader *reader, GLuint program) {
+    reader->program = program;
+}
+
+#if FUNGL_VERSION >= GL_VERSION_4_5
+static void trace_replay_before_glUnmapNamedBuffer(struct trace_reader *reader, GLuint buffer) {
+    trace_replay_unmapped(reader, buffer);
+}
+
+static void trace_replay_after_glMapNamedBuffer(struct trace_reader *reader, GLuint buffer, GLenum access, void *result) {
+    (void)access;
+    GLint size = 0;
+    glGetNamedBufferParameteriv(buffer, GL_BUFFER_SIZE, &size);
+    trace_replay_mapped(reader, buffer, 0, size, result);
+}
+
+static void trace_replay_after_glMapNamedBufferRange(struct trace_reader *reader, GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access, void *result) {
+    (void)access;
+    trace_replay_mapped(reader, buffer, offset, length, result);
+}
+#endif
+
+// Writes that went into a mapping are copied into the replay's mapping of
+// the same buffer, they are dropped if the replay's map call failed
+static void trace_replay_memory(struct trace_reader *reader) {
+    GLuint buffer = trace_name(reader, TRACE_NAME_BUFFER, (GLuint)trace_read_uint(reader));
+    uint64_t offset = trace_read_uint(reader);
+    size_t size;
+    const void *data = trace_read_sized(reader, &size);
+    struct trace_replay_mapping *mapping = trace_replay_mapping(reader, buffer);
+    if (reader->error || !data || !mapping || offset < (uint64_t)mapping->offset ||
+        offset - (uint64_t)mapping->offset + size > (uint64_t)mapping->length)
+        return;
+    memcpy(mapping->ptr + (offset - (uint64_t)mapping->offset), data, size);
+}
+
+#include "gltrace_calls.h"
+
+static const char* trace_command_name(int command) {
+    if (command < TRACE_FIRST_COMMAND || command >= TRACE_COMMAND_END)
+        return "unknown command";
+    return trace_command_names[command - TRACE_FIRST_COMMAND];
+}
+
+static void trace_frame_func(void *userdata) {
+    (void)userdata;
+    trace_frame();
+}
+
+bool trace_capture_begin(const char *path) {
+    if (state.capturing)
+        return false;
+    memset(&state, 0, sizeof(state));
+    if (!(state.file = fopen(path, "wb")))
+        return false;
+    struct trace_header header = {
+        .magic = TRACE_MAGIC,
+        .format = TRACE_FORMAT,
+        .hash = TRACE_COMMANDS_HASH,
+        .commands = TRACE_COMMAND_END,
+        .frames = -1
+    };
+    if (fwrite(&header, sizeof(header), 1, state.file) != 1) {
+        fclose(state.file);
+        state.file = NULL;
+        return false;
+    }
+    state.out = &state.frame;
+#define X(T, N)                \
+    if (__##N) {               \
+        trace_real.N = __##N;  \
+        __##N = trace_##N;     \
+    }
+    TRACE_COMMANDS
+#undef X
+    state.registered = glutAddFrameFunc(trace_frame_func, NULL);
+    state.capturing = true;
+    return true;
+}
+
+void trace_frame(void) {
+    if (!state.capturing)
+        return;
+    // Pages of mappings from earlier frames go ahead of the calls that
+    // may draw from them, new mappings only exist after their map call
+    for (size_t i = 0; i < state.mapping_count; i++)
+        if (state.mappings[i].shadow && !state.mappings[i].fresh)
+            trace_write_changes(&state.pages, &state.mappings[i]);
+    trace_flush(&state.pages);
+    trace_flush(&state.frame);
+    for (size_t i = 0; i < state.mapping_count; i++) {
+        if (state.mappings[i].shadow && state.mappings[i].fresh)
+            trace_write_changes(&state.pages, &state.mappings[i]);
+        state.mappings[i].fresh = false;
+    }
+    trace_put_uint(&state.pages, TRACE_PACKET_FRAME);
+    trace_flush(&state.pages);
+    state.frames++;
+}
+
+bool trace_capture_end(void) {
+    if (!state.capturing)
+        return false;
+    trace_frame();
+#define X(T, N)                \
+    if (trace_real.N)          \
+        __##N = trace_real.N;
+    TRACE_COMMANDS
+#undef X
+    memset(&trace_real, 0, sizeof(trace_real));
+    if (state.registered)
+        glutRemoveFrameFunc(trace_frame_func, NULL);
+    bool result = !ferror(state.file) && fseek(state.file, offsetof(struct trace_header, frames), SEEK_SET) == 0 &&
+                  fwrite(&state.frames, sizeof(int32_t), 1, state.file) == 1;
+    result = fclose(state.file) == 0 && result;
+    while (state.mapping_count)
+        trace_mapping_release(&state.mappings[0]);
+    free(state.mappings);
+    free(state.frame.data);
+    free(state.pages.data);
+    memset(&state, 0, sizeof(state));
+    return result;
+}
+
+bool trace_capturing(void) {
+    return state.capturing;
+}
+
+int trace_capture_frames(void) {
+    return state.frames;
+}
+
+struct trace_replay* trace_replay_open(const char *path) {
+    struct trace_header header;
+    size_t size;
+    const void *file = texture_map_file(path, &size);
+    if (!file)
+        return NULL;
+    if (size < sizeof(header))
+        goto BAIL;
+    memcpy(&header, file, sizeof(header));
+    if (memcmp(header.magic, TRACE_MAGIC, 4) || header.format != TRACE_FORMAT ||
+        header.hash != TRACE_COMMANDS_HASH || header.commands != TRACE_COMMAND_END)
+        goto BAIL;
+    struct trace_replay *replay = calloc(1, sizeof(struct trace_replay));
+    if (!replay)
+        goto BAIL;
+    replay->file = file;
+    replay->size = size;
+    replay->frames = header.frames;
+    struct trace_reader *reader = &replay->reader;
+    reader->base = file;
+    reader->position = reader->base + sizeof(header);
+    reader->end = reader->base + size;
+    reader->scratch_capacity = 64 << 10;
+    if (!(reader->scratch = malloc(reader->scratch_capacity)))
+        abort();
+    return replay;
+BAIL:
+    texture_unmap_file(file, size);
+    return NULL;
+}
+
+void trace_replay_close(struct trace_replay *replay) {
+    if (!replay)
+        return;
+    struct trace_reader *reader = &replay->reader;
+    trace_scratch_reset(reader);
+    free(reader->scratch);
+    free(reader->blocks);
+    free(reader->mappings);
+    trace_map_free(&reader->names);
+    trace_map_free(&reader->locations);
+    trace_map_free(&reader->syncs);
+    texture_unmap_file(replay->file, replay->size);
+    free(replay);
+}
+
+bool trace_replay_frame(struct trace_replay *replay) {
+    struct trace_reader *reader = &replay->reader;
+    while (!reader->error && reader->position < reader->end) {
+        uint64_t command = trace_read_uint(reader);
+        switch (command) {
+            case TRACE_PACKET_PAD:
+                continue;
+            case TRACE_PACKET_FRAME:
+                replay->replayed++;
+                return true;
+            case TRACE_PACKET_MEMORY:
+                trace_replay_memory(reader);
+                break;
+            default:
+                if (command >= TRACE_COMMAND_END || !trace_replay_commands[command - TRACE_FIRST_COMMAND]) {
+                    trace_missing(reader, (int)command);
+                    break;
+                }
+                trace_replay_commands[command - TRACE_FIRST_COMMAND](reader);
+                replay->calls++;
+                break;
+        }
+        trace_scratch_reset(reader);
+    }
+    if (!reader->error && replay->frames >= 0 && replay->replayed != replay->frames)
+        trace_fail(reader, "trace is cut short");
+    return false;
+}
+
+int trace_replay_frames(const struct trace_replay *replay) {
+    return replay->frames;
+}
+
+const char* trace_replay_error(const struct trace_replay *replay) {
+    return replay->reader.error;
+}
+
+size_t trace_replay_calls(const struct trace_replay *replay) {
+    return replay->calls;
+}
+
+size_t trace_replay_position(const struct trace_replay *replay) {
+    return (size_t)(replay->reader.position - replay->reader.base);
+}
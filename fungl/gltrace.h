@@ -0,0 +1,109 @@
+/* gltrace.h --  https://github.com/takeiteasy/fungl
+
+ fungl puts the fun back into OpenGL
+
+ Copyright (C) 2024  George Watson
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+ GL call capture and replay. While capturing, every GL function pointer is
+ swapped for a wrapper (generated from gl.xml by tools/gltrace.rb) that
+ writes the call and the data it reads (buffer and texture uploads, uniform
+ arrays, shader sources) to a compact binary trace, then calls the real
+ function. A replay re-executes the trace frame by frame as fast as the
+ driver takes it, so a frame from the field can be benchmarked offline
+ against the exact same calls.
+
+    glInit();
+    trace_capture_begin("frames.trace");
+    glutMainLoop();  // trace_capture_end() once enough frames are in
+
+    struct trace_replay *replay = trace_replay_open("frames.trace");
+    while (trace_replay_frame(replay))
+        glutSwapBuffers();
+
+ Arguments are written as varints, so most calls take a few bytes. Object
+ names, fence syncs and uniform locations the replay gets back can differ
+ from the captured ones and are remapped. Data written through mapped
+ buffers is recorded when it's unmapped or flushed; persistent mappings
+ are compared against a shadow copy at the end of each frame and the
+ pages that changed go out ahead of the frame, so rings that stream into
+ them (see glbuffer.h) replay correctly except in the frame they are
+ mapped. Queries (glGet*, glIs*) aren't recorded.
+
+ The trace has no snapshot of the state at the start of the capture:
+ capturing has to begin before the program creates any GL objects, and a
+ replay has to start from a fresh context of the same version. Frames are
+ delimited by glutMainLoop, programs with their own loop call trace_frame
+ at the start of each frame. Client side vertex and index arrays aren't
+ supported, as in the core profile, and attribute locations and uniform
+ block indices are assumed to match between the capture and the replay. */
+
+#if !defined(gltrace_h) && !defined(FUNGL_NO_TRACE)
+#define gltrace_h
+#if defined(__cplusplus)
+extern "C" {
+#endif
+#include "gl.h"
+#if FUNGL_VERSION < GL_VERSION_3_2
+#error "gltrace.h requires FUNGL_VERSION >= GL_VERSION_3_2"
+#endif
+#include "gltexture.h"
+#ifndef gltexture_h
+#error "gltrace.h requires gltexture.h, don't define FUNGL_NO_TEXTURE"
+#endif
+#include <stddef.h>
+#include <stdbool.h>
+
+// Bytes of a frame buffered before they are written out mid frame, pages
+// of persistent mappings written after that land behind the frame
+#ifndef TRACE_FRAME_BUFFER
+#define TRACE_FRAME_BUFFER (256 << 20)
+#endif
+// Granularity persistent mappings are compared at
+#define TRACE_PAGE_SIZE 4096
+
+// Call after glInit. Registers trace_frame as a glut frame func.
+bool trace_capture_begin(const char *path);
+// Ends the current frame, restores the real functions and closes the file
+bool trace_capture_end(void);
+bool trace_capturing(void);
+// Ends the current frame of the capture
+void trace_frame(void);
+// Frames written so far
+int trace_capture_frames(void);
+
+struct trace_replay;
+
+// NULL if the file can't be read or was written by a build generated from
+// a different gl.xml
+struct trace_replay* trace_replay_open(const char *path);
+// Objects created by the replay are left alive
+void trace_replay_close(struct trace_replay *replay);
+// Executes the calls of the next frame. Returns false at the end of the
+// trace, or when it stopped on a call this context lacks or malformed data
+// (see trace_replay_error).
+bool trace_replay_frame(struct trace_replay *replay);
+// Frames in the trace, -1 if the capture wasn't ended cleanly
+int trace_replay_frames(const struct trace_replay *replay);
+// NULL unless the replay stopped early
+const char* trace_replay_error(const struct trace_replay *replay);
+// Calls executed and bytes read so far
+size_t trace_replay_calls(const struct trace_replay *replay);
+size_t trace_replay_position(const struct trace_replay *replay);
+
+#if defined(__cplusplus)
+}
+#endif
+#endif /* gltrace_h */
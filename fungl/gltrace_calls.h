@@ -0,0 +1,21444 @@
+/* gltrace_calls.h -- https://github.com/takeiteasy/fungl
+
+  This file was generated by https://github.com/takeiteasy/fungl/blob/master/tools/gltrace.rb
+
+  fungl puts the fun back into OpenGL
+
+  Copyright (C) 2024  George Watson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+// Included by gltrace.c only, after the helpers the wrappers use
+
+// Traces are only replayed by builds generated from the same command list
+#define TRACE_COMMANDS_HASH 0x28dd29d4u
+
+enum trace_command {
+    TRACE_glCullFace = TRACE_FIRST_COMMAND,
+    TRACE_glFrontFace,
+    TRACE_glHint,
+    TRACE_glLineWidth,
+    TRACE_glPointSize,
+    TRACE_glPolygonMode,
+    TRACE_glScissor,
+    TRACE_glTexParameterf,
+    TRACE_glTexParameterfv,
+    TRACE_glTexParameteri,
+    TRACE_glTexParameteriv,
+    TRACE_glTexImage1D,
+    TRACE_glTexImage2D,
+    TRACE_glDrawBuffer,
+    TRACE_glClear,
+    TRACE_glClearColor,
+    TRACE_glClearStencil,
+    TRACE_glClearDepth,
+    TRACE_glStencilMask,
+    TRACE_glColorMask,
+    TRACE_glDepthMask,
+    TRACE_glDisable,
+    TRACE_glEnable,
+    TRACE_glFinish,
+    TRACE_glFlush,
+    TRACE_glBlendFunc,
+    TRACE_glLogicOp,
+    TRACE_glStencilFunc,
+    TRACE_glStencilOp,
+    TRACE_glDepthFunc,
+    TRACE_glPixelStoref,
+    TRACE_glPixelStorei,
+    TRACE_glReadBuffer,
+    TRACE_glReadPixels,
+    TRACE_glDepthRange,
+    TRACE_glViewport,
+    TRACE_glNewList,
+    TRACE_glEndList,
+    TRACE_glCallList,
+    TRACE_glCallLists,
+    TRACE_glDeleteLists,
+    TRACE_glGenLists,
+    TRACE_glListBase,
+    TRACE_glBegin,
+    TRACE_glBitmap,
+    TRACE_glColor3b,
+    TRACE_glColor3bv,
+    TRACE_glColor3d,
+    TRACE_glColor3dv,
+    TRACE_glColor3f,
+    TRACE_glColor3fv,
+    TRACE_glColor3i,
+    TRACE_glColor3iv,
+    TRACE_glColor3s,
+    TRACE_glColor3sv,
+    TRACE_glColor3ub,
+    TRACE_glColor3ubv,
+    TRACE_glColor3ui,
+    TRACE_glColor3uiv,
+    TRACE_glColor3us,
+    TRACE_glColor3usv,
+    TRACE_glColor4b,
+    TRACE_glColor4bv,
+    TRACE_glColor4d,
+    TRACE_glColor4dv,
+    TRACE_glColor4f,
+    TRACE_glColor4fv,
+    TRACE_glColor4i,
+    TRACE_glColor4iv,
+    TRACE_glColor4s,
+    TRACE_glColor4sv,
+    TRACE_glColor4ub,
+    TRACE_glColor4ubv,
+    TRACE_glColor4ui,
+    TRACE_glColor4uiv,
+    TRACE_glColor4us,
+    TRACE_glColor4usv,
+    TRACE_glEdgeFlag,
+    TRACE_glEdgeFlagv,
+    TRACE_glEnd,
+    TRACE_glIndexd,
+    TRACE_glIndexdv,
+    TRACE_glIndexf,
+    TRACE_glIndexfv,
+    TRACE_glIndexi,
+    TRACE_glIndexiv,
+    TRACE_glIndexs,
+    TRACE_glIndexsv,
+    TRACE_glNormal3b,
+    TRACE_glNormal3bv,
+    TRACE_glNormal3d,
+    TRACE_glNormal3dv,
+    TRACE_glNormal3f,
+    TRACE_glNormal3fv,
+    TRACE_glNormal3i,
+    TRACE_glNormal3iv,
+    TRACE_glNormal3s,
+    TRACE_glNormal3sv,
+    TRACE_glRasterPos2d,
+    TRACE_glRasterPos2dv,
+    TRACE_glRasterPos2f,
+    TRACE_glRasterPos2fv,
+    TRACE_glRasterPos2i,
+    TRACE_glRasterPos2iv,
+    TRACE_glRasterPos2s,
+    TRACE_glRasterPos2sv,
+    TRACE_glRasterPos3d,
+    TRACE_glRasterPos3dv,
+    TRACE_glRasterPos3f,
+    TRACE_glRasterPos3fv,
+    TRACE_glRasterPos3i,
+    TRACE_glRasterPos3iv,
+    TRACE_glRasterPos3s,
+    TRACE_glRasterPos3sv,
+    TRACE_glRasterPos4d,
+    TRACE_glRasterPos4dv,
+    TRACE_glRasterPos4f,
+    TRACE_glRasterPos4fv,
+    TRACE_glRasterPos4i,
+    TRACE_glRasterPos4iv,
+    TRACE_glRasterPos4s,
+    TRACE_glRasterPos4sv,
+    TRACE_glRectd,
+    TRACE_glRectdv,
+    TRACE_glRectf,
+    TRACE_glRectfv,
+    TRACE_glRecti,
+    TRACE_glRectiv,
+    TRACE_glRects,
+    TRACE_glRectsv,
+    TRACE_glTexCoord1d,
+    TRACE_glTexCoord1dv,
+    TRACE_glTexCoord1f,
+    TRACE_glTexCoord1fv,
+    TRACE_glTexCoord1i,
+    TRACE_glTexCoord1iv,
+    TRACE_glTexCoord1s,
+    TRACE_glTexCoord1sv,
+    TRACE_glTexCoord2d,
+    TRACE_glTexCoord2dv,
+    TRACE_glTexCoord2f,
+    TRACE_glTexCoord2fv,
+    TRACE_glTexCoord2i,
+    TRACE_glTexCoord2iv,
+    TRACE_glTexCoord2s,
+    TRACE_glTexCoord2sv,
+    TRACE_glTexCoord3d,
+    TRACE_glTexCoord3dv,
+    TRACE_glTexCoord3f,
+    TRACE_glTexCoord3fv,
+    TRACE_glTexCoord3i,
+    TRACE_glTexCoord3iv,
+    TRACE_glTexCoord3s,
+    TRACE_glTexCoord3sv,
+    TRACE_glTexCoord4d,
+    TRACE_glTexCoord4dv,
+    TRACE_glTexCoord4f,
+    TRACE_glTexCoord4fv,
+    TRACE_glTexCoord4i,
+    TRACE_glTexCoord4iv,
+    TRACE_glTexCoord4s,
+    TRACE_glTexCoord4sv,
+    TRACE_glVertex2d,
+    TRACE_glVertex2dv,
+    TRACE_glVertex2f,
+    TRACE_glVertex2fv,
+    TRACE_glVertex2i,
+    TRACE_glVertex2iv,
+    TRACE_glVertex2s,
+    TRACE_glVertex2sv,
+    TRACE_glVertex3d,
+    TRACE_glVertex3dv,
+    TRACE_glVertex3f,
+    TRACE_glVertex3fv,
+    TRACE_glVertex3i,
+    TRACE_glVertex3iv,
+    TRACE_glVertex3s,
+    TRACE_glVertex3sv,
+    TRACE_glVertex4d,
+    TRACE_glVertex4dv,
+    TRACE_glVertex4f,
+    TRACE_glVertex4fv,
+    TRACE_glVertex4i,
+    TRACE_glVertex4iv,
+    TRACE_glVertex4s,
+    TRACE_glVertex4sv,
+    TRACE_glClipPlane,
+    TRACE_glColorMaterial,
+    TRACE_glFogf,
+    TRACE_glFogfv,
+    TRACE_glFogi,
+    TRACE_glFogiv,
+    TRACE_glLightf,
+    TRACE_glLightfv,
+    TRACE_glLighti,
+    TRACE_glLightiv,
+    TRACE_glLightModelf,
+    TRACE_glLightModelfv,
+    TRACE_glLightModeli,
+    TRACE_glLightModeliv,
+    TRACE_glLineStipple,
+    TRACE_glMaterialf,
+    TRACE_glMaterialfv,
+    TRACE_glMateriali,
+    TRACE_glMaterialiv,
+    TRACE_glPolygonStipple,
+    TRACE_glShadeModel,
+    TRACE_glTexEnvf,
+    TRACE_glTexEnvfv,
+    TRACE_glTexEnvi,
+    TRACE_glTexEnviv,
+    TRACE_glTexGend,
+    TRACE_glTexGendv,
+    TRACE_glTexGenf,
+    TRACE_glTexGenfv,
+    TRACE_glTexGeni,
+    TRACE_glTexGeniv,
+    TRACE_glInitNames,
+    TRACE_glLoadName,
+    TRACE_glPassThrough,
+    TRACE_glPopName,
+    TRACE_glPushName,
+    TRACE_glClearAccum,
+    TRACE_glClearIndex,
+    TRACE_glIndexMask,
+    TRACE_glAccum,
+    TRACE_glPopAttrib,
+    TRACE_glPushAttrib,
+    TRACE_glMap1d,
+    TRACE_glMap1f,
+    TRACE_glMap2d,
+    TRACE_glMap2f,
+    TRACE_glMapGrid1d,
+    TRACE_glMapGrid1f,
+    TRACE_glMapGrid2d,
+    TRACE_glMapGrid2f,
+    TRACE_glEvalCoord1d,
+    TRACE_glEvalCoord1dv,
+    TRACE_glEvalCoord1f,
+    TRACE_glEvalCoord1fv,
+    TRACE_glEvalCoord2d,
+    TRACE_glEvalCoord2dv,
+    TRACE_glEvalCoord2f,
+    TRACE_glEvalCoord2fv,
+    TRACE_glEvalMesh1,
+    TRACE_glEvalPoint1,
+    TRACE_glEvalMesh2,
+    TRACE_glEvalPoint2,
+    TRACE_glAlphaFunc,
+    TRACE_glPixelZoom,
+    TRACE_glPixelTransferf,
+    TRACE_glPixelTransferi,
+    TRACE_glPixelMapfv,
+    TRACE_glPixelMapuiv,
+    TRACE_glPixelMapusv,
+    TRACE_glCopyPixels,
+    TRACE_glDrawPixels,
+    TRACE_glFrustum,
+    TRACE_glLoadIdentity,
+    TRACE_glLoadMatrixf,
+    TRACE_glLoadMatrixd,
+    TRACE_glMatrixMode,
+    TRACE_glMultMatrixf,
+    TRACE_glMultMatrixd,
+    TRACE_glOrtho,
+    TRACE_glPopMatrix,
+    TRACE_glPushMatrix,
+    TRACE_glRotated,
+    TRACE_glRotatef,
+    TRACE_glScaled,
+    TRACE_glScalef,
+    TRACE_glTranslated,
+    TRACE_glTranslatef,
+    TRACE_glDrawArrays,
+    TRACE_glDrawElements,
+    TRACE_glPolygonOffset,
+    TRACE_glCopyTexImage1D,
+    TRACE_glCopyTexImage2D,
+    TRACE_glCopyTexSubImage1D,
+    TRACE_glCopyTexSubImage2D,
+    TRACE_glTexSubImage1D,
+    TRACE_glTexSubImage2D,
+    TRACE_glBindTexture,
+    TRACE_glDeleteTextures,
+    TRACE_glGenTextures,
+    TRACE_glArrayElement,
+    TRACE_glColorPointer,
+    TRACE_glDisableClientState,
+    TRACE_glEdgeFlagPointer,
+    TRACE_glEnableClientState,
+    TRACE_glIndexPointer,
+    TRACE_glInterleavedArrays,
+    TRACE_glNormalPointer,
+    TRACE_glTexCoordPointer,
+    TRACE_glVertexPointer,
+    TRACE_glPrioritizeTextures,
+    TRACE_glIndexub,
+    TRACE_glIndexubv,
+    TRACE_glPopClientAttrib,
+    TRACE_glPushClientAttrib,
+    TRACE_glDrawRangeElements,
+    TRACE_glTexImage3D,
+    TRACE_glTexSubImage3D,
+    TRACE_glCopyTexSubImage3D,
+    TRACE_glActiveTexture,
+    TRACE_glSampleCoverage,
+    TRACE_glCompressedTexImage3D,
+    TRACE_glCompressedTexImage2D,
+    TRACE_glCompressedTexImage1D,
+    TRACE_glCompressedTexSubImage3D,
+    TRACE_glCompressedTexSubImage2D,
+    TRACE_glCompressedTexSubImage1D,
+    TRACE_glClientActiveTexture,
+    TRACE_glMultiTexCoord1d,
+    TRACE_glMultiTexCoord1dv,
+    TRACE_glMultiTexCoord1f,
+    TRACE_glMultiTexCoord1fv,
+    TRACE_glMultiTexCoord1i,
+    TRACE_glMultiTexCoord1iv,
+    TRACE_glMultiTexCoord1s,
+    TRACE_glMultiTexCoord1sv,
+    TRACE_glMultiTexCoord2d,
+    TRACE_glMultiTexCoord2dv,
+    TRACE_glMultiTexCoord2f,
+    TRACE_glMultiTexCoord2fv,
+    TRACE_glMultiTexCoord2i,
+    TRACE_glMultiTexCoord2iv,
+    TRACE_glMultiTexCoord2s,
+    TRACE_glMultiTexCoord2sv,
+    TRACE_glMultiTexCoord3d,
+    TRACE_glMultiTexCoord3dv,
+    TRACE_glMultiTexCoord3f,
+    TRACE_glMultiTexCoord3fv,
+    TRACE_glMultiTexCoord3i,
+    TRACE_glMultiTexCoord3iv,
+    TRACE_glMultiTexCoord3s,
+    TRACE_glMultiTexCoord3sv,
+    TRACE_glMultiTexCoord4d,
+    TRACE_glMultiTexCoord4dv,
+    TRACE_glMultiTexCoord4f,
+    TRACE_glMultiTexCoord4fv,
+    TRACE_glMultiTexCoord4i,
+    TRACE_glMultiTexCoord4iv,
+    TRACE_glMultiTexCoord4s,
+    TRACE_glMultiTexCoord4sv,
+    TRACE_glLoadTransposeMatrixf,
+    TRACE_glLoadTransposeMatrixd,
+    TRACE_glMultTransposeMatrixf,
+    TRACE_glMultTransposeMatrixd,
+    TRACE_glBlendFuncSeparate,
+    TRACE_glMultiDrawArrays,
+    TRACE_glMultiDrawElements,
+    TRACE_glPointParameterf,
+    TRACE_glPointParameterfv,
+    TRACE_glPointParameteri,
+    TRACE_glPointParameteriv,
+    TRACE_glFogCoordf,
+    TRACE_glFogCoordfv,
+    TRACE_glFogCoordd,
+    TRACE_glFogCoorddv,
+    TRACE_glFogCoordPointer,
+    TRACE_glSecondaryColor3b,
+    TRACE_glSecondaryColor3bv,
+    TRACE_glSecondaryColor3d,
+    TRACE_glSecondaryColor3dv,
+    TRACE_glSecondaryColor3f,
+    TRACE_glSecondaryColor3fv,
+    TRACE_glSecondaryColor3i,
+    TRACE_glSecondaryColor3iv,
+    TRACE_glSecondaryColor3s,
+    TRACE_glSecondaryColor3sv,
+    TRACE_glSecondaryColor3ub,
+    TRACE_glSecondaryColor3ubv,
+    TRACE_glSecondaryColor3ui,
+    TRACE_glSecondaryColor3uiv,
+    TRACE_glSecondaryColor3us,
+    TRACE_glSecondaryColor3usv,
+    TRACE_glSecondaryColorPointer,
+    TRACE_glWindowPos2d,
+    TRACE_glWindowPos2dv,
+    TRACE_glWindowPos2f,
+    TRACE_glWindowPos2fv,
+    TRACE_glWindowPos2i,
+    TRACE_glWindowPos2iv,
+    TRACE_glWindowPos2s,
+    TRACE_glWindowPos2sv,
+    TRACE_glWindowPos3d,
+    TRACE_glWindowPos3dv,
+    TRACE_glWindowPos3f,
+    TRACE_glWindowPos3fv,
+    TRACE_glWindowPos3i,
+    TRACE_glWindowPos3iv,
+    TRACE_glWindowPos3s,
+    TRACE_glWindowPos3sv,
+    TRACE_glBlendColor,
+    TRACE_glBlendEquation,
+    TRACE_glGenQueries,
+    TRACE_glDeleteQueries,
+    TRACE_glBeginQuery,
+    TRACE_glEndQuery,
+    TRACE_glBindBuffer,
+    TRACE_glDeleteBuffers,
+    TRACE_glGenBuffers,
+    TRACE_glBufferData,
+    TRACE_glBufferSubData,
+    TRACE_glMapBuffer,
+    TRACE_glUnmapBuffer,
+    TRACE_glBlendEquationSeparate,
+    TRACE_glDrawBuffers,
+    TRACE_glStencilOpSeparate,
+    TRACE_glStencilFuncSeparate,
+    TRACE_glStencilMaskSeparate,
+    TRACE_glAttachShader,
+    TRACE_glBindAttribLocation,
+    TRACE_glCompileShader,
+    TRACE_glCreateProgram,
+    TRACE_glCreateShader,
+    TRACE_glDeleteProgram,
+    TRACE_glDeleteShader,
+    TRACE_glDetachShader,
+    TRACE_glDisableVertexAttribArray,
+    TRACE_glEnableVertexAttribArray,
+    TRACE_glGetUniformLocation,
+    TRACE_glLinkProgram,
+    TRACE_glShaderSource,
+    TRACE_glUseProgram,
+    TRACE_glUniform1f,
+    TRACE_glUniform2f,
+    TRACE_glUniform3f,
+    TRACE_glUniform4f,
+    TRACE_glUniform1i,
+    TRACE_glUniform2i,
+    TRACE_glUniform3i,
+    TRACE_glUniform4i,
+    TRACE_glUniform1fv,
+    TRACE_glUniform2fv,
+    TRACE_glUniform3fv,
+    TRACE_glUniform4fv,
+    TRACE_glUniform1iv,
+    TRACE_glUniform2iv,
+    TRACE_glUniform3iv,
+    TRACE_glUniform4iv,
+    TRACE_glUniformMatrix2fv,
+    TRACE_glUniformMatrix3fv,
+    TRACE_glUniformMatrix4fv,
+    TRACE_glValidateProgram,
+    TRACE_glVertexAttrib1d,
+    TRACE_glVertexAttrib1dv,
+    TRACE_glVertexAttrib1f,
+    TRACE_glVertexAttrib1fv,
+    TRACE_glVertexAttrib1s,
+    TRACE_glVertexAttrib1sv,
+    TRACE_glVertexAttrib2d,
+    TRACE_glVertexAttrib2dv,
+    TRACE_glVertexAttrib2f,
+    TRACE_glVertexAttrib2fv,
+    TRACE_glVertexAttrib2s,
+    TRACE_glVertexAttrib2sv,
+    TRACE_glVertexAttrib3d,
+    TRACE_glVertexAttrib3dv,
+    TRACE_glVertexAttrib3f,
+    TRACE_glVertexAttrib3fv,
+    TRACE_glVertexAttrib3s,
+    TRACE_glVertexAttrib3sv,
+    TRACE_glVertexAttrib4Nbv,
+    TRACE_glVertexAttrib4Niv,
+    TRACE_glVertexAttrib4Nsv,
+    TRACE_glVertexAttrib4Nub,
+    TRACE_glVertexAttrib4Nubv,
+    TRACE_glVertexAttrib4Nuiv,
+    TRACE_glVertexAttrib4Nusv,
+    TRACE_glVertexAttrib4bv,
+    TRACE_glVertexAttrib4d,
+    TRACE_glVertexAttrib4dv,
+    TRACE_glVertexAttrib4f,
+    TRACE_glVertexAttrib4fv,
+    TRACE_glVertexAttrib4iv,
+    TRACE_glVertexAttrib4s,
+    TRACE_glVertexAttrib4sv,
+    TRACE_glVertexAttrib4ubv,
+    TRACE_glVertexAttrib4uiv,
+    TRACE_glVertexAttrib4usv,
+    TRACE_glVertexAttribPointer,
+    TRACE_glUniformMatrix2x3fv,
+    TRACE_glUniformMatrix3x2fv,
+    TRACE_glUniformMatrix2x4fv,
+    TRACE_glUniformMatrix4x2fv,
+    TRACE_glUniformMatrix3x4fv,
+    TRACE_glUniformMatrix4x3fv,
+    TRACE_glColorMaski,
+    TRACE_glEnablei,
+    TRACE_glDisablei,
+    TRACE_glBeginTransformFeedback,
+    TRACE_glEndTransformFeedback,
+    TRACE_glBindBufferRange,
+    TRACE_glBindBufferBase,
+    TRACE_glTransformFeedbackVaryings,
+    TRACE_glClampColor,
+    TRACE_glBeginConditionalRender,
+    TRACE_glEndConditionalRender,
+    TRACE_glVertexAttribIPointer,
+    TRACE_glVertexAttribI1i,
+    TRACE_glVertexAttribI2i,
+    TRACE_glVertexAttribI3i,
+    TRACE_glVertexAttribI4i,
+    TRACE_glVertexAttribI1ui,
+    TRACE_glVertexAttribI2ui,
+    TRACE_glVertexAttribI3ui,
+    TRACE_glVertexAttribI4ui,
+    TRACE_glVertexAttribI1iv,
+    TRACE_glVertexAttribI2iv,
+    TRACE_glVertexAttribI3iv,
+    TRACE_glVertexAttribI4iv,
+    TRACE_glVertexAttribI1uiv,
+    TRACE_glVertexAttribI2uiv,
+    TRACE_glVertexAttribI3uiv,
+    TRACE_glVertexAttribI4uiv,
+    TRACE_glVertexAttribI4bv,
+    TRACE_glVertexAttribI4sv,
+    TRACE_glVertexAttribI4ubv,
+    TRACE_glVertexAttribI4usv,
+    TRACE_glBindFragDataLocation,
+    TRACE_glUniform1ui,
+    TRACE_glUniform2ui,
+    TRACE_glUniform3ui,
+    TRACE_glUniform4ui,
+    TRACE_glUniform1uiv,
+    TRACE_glUniform2uiv,
+    TRACE_glUniform3uiv,
+    TRACE_glUniform4uiv,
+    TRACE_glTexParameterIiv,
+    TRACE_glTexParameterIuiv,
+    TRACE_glClearBufferiv,
+    TRACE_glClearBufferuiv,
+    TRACE_glClearBufferfv,
+    TRACE_glClearBufferfi,
+    TRACE_glBindRenderbuffer,
+    TRACE_glDeleteRenderbuffers,
+    TRACE_glGenRenderbuffers,
+    TRACE_glRenderbufferStorage,
+    TRACE_glBindFramebuffer,
+    TRACE_glDeleteFramebuffers,
+    TRACE_glGenFramebuffers,
+    TRACE_glFramebufferTexture1D,
+    TRACE_glFramebufferTexture2D,
+    TRACE_glFramebufferTexture3D,
+    TRACE_glFramebufferRenderbuffer,
+    TRACE_glGenerateMipmap,
+    TRACE_glBlitFramebuffer,
+    TRACE_glRenderbufferStorageMultisample,
+    TRACE_glFramebufferTextureLayer,
+    TRACE_glMapBufferRange,
+    TRACE_glFlushMappedBufferRange,
+    TRACE_glBindVertexArray,
+    TRACE_glDeleteVertexArrays,
+    TRACE_glGenVertexArrays,
+    TRACE_glDrawArraysInstanced,
+    TRACE_glDrawElementsInstanced,
+    TRACE_glTexBuffer,
+    TRACE_glPrimitiveRestartIndex,
+    TRACE_glCopyBufferSubData,
+    TRACE_glUniformBlockBinding,
+    TRACE_glDrawElementsBaseVertex,
+    TRACE_glDrawRangeElementsBaseVertex,
+    TRACE_glDrawElementsInstancedBaseVertex,
+    TRACE_glMultiDrawElementsBaseVertex,
+    TRACE_glProvokingVertex,
+    TRACE_glFenceSync,
+    TRACE_glDeleteSync,
+    TRACE_glClientWaitSync,
+    TRACE_glWaitSync,
+    TRACE_glFramebufferTexture,
+    TRACE_glTexImage2DMultisample,
+    TRACE_glTexImage3DMultisample,
+    TRACE_glSampleMaski,
+    TRACE_glBindFragDataLocationIndexed,
+    TRACE_glGenSamplers,
+    TRACE_glDeleteSamplers,
+    TRACE_glBindSampler,
+    TRACE_glSamplerParameteri,
+    TRACE_glSamplerParameteriv,
+    TRACE_glSamplerParameterf,
+    TRACE_glSamplerParameterfv,
+    TRACE_glSamplerParameterIiv,
+    TRACE_glSamplerParameterIuiv,
+    TRACE_glQueryCounter,
+    TRACE_glVertexAttribDivisor,
+    TRACE_glVertexAttribP1ui,
+    TRACE_glVertexAttribP1uiv,
+    TRACE_glVertexAttribP2ui,
+    TRACE_glVertexAttribP2uiv,
+    TRACE_glVertexAttribP3ui,
+    TRACE_glVertexAttribP3uiv,
+    TRACE_glVertexAttribP4ui,
+    TRACE_glVertexAttribP4uiv,
+    TRACE_glVertexP2ui,
+    TRACE_glVertexP2uiv,
+    TRACE_glVertexP3ui,
+    TRACE_glVertexP3uiv,
+    TRACE_glVertexP4ui,
+    TRACE_glVertexP4uiv,
+    TRACE_glTexCoordP1ui,
+    TRACE_glTexCoordP1uiv,
+    TRACE_glTexCoordP2ui,
+    TRACE_glTexCoordP2uiv,
+    TRACE_glTexCoordP3ui,
+    TRACE_glTexCoordP3uiv,
+    TRACE_glTexCoordP4ui,
+    TRACE_glTexCoordP4uiv,
+    TRACE_glMultiTexCoordP1ui,
+    TRACE_glMultiTexCoordP1uiv,
+    TRACE_glMultiTexCoordP2ui,
+    TRACE_glMultiTexCoordP2uiv,
+    TRACE_glMultiTexCoordP3ui,
+    TRACE_glMultiTexCoordP3uiv,
+    TRACE_glMultiTexCoordP4ui,
+    TRACE_glMultiTexCoordP4uiv,
+    TRACE_glNormalP3ui,
+    TRACE_glNormalP3uiv,
+    TRACE_glColorP3ui,
+    TRACE_glColorP3uiv,
+    TRACE_glColorP4ui,
+    TRACE_glColorP4uiv,
+    TRACE_glSecondaryColorP3ui,
+    TRACE_glSecondaryColorP3uiv,
+    TRACE_glMinSampleShading,
+    TRACE_glBlendEquationi,
+    TRACE_glBlendEquationSeparatei,
+    TRACE_glBlendFunci,
+    TRACE_glBlendFuncSeparatei,
+    TRACE_glDrawArraysIndirect,
+    TRACE_glDrawElementsIndirect,
+    TRACE_glUniform1d,
+    TRACE_glUniform2d,
+    TRACE_glUniform3d,
+    TRACE_glUniform4d,
+    TRACE_glUniform1dv,
+    TRACE_glUniform2dv,
+    TRACE_glUniform3dv,
+    TRACE_glUniform4dv,
+    TRACE_glUniformMatrix2dv,
+    TRACE_glUniformMatrix3dv,
+    TRACE_glUniformMatrix4dv,
+    TRACE_glUniformMatrix2x3dv,
+    TRACE_glUniformMatrix2x4dv,
+    TRACE_glUniformMatrix3x2dv,
+    TRACE_glUniformMatrix3x4dv,
+    TRACE_glUniformMatrix4x2dv,
+    TRACE_glUniformMatrix4x3dv,
+    TRACE_glUniformSubroutinesuiv,
+    TRACE_glPatchParameteri,
+    TRACE_glPatchParameterfv,
+    TRACE_glBindTransformFeedback,
+    TRACE_glDeleteTransformFeedbacks,
+    TRACE_glGenTransformFeedbacks,
+    TRACE_glPauseTransformFeedback,
+    TRACE_glResumeTransformFeedback,
+    TRACE_glDrawTransformFeedback,
+    TRACE_glDrawTransformFeedbackStream,
+    TRACE_glBeginQueryIndexed,
+    TRACE_glEndQueryIndexed,
+    TRACE_glReleaseShaderCompiler,
+    TRACE_glShaderBinary,
+    TRACE_glDepthRangef,
+    TRACE_glClearDepthf,
+    TRACE_glProgramBinary,
+    TRACE_glProgramParameteri,
+    TRACE_glUseProgramStages,
+    TRACE_glActiveShaderProgram,
+    TRACE_glCreateShaderProgramv,
+    TRACE_glBindProgramPipeline,
+    TRACE_glDeleteProgramPipelines,
+    TRACE_glGenProgramPipelines,
+    TRACE_glProgramUniform1i,
+    TRACE_glProgramUniform1iv,
+    TRACE_glProgramUniform1f,
+    TRACE_glProgramUniform1fv,
+    TRACE_glProgramUniform1d,
+    TRACE_glProgramUniform1dv,
+    TRACE_glProgramUniform1ui,
+    TRACE_glProgramUniform1uiv,
+    TRACE_glProgramUniform2i,
+    TRACE_glProgramUniform2iv,
+    TRACE_glProgramUniform2f,
+    TRACE_glProgramUniform2fv,
+    TRACE_glProgramUniform2d,
+    TRACE_glProgramUniform2dv,
+    TRACE_glProgramUniform2ui,
+    TRACE_glProgramUniform2uiv,
+    TRACE_glProgramUniform3i,
+    TRACE_glProgramUniform3iv,
+    TRACE_glProgramUniform3f,
+    TRACE_glProgramUniform3fv,
+    TRACE_glProgramUniform3d,
+    TRACE_glProgramUniform3dv,
+    TRACE_glProgramUniform3ui,
+    TRACE_glProgramUniform3uiv,
+    TRACE_glProgramUniform4i,
+    TRACE_glProgramUniform4iv,
+    TRACE_glProgramUniform4f,
+    TRACE_glProgramUniform4fv,
+    TRACE_glProgramUniform4d,
+    TRACE_glProgramUniform4dv,
+    TRACE_glProgramUniform4ui,
+    TRACE_glProgramUniform4uiv,
+    TRACE_glProgramUniformMatrix2fv,
+    TRACE_glProgramUniformMatrix3fv,
+    TRACE_glProgramUniformMatrix4fv,
+    TRACE_glProgramUniformMatrix2dv,
+    TRACE_glProgramUniformMatrix3dv,
+    TRACE_glProgramUniformMatrix4dv,
+    TRACE_glProgramUniformMatrix2x3fv,
+    TRACE_glProgramUniformMatrix3x2fv,
+    TRACE_glProgramUniformMatrix2x4fv,
+    TRACE_glProgramUniformMatrix4x2fv,
+    TRACE_glProgramUniformMatrix3x4fv,
+    TRACE_glProgramUniformMatrix4x3fv,
+    TRACE_glProgramUniformMatrix2x3dv,
+    TRACE_glProgramUniformMatrix3x2dv,
+    TRACE_glProgramUniformMatrix2x4dv,
+    TRACE_glProgramUniformMatrix4x2dv,
+    TRACE_glProgramUniformMatrix3x4dv,
+    TRACE_glProgramUniformMatrix4x3dv,
+    TRACE_glValidateProgramPipeline,
+    TRACE_glVertexAttribL1d,
+    TRACE_glVertexAttribL2d,
+    TRACE_glVertexAttribL3d,
+    TRACE_glVertexAttribL4d,
+    TRACE_glVertexAttribL1dv,
+    TRACE_glVertexAttribL2dv,
+    TRACE_glVertexAttribL3dv,
+    TRACE_glVertexAttribL4dv,
+    TRACE_glVertexAttribLPointer,
+    TRACE_glViewportArrayv,
+    TRACE_glViewportIndexedf,
+    TRACE_glViewportIndexedfv,
+    TRACE_glScissorArrayv,
+    TRACE_glScissorIndexed,
+    TRACE_glScissorIndexedv,
+    TRACE_glDepthRangeArrayv,
+    TRACE_glDepthRangeIndexed,
+    TRACE_glDrawArraysInstancedBaseInstance,
+    TRACE_glDrawElementsInstancedBaseInstance,
+    TRACE_glDrawElementsInstancedBaseVertexBaseInstance,
+    TRACE_glBindImageTexture,
+    TRACE_glMemoryBarrier,
+    TRACE_glTexStorage1D,
+    TRACE_glTexStorage2D,
+    TRACE_glTexStorage3D,
+    TRACE_glDrawTransformFeedbackInstanced,
+    TRACE_glDrawTransformFeedbackStreamInstanced,
+    TRACE_glClearBufferData,
+    TRACE_glClearBufferSubData,
+    TRACE_glDispatchCompute,
+    TRACE_glDispatchComputeIndirect,
+    TRACE_glCopyImageSubData,
+    TRACE_glFramebufferParameteri,
+    TRACE_glInvalidateTexSubImage,
+    TRACE_glInvalidateTexImage,
+    TRACE_glInvalidateBufferSubData,
+    TRACE_glInvalidateBufferData,
+    TRACE_glInvalidateFramebuffer,
+    TRACE_glInvalidateSubFramebuffer,
+    TRACE_glMultiDrawArraysIndirect,
+    TRACE_glMultiDrawElementsIndirect,
+    TRACE_glShaderStorageBlockBinding,
+    TRACE_glTexBufferRange,
+    TRACE_glTexStorage2DMultisample,
+    TRACE_glTexStorage3DMultisample,
+    TRACE_glTextureView,
+    TRACE_glBindVertexBuffer,
+    TRACE_glVertexAttribFormat,
+    TRACE_glVertexAttribIFormat,
+    TRACE_glVertexAttribLFormat,
+    TRACE_glVertexAttribBinding,
+    TRACE_glVertexBindingDivisor,
+    TRACE_glDebugMessageControl,
+    TRACE_glDebugMessageInsert,
+    TRACE_glPushDebugGroup,
+    TRACE_glPopDebugGroup,
+    TRACE_glObjectLabel,
+    TRACE_glObjectPtrLabel,
+    TRACE_glBufferStorage,
+    TRACE_glClearTexImage,
+    TRACE_glClearTexSubImage,
+    TRACE_glBindBuffersBase,
+    TRACE_glBindBuffersRange,
+    TRACE_glBindTextures,
+    TRACE_glBindSamplers,
+    TRACE_glBindImageTextures,
+    TRACE_glBindVertexBuffers,
+    TRACE_glClipControl,
+    TRACE_glCreateTransformFeedbacks,
+    TRACE_glTransformFeedbackBufferBase,
+    TRACE_glTransformFeedbackBufferRange,
+    TRACE_glCreateBuffers,
+    TRACE_glNamedBufferStorage,
+    TRACE_glNamedBufferData,
+    TRACE_glNamedBufferSubData,
+    TRACE_glCopyNamedBufferSubData,
+    TRACE_glClearNamedBufferData,
+    TRACE_glClearNamedBufferSubData,
+    TRACE_glMapNamedBuffer,
+    TRACE_glMapNamedBufferRange,
+    TRACE_glUnmapNamedBuffer,
+    TRACE_glFlushMappedNamedBufferRange,
+    TRACE_glCreateFramebuffers,
+    TRACE_glNamedFramebufferRenderbuffer,
+    TRACE_glNamedFramebufferParameteri,
+    TRACE_glNamedFramebufferTexture,
+    TRACE_glNamedFramebufferTextureLayer,
+    TRACE_glNamedFramebufferDrawBuffer,
+    TRACE_glNamedFramebufferDrawBuffers,
+    TRACE_glNamedFramebufferReadBuffer,
+    TRACE_glInvalidateNamedFramebufferData,
+    TRACE_glInvalidateNamedFramebufferSubData,
+    TRACE_glClearNamedFramebufferiv,
+    TRACE_glClearNamedFramebufferuiv,
+    TRACE_glClearNamedFramebufferfv,
+    TRACE_glClearNamedFramebufferfi,
+    TRACE_glBlitNamedFramebuffer,
+    TRACE_glCreateRenderbuffers,
+    TRACE_glNamedRenderbufferStorage,
+    TRACE_glNamedRenderbufferStorageMultisample,
+    TRACE_glCreateTextures,
+    TRACE_glTextureBuffer,
+    TRACE_glTextureBufferRange,
+    TRACE_glTextureStorage1D,
+    TRACE_glTextureStorage2D,
+    TRACE_glTextureStorage3D,
+    TRACE_glTextureStorage2DMultisample,
+    TRACE_glTextureStorage3DMultisample,
+    TRACE_glTextureSubImage1D,
+    TRACE_glTextureSubImage2D,
+    TRACE_glTextureSubImage3D,
+    TRACE_glCompressedTextureSubImage1D,
+    TRACE_glCompressedTextureSubImage2D,
+    TRACE_glCompressedTextureSubImage3D,
+    TRACE_glCopyTextureSubImage1D,
+    TRACE_glCopyTextureSubImage2D,
+    TRACE_glCopyTextureSubImage3D,
+    TRACE_glTextureParameterf,
+    TRACE_glTextureParameterfv,
+    TRACE_glTextureParameteri,
+    TRACE_glTextureParameterIiv,
+    TRACE_glTextureParameterIuiv,
+    TRACE_glTextureParameteriv,
+    TRACE_glGenerateTextureMipmap,
+    TRACE_glBindTextureUnit,
+    TRACE_glCreateVertexArrays,
+    TRACE_glDisableVertexArrayAttrib,
+    TRACE_glEnableVertexArrayAttrib,
+    TRACE_glVertexArrayElementBuffer,
+    TRACE_glVertexArrayVertexBuffer,
+    TRACE_glVertexArrayVertexBuffers,
+    TRACE_glVertexArrayAttribBinding,
+    TRACE_glVertexArrayAttribFormat,
+    TRACE_glVertexArrayAttribIFormat,
+    TRACE_glVertexArrayAttribLFormat,
+    TRACE_glVertexArrayBindingDivisor,
+    TRACE_glCreateSamplers,
+    TRACE_glCreateProgramPipelines,
+    TRACE_glCreateQueries,
+    TRACE_glMemoryBarrierByRegion,
+    TRACE_glReadnPixels,
+    TRACE_glTextureBarrier,
+    TRACE_glSpecializeShader,
+    TRACE_glMultiDrawArraysIndirectCount,
+    TRACE_glMultiDrawElementsIndirectCount,
+    TRACE_glPolygonOffsetClamp,
+    TRACE_COMMAND_END
+};
+
+static const char *trace_command_names[TRACE_COMMAND_END - TRACE_FIRST_COMMAND] = {
+    "glCullFace", "glFrontFace", "glHint", "glLineWidth",
+    "glPointSize", "glPolygonMode", "glScissor", "glTexParameterf",
+    "glTexParameterfv", "glTexParameteri", "glTexParameteriv", "glTexImage1D",
+    "glTexImage2D", "glDrawBuffer", "glClear", "glClearColor",
+    "glClearStencil", "glClearDepth", "glStencilMask", "glColorMask",
+    "glDepthMask", "glDisable", "glEnable", "glFinish",
+    "glFlush", "glBlendFunc", "glLogicOp", "glStencilFunc",
+    "glStencilOp", "glDepthFunc", "glPixelStoref", "glPixelStorei",
+    "glReadBuffer", "glReadPixels", "glDepthRange", "glViewport",
+    "glNewList", "glEndList", "glCallList", "glCallLists",
+    "glDeleteLists", "glGenLists", "glListBase", "glBegin",
+    "glBitmap", "glColor3b", "glColor3bv", "glColor3d",
+    "glColor3dv", "glColor3f", "glColor3fv", "glColor3i",
+    "glColor3iv", "glColor3s", "glColor3sv", "glColor3ub",
+    "glColor3ubv", "glColor3ui", "glColor3uiv", "glColor3us",
+    "glColor3usv", "glColor4b", "glColor4bv", "glColor4d",
+    "glColor4dv", "glColor4f", "glColor4fv", "glColor4i",
+    "glColor4iv", "glColor4s", "glColor4sv", "glColor4ub",
+    "glColor4ubv", "glColor4ui", "glColor4uiv", "glColor4us",
+    "glColor4usv", "glEdgeFlag", "glEdgeFlagv", "glEnd",
+    "glIndexd", "glIndexdv", "glIndexf", "glIndexfv",
+    "glIndexi", "glIndexiv", "glIndexs", "glIndexsv",
+    "glNormal3b", "glNormal3bv", "glNormal3d", "glNormal3dv",
+    "glNormal3f", "glNormal3fv", "glNormal3i", "glNormal3iv",
+    "glNormal3s", "glNormal3sv", "glRasterPos2d", "glRasterPos2dv",
+    "glRasterPos2f", "glRasterPos2fv", "glRasterPos2i", "glRasterPos2iv",
+    "glRasterPos2s", "glRasterPos2sv", "glRasterPos3d", "glRasterPos3dv",
+    "glRasterPos3f", "glRasterPos3fv", "glRasterPos3i", "glRasterPos3iv",
+    "glRasterPos3s", "glRasterPos3sv", "glRasterPos4d", "glRasterPos4dv",
+    "glRasterPos4f", "glRasterPos4fv", "glRasterPos4i", "glRasterPos4iv",
+    "glRasterPos4s", "glRasterPos4sv", "glRectd", "glRectdv",
+    "glRectf", "glRectfv", "glRecti", "glRectiv",
+    "glRects", "glRectsv", "glTexCoord1d", "glTexCoord1dv",
+    "glTexCoord1f", "glTexCoord1fv", "glTexCoord1i", "glTexCoord1iv",
+    "glTexCoord1s", "glTexCoord1sv", "glTexCoord2d", "glTexCoord2dv",
+    "glTexCoord2f", "glTexCoord2fv", "glTexCoord2i", "glTexCoord2iv",
+    "glTexCoord2s", "glTexCoord2sv", "glTexCoord3d", "glTexCoord3dv",
+    "glTexCoord3f", "glTexCoord3fv", "glTexCoord3i", "glTexCoord3iv",
+    "glTexCoord3s", "glTexCoord3sv", "glTexCoord4d", "glTexCoord4dv",
+    "glTexCoord4f", "glTexCoord4fv", "glTexCoord4i", "glTexCoord4iv",
+    "glTexCoord4s", "glTexCoord4sv", "glVertex2d", "glVertex2dv",
+    "glVertex2f", "glVertex2fv", "glVertex2i", "glVertex2iv",
+    "glVertex2s", "glVertex2sv", "glVertex3d", "glVertex3dv",
+    "glVertex3f", "glVertex3fv", "glVertex3i", "glVertex3iv",
+    "glVertex3s", "glVertex3sv", "glVertex4d", "glVertex4dv",
+    "glVertex4f", "glVertex4fv", "glVertex4i", "glVertex4iv",
+    "glVertex4s", "glVertex4sv", "glClipPlane", "glColorMaterial",
+    "glFogf", "glFogfv", "glFogi", "glFogiv",
+    "glLightf", "glLightfv", "glLighti", "glLightiv",
+    "glLightModelf", "glLightModelfv", "glLightModeli", "glLightModeliv",
+    "glLineStipple", "glMaterialf", "glMaterialfv", "glMateriali",
+    "glMaterialiv", "glPolygonStipple", "glShadeModel", "glTexEnvf",
+    "glTexEnvfv", "glTexEnvi", "glTexEnviv", "glTexGend",
+    "glTexGendv", "glTexGenf", "glTexGenfv", "glTexGeni",
+    "glTexGeniv", "glInitNames", "glLoadName", "glPassThrough",
+    "glPopName", "glPushName", "glClearAccum", "glClearIndex",
+    "glIndexMask", "glAccum", "glPopAttrib", "glPushAttrib",
+    "glMap1d", "glMap1f", "glMap2d", "glMap2f",
+    "glMapGrid1d", "glMapGrid1f", "glMapGrid2d", "glMapGrid2f",
+    "glEvalCoord1d", "glEvalCoord1dv", "glEvalCoord1f", "glEvalCoord1fv",
+    "glEvalCoord2d", "glEvalCoord2dv", "glEvalCoord2f", "glEvalCoord2fv",
+    "glEvalMesh1", "glEvalPoint1", "glEvalMesh2", "glEvalPoint2",
+    "glAlphaFunc", "glPixelZoom", "glPixelTransferf", "glPixelTransferi",
+    "glPixelMapfv", "glPixelMapuiv", "glPixelMapusv", "glCopyPixels",
+    "glDrawPixels", "glFrustum", "glLoadIdentity", "glLoadMatrixf",
+    "glLoadMatrixd", "glMatrixMode", "glMultMatrixf", "glMultMatrixd",
+    "glOrtho", "glPopMatrix", "glPushMatrix", "glRotated",
+    "glRotatef", "glScaled", "glScalef", "glTranslated",
+    "glTranslatef", "glDrawArrays", "glDrawElements", "glPolygonOffset",
+    "glCopyTexImage1D", "glCopyTexImage2D", "glCopyTexSubImage1D", "glCopyTexSubImage2D",
+    "glTexSubImage1D", "glTexSubImage2D", "glBindTexture", "glDeleteTextures",
+    "glGenTextures", "glArrayElement", "glColorPointer", "glDisableClientState",
+    "glEdgeFlagPointer", "glEnableClientState", "glIndexPointer", "glInterleavedArrays",
+    "glNormalPointer", "glTexCoordPointer", "glVertexPointer", "glPrioritizeTextures",
+    "glIndexub", "glIndexubv", "glPopClientAttrib", "glPushClientAttrib",
+    "glDrawRangeElements", "glTexImage3D", "glTexSubImage3D", "glCopyTexSubImage3D",
+    "glActiveTexture", "glSampleCoverage", "glCompressedTexImage3D", "glCompressedTexImage2D",
+    "glCompressedTexImage1D", "glCompressedTexSubImage3D", "glCompressedTexSubImage2D", "glCompressedTexSubImage1D",
+    "glClientActiveTexture", "glMultiTexCoord1d", "glMultiTexCoord1dv", "glMultiTexCoord1f",
+    "glMultiTexCoord1fv", "glMultiTexCoord1i", "glMultiTexCoord1iv", "glMultiTexCoord1s",
+    "glMultiTexCoord1sv", "glMultiTexCoord2d", "glMultiTexCoord2dv", "glMultiTexCoord2f",
+    "glMultiTexCoord2fv", "glMultiTexCoord2i", "glMultiTexCoord2iv", "glMultiTexCoord2s",
+    "glMultiTexCoord2sv", "glMultiTexCoord3d", "glMultiTexCoord3dv", "glMultiTexCoord3f",
+    "glMultiTexCoord3fv", "glMultiTexCoord3i", "glMultiTexCoord3iv", "glMultiTexCoord3s",
+    "glMultiTexCoord3sv", "glMultiTexCoord4d", "glMultiTexCoord4dv", "glMultiTexCoord4f",
+    "glMultiTexCoord4fv", "glMultiTexCoord4i", "glMultiTexCoord4iv", "glMultiTexCoord4s",
+    "glMultiTexCoord4sv", "glLoadTransposeMatrixf", "glLoadTransposeMatrixd", "glMultTransposeMatrixf",
+    "glMultTransposeMatrixd", "glBlendFuncSeparate", "glMultiDrawArrays", "glMultiDrawElements",
+    "glPointParameterf", "glPointParameterfv", "glPointParameteri", "glPointParameteriv",
+    "glFogCoordf", "glFogCoordfv", "glFogCoordd", "glFogCoorddv",
+    "glFogCoordPointer", "glSecondaryColor3b", "glSecondaryColor3bv", "glSecondaryColor3d",
+    "glSecondaryColor3dv", "glSecondaryColor3f", "glSecondaryColor3fv", "glSecondaryColor3i",
+    "glSecondaryColor3iv", "glSecondaryColor3s", "glSecondaryColor3sv", "glSecondaryColor3ub",
+    "glSecondaryColor3ubv", "glSecondaryColor3ui", "glSecondaryColor3uiv", "glSecondaryColor3us",
+    "glSecondaryColor3usv", "glSecondaryColorPointer", "glWindowPos2d", "glWindowPos2dv",
+    "glWindowPos2f", "glWindowPos2fv", "glWindowPos2i", "glWindowPos2iv",
+    "glWindowPos2s", "glWindowPos2sv", "glWindowPos3d", "glWindowPos3dv",
+    "glWindowPos3f", "glWindowPos3fv", "glWindowPos3i", "glWindowPos3iv",
+    "glWindowPos3s", "glWindowPos3sv", "glBlendColor", "glBlendEquation",
+    "glGenQueries", "glDeleteQueries", "glBeginQuery", "glEndQuery",
+    "glBindBuffer", "glDeleteBuffers", "glGenBuffers", "glBufferData",
+    "glBufferSubData", "glMapBuffer", "glUnmapBuffer", "glBlendEquationSeparate",
+    "glDrawBuffers", "glStencilOpSeparate", "glStencilFuncSeparate", "glStencilMaskSeparate",
+    "glAttachShader", "glBindAttribLocation", "glCompileShader", "glCreateProgram",
+    "glCreateShader", "glDeleteProgram", "glDeleteShader", "glDetachShader",
+    "glDisableVertexAttribArray", "glEnableVertexAttribArray", "glGetUniformLocation", "glLinkProgram",
+    "glShaderSource", "glUseProgram", "glUniform1f", "glUniform2f",
+    "glUniform3f", "glUniform4f", "glUniform1i", "glUniform2i",
+    "glUniform3i", "glUniform4i", "glUniform1fv", "glUniform2fv",
+    "glUniform3fv", "glUniform4fv", "glUniform1iv", "glUniform2iv",
+    "glUniform3iv", "glUniform4iv", "glUniformMatrix2fv", "glUniformMatrix3fv",
+    "glUniformMatrix4fv", "glValidateProgram", "glVertexAttrib1d", "glVertexAttrib1dv",
+    "glVertexAttrib1f", "glVertexAttrib1fv", "glVertexAttrib1s", "glVertexAttrib1sv",
+    "glVertexAttrib2d", "glVertexAttrib2dv", "glVertexAttrib2f", "glVertexAttrib2fv",
+    "glVertexAttrib2s", "glVertexAttrib2sv", "glVertexAttrib3d", "glVertexAttrib3dv",
+    "glVertexAttrib3f", "glVertexAttrib3fv", "glVertexAttrib3s", "glVertexAttrib3sv",
+    "glVertexAttrib4Nbv", "glVertexAttrib4Niv", "glVertexAttrib4Nsv", "glVertexAttrib4Nub",
+    "glVertexAttrib4Nubv", "glVertexAttrib4Nuiv", "glVertexAttrib4Nusv", "glVertexAttrib4bv",
+    "glVertexAttrib4d", "glVertexAttrib4dv", "glVertexAttrib4f", "glVertexAttrib4fv",
+    "glVertexAttrib4iv", "glVertexAttrib4s", "glVertexAttrib4sv", "glVertexAttrib4ubv",
+    "glVertexAttrib4uiv", "glVertexAttrib4usv", "glVertexAttribPointer", "glUniformMatrix2x3fv",
+    "glUniformMatrix3x2fv", "glUniformMatrix2x4fv", "glUniformMatrix4x2fv", "glUniformMatrix3x4fv",
+    "glUniformMatrix4x3fv", "glColorMaski", "glEnablei", "glDisablei",
+    "glBeginTransformFeedback", "glEndTransformFeedback", "glBindBufferRange", "glBindBufferBase",
+    "glTransformFeedbackVaryings", "glClampColor", "glBeginConditionalRender", "glEndConditionalRender",
+    "glVertexAttribIPointer", "glVertexAttribI1i", "glVertexAttribI2i", "glVertexAttribI3i",
+    "glVertexAttribI4i", "glVertexAttribI1ui", "glVertexAttribI2ui", "glVertexAttribI3ui",
+    "glVertexAttribI4ui", "glVertexAttribI1iv", "glVertexAttribI2iv", "glVertexAttribI3iv",
+    "glVertexAttribI4iv", "glVertexAttribI1uiv", "glVertexAttribI2uiv", "glVertexAttribI3uiv",
+    "glVertexAttribI4uiv", "glVertexAttribI4bv", "glVertexAttribI4sv", "glVertexAttribI4ubv",
+    "glVertexAttribI4usv", "glBindFragDataLocation", "glUniform1ui", "glUniform2ui",
+    "glUniform3ui", "glUniform4ui", "glUniform1uiv", "glUniform2uiv",
+    "glUniform3uiv", "glUniform4uiv", "glTexParameterIiv", "glTexParameterIuiv",
+    "glClearBufferiv", "glClearBufferuiv", "glClearBufferfv", "glClearBufferfi",
+    "glBindRenderbuffer", "glDeleteRenderbuffers", "glGenRenderbuffers", "glRenderbufferStorage",
+    "glBindFramebuffer", "glDeleteFramebuffers", "glGenFramebuffers", "glFramebufferTexture1D",
+    "glFramebufferTexture2D", "glFramebufferTexture3D", "glFramebufferRenderbuffer", "glGenerateMipmap",
+    "glBlitFramebuffer", "glRenderbufferStorageMultisample", "glFramebufferTextureLayer", "glMapBufferRange",
+    "glFlushMappedBufferRange", "glBindVertexArray", "glDeleteVertexArrays", "glGenVertexArrays",
+    "glDrawArraysInstanced", "glDrawElementsInstanced", "glTexBuffer", "glPrimitiveRestartIndex",
+    "glCopyBufferSubData", "glUniformBlockBinding", "glDrawElementsBaseVertex", "glDrawRangeElementsBaseVertex",
+    "glDrawElementsInstancedBaseVertex", "glMultiDrawElementsBaseVertex", "glProvokingVertex", "glFenceSync",
+    "glDeleteSync", "glClientWaitSync", "glWaitSync", "glFramebufferTexture",
+    "glTexImage2DMultisample", "glTexImage3DMultisample", "glSampleMaski", "glBindFragDataLocationIndexed",
+    "glGenSamplers", "glDeleteSamplers", "glBindSampler", "glSamplerParameteri",
+    "glSamplerParameteriv", "glSamplerParameterf", "glSamplerParameterfv", "glSamplerParameterIiv",
+    "glSamplerParameterIuiv", "glQueryCounter", "glVertexAttribDivisor", "glVertexAttribP1ui",
+    "glVertexAttribP1uiv", "glVertexAttribP2ui", "glVertexAttribP2uiv", "glVertexAttribP3ui",
+    "glVertexAttribP3uiv", "glVertexAttribP4ui", "glVertexAttribP4uiv", "glVertexP2ui",
+    "glVertexP2uiv", "glVertexP3ui", "glVertexP3uiv", "glVertexP4ui",
+    "glVertexP4uiv", "glTexCoordP1ui", "glTexCoordP1uiv", "glTexCoordP2ui",
+    "glTexCoordP2uiv", "glTexCoordP3ui", "glTexCoordP3uiv", "glTexCoordP4ui",
+    "glTexCoordP4uiv", "glMultiTexCoordP1ui", "glMultiTexCoordP1uiv", "glMultiTexCoordP2ui",
+    "glMultiTexCoordP2uiv", "glMultiTexCoordP3ui", "glMultiTexCoordP3uiv", "glMultiTexCoordP4ui",
+    "glMultiTexCoordP4uiv", "glNormalP3ui", "glNormalP3uiv", "glColorP3ui",
+    "glColorP3uiv", "glColorP4ui", "glColorP4uiv", "glSecondaryColorP3ui",
+    "glSecondaryColorP3uiv", "glMinSampleShading", "glBlendEquationi", "glBlendEquationSeparatei",
+    "glBlendFunci", "glBlendFuncSeparatei", "glDrawArraysIndirect", "glDrawElementsIndirect",
+    "glUniform1d", "glUniform2d", "glUniform3d", "glUniform4d",
+    "glUniform1dv", "glUniform2dv", "glUniform3dv", "glUniform4dv",
+    "glUniformMatrix2dv", "glUniformMatrix3dv", "glUniformMatrix4dv", "glUniformMatrix2x3dv",
+    "glUniformMatrix2x4dv", "glUniformMatrix3x2dv", "glUniformMatrix3x4dv", "glUniformMatrix4x2dv",
+    "glUniformMatrix4x3dv", "glUniformSubroutinesuiv", "glPatchParameteri", "glPatchParameterfv",
+    "glBindTransformFeedback", "glDeleteTransformFeedbacks", "glGenTransformFeedbacks", "glPauseTransformFeedback",
+    "glResumeTransformFeedback", "glDrawTransformFeedback", "glDrawTransformFeedbackStream", "glBeginQueryIndexed",
+    "glEndQueryIndexed", "glReleaseShaderCompiler", "glShaderBinary", "glDepthRangef",
+    "glClearDepthf", "glProgramBinary", "glProgramParameteri", "glUseProgramStages",
+    "glActiveShaderProgram", "glCreateShaderProgramv", "glBindProgramPipeline", "glDeleteProgramPipelines",
+    "glGenProgramPipelines", "glProgramUniform1i", "glProgramUniform1iv", "glProgramUniform1f",
+    "glProgramUniform1fv", "glProgramUniform1d", "glProgramUniform1dv", "glProgramUniform1ui",
+    "glProgramUniform1uiv", "glProgramUniform2i", "glProgramUniform2iv", "glProgramUniform2f",
+    "glProgramUniform2fv", "glProgramUniform2d", "glProgramUniform2dv", "glProgramUniform2ui",
+    "glProgramUniform2uiv", "glProgramUniform3i", "glProgramUniform3iv", "glProgramUniform3f",
+    "glProgramUniform3fv", "glProgramUniform3d", "glProgramUniform3dv", "glProgramUniform3ui",
+    "glProgramUniform3uiv", "glProgramUniform4i", "glProgramUniform4iv", "glProgramUniform4f",
+    "glProgramUniform4fv", "glProgramUniform4d", "glProgramUniform4dv", "glProgramUniform4ui",
+    "glProgramUniform4uiv", "glProgramUniformMatrix2fv", "glProgramUniformMatrix3fv", "glProgramUniformMatrix4fv",
+    "glProgramUniformMatrix2dv", "glProgramUniformMatrix3dv", "glProgramUniformMatrix4dv", "glProgramUniformMatrix2x3fv",
+    "glProgramUniformMatrix3x2fv", "glProgramUniformMatrix2x4fv", "glProgramUniformMatrix4x2fv", "glProgramUniformMatrix3x4fv",
+    "glProgramUniformMatrix4x3fv", "glProgramUniformMatrix2x3dv", "glProgramUniformMatrix3x2dv", "glProgramUniformMatrix2x4dv",
+    "glProgramUniformMatrix4x2dv", "glProgramUniformMatrix3x4dv", "glProgramUniformMatrix4x3dv", "glValidateProgramPipeline",
+    "glVertexAttribL1d", "glVertexAttribL2d", "glVertexAttribL3d", "glVertexAttribL4d",
+    "glVertexAttribL1dv", "glVertexAttribL2dv", "glVertexAttribL3dv", "glVertexAttribL4dv",
+    "glVertexAttribLPointer", "glViewportArrayv", "glViewportIndexedf", "glViewportIndexedfv",
+    "glScissorArrayv", "glScissorIndexed", "glScissorIndexedv", "glDepthRangeArrayv",
+    "glDepthRangeIndexed", "glDrawArraysInstancedBaseInstance", "glDrawElementsInstancedBaseInstance", "glDrawElementsInstancedBaseVertexBaseInstance",
+    "glBindImageTexture", "glMemoryBarrier", "glTexStorage1D", "glTexStorage2D",
+    "glTexStorage3D", "glDrawTransformFeedbackInstanced", "glDrawTransformFeedbackStreamInstanced", "glClearBufferData",
+    "glClearBufferSubData", "glDispatchCompute", "glDispatchComputeIndirect", "glCopyImageSubData",
+    "glFramebufferParameteri", "glInvalidateTexSubImage", "glInvalidateTexImage", "glInvalidateBufferSubData",
+    "glInvalidateBufferData", "glInvalidateFramebuffer", "glInvalidateSubFramebuffer", "glMultiDrawArraysIndirect",
+    "glMultiDrawElementsIndirect", "glShaderStorageBlockBinding", "glTexBufferRange", "glTexStorage2DMultisample",
+    "glTexStorage3DMultisample", "glTextureView", "glBindVertexBuffer", "glVertexAttribFormat",
+    "glVertexAttribIFormat", "glVertexAttribLFormat", "glVertexAttribBinding", "glVertexBindingDivisor",
+    "glDebugMessageControl", "glDebugMessageInsert", "glPushDebugGroup", "glPopDebugGroup",
+    "glObjectLabel", "glObjectPtrLabel", "glBufferStorage", "glClearTexImage",
+    "glClearTexSubImage", "glBindBuffersBase", "glBindBuffersRange", "glBindTextures",
+    "glBindSamplers", "glBindImageTextures", "glBindVertexBuffers", "glClipControl",
+    "glCreateTransformFeedbacks", "glTransformFeedbackBufferBase", "glTransformFeedbackBufferRange", "glCreateBuffers",
+    "glNamedBufferStorage", "glNamedBufferData", "glNamedBufferSubData", "glCopyNamedBufferSubData",
+    "glClearNamedBufferData", "glClearNamedBufferSubData", "glMapNamedBuffer", "glMapNamedBufferRange",
+    "glUnmapNamedBuffer", "glFlushMappedNamedBufferRange", "glCreateFramebuffers", "glNamedFramebufferRenderbuffer",
+    "glNamedFramebufferParameteri", "glNamedFramebufferTexture", "glNamedFramebufferTextureLayer", "glNamedFramebufferDrawBuffer",
+    "glNamedFramebufferDrawBuffers", "glNamedFramebufferReadBuffer", "glInvalidateNamedFramebufferData", "glInvalidateNamedFramebufferSubData",
+    "glClearNamedFramebufferiv", "glClearNamedFramebufferuiv", "glClearNamedFramebufferfv", "glClearNamedFramebufferfi",
+    "glBlitNamedFramebuffer", "glCreateRenderbuffers", "glNamedRenderbufferStorage", "glNamedRenderbufferStorageMultisample",
+    "glCreateTextures", "glTextureBuffer", "glTextureBufferRange", "glTextureStorage1D",
+    "glTextureStorage2D", "glTextureStorage3D", "glTextureStorage2DMultisample", "glTextureStorage3DMultisample",
+    "glTextureSubImage1D", "glTextureSubImage2D", "glTextureSubImage3D", "glCompressedTextureSubImage1D",
+    "glCompressedTextureSubImage2D", "glCompressedTextureSubImage3D", "glCopyTextureSubImage1D", "glCopyTextureSubImage2D",
+    "glCopyTextureSubImage3D", "glTextureParameterf", "glTextureParameterfv", "glTextureParameteri",
+    "glTextureParameterIiv", "glTextureParameterIuiv", "glTextureParameteriv", "glGenerateTextureMipmap",
+    "glBindTextureUnit", "glCreateVertexArrays", "glDisableVertexArrayAttrib", "glEnableVertexArrayAttrib",
+    "glVertexArrayElementBuffer", "glVertexArrayVertexBuffer", "glVertexArrayVertexBuffers", "glVertexArrayAttribBinding",
+    "glVertexArrayAttribFormat", "glVertexArrayAttribIFormat", "glVertexArrayAttribLFormat", "glVertexArrayBindingDivisor",
+    "glCreateSamplers", "glCreateProgramPipelines", "glCreateQueries", "glMemoryBarrierByRegion",
+    "glReadnPixels", "glTextureBarrier", "glSpecializeShader", "glMultiDrawArraysIndirectCount",
+    "glMultiDrawElementsIndirectCount", "glPolygonOffsetClamp",
+};
+
+#define TRACE_COMMANDS_1_0 \
+	X(PFNGLCULLFACEPROC, glCullFace) \
+	X(PFNGLFRONTFACEPROC, glFrontFace) \
+	X(PFNGLHINTPROC, glHint) \
+	X(PFNGLLINEWIDTHPROC, glLineWidth) \
+	X(PFNGLPOINTSIZEPROC, glPointSize) \
+	X(PFNGLPOLYGONMODEPROC, glPolygonMode) \
+	X(PFNGLSCISSORPROC, glScissor) \
+	X(PFNGLTEXPARAMETERFPROC, glTexParameterf) \
+	X(PFNGLTEXPARAMETERFVPROC, glTexParameterfv) \
+	X(PFNGLTEXPARAMETERIPROC, glTexParameteri) \
+	X(PFNGLTEXPARAMETERIVPROC, glTexParameteriv) \
+	X(PFNGLTEXIMAGE1DPROC, glTexImage1D) \
+	X(PFNGLTEXIMAGE2DPROC, glTexImage2D) \
+	X(PFNGLDRAWBUFFERPROC, glDrawBuffer) \
+	X(PFNGLCLEARPROC, glClear) \
+	X(PFNGLCLEARCOLORPROC, glClearColor) \
+	X(PFNGLCLEARSTENCILPROC, glClearStencil) \
+	X(PFNGLCLEARDEPTHPROC, glClearDepth) \
+	X(PFNGLSTENCILMASKPROC, glStencilMask) \
+	X(PFNGLCOLORMASKPROC, glColorMask) \
+	X(PFNGLDEPTHMASKPROC, glDepthMask) \
+	X(PFNGLDISABLEPROC, glDisable) \
+	X(PFNGLENABLEPROC, glEnable) \
+	X(PFNGLFINISHPROC, glFinish) \
+	X(PFNGLFLUSHPROC, glFlush) \
+	X(PFNGLBLENDFUNCPROC, glBlendFunc) \
+	X(PFNGLLOGICOPPROC, glLogicOp) \
+	X(PFNGLSTENCILFUNCPROC, glStencilFunc) \
+	X(PFNGLSTENCILOPPROC, glStencilOp) \
+	X(PFNGLDEPTHFUNCPROC, glDepthFunc) \
+	X(PFNGLPIXELSTOREFPROC, glPixelStoref) \
+	X(PFNGLPIXELSTOREIPROC, glPixelStorei) \
+	X(PFNGLREADBUFFERPROC, glReadBuffer) \
+	X(PFNGLREADPIXELSPROC, glReadPixels) \
+	X(PFNGLDEPTHRANGEPROC, glDepthRange) \
+	X(PFNGLVIEWPORTPROC, glViewport) \
+	X(PFNGLNEWLISTPROC, glNewList) \
+	X(PFNGLENDLISTPROC, glEndList) \
+	X(PFNGLCALLLISTPROC, glCallList) \
+	X(PFNGLCALLLISTSPROC, glCallLists) \
+	X(PFNGLDELETELISTSPROC, glDeleteLists) \
+	X(PFNGLGENLISTSPROC, glGenLists) \
+	X(PFNGLLISTBASEPROC, glListBase) \
+	X(PFNGLBEGINPROC, glBegin) \
+	X(PFNGLBITMAPPROC, glBitmap) \
+	X(PFNGLCOLOR3BPROC, glColor3b) \
+	X(PFNGLCOLOR3BVPROC, glColor3bv) \
+	X(PFNGLCOLOR3DPROC, glColor3d) \
+	X(PFNGLCOLOR3DVPROC, glColor3dv) \
+	X(PFNGLCOLOR3FPROC, glColor3f) \
+	X(PFNGLCOLOR3FVPROC, glColor3fv) \
+	X(PFNGLCOLOR3IPROC, glColor3i) \
+	X(PFNGLCOLOR3IVPROC, glColor3iv) \
+	X(PFNGLCOLOR3SPROC, glColor3s) \
+	X(PFNGLCOLOR3SVPROC, glColor3sv) \
+	X(PFNGLCOLOR3UBPROC, glColor3ub) \
+	X(PFNGLCOLOR3UBVPROC, glColor3ubv) \
+	X(PFNGLCOLOR3UIPROC, glColor3ui) \
+	X(PFNGLCOLOR3UIVPROC, glColor3uiv) \
+	X(PFNGLCOLOR3USPROC, glColor3us) \
+	X(PFNGLCOLOR3USVPROC, glColor3usv) \
+	X(PFNGLCOLOR4BPROC, glColor4b) \
+	X(PFNGLCOLOR4BVPROC, glColor4bv) \
+	X(PFNGLCOLOR4DPROC, glColor4d) \
+	X(PFNGLCOLOR4DVPROC, glColor4dv) \
+	X(PFNGLCOLOR4FPROC, glColor4f) \
+	X(PFNGLCOLOR4FVPROC, glColor4fv) \
+	X(PFNGLCOLOR4IPROC, glColor4i) \
+	X(PFNGLCOLOR4IVPROC, glColor4iv) \
+	X(PFNGLCOLOR4SPROC, glColor4s) \
+	X(PFNGLCOLOR4SVPROC, glColor4sv) \
+	X(PFNGLCOLOR4UBPROC, glColor4ub) \
+	X(PFNGLCOLOR4UBVPROC, glColor4ubv) \
+	X(PFNGLCOLOR4UIPROC, glColor4ui) \
+	X(PFNGLCOLOR4UIVPROC, glColor4uiv) \
+	X(PFNGLCOLOR4USPROC, glColor4us) \
+	X(PFNGLCOLOR4USVPROC, glColor4usv) \
+	X(PFNGLEDGEFLAGPROC, glEdgeFlag) \
+	X(PFNGLEDGEFLAGVPROC, glEdgeFlagv) \
+	X(PFNGLENDPROC, glEnd) \
+	X(PFNGLINDEXDPROC, glIndexd) \
+	X(PFNGLINDEXDVPROC, glIndexdv) \
+	X(PFNGLINDEXFPROC, glIndexf) \
+	X(PFNGLINDEXFVPROC, glIndexfv) \
+	X(PFNGLINDEXIPROC, glIndexi) \
+	X(PFNGLINDEXIVPROC, glIndexiv) \
+	X(PFNGLINDEXSPROC, glIndexs) \
+	X(PFNGLINDEXSVPROC, glIndexsv) \
+	X(PFNGLNORMAL3BPROC, glNormal3b) \
+	X(PFNGLNORMAL3BVPROC, glNormal3bv) \
+	X(PFNGLNORMAL3DPROC, glNormal3d) \
+	X(PFNGLNORMAL3DVPROC, glNormal3dv) \
+	X(PFNGLNORMAL3FPROC, glNormal3f) \
+	X(PFNGLNORMAL3FVPROC, glNormal3fv) \
+	X(PFNGLNORMAL3IPROC, glNormal3i) \
+	X(PFNGLNORMAL3IVPROC, glNormal3iv) \
+	X(PFNGLNORMAL3SPROC, glNormal3s) \
+	X(PFNGLNORMAL3SVPROC, glNormal3sv) \
+	X(PFNGLRASTERPOS2DPROC, glRasterPos2d) \
+	X(PFNGLRASTERPOS2DVPROC, glRasterPos2dv) \
+	X(PFNGLRASTERPOS2FPROC, glRasterPos2f) \
+	X(PFNGLRASTERPOS2FVPROC, glRasterPos2fv) \
+	X(PFNGLRASTERPOS2IPROC, glRasterPos2i) \
+	X(PFNGLRASTERPOS2IVPROC, glRasterPos2iv) \
+	X(PFNGLRASTERPOS2SPROC, glRasterPos2s) \
+	X(PFNGLRASTERPOS2SVPROC, glRasterPos2sv) \
+	X(PFNGLRASTERPOS3DPROC, glRasterPos3d) \
+	X(PFNGLRASTERPOS3DVPROC, glRasterPos3dv) \
+	X(PFNGLRASTERPOS3FPROC, glRasterPos3f) \
+	X(PFNGLRASTERPOS3FVPROC, glRasterPos3fv) \
+	X(PFNGLRASTERPOS3IPROC, glRasterPos3i) \
+	X(PFNGLRASTERPOS3IVPROC, glRasterPos3iv) \
+	X(PFNGLRASTERPOS3SPROC, glRasterPos3s) \
+	X(PFNGLRASTERPOS3SVPROC, glRasterPos3sv) \
+	X(PFNGLRASTERPOS4DPROC, glRasterPos4d) \
+	X(PFNGLRASTERPOS4DVPROC, glRasterPos4dv) \
+	X(PFNGLRASTERPOS4FPROC, glRasterPos4f) \
+	X(PFNGLRASTERPOS4FVPROC, glRasterPos4fv) \
+	X(PFNGLRASTERPOS4IPROC, glRasterPos4i) \
+	X(PFNGLRASTERPOS4IVPROC, glRasterPos4iv) \
+	X(PFNGLRASTERPOS4SPROC, glRasterPos4s) \
+	X(PFNGLRASTERPOS4SVPROC, glRasterPos4sv) \
+	X(PFNGLRECTDPROC, glRectd) \
+	X(PFNGLRECTDVPROC, glRectdv) \
+	X(PFNGLRECTFPROC, glRectf) \
+	X(PFNGLRECTFVPROC, glRectfv) \
+	X(PFNGLRECTIPROC, glRecti) \
+	X(PFNGLRECTIVPROC, glRectiv) \
+	X(PFNGLRECTSPROC, glRects) \
+	X(PFNGLRECTSVPROC, glRectsv) \
+	X(PFNGLTEXCOORD1DPROC, glTexCoord1d) \
+	X(PFNGLTEXCOORD1DVPROC, glTexCoord1dv) \
+	X(PFNGLTEXCOORD1FPROC, glTexCoord1f) \
+	X(PFNGLTEXCOORD1FVPROC, glTexCoord1fv) \
+	X(PFNGLTEXCOORD1IPROC, glTexCoord1i) \
+	X(PFNGLTEXCOORD1IVPROC, glTexCoord1iv) \
+	X(PFNGLTEXCOORD1SPROC, glTexCoord1s) \
+	X(PFNGLTEXCOORD1SVPROC, glTexCoord1sv) \
+	X(PFNGLTEXCOORD2DPROC, glTexCoord2d) \
+	X(PFNGLTEXCOORD2DVPROC, glTexCoord2dv) \
+	X(PFNGLTEXCOORD2FPROC, glTexCoord2f) \
+	X(PFNGLTEXCOORD2FVPROC, glTexCoord2fv) \
+	X(PFNGLTEXCOORD2IPROC, glTexCoord2i) \
+	X(PFNGLTEXCOORD2IVPROC, glTexCoord2iv) \
+	X(PFNGLTEXCOORD2SPROC, glTexCoord2s) \
+	X(PFNGLTEXCOORD2SVPROC, glTexCoord2sv) \
+	X(PFNGLTEXCOORD3DPROC, glTexCoord3d) \
+	X(PFNGLTEXCOORD3DVPROC, glTexCoord3dv) \
+	X(PFNGLTEXCOORD3FPROC, glTexCoord3f) \
+	X(PFNGLTEXCOORD3FVPROC, glTexCoord3fv) \
+	X(PFNGLTEXCOORD3IPROC, glTexCoord3i) \
+	X(PFNGLTEXCOORD3IVPROC, glTexCoord3iv) \
+	X(PFNGLTEXCOORD3SPROC, glTexCoord3s) \
+	X(PFNGLTEXCOORD3SVPROC, glTexCoord3sv) \
+	X(PFNGLTEXCOORD4DPROC, glTexCoord4d) \
+	X(PFNGLTEXCOORD4DVPROC, glTexCoord4dv) \
+	X(PFNGLTEXCOORD4FPROC, glTexCoord4f) \
+	X(PFNGLTEXCOORD4FVPROC, glTexCoord4fv) \
+	X(PFNGLTEXCOORD4IPROC, glTexCoord4i) \
+	X(PFNGLTEXCOORD4IVPROC, glTexCoord4iv) \
+	X(PFNGLTEXCOORD4SPROC, glTexCoord4s) \
+	X(PFNGLTEXCOORD4SVPROC, glTexCoord4sv) \
+	X(PFNGLVERTEX2DPROC, glVertex2d) \
+	X(PFNGLVERTEX2DVPROC, glVertex2dv) \
+	X(PFNGLVERTEX2FPROC, glVertex2f) \
+	X(PFNGLVERTEX2FVPROC, glVertex2fv) \
+	X(PFNGLVERTEX2IPROC, glVertex2i) \
+	X(PFNGLVERTEX2IVPROC, glVertex2iv) \
+	X(PFNGLVERTEX2SPROC, glVertex2s) \
+	X(PFNGLVERTEX2SVPROC, glVertex2sv) \
+	X(PFNGLVERTEX3DPROC, glVertex3d) \
+	X(PFNGLVERTEX3DVPROC, glVertex3dv) \
+	X(PFNGLVERTEX3FPROC, glVertex3f) \
+	X(PFNGLVERTEX3FVPROC, glVertex3fv) \
+	X(PFNGLVERTEX3IPROC, glVertex3i) \
+	X(PFNGLVERTEX3IVPROC, glVertex3iv) \
+	X(PFNGLVERTEX3SPROC, glVertex3s) \
+	X(PFNGLVERTEX3SVPROC, glVertex3sv) \
+	X(PFNGLVERTEX4DPROC, glVertex4d) \
+	X(PFNGLVERTEX4DVPROC, glVertex4dv) \
+	X(PFNGLVERTEX4FPROC, glVertex4f) \
+	X(PFNGLVERTEX4FVPROC, glVertex4fv) \
+	X(PFNGLVERTEX4IPROC, glVertex4i) \
+	X(PFNGLVERTEX4IVPROC, glVertex4iv) \
+	X(PFNGLVERTEX4SPROC, glVertex4s) \
+	X(PFNGLVERTEX4SVPROC, glVertex4sv) \
+	X(PFNGLCLIPPLANEPROC, glClipPlane) \
+	X(PFNGLCOLORMATERIALPROC, glColorMaterial) \
+	X(PFNGLFOGFPROC, glFogf) \
+	X(PFNGLFOGFVPROC, glFogfv) \
+	X(PFNGLFOGIPROC, glFogi) \
+	X(PFNGLFOGIVPROC, glFogiv) \
+	X(PFNGLLIGHTFPROC, glLightf) \
+	X(PFNGLLIGHTFVPROC, glLightfv) \
+	X(PFNGLLIGHTIPROC, glLighti) \
+	X(PFNGLLIGHTIVPROC, glLightiv) \
+	X(PFNGLLIGHTMODELFPROC, glLightModelf) \
+	X(PFNGLLIGHTMODELFVPROC, glLightModelfv) \
+	X(PFNGLLIGHTMODELIPROC, glLightModeli) \
+	X(PFNGLLIGHTMODELIVPROC, glLightModeliv) \
+	X(PFNGLLINESTIPPLEPROC, glLineStipple) \
+	X(PFNGLMATERIALFPROC, glMaterialf) \
+	X(PFNGLMATERIALFVPROC, glMaterialfv) \
+	X(PFNGLMATERIALIPROC, glMateriali) \
+	X(PFNGLMATERIALIVPROC, glMaterialiv) \
+	X(PFNGLPOLYGONSTIPPLEPROC, glPolygonStipple) \
+	X(PFNGLSHADEMODELPROC, glShadeModel) \
+	X(PFNGLTEXENVFPROC, glTexEnvf) \
+	X(PFNGLTEXENVFVPROC, glTexEnvfv) \
+	X(PFNGLTEXENVIPROC, glTexEnvi) \
+	X(PFNGLTEXENVIVPROC, glTexEnviv) \
+	X(PFNGLTEXGENDPROC, glTexGend) \
+	X(PFNGLTEXGENDVPROC, glTexGendv) \
+	X(PFNGLTEXGENFPROC, glTexGenf) \
+	X(PFNGLTEXGENFVPROC, glTexGenfv) \
+	X(PFNGLTEXGENIPROC, glTexGeni) \
+	X(PFNGLTEXGENIVPROC, glTexGeniv) \
+	X(PFNGLINITNAMESPROC, glInitNames) \
+	X(PFNGLLOADNAMEPROC, glLoadName) \
+	X(PFNGLPASSTHROUGHPROC, glPassThrough) \
+	X(PFNGLPOPNAMEPROC, glPopName) \
+	X(PFNGLPUSHNAMEPROC, glPushName) \
+	X(PFNGLCLEARACCUMPROC, glClearAccum) \
+	X(PFNGLCLEARINDEXPROC, glClearIndex) \
+	X(PFNGLINDEXMASKPROC, glIndexMask) \
+	X(PFNGLACCUMPROC, glAccum) \
+	X(PFNGLPOPATTRIBPROC, glPopAttrib) \
+	X(PFNGLPUSHATTRIBPROC, glPushAttrib) \
+	X(PFNGLMAP1DPROC, glMap1d) \
+	X(PFNGLMAP1FPROC, glMap1f) \
+	X(PFNGLMAP2DPROC, glMap2d) \
+	X(PFNGLMAP2FPROC, glMap2f) \
+	X(PFNGLMAPGRID1DPROC, glMapGrid1d) \
+	X(PFNGLMAPGRID1FPROC, glMapGrid1f) \
+	X(PFNGLMAPGRID2DPROC, glMapGrid2d) \
+	X(PFNGLMAPGRID2FPROC, glMapGrid2f) \
+	X(PFNGLEVALCOORD1DPROC, glEvalCoord1d) \
+	X(PFNGLEVALCOORD1DVPROC, glEvalCoord1dv) \
+	X(PFNGLEVALCOORD1FPROC, glEvalCoord1f) \
+	X(PFNGLEVALCOORD1FVPROC, glEvalCoord1fv) \
+	X(PFNGLEVALCOORD2DPROC, glEvalCoord2d) \
+	X(PFNGLEVALCOORD2DVPROC, glEvalCoord2dv) \
+	X(PFNGLEVALCOORD2FPROC, glEvalCoord2f) \
+	X(PFNGLEVALCOORD2FVPROC, glEvalCoord2fv) \
+	X(PFNGLEVALMESH1PROC, glEvalMesh1) \
+	X(PFNGLEVALPOINT1PROC, glEvalPoint1) \
+	X(PFNGLEVALMESH2PROC, glEvalMesh2) \
+	X(PFNGLEVALPOINT2PROC, glEvalPoint2) \
+	X(PFNGLALPHAFUNCPROC, glAlphaFunc) \
+	X(PFNGLPIXELZOOMPROC, glPixelZoom) \
+	X(PFNGLPIXELTRANSFERFPROC, glPixelTransferf) \
+	X(PFNGLPIXELTRANSFERIPROC, glPixelTransferi) \
+	X(PFNGLPIXELMAPFVPROC, glPixelMapfv) \
+	X(PFNGLPIXELMAPUIVPROC, glPixelMapuiv) \
+	X(PFNGLPIXELMAPUSVPROC, glPixelMapusv) \
+	X(PFNGLCOPYPIXELSPROC, glCopyPixels) \
+	X(PFNGLDRAWPIXELSPROC, glDrawPixels) \
+	X(PFNGLFRUSTUMPROC, glFrustum) \
+	X(PFNGLLOADIDENTITYPROC, glLoadIdentity) \
+	X(PFNGLLOADMATRIXFPROC, glLoadMatrixf) \
+	X(PFNGLLOADMATRIXDPROC, glLoadMatrixd) \
+	X(PFNGLMATRIXMODEPROC, glMatrixMode) \
+	X(PFNGLMULTMATRIXFPROC, glMultMatrixf) \
+	X(PFNGLMULTMATRIXDPROC, glMultMatrixd) \
+	X(PFNGLORTHOPROC, glOrtho) \
+	X(PFNGLPOPMATRIXPROC, glPopMatrix) \
+	X(PFNGLPUSHMATRIXPROC, glPushMatrix) \
+	X(PFNGLROTATEDPROC, glRotated) \
+	X(PFNGLROTATEFPROC, glRotatef) \
+	X(PFNGLSCALEDPROC, glScaled) \
+	X(PFNGLSCALEFPROC, glScalef) \
+	X(PFNGLTRANSLATEDPROC, glTranslated) \
+	X(PFNGLTRANSLATEFPROC, glTranslatef) \
+
+#define TRACE_COMMANDS_1_1 \
+	X(PFNGLDRAWARRAYSPROC, glDrawArrays) \
+	X(PFNGLDRAWELEMENTSPROC, glDrawElements) \
+	X(PFNGLPOLYGONOFFSETPROC, glPolygonOffset) \
+	X(PFNGLCOPYTEXIMAGE1DPROC, glCopyTexImage1D) \
+	X(PFNGLCOPYTEXIMAGE2DPROC, glCopyTexImage2D) \
+	X(PFNGLCOPYTEXSUBIMAGE1DPROC, glCopyTexSubImage1D) \
+	X(PFNGLCOPYTEXSUBIMAGE2DPROC, glCopyTexSubImage2D) \
+	X(PFNGLTEXSUBIMAGE1DPROC, glTexSubImage1D) \
+	X(PFNGLTEXSUBIMAGE2DPROC, glTexSubImage2D) \
+	X(PFNGLBINDTEXTUREPROC, glBindTexture) \
+	X(PFNGLDELETETEXTURESPROC, glDeleteTextures) \
+	X(PFNGLGENTEXTURESPROC, glGenTextures) \
+	X(PFNGLARRAYELEMENTPROC, glArrayElement) \
+	X(PFNGLCOLORPOINTERPROC, glColorPointer) \
+	X(PFNGLDISABLECLIENTSTATEPROC, glDisableClientState) \
+	X(PFNGLEDGEFLAGPOINTERPROC, glEdgeFlagPointer) \
+	X(PFNGLENABLECLIENTSTATEPROC, glEnableClientState) \
+	X(PFNGLINDEXPOINTERPROC, glIndexPointer) \
+	X(PFNGLINTERLEAVEDARRAYSPROC, glInterleavedArrays) \
+	X(PFNGLNORMALPOINTERPROC, glNormalPointer) \
+	X(PFNGLTEXCOORDPOINTERPROC, glTexCoordPointer) \
+	X(PFNGLVERTEXPOINTERPROC, glVertexPointer) \
+	X(PFNGLPRIORITIZETEXTURESPROC, glPrioritizeTextures) \
+	X(PFNGLINDEXUBPROC, glIndexub) \
+	X(PFNGLINDEXUBVPROC, glIndexubv) \
+	X(PFNGLPOPCLIENTATTRIBPROC, glPopClientAttrib) \
+	X(PFNGLPUSHCLIENTATTRIBPROC, glPushClientAttrib) \
+
+#define TRACE_COMMANDS_1_2 \
+	X(PFNGLDRAWRANGEELEMENTSPROC, glDrawRangeElements) \
+	X(PFNGLTEXIMAGE3DPROC, glTexImage3D) \
+	X(PFNGLTEXSUBIMAGE3DPROC, glTexSubImage3D) \
+	X(PFNGLCOPYTEXSUBIMAGE3DPROC, glCopyTexSubImage3D) \
+
+#define TRACE_COMMANDS_1_3 \
+	X(PFNGLACTIVETEXTUREPROC, glActiveTexture) \
+	X(PFNGLSAMPLECOVERAGEPROC, glSampleCoverage) \
+	X(PFNGLCOMPRESSEDTEXIMAGE3DPROC, glCompressedTexImage3D) \
+	X(PFNGLCOMPRESSEDTEXIMAGE2DPROC, glCompressedTexImage2D) \
+	X(PFNGLCOMPRESSEDTEXIMAGE1DPROC, glCompressedTexImage1D) \
+	X(PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, glCompressedTexSubImage3D) \
+	X(PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, glCompressedTexSubImage2D) \
+	X(PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC, glCompressedTexSubImage1D) \
+	X(PFNGLCLIENTACTIVETEXTUREPROC, glClientActiveTexture) \
+	X(PFNGLMULTITEXCOORD1DPROC, glMultiTexCoord1d) \
+	X(PFNGLMULTITEXCOORD1DVPROC, glMultiTexCoord1dv) \
+	X(PFNGLMULTITEXCOORD1FPROC, glMultiTexCoord1f) \
+	X(PFNGLMULTITEXCOORD1FVPROC, glMultiTexCoord1fv) \
+	X(PFNGLMULTITEXCOORD1IPROC, glMultiTexCoord1i) \
+	X(PFNGLMULTITEXCOORD1IVPROC, glMultiTexCoord1iv) \
+	X(PFNGLMULTITEXCOORD1SPROC, glMultiTexCoord1s) \
+	X(PFNGLMULTITEXCOORD1SVPROC, glMultiTexCoord1sv) \
+	X(PFNGLMULTITEXCOORD2DPROC, glMultiTexCoord2d) \
+	X(PFNGLMULTITEXCOORD2DVPROC, glMultiTexCoord2dv) \
+	X(PFNGLMULTITEXCOORD2FPROC, glMultiTexCoord2f) \
+	X(PFNGLMULTITEXCOORD2FVPROC, glMultiTexCoord2fv) \
+	X(PFNGLMULTITEXCOORD2IPROC, glMultiTexCoord2i) \
+	X(PFNGLMULTITEXCOORD2IVPROC, glMultiTexCoord2iv) \
+	X(PFNGLMULTITEXCOORD2SPROC, glMultiTexCoord2s) \
+	X(PFNGLMULTITEXCOORD2SVPROC, glMultiTexCoord2sv) \
+	X(PFNGLMULTITEXCOORD3DPROC, glMultiTexCoord3d) \
+	X(PFNGLMULTITEXCOORD3DVPROC, glMultiTexCoord3dv) \
+	X(PFNGLMULTITEXCOORD3FPROC, glMultiTexCoord3f) \
+	X(PFNGLMULTITEXCOORD3FVPROC, glMultiTexCoord3fv) \
+	X(PFNGLMULTITEXCOORD3IPROC, glMultiTexCoord3i) \
+	X(PFNGLMULTITEXCOORD3IVPROC, glMultiTexCoord3iv) \
+	X(PFNGLMULTITEXCOORD3SPROC, glMultiTexCoord3s) \
+	X(PFNGLMULTITEXCOORD3SVPROC, glMultiTexCoord3sv) \
+	X(PFNGLMULTITEXCOORD4DPROC, glMultiTexCoord4d) \
+	X(PFNGLMULTITEXCOORD4DVPROC, glMultiTexCoord4dv) \
+	X(PFNGLMULTITEXCOORD4FPROC, glMultiTexCoord4f) \
+	X(PFNGLMULTITEXCOORD4FVPROC, glMultiTexCoord4fv) \
+	X(PFNGLMULTITEXCOORD4IPROC, glMultiTexCoord4i) \
+	X(PFNGLMULTITEXCOORD4IVPROC, glMultiTexCoord4iv) \
+	X(PFNGLMULTITEXCOORD4SPROC, glMultiTexCoord4s) \
+	X(PFNGLMULTITEXCOORD4SVPROC, glMultiTexCoord4sv) \
+	X(PFNGLLOADTRANSPOSEMATRIXFPROC, glLoadTransposeMatrixf) \
+	X(PFNGLLOADTRANSPOSEMATRIXDPROC, glLoadTransposeMatrixd) \
+	X(PFNGLMULTTRANSPOSEMATRIXFPROC, glMultTransposeMatrixf) \
+	X(PFNGLMULTTRANSPOSEMATRIXDPROC, glMultTransposeMatrixd) \
+
+#define TRACE_COMMANDS_1_4 \
+	X(PFNGLBLENDFUNCSEPARATEPROC, glBlendFuncSeparate) \
+	X(PFNGLMULTIDRAWARRAYSPROC, glMultiDrawArrays) \
+	X(PFNGLMULTIDRAWELEMENTSPROC, glMultiDrawElements) \
+	X(PFNGLPOINTPARAMETERFPROC, glPointParameterf) \
+	X(PFNGLPOINTPARAMETERFVPROC, glPointParameterfv) \
+	X(PFNGLPOINTPARAMETERIPROC, glPointParameteri) \
+	X(PFNGLPOINTPARAMETERIVPROC, glPointParameteriv) \
+	X(PFNGLFOGCOORDFPROC, glFogCoordf) \
+	X(PFNGLFOGCOORDFVPROC, glFogCoordfv) \
+	X(PFNGLFOGCOORDDPROC, glFogCoordd) \
+	X(PFNGLFOGCOORDDVPROC, glFogCoorddv) \
+	X(PFNGLFOGCOORDPOINTERPROC, glFogCoordPointer) \
+	X(PFNGLSECONDARYCOLOR3BPROC, glSecondaryColor3b) \
+	X(PFNGLSECONDARYCOLOR3BVPROC, glSecondaryColor3bv) \
+	X(PFNGLSECONDARYCOLOR3DPROC, glSecondaryColor3d) \
+	X(PFNGLSECONDARYCOLOR3DVPROC, glSecondaryColor3dv) \
+	X(PFNGLSECONDARYCOLOR3FPROC, glSecondaryColor3f) \
+	X(PFNGLSECONDARYCOLOR3FVPROC, glSecondaryColor3fv) \
+	X(PFNGLSECONDARYCOLOR3IPROC, glSecondaryColor3i) \
+	X(PFNGLSECONDARYCOLOR3IVPROC, glSecondaryColor3iv) \
+	X(PFNGLSECONDARYCOLOR3SPROC, glSecondaryColor3s) \
+	X(PFNGLSECONDARYCOLOR3SVPROC, glSecondaryColor3sv) \
+	X(PFNGLSECONDARYCOLOR3UBPROC, glSecondaryColor3ub) \
+	X(PFNGLSECONDARYCOLOR3UBVPROC, glSecondaryColor3ubv) \
+	X(PFNGLSECONDARYCOLOR3UIPROC, glSecondaryColor3ui) \
+	X(PFNGLSECONDARYCOLOR3UIVPROC, glSecondaryColor3uiv) \
+	X(PFNGLSECONDARYCOLOR3USPROC, glSecondaryColor3us) \
+	X(PFNGLSECONDARYCOLOR3USVPROC, glSecondaryColor3usv) \
+	X(PFNGLSECONDARYCOLORPOINTERPROC, glSecondaryColorPointer) \
+	X(PFNGLWINDOWPOS2DPROC, glWindowPos2d) \
+	X(PFNGLWINDOWPOS2DVPROC, glWindowPos2dv) \
+	X(PFNGLWINDOWPOS2FPROC, glWindowPos2f) \
+	X(PFNGLWINDOWPOS2FVPROC, glWindowPos2fv) \
+	X(PFNGLWINDOWPOS2IPROC, glWindowPos2i) \
+	X(PFNGLWINDOWPOS2IVPROC, glWindowPos2iv) \
+	X(PFNGLWINDOWPOS2SPROC, glWindowPos2s) \
+	X(PFNGLWINDOWPOS2SVPROC, glWindowPos2sv) \
+	X(PFNGLWINDOWPOS3DPROC, glWindowPos3d) \
+	X(PFNGLWINDOWPOS3DVPROC, glWindowPos3dv) \
+	X(PFNGLWINDOWPOS3FPROC, glWindowPos3f) \
+	X(PFNGLWINDOWPOS3FVPROC, glWindowPos3fv) \
+	X(PFNGLWINDOWPOS3IPROC, glWindowPos3i) \
+	X(PFNGLWINDOWPOS3IVPROC, glWindowPos3iv) \
+	X(PFNGLWINDOWPOS3SPROC, glWindowPos3s) \
+	X(PFNGLWINDOWPOS3SVPROC, glWindowPos3sv) \
+	X(PFNGLBLENDCOLORPROC, glBlendColor) \
+	X(PFNGLBLENDEQUATIONPROC, glBlendEquation) \
+
+#define TRACE_COMMANDS_1_5 \
+	X(PFNGLGENQUERIESPROC, glGenQueries) \
+	X(PFNGLDELETEQUERIESPROC, glDeleteQueries) \
+	X(PFNGLBEGINQUERYPROC, glBeginQuery) \
+	X(PFNGLENDQUERYPROC, glEndQuery) \
+	X(PFNGLBINDBUFFERPROC, glBindBuffer) \
+	X(PFNGLDELETEBUFFERSPROC, glDeleteBuffers) \
+	X(PFNGLGENBUFFERSPROC, glGenBuffers) \
+	X(PFNGLBUFFERDATAPROC, glBufferData) \
+	X(PFNGLBUFFERSUBDATAPROC, glBufferSubData) \
+	X(PFNGLMAPBUFFERPROC, glMapBuffer) \
+	X(PFNGLUNMAPBUFFERPROC, glUnmapBuffer) \
+
+#define TRACE_COMMANDS_2_0 \
+	X(PFNGLBLENDEQUATIONSEPARATEPROC, glBlendEquationSeparate) \
+	X(PFNGLDRAWBUFFERSPROC, glDrawBuffers) \
+	X(PFNGLSTENCILOPSEPARATEPROC, glStencilOpSeparate) \
+	X(PFNGLSTENCILFUNCSEPARATEPROC, glStencilFuncSeparate) \
+	X(PFNGLSTENCILMASKSEPARATEPROC, glStencilMaskSeparate) \
+	X(PFNGLATTACHSHADERPROC, glAttachShader) \
+	X(PFNGLBINDATTRIBLOCATIONPROC, glBindAttribLocation) \
+	X(PFNGLCOMPILESHADERPROC, glCompileShader) \
+	X(PFNGLCREATEPROGRAMPROC, glCreateProgram) \
+	X(PFNGLCREATESHADERPROC, glCreateShader) \
+	X(PFNGLDELETEPROGRAMPROC, glDeleteProgram) \
+	X(PFNGLDELETESHADERPROC, glDeleteShader) \
+	X(PFNGLDETACHSHADERPROC, glDetachShader) \
+	X(PFNGLDISABLEVERTEXATTRIBARRAYPROC, glDisableVertexAttribArray) \
+	X(PFNGLENABLEVERTEXATTRIBARRAYPROC, glEnableVertexAttribArray) \
+	X(PFNGLGETUNIFORMLOCATIONPROC, glGetUniformLocation) \
+	X(PFNGLLINKPROGRAMPROC, glLinkProgram) \
+	X(PFNGLSHADERSOURCEPROC, glShaderSource) \
+	X(PFNGLUSEPROGRAMPROC, glUseProgram) \
+	X(PFNGLUNIFORM1FPROC, glUniform1f) \
+	X(PFNGLUNIFORM2FPROC, glUniform2f) \
+	X(PFNGLUNIFORM3FPROC, glUniform3f) \
+	X(PFNGLUNIFORM4FPROC, glUniform4f) \
+	X(PFNGLUNIFORM1IPROC, glUniform1i) \
+	X(PFNGLUNIFORM2IPROC, glUniform2i) \
+	X(PFNGLUNIFORM3IPROC, glUniform3i) \
+	X(PFNGLUNIFORM4IPROC, glUniform4i) \
+	X(PFNGLUNIFORM1FVPROC, glUniform1fv) \
+	X(PFNGLUNIFORM2FVPROC, glUniform2fv) \
+	X(PFNGLUNIFORM3FVPROC, glUniform3fv) \
+	X(PFNGLUNIFORM4FVPROC, glUniform4fv) \
+	X(PFNGLUNIFORM1IVPROC, glUniform1iv) \
+	X(PFNGLUNIFORM2IVPROC, glUniform2iv) \
+	X(PFNGLUNIFORM3IVPROC, glUniform3iv) \
+	X(PFNGLUNIFORM4IVPROC, glUniform4iv) \
+	X(PFNGLUNIFORMMATRIX2FVPROC, glUniformMatrix2fv) \
+	X(PFNGLUNIFORMMATRIX3FVPROC, glUniformMatrix3fv) \
+	X(PFNGLUNIFORMMATRIX4FVPROC, glUniformMatrix4fv) \
+	X(PFNGLVALIDATEPROGRAMPROC, glValidateProgram) \
+	X(PFNGLVERTEXATTRIB1DPROC, glVertexAttrib1d) \
+	X(PFNGLVERTEXATTRIB1DVPROC, glVertexAttrib1dv) \
+	X(PFNGLVERTEXATTRIB1FPROC, glVertexAttrib1f) \
+	X(PFNGLVERTEXATTRIB1FVPROC, glVertexAttrib1fv) \
+	X(PFNGLVERTEXATTRIB1SPROC, glVertexAttrib1s) \
+	X(PFNGLVERTEXATTRIB1SVPROC, glVertexAttrib1sv) \
+	X(PFNGLVERTEXATTRIB2DPROC, glVertexAttrib2d) \
+	X(PFNGLVERTEXATTRIB2DVPROC, glVertexAttrib2dv) \
+	X(PFNGLVERTEXATTRIB2FPROC, glVertexAttrib2f) \
+	X(PFNGLVERTEXATTRIB2FVPROC, glVertexAttrib2fv) \
+	X(PFNGLVERTEXATTRIB2SPROC, glVertexAttrib2s) \
+	X(PFNGLVERTEXATTRIB2SVPROC, glVertexAttrib2sv) \
+	X(PFNGLVERTEXATTRIB3DPROC, glVertexAttrib3d) \
+	X(PFNGLVERTEXATTRIB3DVPROC, glVertexAttrib3dv) \
+	X(PFNGLVERTEXATTRIB3FPROC, glVertexAttrib3f) \
+	X(PFNGLVERTEXATTRIB3FVPROC, glVertexAttrib3fv) \
+	X(PFNGLVERTEXATTRIB3SPROC, glVertexAttrib3s) \
+	X(PFNGLVERTEXATTRIB3SVPROC, glVertexAttrib3sv) \
+	X(PFNGLVERTEXATTRIB4NBVPROC, glVertexAttrib4Nbv) \
+	X(PFNGLVERTEXATTRIB4NIVPROC, glVertexAttrib4Niv) \
+	X(PFNGLVERTEXATTRIB4NSVPROC, glVertexAttrib4Nsv) \
+	X(PFNGLVERTEXATTRIB4NUBPROC, glVertexAttrib4Nub) \
+	X(PFNGLVERTEXATTRIB4NUBVPROC, glVertexAttrib4Nubv) \
+	X(PFNGLVERTEXATTRIB4NUIVPROC, glVertexAttrib4Nuiv) \
+	X(PFNGLVERTEXATTRIB4NUSVPROC, glVertexAttrib4Nusv) \
+	X(PFNGLVERTEXATTRIB4BVPROC, glVertexAttrib4bv) \
+	X(PFNGLVERTEXATTRIB4DPROC, glVertexAttrib4d) \
+	X(PFNGLVERTEXATTRIB4DVPROC, glVertexAttrib4dv) \
+	X(PFNGLVERTEXATTRIB4FPROC, glVertexAttrib4f) \
+	X(PFNGLVERTEXATTRIB4FVPROC, glVertexAttrib4fv) \
+	X(PFNGLVERTEXATTRIB4IVPROC, glVertexAttrib4iv) \
+	X(PFNGLVERTEXATTRIB4SPROC, glVertexAttrib4s) \
+	X(PFNGLVERTEXATTRIB4SVPROC, glVertexAttrib4sv) \
+	X(PFNGLVERTEXATTRIB4UBVPROC, glVertexAttrib4ubv) \
+	X(PFNGLVERTEXATTRIB4UIVPROC, glVertexAttrib4uiv) \
+	X(PFNGLVERTEXATTRIB4USVPROC, glVertexAttrib4usv) \
+	X(PFNGLVERTEXATTRIBPOINTERPROC, glVertexAttribPointer) \
+
+#define TRACE_COMMANDS_2_1 \
+	X(PFNGLUNIFORMMATRIX2X3FVPROC, glUniformMatrix2x3fv) \
+	X(PFNGLUNIFORMMATRIX3X2FVPROC, glUniformMatrix3x2fv) \
+	X(PFNGLUNIFORMMATRIX2X4FVPROC, glUniformMatrix2x4fv) \
+	X(PFNGLUNIFORMMATRIX4X2FVPROC, glUniformMatrix4x2fv) \
+	X(PFNGLUNIFORMMATRIX3X4FVPROC, glUniformMatrix3x4fv) \
+	X(PFNGLUNIFORMMATRIX4X3FVPROC, glUniformMatrix4x3fv) \
+
+#define TRACE_COMMANDS_3_0 \
+	X(PFNGLCOLORMASKIPROC, glColorMaski) \
+	X(PFNGLENABLEIPROC, glEnablei) \
+	X(PFNGLDISABLEIPROC, glDisablei) \
+	X(PFNGLBEGINTRANSFORMFEEDBACKPROC, glBeginTransformFeedback) \
+	X(PFNGLENDTRANSFORMFEEDBACKPROC, glEndTransformFeedback) \
+	X(PFNGLBINDBUFFERRANGEPROC, glBindBufferRange) \
+	X(PFNGLBINDBUFFERBASEPROC, glBindBufferBase) \
+	X(PFNGLTRANSFORMFEEDBACKVARYINGSPROC, glTransformFeedbackVaryings) \
+	X(PFNGLCLAMPCOLORPROC, glClampColor) \
+	X(PFNGLBEGINCONDITIONALRENDERPROC, glBeginConditionalRender) \
+	X(PFNGLENDCONDITIONALRENDERPROC, glEndConditionalRender) \
+	X(PFNGLVERTEXATTRIBIPOINTERPROC, glVertexAttribIPointer) \
+	X(PFNGLVERTEXATTRIBI1IPROC, glVertexAttribI1i) \
+	X(PFNGLVERTEXATTRIBI2IPROC, glVertexAttribI2i) \
+	X(PFNGLVERTEXATTRIBI3IPROC, glVertexAttribI3i) \
+	X(PFNGLVERTEXATTRIBI4IPROC, glVertexAttribI4i) \
+	X(PFNGLVERTEXATTRIBI1UIPROC, glVertexAttribI1ui) \
+	X(PFNGLVERTEXATTRIBI2UIPROC, glVertexAttribI2ui) \
+	X(PFNGLVERTEXATTRIBI3UIPROC, glVertexAttribI3ui) \
+	X(PFNGLVERTEXATTRIBI4UIPROC, glVertexAttribI4ui) \
+	X(PFNGLVERTEXATTRIBI1IVPROC, glVertexAttribI1iv) \
+	X(PFNGLVERTEXATTRIBI2IVPROC, glVertexAttribI2iv) \
+	X(PFNGLVERTEXATTRIBI3IVPROC, glVertexAttribI3iv) \
+	X(PFNGLVERTEXATTRIBI4IVPROC, glVertexAttribI4iv) \
+	X(PFNGLVERTEXATTRIBI1UIVPROC, glVertexAttribI1uiv) \
+	X(PFNGLVERTEXATTRIBI2UIVPROC, glVertexAttribI2uiv) \
+	X(PFNGLVERTEXATTRIBI3UIVPROC, glVertexAttribI3uiv) \
+	X(PFNGLVERTEXATTRIBI4UIVPROC, glVertexAttribI4uiv) \
+	X(PFNGLVERTEXATTRIBI4BVPROC, glVertexAttribI4bv) \
+	X(PFNGLVERTEXATTRIBI4SVPROC, glVertexAttribI4sv) \
+	X(PFNGLVERTEXATTRIBI4UBVPROC, glVertexAttribI4ubv) \
+	X(PFNGLVERTEXATTRIBI4USVPROC, glVertexAttribI4usv) \
+	X(PFNGLBINDFRAGDATALOCATIONPROC, glBindFragDataLocation) \
+	X(PFNGLUNIFORM1UIPROC, glUniform1ui) \
+	X(PFNGLUNIFORM2UIPROC, glUniform2ui) \
+	X(PFNGLUNIFORM3UIPROC, glUniform3ui) \
+	X(PFNGLUNIFORM4UIPROC, glUniform4ui) \
+	X(PFNGLUNIFORM1UIVPROC, glUniform1uiv) \
+	X(PFNGLUNIFORM2UIVPROC, glUniform2uiv) \
+	X(PFNGLUNIFORM3UIVPROC, glUniform3uiv) \
+	X(PFNGLUNIFORM4UIVPROC, glUniform4uiv) \
+	X(PFNGLTEXPARAMETERIIVPROC, glTexParameterIiv) \
+	X(PFNGLTEXPARAMETERIUIVPROC, glTexParameterIuiv) \
+	X(PFNGLCLEARBUFFERIVPROC, glClearBufferiv) \
+	X(PFNGLCLEARBUFFERUIVPROC, glClearBufferuiv) \
+	X(PFNGLCLEARBUFFERFVPROC, glClearBufferfv) \
+	X(PFNGLCLEARBUFFERFIPROC, glClearBufferfi) \
+	X(PFNGLBINDRENDERBUFFERPROC, glBindRenderbuffer) \
+	X(PFNGLDELETERENDERBUFFERSPROC, glDeleteRenderbuffers) \
+	X(PFNGLGENRENDERBUFFERSPROC, glGenRenderbuffers) \
+	X(PFNGLRENDERBUFFERSTORAGEPROC, glRenderbufferStorage) \
+	X(PFNGLBINDFRAMEBUFFERPROC, glBindFramebuffer) \
+	X(PFNGLDELETEFRAMEBUFFERSPROC, glDeleteFramebuffers) \
+	X(PFNGLGENFRAMEBUFFERSPROC, glGenFramebuffers) \
+	X(PFNGLFRAMEBUFFERTEXTURE1DPROC, glFramebufferTexture1D) \
+	X(PFNGLFRAMEBUFFERTEXTURE2DPROC, glFramebufferTexture2D) \
+	X(PFNGLFRAMEBUFFERTEXTURE3DPROC, glFramebufferTexture3D) \
+	X(PFNGLFRAMEBUFFERRENDERBUFFERPROC, glFramebufferRenderbuffer) \
+	X(PFNGLGENERATEMIPMAPPROC, glGenerateMipmap) \
+	X(PFNGLBLITFRAMEBUFFERPROC, glBlitFramebuffer) \
+	X(PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC, glRenderbufferStorageMultisample) \
+	X(PFNGLFRAMEBUFFERTEXTURELAYERPROC, glFramebufferTextureLayer) \
+	X(PFNGLMAPBUFFERRANGEPROC, glMapBufferRange) \
+	X(PFNGLFLUSHMAPPEDBUFFERRANGEPROC, glFlushMappedBufferRange) \
+	X(PFNGLBINDVERTEXARRAYPROC, glBindVertexArray) \
+	X(PFNGLDELETEVERTEXARRAYSPROC, glDeleteVertexArrays) \
+	X(PFNGLGENVERTEXARRAYSPROC, glGenVertexArrays) \
+
+#define TRACE_COMMANDS_3_1 \
+	X(PFNGLDRAWARRAYSINSTANCEDPROC, glDrawArraysInstanced) \
+	X(PFNGLDRAWELEMENTSINSTANCEDPROC, glDrawElementsInstanced) \
+	X(PFNGLTEXBUFFERPROC, glTexBuffer) \
+	X(PFNGLPRIMITIVERESTARTINDEXPROC, glPrimitiveRestartIndex) \
+	X(PFNGLCOPYBUFFERSUBDATAPROC, glCopyBufferSubData) \
+	X(PFNGLUNIFORMBLOCKBINDINGPROC, glUniformBlockBinding) \
+
+#define TRACE_COMMANDS_3_2 \
+	X(PFNGLDRAWELEMENTSBASEVERTEXPROC, glDrawElementsBaseVertex) \
+	X(PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC, glDrawRangeElementsBaseVertex) \
+	X(PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC, glDrawElementsInstancedBaseVertex) \
+	X(PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC, glMultiDrawElementsBaseVertex) \
+	X(PFNGLPROVOKINGVERTEXPROC, glProvokingVertex) \
+	X(PFNGLFENCESYNCPROC, glFenceSync) \
+	X(PFNGLDELETESYNCPROC, glDeleteSync) \
+	X(PFNGLCLIENTWAITSYNCPROC, glClientWaitSync) \
+	X(PFNGLWAITSYNCPROC, glWaitSync) \
+	X(PFNGLFRAMEBUFFERTEXTUREPROC, glFramebufferTexture) \
+	X(PFNGLTEXIMAGE2DMULTISAMPLEPROC, glTexImage2DMultisample) \
+	X(PFNGLTEXIMAGE3DMULTISAMPLEPROC, glTexImage3DMultisample) \
+	X(PFNGLSAMPLEMASKIPROC, glSampleMaski) \
+
+#define TRACE_COMMANDS_3_3 \
+	X(PFNGLBINDFRAGDATALOCATIONINDEXEDPROC, glBindFragDataLocationIndexed) \
+	X(PFNGLGENSAMPLERSPROC, glGenSamplers) \
+	X(PFNGLDELETESAMPLERSPROC, glDeleteSamplers) \
+	X(PFNGLBINDSAMPLERPROC, glBindSampler) \
+	X(PFNGLSAMPLERPARAMETERIPROC, glSamplerParameteri) \
+	X(PFNGLSAMPLERPARAMETERIVPROC, glSamplerParameteriv) \
+	X(PFNGLSAMPLERPARAMETERFPROC, glSamplerParameterf) \
+	X(PFNGLSAMPLERPARAMETERFVPROC, glSamplerParameterfv) \
+	X(PFNGLSAMPLERPARAMETERIIVPROC, glSamplerParameterIiv) \
+	X(PFNGLSAMPLERPARAMETERIUIVPROC, glSamplerParameterIuiv) \
+	X(PFNGLQUERYCOUNTERPROC, glQueryCounter) \
+	X(PFNGLVERTEXATTRIBDIVISORPROC, glVertexAttribDivisor) \
+	X(PFNGLVERTEXATTRIBP1UIPROC, glVertexAttribP1ui) \
+	X(PFNGLVERTEXATTRIBP1UIVPROC, glVertexAttribP1uiv) \
+	X(PFNGLVERTEXATTRIBP2UIPROC, glVertexAttribP2ui) \
+	X(PFNGLVERTEXATTRIBP2UIVPROC, glVertexAttribP2uiv) \
+	X(PFNGLVERTEXATTRIBP3UIPROC, glVertexAttribP3ui) \
+	X(PFNGLVERTEXATTRIBP3UIVPROC, glVertexAttribP3uiv) \
+	X(PFNGLVERTEXATTRIBP4UIPROC, glVertexAttribP4ui) \
+	X(PFNGLVERTEXATTRIBP4UIVPROC, glVertexAttribP4uiv) \
+	X(PFNGLVERTEXP2UIPROC, glVertexP2ui) \
+	X(PFNGLVERTEXP2UIVPROC, glVertexP2uiv) \
+	X(PFNGLVERTEXP3UIPROC, glVertexP3ui) \
+	X(PFNGLVERTEXP3UIVPROC, glVertexP3uiv) \
+	X(PFNGLVERTEXP4UIPROC, glVertexP4ui) \
+	X(PFNGLVERTEXP4UIVPROC, glVertexP4uiv) \
+	X(PFNGLTEXCOORDP1UIPROC, glTexCoordP1ui) \
+	X(PFNGLTEXCOORDP1UIVPROC, glTexCoordP1uiv) \
+	X(PFNGLTEXCOORDP2UIPROC, glTexCoordP2ui) \
+	X(PFNGLTEXCOORDP2UIVPROC, glTexCoordP2uiv) \
+	X(PFNGLTEXCOORDP3UIPROC, glTexCoordP3ui) \
+	X(PFNGLTEXCOORDP3UIVPROC, glTexCoordP3uiv) \
+	X(PFNGLTEXCOORDP4UIPROC, glTexCoordP4ui) \
+	X(PFNGLTEXCOORDP4UIVPROC, glTexCoordP4uiv) \
+	X(PFNGLMULTITEXCOORDP1UIPROC, glMultiTexCoordP1ui) \
+	X(PFNGLMULTITEXCOORDP1UIVPROC, glMultiTexCoordP1uiv) \
+	X(PFNGLMULTITEXCOORDP2UIPROC, glMultiTexCoordP2ui) \
+	X(PFNGLMULTITEXCOORDP2UIVPROC, glMultiTexCoordP2uiv) \
+	X(PFNGLMULTITEXCOORDP3UIPROC, glMultiTexCoordP3ui) \
+	X(PFNGLMULTITEXCOORDP3UIVPROC, glMultiTexCoordP3uiv) \
+	X(PFNGLMULTITEXCOORDP4UIPROC, glMultiTexCoordP4ui) \
+	X(PFNGLMULTITEXCOORDP4UIVPROC, glMultiTexCoordP4uiv) \
+	X(PFNGLNORMALP3UIPROC, glNormalP3ui) \
+	X(PFNGLNORMALP3UIVPROC, glNormalP3uiv) \
+	X(PFNGLCOLORP3UIPROC, glColorP3ui) \
+	X(PFNGLCOLORP3UIVPROC, glColorP3uiv) \
+	X(PFNGLCOLORP4UIPROC, glColorP4ui) \
+	X(PFNGLCOLORP4UIVPROC, glColorP4uiv) \
+	X(PFNGLSECONDARYCOLORP3UIPROC, glSecondaryColorP3ui) \
+	X(PFNGLSECONDARYCOLORP3UIVPROC, glSecondaryColorP3uiv) \
+
+#define TRACE_COMMANDS_4_0 \
+	X(PFNGLMINSAMPLESHADINGPROC, glMinSampleShading) \
+	X(PFNGLBLENDEQUATIONIPROC, glBlendEquationi) \
+	X(PFNGLBLENDEQUATIONSEPARATEIPROC, glBlendEquationSeparatei) \
+	X(PFNGLBLENDFUNCIPROC, glBlendFunci) \
+	X(PFNGLBLENDFUNCSEPARATEIPROC, glBlendFuncSeparatei) \
+	X(PFNGLDRAWARRAYSINDIRECTPROC, glDrawArraysIndirect) \
+	X(PFNGLDRAWELEMENTSINDIRECTPROC, glDrawElementsIndirect) \
+	X(PFNGLUNIFORM1DPROC, glUniform1d) \
+	X(PFNGLUNIFORM2DPROC, glUniform2d) \
+	X(PFNGLUNIFORM3DPROC, glUniform3d) \
+	X(PFNGLUNIFORM4DPROC, glUniform4d) \
+	X(PFNGLUNIFORM1DVPROC, glUniform1dv) \
+	X(PFNGLUNIFORM2DVPROC, glUniform2dv) \
+	X(PFNGLUNIFORM3DVPROC, glUniform3dv) \
+	X(PFNGLUNIFORM4DVPROC, glUniform4dv) \
+	X(PFNGLUNIFORMMATRIX2DVPROC, glUniformMatrix2dv) \
+	X(PFNGLUNIFORMMATRIX3DVPROC, glUniformMatrix3dv) \
+	X(PFNGLUNIFORMMATRIX4DVPROC, glUniformMatrix4dv) \
+	X(PFNGLUNIFORMMATRIX2X3DVPROC, glUniformMatrix2x3dv) \
+	X(PFNGLUNIFORMMATRIX2X4DVPROC, glUniformMatrix2x4dv) \
+	X(PFNGLUNIFORMMATRIX3X2DVPROC, glUniformMatrix3x2dv) \
+	X(PFNGLUNIFORMMATRIX3X4DVPROC, glUniformMatrix3x4dv) \
+	X(PFNGLUNIFORMMATRIX4X2DVPROC, glUniformMatrix4x2dv) \
+	X(PFNGLUNIFORMMATRIX4X3DVPROC, glUniformMatrix4x3dv) \
+	X(PFNGLUNIFORMSUBROUTINESUIVPROC, glUniformSubroutinesuiv) \
+	X(PFNGLPATCHPARAMETERIPROC, glPatchParameteri) \
+	X(PFNGLPATCHPARAMETERFVPROC, glPatchParameterfv) \
+	X(PFNGLBINDTRANSFORMFEEDBACKPROC, glBindTransformFeedback) \
+	X(PFNGLDELETETRANSFORMFEEDBACKSPROC, glDeleteTransformFeedbacks) \
+	X(PFNGLGENTRANSFORMFEEDBACKSPROC, glGenTransformFeedbacks) \
+	X(PFNGLPAUSETRANSFORMFEEDBACKPROC, glPauseTransformFeedback) \
+	X(PFNGLRESUMETRANSFORMFEEDBACKPROC, glResumeTransformFeedback) \
+	X(PFNGLDRAWTRANSFORMFEEDBACKPROC, glDrawTransformFeedback) \
+	X(PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC, glDrawTransformFeedbackStream) \
+	X(PFNGLBEGINQUERYINDEXEDPROC, glBeginQueryIndexed) \
+	X(PFNGLENDQUERYINDEXEDPROC, glEndQueryIndexed) \
+
+#define TRACE_COMMANDS_4_1 \
+	X(PFNGLRELEASESHADERCOMPILERPROC, glReleaseShaderCompiler) \
+	X(PFNGLSHADERBINARYPROC, glShaderBinary) \
+	X(PFNGLDEPTHRANGEFPROC, glDepthRangef) \
+	X(PFNGLCLEARDEPTHFPROC, glClearDepthf) \
+	X(PFNGLPROGRAMBINARYPROC, glProgramBinary) \
+	X(PFNGLPROGRAMPARAMETERIPROC, glProgramParameteri) \
+	X(PFNGLUSEPROGRAMSTAGESPROC, glUseProgramStages) \
+	X(PFNGLACTIVESHADERPROGRAMPROC, glActiveShaderProgram) \
+	X(PFNGLCREATESHADERPROGRAMVPROC, glCreateShaderProgramv) \
+	X(PFNGLBINDPROGRAMPIPELINEPROC, glBindProgramPipeline) \
+	X(PFNGLDELETEPROGRAMPIPELINESPROC, glDeleteProgramPipelines) \
+	X(PFNGLGENPROGRAMPIPELINESPROC, glGenProgramPipelines) \
+	X(PFNGLPROGRAMUNIFORM1IPROC, glProgramUniform1i) \
+	X(PFNGLPROGRAMUNIFORM1IVPROC, glProgramUniform1iv) \
+	X(PFNGLPROGRAMUNIFORM1FPROC, glProgramUniform1f) \
+	X(PFNGLPROGRAMUNIFORM1FVPROC, glProgramUniform1fv) \
+	X(PFNGLPROGRAMUNIFORM1DPROC, glProgramUniform1d) \
+	X(PFNGLPROGRAMUNIFORM1DVPROC, glProgramUniform1dv) \
+	X(PFNGLPROGRAMUNIFORM1UIPROC, glProgramUniform1ui) \
+	X(PFNGLPROGRAMUNIFORM1UIVPROC, glProgramUniform1uiv) \
+	X(PFNGLPROGRAMUNIFORM2IPROC, glProgramUniform2i) \
+	X(PFNGLPROGRAMUNIFORM2IVPROC, glProgramUniform2iv) \
+	X(PFNGLPROGRAMUNIFORM2FPROC, glProgramUniform2f) \
+	X(PFNGLPROGRAMUNIFORM2FVPROC, glProgramUniform2fv) \
+	X(PFNGLPROGRAMUNIFORM2DPROC, glProgramUniform2d) \
+	X(PFNGLPROGRAMUNIFORM2DVPROC, glProgramUniform2dv) \
+	X(PFNGLPROGRAMUNIFORM2UIPROC, glProgramUniform2ui) \
+	X(PFNGLPROGRAMUNIFORM2UIVPROC, glProgramUniform2uiv) \
+	X(PFNGLPROGRAMUNIFORM3IPROC, glProgramUniform3i) \
+	X(PFNGLPROGRAMUNIFORM3IVPROC, glProgramUniform3iv) \
+	X(PFNGLPROGRAMUNIFORM3FPROC, glProgramUniform3f) \
+	X(PFNGLPROGRAMUNIFORM3FVPROC, glProgramUniform3fv) \
+	X(PFNGLPROGRAMUNIFORM3DPROC, glProgramUniform3d) \
+	X(PFNGLPROGRAMUNIFORM3DVPROC, glProgramUniform3dv) \
+	X(PFNGLPROGRAMUNIFORM3UIPROC, glProgramUniform3ui) \
+	X(PFNGLPROGRAMUNIFORM3UIVPROC, glProgramUniform3uiv) \
+	X(PFNGLPROGRAMUNIFORM4IPROC, glProgramUniform4i) \
+	X(PFNGLPROGRAMUNIFORM4IVPROC, glProgramUniform4iv) \
+	X(PFNGLPROGRAMUNIFORM4FPROC, glProgramUniform4f) \
+	X(PFNGLPROGRAMUNIFORM4FVPROC, glProgramUniform4fv) \
+	X(PFNGLPROGRAMUNIFORM4DPROC, glProgramUniform4d) \
+	X(PFNGLPROGRAMUNIFORM4DVPROC, glProgramUniform4dv) \
+	X(PFNGLPROGRAMUNIFORM4UIPROC, glProgramUniform4ui) \
+	X(PFNGLPROGRAMUNIFORM4UIVPROC, glProgramUniform4uiv) \
+	X(PFNGLPROGRAMUNIFORMMATRIX2FVPROC, glProgramUniformMatrix2fv) \
+	X(PFNGLPROGRAMUNIFORMMATRIX3FVPROC, glProgramUniformMatrix3fv) \
+	X(PFNGLPROGRAMUNIFORMMATRIX4FVPROC, glProgramUniformMatrix4fv) \
+	X(PFNGLPROGRAMUNIFORMMATRIX2DVPROC, glProgramUniformMatrix2dv) \
+	X(PFNGLPROGRAMUNIFORMMATRIX3DVPROC, glProgramUniformMatrix3dv) \
+	X(PFNGLPROGRAMUNIFORMMATRIX4DVPROC, glProgramUniformMatrix4dv) \
+	X(PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC, glProgramUniformMatrix2x3fv) \
+	X(PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC, glProgramUniformMatrix3x2fv) \
+	X(PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC, glProgramUniformMatrix2x4fv) \
+	X(PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC, glProgramUniformMatrix4x2fv) \
+	X(PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC, glProgramUniformMatrix3x4fv) \
+	X(PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC, glProgramUniformMatrix4x3fv) \
+	X(PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC, glProgramUniformMatrix2x3dv) \
+	X(PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC, glProgramUniformMatrix3x2dv) \
+	X(PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC, glProgramUniformMatrix2x4dv) \
+	X(PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC, glProgramUniformMatrix4x2dv) \
+	X(PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC, glProgramUniformMatrix3x4dv) \
+	X(PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC, glProgramUniformMatrix4x3dv) \
+	X(PFNGLVALIDATEPROGRAMPIPELINEPROC, glValidateProgramPipeline) \
+	X(PFNGLVERTEXATTRIBL1DPROC, glVertexAttribL1d) \
+	X(PFNGLVERTEXATTRIBL2DPROC, glVertexAttribL2d) \
+	X(PFNGLVERTEXATTRIBL3DPROC, glVertexAttribL3d) \
+	X(PFNGLVERTEXATTRIBL4DPROC, glVertexAttribL4d) \
+	X(PFNGLVERTEXATTRIBL1DVPROC, glVertexAttribL1dv) \
+	X(PFNGLVERTEXATTRIBL2DVPROC, glVertexAttribL2dv) \
+	X(PFNGLVERTEXATTRIBL3DVPROC, glVertexAttribL3dv) \
+	X(PFNGLVERTEXATTRIBL4DVPROC, glVertexAttribL4dv) \
+	X(PFNGLVERTEXATTRIBLPOINTERPROC, glVertexAttribLPointer) \
+	X(PFNGLVIEWPORTARRAYVPROC, glViewportArrayv) \
+	X(PFNGLVIEWPORTINDEXEDFPROC, glViewportIndexedf) \
+	X(PFNGLVIEWPORTINDEXEDFVPROC, glViewportIndexedfv) \
+	X(PFNGLSCISSORARRAYVPROC, glScissorArrayv) \
+	X(PFNGLSCISSORINDEXEDPROC, glScissorIndexed) \
+	X(PFNGLSCISSORINDEXEDVPROC, glScissorIndexedv) \
+	X(PFNGLDEPTHRANGEARRAYVPROC, glDepthRangeArrayv) \
+	X(PFNGLDEPTHRANGEINDEXEDPROC, glDepthRangeIndexed) \
+
+#define TRACE_COMMANDS_4_2 \
+	X(PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC, glDrawArraysInstancedBaseInstance) \
+	X(PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC, glDrawElementsInstancedBaseInstance) \
+	X(PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC, glDrawElementsInstancedBaseVertexBaseInstance) \
+	X(PFNGLBINDIMAGETEXTUREPROC, glBindImageTexture) \
+	X(PFNGLMEMORYBARRIERPROC, glMemoryBarrier) \
+	X(PFNGLTEXSTORAGE1DPROC, glTexStorage1D) \
+	X(PFNGLTEXSTORAGE2DPROC, glTexStorage2D) \
+	X(PFNGLTEXSTORAGE3DPROC, glTexStorage3D) \
+	X(PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC, glDrawTransformFeedbackInstanced) \
+	X(PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC, glDrawTransformFeedbackStreamInstanced) \
+
+#define TRACE_COMMANDS_4_3 \
+	X(PFNGLCLEARBUFFERDATAPROC, glClearBufferData) \
+	X(PFNGLCLEARBUFFERSUBDATAPROC, glClearBufferSubData) \
+	X(PFNGLDISPATCHCOMPUTEPROC, glDispatchCompute) \
+	X(PFNGLDISPATCHCOMPUTEINDIRECTPROC, glDispatchComputeIndirect) \
+	X(PFNGLCOPYIMAGESUBDATAPROC, glCopyImageSubData) \
+	X(PFNGLFRAMEBUFFERPARAMETERIPROC, glFramebufferParameteri) \
+	X(PFNGLINVALIDATETEXSUBIMAGEPROC, glInvalidateTexSubImage) \
+	X(PFNGLINVALIDATETEXIMAGEPROC, glInvalidateTexImage) \
+	X(PFNGLINVALIDATEBUFFERSUBDATAPROC, glInvalidateBufferSubData) \
+	X(PFNGLINVALIDATEBUFFERDATAPROC, glInvalidateBufferData) \
+	X(PFNGLINVALIDATEFRAMEBUFFERPROC, glInvalidateFramebuffer) \
+	X(PFNGLINVALIDATESUBFRAMEBUFFERPROC, glInvalidateSubFramebuffer) \
+	X(PFNGLMULTIDRAWARRAYSINDIRECTPROC, glMultiDrawArraysIndirect) \
+	X(PFNGLMULTIDRAWELEMENTSINDIRECTPROC, glMultiDrawElementsIndirect) \
+	X(PFNGLSHADERSTORAGEBLOCKBINDINGPROC, glShaderStorageBlockBinding) \
+	X(PFNGLTEXBUFFERRANGEPROC, glTexBufferRange) \
+	X(PFNGLTEXSTORAGE2DMULTISAMPLEPROC, glTexStorage2DMultisample) \
+	X(PFNGLTEXSTORAGE3DMULTISAMPLEPROC, glTexStorage3DMultisample) \
+	X(PFNGLTEXTUREVIEWPROC, glTextureView) \
+	X(PFNGLBINDVERTEXBUFFERPROC, glBindVertexBuffer) \
+	X(PFNGLVERTEXATTRIBFORMATPROC, glVertexAttribFormat) \
+	X(PFNGLVERTEXATTRIBIFORMATPROC, glVertexAttribIFormat) \
+	X(PFNGLVERTEXATTRIBLFORMATPROC, glVertexAttribLFormat) \
+	X(PFNGLVERTEXATTRIBBINDINGPROC, glVertexAttribBinding) \
+	X(PFNGLVERTEXBINDINGDIVISORPROC, glVertexBindingDivisor) \
+	X(PFNGLDEBUGMESSAGECONTROLPROC, glDebugMessageControl) \
+	X(PFNGLDEBUGMESSAGEINSERTPROC, glDebugMessageInsert) \
+	X(PFNGLPUSHDEBUGGROUPPROC, glPushDebugGroup) \
+	X(PFNGLPOPDEBUGGROUPPROC, glPopDebugGroup) \
+	X(PFNGLOBJECTLABELPROC, glObjectLabel) \
+	X(PFNGLOBJECTPTRLABELPROC, glObjectPtrLabel) \
+
+#define TRACE_COMMANDS_4_4 \
+	X(PFNGLBUFFERSTORAGEPROC, glBufferStorage) \
+	X(PFNGLCLEARTEXIMAGEPROC, glClearTexImage) \
+	X(PFNGLCLEARTEXSUBIMAGEPROC, glClearTexSubImage) \
+	X(PFNGLBINDBUFFERSBASEPROC, glBindBuffersBase) \
+	X(PFNGLBINDBUFFERSRANGEPROC, glBindBuffersRange) \
+	X(PFNGLBINDTEXTURESPROC, glBindTextures) \
+	X(PFNGLBINDSAMPLERSPROC, glBindSamplers) \
+	X(PFNGLBINDIMAGETEXTURESPROC, glBindImageTextures) \
+	X(PFNGLBINDVERTEXBUFFERSPROC, glBindVertexBuffers) \
+
+#define TRACE_COMMANDS_4_5 \
+	X(PFNGLCLIPCONTROLPROC, glClipControl) \
+	X(PFNGLCREATETRANSFORMFEEDBACKSPROC, glCreateTransformFeedbacks) \
+	X(PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC, glTransformFeedbackBufferBase) \
+	X(PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC, glTransformFeedbackBufferRange) \
+	X(PFNGLCREATEBUFFERSPROC, glCreateBuffers) \
+	X(PFNGLNAMEDBUFFERSTORAGEPROC, glNamedBufferStorage) \
+	X(PFNGLNAMEDBUFFERDATAPROC, glNamedBufferData) \
+	X(PFNGLNAMEDBUFFERSUBDATAPROC, glNamedBufferSubData) \
+	X(PFNGLCOPYNAMEDBUFFERSUBDATAPROC, glCopyNamedBufferSubData) \
+	X(PFNGLCLEARNAMEDBUFFERDATAPROC, glClearNamedBufferData) \
+	X(PFNGLCLEARNAMEDBUFFERSUBDATAPROC, glClearNamedBufferSubData) \
+	X(PFNGLMAPNAMEDBUFFERPROC, glMapNamedBuffer) \
+	X(PFNGLMAPNAMEDBUFFERRANGEPROC, glMapNamedBufferRange) \
+	X(PFNGLUNMAPNAMEDBUFFERPROC, glUnmapNamedBuffer) \
+	X(PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC, glFlushMappedNamedBufferRange) \
+	X(PFNGLCREATEFRAMEBUFFERSPROC, glCreateFramebuffers) \
+	X(PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC, glNamedFramebufferRenderbuffer) \
+	X(PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC, glNamedFramebufferParameteri) \
+	X(PFNGLNAMEDFRAMEBUFFERTEXTUREPROC, glNamedFramebufferTexture) \
+	X(PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC, glNamedFramebufferTextureLayer) \
+	X(PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC, glNamedFramebufferDrawBuffer) \
+	X(PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC, glNamedFramebufferDrawBuffers) \
+	X(PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC, glNamedFramebufferReadBuffer) \
+	X(PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC, glInvalidateNamedFramebufferData) \
+	X(PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC, glInvalidateNamedFramebufferSubData) \
+	X(PFNGLCLEARNAMEDFRAMEBUFFERIVPROC, glClearNamedFramebufferiv) \
+	X(PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC, glClearNamedFramebufferuiv) \
+	X(PFNGLCLEARNAMEDFRAMEBUFFERFVPROC, glClearNamedFramebufferfv) \
+	X(PFNGLCLEARNAMEDFRAMEBUFFERFIPROC, glClearNamedFramebufferfi) \
+	X(PFNGLBLITNAMEDFRAMEBUFFERPROC, glBlitNamedFramebuffer) \
+	X(PFNGLCREATERENDERBUFFERSPROC, glCreateRenderbuffers) \
+	X(PFNGLNAMEDRENDERBUFFERSTORAGEPROC, glNamedRenderbufferStorage) \
+	X(PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC, glNamedRenderbufferStorageMultisample) \
+	X(PFNGLCREATETEXTURESPROC, glCreateTextures) \
+	X(PFNGLTEXTUREBUFFERPROC, glTextureBuffer) \
+	X(PFNGLTEXTUREBUFFERRANGEPROC, glTextureBufferRange) \
+	X(PFNGLTEXTURESTORAGE1DPROC, glTextureStorage1D) \
+	X(PFNGLTEXTURESTORAGE2DPROC, glTextureStorage2D) \
+	X(PFNGLTEXTURESTORAGE3DPROC, glTextureStorage3D) \
+	X(PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC, glTextureStorage2DMultisample) \
+	X(PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC, glTextureStorage3DMultisample) \
+	X(PFNGLTEXTURESUBIMAGE1DPROC, glTextureSubImage1D) \
+	X(PFNGLTEXTURESUBIMAGE2DPROC, glTextureSubImage2D) \
+	X(PFNGLTEXTURESUBIMAGE3DPROC, glTextureSubImage3D) \
+	X(PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC, glCompressedTextureSubImage1D) \
+	X(PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC, glCompressedTextureSubImage2D) \
+	X(PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC, glCompressedTextureSubImage3D) \
+	X(PFNGLCOPYTEXTURESUBIMAGE1DPROC, glCopyTextureSubImage1D) \
+	X(PFNGLCOPYTEXTURESUBIMAGE2DPROC, glCopyTextureSubImage2D) \
+	X(PFNGLCOPYTEXTURESUBIMAGE3DPROC, glCopyTextureSubImage3D) \
+	X(PFNGLTEXTUREPARAMETERFPROC, glTextureParameterf) \
+	X(PFNGLTEXTUREPARAMETERFVPROC, glTextureParameterfv) \
+	X(PFNGLTEXTUREPARAMETERIPROC, glTextureParameteri) \
+	X(PFNGLTEXTUREPARAMETERIIVPROC, glTextureParameterIiv) \
+	X(PFNGLTEXTUREPARAMETERIUIVPROC, glTextureParameterIuiv) \
+	X(PFNGLTEXTUREPARAMETERIVPROC, glTextureParameteriv) \
+	X(PFNGLGENERATETEXTUREMIPMAPPROC, glGenerateTextureMipmap) \
+	X(PFNGLBINDTEXTUREUNITPROC, glBindTextureUnit) \
+	X(PFNGLCREATEVERTEXARRAYSPROC, glCreateVertexArrays) \
+	X(PFNGLDISABLEVERTEXARRAYATTRIBPROC, glDisableVertexArrayAttrib) \
+	X(PFNGLENABLEVERTEXARRAYATTRIBPROC, glEnableVertexArrayAttrib) \
+	X(PFNGLVERTEXARRAYELEMENTBUFFERPROC, glVertexArrayElementBuffer) \
+	X(PFNGLVERTEXARRAYVERTEXBUFFERPROC, glVertexArrayVertexBuffer) \
+	X(PFNGLVERTEXARRAYVERTEXBUFFERSPROC, glVertexArrayVertexBuffers) \
+	X(PFNGLVERTEXARRAYATTRIBBINDINGPROC, glVertexArrayAttribBinding) \
+	X(PFNGLVERTEXARRAYATTRIBFORMATPROC, glVertexArrayAttribFormat) \
+	X(PFNGLVERTEXARRAYATTRIBIFORMATPROC, glVertexArrayAttribIFormat) \
+	X(PFNGLVERTEXARRAYATTRIBLFORMATPROC, glVertexArrayAttribLFormat) \
+	X(PFNGLVERTEXARRAYBINDINGDIVISORPROC, glVertexArrayBindingDivisor) \
+	X(PFNGLCREATESAMPLERSPROC, glCreateSamplers) \
+	X(PFNGLCREATEPROGRAMPIPELINESPROC, glCreateProgramPipelines) \
+	X(PFNGLCREATEQUERIESPROC, glCreateQueries) \
+	X(PFNGLMEMORYBARRIERBYREGIONPROC, glMemoryBarrierByRegion) \
+	X(PFNGLREADNPIXELSPROC, glReadnPixels) \
+	X(PFNGLTEXTUREBARRIERPROC, glTextureBarrier) \
+
+#define TRACE_COMMANDS_4_6 \
+	X(PFNGLSPECIALIZESHADERPROC, glSpecializeShader) \
+	X(PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC, glMultiDrawArraysIndirectCount) \
+	X(PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC, glMultiDrawElementsIndirectCount) \
+	X(PFNGLPOLYGONOFFSETCLAMPPROC, glPolygonOffsetClamp) \
+
+#if FUNGL_VERSION >= GL_VERSION_1_0
+#define TRACE_COMMANDS_UPTO_1_0 TRACE_COMMANDS_1_0
+#else
+#define TRACE_COMMANDS_UPTO_1_0
+#endif
+#if FUNGL_VERSION >= GL_VERSION_1_1
+#define TRACE_COMMANDS_UPTO_1_1 TRACE_COMMANDS_UPTO_1_0 TRACE_COMMANDS_1_1
+#else
+#define TRACE_COMMANDS_UPTO_1_1 TRACE_COMMANDS_UPTO_1_0
+#endif
+#if FUNGL_VERSION >= GL_VERSION_1_2
+#define TRACE_COMMANDS_UPTO_1_2 TRACE_COMMANDS_UPTO_1_1 TRACE_COMMANDS_1_2
+#else
+#define TRACE_COMMANDS_UPTO_1_2 TRACE_COMMANDS_UPTO_1_1
+#endif
+#if FUNGL_VERSION >= GL_VERSION_1_3
+#define TRACE_COMMANDS_UPTO_1_3 TRACE_COMMANDS_UPTO_1_2 TRACE_COMMANDS_1_3
+#else
+#define TRACE_COMMANDS_UPTO_1_3 TRACE_COMMANDS_UPTO_1_2
+#endif
+#if FUNGL_VERSION >= GL_VERSION_1_4
+#define TRACE_COMMANDS_UPTO_1_4 TRACE_COMMANDS_UPTO_1_3 TRACE_COMMANDS_1_4
+#else
+#define TRACE_COMMANDS_UPTO_1_4 TRACE_COMMANDS_UPTO_1_3
+#endif
+#if FUNGL_VERSION >= GL_VERSION_1_5
+#define TRACE_COMMANDS_UPTO_1_5 TRACE_COMMANDS_UPTO_1_4 TRACE_COMMANDS_1_5
+#else
+#define TRACE_COMMANDS_UPTO_1_5 TRACE_COMMANDS_UPTO_1_4
+#endif
+#if FUNGL_VERSION >= GL_VERSION_2_0
+#define TRACE_COMMANDS_UPTO_2_0 TRACE_COMMANDS_UPTO_1_5 TRACE_COMMANDS_2_0
+#else
+#define TRACE_COMMANDS_UPTO_2_0 TRACE_COMMANDS_UPTO_1_5
+#endif
+#if FUNGL_VERSION >= GL_VERSION_2_1
+#define TRACE_COMMANDS_UPTO_2_1 TRACE_COMMANDS_UPTO_2_0 TRACE_COMMANDS_2_1
+#else
+#define TRACE_COMMANDS_UPTO_2_1 TRACE_COMMANDS_UPTO_2_0
+#endif
+#if FUNGL_VERSION >= GL_VERSION_3_0
+#define TRACE_COMMANDS_UPTO_3_0 TRACE_COMMANDS_UPTO_2_1 TRACE_COMMANDS_3_0
+#else
+#define TRACE_COMMANDS_UPTO_3_0 TRACE_COMMANDS_UPTO_2_1
+#endif
+#if FUNGL_VERSION >= GL_VERSION_3_1
+#define TRACE_COMMANDS_UPTO_3_1 TRACE_COMMANDS_UPTO_3_0 TRACE_COMMANDS_3_1
+#else
+#define TRACE_COMMANDS_UPTO_3_1 TRACE_COMMANDS_UPTO_3_0
+#endif
+#if FUNGL_VERSION >= GL_VERSION_3_2
+#define TRACE_COMMANDS_UPTO_3_2 TRACE_COMMANDS_UPTO_3_1 TRACE_COMMANDS_3_2
+#else
+#define TRACE_COMMANDS_UPTO_3_2 TRACE_COMMANDS_UPTO_3_1
+#endif
+#if FUNGL_VERSION >= GL_VERSION_3_3
+#define TRACE_COMMANDS_UPTO_3_3 TRACE_COMMANDS_UPTO_3_2 TRACE_COMMANDS_3_3
+#else
+#define TRACE_COMMANDS_UPTO_3_3 TRACE_COMMANDS_UPTO_3_2
+#endif
+#if FUNGL_VERSION >= GL_VERSION_4_0
+#define TRACE_COMMANDS_UPTO_4_0 TRACE_COMMANDS_UPTO_3_3 TRACE_COMMANDS_4_0
+#else
+#define TRACE_COMMANDS_UPTO_4_0 TRACE_COMMANDS_UPTO_3_3
+#endif
+#if FUNGL_VERSION >= GL_VERSION_4_1
+#define TRACE_COMMANDS_UPTO_4_1 TRACE_COMMANDS_UPTO_4_0 TRACE_COMMANDS_4_1
+#else
+#define TRACE_COMMANDS_UPTO_4_1 TRACE_COMMANDS_UPTO_4_0
+#endif
+#if FUNGL_VERSION >= GL_VERSION_4_2
+#define TRACE_COMMANDS_UPTO_4_2 TRACE_COMMANDS_UPTO_4_1 TRACE_COMMANDS_4_2
+#else
+#define TRACE_COMMANDS_UPTO_4_2 TRACE_COMMANDS_UPTO_4_1
+#endif
+#if FUNGL_VERSION >= GL_VERSION_4_3
+#define TRACE_COMMANDS_UPTO_4_3 TRACE_COMMANDS_UPTO_4_2 TRACE_COMMANDS_4_3
+#else
+#define TRACE_COMMANDS_UPTO_4_3 TRACE_COMMANDS_UPTO_4_2
+#endif
+#if FUNGL_VERSION >= GL_VERSION_4_4
+#define TRACE_COMMANDS_UPTO_4_4 TRACE_COMMANDS_UPTO_4_3 TRACE_COMMANDS_4_4
+#else
+#define TRACE_COMMANDS_UPTO_4_4 TRACE_COMMANDS_UPTO_4_3
+#endif
+#if FUNGL_VERSION >= GL_VERSION_4_5
+#define TRACE_COMMANDS_UPTO_4_5 TRACE_COMMANDS_UPTO_4_4 TRACE_COMMANDS_4_5
+#else
+#define TRACE_COMMANDS_UPTO_4_5 TRACE_COMMANDS_UPTO_4_4
+#endif
+#if FUNGL_VERSION >= GL_VERSION_4_6
+#define TRACE_COMMANDS_UPTO_4_6 TRACE_COMMANDS_UPTO_4_5 TRACE_COMMANDS_4_6
+#else
+#define TRACE_COMMANDS_UPTO_4_6 TRACE_COMMANDS_UPTO_4_5
+#endif
+#define TRACE_COMMANDS TRACE_COMMANDS_UPTO_4_6
+
+#define X(T, N) T N;
+static struct {
+    TRACE_COMMANDS
+} trace_real;
+#undef X
+
+#if FUNGL_VERSION >= GL_VERSION_1_0
+static void APIENTRY trace_glCullFace(GLenum mode) {
+    trace_command(TRACE_glCullFace);
+    trace_write_uint(mode);
+    trace_real.glCullFace(mode);
+}
+
+static void trace_replay_glCullFace(struct trace_reader *reader) {
+    if (!__glCullFace) {
+        trace_missing(reader, TRACE_glCullFace);
+        return;
+    }
+    GLenum mode = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glCullFace(mode);
+}
+
+static void APIENTRY trace_glFrontFace(GLenum mode) {
+    trace_command(TRACE_glFrontFace);
+    trace_write_uint(mode);
+    trace_real.glFrontFace(mode);
+}
+
+static void trace_replay_glFrontFace(struct trace_reader *reader) {
+    if (!__glFrontFace) {
+        trace_missing(reader, TRACE_glFrontFace);
+        return;
+    }
+    GLenum mode = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glFrontFace(mode);
+}
+
+static void APIENTRY trace_glHint(GLenum target, GLenum mode) {
+    trace_command(TRACE_glHint);
+    trace_write_uint(target);
+    trace_write_uint(mode);
+    trace_real.glHint(target, mode);
+}
+
+static void trace_replay_glHint(struct trace_reader *reader) {
+    if (!__glHint) {
+        trace_missing(reader, TRACE_glHint);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLenum mode = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glHint(target, mode);
+}
+
+static void APIENTRY trace_glLineWidth(GLfloat width) {
+    trace_command(TRACE_glLineWidth);
+    trace_write_float(width);
+    trace_real.glLineWidth(width);
+}
+
+static void trace_replay_glLineWidth(struct trace_reader *reader) {
+    if (!__glLineWidth) {
+        trace_missing(reader, TRACE_glLineWidth);
+        return;
+    }
+    GLfloat width = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glLineWidth(width);
+}
+
+static void APIENTRY trace_glPointSize(GLfloat size) {
+    trace_command(TRACE_glPointSize);
+    trace_write_float(size);
+    trace_real.glPointSize(size);
+}
+
+static void trace_replay_glPointSize(struct trace_reader *reader) {
+    if (!__glPointSize) {
+        trace_missing(reader, TRACE_glPointSize);
+        return;
+    }
+    GLfloat size = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glPointSize(size);
+}
+
+static void APIENTRY trace_glPolygonMode(GLenum face, GLenum mode) {
+    trace_command(TRACE_glPolygonMode);
+    trace_write_uint(face);
+    trace_write_uint(mode);
+    trace_real.glPolygonMode(face, mode);
+}
+
+static void trace_replay_glPolygonMode(struct trace_reader *reader) {
+    if (!__glPolygonMode) {
+        trace_missing(reader, TRACE_glPolygonMode);
+        return;
+    }
+    GLenum face = (GLenum)trace_read_uint(reader);
+    GLenum mode = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glPolygonMode(face, mode);
+}
+
+static void APIENTRY trace_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+    trace_command(TRACE_glScissor);
+    trace_write_int(x);
+    trace_write_int(y);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_real.glScissor(x, y, width, height);
+}
+
+static void trace_replay_glScissor(struct trace_reader *reader) {
+    if (!__glScissor) {
+        trace_missing(reader, TRACE_glScissor);
+        return;
+    }
+    GLint x = (GLint)trace_read_int(reader);
+    GLint y = (GLint)trace_read_int(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glScissor(x, y, width, height);
+}
+
+static void APIENTRY trace_glTexParameterf(GLenum target, GLenum pname, GLfloat param) {
+    trace_command(TRACE_glTexParameterf);
+    trace_write_uint(target);
+    trace_write_uint(pname);
+    trace_write_float(param);
+    trace_real.glTexParameterf(target, pname, param);
+}
+
+static void trace_replay_glTexParameterf(struct trace_reader *reader) {
+    if (!__glTexParameterf) {
+        trace_missing(reader, TRACE_glTexParameterf);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    GLfloat param = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glTexParameterf(target, pname, param);
+}
+
+static void APIENTRY trace_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params) {
+    trace_command(TRACE_glTexParameterfv);
+    trace_write_uint(target);
+    trace_write_uint(pname);
+    trace_write_array(params, (size_t)(trace_pname_count(pname)), sizeof(GLfloat));
+    trace_real.glTexParameterfv(target, pname, params);
+}
+
+static void trace_replay_glTexParameterfv(struct trace_reader *reader) {
+    if (!__glTexParameterfv) {
+        trace_missing(reader, TRACE_glTexParameterfv);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    const GLfloat *params = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glTexParameterfv(target, pname, params);
+}
+
+static void APIENTRY trace_glTexParameteri(GLenum target, GLenum pname, GLint param) {
+    trace_command(TRACE_glTexParameteri);
+    trace_write_uint(target);
+    trace_write_uint(pname);
+    trace_write_int(param);
+    trace_real.glTexParameteri(target, pname, param);
+}
+
+static void trace_replay_glTexParameteri(struct trace_reader *reader) {
+    if (!__glTexParameteri) {
+        trace_missing(reader, TRACE_glTexParameteri);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    GLint param = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glTexParameteri(target, pname, param);
+}
+
+static void APIENTRY trace_glTexParameteriv(GLenum target, GLenum pname, const GLint *params) {
+    trace_command(TRACE_glTexParameteriv);
+    trace_write_uint(target);
+    trace_write_uint(pname);
+    trace_write_array(params, (size_t)(trace_pname_count(pname)), sizeof(GLint));
+    trace_real.glTexParameteriv(target, pname, params);
+}
+
+static void trace_replay_glTexParameteriv(struct trace_reader *reader) {
+    if (!__glTexParameteriv) {
+        trace_missing(reader, TRACE_glTexParameteriv);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    const GLint *params = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glTexParameteriv(target, pname, params);
+}
+
+static void APIENTRY trace_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) {
+    trace_command(TRACE_glTexImage1D);
+    trace_write_uint(target);
+    trace_write_int(level);
+    trace_write_int(internalformat);
+    trace_write_int(width);
+    trace_write_int(border);
+    trace_write_uint(format);
+    trace_write_uint(type);
+    trace_write_unpack(pixels, trace_pixels_span(format, type, width, 1, 1, false));
+    trace_real.glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+}
+
+static void trace_replay_glTexImage1D(struct trace_reader *reader) {
+    if (!__glTexImage1D) {
+        trace_missing(reader, TRACE_glTexImage1D);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLint level = (GLint)trace_read_int(reader);
+    GLint internalformat = (GLint)trace_read_int(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLint border = (GLint)trace_read_int(reader);
+    GLenum format = (GLenum)trace_read_uint(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const void *pixels = trace_read_unpack(reader);
+    if (reader->error)
+        return;
+    __glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+}
+
+static void APIENTRY trace_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+    trace_command(TRACE_glTexImage2D);
+    trace_write_uint(target);
+    trace_write_int(level);
+    trace_write_int(internalformat);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_write_int(border);
+    trace_write_uint(format);
+    trace_write_uint(type);
+    trace_write_unpack(pixels, trace_pixels_span(format, type, width, height, 1, false));
+    trace_real.glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+}
+
+static void trace_replay_glTexImage2D(struct trace_reader *reader) {
+    if (!__glTexImage2D) {
+        trace_missing(reader, TRACE_glTexImage2D);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLint level = (GLint)trace_read_int(reader);
+    GLint internalformat = (GLint)trace_read_int(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    GLint border = (GLint)trace_read_int(reader);
+    GLenum format = (GLenum)trace_read_uint(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const void *pixels = trace_read_unpack(reader);
+    if (reader->error)
+        return;
+    __glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+}
+
+static void APIENTRY trace_glDrawBuffer(GLenum buf) {
+    trace_command(TRACE_glDrawBuffer);
+    trace_write_uint(buf);
+    trace_real.glDrawBuffer(buf);
+}
+
+static void trace_replay_glDrawBuffer(struct trace_reader *reader) {
+    if (!__glDrawBuffer) {
+        trace_missing(reader, TRACE_glDrawBuffer);
+        return;
+    }
+    GLenum buf = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glDrawBuffer(buf);
+}
+
+static void APIENTRY trace_glClear(GLbitfield mask) {
+    trace_command(TRACE_glClear);
+    trace_write_uint(mask);
+    trace_real.glClear(mask);
+}
+
+static void trace_replay_glClear(struct trace_reader *reader) {
+    if (!__glClear) {
+        trace_missing(reader, TRACE_glClear);
+        return;
+    }
+    GLbitfield mask = (GLbitfield)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glClear(mask);
+}
+
+static void APIENTRY trace_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    trace_command(TRACE_glClearColor);
+    trace_write_float(red);
+    trace_write_float(green);
+    trace_write_float(blue);
+    trace_write_float(alpha);
+    trace_real.glClearColor(red, green, blue, alpha);
+}
+
+static void trace_replay_glClearColor(struct trace_reader *reader) {
+    if (!__glClearColor) {
+        trace_missing(reader, TRACE_glClearColor);
+        return;
+    }
+    GLfloat red = trace_read_float(reader);
+    GLfloat green = trace_read_float(reader);
+    GLfloat blue = trace_read_float(reader);
+    GLfloat alpha = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glClearColor(red, green, blue, alpha);
+}
+
+static void APIENTRY trace_glClearStencil(GLint s) {
+    trace_command(TRACE_glClearStencil);
+    trace_write_int(s);
+    trace_real.glClearStencil(s);
+}
+
+static void trace_replay_glClearStencil(struct trace_reader *reader) {
+    if (!__glClearStencil) {
+        trace_missing(reader, TRACE_glClearStencil);
+        return;
+    }
+    GLint s = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glClearStencil(s);
+}
+
+static void APIENTRY trace_glClearDepth(GLdouble depth) {
+    trace_command(TRACE_glClearDepth);
+    trace_write_double(depth);
+    trace_real.glClearDepth(depth);
+}
+
+static void trace_replay_glClearDepth(struct trace_reader *reader) {
+    if (!__glClearDepth) {
+        trace_missing(reader, TRACE_glClearDepth);
+        return;
+    }
+    GLdouble depth = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glClearDepth(depth);
+}
+
+static void APIENTRY trace_glStencilMask(GLuint mask) {
+    trace_command(TRACE_glStencilMask);
+    trace_write_uint(mask);
+    trace_real.glStencilMask(mask);
+}
+
+static void trace_replay_glStencilMask(struct trace_reader *reader) {
+    if (!__glStencilMask) {
+        trace_missing(reader, TRACE_glStencilMask);
+        return;
+    }
+    GLuint mask = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glStencilMask(mask);
+}
+
+static void APIENTRY trace_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+    trace_command(TRACE_glColorMask);
+    trace_write_uint(red);
+    trace_write_uint(green);
+    trace_write_uint(blue);
+    trace_write_uint(alpha);
+    trace_real.glColorMask(red, green, blue, alpha);
+}
+
+static void trace_replay_glColorMask(struct trace_reader *reader) {
+    if (!__glColorMask) {
+        trace_missing(reader, TRACE_glColorMask);
+        return;
+    }
+    GLboolean red = (GLboolean)trace_read_uint(reader);
+    GLboolean green = (GLboolean)trace_read_uint(reader);
+    GLboolean blue = (GLboolean)trace_read_uint(reader);
+    GLboolean alpha = (GLboolean)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glColorMask(red, green, blue, alpha);
+}
+
+static void APIENTRY trace_glDepthMask(GLboolean flag) {
+    trace_command(TRACE_glDepthMask);
+    trace_write_uint(flag);
+    trace_real.glDepthMask(flag);
+}
+
+static void trace_replay_glDepthMask(struct trace_reader *reader) {
+    if (!__glDepthMask) {
+        trace_missing(reader, TRACE_glDepthMask);
+        return;
+    }
+    GLboolean flag = (GLboolean)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glDepthMask(flag);
+}
+
+static void APIENTRY trace_glDisable(GLenum cap) {
+    trace_command(TRACE_glDisable);
+    trace_write_uint(cap);
+    trace_real.glDisable(cap);
+}
+
+static void trace_replay_glDisable(struct trace_reader *reader) {
+    if (!__glDisable) {
+        trace_missing(reader, TRACE_glDisable);
+        return;
+    }
+    GLenum cap = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glDisable(cap);
+}
+
+static void APIENTRY trace_glEnable(GLenum cap) {
+    trace_command(TRACE_glEnable);
+    trace_write_uint(cap);
+    trace_real.glEnable(cap);
+}
+
+static void trace_replay_glEnable(struct trace_reader *reader) {
+    if (!__glEnable) {
+        trace_missing(reader, TRACE_glEnable);
+        return;
+    }
+    GLenum cap = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glEnable(cap);
+}
+
+static void APIENTRY trace_glFinish(void) {
+    trace_command(TRACE_glFinish);
+    trace_real.glFinish();
+}
+
+static void trace_replay_glFinish(struct trace_reader *reader) {
+    if (!__glFinish) {
+        trace_missing(reader, TRACE_glFinish);
+        return;
+    }
+    if (reader->error)
+        return;
+    __glFinish();
+}
+
+static void APIENTRY trace_glFlush(void) {
+    trace_command(TRACE_glFlush);
+    trace_real.glFlush();
+}
+
+static void trace_replay_glFlush(struct trace_reader *reader) {
+    if (!__glFlush) {
+        trace_missing(reader, TRACE_glFlush);
+        return;
+    }
+    if (reader->error)
+        return;
+    __glFlush();
+}
+
+static void APIENTRY trace_glBlendFunc(GLenum sfactor, GLenum dfactor) {
+    trace_command(TRACE_glBlendFunc);
+    trace_write_uint(sfactor);
+    trace_write_uint(dfactor);
+    trace_real.glBlendFunc(sfactor, dfactor);
+}
+
+static void trace_replay_glBlendFunc(struct trace_reader *reader) {
+    if (!__glBlendFunc) {
+        trace_missing(reader, TRACE_glBlendFunc);
+        return;
+    }
+    GLenum sfactor = (GLenum)trace_read_uint(reader);
+    GLenum dfactor = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glBlendFunc(sfactor, dfactor);
+}
+
+static void APIENTRY trace_glLogicOp(GLenum opcode) {
+    trace_command(TRACE_glLogicOp);
+    trace_write_uint(opcode);
+    trace_real.glLogicOp(opcode);
+}
+
+static void trace_replay_glLogicOp(struct trace_reader *reader) {
+    if (!__glLogicOp) {
+        trace_missing(reader, TRACE_glLogicOp);
+        return;
+    }
+    GLenum opcode = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glLogicOp(opcode);
+}
+
+static void APIENTRY trace_glStencilFunc(GLenum func, GLint ref, GLuint mask) {
+    trace_command(TRACE_glStencilFunc);
+    trace_write_uint(func);
+    trace_write_int(ref);
+    trace_write_uint(mask);
+    trace_real.glStencilFunc(func, ref, mask);
+}
+
+static void trace_replay_glStencilFunc(struct trace_reader *reader) {
+    if (!__glStencilFunc) {
+        trace_missing(reader, TRACE_glStencilFunc);
+        return;
+    }
+    GLenum func = (GLenum)trace_read_uint(reader);
+    GLint ref = (GLint)trace_read_int(reader);
+    GLuint mask = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glStencilFunc(func, ref, mask);
+}
+
+static void APIENTRY trace_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
+    trace_command(TRACE_glStencilOp);
+    trace_write_uint(fail);
+    trace_write_uint(zfail);
+    trace_write_uint(zpass);
+    trace_real.glStencilOp(fail, zfail, zpass);
+}
+
+static void trace_replay_glStencilOp(struct trace_reader *reader) {
+    if (!__glStencilOp) {
+        trace_missing(reader, TRACE_glStencilOp);
+        return;
+    }
+    GLenum fail = (GLenum)trace_read_uint(reader);
+    GLenum zfail = (GLenum)trace_read_uint(reader);
+    GLenum zpass = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glStencilOp(fail, zfail, zpass);
+}
+
+static void APIENTRY trace_glDepthFunc(GLenum func) {
+    trace_command(TRACE_glDepthFunc);
+    trace_write_uint(func);
+    trace_real.glDepthFunc(func);
+}
+
+static void trace_replay_glDepthFunc(struct trace_reader *reader) {
+    if (!__glDepthFunc) {
+        trace_missing(reader, TRACE_glDepthFunc);
+        return;
+    }
+    GLenum func = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glDepthFunc(func);
+}
+
+static void APIENTRY trace_glPixelStoref(GLenum pname, GLfloat param) {
+    trace_command(TRACE_glPixelStoref);
+    trace_write_uint(pname);
+    trace_write_float(param);
+    trace_real.glPixelStoref(pname, param);
+}
+
+static void trace_replay_glPixelStoref(struct trace_reader *reader) {
+    if (!__glPixelStoref) {
+        trace_missing(reader, TRACE_glPixelStoref);
+        return;
+    }
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    GLfloat param = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glPixelStoref(pname, param);
+}
+
+static void APIENTRY trace_glPixelStorei(GLenum pname, GLint param) {
+    trace_command(TRACE_glPixelStorei);
+    trace_write_uint(pname);
+    trace_write_int(param);
+    trace_real.glPixelStorei(pname, param);
+}
+
+static void trace_replay_glPixelStorei(struct trace_reader *reader) {
+    if (!__glPixelStorei) {
+        trace_missing(reader, TRACE_glPixelStorei);
+        return;
+    }
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    GLint param = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glPixelStorei(pname, param);
+}
+
+static void APIENTRY trace_glReadBuffer(GLenum src) {
+    trace_command(TRACE_glReadBuffer);
+    trace_write_uint(src);
+    trace_real.glReadBuffer(src);
+}
+
+static void trace_replay_glReadBuffer(struct trace_reader *reader) {
+    if (!__glReadBuffer) {
+        trace_missing(reader, TRACE_glReadBuffer);
+        return;
+    }
+    GLenum src = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glReadBuffer(src);
+}
+
+static void APIENTRY trace_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) {
+    trace_command(TRACE_glReadPixels);
+    trace_write_int(x);
+    trace_write_int(y);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_write_uint(format);
+    trace_write_uint(type);
+    trace_write_pack(pixels, trace_pixels_span(format, type, width, height, 1, true));
+    trace_real.glReadPixels(x, y, width, height, format, type, pixels);
+}
+
+static void trace_replay_glReadPixels(struct trace_reader *reader) {
+    if (!__glReadPixels) {
+        trace_missing(reader, TRACE_glReadPixels);
+        return;
+    }
+    GLint x = (GLint)trace_read_int(reader);
+    GLint y = (GLint)trace_read_int(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    GLenum format = (GLenum)trace_read_uint(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    void *pixels = trace_read_pack(reader);
+    if (reader->error)
+        return;
+    __glReadPixels(x, y, width, height, format, type, pixels);
+}
+
+static void APIENTRY trace_glDepthRange(GLdouble n, GLdouble f) {
+    trace_command(TRACE_glDepthRange);
+    trace_write_double(n);
+    trace_write_double(f);
+    trace_real.glDepthRange(n, f);
+}
+
+static void trace_replay_glDepthRange(struct trace_reader *reader) {
+    if (!__glDepthRange) {
+        trace_missing(reader, TRACE_glDepthRange);
+        return;
+    }
+    GLdouble n = trace_read_double(reader);
+    GLdouble f = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glDepthRange(n, f);
+}
+
+static void APIENTRY trace_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+    trace_command(TRACE_glViewport);
+    trace_write_int(x);
+    trace_write_int(y);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_real.glViewport(x, y, width, height);
+}
+
+static void trace_replay_glViewport(struct trace_reader *reader) {
+    if (!__glViewport) {
+        trace_missing(reader, TRACE_glViewport);
+        return;
+    }
+    GLint x = (GLint)trace_read_int(reader);
+    GLint y = (GLint)trace_read_int(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glViewport(x, y, width, height);
+}
+
+static void APIENTRY trace_glNewList(GLuint list, GLenum mode) {
+    trace_command(TRACE_glNewList);
+    trace_write_uint(list);
+    trace_write_uint(mode);
+    trace_real.glNewList(list, mode);
+}
+
+static void trace_replay_glNewList(struct trace_reader *reader) {
+    if (!__glNewList) {
+        trace_missing(reader, TRACE_glNewList);
+        return;
+    }
+    GLuint list = trace_name(reader, TRACE_NAME_DISPLAY_LIST, (GLuint)trace_read_uint(reader));
+    GLenum mode = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glNewList(list, mode);
+}
+
+static void APIENTRY trace_glEndList(void) {
+    trace_command(TRACE_glEndList);
+    trace_real.glEndList();
+}
+
+static void trace_replay_glEndList(struct trace_reader *reader) {
+    if (!__glEndList) {
+        trace_missing(reader, TRACE_glEndList);
+        return;
+    }
+    if (reader->error)
+        return;
+    __glEndList();
+}
+
+static void APIENTRY trace_glCallList(GLuint list) {
+    trace_command(TRACE_glCallList);
+    trace_write_uint(list);
+    trace_real.glCallList(list);
+}
+
+static void trace_replay_glCallList(struct trace_reader *reader) {
+    if (!__glCallList) {
+        trace_missing(reader, TRACE_glCallList);
+        return;
+    }
+    GLuint list = trace_name(reader, TRACE_NAME_DISPLAY_LIST, (GLuint)trace_read_uint(reader));
+    if (reader->error)
+        return;
+    __glCallList(list);
+}
+
+static void APIENTRY trace_glCallLists(GLsizei n, GLenum type, const void *lists) {
+    trace_command(TRACE_glCallLists);
+    trace_write_int(n);
+    trace_write_uint(type);
+    trace_write_array(lists, (size_t)((n)*trace_type_size(type)), 1);
+    trace_real.glCallLists(n, type, lists);
+}
+
+static void trace_replay_glCallLists(struct trace_reader *reader) {
+    if (!__glCallLists) {
+        trace_missing(reader, TRACE_glCallLists);
+        return;
+    }
+    GLsizei n = (GLsizei)trace_read_int(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const void *lists = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glCallLists(n, type, lists);
+}
+
+static void APIENTRY trace_glDeleteLists(GLuint list, GLsizei range) {
+    trace_command(TRACE_glDeleteLists);
+    trace_write_uint(list);
+    trace_write_int(range);
+    trace_real.glDeleteLists(list, range);
+}
+
+static void trace_replay_glDeleteLists(struct trace_reader *reader) {
+    if (!__glDeleteLists) {
+        trace_missing(reader, TRACE_glDeleteLists);
+        return;
+    }
+    GLuint list = trace_name(reader, TRACE_NAME_DISPLAY_LIST, (GLuint)trace_read_uint(reader));
+    GLsizei range = (GLsizei)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glDeleteLists(list, range);
+}
+
+static GLuint APIENTRY trace_glGenLists(GLsizei range) {
+    trace_command(TRACE_glGenLists);
+    trace_write_int(range);
+    GLuint result = trace_real.glGenLists(range);
+    trace_write_uint(result);
+    return result;
+}
+
+static void trace_replay_glGenLists(struct trace_reader *reader) {
+    if (!__glGenLists) {
+        trace_missing(reader, TRACE_glGenLists);
+        return;
+    }
+    GLsizei range = (GLsizei)trace_read_int(reader);
+    if (reader->error)
+        return;
+    GLuint result = __glGenLists(range);
+    trace_map_name(reader, TRACE_NAME_DISPLAY_LIST, (GLuint)trace_read_uint(reader), result, range);
+}
+
+static void APIENTRY trace_glListBase(GLuint base) {
+    trace_command(TRACE_glListBase);
+    trace_write_uint(base);
+    trace_real.glListBase(base);
+}
+
+static void trace_replay_glListBase(struct trace_reader *reader) {
+    if (!__glListBase) {
+        trace_missing(reader, TRACE_glListBase);
+        return;
+    }
+    GLuint base = trace_name(reader, TRACE_NAME_DISPLAY_LIST, (GLuint)trace_read_uint(reader));
+    if (reader->error)
+        return;
+    __glListBase(base);
+}
+
+static void APIENTRY trace_glBegin(GLenum mode) {
+    trace_command(TRACE_glBegin);
+    trace_write_uint(mode);
+    trace_real.glBegin(mode);
+}
+
+static void trace_replay_glBegin(struct trace_reader *reader) {
+    if (!__glBegin) {
+        trace_missing(reader, TRACE_glBegin);
+        return;
+    }
+    GLenum mode = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glBegin(mode);
+}
+
+static void APIENTRY trace_glBitmap(GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLfloat xmove, GLfloat ymove, const GLubyte *bitmap) {
+    trace_command(TRACE_glBitmap);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_write_float(xorig);
+    trace_write_float(yorig);
+    trace_write_float(xmove);
+    trace_write_float(ymove);
+    trace_write_array(bitmap, (size_t)(((width) + 7) / 8 * (height)), sizeof(GLubyte));
+    trace_real.glBitmap(width, height, xorig, yorig, xmove, ymove, bitmap);
+}
+
+static void trace_replay_glBitmap(struct trace_reader *reader) {
+    if (!__glBitmap) {
+        trace_missing(reader, TRACE_glBitmap);
+        return;
+    }
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    GLfloat xorig = trace_read_float(reader);
+    GLfloat yorig = trace_read_float(reader);
+    GLfloat xmove = trace_read_float(reader);
+    GLfloat ymove = trace_read_float(reader);
+    const GLubyte *bitmap = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glBitmap(width, height, xorig, yorig, xmove, ymove, bitmap);
+}
+
+static void APIENTRY trace_glColor3b(GLbyte red, GLbyte green, GLbyte blue) {
+    trace_command(TRACE_glColor3b);
+    trace_write_int(red);
+    trace_write_int(green);
+    trace_write_int(blue);
+    trace_real.glColor3b(red, green, blue);
+}
+
+static void trace_replay_glColor3b(struct trace_reader *reader) {
+    if (!__glColor3b) {
+        trace_missing(reader, TRACE_glColor3b);
+        return;
+    }
+    GLbyte red = (GLbyte)trace_read_int(reader);
+    GLbyte green = (GLbyte)trace_read_int(reader);
+    GLbyte blue = (GLbyte)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glColor3b(red, green, blue);
+}
+
+static void APIENTRY trace_glColor3bv(const GLbyte *v) {
+    trace_command(TRACE_glColor3bv);
+    trace_write_array(v, (size_t)(3), sizeof(GLbyte));
+    trace_real.glColor3bv(v);
+}
+
+static void trace_replay_glColor3bv(struct trace_reader *reader) {
+    if (!__glColor3bv) {
+        trace_missing(reader, TRACE_glColor3bv);
+        return;
+    }
+    const GLbyte *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glColor3bv(v);
+}
+
+static void APIENTRY trace_glColor3d(GLdouble red, GLdouble green, GLdouble blue) {
+    trace_command(TRACE_glColor3d);
+    trace_write_double(red);
+    trace_write_double(green);
+    trace_write_double(blue);
+    trace_real.glColor3d(red, green, blue);
+}
+
+static void trace_replay_glColor3d(struct trace_reader *reader) {
+    if (!__glColor3d) {
+        trace_missing(reader, TRACE_glColor3d);
+        return;
+    }
+    GLdouble red = trace_read_double(reader);
+    GLdouble green = trace_read_double(reader);
+    GLdouble blue = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glColor3d(red, green, blue);
+}
+
+static void APIENTRY trace_glColor3dv(const GLdouble *v) {
+    trace_command(TRACE_glColor3dv);
+    trace_write_array(v, (size_t)(3), sizeof(GLdouble));
+    trace_real.glColor3dv(v);
+}
+
+static void trace_replay_glColor3dv(struct trace_reader *reader) {
+    if (!__glColor3dv) {
+        trace_missing(reader, TRACE_glColor3dv);
+        return;
+    }
+    const GLdouble *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glColor3dv(v);
+}
+
+static void APIENTRY trace_glColor3f(GLfloat red, GLfloat green, GLfloat blue) {
+    trace_command(TRACE_glColor3f);
+    trace_write_float(red);
+    trace_write_float(green);
+    trace_write_float(blue);
+    trace_real.glColor3f(red, green, blue);
+}
+
+static void trace_replay_glColor3f(struct trace_reader *reader) {
+    if (!__glColor3f) {
+        trace_missing(reader, TRACE_glColor3f);
+        return;
+    }
+    GLfloat red = trace_read_float(reader);
+    GLfloat green = trace_read_float(reader);
+    GLfloat blue = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glColor3f(red, green, blue);
+}
+
+static void APIENTRY trace_glColor3fv(const GLfloat *v) {
+    trace_command(TRACE_glColor3fv);
+    trace_write_array(v, (size_t)(3), sizeof(GLfloat));
+    trace_real.glColor3fv(v);
+}
+
+static void trace_replay_glColor3fv(struct trace_reader *reader) {
+    if (!__glColor3fv) {
+        trace_missing(reader, TRACE_glColor3fv);
+        return;
+    }
+    const GLfloat *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glColor3fv(v);
+}
+
+static void APIENTRY trace_glColor3i(GLint red, GLint green, GLint blue) {
+    trace_command(TRACE_glColor3i);
+    trace_write_int(red);
+    trace_write_int(green);
+    trace_write_int(blue);
+    trace_real.glColor3i(red, green, blue);
+}
+
+static void trace_replay_glColor3i(struct trace_reader *reader) {
+    if (!__glColor3i) {
+        trace_missing(reader, TRACE_glColor3i);
+        return;
+    }
+    GLint red = (GLint)trace_read_int(reader);
+    GLint green = (GLint)trace_read_int(reader);
+    GLint blue = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glColor3i(red, green, blue);
+}
+
+static void APIENTRY trace_glColor3iv(const GLint *v) {
+    trace_command(TRACE_glColor3iv);
+    trace_write_array(v, (size_t)(3), sizeof(GLint));
+    trace_real.glColor3iv(v);
+}
+
+static void trace_replay_glColor3iv(struct trace_reader *reader) {
+    if (!__glColor3iv) {
+        trace_missing(reader, TRACE_glColor3iv);
+        return;
+    }
+    const GLint *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glColor3iv(v);
+}
+
+static void APIENTRY trace_glColor3s(GLshort red, GLshort green, GLshort blue) {
+    trace_command(TRACE_glColor3s);
+    trace_write_int(red);
+    trace_write_int(green);
+    trace_write_int(blue);
+    trace_real.glColor3s(red, green, blue);
+}
+
+static void trace_replay_glColor3s(struct trace_reader *reader) {
+    if (!__glColor3s) {
+        trace_missing(reader, TRACE_glColor3s);
+        return;
+    }
+    GLshort red = (GLshort)trace_read_int(reader);
+    GLshort green = (GLshort)trace_read_int(reader);
+    GLshort blue = (GLshort)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glColor3s(red, green, blue);
+}
+
+static void APIENTRY trace_glColor3sv(const GLshort *v) {
+    trace_command(TRACE_glColor3sv);
+    trace_write_array(v, (size_t)(3), sizeof(GLshort));
+    trace_real.glColor3sv(v);
+}
+
+static void trace_replay_glColor3sv(struct trace_reader *reader) {
+    if (!__glColor3sv) {
+        trace_missing(reader, TRACE_glColor3sv);
+        return;
+    }
+    const GLshort *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glColor3sv(v);
+}
+
+static void APIENTRY trace_glColor3ub(GLubyte red, GLubyte green, GLubyte blue) {
+    trace_command(TRACE_glColor3ub);
+    trace_write_uint(red);
+    trace_write_uint(green);
+    trace_write_uint(blue);
+    trace_real.glColor3ub(red, green, blue);
+}
+
+static void trace_replay_glColor3ub(struct trace_reader *reader) {
+    if (!__glColor3ub) {
+        trace_missing(reader, TRACE_glColor3ub);
+        return;
+    }
+    GLubyte red = (GLubyte)trace_read_uint(reader);
+    GLubyte green = (GLubyte)trace_read_uint(reader);
+    GLubyte blue = (GLubyte)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glColor3ub(red, green, blue);
+}
+
+static void APIENTRY trace_glColor3ubv(const GLubyte *v) {
+    trace_command(TRACE_glColor3ubv);
+    trace_write_array(v, (size_t)(3), sizeof(GLubyte));
+    trace_real.glColor3ubv(v);
+}
+
+static void trace_replay_glColor3ubv(struct trace_reader *reader) {
+    if (!__glColor3ubv) {
+        trace_missing(reader, TRACE_glColor3ubv);
+        return;
+    }
+    const GLubyte *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glColor3ubv(v);
+}
+
+static void APIENTRY trace_glColor3ui(GLuint red, GLuint green, GLuint blue) {
+    trace_command(TRACE_glColor3ui);
+    trace_write_uint(red);
+    trace_write_uint(green);
+    trace_write_uint(blue);
+    trace_real.glColor3ui(red, green, blue);
+}
+
+static void trace_replay_glColor3ui(struct trace_reader *reader) {
+    if (!__glColor3ui) {
+        trace_missing(reader, TRACE_glColor3ui);
+        return;
+    }
+    GLuint red = (GLuint)trace_read_uint(reader);
+    GLuint green = (GLuint)trace_read_uint(reader);
+    GLuint blue = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glColor3ui(red, green, blue);
+}
+
+static void APIENTRY trace_glColor3uiv(const GLuint *v) {
+    trace_command(TRACE_glColor3uiv);
+    trace_write_array(v, (size_t)(3), sizeof(GLuint));
+    trace_real.glColor3uiv(v);
+}
+
+static void trace_replay_glColor3uiv(struct trace_reader *reader) {
+    if (!__glColor3uiv) {
+        trace_missing(reader, TRACE_glColor3uiv);
+        return;
+    }
+    const GLuint *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glColor3uiv(v);
+}
+
+static void APIENTRY trace_glColor3us(GLushort red, GLushort green, GLushort blue) {
+    trace_command(TRACE_glColor3us);
+    trace_write_uint(red);
+    trace_write_uint(green);
+    trace_write_uint(blue);
+    trace_real.glColor3us(red, green, blue);
+}
+
+static void trace_replay_glColor3us(struct trace_reader *reader) {
+    if (!__glColor3us) {
+        trace_missing(reader, TRACE_glColor3us);
+        return;
+    }
+    GLushort red = (GLushort)trace_read_uint(reader);
+    GLushort green = (GLushort)trace_read_uint(reader);
+    GLushort blue = (GLushort)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glColor3us(red, green, blue);
+}
+
+static void APIENTRY trace_glColor3usv(const GLushort *v) {
+    trace_command(TRACE_glColor3usv);
+    trace_write_array(v, (size_t)(3), sizeof(GLushort));
+    trace_real.glColor3usv(v);
+}
+
+static void trace_replay_glColor3usv(struct trace_reader *reader) {
+    if (!__glColor3usv) {
+        trace_missing(reader, TRACE_glColor3usv);
+        return;
+    }
+    const GLushort *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glColor3usv(v);
+}
+
+static void APIENTRY trace_glColor4b(GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha) {
+    trace_command(TRACE_glColor4b);
+    trace_write_int(red);
+    trace_write_int(green);
+    trace_write_int(blue);
+    trace_write_int(alpha);
+    trace_real.glColor4b(red, green, blue, alpha);
+}
+
+static void trace_replay_glColor4b(struct trace_reader *reader) {
+    if (!__glColor4b) {
+        trace_missing(reader, TRACE_glColor4b);
+        return;
+    }
+    GLbyte red = (GLbyte)trace_read_int(reader);
+    GLbyte green = (GLbyte)trace_read_int(reader);
+    GLbyte blue = (GLbyte)trace_read_int(reader);
+    GLbyte alpha = (GLbyte)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glColor4b(red, green, blue, alpha);
+}
+
+static void APIENTRY trace_glColor4bv(const GLbyte *v) {
+    trace_command(TRACE_glColor4bv);
+    trace_write_array(v, (size_t)(4), sizeof(GLbyte));
+    trace_real.glColor4bv(v);
+}
+
+static void trace_replay_glColor4bv(struct trace_reader *reader) {
+    if (!__glColor4bv) {
+        trace_missing(reader, TRACE_glColor4bv);
+        return;
+    }
+    const GLbyte *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glColor4bv(v);
+}
+
+static void APIENTRY trace_glColor4d(GLdouble red, GLdouble green, GLdouble blue, GLdouble alpha) {
+    trace_command(TRACE_glColor4d);
+    trace_write_double(red);
+    trace_write_double(green);
+    trace_write_double(blue);
+    trace_write_double(alpha);
+    trace_real.glColor4d(red, green, blue, alpha);
+}
+
+static void trace_replay_glColor4d(struct trace_reader *reader) {
+    if (!__glColor4d) {
+        trace_missing(reader, TRACE_glColor4d);
+        return;
+    }
+    GLdouble red = trace_read_double(reader);
+    GLdouble green = trace_read_double(reader);
+    GLdouble blue = trace_read_double(reader);
+    GLdouble alpha = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glColor4d(red, green, blue, alpha);
+}
+
+static void APIENTRY trace_glColor4dv(const GLdouble *v) {
+    trace_command(TRACE_glColor4dv);
+    trace_write_array(v, (size_t)(4), sizeof(GLdouble));
+    trace_real.glColor4dv(v);
+}
+
+static void trace_replay_glColor4dv(struct trace_reader *reader) {
+    if (!__glColor4dv) {
+        trace_missing(reader, TRACE_glColor4dv);
+        return;
+    }
+    const GLdouble *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glColor4dv(v);
+}
+
+static void APIENTRY trace_glColor4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    trace_command(TRACE_glColor4f);
+    trace_write_float(red);
+    trace_write_float(green);
+    trace_write_float(blue);
+    trace_write_float(alpha);
+    trace_real.glColor4f(red, green, blue, alpha);
+}
+
+static void trace_replay_glColor4f(struct trace_reader *reader) {
+    if (!__glColor4f) {
+        trace_missing(reader, TRACE_glColor4f);
+        return;
+    }
+    GLfloat red = trace_read_float(reader);
+    GLfloat green = trace_read_float(reader);
+    GLfloat blue = trace_read_float(reader);
+    GLfloat alpha = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glColor4f(red, green, blue, alpha);
+}
+
+static void APIENTRY trace_glColor4fv(const GLfloat *v) {
+    trace_command(TRACE_glColor4fv);
+    trace_write_array(v, (size_t)(4), sizeof(GLfloat));
+    trace_real.glColor4fv(v);
+}
+
+static void trace_replay_glColor4fv(struct trace_reader *reader) {
+    if (!__glColor4fv) {
+        trace_missing(reader, TRACE_glColor4fv);
+        return;
+    }
+    const GLfloat *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glColor4fv(v);
+}
+
+static void APIENTRY trace_glColor4i(GLint red, GLint green, GLint blue, GLint alpha) {
+    trace_command(TRACE_glColor4i);
+    trace_write_int(red);
+    trace_write_int(green);
+    trace_write_int(blue);
+    trace_write_int(alpha);
+    trace_real.glColor4i(red, green, blue, alpha);
+}
+
+static void trace_replay_glColor4i(struct trace_reader *reader) {
+    if (!__glColor4i) {
+        trace_missing(reader, TRACE_glColor4i);
+        return;
+    }
+    GLint red = (GLint)trace_read_int(reader);
+    GLint green = (GLint)trace_read_int(reader);
+    GLint blue = (GLint)trace_read_int(reader);
+    GLint alpha = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glColor4i(red, green, blue, alpha);
+}
+
+static void APIENTRY trace_glColor4iv(const GLint *v) {
+    trace_command(TRACE_glColor4iv);
+    trace_write_array(v, (size_t)(4), sizeof(GLint));
+    trace_real.glColor4iv(v);
+}
+
+static void trace_replay_glColor4iv(struct trace_reader *reader) {
+    if (!__glColor4iv) {
+        trace_missing(reader, TRACE_glColor4iv);
+        return;
+    }
+    const GLint *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glColor4iv(v);
+}
+
+static void APIENTRY trace_glColor4s(GLshort red, GLshort green, GLshort blue, GLshort alpha) {
+    trace_command(TRACE_glColor4s);
+    trace_write_int(red);
+    trace_write_int(green);
+    trace_write_int(blue);
+    trace_write_int(alpha);
+    trace_real.glColor4s(red, green, blue, alpha);
+}
+
+static void trace_replay_glColor4s(struct trace_reader *reader) {
+    if (!__glColor4s) {
+        trace_missing(reader, TRACE_glColor4s);
+        return;
+    }
+    GLshort red = (GLshort)trace_read_int(reader);
+    GLshort green = (GLshort)trace_read_int(reader);
+    GLshort blue = (GLshort)trace_read_int(reader);
+    GLshort alpha = (GLshort)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glColor4s(red, green, blue, alpha);
+}
+
+static void APIENTRY trace_glColor4sv(const GLshort *v) {
+    trace_command(TRACE_glColor4sv);
+    trace_write_array(v, (size_t)(4), sizeof(GLshort));
+    trace_real.glColor4sv(v);
+}
+
+static void trace_replay_glColor4sv(struct trace_reader *reader) {
+    if (!__glColor4sv) {
+        trace_missing(reader, TRACE_glColor4sv);
+        return;
+    }
+    const GLshort *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glColor4sv(v);
+}
+
+static void APIENTRY trace_glColor4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha) {
+    trace_command(TRACE_glColor4ub);
+    trace_write_uint(red);
+    trace_write_uint(green);
+    trace_write_uint(blue);
+    trace_write_uint(alpha);
+    trace_real.glColor4ub(red, green, blue, alpha);
+}
+
+static void trace_replay_glColor4ub(struct trace_reader *reader) {
+    if (!__glColor4ub) {
+        trace_missing(reader, TRACE_glColor4ub);
+        return;
+    }
+    GLubyte red = (GLubyte)trace_read_uint(reader);
+    GLubyte green = (GLubyte)trace_read_uint(reader);
+    GLubyte blue = (GLubyte)trace_read_uint(reader);
+    GLubyte alpha = (GLubyte)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glColor4ub(red, green, blue, alpha);
+}
+
+static void APIENTRY trace_glColor4ubv(const GLubyte *v) {
+    trace_command(TRACE_glColor4ubv);
+    trace_write_array(v, (size_t)(4), sizeof(GLubyte));
+    trace_real.glColor4ubv(v);
+}
+
+static void trace_replay_glColor4ubv(struct trace_reader *reader) {
+    if (!__glColor4ubv) {
+        trace_missing(reader, TRACE_glColor4ubv);
+        return;
+    }
+    const GLubyte *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glColor4ubv(v);
+}
+
+static void APIENTRY trace_glColor4ui(GLuint red, GLuint green, GLuint blue, GLuint alpha) {
+    trace_command(TRACE_glColor4ui);
+    trace_write_uint(red);
+    trace_write_uint(green);
+    trace_write_uint(blue);
+    trace_write_uint(alpha);
+    trace_real.glColor4ui(red, green, blue, alpha);
+}
+
+static void trace_replay_glColor4ui(struct trace_reader *reader) {
+    if (!__glColor4ui) {
+        trace_missing(reader, TRACE_glColor4ui);
+        return;
+    }
+    GLuint red = (GLuint)trace_read_uint(reader);
+    GLuint green = (GLuint)trace_read_uint(reader);
+    GLuint blue = (GLuint)trace_read_uint(reader);
+    GLuint alpha = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glColor4ui(red, green, blue, alpha);
+}
+
+static void APIENTRY trace_glColor4uiv(const GLuint *v) {
+    trace_command(TRACE_glColor4uiv);
+    trace_write_array(v, (size_t)(4), sizeof(GLuint));
+    trace_real.glColor4uiv(v);
+}
+
+static void trace_replay_glColor4uiv(struct trace_reader *reader) {
+    if (!__glColor4uiv) {
+        trace_missing(reader, TRACE_glColor4uiv);
+        return;
+    }
+    const GLuint *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glColor4uiv(v);
+}
+
+static void APIENTRY trace_glColor4us(GLushort red, GLushort green, GLushort blue, GLushort alpha) {
+    trace_command(TRACE_glColor4us);
+    trace_write_uint(red);
+    trace_write_uint(green);
+    trace_write_uint(blue);
+    trace_write_uint(alpha);
+    trace_real.glColor4us(red, green, blue, alpha);
+}
+
+static void trace_replay_glColor4us(struct trace_reader *reader) {
+    if (!__glColor4us) {
+        trace_missing(reader, TRACE_glColor4us);
+        return;
+    }
+    GLushort red = (GLushort)trace_read_uint(reader);
+    GLushort green = (GLushort)trace_read_uint(reader);
+    GLushort blue = (GLushort)trace_read_uint(reader);
+    GLushort alpha = (GLushort)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glColor4us(red, green, blue, alpha);
+}
+
+static void APIENTRY trace_glColor4usv(const GLushort *v) {
+    trace_command(TRACE_glColor4usv);
+    trace_write_array(v, (size_t)(4), sizeof(GLushort));
+    trace_real.glColor4usv(v);
+}
+
+static void trace_replay_glColor4usv(struct trace_reader *reader) {
+    if (!__glColor4usv) {
+        trace_missing(reader, TRACE_glColor4usv);
+        return;
+    }
+    const GLushort *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glColor4usv(v);
+}
+
+static void APIENTRY trace_glEdgeFlag(GLboolean flag) {
+    trace_command(TRACE_glEdgeFlag);
+    trace_write_uint(flag);
+    trace_real.glEdgeFlag(flag);
+}
+
+static void trace_replay_glEdgeFlag(struct trace_reader *reader) {
+    if (!__glEdgeFlag) {
+        trace_missing(reader, TRACE_glEdgeFlag);
+        return;
+    }
+    GLboolean flag = (GLboolean)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glEdgeFlag(flag);
+}
+
+static void APIENTRY trace_glEdgeFlagv(const GLboolean *flag) {
+    trace_command(TRACE_glEdgeFlagv);
+    trace_write_array(flag, (size_t)(1), sizeof(GLboolean));
+    trace_real.glEdgeFlagv(flag);
+}
+
+static void trace_replay_glEdgeFlagv(struct trace_reader *reader) {
+    if (!__glEdgeFlagv) {
+        trace_missing(reader, TRACE_glEdgeFlagv);
+        return;
+    }
+    const GLboolean *flag = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glEdgeFlagv(flag);
+}
+
+static void APIENTRY trace_glEnd(void) {
+    trace_command(TRACE_glEnd);
+    trace_real.glEnd();
+}
+
+static void trace_replay_glEnd(struct trace_reader *reader) {
+    if (!__glEnd) {
+        trace_missing(reader, TRACE_glEnd);
+        return;
+    }
+    if (reader->error)
+        return;
+    __glEnd();
+}
+
+static void APIENTRY trace_glIndexd(GLdouble c) {
+    trace_command(TRACE_glIndexd);
+    trace_write_double(c);
+    trace_real.glIndexd(c);
+}
+
+static void trace_replay_glIndexd(struct trace_reader *reader) {
+    if (!__glIndexd) {
+        trace_missing(reader, TRACE_glIndexd);
+        return;
+    }
+    GLdouble c = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glIndexd(c);
+}
+
+static void APIENTRY trace_glIndexdv(const GLdouble *c) {
+    trace_command(TRACE_glIndexdv);
+    trace_write_array(c, (size_t)(1), sizeof(GLdouble));
+    trace_real.glIndexdv(c);
+}
+
+static void trace_replay_glIndexdv(struct trace_reader *reader) {
+    if (!__glIndexdv) {
+        trace_missing(reader, TRACE_glIndexdv);
+        return;
+    }
+    const GLdouble *c = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glIndexdv(c);
+}
+
+static void APIENTRY trace_glIndexf(GLfloat c) {
+    trace_command(TRACE_glIndexf);
+    trace_write_float(c);
+    trace_real.glIndexf(c);
+}
+
+static void trace_replay_glIndexf(struct trace_reader *reader) {
+    if (!__glIndexf) {
+        trace_missing(reader, TRACE_glIndexf);
+        return;
+    }
+    GLfloat c = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glIndexf(c);
+}
+
+static void APIENTRY trace_glIndexfv(const GLfloat *c) {
+    trace_command(TRACE_glIndexfv);
+    trace_write_array(c, (size_t)(1), sizeof(GLfloat));
+    trace_real.glIndexfv(c);
+}
+
+static void trace_replay_glIndexfv(struct trace_reader *reader) {
+    if (!__glIndexfv) {
+        trace_missing(reader, TRACE_glIndexfv);
+        return;
+    }
+    const GLfloat *c = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glIndexfv(c);
+}
+
+static void APIENTRY trace_glIndexi(GLint c) {
+    trace_command(TRACE_glIndexi);
+    trace_write_int(c);
+    trace_real.glIndexi(c);
+}
+
+static void trace_replay_glIndexi(struct trace_reader *reader) {
+    if (!__glIndexi) {
+        trace_missing(reader, TRACE_glIndexi);
+        return;
+    }
+    GLint c = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glIndexi(c);
+}
+
+static void APIENTRY trace_glIndexiv(const GLint *c) {
+    trace_command(TRACE_glIndexiv);
+    trace_write_array(c, (size_t)(1), sizeof(GLint));
+    trace_real.glIndexiv(c);
+}
+
+static void trace_replay_glIndexiv(struct trace_reader *reader) {
+    if (!__glIndexiv) {
+        trace_missing(reader, TRACE_glIndexiv);
+        return;
+    }
+    const GLint *c = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glIndexiv(c);
+}
+
+static void APIENTRY trace_glIndexs(GLshort c) {
+    trace_command(TRACE_glIndexs);
+    trace_write_int(c);
+    trace_real.glIndexs(c);
+}
+
+static void trace_replay_glIndexs(struct trace_reader *reader) {
+    if (!__glIndexs) {
+        trace_missing(reader, TRACE_glIndexs);
+        return;
+    }
+    GLshort c = (GLshort)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glIndexs(c);
+}
+
+static void APIENTRY trace_glIndexsv(const GLshort *c) {
+    trace_command(TRACE_glIndexsv);
+    trace_write_array(c, (size_t)(1), sizeof(GLshort));
+    trace_real.glIndexsv(c);
+}
+
+static void trace_replay_glIndexsv(struct trace_reader *reader) {
+    if (!__glIndexsv) {
+        trace_missing(reader, TRACE_glIndexsv);
+        return;
+    }
+    const GLshort *c = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glIndexsv(c);
+}
+
+static void APIENTRY trace_glNormal3b(GLbyte nx, GLbyte ny, GLbyte nz) {
+    trace_command(TRACE_glNormal3b);
+    trace_write_int(nx);
+    trace_write_int(ny);
+    trace_write_int(nz);
+    trace_real.glNormal3b(nx, ny, nz);
+}
+
+static void trace_replay_glNormal3b(struct trace_reader *reader) {
+    if (!__glNormal3b) {
+        trace_missing(reader, TRACE_glNormal3b);
+        return;
+    }
+    GLbyte nx = (GLbyte)trace_read_int(reader);
+    GLbyte ny = (GLbyte)trace_read_int(reader);
+    GLbyte nz = (GLbyte)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glNormal3b(nx, ny, nz);
+}
+
+static void APIENTRY trace_glNormal3bv(const GLbyte *v) {
+    trace_command(TRACE_glNormal3bv);
+    trace_write_array(v, (size_t)(3), sizeof(GLbyte));
+    trace_real.glNormal3bv(v);
+}
+
+static void trace_replay_glNormal3bv(struct trace_reader *reader) {
+    if (!__glNormal3bv) {
+        trace_missing(reader, TRACE_glNormal3bv);
+        return;
+    }
+    const GLbyte *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glNormal3bv(v);
+}
+
+static void APIENTRY trace_glNormal3d(GLdouble nx, GLdouble ny, GLdouble nz) {
+    trace_command(TRACE_glNormal3d);
+    trace_write_double(nx);
+    trace_write_double(ny);
+    trace_write_double(nz);
+    trace_real.glNormal3d(nx, ny, nz);
+}
+
+static void trace_replay_glNormal3d(struct trace_reader *reader) {
+    if (!__glNormal3d) {
+        trace_missing(reader, TRACE_glNormal3d);
+        return;
+    }
+    GLdouble nx = trace_read_double(reader);
+    GLdouble ny = trace_read_double(reader);
+    GLdouble nz = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glNormal3d(nx, ny, nz);
+}
+
+static void APIENTRY trace_glNormal3dv(const GLdouble *v) {
+    trace_command(TRACE_glNormal3dv);
+    trace_write_array(v, (size_t)(3), sizeof(GLdouble));
+    trace_real.glNormal3dv(v);
+}
+
+static void trace_replay_glNormal3dv(struct trace_reader *reader) {
+    if (!__glNormal3dv) {
+        trace_missing(reader, TRACE_glNormal3dv);
+        return;
+    }
+    const GLdouble *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glNormal3dv(v);
+}
+
+static void APIENTRY trace_glNormal3f(GLfloat nx, GLfloat ny, GLfloat nz) {
+    trace_command(TRACE_glNormal3f);
+    trace_write_float(nx);
+    trace_write_float(ny);
+    trace_write_float(nz);
+    trace_real.glNormal3f(nx, ny, nz);
+}
+
+static void trace_replay_glNormal3f(struct trace_reader *reader) {
+    if (!__glNormal3f) {
+        trace_missing(reader, TRACE_glNormal3f);
+        return;
+    }
+    GLfloat nx = trace_read_float(reader);
+    GLfloat ny = trace_read_float(reader);
+    GLfloat nz = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glNormal3f(nx, ny, nz);
+}
+
+static void APIENTRY trace_glNormal3fv(const GLfloat *v) {
+    trace_command(TRACE_glNormal3fv);
+    trace_write_array(v, (size_t)(3), sizeof(GLfloat));
+    trace_real.glNormal3fv(v);
+}
+
+static void trace_replay_glNormal3fv(struct trace_reader *reader) {
+    if (!__glNormal3fv) {
+        trace_missing(reader, TRACE_glNormal3fv);
+        return;
+    }
+    const GLfloat *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glNormal3fv(v);
+}
+
+static void APIENTRY trace_glNormal3i(GLint nx, GLint ny, GLint nz) {
+    trace_command(TRACE_glNormal3i);
+    trace_write_int(nx);
+    trace_write_int(ny);
+    trace_write_int(nz);
+    trace_real.glNormal3i(nx, ny, nz);
+}
+
+static void trace_replay_glNormal3i(struct trace_reader *reader) {
+    if (!__glNormal3i) {
+        trace_missing(reader, TRACE_glNormal3i);
+        return;
+    }
+    GLint nx = (GLint)trace_read_int(reader);
+    GLint ny = (GLint)trace_read_int(reader);
+    GLint nz = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glNormal3i(nx, ny, nz);
+}
+
+static void APIENTRY trace_glNormal3iv(const GLint *v) {
+    trace_command(TRACE_glNormal3iv);
+    trace_write_array(v, (size_t)(3), sizeof(GLint));
+    trace_real.glNormal3iv(v);
+}
+
+static void trace_replay_glNormal3iv(struct trace_reader *reader) {
+    if (!__glNormal3iv) {
+        trace_missing(reader, TRACE_glNormal3iv);
+        return;
+    }
+    const GLint *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glNormal3iv(v);
+}
+
+static void APIENTRY trace_glNormal3s(GLshort nx, GLshort ny, GLshort nz) {
+    trace_command(TRACE_glNormal3s);
+    trace_write_int(nx);
+    trace_write_int(ny);
+    trace_write_int(nz);
+    trace_real.glNormal3s(nx, ny, nz);
+}
+
+static void trace_replay_glNormal3s(struct trace_reader *reader) {
+    if (!__glNormal3s) {
+        trace_missing(reader, TRACE_glNormal3s);
+        return;
+    }
+    GLshort nx = (GLshort)trace_read_int(reader);
+    GLshort ny = (GLshort)trace_read_int(reader);
+    GLshort nz = (GLshort)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glNormal3s(nx, ny, nz);
+}
+
+static void APIENTRY trace_glNormal3sv(const GLshort *v) {
+    trace_command(TRACE_glNormal3sv);
+    trace_write_array(v, (size_t)(3), sizeof(GLshort));
+    trace_real.glNormal3sv(v);
+}
+
+static void trace_replay_glNormal3sv(struct trace_reader *reader) {
+    if (!__glNormal3sv) {
+        trace_missing(reader, TRACE_glNormal3sv);
+        return;
+    }
+    const GLshort *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glNormal3sv(v);
+}
+
+static void APIENTRY trace_glRasterPos2d(GLdouble x, GLdouble y) {
+    trace_command(TRACE_glRasterPos2d);
+    trace_write_double(x);
+    trace_write_double(y);
+    trace_real.glRasterPos2d(x, y);
+}
+
+static void trace_replay_glRasterPos2d(struct trace_reader *reader) {
+    if (!__glRasterPos2d) {
+        trace_missing(reader, TRACE_glRasterPos2d);
+        return;
+    }
+    GLdouble x = trace_read_double(reader);
+    GLdouble y = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glRasterPos2d(x, y);
+}
+
+static void APIENTRY trace_glRasterPos2dv(const GLdouble *v) {
+    trace_command(TRACE_glRasterPos2dv);
+    trace_write_array(v, (size_t)(2), sizeof(GLdouble));
+    trace_real.glRasterPos2dv(v);
+}
+
+static void trace_replay_glRasterPos2dv(struct trace_reader *reader) {
+    if (!__glRasterPos2dv) {
+        trace_missing(reader, TRACE_glRasterPos2dv);
+        return;
+    }
+    const GLdouble *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glRasterPos2dv(v);
+}
+
+static void APIENTRY trace_glRasterPos2f(GLfloat x, GLfloat y) {
+    trace_command(TRACE_glRasterPos2f);
+    trace_write_float(x);
+    trace_write_float(y);
+    trace_real.glRasterPos2f(x, y);
+}
+
+static void trace_replay_glRasterPos2f(struct trace_reader *reader) {
+    if (!__glRasterPos2f) {
+        trace_missing(reader, TRACE_glRasterPos2f);
+        return;
+    }
+    GLfloat x = trace_read_float(reader);
+    GLfloat y = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glRasterPos2f(x, y);
+}
+
+static void APIENTRY trace_glRasterPos2fv(const GLfloat *v) {
+    trace_command(TRACE_glRasterPos2fv);
+    trace_write_array(v, (size_t)(2), sizeof(GLfloat));
+    trace_real.glRasterPos2fv(v);
+}
+
+static void trace_replay_glRasterPos2fv(struct trace_reader *reader) {
+    if (!__glRasterPos2fv) {
+        trace_missing(reader, TRACE_glRasterPos2fv);
+        return;
+    }
+    const GLfloat *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glRasterPos2fv(v);
+}
+
+static void APIENTRY trace_glRasterPos2i(GLint x, GLint y) {
+    trace_command(TRACE_glRasterPos2i);
+    trace_write_int(x);
+    trace_write_int(y);
+    trace_real.glRasterPos2i(x, y);
+}
+
+static void trace_replay_glRasterPos2i(struct trace_reader *reader) {
+    if (!__glRasterPos2i) {
+        trace_missing(reader, TRACE_glRasterPos2i);
+        return;
+    }
+    GLint x = (GLint)trace_read_int(reader);
+    GLint y = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glRasterPos2i(x, y);
+}
+
+static void APIENTRY trace_glRasterPos2iv(const GLint *v) {
+    trace_command(TRACE_glRasterPos2iv);
+    trace_write_array(v, (size_t)(2), sizeof(GLint));
+    trace_real.glRasterPos2iv(v);
+}
+
+static void trace_replay_glRasterPos2iv(struct trace_reader *reader) {
+    if (!__glRasterPos2iv) {
+        trace_missing(reader, TRACE_glRasterPos2iv);
+        return;
+    }
+    const GLint *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glRasterPos2iv(v);
+}
+
+static void APIENTRY trace_glRasterPos2s(GLshort x, GLshort y) {
+    trace_command(TRACE_glRasterPos2s);
+    trace_write_int(x);
+    trace_write_int(y);
+    trace_real.glRasterPos2s(x, y);
+}
+
+static void trace_replay_glRasterPos2s(struct trace_reader *reader) {
+    if (!__glRasterPos2s) {
+        trace_missing(reader, TRACE_glRasterPos2s);
+        return;
+    }
+    GLshort x = (GLshort)trace_read_int(reader);
+    GLshort y = (GLshort)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glRasterPos2s(x, y);
+}
+
+static void APIENTRY trace_glRasterPos2sv(const GLshort *v) {
+    trace_command(TRACE_glRasterPos2sv);
+    trace_write_array(v, (size_t)(2), sizeof(GLshort));
+    trace_real.glRasterPos2sv(v);
+}
+
+static void trace_replay_glRasterPos2sv(struct trace_reader *reader) {
+    if (!__glRasterPos2sv) {
+        trace_missing(reader, TRACE_glRasterPos2sv);
+        return;
+    }
+    const GLshort *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glRasterPos2sv(v);
+}
+
+static void APIENTRY trace_glRasterPos3d(GLdouble x, GLdouble y, GLdouble z) {
+    trace_command(TRACE_glRasterPos3d);
+    trace_write_double(x);
+    trace_write_double(y);
+    trace_write_double(z);
+    trace_real.glRasterPos3d(x, y, z);
+}
+
+static void trace_replay_glRasterPos3d(struct trace_reader *reader) {
+    if (!__glRasterPos3d) {
+        trace_missing(reader, TRACE_glRasterPos3d);
+        return;
+    }
+    GLdouble x = trace_read_double(reader);
+    GLdouble y = trace_read_double(reader);
+    GLdouble z = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glRasterPos3d(x, y, z);
+}
+
+static void APIENTRY trace_glRasterPos3dv(const GLdouble *v) {
+    trace_command(TRACE_glRasterPos3dv);
+    trace_write_array(v, (size_t)(3), sizeof(GLdouble));
+    trace_real.glRasterPos3dv(v);
+}
+
+static void trace_replay_glRasterPos3dv(struct trace_reader *reader) {
+    if (!__glRasterPos3dv) {
+        trace_missing(reader, TRACE_glRasterPos3dv);
+        return;
+    }
+    const GLdouble *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glRasterPos3dv(v);
+}
+
+static void APIENTRY trace_glRasterPos3f(GLfloat x, GLfloat y, GLfloat z) {
+    trace_command(TRACE_glRasterPos3f);
+    trace_write_float(x);
+    trace_write_float(y);
+    trace_write_float(z);
+    trace_real.glRasterPos3f(x, y, z);
+}
+
+static void trace_replay_glRasterPos3f(struct trace_reader *reader) {
+    if (!__glRasterPos3f) {
+        trace_missing(reader, TRACE_glRasterPos3f);
+        return;
+    }
+    GLfloat x = trace_read_float(reader);
+    GLfloat y = trace_read_float(reader);
+    GLfloat z = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glRasterPos3f(x, y, z);
+}
+
+static void APIENTRY trace_glRasterPos3fv(const GLfloat *v) {
+    trace_command(TRACE_glRasterPos3fv);
+    trace_write_array(v, (size_t)(3), sizeof(GLfloat));
+    trace_real.glRasterPos3fv(v);
+}
+
+static void trace_replay_glRasterPos3fv(struct trace_reader *reader) {
+    if (!__glRasterPos3fv) {
+        trace_missing(reader, TRACE_glRasterPos3fv);
+        return;
+    }
+    const GLfloat *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glRasterPos3fv(v);
+}
+
+static void APIENTRY trace_glRasterPos3i(GLint x, GLint y, GLint z) {
+    trace_command(TRACE_glRasterPos3i);
+    trace_write_int(x);
+    trace_write_int(y);
+    trace_write_int(z);
+    trace_real.glRasterPos3i(x, y, z);
+}
+
+static void trace_replay_glRasterPos3i(struct trace_reader *reader) {
+    if (!__glRasterPos3i) {
+        trace_missing(reader, TRACE_glRasterPos3i);
+        return;
+    }
+    GLint x = (GLint)trace_read_int(reader);
+    GLint y = (GLint)trace_read_int(reader);
+    GLint z = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glRasterPos3i(x, y, z);
+}
+
+static void APIENTRY trace_glRasterPos3iv(const GLint *v) {
+    trace_command(TRACE_glRasterPos3iv);
+    trace_write_array(v, (size_t)(3), sizeof(GLint));
+    trace_real.glRasterPos3iv(v);
+}
+
+static void trace_replay_glRasterPos3iv(struct trace_reader *reader) {
+    if (!__glRasterPos3iv) {
+        trace_missing(reader, TRACE_glRasterPos3iv);
+        return;
+    }
+    const GLint *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glRasterPos3iv(v);
+}
+
+static void APIENTRY trace_glRasterPos3s(GLshort x, GLshort y, GLshort z) {
+    trace_command(TRACE_glRasterPos3s);
+    trace_write_int(x);
+    trace_write_int(y);
+    trace_write_int(z);
+    trace_real.glRasterPos3s(x, y, z);
+}
+
+static void trace_replay_glRasterPos3s(struct trace_reader *reader) {
+    if (!__glRasterPos3s) {
+        trace_missing(reader, TRACE_glRasterPos3s);
+        return;
+    }
+    GLshort x = (GLshort)trace_read_int(reader);
+    GLshort y = (GLshort)trace_read_int(reader);
+    GLshort z = (GLshort)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glRasterPos3s(x, y, z);
+}
+
+static void APIENTRY trace_glRasterPos3sv(const GLshort *v) {
+    trace_command(TRACE_glRasterPos3sv);
+    trace_write_array(v, (size_t)(3), sizeof(GLshort));
+    trace_real.glRasterPos3sv(v);
+}
+
+static void trace_replay_glRasterPos3sv(struct trace_reader *reader) {
+    if (!__glRasterPos3sv) {
+        trace_missing(reader, TRACE_glRasterPos3sv);
+        return;
+    }
+    const GLshort *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glRasterPos3sv(v);
+}
+
+static void APIENTRY trace_glRasterPos4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    trace_command(TRACE_glRasterPos4d);
+    trace_write_double(x);
+    trace_write_double(y);
+    trace_write_double(z);
+    trace_write_double(w);
+    trace_real.glRasterPos4d(x, y, z, w);
+}
+
+static void trace_replay_glRasterPos4d(struct trace_reader *reader) {
+    if (!__glRasterPos4d) {
+        trace_missing(reader, TRACE_glRasterPos4d);
+        return;
+    }
+    GLdouble x = trace_read_double(reader);
+    GLdouble y = trace_read_double(reader);
+    GLdouble z = trace_read_double(reader);
+    GLdouble w = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glRasterPos4d(x, y, z, w);
+}
+
+static void APIENTRY trace_glRasterPos4dv(const GLdouble *v) {
+    trace_command(TRACE_glRasterPos4dv);
+    trace_write_array(v, (size_t)(4), sizeof(GLdouble));
+    trace_real.glRasterPos4dv(v);
+}
+
+static void trace_replay_glRasterPos4dv(struct trace_reader *reader) {
+    if (!__glRasterPos4dv) {
+        trace_missing(reader, TRACE_glRasterPos4dv);
+        return;
+    }
+    const GLdouble *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glRasterPos4dv(v);
+}
+
+static void APIENTRY trace_glRasterPos4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+    trace_command(TRACE_glRasterPos4f);
+    trace_write_float(x);
+    trace_write_float(y);
+    trace_write_float(z);
+    trace_write_float(w);
+    trace_real.glRasterPos4f(x, y, z, w);
+}
+
+static void trace_replay_glRasterPos4f(struct trace_reader *reader) {
+    if (!__glRasterPos4f) {
+        trace_missing(reader, TRACE_glRasterPos4f);
+        return;
+    }
+    GLfloat x = trace_read_float(reader);
+    GLfloat y = trace_read_float(reader);
+    GLfloat z = trace_read_float(reader);
+    GLfloat w = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glRasterPos4f(x, y, z, w);
+}
+
+static void APIENTRY trace_glRasterPos4fv(const GLfloat *v) {
+    trace_command(TRACE_glRasterPos4fv);
+    trace_write_array(v, (size_t)(4), sizeof(GLfloat));
+    trace_real.glRasterPos4fv(v);
+}
+
+static void trace_replay_glRasterPos4fv(struct trace_reader *reader) {
+    if (!__glRasterPos4fv) {
+        trace_missing(reader, TRACE_glRasterPos4fv);
+        return;
+    }
+    const GLfloat *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glRasterPos4fv(v);
+}
+
+static void APIENTRY trace_glRasterPos4i(GLint x, GLint y, GLint z, GLint w) {
+    trace_command(TRACE_glRasterPos4i);
+    trace_write_int(x);
+    trace_write_int(y);
+    trace_write_int(z);
+    trace_write_int(w);
+    trace_real.glRasterPos4i(x, y, z, w);
+}
+
+static void trace_replay_glRasterPos4i(struct trace_reader *reader) {
+    if (!__glRasterPos4i) {
+        trace_missing(reader, TRACE_glRasterPos4i);
+        return;
+    }
+    GLint x = (GLint)trace_read_int(reader);
+    GLint y = (GLint)trace_read_int(reader);
+    GLint z = (GLint)trace_read_int(reader);
+    GLint w = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glRasterPos4i(x, y, z, w);
+}
+
+static void APIENTRY trace_glRasterPos4iv(const GLint *v) {
+    trace_command(TRACE_glRasterPos4iv);
+    trace_write_array(v, (size_t)(4), sizeof(GLint));
+    trace_real.glRasterPos4iv(v);
+}
+
+static void trace_replay_glRasterPos4iv(struct trace_reader *reader) {
+    if (!__glRasterPos4iv) {
+        trace_missing(reader, TRACE_glRasterPos4iv);
+        return;
+    }
+    const GLint *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glRasterPos4iv(v);
+}
+
+static void APIENTRY trace_glRasterPos4s(GLshort x, GLshort y, GLshort z, GLshort w) {
+    trace_command(TRACE_glRasterPos4s);
+    trace_write_int(x);
+    trace_write_int(y);
+    trace_write_int(z);
+    trace_write_int(w);
+    trace_real.glRasterPos4s(x, y, z, w);
+}
+
+static void trace_replay_glRasterPos4s(struct trace_reader *reader) {
+    if (!__glRasterPos4s) {
+        trace_missing(reader, TRACE_glRasterPos4s);
+        return;
+    }
+    GLshort x = (GLshort)trace_read_int(reader);
+    GLshort y = (GLshort)trace_read_int(reader);
+    GLshort z = (GLshort)trace_read_int(reader);
+    GLshort w = (GLshort)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glRasterPos4s(x, y, z, w);
+}
+
+static void APIENTRY trace_glRasterPos4sv(const GLshort *v) {
+    trace_command(TRACE_glRasterPos4sv);
+    trace_write_array(v, (size_t)(4), sizeof(GLshort));
+    trace_real.glRasterPos4sv(v);
+}
+
+static void trace_replay_glRasterPos4sv(struct trace_reader *reader) {
+    if (!__glRasterPos4sv) {
+        trace_missing(reader, TRACE_glRasterPos4sv);
+        return;
+    }
+    const GLshort *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glRasterPos4sv(v);
+}
+
+static void APIENTRY trace_glRectd(GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2) {
+    trace_command(TRACE_glRectd);
+    trace_write_double(x1);
+    trace_write_double(y1);
+    trace_write_double(x2);
+    trace_write_double(y2);
+    trace_real.glRectd(x1, y1, x2, y2);
+}
+
+static void trace_replay_glRectd(struct trace_reader *reader) {
+    if (!__glRectd) {
+        trace_missing(reader, TRACE_glRectd);
+        return;
+    }
+    GLdouble x1 = trace_read_double(reader);
+    GLdouble y1 = trace_read_double(reader);
+    GLdouble x2 = trace_read_double(reader);
+    GLdouble y2 = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glRectd(x1, y1, x2, y2);
+}
+
+static void APIENTRY trace_glRectdv(const GLdouble *v1, const GLdouble *v2) {
+    trace_command(TRACE_glRectdv);
+    trace_write_array(v1, (size_t)(2), sizeof(GLdouble));
+    trace_write_array(v2, (size_t)(2), sizeof(GLdouble));
+    trace_real.glRectdv(v1, v2);
+}
+
+static void trace_replay_glRectdv(struct trace_reader *reader) {
+    if (!__glRectdv) {
+        trace_missing(reader, TRACE_glRectdv);
+        return;
+    }
+    const GLdouble *v1 = trace_read_array(reader);
+    const GLdouble *v2 = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glRectdv(v1, v2);
+}
+
+static void APIENTRY trace_glRectf(GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2) {
+    trace_command(TRACE_glRectf);
+    trace_write_float(x1);
+    trace_write_float(y1);
+    trace_write_float(x2);
+    trace_write_float(y2);
+    trace_real.glRectf(x1, y1, x2, y2);
+}
+
+static void trace_replay_glRectf(struct trace_reader *reader) {
+    if (!__glRectf) {
+        trace_missing(reader, TRACE_glRectf);
+        return;
+    }
+    GLfloat x1 = trace_read_float(reader);
+    GLfloat y1 = trace_read_float(reader);
+    GLfloat x2 = trace_read_float(reader);
+    GLfloat y2 = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glRectf(x1, y1, x2, y2);
+}
+
+static void APIENTRY trace_glRectfv(const GLfloat *v1, const GLfloat *v2) {
+    trace_command(TRACE_glRectfv);
+    trace_write_array(v1, (size_t)(2), sizeof(GLfloat));
+    trace_write_array(v2, (size_t)(2), sizeof(GLfloat));
+    trace_real.glRectfv(v1, v2);
+}
+
+static void trace_replay_glRectfv(struct trace_reader *reader) {
+    if (!__glRectfv) {
+        trace_missing(reader, TRACE_glRectfv);
+        return;
+    }
+    const GLfloat *v1 = trace_read_array(reader);
+    const GLfloat *v2 = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glRectfv(v1, v2);
+}
+
+static void APIENTRY trace_glRecti(GLint x1, GLint y1, GLint x2, GLint y2) {
+    trace_command(TRACE_glRecti);
+    trace_write_int(x1);
+    trace_write_int(y1);
+    trace_write_int(x2);
+    trace_write_int(y2);
+    trace_real.glRecti(x1, y1, x2, y2);
+}
+
+static void trace_replay_glRecti(struct trace_reader *reader) {
+    if (!__glRecti) {
+        trace_missing(reader, TRACE_glRecti);
+        return;
+    }
+    GLint x1 = (GLint)trace_read_int(reader);
+    GLint y1 = (GLint)trace_read_int(reader);
+    GLint x2 = (GLint)trace_read_int(reader);
+    GLint y2 = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glRecti(x1, y1, x2, y2);
+}
+
+static void APIENTRY trace_glRectiv(const GLint *v1, const GLint *v2) {
+    trace_command(TRACE_glRectiv);
+    trace_write_array(v1, (size_t)(2), sizeof(GLint));
+    trace_write_array(v2, (size_t)(2), sizeof(GLint));
+    trace_real.glRectiv(v1, v2);
+}
+
+static void trace_replay_glRectiv(struct trace_reader *reader) {
+    if (!__glRectiv) {
+        trace_missing(reader, TRACE_glRectiv);
+        return;
+    }
+    const GLint *v1 = trace_read_array(reader);
+    const GLint *v2 = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glRectiv(v1, v2);
+}
+
+static void APIENTRY trace_glRects(GLshort x1, GLshort y1, GLshort x2, GLshort y2) {
+    trace_command(TRACE_glRects);
+    trace_write_int(x1);
+    trace_write_int(y1);
+    trace_write_int(x2);
+    trace_write_int(y2);
+    trace_real.glRects(x1, y1, x2, y2);
+}
+
+static void trace_replay_glRects(struct trace_reader *reader) {
+    if (!__glRects) {
+        trace_missing(reader, TRACE_glRects);
+        return;
+    }
+    GLshort x1 = (GLshort)trace_read_int(reader);
+    GLshort y1 = (GLshort)trace_read_int(reader);
+    GLshort x2 = (GLshort)trace_read_int(reader);
+    GLshort y2 = (GLshort)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glRects(x1, y1, x2, y2);
+}
+
+static void APIENTRY trace_glRectsv(const GLshort *v1, const GLshort *v2) {
+    trace_command(TRACE_glRectsv);
+    trace_write_array(v1, (size_t)(2), sizeof(GLshort));
+    trace_write_array(v2, (size_t)(2), sizeof(GLshort));
+    trace_real.glRectsv(v1, v2);
+}
+
+static void trace_replay_glRectsv(struct trace_reader *reader) {
+    if (!__glRectsv) {
+        trace_missing(reader, TRACE_glRectsv);
+        return;
+    }
+    const GLshort *v1 = trace_read_array(reader);
+    const GLshort *v2 = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glRectsv(v1, v2);
+}
+
+static void APIENTRY trace_glTexCoord1d(GLdouble s) {
+    trace_command(TRACE_glTexCoord1d);
+    trace_write_double(s);
+    trace_real.glTexCoord1d(s);
+}
+
+static void trace_replay_glTexCoord1d(struct trace_reader *reader) {
+    if (!__glTexCoord1d) {
+        trace_missing(reader, TRACE_glTexCoord1d);
+        return;
+    }
+    GLdouble s = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glTexCoord1d(s);
+}
+
+static void APIENTRY trace_glTexCoord1dv(const GLdouble *v) {
+    trace_command(TRACE_glTexCoord1dv);
+    trace_write_array(v, (size_t)(1), sizeof(GLdouble));
+    trace_real.glTexCoord1dv(v);
+}
+
+static void trace_replay_glTexCoord1dv(struct trace_reader *reader) {
+    if (!__glTexCoord1dv) {
+        trace_missing(reader, TRACE_glTexCoord1dv);
+        return;
+    }
+    const GLdouble *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glTexCoord1dv(v);
+}
+
+static void APIENTRY trace_glTexCoord1f(GLfloat s) {
+    trace_command(TRACE_glTexCoord1f);
+    trace_write_float(s);
+    trace_real.glTexCoord1f(s);
+}
+
+static void trace_replay_glTexCoord1f(struct trace_reader *reader) {
+    if (!__glTexCoord1f) {
+        trace_missing(reader, TRACE_glTexCoord1f);
+        return;
+    }
+    GLfloat s = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glTexCoord1f(s);
+}
+
+static void APIENTRY trace_glTexCoord1fv(const GLfloat *v) {
+    trace_command(TRACE_glTexCoord1fv);
+    trace_write_array(v, (size_t)(1), sizeof(GLfloat));
+    trace_real.glTexCoord1fv(v);
+}
+
+static void trace_replay_glTexCoord1fv(struct trace_reader *reader) {
+    if (!__glTexCoord1fv) {
+        trace_missing(reader, TRACE_glTexCoord1fv);
+        return;
+    }
+    const GLfloat *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glTexCoord1fv(v);
+}
+
+static void APIENTRY trace_glTexCoord1i(GLint s) {
+    trace_command(TRACE_glTexCoord1i);
+    trace_write_int(s);
+    trace_real.glTexCoord1i(s);
+}
+
+static void trace_replay_glTexCoord1i(struct trace_reader *reader) {
+    if (!__glTexCoord1i) {
+        trace_missing(reader, TRACE_glTexCoord1i);
+        return;
+    }
+    GLint s = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glTexCoord1i(s);
+}
+
+static void APIENTRY trace_glTexCoord1iv(const GLint *v) {
+    trace_command(TRACE_glTexCoord1iv);
+    trace_write_array(v, (size_t)(1), sizeof(GLint));
+    trace_real.glTexCoord1iv(v);
+}
+
+static void trace_replay_glTexCoord1iv(struct trace_reader *reader) {
+    if (!__glTexCoord1iv) {
+        trace_missing(reader, TRACE_glTexCoord1iv);
+        return;
+    }
+    const GLint *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glTexCoord1iv(v);
+}
+
+static void APIENTRY trace_glTexCoord1s(GLshort s) {
+    trace_command(TRACE_glTexCoord1s);
+    trace_write_int(s);
+    trace_real.glTexCoord1s(s);
+}
+
+static void trace_replay_glTexCoord1s(struct trace_reader *reader) {
+    if (!__glTexCoord1s) {
+        trace_missing(reader, TRACE_glTexCoord1s);
+        return;
+    }
+    GLshort s = (GLshort)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glTexCoord1s(s);
+}
+
+static void APIENTRY trace_glTexCoord1sv(const GLshort *v) {
+    trace_command(TRACE_glTexCoord1sv);
+    trace_write_array(v, (size_t)(1), sizeof(GLshort));
+    trace_real.glTexCoord1sv(v);
+}
+
+static void trace_replay_glTexCoord1sv(struct trace_reader *reader) {
+    if (!__glTexCoord1sv) {
+        trace_missing(reader, TRACE_glTexCoord1sv);
+        return;
+    }
+    const GLshort *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glTexCoord1sv(v);
+}
+
+static void APIENTRY trace_glTexCoord2d(GLdouble s, GLdouble t) {
+    trace_command(TRACE_glTexCoord2d);
+    trace_write_double(s);
+    trace_write_double(t);
+    trace_real.glTexCoord2d(s, t);
+}
+
+static void trace_replay_glTexCoord2d(struct trace_reader *reader) {
+    if (!__glTexCoord2d) {
+        trace_missing(reader, TRACE_glTexCoord2d);
+        return;
+    }
+    GLdouble s = trace_read_double(reader);
+    GLdouble t = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glTexCoord2d(s, t);
+}
+
+static void APIENTRY trace_glTexCoord2dv(const GLdouble *v) {
+    trace_command(TRACE_glTexCoord2dv);
+    trace_write_array(v, (size_t)(2), sizeof(GLdouble));
+    trace_real.glTexCoord2dv(v);
+}
+
+static void trace_replay_glTexCoord2dv(struct trace_reader *reader) {
+    if (!__glTexCoord2dv) {
+        trace_missing(reader, TRACE_glTexCoord2dv);
+        return;
+    }
+    const GLdouble *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glTexCoord2dv(v);
+}
+
+static void APIENTRY trace_glTexCoord2f(GLfloat s, GLfloat t) {
+    trace_command(TRACE_glTexCoord2f);
+    trace_write_float(s);
+    trace_write_float(t);
+    trace_real.glTexCoord2f(s, t);
+}
+
+static void trace_replay_glTexCoord2f(struct trace_reader *reader) {
+    if (!__glTexCoord2f) {
+        trace_missing(reader, TRACE_glTexCoord2f);
+        return;
+    }
+    GLfloat s = trace_read_float(reader);
+    GLfloat t = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glTexCoord2f(s, t);
+}
+
+static void APIENTRY trace_glTexCoord2fv(const GLfloat *v) {
+    trace_command(TRACE_glTexCoord2fv);
+    trace_write_array(v, (size_t)(2), sizeof(GLfloat));
+    trace_real.glTexCoord2fv(v);
+}
+
+static void trace_replay_glTexCoord2fv(struct trace_reader *reader) {
+    if (!__glTexCoord2fv) {
+        trace_missing(reader, TRACE_glTexCoord2fv);
+        return;
+    }
+    const GLfloat *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glTexCoord2fv(v);
+}
+
+static void APIENTRY trace_glTexCoord2i(GLint s, GLint t) {
+    trace_command(TRACE_glTexCoord2i);
+    trace_write_int(s);
+    trace_write_int(t);
+    trace_real.glTexCoord2i(s, t);
+}
+
+static void trace_replay_glTexCoord2i(struct trace_reader *reader) {
+    if (!__glTexCoord2i) {
+        trace_missing(reader, TRACE_glTexCoord2i);
+        return;
+    }
+    GLint s = (GLint)trace_read_int(reader);
+    GLint t = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glTexCoord2i(s, t);
+}
+
+static void APIENTRY trace_glTexCoord2iv(const GLint *v) {
+    trace_command(TRACE_glTexCoord2iv);
+    trace_write_array(v, (size_t)(2), sizeof(GLint));
+    trace_real.glTexCoord2iv(v);
+}
+
+static void trace_replay_glTexCoord2iv(struct trace_reader *reader) {
+    if (!__glTexCoord2iv) {
+        trace_missing(reader, TRACE_glTexCoord2iv);
+        return;
+    }
+    const GLint *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glTexCoord2iv(v);
+}
+
+static void APIENTRY trace_glTexCoord2s(GLshort s, GLshort t) {
+    trace_command(TRACE_glTexCoord2s);
+    trace_write_int(s);
+    trace_write_int(t);
+    trace_real.glTexCoord2s(s, t);
+}
+
+static void trace_replay_glTexCoord2s(struct trace_reader *reader) {
+    if (!__glTexCoord2s) {
+        trace_missing(reader, TRACE_glTexCoord2s);
+        return;
+    }
+    GLshort s = (GLshort)trace_read_int(reader);
+    GLshort t = (GLshort)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glTexCoord2s(s, t);
+}
+
+static void APIENTRY trace_glTexCoord2sv(const GLshort *v) {
+    trace_command(TRACE_glTexCoord2sv);
+    trace_write_array(v, (size_t)(2), sizeof(GLshort));
+    trace_real.glTexCoord2sv(v);
+}
+
+static void trace_replay_glTexCoord2sv(struct trace_reader *reader) {
+    if (!__glTexCoord2sv) {
+        trace_missing(reader, TRACE_glTexCoord2sv);
+        return;
+    }
+    const GLshort *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glTexCoord2sv(v);
+}
+
+static void APIENTRY trace_glTexCoord3d(GLdouble s, GLdouble t, GLdouble r) {
+    trace_command(TRACE_glTexCoord3d);
+    trace_write_double(s);
+    trace_write_double(t);
+    trace_write_double(r);
+    trace_real.glTexCoord3d(s, t, r);
+}
+
+static void trace_replay_glTexCoord3d(struct trace_reader *reader) {
+    if (!__glTexCoord3d) {
+        trace_missing(reader, TRACE_glTexCoord3d);
+        return;
+    }
+    GLdouble s = trace_read_double(reader);
+    GLdouble t = trace_read_double(reader);
+    GLdouble r = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glTexCoord3d(s, t, r);
+}
+
+static void APIENTRY trace_glTexCoord3dv(const GLdouble *v) {
+    trace_command(TRACE_glTexCoord3dv);
+    trace_write_array(v, (size_t)(3), sizeof(GLdouble));
+    trace_real.glTexCoord3dv(v);
+}
+
+static void trace_replay_glTexCoord3dv(struct trace_reader *reader) {
+    if (!__glTexCoord3dv) {
+        trace_missing(reader, TRACE_glTexCoord3dv);
+        return;
+    }
+    const GLdouble *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glTexCoord3dv(v);
+}
+
+static void APIENTRY trace_glTexCoord3f(GLfloat s, GLfloat t, GLfloat r) {
+    trace_command(TRACE_glTexCoord3f);
+    trace_write_float(s);
+    trace_write_float(t);
+    trace_write_float(r);
+    trace_real.glTexCoord3f(s, t, r);
+}
+
+static void trace_replay_glTexCoord3f(struct trace_reader *reader) {
+    if (!__glTexCoord3f) {
+        trace_missing(reader, TRACE_glTexCoord3f);
+        return;
+    }
+    GLfloat s = trace_read_float(reader);
+    GLfloat t = trace_read_float(reader);
+    GLfloat r = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glTexCoord3f(s, t, r);
+}
+
+static void APIENTRY trace_glTexCoord3fv(const GLfloat *v) {
+    trace_command(TRACE_glTexCoord3fv);
+    trace_write_array(v, (size_t)(3), sizeof(GLfloat));
+    trace_real.glTexCoord3fv(v);
+}
+
+static void trace_replay_glTexCoord3fv(struct trace_reader *reader) {
+    if (!__glTexCoord3fv) {
+        trace_missing(reader, TRACE_glTexCoord3fv);
+        return;
+    }
+    const GLfloat *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glTexCoord3fv(v);
+}
+
+static void APIENTRY trace_glTexCoord3i(GLint s, GLint t, GLint r) {
+    trace_command(TRACE_glTexCoord3i);
+    trace_write_int(s);
+    trace_write_int(t);
+    trace_write_int(r);
+    trace_real.glTexCoord3i(s, t, r);
+}
+
+static void trace_replay_glTexCoord3i(struct trace_reader *reader) {
+    if (!__glTexCoord3i) {
+        trace_missing(reader, TRACE_glTexCoord3i);
+        return;
+    }
+    GLint s = (GLint)trace_read_int(reader);
+    GLint t = (GLint)trace_read_int(reader);
+    GLint r = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glTexCoord3i(s, t, r);
+}
+
+static void APIENTRY trace_glTexCoord3iv(const GLint *v) {
+    trace_command(TRACE_glTexCoord3iv);
+    trace_write_array(v, (size_t)(3), sizeof(GLint));
+    trace_real.glTexCoord3iv(v);
+}
+
+static void trace_replay_glTexCoord3iv(struct trace_reader *reader) {
+    if (!__glTexCoord3iv) {
+        trace_missing(reader, TRACE_glTexCoord3iv);
+        return;
+    }
+    const GLint *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glTexCoord3iv(v);
+}
+
+static void APIENTRY trace_glTexCoord3s(GLshort s, GLshort t, GLshort r) {
+    trace_command(TRACE_glTexCoord3s);
+    trace_write_int(s);
+    trace_write_int(t);
+    trace_write_int(r);
+    trace_real.glTexCoord3s(s, t, r);
+}
+
+static void trace_replay_glTexCoord3s(struct trace_reader *reader) {
+    if (!__glTexCoord3s) {
+        trace_missing(reader, TRACE_glTexCoord3s);
+        return;
+    }
+    GLshort s = (GLshort)trace_read_int(reader);
+    GLshort t = (GLshort)trace_read_int(reader);
+    GLshort r = (GLshort)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glTexCoord3s(s, t, r);
+}
+
+static void APIENTRY trace_glTexCoord3sv(const GLshort *v) {
+    trace_command(TRACE_glTexCoord3sv);
+    trace_write_array(v, (size_t)(3), sizeof(GLshort));
+    trace_real.glTexCoord3sv(v);
+}
+
+static void trace_replay_glTexCoord3sv(struct trace_reader *reader) {
+    if (!__glTexCoord3sv) {
+        trace_missing(reader, TRACE_glTexCoord3sv);
+        return;
+    }
+    const GLshort *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glTexCoord3sv(v);
+}
+
+static void APIENTRY trace_glTexCoord4d(GLdouble s, GLdouble t, GLdouble r, GLdouble q) {
+    trace_command(TRACE_glTexCoord4d);
+    trace_write_double(s);
+    trace_write_double(t);
+    trace_write_double(r);
+    trace_write_double(q);
+    trace_real.glTexCoord4d(s, t, r, q);
+}
+
+static void trace_replay_glTexCoord4d(struct trace_reader *reader) {
+    if (!__glTexCoord4d) {
+        trace_missing(reader, TRACE_glTexCoord4d);
+        return;
+    }
+    GLdouble s = trace_read_double(reader);
+    GLdouble t = trace_read_double(reader);
+    GLdouble r = trace_read_double(reader);
+    GLdouble q = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glTexCoord4d(s, t, r, q);
+}
+
+static void APIENTRY trace_glTexCoord4dv(const GLdouble *v) {
+    trace_command(TRACE_glTexCoord4dv);
+    trace_write_array(v, (size_t)(4), sizeof(GLdouble));
+    trace_real.glTexCoord4dv(v);
+}
+
+static void trace_replay_glTexCoord4dv(struct trace_reader *reader) {
+    if (!__glTexCoord4dv) {
+        trace_missing(reader, TRACE_glTexCoord4dv);
+        return;
+    }
+    const GLdouble *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glTexCoord4dv(v);
+}
+
+static void APIENTRY trace_glTexCoord4f(GLfloat s, GLfloat t, GLfloat r, GLfloat q) {
+    trace_command(TRACE_glTexCoord4f);
+    trace_write_float(s);
+    trace_write_float(t);
+    trace_write_float(r);
+    trace_write_float(q);
+    trace_real.glTexCoord4f(s, t, r, q);
+}
+
+static void trace_replay_glTexCoord4f(struct trace_reader *reader) {
+    if (!__glTexCoord4f) {
+        trace_missing(reader, TRACE_glTexCoord4f);
+        return;
+    }
+    GLfloat s = trace_read_float(reader);
+    GLfloat t = trace_read_float(reader);
+    GLfloat r = trace_read_float(reader);
+    GLfloat q = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glTexCoord4f(s, t, r, q);
+}
+
+static void APIENTRY trace_glTexCoord4fv(const GLfloat *v) {
+    trace_command(TRACE_glTexCoord4fv);
+    trace_write_array(v, (size_t)(4), sizeof(GLfloat));
+    trace_real.glTexCoord4fv(v);
+}
+
+static void trace_replay_glTexCoord4fv(struct trace_reader *reader) {
+    if (!__glTexCoord4fv) {
+        trace_missing(reader, TRACE_glTexCoord4fv);
+        return;
+    }
+    const GLfloat *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glTexCoord4fv(v);
+}
+
+static void APIENTRY trace_glTexCoord4i(GLint s, GLint t, GLint r, GLint q) {
+    trace_command(TRACE_glTexCoord4i);
+    trace_write_int(s);
+    trace_write_int(t);
+    trace_write_int(r);
+    trace_write_int(q);
+    trace_real.glTexCoord4i(s, t, r, q);
+}
+
+static void trace_replay_glTexCoord4i(struct trace_reader *reader) {
+    if (!__glTexCoord4i) {
+        trace_missing(reader, TRACE_glTexCoord4i);
+        return;
+    }
+    GLint s = (GLint)trace_read_int(reader);
+    GLint t = (GLint)trace_read_int(reader);
+    GLint r = (GLint)trace_read_int(reader);
+    GLint q = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glTexCoord4i(s, t, r, q);
+}
+
+static void APIENTRY trace_glTexCoord4iv(const GLint *v) {
+    trace_command(TRACE_glTexCoord4iv);
+    trace_write_array(v, (size_t)(4), sizeof(GLint));
+    trace_real.glTexCoord4iv(v);
+}
+
+static void trace_replay_glTexCoord4iv(struct trace_reader *reader) {
+    if (!__glTexCoord4iv) {
+        trace_missing(reader, TRACE_glTexCoord4iv);
+        return;
+    }
+    const GLint *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glTexCoord4iv(v);
+}
+
+static void APIENTRY trace_glTexCoord4s(GLshort s, GLshort t, GLshort r, GLshort q) {
+    trace_command(TRACE_glTexCoord4s);
+    trace_write_int(s);
+    trace_write_int(t);
+    trace_write_int(r);
+    trace_write_int(q);
+    trace_real.glTexCoord4s(s, t, r, q);
+}
+
+static void trace_replay_glTexCoord4s(struct trace_reader *reader) {
+    if (!__glTexCoord4s) {
+        trace_missing(reader, TRACE_glTexCoord4s);
+        return;
+    }
+    GLshort s = (GLshort)trace_read_int(reader);
+    GLshort t = (GLshort)trace_read_int(reader);
+    GLshort r = (GLshort)trace_read_int(reader);
+    GLshort q = (GLshort)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glTexCoord4s(s, t, r, q);
+}
+
+static void APIENTRY trace_glTexCoord4sv(const GLshort *v) {
+    trace_command(TRACE_glTexCoord4sv);
+    trace_write_array(v, (size_t)(4), sizeof(GLshort));
+    trace_real.glTexCoord4sv(v);
+}
+
+static void trace_replay_glTexCoord4sv(struct trace_reader *reader) {
+    if (!__glTexCoord4sv) {
+        trace_missing(reader, TRACE_glTexCoord4sv);
+        return;
+    }
+    const GLshort *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glTexCoord4sv(v);
+}
+
+static void APIENTRY trace_glVertex2d(GLdouble x, GLdouble y) {
+    trace_command(TRACE_glVertex2d);
+    trace_write_double(x);
+    trace_write_double(y);
+    trace_real.glVertex2d(x, y);
+}
+
+static void trace_replay_glVertex2d(struct trace_reader *reader) {
+    if (!__glVertex2d) {
+        trace_missing(reader, TRACE_glVertex2d);
+        return;
+    }
+    GLdouble x = trace_read_double(reader);
+    GLdouble y = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glVertex2d(x, y);
+}
+
+static void APIENTRY trace_glVertex2dv(const GLdouble *v) {
+    trace_command(TRACE_glVertex2dv);
+    trace_write_array(v, (size_t)(2), sizeof(GLdouble));
+    trace_real.glVertex2dv(v);
+}
+
+static void trace_replay_glVertex2dv(struct trace_reader *reader) {
+    if (!__glVertex2dv) {
+        trace_missing(reader, TRACE_glVertex2dv);
+        return;
+    }
+    const GLdouble *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertex2dv(v);
+}
+
+static void APIENTRY trace_glVertex2f(GLfloat x, GLfloat y) {
+    trace_command(TRACE_glVertex2f);
+    trace_write_float(x);
+    trace_write_float(y);
+    trace_real.glVertex2f(x, y);
+}
+
+static void trace_replay_glVertex2f(struct trace_reader *reader) {
+    if (!__glVertex2f) {
+        trace_missing(reader, TRACE_glVertex2f);
+        return;
+    }
+    GLfloat x = trace_read_float(reader);
+    GLfloat y = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glVertex2f(x, y);
+}
+
+static void APIENTRY trace_glVertex2fv(const GLfloat *v) {
+    trace_command(TRACE_glVertex2fv);
+    trace_write_array(v, (size_t)(2), sizeof(GLfloat));
+    trace_real.glVertex2fv(v);
+}
+
+static void trace_replay_glVertex2fv(struct trace_reader *reader) {
+    if (!__glVertex2fv) {
+        trace_missing(reader, TRACE_glVertex2fv);
+        return;
+    }
+    const GLfloat *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertex2fv(v);
+}
+
+static void APIENTRY trace_glVertex2i(GLint x, GLint y) {
+    trace_command(TRACE_glVertex2i);
+    trace_write_int(x);
+    trace_write_int(y);
+    trace_real.glVertex2i(x, y);
+}
+
+static void trace_replay_glVertex2i(struct trace_reader *reader) {
+    if (!__glVertex2i) {
+        trace_missing(reader, TRACE_glVertex2i);
+        return;
+    }
+    GLint x = (GLint)trace_read_int(reader);
+    GLint y = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glVertex2i(x, y);
+}
+
+static void APIENTRY trace_glVertex2iv(const GLint *v) {
+    trace_command(TRACE_glVertex2iv);
+    trace_write_array(v, (size_t)(2), sizeof(GLint));
+    trace_real.glVertex2iv(v);
+}
+
+static void trace_replay_glVertex2iv(struct trace_reader *reader) {
+    if (!__glVertex2iv) {
+        trace_missing(reader, TRACE_glVertex2iv);
+        return;
+    }
+    const GLint *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertex2iv(v);
+}
+
+static void APIENTRY trace_glVertex2s(GLshort x, GLshort y) {
+    trace_command(TRACE_glVertex2s);
+    trace_write_int(x);
+    trace_write_int(y);
+    trace_real.glVertex2s(x, y);
+}
+
+static void trace_replay_glVertex2s(struct trace_reader *reader) {
+    if (!__glVertex2s) {
+        trace_missing(reader, TRACE_glVertex2s);
+        return;
+    }
+    GLshort x = (GLshort)trace_read_int(reader);
+    GLshort y = (GLshort)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glVertex2s(x, y);
+}
+
+static void APIENTRY trace_glVertex2sv(const GLshort *v) {
+    trace_command(TRACE_glVertex2sv);
+    trace_write_array(v, (size_t)(2), sizeof(GLshort));
+    trace_real.glVertex2sv(v);
+}
+
+static void trace_replay_glVertex2sv(struct trace_reader *reader) {
+    if (!__glVertex2sv) {
+        trace_missing(reader, TRACE_glVertex2sv);
+        return;
+    }
+    const GLshort *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertex2sv(v);
+}
+
+static void APIENTRY trace_glVertex3d(GLdouble x, GLdouble y, GLdouble z) {
+    trace_command(TRACE_glVertex3d);
+    trace_write_double(x);
+    trace_write_double(y);
+    trace_write_double(z);
+    trace_real.glVertex3d(x, y, z);
+}
+
+static void trace_replay_glVertex3d(struct trace_reader *reader) {
+    if (!__glVertex3d) {
+        trace_missing(reader, TRACE_glVertex3d);
+        return;
+    }
+    GLdouble x = trace_read_double(reader);
+    GLdouble y = trace_read_double(reader);
+    GLdouble z = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glVertex3d(x, y, z);
+}
+
+static void APIENTRY trace_glVertex3dv(const GLdouble *v) {
+    trace_command(TRACE_glVertex3dv);
+    trace_write_array(v, (size_t)(3), sizeof(GLdouble));
+    trace_real.glVertex3dv(v);
+}
+
+static void trace_replay_glVertex3dv(struct trace_reader *reader) {
+    if (!__glVertex3dv) {
+        trace_missing(reader, TRACE_glVertex3dv);
+        return;
+    }
+    const GLdouble *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertex3dv(v);
+}
+
+static void APIENTRY trace_glVertex3f(GLfloat x, GLfloat y, GLfloat z) {
+    trace_command(TRACE_glVertex3f);
+    trace_write_float(x);
+    trace_write_float(y);
+    trace_write_float(z);
+    trace_real.glVertex3f(x, y, z);
+}
+
+static void trace_replay_glVertex3f(struct trace_reader *reader) {
+    if (!__glVertex3f) {
+        trace_missing(reader, TRACE_glVertex3f);
+        return;
+    }
+    GLfloat x = trace_read_float(reader);
+    GLfloat y = trace_read_float(reader);
+    GLfloat z = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glVertex3f(x, y, z);
+}
+
+static void APIENTRY trace_glVertex3fv(const GLfloat *v) {
+    trace_command(TRACE_glVertex3fv);
+    trace_write_array(v, (size_t)(3), sizeof(GLfloat));
+    trace_real.glVertex3fv(v);
+}
+
+static void trace_replay_glVertex3fv(struct trace_reader *reader) {
+    if (!__glVertex3fv) {
+        trace_missing(reader, TRACE_glVertex3fv);
+        return;
+    }
+    const GLfloat *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertex3fv(v);
+}
+
+static void APIENTRY trace_glVertex3i(GLint x, GLint y, GLint z) {
+    trace_command(TRACE_glVertex3i);
+    trace_write_int(x);
+    trace_write_int(y);
+    trace_write_int(z);
+    trace_real.glVertex3i(x, y, z);
+}
+
+static void trace_replay_glVertex3i(struct trace_reader *reader) {
+    if (!__glVertex3i) {
+        trace_missing(reader, TRACE_glVertex3i);
+        return;
+    }
+    GLint x = (GLint)trace_read_int(reader);
+    GLint y = (GLint)trace_read_int(reader);
+    GLint z = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glVertex3i(x, y, z);
+}
+
+static void APIENTRY trace_glVertex3iv(const GLint *v) {
+    trace_command(TRACE_glVertex3iv);
+    trace_write_array(v, (size_t)(3), sizeof(GLint));
+    trace_real.glVertex3iv(v);
+}
+
+static void trace_replay_glVertex3iv(struct trace_reader *reader) {
+    if (!__glVertex3iv) {
+        trace_missing(reader, TRACE_glVertex3iv);
+        return;
+    }
+    const GLint *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertex3iv(v);
+}
+
+static void APIENTRY trace_glVertex3s(GLshort x, GLshort y, GLshort z) {
+    trace_command(TRACE_glVertex3s);
+    trace_write_int(x);
+    trace_write_int(y);
+    trace_write_int(z);
+    trace_real.glVertex3s(x, y, z);
+}
+
+static void trace_replay_glVertex3s(struct trace_reader *reader) {
+    if (!__glVertex3s) {
+        trace_missing(reader, TRACE_glVertex3s);
+        return;
+    }
+    GLshort x = (GLshort)trace_read_int(reader);
+    GLshort y = (GLshort)trace_read_int(reader);
+    GLshort z = (GLshort)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glVertex3s(x, y, z);
+}
+
+static void APIENTRY trace_glVertex3sv(const GLshort *v) {
+    trace_command(TRACE_glVertex3sv);
+    trace_write_array(v, (size_t)(3), sizeof(GLshort));
+    trace_real.glVertex3sv(v);
+}
+
+static void trace_replay_glVertex3sv(struct trace_reader *reader) {
+    if (!__glVertex3sv) {
+        trace_missing(reader, TRACE_glVertex3sv);
+        return;
+    }
+    const GLshort *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertex3sv(v);
+}
+
+static void APIENTRY trace_glVertex4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    trace_command(TRACE_glVertex4d);
+    trace_write_double(x);
+    trace_write_double(y);
+    trace_write_double(z);
+    trace_write_double(w);
+    trace_real.glVertex4d(x, y, z, w);
+}
+
+static void trace_replay_glVertex4d(struct trace_reader *reader) {
+    if (!__glVertex4d) {
+        trace_missing(reader, TRACE_glVertex4d);
+        return;
+    }
+    GLdouble x = trace_read_double(reader);
+    GLdouble y = trace_read_double(reader);
+    GLdouble z = trace_read_double(reader);
+    GLdouble w = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glVertex4d(x, y, z, w);
+}
+
+static void APIENTRY trace_glVertex4dv(const GLdouble *v) {
+    trace_command(TRACE_glVertex4dv);
+    trace_write_array(v, (size_t)(4), sizeof(GLdouble));
+    trace_real.glVertex4dv(v);
+}
+
+static void trace_replay_glVertex4dv(struct trace_reader *reader) {
+    if (!__glVertex4dv) {
+        trace_missing(reader, TRACE_glVertex4dv);
+        return;
+    }
+    const GLdouble *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertex4dv(v);
+}
+
+static void APIENTRY trace_glVertex4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+    trace_command(TRACE_glVertex4f);
+    trace_write_float(x);
+    trace_write_float(y);
+    trace_write_float(z);
+    trace_write_float(w);
+    trace_real.glVertex4f(x, y, z, w);
+}
+
+static void trace_replay_glVertex4f(struct trace_reader *reader) {
+    if (!__glVertex4f) {
+        trace_missing(reader, TRACE_glVertex4f);
+        return;
+    }
+    GLfloat x = trace_read_float(reader);
+    GLfloat y = trace_read_float(reader);
+    GLfloat z = trace_read_float(reader);
+    GLfloat w = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glVertex4f(x, y, z, w);
+}
+
+static void APIENTRY trace_glVertex4fv(const GLfloat *v) {
+    trace_command(TRACE_glVertex4fv);
+    trace_write_array(v, (size_t)(4), sizeof(GLfloat));
+    trace_real.glVertex4fv(v);
+}
+
+static void trace_replay_glVertex4fv(struct trace_reader *reader) {
+    if (!__glVertex4fv) {
+        trace_missing(reader, TRACE_glVertex4fv);
+        return;
+    }
+    const GLfloat *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertex4fv(v);
+}
+
+static void APIENTRY trace_glVertex4i(GLint x, GLint y, GLint z, GLint w) {
+    trace_command(TRACE_glVertex4i);
+    trace_write_int(x);
+    trace_write_int(y);
+    trace_write_int(z);
+    trace_write_int(w);
+    trace_real.glVertex4i(x, y, z, w);
+}
+
+static void trace_replay_glVertex4i(struct trace_reader *reader) {
+    if (!__glVertex4i) {
+        trace_missing(reader, TRACE_glVertex4i);
+        return;
+    }
+    GLint x = (GLint)trace_read_int(reader);
+    GLint y = (GLint)trace_read_int(reader);
+    GLint z = (GLint)trace_read_int(reader);
+    GLint w = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glVertex4i(x, y, z, w);
+}
+
+static void APIENTRY trace_glVertex4iv(const GLint *v) {
+    trace_command(TRACE_glVertex4iv);
+    trace_write_array(v, (size_t)(4), sizeof(GLint));
+    trace_real.glVertex4iv(v);
+}
+
+static void trace_replay_glVertex4iv(struct trace_reader *reader) {
+    if (!__glVertex4iv) {
+        trace_missing(reader, TRACE_glVertex4iv);
+        return;
+    }
+    const GLint *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertex4iv(v);
+}
+
+static void APIENTRY trace_glVertex4s(GLshort x, GLshort y, GLshort z, GLshort w) {
+    trace_command(TRACE_glVertex4s);
+    trace_write_int(x);
+    trace_write_int(y);
+    trace_write_int(z);
+    trace_write_int(w);
+    trace_real.glVertex4s(x, y, z, w);
+}
+
+static void trace_replay_glVertex4s(struct trace_reader *reader) {
+    if (!__glVertex4s) {
+        trace_missing(reader, TRACE_glVertex4s);
+        return;
+    }
+    GLshort x = (GLshort)trace_read_int(reader);
+    GLshort y = (GLshort)trace_read_int(reader);
+    GLshort z = (GLshort)trace_read_int(reader);
+    GLshort w = (GLshort)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glVertex4s(x, y, z, w);
+}
+
+static void APIENTRY trace_glVertex4sv(const GLshort *v) {
+    trace_command(TRACE_glVertex4sv);
+    trace_write_array(v, (size_t)(4), sizeof(GLshort));
+    trace_real.glVertex4sv(v);
+}
+
+static void trace_replay_glVertex4sv(struct trace_reader *reader) {
+    if (!__glVertex4sv) {
+        trace_missing(reader, TRACE_glVertex4sv);
+        return;
+    }
+    const GLshort *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertex4sv(v);
+}
+
+static void APIENTRY trace_glClipPlane(GLenum plane, const GLdouble *equation) {
+    trace_command(TRACE_glClipPlane);
+    trace_write_uint(plane);
+    trace_write_array(equation, (size_t)(4), sizeof(GLdouble));
+    trace_real.glClipPlane(plane, equation);
+}
+
+static void trace_replay_glClipPlane(struct trace_reader *reader) {
+    if (!__glClipPlane) {
+        trace_missing(reader, TRACE_glClipPlane);
+        return;
+    }
+    GLenum plane = (GLenum)trace_read_uint(reader);
+    const GLdouble *equation = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glClipPlane(plane, equation);
+}
+
+static void APIENTRY trace_glColorMaterial(GLenum face, GLenum mode) {
+    trace_command(TRACE_glColorMaterial);
+    trace_write_uint(face);
+    trace_write_uint(mode);
+    trace_real.glColorMaterial(face, mode);
+}
+
+static void trace_replay_glColorMaterial(struct trace_reader *reader) {
+    if (!__glColorMaterial) {
+        trace_missing(reader, TRACE_glColorMaterial);
+        return;
+    }
+    GLenum face = (GLenum)trace_read_uint(reader);
+    GLenum mode = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glColorMaterial(face, mode);
+}
+
+static void APIENTRY trace_glFogf(GLenum pname, GLfloat param) {
+    trace_command(TRACE_glFogf);
+    trace_write_uint(pname);
+    trace_write_float(param);
+    trace_real.glFogf(pname, param);
+}
+
+static void trace_replay_glFogf(struct trace_reader *reader) {
+    if (!__glFogf) {
+        trace_missing(reader, TRACE_glFogf);
+        return;
+    }
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    GLfloat param = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glFogf(pname, param);
+}
+
+static void APIENTRY trace_glFogfv(GLenum pname, const GLfloat *params) {
+    trace_command(TRACE_glFogfv);
+    trace_write_uint(pname);
+    trace_write_array(params, (size_t)(trace_pname_count(pname)), sizeof(GLfloat));
+    trace_real.glFogfv(pname, params);
+}
+
+static void trace_replay_glFogfv(struct trace_reader *reader) {
+    if (!__glFogfv) {
+        trace_missing(reader, TRACE_glFogfv);
+        return;
+    }
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    const GLfloat *params = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glFogfv(pname, params);
+}
+
+static void APIENTRY trace_glFogi(GLenum pname, GLint param) {
+    trace_command(TRACE_glFogi);
+    trace_write_uint(pname);
+    trace_write_int(param);
+    trace_real.glFogi(pname, param);
+}
+
+static void trace_replay_glFogi(struct trace_reader *reader) {
+    if (!__glFogi) {
+        trace_missing(reader, TRACE_glFogi);
+        return;
+    }
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    GLint param = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glFogi(pname, param);
+}
+
+static void APIENTRY trace_glFogiv(GLenum pname, const GLint *params) {
+    trace_command(TRACE_glFogiv);
+    trace_write_uint(pname);
+    trace_write_array(params, (size_t)(trace_pname_count(pname)), sizeof(GLint));
+    trace_real.glFogiv(pname, params);
+}
+
+static void trace_replay_glFogiv(struct trace_reader *reader) {
+    if (!__glFogiv) {
+        trace_missing(reader, TRACE_glFogiv);
+        return;
+    }
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    const GLint *params = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glFogiv(pname, params);
+}
+
+static void APIENTRY trace_glLightf(GLenum light, GLenum pname, GLfloat param) {
+    trace_command(TRACE_glLightf);
+    trace_write_uint(light);
+    trace_write_uint(pname);
+    trace_write_float(param);
+    trace_real.glLightf(light, pname, param);
+}
+
+static void trace_replay_glLightf(struct trace_reader *reader) {
+    if (!__glLightf) {
+        trace_missing(reader, TRACE_glLightf);
+        return;
+    }
+    GLenum light = (GLenum)trace_read_uint(reader);
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    GLfloat param = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glLightf(light, pname, param);
+}
+
+static void APIENTRY trace_glLightfv(GLenum light, GLenum pname, const GLfloat *params) {
+    trace_command(TRACE_glLightfv);
+    trace_write_uint(light);
+    trace_write_uint(pname);
+    trace_write_array(params, (size_t)(trace_pname_count(pname)), sizeof(GLfloat));
+    trace_real.glLightfv(light, pname, params);
+}
+
+static void trace_replay_glLightfv(struct trace_reader *reader) {
+    if (!__glLightfv) {
+        trace_missing(reader, TRACE_glLightfv);
+        return;
+    }
+    GLenum light = (GLenum)trace_read_uint(reader);
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    const GLfloat *params = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glLightfv(light, pname, params);
+}
+
+static void APIENTRY trace_glLighti(GLenum light, GLenum pname, GLint param) {
+    trace_command(TRACE_glLighti);
+    trace_write_uint(light);
+    trace_write_uint(pname);
+    trace_write_int(param);
+    trace_real.glLighti(light, pname, param);
+}
+
+static void trace_replay_glLighti(struct trace_reader *reader) {
+    if (!__glLighti) {
+        trace_missing(reader, TRACE_glLighti);
+        return;
+    }
+    GLenum light = (GLenum)trace_read_uint(reader);
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    GLint param = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glLighti(light, pname, param);
+}
+
+static void APIENTRY trace_glLightiv(GLenum light, GLenum pname, const GLint *params) {
+    trace_command(TRACE_glLightiv);
+    trace_write_uint(light);
+    trace_write_uint(pname);
+    trace_write_array(params, (size_t)(trace_pname_count(pname)), sizeof(GLint));
+    trace_real.glLightiv(light, pname, params);
+}
+
+static void trace_replay_glLightiv(struct trace_reader *reader) {
+    if (!__glLightiv) {
+        trace_missing(reader, TRACE_glLightiv);
+        return;
+    }
+    GLenum light = (GLenum)trace_read_uint(reader);
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    const GLint *params = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glLightiv(light, pname, params);
+}
+
+static void APIENTRY trace_glLightModelf(GLenum pname, GLfloat param) {
+    trace_command(TRACE_glLightModelf);
+    trace_write_uint(pname);
+    trace_write_float(param);
+    trace_real.glLightModelf(pname, param);
+}
+
+static void trace_replay_glLightModelf(struct trace_reader *reader) {
+    if (!__glLightModelf) {
+        trace_missing(reader, TRACE_glLightModelf);
+        return;
+    }
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    GLfloat param = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glLightModelf(pname, param);
+}
+
+static void APIENTRY trace_glLightModelfv(GLenum pname, const GLfloat *params) {
+    trace_command(TRACE_glLightModelfv);
+    trace_write_uint(pname);
+    trace_write_array(params, (size_t)(trace_pname_count(pname)), sizeof(GLfloat));
+    trace_real.glLightModelfv(pname, params);
+}
+
+static void trace_replay_glLightModelfv(struct trace_reader *reader) {
+    if (!__glLightModelfv) {
+        trace_missing(reader, TRACE_glLightModelfv);
+        return;
+    }
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    const GLfloat *params = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glLightModelfv(pname, params);
+}
+
+static void APIENTRY trace_glLightModeli(GLenum pname, GLint param) {
+    trace_command(TRACE_glLightModeli);
+    trace_write_uint(pname);
+    trace_write_int(param);
+    trace_real.glLightModeli(pname, param);
+}
+
+static void trace_replay_glLightModeli(struct trace_reader *reader) {
+    if (!__glLightModeli) {
+        trace_missing(reader, TRACE_glLightModeli);
+        return;
+    }
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    GLint param = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glLightModeli(pname, param);
+}
+
+static void APIENTRY trace_glLightModeliv(GLenum pname, const GLint *params) {
+    trace_command(TRACE_glLightModeliv);
+    trace_write_uint(pname);
+    trace_write_array(params, (size_t)(trace_pname_count(pname)), sizeof(GLint));
+    trace_real.glLightModeliv(pname, params);
+}
+
+static void trace_replay_glLightModeliv(struct trace_reader *reader) {
+    if (!__glLightModeliv) {
+        trace_missing(reader, TRACE_glLightModeliv);
+        return;
+    }
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    const GLint *params = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glLightModeliv(pname, params);
+}
+
+static void APIENTRY trace_glLineStipple(GLint factor, GLushort pattern) {
+    trace_command(TRACE_glLineStipple);
+    trace_write_int(factor);
+    trace_write_uint(pattern);
+    trace_real.glLineStipple(factor, pattern);
+}
+
+static void trace_replay_glLineStipple(struct trace_reader *reader) {
+    if (!__glLineStipple) {
+        trace_missing(reader, TRACE_glLineStipple);
+        return;
+    }
+    GLint factor = (GLint)trace_read_int(reader);
+    GLushort pattern = (GLushort)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glLineStipple(factor, pattern);
+}
+
+static void APIENTRY trace_glMaterialf(GLenum face, GLenum pname, GLfloat param) {
+    trace_command(TRACE_glMaterialf);
+    trace_write_uint(face);
+    trace_write_uint(pname);
+    trace_write_float(param);
+    trace_real.glMaterialf(face, pname, param);
+}
+
+static void trace_replay_glMaterialf(struct trace_reader *reader) {
+    if (!__glMaterialf) {
+        trace_missing(reader, TRACE_glMaterialf);
+        return;
+    }
+    GLenum face = (GLenum)trace_read_uint(reader);
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    GLfloat param = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glMaterialf(face, pname, param);
+}
+
+static void APIENTRY trace_glMaterialfv(GLenum face, GLenum pname, const GLfloat *params) {
+    trace_command(TRACE_glMaterialfv);
+    trace_write_uint(face);
+    trace_write_uint(pname);
+    trace_write_array(params, (size_t)(trace_pname_count(pname)), sizeof(GLfloat));
+    trace_real.glMaterialfv(face, pname, params);
+}
+
+static void trace_replay_glMaterialfv(struct trace_reader *reader) {
+    if (!__glMaterialfv) {
+        trace_missing(reader, TRACE_glMaterialfv);
+        return;
+    }
+    GLenum face = (GLenum)trace_read_uint(reader);
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    const GLfloat *params = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glMaterialfv(face, pname, params);
+}
+
+static void APIENTRY trace_glMateriali(GLenum face, GLenum pname, GLint param) {
+    trace_command(TRACE_glMateriali);
+    trace_write_uint(face);
+    trace_write_uint(pname);
+    trace_write_int(param);
+    trace_real.glMateriali(face, pname, param);
+}
+
+static void trace_replay_glMateriali(struct trace_reader *reader) {
+    if (!__glMateriali) {
+        trace_missing(reader, TRACE_glMateriali);
+        return;
+    }
+    GLenum face = (GLenum)trace_read_uint(reader);
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    GLint param = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glMateriali(face, pname, param);
+}
+
+static void APIENTRY trace_glMaterialiv(GLenum face, GLenum pname, const GLint *params) {
+    trace_command(TRACE_glMaterialiv);
+    trace_write_uint(face);
+    trace_write_uint(pname);
+    trace_write_array(params, (size_t)(trace_pname_count(pname)), sizeof(GLint));
+    trace_real.glMaterialiv(face, pname, params);
+}
+
+static void trace_replay_glMaterialiv(struct trace_reader *reader) {
+    if (!__glMaterialiv) {
+        trace_missing(reader, TRACE_glMaterialiv);
+        return;
+    }
+    GLenum face = (GLenum)trace_read_uint(reader);
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    const GLint *params = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glMaterialiv(face, pname, params);
+}
+
+static void APIENTRY trace_glPolygonStipple(const GLubyte *mask) {
+    trace_command(TRACE_glPolygonStipple);
+    trace_write_array(mask, (size_t)(128), sizeof(GLubyte));
+    trace_real.glPolygonStipple(mask);
+}
+
+static void trace_replay_glPolygonStipple(struct trace_reader *reader) {
+    if (!__glPolygonStipple) {
+        trace_missing(reader, TRACE_glPolygonStipple);
+        return;
+    }
+    const GLubyte *mask = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glPolygonStipple(mask);
+}
+
+static void APIENTRY trace_glShadeModel(GLenum mode) {
+    trace_command(TRACE_glShadeModel);
+    trace_write_uint(mode);
+    trace_real.glShadeModel(mode);
+}
+
+static void trace_replay_glShadeModel(struct trace_reader *reader) {
+    if (!__glShadeModel) {
+        trace_missing(reader, TRACE_glShadeModel);
+        return;
+    }
+    GLenum mode = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glShadeModel(mode);
+}
+
+static void APIENTRY trace_glTexEnvf(GLenum target, GLenum pname, GLfloat param) {
+    trace_command(TRACE_glTexEnvf);
+    trace_write_uint(target);
+    trace_write_uint(pname);
+    trace_write_float(param);
+    trace_real.glTexEnvf(target, pname, param);
+}
+
+static void trace_replay_glTexEnvf(struct trace_reader *reader) {
+    if (!__glTexEnvf) {
+        trace_missing(reader, TRACE_glTexEnvf);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    GLfloat param = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glTexEnvf(target, pname, param);
+}
+
+static void APIENTRY trace_glTexEnvfv(GLenum target, GLenum pname, const GLfloat *params) {
+    trace_command(TRACE_glTexEnvfv);
+    trace_write_uint(target);
+    trace_write_uint(pname);
+    trace_write_array(params, (size_t)(trace_pname_count(pname)), sizeof(GLfloat));
+    trace_real.glTexEnvfv(target, pname, params);
+}
+
+static void trace_replay_glTexEnvfv(struct trace_reader *reader) {
+    if (!__glTexEnvfv) {
+        trace_missing(reader, TRACE_glTexEnvfv);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    const GLfloat *params = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glTexEnvfv(target, pname, params);
+}
+
+static void APIENTRY trace_glTexEnvi(GLenum target, GLenum pname, GLint param) {
+    trace_command(TRACE_glTexEnvi);
+    trace_write_uint(target);
+    trace_write_uint(pname);
+    trace_write_int(param);
+    trace_real.glTexEnvi(target, pname, param);
+}
+
+static void trace_replay_glTexEnvi(struct trace_reader *reader) {
+    if (!__glTexEnvi) {
+        trace_missing(reader, TRACE_glTexEnvi);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    GLint param = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glTexEnvi(target, pname, param);
+}
+
+static void APIENTRY trace_glTexEnviv(GLenum target, GLenum pname, const GLint *params) {
+    trace_command(TRACE_glTexEnviv);
+    trace_write_uint(target);
+    trace_write_uint(pname);
+    trace_write_array(params, (size_t)(trace_pname_count(pname)), sizeof(GLint));
+    trace_real.glTexEnviv(target, pname, params);
+}
+
+static void trace_replay_glTexEnviv(struct trace_reader *reader) {
+    if (!__glTexEnviv) {
+        trace_missing(reader, TRACE_glTexEnviv);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    const GLint *params = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glTexEnviv(target, pname, params);
+}
+
+static void APIENTRY trace_glTexGend(GLenum coord, GLenum pname, GLdouble param) {
+    trace_command(TRACE_glTexGend);
+    trace_write_uint(coord);
+    trace_write_uint(pname);
+    trace_write_double(param);
+    trace_real.glTexGend(coord, pname, param);
+}
+
+static void trace_replay_glTexGend(struct trace_reader *reader) {
+    if (!__glTexGend) {
+        trace_missing(reader, TRACE_glTexGend);
+        return;
+    }
+    GLenum coord = (GLenum)trace_read_uint(reader);
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    GLdouble param = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glTexGend(coord, pname, param);
+}
+
+static void APIENTRY trace_glTexGendv(GLenum coord, GLenum pname, const GLdouble *params) {
+    trace_command(TRACE_glTexGendv);
+    trace_write_uint(coord);
+    trace_write_uint(pname);
+    trace_write_array(params, (size_t)(trace_pname_count(pname)), sizeof(GLdouble));
+    trace_real.glTexGendv(coord, pname, params);
+}
+
+static void trace_replay_glTexGendv(struct trace_reader *reader) {
+    if (!__glTexGendv) {
+        trace_missing(reader, TRACE_glTexGendv);
+        return;
+    }
+    GLenum coord = (GLenum)trace_read_uint(reader);
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    const GLdouble *params = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glTexGendv(coord, pname, params);
+}
+
+static void APIENTRY trace_glTexGenf(GLenum coord, GLenum pname, GLfloat param) {
+    trace_command(TRACE_glTexGenf);
+    trace_write_uint(coord);
+    trace_write_uint(pname);
+    trace_write_float(param);
+    trace_real.glTexGenf(coord, pname, param);
+}
+
+static void trace_replay_glTexGenf(struct trace_reader *reader) {
+    if (!__glTexGenf) {
+        trace_missing(reader, TRACE_glTexGenf);
+        return;
+    }
+    GLenum coord = (GLenum)trace_read_uint(reader);
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    GLfloat param = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glTexGenf(coord, pname, param);
+}
+
+static void APIENTRY trace_glTexGenfv(GLenum coord, GLenum pname, const GLfloat *params) {
+    trace_command(TRACE_glTexGenfv);
+    trace_write_uint(coord);
+    trace_write_uint(pname);
+    trace_write_array(params, (size_t)(trace_pname_count(pname)), sizeof(GLfloat));
+    trace_real.glTexGenfv(coord, pname, params);
+}
+
+static void trace_replay_glTexGenfv(struct trace_reader *reader) {
+    if (!__glTexGenfv) {
+        trace_missing(reader, TRACE_glTexGenfv);
+        return;
+    }
+    GLenum coord = (GLenum)trace_read_uint(reader);
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    const GLfloat *params = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glTexGenfv(coord, pname, params);
+}
+
+static void APIENTRY trace_glTexGeni(GLenum coord, GLenum pname, GLint param) {
+    trace_command(TRACE_glTexGeni);
+    trace_write_uint(coord);
+    trace_write_uint(pname);
+    trace_write_int(param);
+    trace_real.glTexGeni(coord, pname, param);
+}
+
+static void trace_replay_glTexGeni(struct trace_reader *reader) {
+    if (!__glTexGeni) {
+        trace_missing(reader, TRACE_glTexGeni);
+        return;
+    }
+    GLenum coord = (GLenum)trace_read_uint(reader);
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    GLint param = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glTexGeni(coord, pname, param);
+}
+
+static void APIENTRY trace_glTexGeniv(GLenum coord, GLenum pname, const GLint *params) {
+    trace_command(TRACE_glTexGeniv);
+    trace_write_uint(coord);
+    trace_write_uint(pname);
+    trace_write_array(params, (size_t)(trace_pname_count(pname)), sizeof(GLint));
+    trace_real.glTexGeniv(coord, pname, params);
+}
+
+static void trace_replay_glTexGeniv(struct trace_reader *reader) {
+    if (!__glTexGeniv) {
+        trace_missing(reader, TRACE_glTexGeniv);
+        return;
+    }
+    GLenum coord = (GLenum)trace_read_uint(reader);
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    const GLint *params = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glTexGeniv(coord, pname, params);
+}
+
+static void APIENTRY trace_glInitNames(void) {
+    trace_command(TRACE_glInitNames);
+    trace_real.glInitNames();
+}
+
+static void trace_replay_glInitNames(struct trace_reader *reader) {
+    if (!__glInitNames) {
+        trace_missing(reader, TRACE_glInitNames);
+        return;
+    }
+    if (reader->error)
+        return;
+    __glInitNames();
+}
+
+static void APIENTRY trace_glLoadName(GLuint name) {
+    trace_command(TRACE_glLoadName);
+    trace_write_uint(name);
+    trace_real.glLoadName(name);
+}
+
+static void trace_replay_glLoadName(struct trace_reader *reader) {
+    if (!__glLoadName) {
+        trace_missing(reader, TRACE_glLoadName);
+        return;
+    }
+    GLuint name = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glLoadName(name);
+}
+
+static void APIENTRY trace_glPassThrough(GLfloat token) {
+    trace_command(TRACE_glPassThrough);
+    trace_write_float(token);
+    trace_real.glPassThrough(token);
+}
+
+static void trace_replay_glPassThrough(struct trace_reader *reader) {
+    if (!__glPassThrough) {
+        trace_missing(reader, TRACE_glPassThrough);
+        return;
+    }
+    GLfloat token = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glPassThrough(token);
+}
+
+static void APIENTRY trace_glPopName(void) {
+    trace_command(TRACE_glPopName);
+    trace_real.glPopName();
+}
+
+static void trace_replay_glPopName(struct trace_reader *reader) {
+    if (!__glPopName) {
+        trace_missing(reader, TRACE_glPopName);
+        return;
+    }
+    if (reader->error)
+        return;
+    __glPopName();
+}
+
+static void APIENTRY trace_glPushName(GLuint name) {
+    trace_command(TRACE_glPushName);
+    trace_write_uint(name);
+    trace_real.glPushName(name);
+}
+
+static void trace_replay_glPushName(struct trace_reader *reader) {
+    if (!__glPushName) {
+        trace_missing(reader, TRACE_glPushName);
+        return;
+    }
+    GLuint name = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glPushName(name);
+}
+
+static void APIENTRY trace_glClearAccum(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    trace_command(TRACE_glClearAccum);
+    trace_write_float(red);
+    trace_write_float(green);
+    trace_write_float(blue);
+    trace_write_float(alpha);
+    trace_real.glClearAccum(red, green, blue, alpha);
+}
+
+static void trace_replay_glClearAccum(struct trace_reader *reader) {
+    if (!__glClearAccum) {
+        trace_missing(reader, TRACE_glClearAccum);
+        return;
+    }
+    GLfloat red = trace_read_float(reader);
+    GLfloat green = trace_read_float(reader);
+    GLfloat blue = trace_read_float(reader);
+    GLfloat alpha = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glClearAccum(red, green, blue, alpha);
+}
+
+static void APIENTRY trace_glClearIndex(GLfloat c) {
+    trace_command(TRACE_glClearIndex);
+    trace_write_float(c);
+    trace_real.glClearIndex(c);
+}
+
+static void trace_replay_glClearIndex(struct trace_reader *reader) {
+    if (!__glClearIndex) {
+        trace_missing(reader, TRACE_glClearIndex);
+        return;
+    }
+    GLfloat c = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glClearIndex(c);
+}
+
+static void APIENTRY trace_glIndexMask(GLuint mask) {
+    trace_command(TRACE_glIndexMask);
+    trace_write_uint(mask);
+    trace_real.glIndexMask(mask);
+}
+
+static void trace_replay_glIndexMask(struct trace_reader *reader) {
+    if (!__glIndexMask) {
+        trace_missing(reader, TRACE_glIndexMask);
+        return;
+    }
+    GLuint mask = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glIndexMask(mask);
+}
+
+static void APIENTRY trace_glAccum(GLenum op, GLfloat value) {
+    trace_command(TRACE_glAccum);
+    trace_write_uint(op);
+    trace_write_float(value);
+    trace_real.glAccum(op, value);
+}
+
+static void trace_replay_glAccum(struct trace_reader *reader) {
+    if (!__glAccum) {
+        trace_missing(reader, TRACE_glAccum);
+        return;
+    }
+    GLenum op = (GLenum)trace_read_uint(reader);
+    GLfloat value = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glAccum(op, value);
+}
+
+static void APIENTRY trace_glPopAttrib(void) {
+    trace_command(TRACE_glPopAttrib);
+    trace_real.glPopAttrib();
+}
+
+static void trace_replay_glPopAttrib(struct trace_reader *reader) {
+    if (!__glPopAttrib) {
+        trace_missing(reader, TRACE_glPopAttrib);
+        return;
+    }
+    if (reader->error)
+        return;
+    __glPopAttrib();
+}
+
+static void APIENTRY trace_glPushAttrib(GLbitfield mask) {
+    trace_command(TRACE_glPushAttrib);
+    trace_write_uint(mask);
+    trace_real.glPushAttrib(mask);
+}
+
+static void trace_replay_glPushAttrib(struct trace_reader *reader) {
+    if (!__glPushAttrib) {
+        trace_missing(reader, TRACE_glPushAttrib);
+        return;
+    }
+    GLbitfield mask = (GLbitfield)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glPushAttrib(mask);
+}
+
+static void APIENTRY trace_glMap1d(GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble *points) {
+    trace_command(TRACE_glMap1d);
+    trace_write_uint(target);
+    trace_write_double(u1);
+    trace_write_double(u2);
+    trace_write_int(stride);
+    trace_write_int(order);
+    trace_write_array(points, (size_t)(((order) - 1) * (stride) + trace_map_components(target)), sizeof(GLdouble));
+    trace_real.glMap1d(target, u1, u2, stride, order, points);
+}
+
+static void trace_replay_glMap1d(struct trace_reader *reader) {
+    if (!__glMap1d) {
+        trace_missing(reader, TRACE_glMap1d);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLdouble u1 = trace_read_double(reader);
+    GLdouble u2 = trace_read_double(reader);
+    GLint stride = (GLint)trace_read_int(reader);
+    GLint order = (GLint)trace_read_int(reader);
+    const GLdouble *points = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glMap1d(target, u1, u2, stride, order, points);
+}
+
+static void APIENTRY trace_glMap1f(GLenum target, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat *points) {
+    trace_command(TRACE_glMap1f);
+    trace_write_uint(target);
+    trace_write_float(u1);
+    trace_write_float(u2);
+    trace_write_int(stride);
+    trace_write_int(order);
+    trace_write_array(points, (size_t)(((order) - 1) * (stride) + trace_map_components(target)), sizeof(GLfloat));
+    trace_real.glMap1f(target, u1, u2, stride, order, points);
+}
+
+static void trace_replay_glMap1f(struct trace_reader *reader) {
+    if (!__glMap1f) {
+        trace_missing(reader, TRACE_glMap1f);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLfloat u1 = trace_read_float(reader);
+    GLfloat u2 = trace_read_float(reader);
+    GLint stride = (GLint)trace_read_int(reader);
+    GLint order = (GLint)trace_read_int(reader);
+    const GLfloat *points = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glMap1f(target, u1, u2, stride, order, points);
+}
+
+static void APIENTRY trace_glMap2d(GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, const GLdouble *points) {
+    trace_command(TRACE_glMap2d);
+    trace_write_uint(target);
+    trace_write_double(u1);
+    trace_write_double(u2);
+    trace_write_int(ustride);
+    trace_write_int(uorder);
+    trace_write_double(v1);
+    trace_write_double(v2);
+    trace_write_int(vstride);
+    trace_write_int(vorder);
+    trace_write_array(points, (size_t)(((uorder) - 1) * (ustride) + ((vorder) - 1) * (vstride) + trace_map_components(target)), sizeof(GLdouble));
+    trace_real.glMap2d(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+}
+
+static void trace_replay_glMap2d(struct trace_reader *reader) {
+    if (!__glMap2d) {
+        trace_missing(reader, TRACE_glMap2d);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLdouble u1 = trace_read_double(reader);
+    GLdouble u2 = trace_read_double(reader);
+    GLint ustride = (GLint)trace_read_int(reader);
+    GLint uorder = (GLint)trace_read_int(reader);
+    GLdouble v1 = trace_read_double(reader);
+    GLdouble v2 = trace_read_double(reader);
+    GLint vstride = (GLint)trace_read_int(reader);
+    GLint vorder = (GLint)trace_read_int(reader);
+    const GLdouble *points = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glMap2d(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+}
+
+static void APIENTRY trace_glMap2f(GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, const GLfloat *points) {
+    trace_command(TRACE_glMap2f);
+    trace_write_uint(target);
+    trace_write_float(u1);
+    trace_write_float(u2);
+    trace_write_int(ustride);
+    trace_write_int(uorder);
+    trace_write_float(v1);
+    trace_write_float(v2);
+    trace_write_int(vstride);
+    trace_write_int(vorder);
+    trace_write_array(points, (size_t)(((uorder) - 1) * (ustride) + ((vorder) - 1) * (vstride) + trace_map_components(target)), sizeof(GLfloat));
+    trace_real.glMap2f(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+}
+
+static void trace_replay_glMap2f(struct trace_reader *reader) {
+    if (!__glMap2f) {
+        trace_missing(reader, TRACE_glMap2f);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLfloat u1 = trace_read_float(reader);
+    GLfloat u2 = trace_read_float(reader);
+    GLint ustride = (GLint)trace_read_int(reader);
+    GLint uorder = (GLint)trace_read_int(reader);
+    GLfloat v1 = trace_read_float(reader);
+    GLfloat v2 = trace_read_float(reader);
+    GLint vstride = (GLint)trace_read_int(reader);
+    GLint vorder = (GLint)trace_read_int(reader);
+    const GLfloat *points = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glMap2f(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+}
+
+static void APIENTRY trace_glMapGrid1d(GLint un, GLdouble u1, GLdouble u2) {
+    trace_command(TRACE_glMapGrid1d);
+    trace_write_int(un);
+    trace_write_double(u1);
+    trace_write_double(u2);
+    trace_real.glMapGrid1d(un, u1, u2);
+}
+
+static void trace_replay_glMapGrid1d(struct trace_reader *reader) {
+    if (!__glMapGrid1d) {
+        trace_missing(reader, TRACE_glMapGrid1d);
+        return;
+    }
+    GLint un = (GLint)trace_read_int(reader);
+    GLdouble u1 = trace_read_double(reader);
+    GLdouble u2 = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glMapGrid1d(un, u1, u2);
+}
+
+static void APIENTRY trace_glMapGrid1f(GLint un, GLfloat u1, GLfloat u2) {
+    trace_command(TRACE_glMapGrid1f);
+    trace_write_int(un);
+    trace_write_float(u1);
+    trace_write_float(u2);
+    trace_real.glMapGrid1f(un, u1, u2);
+}
+
+static void trace_replay_glMapGrid1f(struct trace_reader *reader) {
+    if (!__glMapGrid1f) {
+        trace_missing(reader, TRACE_glMapGrid1f);
+        return;
+    }
+    GLint un = (GLint)trace_read_int(reader);
+    GLfloat u1 = trace_read_float(reader);
+    GLfloat u2 = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glMapGrid1f(un, u1, u2);
+}
+
+static void APIENTRY trace_glMapGrid2d(GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdouble v2) {
+    trace_command(TRACE_glMapGrid2d);
+    trace_write_int(un);
+    trace_write_double(u1);
+    trace_write_double(u2);
+    trace_write_int(vn);
+    trace_write_double(v1);
+    trace_write_double(v2);
+    trace_real.glMapGrid2d(un, u1, u2, vn, v1, v2);
+}
+
+static void trace_replay_glMapGrid2d(struct trace_reader *reader) {
+    if (!__glMapGrid2d) {
+        trace_missing(reader, TRACE_glMapGrid2d);
+        return;
+    }
+    GLint un = (GLint)trace_read_int(reader);
+    GLdouble u1 = trace_read_double(reader);
+    GLdouble u2 = trace_read_double(reader);
+    GLint vn = (GLint)trace_read_int(reader);
+    GLdouble v1 = trace_read_double(reader);
+    GLdouble v2 = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glMapGrid2d(un, u1, u2, vn, v1, v2);
+}
+
+static void APIENTRY trace_glMapGrid2f(GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1, GLfloat v2) {
+    trace_command(TRACE_glMapGrid2f);
+    trace_write_int(un);
+    trace_write_float(u1);
+    trace_write_float(u2);
+    trace_write_int(vn);
+    trace_write_float(v1);
+    trace_write_float(v2);
+    trace_real.glMapGrid2f(un, u1, u2, vn, v1, v2);
+}
+
+static void trace_replay_glMapGrid2f(struct trace_reader *reader) {
+    if (!__glMapGrid2f) {
+        trace_missing(reader, TRACE_glMapGrid2f);
+        return;
+    }
+    GLint un = (GLint)trace_read_int(reader);
+    GLfloat u1 = trace_read_float(reader);
+    GLfloat u2 = trace_read_float(reader);
+    GLint vn = (GLint)trace_read_int(reader);
+    GLfloat v1 = trace_read_float(reader);
+    GLfloat v2 = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glMapGrid2f(un, u1, u2, vn, v1, v2);
+}
+
+static void APIENTRY trace_glEvalCoord1d(GLdouble u) {
+    trace_command(TRACE_glEvalCoord1d);
+    trace_write_double(u);
+    trace_real.glEvalCoord1d(u);
+}
+
+static void trace_replay_glEvalCoord1d(struct trace_reader *reader) {
+    if (!__glEvalCoord1d) {
+        trace_missing(reader, TRACE_glEvalCoord1d);
+        return;
+    }
+    GLdouble u = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glEvalCoord1d(u);
+}
+
+static void APIENTRY trace_glEvalCoord1dv(const GLdouble *u) {
+    trace_command(TRACE_glEvalCoord1dv);
+    trace_write_array(u, (size_t)(1), sizeof(GLdouble));
+    trace_real.glEvalCoord1dv(u);
+}
+
+static void trace_replay_glEvalCoord1dv(struct trace_reader *reader) {
+    if (!__glEvalCoord1dv) {
+        trace_missing(reader, TRACE_glEvalCoord1dv);
+        return;
+    }
+    const GLdouble *u = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glEvalCoord1dv(u);
+}
+
+static void APIENTRY trace_glEvalCoord1f(GLfloat u) {
+    trace_command(TRACE_glEvalCoord1f);
+    trace_write_float(u);
+    trace_real.glEvalCoord1f(u);
+}
+
+static void trace_replay_glEvalCoord1f(struct trace_reader *reader) {
+    if (!__glEvalCoord1f) {
+        trace_missing(reader, TRACE_glEvalCoord1f);
+        return;
+    }
+    GLfloat u = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glEvalCoord1f(u);
+}
+
+static void APIENTRY trace_glEvalCoord1fv(const GLfloat *u) {
+    trace_command(TRACE_glEvalCoord1fv);
+    trace_write_array(u, (size_t)(1), sizeof(GLfloat));
+    trace_real.glEvalCoord1fv(u);
+}
+
+static void trace_replay_glEvalCoord1fv(struct trace_reader *reader) {
+    if (!__glEvalCoord1fv) {
+        trace_missing(reader, TRACE_glEvalCoord1fv);
+        return;
+    }
+    const GLfloat *u = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glEvalCoord1fv(u);
+}
+
+static void APIENTRY trace_glEvalCoord2d(GLdouble u, GLdouble v) {
+    trace_command(TRACE_glEvalCoord2d);
+    trace_write_double(u);
+    trace_write_double(v);
+    trace_real.glEvalCoord2d(u, v);
+}
+
+static void trace_replay_glEvalCoord2d(struct trace_reader *reader) {
+    if (!__glEvalCoord2d) {
+        trace_missing(reader, TRACE_glEvalCoord2d);
+        return;
+    }
+    GLdouble u = trace_read_double(reader);
+    GLdouble v = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glEvalCoord2d(u, v);
+}
+
+static void APIENTRY trace_glEvalCoord2dv(const GLdouble *u) {
+    trace_command(TRACE_glEvalCoord2dv);
+    trace_write_array(u, (size_t)(2), sizeof(GLdouble));
+    trace_real.glEvalCoord2dv(u);
+}
+
+static void trace_replay_glEvalCoord2dv(struct trace_reader *reader) {
+    if (!__glEvalCoord2dv) {
+        trace_missing(reader, TRACE_glEvalCoord2dv);
+        return;
+    }
+    const GLdouble *u = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glEvalCoord2dv(u);
+}
+
+static void APIENTRY trace_glEvalCoord2f(GLfloat u, GLfloat v) {
+    trace_command(TRACE_glEvalCoord2f);
+    trace_write_float(u);
+    trace_write_float(v);
+    trace_real.glEvalCoord2f(u, v);
+}
+
+static void trace_replay_glEvalCoord2f(struct trace_reader *reader) {
+    if (!__glEvalCoord2f) {
+        trace_missing(reader, TRACE_glEvalCoord2f);
+        return;
+    }
+    GLfloat u = trace_read_float(reader);
+    GLfloat v = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glEvalCoord2f(u, v);
+}
+
+static void APIENTRY trace_glEvalCoord2fv(const GLfloat *u) {
+    trace_command(TRACE_glEvalCoord2fv);
+    trace_write_array(u, (size_t)(2), sizeof(GLfloat));
+    trace_real.glEvalCoord2fv(u);
+}
+
+static void trace_replay_glEvalCoord2fv(struct trace_reader *reader) {
+    if (!__glEvalCoord2fv) {
+        trace_missing(reader, TRACE_glEvalCoord2fv);
+        return;
+    }
+    const GLfloat *u = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glEvalCoord2fv(u);
+}
+
+static void APIENTRY trace_glEvalMesh1(GLenum mode, GLint i1, GLint i2) {
+    trace_command(TRACE_glEvalMesh1);
+    trace_write_uint(mode);
+    trace_write_int(i1);
+    trace_write_int(i2);
+    trace_real.glEvalMesh1(mode, i1, i2);
+}
+
+static void trace_replay_glEvalMesh1(struct trace_reader *reader) {
+    if (!__glEvalMesh1) {
+        trace_missing(reader, TRACE_glEvalMesh1);
+        return;
+    }
+    GLenum mode = (GLenum)trace_read_uint(reader);
+    GLint i1 = (GLint)trace_read_int(reader);
+    GLint i2 = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glEvalMesh1(mode, i1, i2);
+}
+
+static void APIENTRY trace_glEvalPoint1(GLint i) {
+    trace_command(TRACE_glEvalPoint1);
+    trace_write_int(i);
+    trace_real.glEvalPoint1(i);
+}
+
+static void trace_replay_glEvalPoint1(struct trace_reader *reader) {
+    if (!__glEvalPoint1) {
+        trace_missing(reader, TRACE_glEvalPoint1);
+        return;
+    }
+    GLint i = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glEvalPoint1(i);
+}
+
+static void APIENTRY trace_glEvalMesh2(GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2) {
+    trace_command(TRACE_glEvalMesh2);
+    trace_write_uint(mode);
+    trace_write_int(i1);
+    trace_write_int(i2);
+    trace_write_int(j1);
+    trace_write_int(j2);
+    trace_real.glEvalMesh2(mode, i1, i2, j1, j2);
+}
+
+static void trace_replay_glEvalMesh2(struct trace_reader *reader) {
+    if (!__glEvalMesh2) {
+        trace_missing(reader, TRACE_glEvalMesh2);
+        return;
+    }
+    GLenum mode = (GLenum)trace_read_uint(reader);
+    GLint i1 = (GLint)trace_read_int(reader);
+    GLint i2 = (GLint)trace_read_int(reader);
+    GLint j1 = (GLint)trace_read_int(reader);
+    GLint j2 = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glEvalMesh2(mode, i1, i2, j1, j2);
+}
+
+static void APIENTRY trace_glEvalPoint2(GLint i, GLint j) {
+    trace_command(TRACE_glEvalPoint2);
+    trace_write_int(i);
+    trace_write_int(j);
+    trace_real.glEvalPoint2(i, j);
+}
+
+static void trace_replay_glEvalPoint2(struct trace_reader *reader) {
+    if (!__glEvalPoint2) {
+        trace_missing(reader, TRACE_glEvalPoint2);
+        return;
+    }
+    GLint i = (GLint)trace_read_int(reader);
+    GLint j = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glEvalPoint2(i, j);
+}
+
+static void APIENTRY trace_glAlphaFunc(GLenum func, GLfloat ref) {
+    trace_command(TRACE_glAlphaFunc);
+    trace_write_uint(func);
+    trace_write_float(ref);
+    trace_real.glAlphaFunc(func, ref);
+}
+
+static void trace_replay_glAlphaFunc(struct trace_reader *reader) {
+    if (!__glAlphaFunc) {
+        trace_missing(reader, TRACE_glAlphaFunc);
+        return;
+    }
+    GLenum func = (GLenum)trace_read_uint(reader);
+    GLfloat ref = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glAlphaFunc(func, ref);
+}
+
+static void APIENTRY trace_glPixelZoom(GLfloat xfactor, GLfloat yfactor) {
+    trace_command(TRACE_glPixelZoom);
+    trace_write_float(xfactor);
+    trace_write_float(yfactor);
+    trace_real.glPixelZoom(xfactor, yfactor);
+}
+
+static void trace_replay_glPixelZoom(struct trace_reader *reader) {
+    if (!__glPixelZoom) {
+        trace_missing(reader, TRACE_glPixelZoom);
+        return;
+    }
+    GLfloat xfactor = trace_read_float(reader);
+    GLfloat yfactor = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glPixelZoom(xfactor, yfactor);
+}
+
+static void APIENTRY trace_glPixelTransferf(GLenum pname, GLfloat param) {
+    trace_command(TRACE_glPixelTransferf);
+    trace_write_uint(pname);
+    trace_write_float(param);
+    trace_real.glPixelTransferf(pname, param);
+}
+
+static void trace_replay_glPixelTransferf(struct trace_reader *reader) {
+    if (!__glPixelTransferf) {
+        trace_missing(reader, TRACE_glPixelTransferf);
+        return;
+    }
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    GLfloat param = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glPixelTransferf(pname, param);
+}
+
+static void APIENTRY trace_glPixelTransferi(GLenum pname, GLint param) {
+    trace_command(TRACE_glPixelTransferi);
+    trace_write_uint(pname);
+    trace_write_int(param);
+    trace_real.glPixelTransferi(pname, param);
+}
+
+static void trace_replay_glPixelTransferi(struct trace_reader *reader) {
+    if (!__glPixelTransferi) {
+        trace_missing(reader, TRACE_glPixelTransferi);
+        return;
+    }
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    GLint param = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glPixelTransferi(pname, param);
+}
+
+static void APIENTRY trace_glPixelMapfv(GLenum map, GLsizei mapsize, const GLfloat *values) {
+    trace_command(TRACE_glPixelMapfv);
+    trace_write_uint(map);
+    trace_write_int(mapsize);
+    trace_write_array(values, (size_t)(mapsize), sizeof(GLfloat));
+    trace_real.glPixelMapfv(map, mapsize, values);
+}
+
+static void trace_replay_glPixelMapfv(struct trace_reader *reader) {
+    if (!__glPixelMapfv) {
+        trace_missing(reader, TRACE_glPixelMapfv);
+        return;
+    }
+    GLenum map = (GLenum)trace_read_uint(reader);
+    GLsizei mapsize = (GLsizei)trace_read_int(reader);
+    const GLfloat *values = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glPixelMapfv(map, mapsize, values);
+}
+
+static void APIENTRY trace_glPixelMapuiv(GLenum map, GLsizei mapsize, const GLuint *values) {
+    trace_command(TRACE_glPixelMapuiv);
+    trace_write_uint(map);
+    trace_write_int(mapsize);
+    trace_write_array(values, (size_t)(mapsize), sizeof(GLuint));
+    trace_real.glPixelMapuiv(map, mapsize, values);
+}
+
+static void trace_replay_glPixelMapuiv(struct trace_reader *reader) {
+    if (!__glPixelMapuiv) {
+        trace_missing(reader, TRACE_glPixelMapuiv);
+        return;
+    }
+    GLenum map = (GLenum)trace_read_uint(reader);
+    GLsizei mapsize = (GLsizei)trace_read_int(reader);
+    const GLuint *values = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glPixelMapuiv(map, mapsize, values);
+}
+
+static void APIENTRY trace_glPixelMapusv(GLenum map, GLsizei mapsize, const GLushort *values) {
+    trace_command(TRACE_glPixelMapusv);
+    trace_write_uint(map);
+    trace_write_int(mapsize);
+    trace_write_array(values, (size_t)(mapsize), sizeof(GLushort));
+    trace_real.glPixelMapusv(map, mapsize, values);
+}
+
+static void trace_replay_glPixelMapusv(struct trace_reader *reader) {
+    if (!__glPixelMapusv) {
+        trace_missing(reader, TRACE_glPixelMapusv);
+        return;
+    }
+    GLenum map = (GLenum)trace_read_uint(reader);
+    GLsizei mapsize = (GLsizei)trace_read_int(reader);
+    const GLushort *values = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glPixelMapusv(map, mapsize, values);
+}
+
+static void APIENTRY trace_glCopyPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum type) {
+    trace_command(TRACE_glCopyPixels);
+    trace_write_int(x);
+    trace_write_int(y);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_write_uint(type);
+    trace_real.glCopyPixels(x, y, width, height, type);
+}
+
+static void trace_replay_glCopyPixels(struct trace_reader *reader) {
+    if (!__glCopyPixels) {
+        trace_missing(reader, TRACE_glCopyPixels);
+        return;
+    }
+    GLint x = (GLint)trace_read_int(reader);
+    GLint y = (GLint)trace_read_int(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glCopyPixels(x, y, width, height, type);
+}
+
+static void APIENTRY trace_glDrawPixels(GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+    trace_command(TRACE_glDrawPixels);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_write_uint(format);
+    trace_write_uint(type);
+    trace_write_unpack(pixels, trace_pixels_span(format, type, width, height, 1, false));
+    trace_real.glDrawPixels(width, height, format, type, pixels);
+}
+
+static void trace_replay_glDrawPixels(struct trace_reader *reader) {
+    if (!__glDrawPixels) {
+        trace_missing(reader, TRACE_glDrawPixels);
+        return;
+    }
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    GLenum format = (GLenum)trace_read_uint(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const void *pixels = trace_read_unpack(reader);
+    if (reader->error)
+        return;
+    __glDrawPixels(width, height, format, type, pixels);
+}
+
+static void APIENTRY trace_glFrustum(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) {
+    trace_command(TRACE_glFrustum);
+    trace_write_double(left);
+    trace_write_double(right);
+    trace_write_double(bottom);
+    trace_write_double(top);
+    trace_write_double(zNear);
+    trace_write_double(zFar);
+    trace_real.glFrustum(left, right, bottom, top, zNear, zFar);
+}
+
+static void trace_replay_glFrustum(struct trace_reader *reader) {
+    if (!__glFrustum) {
+        trace_missing(reader, TRACE_glFrustum);
+        return;
+    }
+    GLdouble left = trace_read_double(reader);
+    GLdouble right = trace_read_double(reader);
+    GLdouble bottom = trace_read_double(reader);
+    GLdouble top = trace_read_double(reader);
+    GLdouble zNear = trace_read_double(reader);
+    GLdouble zFar = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glFrustum(left, right, bottom, top, zNear, zFar);
+}
+
+static void APIENTRY trace_glLoadIdentity(void) {
+    trace_command(TRACE_glLoadIdentity);
+    trace_real.glLoadIdentity();
+}
+
+static void trace_replay_glLoadIdentity(struct trace_reader *reader) {
+    if (!__glLoadIdentity) {
+        trace_missing(reader, TRACE_glLoadIdentity);
+        return;
+    }
+    if (reader->error)
+        return;
+    __glLoadIdentity();
+}
+
+static void APIENTRY trace_glLoadMatrixf(const GLfloat *m) {
+    trace_command(TRACE_glLoadMatrixf);
+    trace_write_array(m, (size_t)(16), sizeof(GLfloat));
+    trace_real.glLoadMatrixf(m);
+}
+
+static void trace_replay_glLoadMatrixf(struct trace_reader *reader) {
+    if (!__glLoadMatrixf) {
+        trace_missing(reader, TRACE_glLoadMatrixf);
+        return;
+    }
+    const GLfloat *m = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glLoadMatrixf(m);
+}
+
+static void APIENTRY trace_glLoadMatrixd(const GLdouble *m) {
+    trace_command(TRACE_glLoadMatrixd);
+    trace_write_array(m, (size_t)(16), sizeof(GLdouble));
+    trace_real.glLoadMatrixd(m);
+}
+
+static void trace_replay_glLoadMatrixd(struct trace_reader *reader) {
+    if (!__glLoadMatrixd) {
+        trace_missing(reader, TRACE_glLoadMatrixd);
+        return;
+    }
+    const GLdouble *m = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glLoadMatrixd(m);
+}
+
+static void APIENTRY trace_glMatrixMode(GLenum mode) {
+    trace_command(TRACE_glMatrixMode);
+    trace_write_uint(mode);
+    trace_real.glMatrixMode(mode);
+}
+
+static void trace_replay_glMatrixMode(struct trace_reader *reader) {
+    if (!__glMatrixMode) {
+        trace_missing(reader, TRACE_glMatrixMode);
+        return;
+    }
+    GLenum mode = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glMatrixMode(mode);
+}
+
+static void APIENTRY trace_glMultMatrixf(const GLfloat *m) {
+    trace_command(TRACE_glMultMatrixf);
+    trace_write_array(m, (size_t)(16), sizeof(GLfloat));
+    trace_real.glMultMatrixf(m);
+}
+
+static void trace_replay_glMultMatrixf(struct trace_reader *reader) {
+    if (!__glMultMatrixf) {
+        trace_missing(reader, TRACE_glMultMatrixf);
+        return;
+    }
+    const GLfloat *m = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glMultMatrixf(m);
+}
+
+static void APIENTRY trace_glMultMatrixd(const GLdouble *m) {
+    trace_command(TRACE_glMultMatrixd);
+    trace_write_array(m, (size_t)(16), sizeof(GLdouble));
+    trace_real.glMultMatrixd(m);
+}
+
+static void trace_replay_glMultMatrixd(struct trace_reader *reader) {
+    if (!__glMultMatrixd) {
+        trace_missing(reader, TRACE_glMultMatrixd);
+        return;
+    }
+    const GLdouble *m = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glMultMatrixd(m);
+}
+
+static void APIENTRY trace_glOrtho(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) {
+    trace_command(TRACE_glOrtho);
+    trace_write_double(left);
+    trace_write_double(right);
+    trace_write_double(bottom);
+    trace_write_double(top);
+    trace_write_double(zNear);
+    trace_write_double(zFar);
+    trace_real.glOrtho(left, right, bottom, top, zNear, zFar);
+}
+
+static void trace_replay_glOrtho(struct trace_reader *reader) {
+    if (!__glOrtho) {
+        trace_missing(reader, TRACE_glOrtho);
+        return;
+    }
+    GLdouble left = trace_read_double(reader);
+    GLdouble right = trace_read_double(reader);
+    GLdouble bottom = trace_read_double(reader);
+    GLdouble top = trace_read_double(reader);
+    GLdouble zNear = trace_read_double(reader);
+    GLdouble zFar = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glOrtho(left, right, bottom, top, zNear, zFar);
+}
+
+static void APIENTRY trace_glPopMatrix(void) {
+    trace_command(TRACE_glPopMatrix);
+    trace_real.glPopMatrix();
+}
+
+static void trace_replay_glPopMatrix(struct trace_reader *reader) {
+    if (!__glPopMatrix) {
+        trace_missing(reader, TRACE_glPopMatrix);
+        return;
+    }
+    if (reader->error)
+        return;
+    __glPopMatrix();
+}
+
+static void APIENTRY trace_glPushMatrix(void) {
+    trace_command(TRACE_glPushMatrix);
+    trace_real.glPushMatrix();
+}
+
+static void trace_replay_glPushMatrix(struct trace_reader *reader) {
+    if (!__glPushMatrix) {
+        trace_missing(reader, TRACE_glPushMatrix);
+        return;
+    }
+    if (reader->error)
+        return;
+    __glPushMatrix();
+}
+
+static void APIENTRY trace_glRotated(GLdouble angle, GLdouble x, GLdouble y, GLdouble z) {
+    trace_command(TRACE_glRotated);
+    trace_write_double(angle);
+    trace_write_double(x);
+    trace_write_double(y);
+    trace_write_double(z);
+    trace_real.glRotated(angle, x, y, z);
+}
+
+static void trace_replay_glRotated(struct trace_reader *reader) {
+    if (!__glRotated) {
+        trace_missing(reader, TRACE_glRotated);
+        return;
+    }
+    GLdouble angle = trace_read_double(reader);
+    GLdouble x = trace_read_double(reader);
+    GLdouble y = trace_read_double(reader);
+    GLdouble z = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glRotated(angle, x, y, z);
+}
+
+static void APIENTRY trace_glRotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z) {
+    trace_command(TRACE_glRotatef);
+    trace_write_float(angle);
+    trace_write_float(x);
+    trace_write_float(y);
+    trace_write_float(z);
+    trace_real.glRotatef(angle, x, y, z);
+}
+
+static void trace_replay_glRotatef(struct trace_reader *reader) {
+    if (!__glRotatef) {
+        trace_missing(reader, TRACE_glRotatef);
+        return;
+    }
+    GLfloat angle = trace_read_float(reader);
+    GLfloat x = trace_read_float(reader);
+    GLfloat y = trace_read_float(reader);
+    GLfloat z = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glRotatef(angle, x, y, z);
+}
+
+static void APIENTRY trace_glScaled(GLdouble x, GLdouble y, GLdouble z) {
+    trace_command(TRACE_glScaled);
+    trace_write_double(x);
+    trace_write_double(y);
+    trace_write_double(z);
+    trace_real.glScaled(x, y, z);
+}
+
+static void trace_replay_glScaled(struct trace_reader *reader) {
+    if (!__glScaled) {
+        trace_missing(reader, TRACE_glScaled);
+        return;
+    }
+    GLdouble x = trace_read_double(reader);
+    GLdouble y = trace_read_double(reader);
+    GLdouble z = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glScaled(x, y, z);
+}
+
+static void APIENTRY trace_glScalef(GLfloat x, GLfloat y, GLfloat z) {
+    trace_command(TRACE_glScalef);
+    trace_write_float(x);
+    trace_write_float(y);
+    trace_write_float(z);
+    trace_real.glScalef(x, y, z);
+}
+
+static void trace_replay_glScalef(struct trace_reader *reader) {
+    if (!__glScalef) {
+        trace_missing(reader, TRACE_glScalef);
+        return;
+    }
+    GLfloat x = trace_read_float(reader);
+    GLfloat y = trace_read_float(reader);
+    GLfloat z = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glScalef(x, y, z);
+}
+
+static void APIENTRY trace_glTranslated(GLdouble x, GLdouble y, GLdouble z) {
+    trace_command(TRACE_glTranslated);
+    trace_write_double(x);
+    trace_write_double(y);
+    trace_write_double(z);
+    trace_real.glTranslated(x, y, z);
+}
+
+static void trace_replay_glTranslated(struct trace_reader *reader) {
+    if (!__glTranslated) {
+        trace_missing(reader, TRACE_glTranslated);
+        return;
+    }
+    GLdouble x = trace_read_double(reader);
+    GLdouble y = trace_read_double(reader);
+    GLdouble z = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glTranslated(x, y, z);
+}
+
+static void APIENTRY trace_glTranslatef(GLfloat x, GLfloat y, GLfloat z) {
+    trace_command(TRACE_glTranslatef);
+    trace_write_float(x);
+    trace_write_float(y);
+    trace_write_float(z);
+    trace_real.glTranslatef(x, y, z);
+}
+
+static void trace_replay_glTranslatef(struct trace_reader *reader) {
+    if (!__glTranslatef) {
+        trace_missing(reader, TRACE_glTranslatef);
+        return;
+    }
+    GLfloat x = trace_read_float(reader);
+    GLfloat y = trace_read_float(reader);
+    GLfloat z = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glTranslatef(x, y, z);
+}
+
+#endif
+
+#if FUNGL_VERSION >= GL_VERSION_1_1
+static void APIENTRY trace_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
+    trace_command(TRACE_glDrawArrays);
+    trace_write_uint(mode);
+    trace_write_int(first);
+    trace_write_int(count);
+    trace_real.glDrawArrays(mode, first, count);
+}
+
+static void trace_replay_glDrawArrays(struct trace_reader *reader) {
+    if (!__glDrawArrays) {
+        trace_missing(reader, TRACE_glDrawArrays);
+        return;
+    }
+    GLenum mode = (GLenum)trace_read_uint(reader);
+    GLint first = (GLint)trace_read_int(reader);
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glDrawArrays(mode, first, count);
+}
+
+static void APIENTRY trace_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) {
+    trace_command(TRACE_glDrawElements);
+    trace_write_uint(mode);
+    trace_write_int(count);
+    trace_write_uint(type);
+    trace_write_offset(indices);
+    trace_real.glDrawElements(mode, count, type, indices);
+}
+
+static void trace_replay_glDrawElements(struct trace_reader *reader) {
+    if (!__glDrawElements) {
+        trace_missing(reader, TRACE_glDrawElements);
+        return;
+    }
+    GLenum mode = (GLenum)trace_read_uint(reader);
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const void *indices = trace_read_offset(reader);
+    if (reader->error)
+        return;
+    __glDrawElements(mode, count, type, indices);
+}
+
+static void APIENTRY trace_glPolygonOffset(GLfloat factor, GLfloat units) {
+    trace_command(TRACE_glPolygonOffset);
+    trace_write_float(factor);
+    trace_write_float(units);
+    trace_real.glPolygonOffset(factor, units);
+}
+
+static void trace_replay_glPolygonOffset(struct trace_reader *reader) {
+    if (!__glPolygonOffset) {
+        trace_missing(reader, TRACE_glPolygonOffset);
+        return;
+    }
+    GLfloat factor = trace_read_float(reader);
+    GLfloat units = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glPolygonOffset(factor, units);
+}
+
+static void APIENTRY trace_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+    trace_command(TRACE_glCopyTexImage1D);
+    trace_write_uint(target);
+    trace_write_int(level);
+    trace_write_uint(internalformat);
+    trace_write_int(x);
+    trace_write_int(y);
+    trace_write_int(width);
+    trace_write_int(border);
+    trace_real.glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+}
+
+static void trace_replay_glCopyTexImage1D(struct trace_reader *reader) {
+    if (!__glCopyTexImage1D) {
+        trace_missing(reader, TRACE_glCopyTexImage1D);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLint level = (GLint)trace_read_int(reader);
+    GLenum internalformat = (GLenum)trace_read_uint(reader);
+    GLint x = (GLint)trace_read_int(reader);
+    GLint y = (GLint)trace_read_int(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLint border = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+}
+
+static void APIENTRY trace_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+    trace_command(TRACE_glCopyTexImage2D);
+    trace_write_uint(target);
+    trace_write_int(level);
+    trace_write_uint(internalformat);
+    trace_write_int(x);
+    trace_write_int(y);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_write_int(border);
+    trace_real.glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+}
+
+static void trace_replay_glCopyTexImage2D(struct trace_reader *reader) {
+    if (!__glCopyTexImage2D) {
+        trace_missing(reader, TRACE_glCopyTexImage2D);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLint level = (GLint)trace_read_int(reader);
+    GLenum internalformat = (GLenum)trace_read_uint(reader);
+    GLint x = (GLint)trace_read_int(reader);
+    GLint y = (GLint)trace_read_int(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    GLint border = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+}
+
+static void APIENTRY trace_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+    trace_command(TRACE_glCopyTexSubImage1D);
+    trace_write_uint(target);
+    trace_write_int(level);
+    trace_write_int(xoffset);
+    trace_write_int(x);
+    trace_write_int(y);
+    trace_write_int(width);
+    trace_real.glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+}
+
+static void trace_replay_glCopyTexSubImage1D(struct trace_reader *reader) {
+    if (!__glCopyTexSubImage1D) {
+        trace_missing(reader, TRACE_glCopyTexSubImage1D);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLint level = (GLint)trace_read_int(reader);
+    GLint xoffset = (GLint)trace_read_int(reader);
+    GLint x = (GLint)trace_read_int(reader);
+    GLint y = (GLint)trace_read_int(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+}
+
+static void APIENTRY trace_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    trace_command(TRACE_glCopyTexSubImage2D);
+    trace_write_uint(target);
+    trace_write_int(level);
+    trace_write_int(xoffset);
+    trace_write_int(yoffset);
+    trace_write_int(x);
+    trace_write_int(y);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_real.glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+}
+
+static void trace_replay_glCopyTexSubImage2D(struct trace_reader *reader) {
+    if (!__glCopyTexSubImage2D) {
+        trace_missing(reader, TRACE_glCopyTexSubImage2D);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLint level = (GLint)trace_read_int(reader);
+    GLint xoffset = (GLint)trace_read_int(reader);
+    GLint yoffset = (GLint)trace_read_int(reader);
+    GLint x = (GLint)trace_read_int(reader);
+    GLint y = (GLint)trace_read_int(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+}
+
+static void APIENTRY trace_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+    trace_command(TRACE_glTexSubImage1D);
+    trace_write_uint(target);
+    trace_write_int(level);
+    trace_write_int(xoffset);
+    trace_write_int(width);
+    trace_write_uint(format);
+    trace_write_uint(type);
+    trace_write_unpack(pixels, trace_pixels_span(format, type, width, 1, 1, false));
+    trace_real.glTexSubImage1D(target, level, xoffset, width, format, type, pixels);
+}
+
+static void trace_replay_glTexSubImage1D(struct trace_reader *reader) {
+    if (!__glTexSubImage1D) {
+        trace_missing(reader, TRACE_glTexSubImage1D);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLint level = (GLint)trace_read_int(reader);
+    GLint xoffset = (GLint)trace_read_int(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLenum format = (GLenum)trace_read_uint(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const void *pixels = trace_read_unpack(reader);
+    if (reader->error)
+        return;
+    __glTexSubImage1D(target, level, xoffset, width, format, type, pixels);
+}
+
+static void APIENTRY trace_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+    trace_command(TRACE_glTexSubImage2D);
+    trace_write_uint(target);
+    trace_write_int(level);
+    trace_write_int(xoffset);
+    trace_write_int(yoffset);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_write_uint(format);
+    trace_write_uint(type);
+    trace_write_unpack(pixels, trace_pixels_span(format, type, width, height, 1, false));
+    trace_real.glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+
+static void trace_replay_glTexSubImage2D(struct trace_reader *reader) {
+    if (!__glTexSubImage2D) {
+        trace_missing(reader, TRACE_glTexSubImage2D);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLint level = (GLint)trace_read_int(reader);
+    GLint xoffset = (GLint)trace_read_int(reader);
+    GLint yoffset = (GLint)trace_read_int(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    GLenum format = (GLenum)trace_read_uint(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const void *pixels = trace_read_unpack(reader);
+    if (reader->error)
+        return;
+    __glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+
+static void APIENTRY trace_glBindTexture(GLenum target, GLuint texture) {
+    trace_command(TRACE_glBindTexture);
+    trace_write_uint(target);
+    trace_write_uint(texture);
+    trace_real.glBindTexture(target, texture);
+}
+
+static void trace_replay_glBindTexture(struct trace_reader *reader) {
+    if (!__glBindTexture) {
+        trace_missing(reader, TRACE_glBindTexture);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLuint texture = trace_name(reader, TRACE_NAME_TEXTURE, (GLuint)trace_read_uint(reader));
+    if (reader->error)
+        return;
+    __glBindTexture(target, texture);
+}
+
+static void APIENTRY trace_glDeleteTextures(GLsizei n, const GLuint *textures) {
+    trace_command(TRACE_glDeleteTextures);
+    trace_write_int(n);
+    trace_write_array(textures, (size_t)(n), sizeof(GLuint));
+    trace_real.glDeleteTextures(n, textures);
+}
+
+static void trace_replay_glDeleteTextures(struct trace_reader *reader) {
+    if (!__glDeleteTextures) {
+        trace_missing(reader, TRACE_glDeleteTextures);
+        return;
+    }
+    GLsizei n = (GLsizei)trace_read_int(reader);
+    const GLuint *textures = trace_read_names(reader, TRACE_NAME_TEXTURE);
+    if (reader->error)
+        return;
+    __glDeleteTextures(n, textures);
+}
+
+static void APIENTRY trace_glGenTextures(GLsizei n, GLuint *textures) {
+    trace_command(TRACE_glGenTextures);
+    trace_write_int(n);
+    trace_real.glGenTextures(n, textures);
+    trace_write_array(textures, (size_t)(n), sizeof(GLuint));
+}
+
+static void trace_replay_glGenTextures(struct trace_reader *reader) {
+    if (!__glGenTextures) {
+        trace_missing(reader, TRACE_glGenTextures);
+        return;
+    }
+    GLsizei n = (GLsizei)trace_read_int(reader);
+    GLuint *textures = trace_scratch(reader, (size_t)(n) * sizeof(GLuint));
+    if (reader->error)
+        return;
+    __glGenTextures(n, textures);
+    trace_map_names(reader, TRACE_NAME_TEXTURE, textures, (size_t)(n));
+}
+
+static void APIENTRY trace_glArrayElement(GLint i) {
+    trace_command(TRACE_glArrayElement);
+    trace_write_int(i);
+    trace_real.glArrayElement(i);
+}
+
+static void trace_replay_glArrayElement(struct trace_reader *reader) {
+    if (!__glArrayElement) {
+        trace_missing(reader, TRACE_glArrayElement);
+        return;
+    }
+    GLint i = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glArrayElement(i);
+}
+
+static void APIENTRY trace_glColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+    trace_command(TRACE_glColorPointer);
+    trace_write_int(size);
+    trace_write_uint(type);
+    trace_write_int(stride);
+    trace_write_offset(pointer);
+    trace_real.glColorPointer(size, type, stride, pointer);
+}
+
+static void trace_replay_glColorPointer(struct trace_reader *reader) {
+    if (!__glColorPointer) {
+        trace_missing(reader, TRACE_glColorPointer);
+        return;
+    }
+    GLint size = (GLint)trace_read_int(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLsizei stride = (GLsizei)trace_read_int(reader);
+    const void *pointer = trace_read_offset(reader);
+    if (reader->error)
+        return;
+    __glColorPointer(size, type, stride, pointer);
+}
+
+static void APIENTRY trace_glDisableClientState(GLenum array) {
+    trace_command(TRACE_glDisableClientState);
+    trace_write_uint(array);
+    trace_real.glDisableClientState(array);
+}
+
+static void trace_replay_glDisableClientState(struct trace_reader *reader) {
+    if (!__glDisableClientState) {
+        trace_missing(reader, TRACE_glDisableClientState);
+        return;
+    }
+    GLenum array = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glDisableClientState(array);
+}
+
+static void APIENTRY trace_glEdgeFlagPointer(GLsizei stride, const void *pointer) {
+    trace_command(TRACE_glEdgeFlagPointer);
+    trace_write_int(stride);
+    trace_write_offset(pointer);
+    trace_real.glEdgeFlagPointer(stride, pointer);
+}
+
+static void trace_replay_glEdgeFlagPointer(struct trace_reader *reader) {
+    if (!__glEdgeFlagPointer) {
+        trace_missing(reader, TRACE_glEdgeFlagPointer);
+        return;
+    }
+    GLsizei stride = (GLsizei)trace_read_int(reader);
+    const void *pointer = trace_read_offset(reader);
+    if (reader->error)
+        return;
+    __glEdgeFlagPointer(stride, pointer);
+}
+
+static void APIENTRY trace_glEnableClientState(GLenum array) {
+    trace_command(TRACE_glEnableClientState);
+    trace_write_uint(array);
+    trace_real.glEnableClientState(array);
+}
+
+static void trace_replay_glEnableClientState(struct trace_reader *reader) {
+    if (!__glEnableClientState) {
+        trace_missing(reader, TRACE_glEnableClientState);
+        return;
+    }
+    GLenum array = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glEnableClientState(array);
+}
+
+static void APIENTRY trace_glIndexPointer(GLenum type, GLsizei stride, const void *pointer) {
+    trace_command(TRACE_glIndexPointer);
+    trace_write_uint(type);
+    trace_write_int(stride);
+    trace_write_offset(pointer);
+    trace_real.glIndexPointer(type, stride, pointer);
+}
+
+static void trace_replay_glIndexPointer(struct trace_reader *reader) {
+    if (!__glIndexPointer) {
+        trace_missing(reader, TRACE_glIndexPointer);
+        return;
+    }
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLsizei stride = (GLsizei)trace_read_int(reader);
+    const void *pointer = trace_read_offset(reader);
+    if (reader->error)
+        return;
+    __glIndexPointer(type, stride, pointer);
+}
+
+static void APIENTRY trace_glInterleavedArrays(GLenum format, GLsizei stride, const void *pointer) {
+    trace_command(TRACE_glInterleavedArrays);
+    trace_write_uint(format);
+    trace_write_int(stride);
+    trace_write_offset(pointer);
+    trace_real.glInterleavedArrays(format, stride, pointer);
+}
+
+static void trace_replay_glInterleavedArrays(struct trace_reader *reader) {
+    if (!__glInterleavedArrays) {
+        trace_missing(reader, TRACE_glInterleavedArrays);
+        return;
+    }
+    GLenum format = (GLenum)trace_read_uint(reader);
+    GLsizei stride = (GLsizei)trace_read_int(reader);
+    const void *pointer = trace_read_offset(reader);
+    if (reader->error)
+        return;
+    __glInterleavedArrays(format, stride, pointer);
+}
+
+static void APIENTRY trace_glNormalPointer(GLenum type, GLsizei stride, const void *pointer) {
+    trace_command(TRACE_glNormalPointer);
+    trace_write_uint(type);
+    trace_write_int(stride);
+    trace_write_offset(pointer);
+    trace_real.glNormalPointer(type, stride, pointer);
+}
+
+static void trace_replay_glNormalPointer(struct trace_reader *reader) {
+    if (!__glNormalPointer) {
+        trace_missing(reader, TRACE_glNormalPointer);
+        return;
+    }
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLsizei stride = (GLsizei)trace_read_int(reader);
+    const void *pointer = trace_read_offset(reader);
+    if (reader->error)
+        return;
+    __glNormalPointer(type, stride, pointer);
+}
+
+static void APIENTRY trace_glTexCoordPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+    trace_command(TRACE_glTexCoordPointer);
+    trace_write_int(size);
+    trace_write_uint(type);
+    trace_write_int(stride);
+    trace_write_offset(pointer);
+    trace_real.glTexCoordPointer(size, type, stride, pointer);
+}
+
+static void trace_replay_glTexCoordPointer(struct trace_reader *reader) {
+    if (!__glTexCoordPointer) {
+        trace_missing(reader, TRACE_glTexCoordPointer);
+        return;
+    }
+    GLint size = (GLint)trace_read_int(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLsizei stride = (GLsizei)trace_read_int(reader);
+    const void *pointer = trace_read_offset(reader);
+    if (reader->error)
+        return;
+    __glTexCoordPointer(size, type, stride, pointer);
+}
+
+static void APIENTRY trace_glVertexPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+    trace_command(TRACE_glVertexPointer);
+    trace_write_int(size);
+    trace_write_uint(type);
+    trace_write_int(stride);
+    trace_write_offset(pointer);
+    trace_real.glVertexPointer(size, type, stride, pointer);
+}
+
+static void trace_replay_glVertexPointer(struct trace_reader *reader) {
+    if (!__glVertexPointer) {
+        trace_missing(reader, TRACE_glVertexPointer);
+        return;
+    }
+    GLint size = (GLint)trace_read_int(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLsizei stride = (GLsizei)trace_read_int(reader);
+    const void *pointer = trace_read_offset(reader);
+    if (reader->error)
+        return;
+    __glVertexPointer(size, type, stride, pointer);
+}
+
+static void APIENTRY trace_glPrioritizeTextures(GLsizei n, const GLuint *textures, const GLfloat *priorities) {
+    trace_command(TRACE_glPrioritizeTextures);
+    trace_write_int(n);
+    trace_write_array(textures, (size_t)(n), sizeof(GLuint));
+    trace_write_array(priorities, (size_t)(n), sizeof(GLfloat));
+    trace_real.glPrioritizeTextures(n, textures, priorities);
+}
+
+static void trace_replay_glPrioritizeTextures(struct trace_reader *reader) {
+    if (!__glPrioritizeTextures) {
+        trace_missing(reader, TRACE_glPrioritizeTextures);
+        return;
+    }
+    GLsizei n = (GLsizei)trace_read_int(reader);
+    const GLuint *textures = trace_read_names(reader, TRACE_NAME_TEXTURE);
+    const GLfloat *priorities = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glPrioritizeTextures(n, textures, priorities);
+}
+
+static void APIENTRY trace_glIndexub(GLubyte c) {
+    trace_command(TRACE_glIndexub);
+    trace_write_uint(c);
+    trace_real.glIndexub(c);
+}
+
+static void trace_replay_glIndexub(struct trace_reader *reader) {
+    if (!__glIndexub) {
+        trace_missing(reader, TRACE_glIndexub);
+        return;
+    }
+    GLubyte c = (GLubyte)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glIndexub(c);
+}
+
+static void APIENTRY trace_glIndexubv(const GLubyte *c) {
+    trace_command(TRACE_glIndexubv);
+    trace_write_array(c, (size_t)(1), sizeof(GLubyte));
+    trace_real.glIndexubv(c);
+}
+
+static void trace_replay_glIndexubv(struct trace_reader *reader) {
+    if (!__glIndexubv) {
+        trace_missing(reader, TRACE_glIndexubv);
+        return;
+    }
+    const GLubyte *c = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glIndexubv(c);
+}
+
+static void APIENTRY trace_glPopClientAttrib(void) {
+    trace_command(TRACE_glPopClientAttrib);
+    trace_real.glPopClientAttrib();
+}
+
+static void trace_replay_glPopClientAttrib(struct trace_reader *reader) {
+    if (!__glPopClientAttrib) {
+        trace_missing(reader, TRACE_glPopClientAttrib);
+        return;
+    }
+    if (reader->error)
+        return;
+    __glPopClientAttrib();
+}
+
+static void APIENTRY trace_glPushClientAttrib(GLbitfield mask) {
+    trace_command(TRACE_glPushClientAttrib);
+    trace_write_uint(mask);
+    trace_real.glPushClientAttrib(mask);
+}
+
+static void trace_replay_glPushClientAttrib(struct trace_reader *reader) {
+    if (!__glPushClientAttrib) {
+        trace_missing(reader, TRACE_glPushClientAttrib);
+        return;
+    }
+    GLbitfield mask = (GLbitfield)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glPushClientAttrib(mask);
+}
+
+#endif
+
+#if FUNGL_VERSION >= GL_VERSION_1_2
+static void APIENTRY trace_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) {
+    trace_command(TRACE_glDrawRangeElements);
+    trace_write_uint(mode);
+    trace_write_uint(start);
+    trace_write_uint(end);
+    trace_write_int(count);
+    trace_write_uint(type);
+    trace_write_offset(indices);
+    trace_real.glDrawRangeElements(mode, start, end, count, type, indices);
+}
+
+static void trace_replay_glDrawRangeElements(struct trace_reader *reader) {
+    if (!__glDrawRangeElements) {
+        trace_missing(reader, TRACE_glDrawRangeElements);
+        return;
+    }
+    GLenum mode = (GLenum)trace_read_uint(reader);
+    GLuint start = (GLuint)trace_read_uint(reader);
+    GLuint end = (GLuint)trace_read_uint(reader);
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const void *indices = trace_read_offset(reader);
+    if (reader->error)
+        return;
+    __glDrawRangeElements(mode, start, end, count, type, indices);
+}
+
+static void APIENTRY trace_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+    trace_command(TRACE_glTexImage3D);
+    trace_write_uint(target);
+    trace_write_int(level);
+    trace_write_int(internalformat);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_write_int(depth);
+    trace_write_int(border);
+    trace_write_uint(format);
+    trace_write_uint(type);
+    trace_write_unpack(pixels, trace_pixels_span(format, type, width, height, depth, false));
+    trace_real.glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+
+static void trace_replay_glTexImage3D(struct trace_reader *reader) {
+    if (!__glTexImage3D) {
+        trace_missing(reader, TRACE_glTexImage3D);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLint level = (GLint)trace_read_int(reader);
+    GLint internalformat = (GLint)trace_read_int(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    GLsizei depth = (GLsizei)trace_read_int(reader);
+    GLint border = (GLint)trace_read_int(reader);
+    GLenum format = (GLenum)trace_read_uint(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const void *pixels = trace_read_unpack(reader);
+    if (reader->error)
+        return;
+    __glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+
+static void APIENTRY trace_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+    trace_command(TRACE_glTexSubImage3D);
+    trace_write_uint(target);
+    trace_write_int(level);
+    trace_write_int(xoffset);
+    trace_write_int(yoffset);
+    trace_write_int(zoffset);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_write_int(depth);
+    trace_write_uint(format);
+    trace_write_uint(type);
+    trace_write_unpack(pixels, trace_pixels_span(format, type, width, height, depth, false));
+    trace_real.glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+
+static void trace_replay_glTexSubImage3D(struct trace_reader *reader) {
+    if (!__glTexSubImage3D) {
+        trace_missing(reader, TRACE_glTexSubImage3D);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLint level = (GLint)trace_read_int(reader);
+    GLint xoffset = (GLint)trace_read_int(reader);
+    GLint yoffset = (GLint)trace_read_int(reader);
+    GLint zoffset = (GLint)trace_read_int(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    GLsizei depth = (GLsizei)trace_read_int(reader);
+    GLenum format = (GLenum)trace_read_uint(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const void *pixels = trace_read_unpack(reader);
+    if (reader->error)
+        return;
+    __glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+
+static void APIENTRY trace_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    trace_command(TRACE_glCopyTexSubImage3D);
+    trace_write_uint(target);
+    trace_write_int(level);
+    trace_write_int(xoffset);
+    trace_write_int(yoffset);
+    trace_write_int(zoffset);
+    trace_write_int(x);
+    trace_write_int(y);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_real.glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+
+static void trace_replay_glCopyTexSubImage3D(struct trace_reader *reader) {
+    if (!__glCopyTexSubImage3D) {
+        trace_missing(reader, TRACE_glCopyTexSubImage3D);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLint level = (GLint)trace_read_int(reader);
+    GLint xoffset = (GLint)trace_read_int(reader);
+    GLint yoffset = (GLint)trace_read_int(reader);
+    GLint zoffset = (GLint)trace_read_int(reader);
+    GLint x = (GLint)trace_read_int(reader);
+    GLint y = (GLint)trace_read_int(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+
+#endif
+
+#if FUNGL_VERSION >= GL_VERSION_1_3
+static void APIENTRY trace_glActiveTexture(GLenum texture) {
+    trace_command(TRACE_glActiveTexture);
+    trace_write_uint(texture);
+    trace_real.glActiveTexture(texture);
+}
+
+static void trace_replay_glActiveTexture(struct trace_reader *reader) {
+    if (!__glActiveTexture) {
+        trace_missing(reader, TRACE_glActiveTexture);
+        return;
+    }
+    GLenum texture = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glActiveTexture(texture);
+}
+
+static void APIENTRY trace_glSampleCoverage(GLfloat value, GLboolean invert) {
+    trace_command(TRACE_glSampleCoverage);
+    trace_write_float(value);
+    trace_write_uint(invert);
+    trace_real.glSampleCoverage(value, invert);
+}
+
+static void trace_replay_glSampleCoverage(struct trace_reader *reader) {
+    if (!__glSampleCoverage) {
+        trace_missing(reader, TRACE_glSampleCoverage);
+        return;
+    }
+    GLfloat value = trace_read_float(reader);
+    GLboolean invert = (GLboolean)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glSampleCoverage(value, invert);
+}
+
+static void APIENTRY trace_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) {
+    trace_command(TRACE_glCompressedTexImage3D);
+    trace_write_uint(target);
+    trace_write_int(level);
+    trace_write_uint(internalformat);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_write_int(depth);
+    trace_write_int(border);
+    trace_write_int(imageSize);
+    trace_write_unpack(data, (size_t)imageSize);
+    trace_real.glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+
+static void trace_replay_glCompressedTexImage3D(struct trace_reader *reader) {
+    if (!__glCompressedTexImage3D) {
+        trace_missing(reader, TRACE_glCompressedTexImage3D);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLint level = (GLint)trace_read_int(reader);
+    GLenum internalformat = (GLenum)trace_read_uint(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    GLsizei depth = (GLsizei)trace_read_int(reader);
+    GLint border = (GLint)trace_read_int(reader);
+    GLsizei imageSize = (GLsizei)trace_read_int(reader);
+    const void *data = trace_read_unpack(reader);
+    if (reader->error)
+        return;
+    __glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+
+static void APIENTRY trace_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) {
+    trace_command(TRACE_glCompressedTexImage2D);
+    trace_write_uint(target);
+    trace_write_int(level);
+    trace_write_uint(internalformat);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_write_int(border);
+    trace_write_int(imageSize);
+    trace_write_unpack(data, (size_t)imageSize);
+    trace_real.glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+}
+
+static void trace_replay_glCompressedTexImage2D(struct trace_reader *reader) {
+    if (!__glCompressedTexImage2D) {
+        trace_missing(reader, TRACE_glCompressedTexImage2D);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLint level = (GLint)trace_read_int(reader);
+    GLenum internalformat = (GLenum)trace_read_uint(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    GLint border = (GLint)trace_read_int(reader);
+    GLsizei imageSize = (GLsizei)trace_read_int(reader);
+    const void *data = trace_read_unpack(reader);
+    if (reader->error)
+        return;
+    __glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+}
+
+static void APIENTRY trace_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) {
+    trace_command(TRACE_glCompressedTexImage1D);
+    trace_write_uint(target);
+    trace_write_int(level);
+    trace_write_uint(internalformat);
+    trace_write_int(width);
+    trace_write_int(border);
+    trace_write_int(imageSize);
+    trace_write_unpack(data, (size_t)imageSize);
+    trace_real.glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+}
+
+static void trace_replay_glCompressedTexImage1D(struct trace_reader *reader) {
+    if (!__glCompressedTexImage1D) {
+        trace_missing(reader, TRACE_glCompressedTexImage1D);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLint level = (GLint)trace_read_int(reader);
+    GLenum internalformat = (GLenum)trace_read_uint(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLint border = (GLint)trace_read_int(reader);
+    GLsizei imageSize = (GLsizei)trace_read_int(reader);
+    const void *data = trace_read_unpack(reader);
+    if (reader->error)
+        return;
+    __glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+}
+
+static void APIENTRY trace_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+    trace_command(TRACE_glCompressedTexSubImage3D);
+    trace_write_uint(target);
+    trace_write_int(level);
+    trace_write_int(xoffset);
+    trace_write_int(yoffset);
+    trace_write_int(zoffset);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_write_int(depth);
+    trace_write_uint(format);
+    trace_write_int(imageSize);
+    trace_write_unpack(data, (size_t)imageSize);
+    trace_real.glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+
+static void trace_replay_glCompressedTexSubImage3D(struct trace_reader *reader) {
+    if (!__glCompressedTexSubImage3D) {
+        trace_missing(reader, TRACE_glCompressedTexSubImage3D);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLint level = (GLint)trace_read_int(reader);
+    GLint xoffset = (GLint)trace_read_int(reader);
+    GLint yoffset = (GLint)trace_read_int(reader);
+    GLint zoffset = (GLint)trace_read_int(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    GLsizei depth = (GLsizei)trace_read_int(reader);
+    GLenum format = (GLenum)trace_read_uint(reader);
+    GLsizei imageSize = (GLsizei)trace_read_int(reader);
+    const void *data = trace_read_unpack(reader);
+    if (reader->error)
+        return;
+    __glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+
+static void APIENTRY trace_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+    trace_command(TRACE_glCompressedTexSubImage2D);
+    trace_write_uint(target);
+    trace_write_int(level);
+    trace_write_int(xoffset);
+    trace_write_int(yoffset);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_write_uint(format);
+    trace_write_int(imageSize);
+    trace_write_unpack(data, (size_t)imageSize);
+    trace_real.glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+
+static void trace_replay_glCompressedTexSubImage2D(struct trace_reader *reader) {
+    if (!__glCompressedTexSubImage2D) {
+        trace_missing(reader, TRACE_glCompressedTexSubImage2D);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLint level = (GLint)trace_read_int(reader);
+    GLint xoffset = (GLint)trace_read_int(reader);
+    GLint yoffset = (GLint)trace_read_int(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    GLenum format = (GLenum)trace_read_uint(reader);
+    GLsizei imageSize = (GLsizei)trace_read_int(reader);
+    const void *data = trace_read_unpack(reader);
+    if (reader->error)
+        return;
+    __glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+
+static void APIENTRY trace_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+    trace_command(TRACE_glCompressedTexSubImage1D);
+    trace_write_uint(target);
+    trace_write_int(level);
+    trace_write_int(xoffset);
+    trace_write_int(width);
+    trace_write_uint(format);
+    trace_write_int(imageSize);
+    trace_write_unpack(data, (size_t)imageSize);
+    trace_real.glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+}
+
+static void trace_replay_glCompressedTexSubImage1D(struct trace_reader *reader) {
+    if (!__glCompressedTexSubImage1D) {
+        trace_missing(reader, TRACE_glCompressedTexSubImage1D);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLint level = (GLint)trace_read_int(reader);
+    GLint xoffset = (GLint)trace_read_int(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLenum format = (GLenum)trace_read_uint(reader);
+    GLsizei imageSize = (GLsizei)trace_read_int(reader);
+    const void *data = trace_read_unpack(reader);
+    if (reader->error)
+        return;
+    __glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+}
+
+static void APIENTRY trace_glClientActiveTexture(GLenum texture) {
+    trace_command(TRACE_glClientActiveTexture);
+    trace_write_uint(texture);
+    trace_real.glClientActiveTexture(texture);
+}
+
+static void trace_replay_glClientActiveTexture(struct trace_reader *reader) {
+    if (!__glClientActiveTexture) {
+        trace_missing(reader, TRACE_glClientActiveTexture);
+        return;
+    }
+    GLenum texture = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glClientActiveTexture(texture);
+}
+
+static void APIENTRY trace_glMultiTexCoord1d(GLenum target, GLdouble s) {
+    trace_command(TRACE_glMultiTexCoord1d);
+    trace_write_uint(target);
+    trace_write_double(s);
+    trace_real.glMultiTexCoord1d(target, s);
+}
+
+static void trace_replay_glMultiTexCoord1d(struct trace_reader *reader) {
+    if (!__glMultiTexCoord1d) {
+        trace_missing(reader, TRACE_glMultiTexCoord1d);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLdouble s = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glMultiTexCoord1d(target, s);
+}
+
+static void APIENTRY trace_glMultiTexCoord1dv(GLenum target, const GLdouble *v) {
+    trace_command(TRACE_glMultiTexCoord1dv);
+    trace_write_uint(target);
+    trace_write_array(v, (size_t)(1), sizeof(GLdouble));
+    trace_real.glMultiTexCoord1dv(target, v);
+}
+
+static void trace_replay_glMultiTexCoord1dv(struct trace_reader *reader) {
+    if (!__glMultiTexCoord1dv) {
+        trace_missing(reader, TRACE_glMultiTexCoord1dv);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    const GLdouble *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glMultiTexCoord1dv(target, v);
+}
+
+static void APIENTRY trace_glMultiTexCoord1f(GLenum target, GLfloat s) {
+    trace_command(TRACE_glMultiTexCoord1f);
+    trace_write_uint(target);
+    trace_write_float(s);
+    trace_real.glMultiTexCoord1f(target, s);
+}
+
+static void trace_replay_glMultiTexCoord1f(struct trace_reader *reader) {
+    if (!__glMultiTexCoord1f) {
+        trace_missing(reader, TRACE_glMultiTexCoord1f);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLfloat s = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glMultiTexCoord1f(target, s);
+}
+
+static void APIENTRY trace_glMultiTexCoord1fv(GLenum target, const GLfloat *v) {
+    trace_command(TRACE_glMultiTexCoord1fv);
+    trace_write_uint(target);
+    trace_write_array(v, (size_t)(1), sizeof(GLfloat));
+    trace_real.glMultiTexCoord1fv(target, v);
+}
+
+static void trace_replay_glMultiTexCoord1fv(struct trace_reader *reader) {
+    if (!__glMultiTexCoord1fv) {
+        trace_missing(reader, TRACE_glMultiTexCoord1fv);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    const GLfloat *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glMultiTexCoord1fv(target, v);
+}
+
+static void APIENTRY trace_glMultiTexCoord1i(GLenum target, GLint s) {
+    trace_command(TRACE_glMultiTexCoord1i);
+    trace_write_uint(target);
+    trace_write_int(s);
+    trace_real.glMultiTexCoord1i(target, s);
+}
+
+static void trace_replay_glMultiTexCoord1i(struct trace_reader *reader) {
+    if (!__glMultiTexCoord1i) {
+        trace_missing(reader, TRACE_glMultiTexCoord1i);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLint s = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glMultiTexCoord1i(target, s);
+}
+
+static void APIENTRY trace_glMultiTexCoord1iv(GLenum target, const GLint *v) {
+    trace_command(TRACE_glMultiTexCoord1iv);
+    trace_write_uint(target);
+    trace_write_array(v, (size_t)(1), sizeof(GLint));
+    trace_real.glMultiTexCoord1iv(target, v);
+}
+
+static void trace_replay_glMultiTexCoord1iv(struct trace_reader *reader) {
+    if (!__glMultiTexCoord1iv) {
+        trace_missing(reader, TRACE_glMultiTexCoord1iv);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    const GLint *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glMultiTexCoord1iv(target, v);
+}
+
+static void APIENTRY trace_glMultiTexCoord1s(GLenum target, GLshort s) {
+    trace_command(TRACE_glMultiTexCoord1s);
+    trace_write_uint(target);
+    trace_write_int(s);
+    trace_real.glMultiTexCoord1s(target, s);
+}
+
+static void trace_replay_glMultiTexCoord1s(struct trace_reader *reader) {
+    if (!__glMultiTexCoord1s) {
+        trace_missing(reader, TRACE_glMultiTexCoord1s);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLshort s = (GLshort)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glMultiTexCoord1s(target, s);
+}
+
+static void APIENTRY trace_glMultiTexCoord1sv(GLenum target, const GLshort *v) {
+    trace_command(TRACE_glMultiTexCoord1sv);
+    trace_write_uint(target);
+    trace_write_array(v, (size_t)(1), sizeof(GLshort));
+    trace_real.glMultiTexCoord1sv(target, v);
+}
+
+static void trace_replay_glMultiTexCoord1sv(struct trace_reader *reader) {
+    if (!__glMultiTexCoord1sv) {
+        trace_missing(reader, TRACE_glMultiTexCoord1sv);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    const GLshort *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glMultiTexCoord1sv(target, v);
+}
+
+static void APIENTRY trace_glMultiTexCoord2d(GLenum target, GLdouble s, GLdouble t) {
+    trace_command(TRACE_glMultiTexCoord2d);
+    trace_write_uint(target);
+    trace_write_double(s);
+    trace_write_double(t);
+    trace_real.glMultiTexCoord2d(target, s, t);
+}
+
+static void trace_replay_glMultiTexCoord2d(struct trace_reader *reader) {
+    if (!__glMultiTexCoord2d) {
+        trace_missing(reader, TRACE_glMultiTexCoord2d);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLdouble s = trace_read_double(reader);
+    GLdouble t = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glMultiTexCoord2d(target, s, t);
+}
+
+static void APIENTRY trace_glMultiTexCoord2dv(GLenum target, const GLdouble *v) {
+    trace_command(TRACE_glMultiTexCoord2dv);
+    trace_write_uint(target);
+    trace_write_array(v, (size_t)(2), sizeof(GLdouble));
+    trace_real.glMultiTexCoord2dv(target, v);
+}
+
+static void trace_replay_glMultiTexCoord2dv(struct trace_reader *reader) {
+    if (!__glMultiTexCoord2dv) {
+        trace_missing(reader, TRACE_glMultiTexCoord2dv);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    const GLdouble *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glMultiTexCoord2dv(target, v);
+}
+
+static void APIENTRY trace_glMultiTexCoord2f(GLenum target, GLfloat s, GLfloat t) {
+    trace_command(TRACE_glMultiTexCoord2f);
+    trace_write_uint(target);
+    trace_write_float(s);
+    trace_write_float(t);
+    trace_real.glMultiTexCoord2f(target, s, t);
+}
+
+static void trace_replay_glMultiTexCoord2f(struct trace_reader *reader) {
+    if (!__glMultiTexCoord2f) {
+        trace_missing(reader, TRACE_glMultiTexCoord2f);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLfloat s = trace_read_float(reader);
+    GLfloat t = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glMultiTexCoord2f(target, s, t);
+}
+
+static void APIENTRY trace_glMultiTexCoord2fv(GLenum target, const GLfloat *v) {
+    trace_command(TRACE_glMultiTexCoord2fv);
+    trace_write_uint(target);
+    trace_write_array(v, (size_t)(2), sizeof(GLfloat));
+    trace_real.glMultiTexCoord2fv(target, v);
+}
+
+static void trace_replay_glMultiTexCoord2fv(struct trace_reader *reader) {
+    if (!__glMultiTexCoord2fv) {
+        trace_missing(reader, TRACE_glMultiTexCoord2fv);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    const GLfloat *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glMultiTexCoord2fv(target, v);
+}
+
+static void APIENTRY trace_glMultiTexCoord2i(GLenum target, GLint s, GLint t) {
+    trace_command(TRACE_glMultiTexCoord2i);
+    trace_write_uint(target);
+    trace_write_int(s);
+    trace_write_int(t);
+    trace_real.glMultiTexCoord2i(target, s, t);
+}
+
+static void trace_replay_glMultiTexCoord2i(struct trace_reader *reader) {
+    if (!__glMultiTexCoord2i) {
+        trace_missing(reader, TRACE_glMultiTexCoord2i);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLint s = (GLint)trace_read_int(reader);
+    GLint t = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glMultiTexCoord2i(target, s, t);
+}
+
+static void APIENTRY trace_glMultiTexCoord2iv(GLenum target, const GLint *v) {
+    trace_command(TRACE_glMultiTexCoord2iv);
+    trace_write_uint(target);
+    trace_write_array(v, (size_t)(2), sizeof(GLint));
+    trace_real.glMultiTexCoord2iv(target, v);
+}
+
+static void trace_replay_glMultiTexCoord2iv(struct trace_reader *reader) {
+    if (!__glMultiTexCoord2iv) {
+        trace_missing(reader, TRACE_glMultiTexCoord2iv);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    const GLint *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glMultiTexCoord2iv(target, v);
+}
+
+static void APIENTRY trace_glMultiTexCoord2s(GLenum target, GLshort s, GLshort t) {
+    trace_command(TRACE_glMultiTexCoord2s);
+    trace_write_uint(target);
+    trace_write_int(s);
+    trace_write_int(t);
+    trace_real.glMultiTexCoord2s(target, s, t);
+}
+
+static void trace_replay_glMultiTexCoord2s(struct trace_reader *reader) {
+    if (!__glMultiTexCoord2s) {
+        trace_missing(reader, TRACE_glMultiTexCoord2s);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLshort s = (GLshort)trace_read_int(reader);
+    GLshort t = (GLshort)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glMultiTexCoord2s(target, s, t);
+}
+
+static void APIENTRY trace_glMultiTexCoord2sv(GLenum target, const GLshort *v) {
+    trace_command(TRACE_glMultiTexCoord2sv);
+    trace_write_uint(target);
+    trace_write_array(v, (size_t)(2), sizeof(GLshort));
+    trace_real.glMultiTexCoord2sv(target, v);
+}
+
+static void trace_replay_glMultiTexCoord2sv(struct trace_reader *reader) {
+    if (!__glMultiTexCoord2sv) {
+        trace_missing(reader, TRACE_glMultiTexCoord2sv);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    const GLshort *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glMultiTexCoord2sv(target, v);
+}
+
+static void APIENTRY trace_glMultiTexCoord3d(GLenum target, GLdouble s, GLdouble t, GLdouble r) {
+    trace_command(TRACE_glMultiTexCoord3d);
+    trace_write_uint(target);
+    trace_write_double(s);
+    trace_write_double(t);
+    trace_write_double(r);
+    trace_real.glMultiTexCoord3d(target, s, t, r);
+}
+
+static void trace_replay_glMultiTexCoord3d(struct trace_reader *reader) {
+    if (!__glMultiTexCoord3d) {
+        trace_missing(reader, TRACE_glMultiTexCoord3d);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLdouble s = trace_read_double(reader);
+    GLdouble t = trace_read_double(reader);
+    GLdouble r = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glMultiTexCoord3d(target, s, t, r);
+}
+
+static void APIENTRY trace_glMultiTexCoord3dv(GLenum target, const GLdouble *v) {
+    trace_command(TRACE_glMultiTexCoord3dv);
+    trace_write_uint(target);
+    trace_write_array(v, (size_t)(3), sizeof(GLdouble));
+    trace_real.glMultiTexCoord3dv(target, v);
+}
+
+static void trace_replay_glMultiTexCoord3dv(struct trace_reader *reader) {
+    if (!__glMultiTexCoord3dv) {
+        trace_missing(reader, TRACE_glMultiTexCoord3dv);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    const GLdouble *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glMultiTexCoord3dv(target, v);
+}
+
+static void APIENTRY trace_glMultiTexCoord3f(GLenum target, GLfloat s, GLfloat t, GLfloat r) {
+    trace_command(TRACE_glMultiTexCoord3f);
+    trace_write_uint(target);
+    trace_write_float(s);
+    trace_write_float(t);
+    trace_write_float(r);
+    trace_real.glMultiTexCoord3f(target, s, t, r);
+}
+
+static void trace_replay_glMultiTexCoord3f(struct trace_reader *reader) {
+    if (!__glMultiTexCoord3f) {
+        trace_missing(reader, TRACE_glMultiTexCoord3f);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLfloat s = trace_read_float(reader);
+    GLfloat t = trace_read_float(reader);
+    GLfloat r = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glMultiTexCoord3f(target, s, t, r);
+}
+
+static void APIENTRY trace_glMultiTexCoord3fv(GLenum target, const GLfloat *v) {
+    trace_command(TRACE_glMultiTexCoord3fv);
+    trace_write_uint(target);
+    trace_write_array(v, (size_t)(3), sizeof(GLfloat));
+    trace_real.glMultiTexCoord3fv(target, v);
+}
+
+static void trace_replay_glMultiTexCoord3fv(struct trace_reader *reader) {
+    if (!__glMultiTexCoord3fv) {
+        trace_missing(reader, TRACE_glMultiTexCoord3fv);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    const GLfloat *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glMultiTexCoord3fv(target, v);
+}
+
+static void APIENTRY trace_glMultiTexCoord3i(GLenum target, GLint s, GLint t, GLint r) {
+    trace_command(TRACE_glMultiTexCoord3i);
+    trace_write_uint(target);
+    trace_write_int(s);
+    trace_write_int(t);
+    trace_write_int(r);
+    trace_real.glMultiTexCoord3i(target, s, t, r);
+}
+
+static void trace_replay_glMultiTexCoord3i(struct trace_reader *reader) {
+    if (!__glMultiTexCoord3i) {
+        trace_missing(reader, TRACE_glMultiTexCoord3i);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLint s = (GLint)trace_read_int(reader);
+    GLint t = (GLint)trace_read_int(reader);
+    GLint r = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glMultiTexCoord3i(target, s, t, r);
+}
+
+static void APIENTRY trace_glMultiTexCoord3iv(GLenum target, const GLint *v) {
+    trace_command(TRACE_glMultiTexCoord3iv);
+    trace_write_uint(target);
+    trace_write_array(v, (size_t)(3), sizeof(GLint));
+    trace_real.glMultiTexCoord3iv(target, v);
+}
+
+static void trace_replay_glMultiTexCoord3iv(struct trace_reader *reader) {
+    if (!__glMultiTexCoord3iv) {
+        trace_missing(reader, TRACE_glMultiTexCoord3iv);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    const GLint *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glMultiTexCoord3iv(target, v);
+}
+
+static void APIENTRY trace_glMultiTexCoord3s(GLenum target, GLshort s, GLshort t, GLshort r) {
+    trace_command(TRACE_glMultiTexCoord3s);
+    trace_write_uint(target);
+    trace_write_int(s);
+    trace_write_int(t);
+    trace_write_int(r);
+    trace_real.glMultiTexCoord3s(target, s, t, r);
+}
+
+static void trace_replay_glMultiTexCoord3s(struct trace_reader *reader) {
+    if (!__glMultiTexCoord3s) {
+        trace_missing(reader, TRACE_glMultiTexCoord3s);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLshort s = (GLshort)trace_read_int(reader);
+    GLshort t = (GLshort)trace_read_int(reader);
+    GLshort r = (GLshort)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glMultiTexCoord3s(target, s, t, r);
+}
+
+static void APIENTRY trace_glMultiTexCoord3sv(GLenum target, const GLshort *v) {
+    trace_command(TRACE_glMultiTexCoord3sv);
+    trace_write_uint(target);
+    trace_write_array(v, (size_t)(3), sizeof(GLshort));
+    trace_real.glMultiTexCoord3sv(target, v);
+}
+
+static void trace_replay_glMultiTexCoord3sv(struct trace_reader *reader) {
+    if (!__glMultiTexCoord3sv) {
+        trace_missing(reader, TRACE_glMultiTexCoord3sv);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    const GLshort *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glMultiTexCoord3sv(target, v);
+}
+
+static void APIENTRY trace_glMultiTexCoord4d(GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q) {
+    trace_command(TRACE_glMultiTexCoord4d);
+    trace_write_uint(target);
+    trace_write_double(s);
+    trace_write_double(t);
+    trace_write_double(r);
+    trace_write_double(q);
+    trace_real.glMultiTexCoord4d(target, s, t, r, q);
+}
+
+static void trace_replay_glMultiTexCoord4d(struct trace_reader *reader) {
+    if (!__glMultiTexCoord4d) {
+        trace_missing(reader, TRACE_glMultiTexCoord4d);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLdouble s = trace_read_double(reader);
+    GLdouble t = trace_read_double(reader);
+    GLdouble r = trace_read_double(reader);
+    GLdouble q = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glMultiTexCoord4d(target, s, t, r, q);
+}
+
+static void APIENTRY trace_glMultiTexCoord4dv(GLenum target, const GLdouble *v) {
+    trace_command(TRACE_glMultiTexCoord4dv);
+    trace_write_uint(target);
+    trace_write_array(v, (size_t)(4), sizeof(GLdouble));
+    trace_real.glMultiTexCoord4dv(target, v);
+}
+
+static void trace_replay_glMultiTexCoord4dv(struct trace_reader *reader) {
+    if (!__glMultiTexCoord4dv) {
+        trace_missing(reader, TRACE_glMultiTexCoord4dv);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    const GLdouble *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glMultiTexCoord4dv(target, v);
+}
+
+static void APIENTRY trace_glMultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q) {
+    trace_command(TRACE_glMultiTexCoord4f);
+    trace_write_uint(target);
+    trace_write_float(s);
+    trace_write_float(t);
+    trace_write_float(r);
+    trace_write_float(q);
+    trace_real.glMultiTexCoord4f(target, s, t, r, q);
+}
+
+static void trace_replay_glMultiTexCoord4f(struct trace_reader *reader) {
+    if (!__glMultiTexCoord4f) {
+        trace_missing(reader, TRACE_glMultiTexCoord4f);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLfloat s = trace_read_float(reader);
+    GLfloat t = trace_read_float(reader);
+    GLfloat r = trace_read_float(reader);
+    GLfloat q = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glMultiTexCoord4f(target, s, t, r, q);
+}
+
+static void APIENTRY trace_glMultiTexCoord4fv(GLenum target, const GLfloat *v) {
+    trace_command(TRACE_glMultiTexCoord4fv);
+    trace_write_uint(target);
+    trace_write_array(v, (size_t)(4), sizeof(GLfloat));
+    trace_real.glMultiTexCoord4fv(target, v);
+}
+
+static void trace_replay_glMultiTexCoord4fv(struct trace_reader *reader) {
+    if (!__glMultiTexCoord4fv) {
+        trace_missing(reader, TRACE_glMultiTexCoord4fv);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    const GLfloat *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glMultiTexCoord4fv(target, v);
+}
+
+static void APIENTRY trace_glMultiTexCoord4i(GLenum target, GLint s, GLint t, GLint r, GLint q) {
+    trace_command(TRACE_glMultiTexCoord4i);
+    trace_write_uint(target);
+    trace_write_int(s);
+    trace_write_int(t);
+    trace_write_int(r);
+    trace_write_int(q);
+    trace_real.glMultiTexCoord4i(target, s, t, r, q);
+}
+
+static void trace_replay_glMultiTexCoord4i(struct trace_reader *reader) {
+    if (!__glMultiTexCoord4i) {
+        trace_missing(reader, TRACE_glMultiTexCoord4i);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLint s = (GLint)trace_read_int(reader);
+    GLint t = (GLint)trace_read_int(reader);
+    GLint r = (GLint)trace_read_int(reader);
+    GLint q = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glMultiTexCoord4i(target, s, t, r, q);
+}
+
+static void APIENTRY trace_glMultiTexCoord4iv(GLenum target, const GLint *v) {
+    trace_command(TRACE_glMultiTexCoord4iv);
+    trace_write_uint(target);
+    trace_write_array(v, (size_t)(4), sizeof(GLint));
+    trace_real.glMultiTexCoord4iv(target, v);
+}
+
+static void trace_replay_glMultiTexCoord4iv(struct trace_reader *reader) {
+    if (!__glMultiTexCoord4iv) {
+        trace_missing(reader, TRACE_glMultiTexCoord4iv);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    const GLint *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glMultiTexCoord4iv(target, v);
+}
+
+static void APIENTRY trace_glMultiTexCoord4s(GLenum target, GLshort s, GLshort t, GLshort r, GLshort q) {
+    trace_command(TRACE_glMultiTexCoord4s);
+    trace_write_uint(target);
+    trace_write_int(s);
+    trace_write_int(t);
+    trace_write_int(r);
+    trace_write_int(q);
+    trace_real.glMultiTexCoord4s(target, s, t, r, q);
+}
+
+static void trace_replay_glMultiTexCoord4s(struct trace_reader *reader) {
+    if (!__glMultiTexCoord4s) {
+        trace_missing(reader, TRACE_glMultiTexCoord4s);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLshort s = (GLshort)trace_read_int(reader);
+    GLshort t = (GLshort)trace_read_int(reader);
+    GLshort r = (GLshort)trace_read_int(reader);
+    GLshort q = (GLshort)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glMultiTexCoord4s(target, s, t, r, q);
+}
+
+static void APIENTRY trace_glMultiTexCoord4sv(GLenum target, const GLshort *v) {
+    trace_command(TRACE_glMultiTexCoord4sv);
+    trace_write_uint(target);
+    trace_write_array(v, (size_t)(4), sizeof(GLshort));
+    trace_real.glMultiTexCoord4sv(target, v);
+}
+
+static void trace_replay_glMultiTexCoord4sv(struct trace_reader *reader) {
+    if (!__glMultiTexCoord4sv) {
+        trace_missing(reader, TRACE_glMultiTexCoord4sv);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    const GLshort *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glMultiTexCoord4sv(target, v);
+}
+
+static void APIENTRY trace_glLoadTransposeMatrixf(const GLfloat *m) {
+    trace_command(TRACE_glLoadTransposeMatrixf);
+    trace_write_array(m, (size_t)(16), sizeof(GLfloat));
+    trace_real.glLoadTransposeMatrixf(m);
+}
+
+static void trace_replay_glLoadTransposeMatrixf(struct trace_reader *reader) {
+    if (!__glLoadTransposeMatrixf) {
+        trace_missing(reader, TRACE_glLoadTransposeMatrixf);
+        return;
+    }
+    const GLfloat *m = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glLoadTransposeMatrixf(m);
+}
+
+static void APIENTRY trace_glLoadTransposeMatrixd(const GLdouble *m) {
+    trace_command(TRACE_glLoadTransposeMatrixd);
+    trace_write_array(m, (size_t)(16), sizeof(GLdouble));
+    trace_real.glLoadTransposeMatrixd(m);
+}
+
+static void trace_replay_glLoadTransposeMatrixd(struct trace_reader *reader) {
+    if (!__glLoadTransposeMatrixd) {
+        trace_missing(reader, TRACE_glLoadTransposeMatrixd);
+        return;
+    }
+    const GLdouble *m = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glLoadTransposeMatrixd(m);
+}
+
+static void APIENTRY trace_glMultTransposeMatrixf(const GLfloat *m) {
+    trace_command(TRACE_glMultTransposeMatrixf);
+    trace_write_array(m, (size_t)(16), sizeof(GLfloat));
+    trace_real.glMultTransposeMatrixf(m);
+}
+
+static void trace_replay_glMultTransposeMatrixf(struct trace_reader *reader) {
+    if (!__glMultTransposeMatrixf) {
+        trace_missing(reader, TRACE_glMultTransposeMatrixf);
+        return;
+    }
+    const GLfloat *m = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glMultTransposeMatrixf(m);
+}
+
+static void APIENTRY trace_glMultTransposeMatrixd(const GLdouble *m) {
+    trace_command(TRACE_glMultTransposeMatrixd);
+    trace_write_array(m, (size_t)(16), sizeof(GLdouble));
+    trace_real.glMultTransposeMatrixd(m);
+}
+
+static void trace_replay_glMultTransposeMatrixd(struct trace_reader *reader) {
+    if (!__glMultTransposeMatrixd) {
+        trace_missing(reader, TRACE_glMultTransposeMatrixd);
+        return;
+    }
+    const GLdouble *m = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glMultTransposeMatrixd(m);
+}
+
+#endif
+
+#if FUNGL_VERSION >= GL_VERSION_1_4
+static void APIENTRY trace_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+    trace_command(TRACE_glBlendFuncSeparate);
+    trace_write_uint(sfactorRGB);
+    trace_write_uint(dfactorRGB);
+    trace_write_uint(sfactorAlpha);
+    trace_write_uint(dfactorAlpha);
+    trace_real.glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+
+static void trace_replay_glBlendFuncSeparate(struct trace_reader *reader) {
+    if (!__glBlendFuncSeparate) {
+        trace_missing(reader, TRACE_glBlendFuncSeparate);
+        return;
+    }
+    GLenum sfactorRGB = (GLenum)trace_read_uint(reader);
+    GLenum dfactorRGB = (GLenum)trace_read_uint(reader);
+    GLenum sfactorAlpha = (GLenum)trace_read_uint(reader);
+    GLenum dfactorAlpha = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+
+static void APIENTRY trace_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) {
+    trace_command(TRACE_glMultiDrawArrays);
+    trace_write_uint(mode);
+    trace_write_array(first, (size_t)(drawcount), sizeof(GLint));
+    trace_write_array(count, (size_t)(drawcount), sizeof(GLsizei));
+    trace_write_int(drawcount);
+    trace_real.glMultiDrawArrays(mode, first, count, drawcount);
+}
+
+static void trace_replay_glMultiDrawArrays(struct trace_reader *reader) {
+    if (!__glMultiDrawArrays) {
+        trace_missing(reader, TRACE_glMultiDrawArrays);
+        return;
+    }
+    GLenum mode = (GLenum)trace_read_uint(reader);
+    const GLint *first = trace_read_array(reader);
+    const GLsizei *count = trace_read_array(reader);
+    GLsizei drawcount = (GLsizei)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glMultiDrawArrays(mode, first, count, drawcount);
+}
+
+static void APIENTRY trace_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) {
+    trace_command(TRACE_glMultiDrawElements);
+    trace_write_uint(mode);
+    trace_write_array(count, (size_t)(drawcount), sizeof(GLsizei));
+    trace_write_uint(type);
+    trace_write_offsets(indices, drawcount);
+    trace_write_int(drawcount);
+    trace_real.glMultiDrawElements(mode, count, type, indices, drawcount);
+}
+
+static void trace_replay_glMultiDrawElements(struct trace_reader *reader) {
+    if (!__glMultiDrawElements) {
+        trace_missing(reader, TRACE_glMultiDrawElements);
+        return;
+    }
+    GLenum mode = (GLenum)trace_read_uint(reader);
+    const GLsizei *count = trace_read_array(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const void *const*indices = trace_read_offsets(reader);
+    GLsizei drawcount = (GLsizei)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glMultiDrawElements(mode, count, type, indices, drawcount);
+}
+
+static void APIENTRY trace_glPointParameterf(GLenum pname, GLfloat param) {
+    trace_command(TRACE_glPointParameterf);
+    trace_write_uint(pname);
+    trace_write_float(param);
+    trace_real.glPointParameterf(pname, param);
+}
+
+static void trace_replay_glPointParameterf(struct trace_reader *reader) {
+    if (!__glPointParameterf) {
+        trace_missing(reader, TRACE_glPointParameterf);
+        return;
+    }
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    GLfloat param = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glPointParameterf(pname, param);
+}
+
+static void APIENTRY trace_glPointParameterfv(GLenum pname, const GLfloat *params) {
+    trace_command(TRACE_glPointParameterfv);
+    trace_write_uint(pname);
+    trace_write_array(params, (size_t)(trace_pname_count(pname)), sizeof(GLfloat));
+    trace_real.glPointParameterfv(pname, params);
+}
+
+static void trace_replay_glPointParameterfv(struct trace_reader *reader) {
+    if (!__glPointParameterfv) {
+        trace_missing(reader, TRACE_glPointParameterfv);
+        return;
+    }
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    const GLfloat *params = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glPointParameterfv(pname, params);
+}
+
+static void APIENTRY trace_glPointParameteri(GLenum pname, GLint param) {
+    trace_command(TRACE_glPointParameteri);
+    trace_write_uint(pname);
+    trace_write_int(param);
+    trace_real.glPointParameteri(pname, param);
+}
+
+static void trace_replay_glPointParameteri(struct trace_reader *reader) {
+    if (!__glPointParameteri) {
+        trace_missing(reader, TRACE_glPointParameteri);
+        return;
+    }
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    GLint param = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glPointParameteri(pname, param);
+}
+
+static void APIENTRY trace_glPointParameteriv(GLenum pname, const GLint *params) {
+    trace_command(TRACE_glPointParameteriv);
+    trace_write_uint(pname);
+    trace_write_array(params, (size_t)(trace_pname_count(pname)), sizeof(GLint));
+    trace_real.glPointParameteriv(pname, params);
+}
+
+static void trace_replay_glPointParameteriv(struct trace_reader *reader) {
+    if (!__glPointParameteriv) {
+        trace_missing(reader, TRACE_glPointParameteriv);
+        return;
+    }
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    const GLint *params = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glPointParameteriv(pname, params);
+}
+
+static void APIENTRY trace_glFogCoordf(GLfloat coord) {
+    trace_command(TRACE_glFogCoordf);
+    trace_write_float(coord);
+    trace_real.glFogCoordf(coord);
+}
+
+static void trace_replay_glFogCoordf(struct trace_reader *reader) {
+    if (!__glFogCoordf) {
+        trace_missing(reader, TRACE_glFogCoordf);
+        return;
+    }
+    GLfloat coord = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glFogCoordf(coord);
+}
+
+static void APIENTRY trace_glFogCoordfv(const GLfloat *coord) {
+    trace_command(TRACE_glFogCoordfv);
+    trace_write_array(coord, (size_t)(1), sizeof(GLfloat));
+    trace_real.glFogCoordfv(coord);
+}
+
+static void trace_replay_glFogCoordfv(struct trace_reader *reader) {
+    if (!__glFogCoordfv) {
+        trace_missing(reader, TRACE_glFogCoordfv);
+        return;
+    }
+    const GLfloat *coord = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glFogCoordfv(coord);
+}
+
+static void APIENTRY trace_glFogCoordd(GLdouble coord) {
+    trace_command(TRACE_glFogCoordd);
+    trace_write_double(coord);
+    trace_real.glFogCoordd(coord);
+}
+
+static void trace_replay_glFogCoordd(struct trace_reader *reader) {
+    if (!__glFogCoordd) {
+        trace_missing(reader, TRACE_glFogCoordd);
+        return;
+    }
+    GLdouble coord = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glFogCoordd(coord);
+}
+
+static void APIENTRY trace_glFogCoorddv(const GLdouble *coord) {
+    trace_command(TRACE_glFogCoorddv);
+    trace_write_array(coord, (size_t)(1), sizeof(GLdouble));
+    trace_real.glFogCoorddv(coord);
+}
+
+static void trace_replay_glFogCoorddv(struct trace_reader *reader) {
+    if (!__glFogCoorddv) {
+        trace_missing(reader, TRACE_glFogCoorddv);
+        return;
+    }
+    const GLdouble *coord = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glFogCoorddv(coord);
+}
+
+static void APIENTRY trace_glFogCoordPointer(GLenum type, GLsizei stride, const void *pointer) {
+    trace_command(TRACE_glFogCoordPointer);
+    trace_write_uint(type);
+    trace_write_int(stride);
+    trace_write_offset(pointer);
+    trace_real.glFogCoordPointer(type, stride, pointer);
+}
+
+static void trace_replay_glFogCoordPointer(struct trace_reader *reader) {
+    if (!__glFogCoordPointer) {
+        trace_missing(reader, TRACE_glFogCoordPointer);
+        return;
+    }
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLsizei stride = (GLsizei)trace_read_int(reader);
+    const void *pointer = trace_read_offset(reader);
+    if (reader->error)
+        return;
+    __glFogCoordPointer(type, stride, pointer);
+}
+
+static void APIENTRY trace_glSecondaryColor3b(GLbyte red, GLbyte green, GLbyte blue) {
+    trace_command(TRACE_glSecondaryColor3b);
+    trace_write_int(red);
+    trace_write_int(green);
+    trace_write_int(blue);
+    trace_real.glSecondaryColor3b(red, green, blue);
+}
+
+static void trace_replay_glSecondaryColor3b(struct trace_reader *reader) {
+    if (!__glSecondaryColor3b) {
+        trace_missing(reader, TRACE_glSecondaryColor3b);
+        return;
+    }
+    GLbyte red = (GLbyte)trace_read_int(reader);
+    GLbyte green = (GLbyte)trace_read_int(reader);
+    GLbyte blue = (GLbyte)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glSecondaryColor3b(red, green, blue);
+}
+
+static void APIENTRY trace_glSecondaryColor3bv(const GLbyte *v) {
+    trace_command(TRACE_glSecondaryColor3bv);
+    trace_write_array(v, (size_t)(3), sizeof(GLbyte));
+    trace_real.glSecondaryColor3bv(v);
+}
+
+static void trace_replay_glSecondaryColor3bv(struct trace_reader *reader) {
+    if (!__glSecondaryColor3bv) {
+        trace_missing(reader, TRACE_glSecondaryColor3bv);
+        return;
+    }
+    const GLbyte *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glSecondaryColor3bv(v);
+}
+
+static void APIENTRY trace_glSecondaryColor3d(GLdouble red, GLdouble green, GLdouble blue) {
+    trace_command(TRACE_glSecondaryColor3d);
+    trace_write_double(red);
+    trace_write_double(green);
+    trace_write_double(blue);
+    trace_real.glSecondaryColor3d(red, green, blue);
+}
+
+static void trace_replay_glSecondaryColor3d(struct trace_reader *reader) {
+    if (!__glSecondaryColor3d) {
+        trace_missing(reader, TRACE_glSecondaryColor3d);
+        return;
+    }
+    GLdouble red = trace_read_double(reader);
+    GLdouble green = trace_read_double(reader);
+    GLdouble blue = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glSecondaryColor3d(red, green, blue);
+}
+
+static void APIENTRY trace_glSecondaryColor3dv(const GLdouble *v) {
+    trace_command(TRACE_glSecondaryColor3dv);
+    trace_write_array(v, (size_t)(3), sizeof(GLdouble));
+    trace_real.glSecondaryColor3dv(v);
+}
+
+static void trace_replay_glSecondaryColor3dv(struct trace_reader *reader) {
+    if (!__glSecondaryColor3dv) {
+        trace_missing(reader, TRACE_glSecondaryColor3dv);
+        return;
+    }
+    const GLdouble *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glSecondaryColor3dv(v);
+}
+
+static void APIENTRY trace_glSecondaryColor3f(GLfloat red, GLfloat green, GLfloat blue) {
+    trace_command(TRACE_glSecondaryColor3f);
+    trace_write_float(red);
+    trace_write_float(green);
+    trace_write_float(blue);
+    trace_real.glSecondaryColor3f(red, green, blue);
+}
+
+static void trace_replay_glSecondaryColor3f(struct trace_reader *reader) {
+    if (!__glSecondaryColor3f) {
+        trace_missing(reader, TRACE_glSecondaryColor3f);
+        return;
+    }
+    GLfloat red = trace_read_float(reader);
+    GLfloat green = trace_read_float(reader);
+    GLfloat blue = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glSecondaryColor3f(red, green, blue);
+}
+
+static void APIENTRY trace_glSecondaryColor3fv(const GLfloat *v) {
+    trace_command(TRACE_glSecondaryColor3fv);
+    trace_write_array(v, (size_t)(3), sizeof(GLfloat));
+    trace_real.glSecondaryColor3fv(v);
+}
+
+static void trace_replay_glSecondaryColor3fv(struct trace_reader *reader) {
+    if (!__glSecondaryColor3fv) {
+        trace_missing(reader, TRACE_glSecondaryColor3fv);
+        return;
+    }
+    const GLfloat *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glSecondaryColor3fv(v);
+}
+
+static void APIENTRY trace_glSecondaryColor3i(GLint red, GLint green, GLint blue) {
+    trace_command(TRACE_glSecondaryColor3i);
+    trace_write_int(red);
+    trace_write_int(green);
+    trace_write_int(blue);
+    trace_real.glSecondaryColor3i(red, green, blue);
+}
+
+static void trace_replay_glSecondaryColor3i(struct trace_reader *reader) {
+    if (!__glSecondaryColor3i) {
+        trace_missing(reader, TRACE_glSecondaryColor3i);
+        return;
+    }
+    GLint red = (GLint)trace_read_int(reader);
+    GLint green = (GLint)trace_read_int(reader);
+    GLint blue = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glSecondaryColor3i(red, green, blue);
+}
+
+static void APIENTRY trace_glSecondaryColor3iv(const GLint *v) {
+    trace_command(TRACE_glSecondaryColor3iv);
+    trace_write_array(v, (size_t)(3), sizeof(GLint));
+    trace_real.glSecondaryColor3iv(v);
+}
+
+static void trace_replay_glSecondaryColor3iv(struct trace_reader *reader) {
+    if (!__glSecondaryColor3iv) {
+        trace_missing(reader, TRACE_glSecondaryColor3iv);
+        return;
+    }
+    const GLint *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glSecondaryColor3iv(v);
+}
+
+static void APIENTRY trace_glSecondaryColor3s(GLshort red, GLshort green, GLshort blue) {
+    trace_command(TRACE_glSecondaryColor3s);
+    trace_write_int(red);
+    trace_write_int(green);
+    trace_write_int(blue);
+    trace_real.glSecondaryColor3s(red, green, blue);
+}
+
+static void trace_replay_glSecondaryColor3s(struct trace_reader *reader) {
+    if (!__glSecondaryColor3s) {
+        trace_missing(reader, TRACE_glSecondaryColor3s);
+        return;
+    }
+    GLshort red = (GLshort)trace_read_int(reader);
+    GLshort green = (GLshort)trace_read_int(reader);
+    GLshort blue = (GLshort)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glSecondaryColor3s(red, green, blue);
+}
+
+static void APIENTRY trace_glSecondaryColor3sv(const GLshort *v) {
+    trace_command(TRACE_glSecondaryColor3sv);
+    trace_write_array(v, (size_t)(3), sizeof(GLshort));
+    trace_real.glSecondaryColor3sv(v);
+}
+
+static void trace_replay_glSecondaryColor3sv(struct trace_reader *reader) {
+    if (!__glSecondaryColor3sv) {
+        trace_missing(reader, TRACE_glSecondaryColor3sv);
+        return;
+    }
+    const GLshort *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glSecondaryColor3sv(v);
+}
+
+static void APIENTRY trace_glSecondaryColor3ub(GLubyte red, GLubyte green, GLubyte blue) {
+    trace_command(TRACE_glSecondaryColor3ub);
+    trace_write_uint(red);
+    trace_write_uint(green);
+    trace_write_uint(blue);
+    trace_real.glSecondaryColor3ub(red, green, blue);
+}
+
+static void trace_replay_glSecondaryColor3ub(struct trace_reader *reader) {
+    if (!__glSecondaryColor3ub) {
+        trace_missing(reader, TRACE_glSecondaryColor3ub);
+        return;
+    }
+    GLubyte red = (GLubyte)trace_read_uint(reader);
+    GLubyte green = (GLubyte)trace_read_uint(reader);
+    GLubyte blue = (GLubyte)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glSecondaryColor3ub(red, green, blue);
+}
+
+static void APIENTRY trace_glSecondaryColor3ubv(const GLubyte *v) {
+    trace_command(TRACE_glSecondaryColor3ubv);
+    trace_write_array(v, (size_t)(3), sizeof(GLubyte));
+    trace_real.glSecondaryColor3ubv(v);
+}
+
+static void trace_replay_glSecondaryColor3ubv(struct trace_reader *reader) {
+    if (!__glSecondaryColor3ubv) {
+        trace_missing(reader, TRACE_glSecondaryColor3ubv);
+        return;
+    }
+    const GLubyte *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glSecondaryColor3ubv(v);
+}
+
+static void APIENTRY trace_glSecondaryColor3ui(GLuint red, GLuint green, GLuint blue) {
+    trace_command(TRACE_glSecondaryColor3ui);
+    trace_write_uint(red);
+    trace_write_uint(green);
+    trace_write_uint(blue);
+    trace_real.glSecondaryColor3ui(red, green, blue);
+}
+
+static void trace_replay_glSecondaryColor3ui(struct trace_reader *reader) {
+    if (!__glSecondaryColor3ui) {
+        trace_missing(reader, TRACE_glSecondaryColor3ui);
+        return;
+    }
+    GLuint red = (GLuint)trace_read_uint(reader);
+    GLuint green = (GLuint)trace_read_uint(reader);
+    GLuint blue = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glSecondaryColor3ui(red, green, blue);
+}
+
+static void APIENTRY trace_glSecondaryColor3uiv(const GLuint *v) {
+    trace_command(TRACE_glSecondaryColor3uiv);
+    trace_write_array(v, (size_t)(3), sizeof(GLuint));
+    trace_real.glSecondaryColor3uiv(v);
+}
+
+static void trace_replay_glSecondaryColor3uiv(struct trace_reader *reader) {
+    if (!__glSecondaryColor3uiv) {
+        trace_missing(reader, TRACE_glSecondaryColor3uiv);
+        return;
+    }
+    const GLuint *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glSecondaryColor3uiv(v);
+}
+
+static void APIENTRY trace_glSecondaryColor3us(GLushort red, GLushort green, GLushort blue) {
+    trace_command(TRACE_glSecondaryColor3us);
+    trace_write_uint(red);
+    trace_write_uint(green);
+    trace_write_uint(blue);
+    trace_real.glSecondaryColor3us(red, green, blue);
+}
+
+static void trace_replay_glSecondaryColor3us(struct trace_reader *reader) {
+    if (!__glSecondaryColor3us) {
+        trace_missing(reader, TRACE_glSecondaryColor3us);
+        return;
+    }
+    GLushort red = (GLushort)trace_read_uint(reader);
+    GLushort green = (GLushort)trace_read_uint(reader);
+    GLushort blue = (GLushort)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glSecondaryColor3us(red, green, blue);
+}
+
+static void APIENTRY trace_glSecondaryColor3usv(const GLushort *v) {
+    trace_command(TRACE_glSecondaryColor3usv);
+    trace_write_array(v, (size_t)(3), sizeof(GLushort));
+    trace_real.glSecondaryColor3usv(v);
+}
+
+static void trace_replay_glSecondaryColor3usv(struct trace_reader *reader) {
+    if (!__glSecondaryColor3usv) {
+        trace_missing(reader, TRACE_glSecondaryColor3usv);
+        return;
+    }
+    const GLushort *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glSecondaryColor3usv(v);
+}
+
+static void APIENTRY trace_glSecondaryColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+    trace_command(TRACE_glSecondaryColorPointer);
+    trace_write_int(size);
+    trace_write_uint(type);
+    trace_write_int(stride);
+    trace_write_offset(pointer);
+    trace_real.glSecondaryColorPointer(size, type, stride, pointer);
+}
+
+static void trace_replay_glSecondaryColorPointer(struct trace_reader *reader) {
+    if (!__glSecondaryColorPointer) {
+        trace_missing(reader, TRACE_glSecondaryColorPointer);
+        return;
+    }
+    GLint size = (GLint)trace_read_int(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLsizei stride = (GLsizei)trace_read_int(reader);
+    const void *pointer = trace_read_offset(reader);
+    if (reader->error)
+        return;
+    __glSecondaryColorPointer(size, type, stride, pointer);
+}
+
+static void APIENTRY trace_glWindowPos2d(GLdouble x, GLdouble y) {
+    trace_command(TRACE_glWindowPos2d);
+    trace_write_double(x);
+    trace_write_double(y);
+    trace_real.glWindowPos2d(x, y);
+}
+
+static void trace_replay_glWindowPos2d(struct trace_reader *reader) {
+    if (!__glWindowPos2d) {
+        trace_missing(reader, TRACE_glWindowPos2d);
+        return;
+    }
+    GLdouble x = trace_read_double(reader);
+    GLdouble y = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glWindowPos2d(x, y);
+}
+
+static void APIENTRY trace_glWindowPos2dv(const GLdouble *v) {
+    trace_command(TRACE_glWindowPos2dv);
+    trace_write_array(v, (size_t)(2), sizeof(GLdouble));
+    trace_real.glWindowPos2dv(v);
+}
+
+static void trace_replay_glWindowPos2dv(struct trace_reader *reader) {
+    if (!__glWindowPos2dv) {
+        trace_missing(reader, TRACE_glWindowPos2dv);
+        return;
+    }
+    const GLdouble *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glWindowPos2dv(v);
+}
+
+static void APIENTRY trace_glWindowPos2f(GLfloat x, GLfloat y) {
+    trace_command(TRACE_glWindowPos2f);
+    trace_write_float(x);
+    trace_write_float(y);
+    trace_real.glWindowPos2f(x, y);
+}
+
+static void trace_replay_glWindowPos2f(struct trace_reader *reader) {
+    if (!__glWindowPos2f) {
+        trace_missing(reader, TRACE_glWindowPos2f);
+        return;
+    }
+    GLfloat x = trace_read_float(reader);
+    GLfloat y = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glWindowPos2f(x, y);
+}
+
+static void APIENTRY trace_glWindowPos2fv(const GLfloat *v) {
+    trace_command(TRACE_glWindowPos2fv);
+    trace_write_array(v, (size_t)(2), sizeof(GLfloat));
+    trace_real.glWindowPos2fv(v);
+}
+
+static void trace_replay_glWindowPos2fv(struct trace_reader *reader) {
+    if (!__glWindowPos2fv) {
+        trace_missing(reader, TRACE_glWindowPos2fv);
+        return;
+    }
+    const GLfloat *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glWindowPos2fv(v);
+}
+
+static void APIENTRY trace_glWindowPos2i(GLint x, GLint y) {
+    trace_command(TRACE_glWindowPos2i);
+    trace_write_int(x);
+    trace_write_int(y);
+    trace_real.glWindowPos2i(x, y);
+}
+
+static void trace_replay_glWindowPos2i(struct trace_reader *reader) {
+    if (!__glWindowPos2i) {
+        trace_missing(reader, TRACE_glWindowPos2i);
+        return;
+    }
+    GLint x = (GLint)trace_read_int(reader);
+    GLint y = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glWindowPos2i(x, y);
+}
+
+static void APIENTRY trace_glWindowPos2iv(const GLint *v) {
+    trace_command(TRACE_glWindowPos2iv);
+    trace_write_array(v, (size_t)(2), sizeof(GLint));
+    trace_real.glWindowPos2iv(v);
+}
+
+static void trace_replay_glWindowPos2iv(struct trace_reader *reader) {
+    if (!__glWindowPos2iv) {
+        trace_missing(reader, TRACE_glWindowPos2iv);
+        return;
+    }
+    const GLint *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glWindowPos2iv(v);
+}
+
+static void APIENTRY trace_glWindowPos2s(GLshort x, GLshort y) {
+    trace_command(TRACE_glWindowPos2s);
+    trace_write_int(x);
+    trace_write_int(y);
+    trace_real.glWindowPos2s(x, y);
+}
+
+static void trace_replay_glWindowPos2s(struct trace_reader *reader) {
+    if (!__glWindowPos2s) {
+        trace_missing(reader, TRACE_glWindowPos2s);
+        return;
+    }
+    GLshort x = (GLshort)trace_read_int(reader);
+    GLshort y = (GLshort)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glWindowPos2s(x, y);
+}
+
+static void APIENTRY trace_glWindowPos2sv(const GLshort *v) {
+    trace_command(TRACE_glWindowPos2sv);
+    trace_write_array(v, (size_t)(2), sizeof(GLshort));
+    trace_real.glWindowPos2sv(v);
+}
+
+static void trace_replay_glWindowPos2sv(struct trace_reader *reader) {
+    if (!__glWindowPos2sv) {
+        trace_missing(reader, TRACE_glWindowPos2sv);
+        return;
+    }
+    const GLshort *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glWindowPos2sv(v);
+}
+
+static void APIENTRY trace_glWindowPos3d(GLdouble x, GLdouble y, GLdouble z) {
+    trace_command(TRACE_glWindowPos3d);
+    trace_write_double(x);
+    trace_write_double(y);
+    trace_write_double(z);
+    trace_real.glWindowPos3d(x, y, z);
+}
+
+static void trace_replay_glWindowPos3d(struct trace_reader *reader) {
+    if (!__glWindowPos3d) {
+        trace_missing(reader, TRACE_glWindowPos3d);
+        return;
+    }
+    GLdouble x = trace_read_double(reader);
+    GLdouble y = trace_read_double(reader);
+    GLdouble z = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glWindowPos3d(x, y, z);
+}
+
+static void APIENTRY trace_glWindowPos3dv(const GLdouble *v) {
+    trace_command(TRACE_glWindowPos3dv);
+    trace_write_array(v, (size_t)(3), sizeof(GLdouble));
+    trace_real.glWindowPos3dv(v);
+}
+
+static void trace_replay_glWindowPos3dv(struct trace_reader *reader) {
+    if (!__glWindowPos3dv) {
+        trace_missing(reader, TRACE_glWindowPos3dv);
+        return;
+    }
+    const GLdouble *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glWindowPos3dv(v);
+}
+
+static void APIENTRY trace_glWindowPos3f(GLfloat x, GLfloat y, GLfloat z) {
+    trace_command(TRACE_glWindowPos3f);
+    trace_write_float(x);
+    trace_write_float(y);
+    trace_write_float(z);
+    trace_real.glWindowPos3f(x, y, z);
+}
+
+static void trace_replay_glWindowPos3f(struct trace_reader *reader) {
+    if (!__glWindowPos3f) {
+        trace_missing(reader, TRACE_glWindowPos3f);
+        return;
+    }
+    GLfloat x = trace_read_float(reader);
+    GLfloat y = trace_read_float(reader);
+    GLfloat z = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glWindowPos3f(x, y, z);
+}
+
+static void APIENTRY trace_glWindowPos3fv(const GLfloat *v) {
+    trace_command(TRACE_glWindowPos3fv);
+    trace_write_array(v, (size_t)(3), sizeof(GLfloat));
+    trace_real.glWindowPos3fv(v);
+}
+
+static void trace_replay_glWindowPos3fv(struct trace_reader *reader) {
+    if (!__glWindowPos3fv) {
+        trace_missing(reader, TRACE_glWindowPos3fv);
+        return;
+    }
+    const GLfloat *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glWindowPos3fv(v);
+}
+
+static void APIENTRY trace_glWindowPos3i(GLint x, GLint y, GLint z) {
+    trace_command(TRACE_glWindowPos3i);
+    trace_write_int(x);
+    trace_write_int(y);
+    trace_write_int(z);
+    trace_real.glWindowPos3i(x, y, z);
+}
+
+static void trace_replay_glWindowPos3i(struct trace_reader *reader) {
+    if (!__glWindowPos3i) {
+        trace_missing(reader, TRACE_glWindowPos3i);
+        return;
+    }
+    GLint x = (GLint)trace_read_int(reader);
+    GLint y = (GLint)trace_read_int(reader);
+    GLint z = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glWindowPos3i(x, y, z);
+}
+
+static void APIENTRY trace_glWindowPos3iv(const GLint *v) {
+    trace_command(TRACE_glWindowPos3iv);
+    trace_write_array(v, (size_t)(3), sizeof(GLint));
+    trace_real.glWindowPos3iv(v);
+}
+
+static void trace_replay_glWindowPos3iv(struct trace_reader *reader) {
+    if (!__glWindowPos3iv) {
+        trace_missing(reader, TRACE_glWindowPos3iv);
+        return;
+    }
+    const GLint *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glWindowPos3iv(v);
+}
+
+static void APIENTRY trace_glWindowPos3s(GLshort x, GLshort y, GLshort z) {
+    trace_command(TRACE_glWindowPos3s);
+    trace_write_int(x);
+    trace_write_int(y);
+    trace_write_int(z);
+    trace_real.glWindowPos3s(x, y, z);
+}
+
+static void trace_replay_glWindowPos3s(struct trace_reader *reader) {
+    if (!__glWindowPos3s) {
+        trace_missing(reader, TRACE_glWindowPos3s);
+        return;
+    }
+    GLshort x = (GLshort)trace_read_int(reader);
+    GLshort y = (GLshort)trace_read_int(reader);
+    GLshort z = (GLshort)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glWindowPos3s(x, y, z);
+}
+
+static void APIENTRY trace_glWindowPos3sv(const GLshort *v) {
+    trace_command(TRACE_glWindowPos3sv);
+    trace_write_array(v, (size_t)(3), sizeof(GLshort));
+    trace_real.glWindowPos3sv(v);
+}
+
+static void trace_replay_glWindowPos3sv(struct trace_reader *reader) {
+    if (!__glWindowPos3sv) {
+        trace_missing(reader, TRACE_glWindowPos3sv);
+        return;
+    }
+    const GLshort *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glWindowPos3sv(v);
+}
+
+static void APIENTRY trace_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    trace_command(TRACE_glBlendColor);
+    trace_write_float(red);
+    trace_write_float(green);
+    trace_write_float(blue);
+    trace_write_float(alpha);
+    trace_real.glBlendColor(red, green, blue, alpha);
+}
+
+static void trace_replay_glBlendColor(struct trace_reader *reader) {
+    if (!__glBlendColor) {
+        trace_missing(reader, TRACE_glBlendColor);
+        return;
+    }
+    GLfloat red = trace_read_float(reader);
+    GLfloat green = trace_read_float(reader);
+    GLfloat blue = trace_read_float(reader);
+    GLfloat alpha = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glBlendColor(red, green, blue, alpha);
+}
+
+static void APIENTRY trace_glBlendEquation(GLenum mode) {
+    trace_command(TRACE_glBlendEquation);
+    trace_write_uint(mode);
+    trace_real.glBlendEquation(mode);
+}
+
+static void trace_replay_glBlendEquation(struct trace_reader *reader) {
+    if (!__glBlendEquation) {
+        trace_missing(reader, TRACE_glBlendEquation);
+        return;
+    }
+    GLenum mode = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glBlendEquation(mode);
+}
+
+#endif
+
+#if FUNGL_VERSION >= GL_VERSION_1_5
+static void APIENTRY trace_glGenQueries(GLsizei n, GLuint *ids) {
+    trace_command(TRACE_glGenQueries);
+    trace_write_int(n);
+    trace_real.glGenQueries(n, ids);
+    trace_write_array(ids, (size_t)(n), sizeof(GLuint));
+}
+
+static void trace_replay_glGenQueries(struct trace_reader *reader) {
+    if (!__glGenQueries) {
+        trace_missing(reader, TRACE_glGenQueries);
+        return;
+    }
+    GLsizei n = (GLsizei)trace_read_int(reader);
+    GLuint *ids = trace_scratch(reader, (size_t)(n) * sizeof(GLuint));
+    if (reader->error)
+        return;
+    __glGenQueries(n, ids);
+    trace_map_names(reader, TRACE_NAME_QUERY, ids, (size_t)(n));
+}
+
+static void APIENTRY trace_glDeleteQueries(GLsizei n, const GLuint *ids) {
+    trace_command(TRACE_glDeleteQueries);
+    trace_write_int(n);
+    trace_write_array(ids, (size_t)(n), sizeof(GLuint));
+    trace_real.glDeleteQueries(n, ids);
+}
+
+static void trace_replay_glDeleteQueries(struct trace_reader *reader) {
+    if (!__glDeleteQueries) {
+        trace_missing(reader, TRACE_glDeleteQueries);
+        return;
+    }
+    GLsizei n = (GLsizei)trace_read_int(reader);
+    const GLuint *ids = trace_read_names(reader, TRACE_NAME_QUERY);
+    if (reader->error)
+        return;
+    __glDeleteQueries(n, ids);
+}
+
+static void APIENTRY trace_glBeginQuery(GLenum target, GLuint id) {
+    trace_command(TRACE_glBeginQuery);
+    trace_write_uint(target);
+    trace_write_uint(id);
+    trace_real.glBeginQuery(target, id);
+}
+
+static void trace_replay_glBeginQuery(struct trace_reader *reader) {
+    if (!__glBeginQuery) {
+        trace_missing(reader, TRACE_glBeginQuery);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLuint id = trace_name(reader, TRACE_NAME_QUERY, (GLuint)trace_read_uint(reader));
+    if (reader->error)
+        return;
+    __glBeginQuery(target, id);
+}
+
+static void APIENTRY trace_glEndQuery(GLenum target) {
+    trace_command(TRACE_glEndQuery);
+    trace_write_uint(target);
+    trace_real.glEndQuery(target);
+}
+
+static void trace_replay_glEndQuery(struct trace_reader *reader) {
+    if (!__glEndQuery) {
+        trace_missing(reader, TRACE_glEndQuery);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glEndQuery(target);
+}
+
+static void APIENTRY trace_glBindBuffer(GLenum target, GLuint buffer) {
+    trace_command(TRACE_glBindBuffer);
+    trace_write_uint(target);
+    trace_write_uint(buffer);
+    trace_real.glBindBuffer(target, buffer);
+}
+
+static void trace_replay_glBindBuffer(struct trace_reader *reader) {
+    if (!__glBindBuffer) {
+        trace_missing(reader, TRACE_glBindBuffer);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLuint buffer = trace_name(reader, TRACE_NAME_BUFFER, (GLuint)trace_read_uint(reader));
+    if (reader->error)
+        return;
+    __glBindBuffer(target, buffer);
+}
+
+static void APIENTRY trace_glDeleteBuffers(GLsizei n, const GLuint *buffers) {
+    trace_before_glDeleteBuffers(n, buffers);
+    trace_command(TRACE_glDeleteBuffers);
+    trace_write_int(n);
+    trace_write_array(buffers, (size_t)(n), sizeof(GLuint));
+    trace_real.glDeleteBuffers(n, buffers);
+}
+
+static void trace_replay_glDeleteBuffers(struct trace_reader *reader) {
+    if (!__glDeleteBuffers) {
+        trace_missing(reader, TRACE_glDeleteBuffers);
+        return;
+    }
+    GLsizei n = (GLsizei)trace_read_int(reader);
+    const GLuint *buffers = trace_read_names(reader, TRACE_NAME_BUFFER);
+    if (reader->error)
+        return;
+    trace_replay_before_glDeleteBuffers(reader, n, buffers);
+    __glDeleteBuffers(n, buffers);
+}
+
+static void APIENTRY trace_glGenBuffers(GLsizei n, GLuint *buffers) {
+    trace_command(TRACE_glGenBuffers);
+    trace_write_int(n);
+    trace_real.glGenBuffers(n, buffers);
+    trace_write_array(buffers, (size_t)(n), sizeof(GLuint));
+}
+
+static void trace_replay_glGenBuffers(struct trace_reader *reader) {
+    if (!__glGenBuffers) {
+        trace_missing(reader, TRACE_glGenBuffers);
+        return;
+    }
+    GLsizei n = (GLsizei)trace_read_int(reader);
+    GLuint *buffers = trace_scratch(reader, (size_t)(n) * sizeof(GLuint));
+    if (reader->error)
+        return;
+    __glGenBuffers(n, buffers);
+    trace_map_names(reader, TRACE_NAME_BUFFER, buffers, (size_t)(n));
+}
+
+static void APIENTRY trace_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) {
+    trace_command(TRACE_glBufferData);
+    trace_write_uint(target);
+    trace_write_int(size);
+    trace_write_array(data, (size_t)(size), 1);
+    trace_write_uint(usage);
+    trace_real.glBufferData(target, size, data, usage);
+}
+
+static void trace_replay_glBufferData(struct trace_reader *reader) {
+    if (!__glBufferData) {
+        trace_missing(reader, TRACE_glBufferData);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLsizeiptr size = (GLsizeiptr)trace_read_int(reader);
+    const void *data = trace_read_array(reader);
+    GLenum usage = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glBufferData(target, size, data, usage);
+}
+
+static void APIENTRY trace_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+    trace_command(TRACE_glBufferSubData);
+    trace_write_uint(target);
+    trace_write_int(offset);
+    trace_write_int(size);
+    trace_write_array(data, (size_t)(size), 1);
+    trace_real.glBufferSubData(target, offset, size, data);
+}
+
+static void trace_replay_glBufferSubData(struct trace_reader *reader) {
+    if (!__glBufferSubData) {
+        trace_missing(reader, TRACE_glBufferSubData);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLintptr offset = (GLintptr)trace_read_int(reader);
+    GLsizeiptr size = (GLsizeiptr)trace_read_int(reader);
+    const void *data = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glBufferSubData(target, offset, size, data);
+}
+
+static void *APIENTRY trace_glMapBuffer(GLenum target, GLenum access) {
+    trace_command(TRACE_glMapBuffer);
+    trace_write_uint(target);
+    trace_write_uint(access);
+    void *result = trace_real.glMapBuffer(target, access);
+    trace_after_glMapBuffer(target, access, result);
+    return result;
+}
+
+static void trace_replay_glMapBuffer(struct trace_reader *reader) {
+    if (!__glMapBuffer) {
+        trace_missing(reader, TRACE_glMapBuffer);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLenum access = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    void *result = __glMapBuffer(target, access);
+    trace_replay_after_glMapBuffer(reader, target, access, result);
+}
+
+static GLboolean APIENTRY trace_glUnmapBuffer(GLenum target) {
+    trace_before_glUnmapBuffer(target);
+    trace_command(TRACE_glUnmapBuffer);
+    trace_write_uint(target);
+    GLboolean result = trace_real.glUnmapBuffer(target);
+    return result;
+}
+
+static void trace_replay_glUnmapBuffer(struct trace_reader *reader) {
+    if (!__glUnmapBuffer) {
+        trace_missing(reader, TRACE_glUnmapBuffer);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    trace_replay_before_glUnmapBuffer(reader, target);
+    GLboolean result = __glUnmapBuffer(target);
+    (void)result;
+}
+
+#endif
+
+#if FUNGL_VERSION >= GL_VERSION_2_0
+static void APIENTRY trace_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+    trace_command(TRACE_glBlendEquationSeparate);
+    trace_write_uint(modeRGB);
+    trace_write_uint(modeAlpha);
+    trace_real.glBlendEquationSeparate(modeRGB, modeAlpha);
+}
+
+static void trace_replay_glBlendEquationSeparate(struct trace_reader *reader) {
+    if (!__glBlendEquationSeparate) {
+        trace_missing(reader, TRACE_glBlendEquationSeparate);
+        return;
+    }
+    GLenum modeRGB = (GLenum)trace_read_uint(reader);
+    GLenum modeAlpha = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glBlendEquationSeparate(modeRGB, modeAlpha);
+}
+
+static void APIENTRY trace_glDrawBuffers(GLsizei n, const GLenum *bufs) {
+    trace_command(TRACE_glDrawBuffers);
+    trace_write_int(n);
+    trace_write_array(bufs, (size_t)(n), sizeof(GLenum));
+    trace_real.glDrawBuffers(n, bufs);
+}
+
+static void trace_replay_glDrawBuffers(struct trace_reader *reader) {
+    if (!__glDrawBuffers) {
+        trace_missing(reader, TRACE_glDrawBuffers);
+        return;
+    }
+    GLsizei n = (GLsizei)trace_read_int(reader);
+    const GLenum *bufs = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glDrawBuffers(n, bufs);
+}
+
+static void APIENTRY trace_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+    trace_command(TRACE_glStencilOpSeparate);
+    trace_write_uint(face);
+    trace_write_uint(sfail);
+    trace_write_uint(dpfail);
+    trace_write_uint(dppass);
+    trace_real.glStencilOpSeparate(face, sfail, dpfail, dppass);
+}
+
+static void trace_replay_glStencilOpSeparate(struct trace_reader *reader) {
+    if (!__glStencilOpSeparate) {
+        trace_missing(reader, TRACE_glStencilOpSeparate);
+        return;
+    }
+    GLenum face = (GLenum)trace_read_uint(reader);
+    GLenum sfail = (GLenum)trace_read_uint(reader);
+    GLenum dpfail = (GLenum)trace_read_uint(reader);
+    GLenum dppass = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glStencilOpSeparate(face, sfail, dpfail, dppass);
+}
+
+static void APIENTRY trace_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) {
+    trace_command(TRACE_glStencilFuncSeparate);
+    trace_write_uint(face);
+    trace_write_uint(func);
+    trace_write_int(ref);
+    trace_write_uint(mask);
+    trace_real.glStencilFuncSeparate(face, func, ref, mask);
+}
+
+static void trace_replay_glStencilFuncSeparate(struct trace_reader *reader) {
+    if (!__glStencilFuncSeparate) {
+        trace_missing(reader, TRACE_glStencilFuncSeparate);
+        return;
+    }
+    GLenum face = (GLenum)trace_read_uint(reader);
+    GLenum func = (GLenum)trace_read_uint(reader);
+    GLint ref = (GLint)trace_read_int(reader);
+    GLuint mask = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glStencilFuncSeparate(face, func, ref, mask);
+}
+
+static void APIENTRY trace_glStencilMaskSeparate(GLenum face, GLuint mask) {
+    trace_command(TRACE_glStencilMaskSeparate);
+    trace_write_uint(face);
+    trace_write_uint(mask);
+    trace_real.glStencilMaskSeparate(face, mask);
+}
+
+static void trace_replay_glStencilMaskSeparate(struct trace_reader *reader) {
+    if (!__glStencilMaskSeparate) {
+        trace_missing(reader, TRACE_glStencilMaskSeparate);
+        return;
+    }
+    GLenum face = (GLenum)trace_read_uint(reader);
+    GLuint mask = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glStencilMaskSeparate(face, mask);
+}
+
+static void APIENTRY trace_glAttachShader(GLuint program, GLuint shader) {
+    trace_command(TRACE_glAttachShader);
+    trace_write_uint(program);
+    trace_write_uint(shader);
+    trace_real.glAttachShader(program, shader);
+}
+
+static void trace_replay_glAttachShader(struct trace_reader *reader) {
+    if (!__glAttachShader) {
+        trace_missing(reader, TRACE_glAttachShader);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLuint shader = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    if (reader->error)
+        return;
+    __glAttachShader(program, shader);
+}
+
+static void APIENTRY trace_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) {
+    trace_command(TRACE_glBindAttribLocation);
+    trace_write_uint(program);
+    trace_write_uint(index);
+    trace_write_string(name, -1);
+    trace_real.glBindAttribLocation(program, index, name);
+}
+
+static void trace_replay_glBindAttribLocation(struct trace_reader *reader) {
+    if (!__glBindAttribLocation) {
+        trace_missing(reader, TRACE_glBindAttribLocation);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLchar *name = trace_read_string(reader);
+    if (reader->error)
+        return;
+    __glBindAttribLocation(program, index, name);
+}
+
+static void APIENTRY trace_glCompileShader(GLuint shader) {
+    trace_command(TRACE_glCompileShader);
+    trace_write_uint(shader);
+    trace_real.glCompileShader(shader);
+}
+
+static void trace_replay_glCompileShader(struct trace_reader *reader) {
+    if (!__glCompileShader) {
+        trace_missing(reader, TRACE_glCompileShader);
+        return;
+    }
+    GLuint shader = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    if (reader->error)
+        return;
+    __glCompileShader(shader);
+}
+
+static GLuint APIENTRY trace_glCreateProgram(void) {
+    trace_command(TRACE_glCreateProgram);
+    GLuint result = trace_real.glCreateProgram();
+    trace_write_uint(result);
+    return result;
+}
+
+static void trace_replay_glCreateProgram(struct trace_reader *reader) {
+    if (!__glCreateProgram) {
+        trace_missing(reader, TRACE_glCreateProgram);
+        return;
+    }
+    if (reader->error)
+        return;
+    GLuint result = __glCreateProgram();
+    trace_map_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader), result, 1);
+}
+
+static GLuint APIENTRY trace_glCreateShader(GLenum type) {
+    trace_command(TRACE_glCreateShader);
+    trace_write_uint(type);
+    GLuint result = trace_real.glCreateShader(type);
+    trace_write_uint(result);
+    return result;
+}
+
+static void trace_replay_glCreateShader(struct trace_reader *reader) {
+    if (!__glCreateShader) {
+        trace_missing(reader, TRACE_glCreateShader);
+        return;
+    }
+    GLenum type = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    GLuint result = __glCreateShader(type);
+    trace_map_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader), result, 1);
+}
+
+static void APIENTRY trace_glDeleteProgram(GLuint program) {
+    trace_command(TRACE_glDeleteProgram);
+    trace_write_uint(program);
+    trace_real.glDeleteProgram(program);
+}
+
+static void trace_replay_glDeleteProgram(struct trace_reader *reader) {
+    if (!__glDeleteProgram) {
+        trace_missing(reader, TRACE_glDeleteProgram);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    if (reader->error)
+        return;
+    __glDeleteProgram(program);
+}
+
+static void APIENTRY trace_glDeleteShader(GLuint shader) {
+    trace_command(TRACE_glDeleteShader);
+    trace_write_uint(shader);
+    trace_real.glDeleteShader(shader);
+}
+
+static void trace_replay_glDeleteShader(struct trace_reader *reader) {
+    if (!__glDeleteShader) {
+        trace_missing(reader, TRACE_glDeleteShader);
+        return;
+    }
+    GLuint shader = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    if (reader->error)
+        return;
+    __glDeleteShader(shader);
+}
+
+static void APIENTRY trace_glDetachShader(GLuint program, GLuint shader) {
+    trace_command(TRACE_glDetachShader);
+    trace_write_uint(program);
+    trace_write_uint(shader);
+    trace_real.glDetachShader(program, shader);
+}
+
+static void trace_replay_glDetachShader(struct trace_reader *reader) {
+    if (!__glDetachShader) {
+        trace_missing(reader, TRACE_glDetachShader);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLuint shader = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    if (reader->error)
+        return;
+    __glDetachShader(program, shader);
+}
+
+static void APIENTRY trace_glDisableVertexAttribArray(GLuint index) {
+    trace_command(TRACE_glDisableVertexAttribArray);
+    trace_write_uint(index);
+    trace_real.glDisableVertexAttribArray(index);
+}
+
+static void trace_replay_glDisableVertexAttribArray(struct trace_reader *reader) {
+    if (!__glDisableVertexAttribArray) {
+        trace_missing(reader, TRACE_glDisableVertexAttribArray);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glDisableVertexAttribArray(index);
+}
+
+static void APIENTRY trace_glEnableVertexAttribArray(GLuint index) {
+    trace_command(TRACE_glEnableVertexAttribArray);
+    trace_write_uint(index);
+    trace_real.glEnableVertexAttribArray(index);
+}
+
+static void trace_replay_glEnableVertexAttribArray(struct trace_reader *reader) {
+    if (!__glEnableVertexAttribArray) {
+        trace_missing(reader, TRACE_glEnableVertexAttribArray);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glEnableVertexAttribArray(index);
+}
+
+static GLint APIENTRY trace_glGetUniformLocation(GLuint program, const GLchar *name) {
+    trace_command(TRACE_glGetUniformLocation);
+    trace_write_uint(program);
+    trace_write_string(name, -1);
+    GLint result = trace_real.glGetUniformLocation(program, name);
+    trace_write_int(result);
+    return result;
+}
+
+static void trace_replay_glGetUniformLocation(struct trace_reader *reader) {
+    if (!__glGetUniformLocation) {
+        trace_missing(reader, TRACE_glGetUniformLocation);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    const GLchar *name = trace_read_string(reader);
+    if (reader->error)
+        return;
+    GLint result = __glGetUniformLocation(program, name);
+    trace_map_location(reader, program, (GLint)trace_read_int(reader), result);
+}
+
+static void APIENTRY trace_glLinkProgram(GLuint program) {
+    trace_command(TRACE_glLinkProgram);
+    trace_write_uint(program);
+    trace_real.glLinkProgram(program);
+}
+
+static void trace_replay_glLinkProgram(struct trace_reader *reader) {
+    if (!__glLinkProgram) {
+        trace_missing(reader, TRACE_glLinkProgram);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    if (reader->error)
+        return;
+    __glLinkProgram(program);
+}
+
+static void APIENTRY trace_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) {
+    trace_command(TRACE_glShaderSource);
+    trace_write_uint(shader);
+    trace_write_int(count);
+    trace_write_strings(string, count, length);
+    trace_write_array(length, (size_t)(count), sizeof(GLint));
+    trace_real.glShaderSource(shader, count, string, length);
+}
+
+static void trace_replay_glShaderSource(struct trace_reader *reader) {
+    if (!__glShaderSource) {
+        trace_missing(reader, TRACE_glShaderSource);
+        return;
+    }
+    GLuint shader = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLchar *const*string = trace_read_strings(reader);
+    const GLint *length = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glShaderSource(shader, count, string, length);
+}
+
+static void APIENTRY trace_glUseProgram(GLuint program) {
+    trace_command(TRACE_glUseProgram);
+    trace_write_uint(program);
+    trace_real.glUseProgram(program);
+}
+
+static void trace_replay_glUseProgram(struct trace_reader *reader) {
+    if (!__glUseProgram) {
+        trace_missing(reader, TRACE_glUseProgram);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    if (reader->error)
+        return;
+    __glUseProgram(program);
+    trace_replay_after_glUseProgram(reader, program);
+}
+
+static void APIENTRY trace_glUniform1f(GLint location, GLfloat v0) {
+    trace_command(TRACE_glUniform1f);
+    trace_write_int(location);
+    trace_write_float(v0);
+    trace_real.glUniform1f(location, v0);
+}
+
+static void trace_replay_glUniform1f(struct trace_reader *reader) {
+    if (!__glUniform1f) {
+        trace_missing(reader, TRACE_glUniform1f);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLfloat v0 = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glUniform1f(location, v0);
+}
+
+static void APIENTRY trace_glUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+    trace_command(TRACE_glUniform2f);
+    trace_write_int(location);
+    trace_write_float(v0);
+    trace_write_float(v1);
+    trace_real.glUniform2f(location, v0, v1);
+}
+
+static void trace_replay_glUniform2f(struct trace_reader *reader) {
+    if (!__glUniform2f) {
+        trace_missing(reader, TRACE_glUniform2f);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLfloat v0 = trace_read_float(reader);
+    GLfloat v1 = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glUniform2f(location, v0, v1);
+}
+
+static void APIENTRY trace_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+    trace_command(TRACE_glUniform3f);
+    trace_write_int(location);
+    trace_write_float(v0);
+    trace_write_float(v1);
+    trace_write_float(v2);
+    trace_real.glUniform3f(location, v0, v1, v2);
+}
+
+static void trace_replay_glUniform3f(struct trace_reader *reader) {
+    if (!__glUniform3f) {
+        trace_missing(reader, TRACE_glUniform3f);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLfloat v0 = trace_read_float(reader);
+    GLfloat v1 = trace_read_float(reader);
+    GLfloat v2 = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glUniform3f(location, v0, v1, v2);
+}
+
+static void APIENTRY trace_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+    trace_command(TRACE_glUniform4f);
+    trace_write_int(location);
+    trace_write_float(v0);
+    trace_write_float(v1);
+    trace_write_float(v2);
+    trace_write_float(v3);
+    trace_real.glUniform4f(location, v0, v1, v2, v3);
+}
+
+static void trace_replay_glUniform4f(struct trace_reader *reader) {
+    if (!__glUniform4f) {
+        trace_missing(reader, TRACE_glUniform4f);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLfloat v0 = trace_read_float(reader);
+    GLfloat v1 = trace_read_float(reader);
+    GLfloat v2 = trace_read_float(reader);
+    GLfloat v3 = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glUniform4f(location, v0, v1, v2, v3);
+}
+
+static void APIENTRY trace_glUniform1i(GLint location, GLint v0) {
+    trace_command(TRACE_glUniform1i);
+    trace_write_int(location);
+    trace_write_int(v0);
+    trace_real.glUniform1i(location, v0);
+}
+
+static void trace_replay_glUniform1i(struct trace_reader *reader) {
+    if (!__glUniform1i) {
+        trace_missing(reader, TRACE_glUniform1i);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLint v0 = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glUniform1i(location, v0);
+}
+
+static void APIENTRY trace_glUniform2i(GLint location, GLint v0, GLint v1) {
+    trace_command(TRACE_glUniform2i);
+    trace_write_int(location);
+    trace_write_int(v0);
+    trace_write_int(v1);
+    trace_real.glUniform2i(location, v0, v1);
+}
+
+static void trace_replay_glUniform2i(struct trace_reader *reader) {
+    if (!__glUniform2i) {
+        trace_missing(reader, TRACE_glUniform2i);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLint v0 = (GLint)trace_read_int(reader);
+    GLint v1 = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glUniform2i(location, v0, v1);
+}
+
+static void APIENTRY trace_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+    trace_command(TRACE_glUniform3i);
+    trace_write_int(location);
+    trace_write_int(v0);
+    trace_write_int(v1);
+    trace_write_int(v2);
+    trace_real.glUniform3i(location, v0, v1, v2);
+}
+
+static void trace_replay_glUniform3i(struct trace_reader *reader) {
+    if (!__glUniform3i) {
+        trace_missing(reader, TRACE_glUniform3i);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLint v0 = (GLint)trace_read_int(reader);
+    GLint v1 = (GLint)trace_read_int(reader);
+    GLint v2 = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glUniform3i(location, v0, v1, v2);
+}
+
+static void APIENTRY trace_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+    trace_command(TRACE_glUniform4i);
+    trace_write_int(location);
+    trace_write_int(v0);
+    trace_write_int(v1);
+    trace_write_int(v2);
+    trace_write_int(v3);
+    trace_real.glUniform4i(location, v0, v1, v2, v3);
+}
+
+static void trace_replay_glUniform4i(struct trace_reader *reader) {
+    if (!__glUniform4i) {
+        trace_missing(reader, TRACE_glUniform4i);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLint v0 = (GLint)trace_read_int(reader);
+    GLint v1 = (GLint)trace_read_int(reader);
+    GLint v2 = (GLint)trace_read_int(reader);
+    GLint v3 = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glUniform4i(location, v0, v1, v2, v3);
+}
+
+static void APIENTRY trace_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) {
+    trace_command(TRACE_glUniform1fv);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_array(value, (size_t)((count)*1), sizeof(GLfloat));
+    trace_real.glUniform1fv(location, count, value);
+}
+
+static void trace_replay_glUniform1fv(struct trace_reader *reader) {
+    if (!__glUniform1fv) {
+        trace_missing(reader, TRACE_glUniform1fv);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLfloat *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glUniform1fv(location, count, value);
+}
+
+static void APIENTRY trace_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) {
+    trace_command(TRACE_glUniform2fv);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_array(value, (size_t)((count)*2), sizeof(GLfloat));
+    trace_real.glUniform2fv(location, count, value);
+}
+
+static void trace_replay_glUniform2fv(struct trace_reader *reader) {
+    if (!__glUniform2fv) {
+        trace_missing(reader, TRACE_glUniform2fv);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLfloat *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glUniform2fv(location, count, value);
+}
+
+static void APIENTRY trace_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) {
+    trace_command(TRACE_glUniform3fv);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_array(value, (size_t)((count)*3), sizeof(GLfloat));
+    trace_real.glUniform3fv(location, count, value);
+}
+
+static void trace_replay_glUniform3fv(struct trace_reader *reader) {
+    if (!__glUniform3fv) {
+        trace_missing(reader, TRACE_glUniform3fv);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLfloat *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glUniform3fv(location, count, value);
+}
+
+static void APIENTRY trace_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) {
+    trace_command(TRACE_glUniform4fv);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_array(value, (size_t)((count)*4), sizeof(GLfloat));
+    trace_real.glUniform4fv(location, count, value);
+}
+
+static void trace_replay_glUniform4fv(struct trace_reader *reader) {
+    if (!__glUniform4fv) {
+        trace_missing(reader, TRACE_glUniform4fv);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLfloat *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glUniform4fv(location, count, value);
+}
+
+static void APIENTRY trace_glUniform1iv(GLint location, GLsizei count, const GLint *value) {
+    trace_command(TRACE_glUniform1iv);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_array(value, (size_t)((count)*1), sizeof(GLint));
+    trace_real.glUniform1iv(location, count, value);
+}
+
+static void trace_replay_glUniform1iv(struct trace_reader *reader) {
+    if (!__glUniform1iv) {
+        trace_missing(reader, TRACE_glUniform1iv);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLint *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glUniform1iv(location, count, value);
+}
+
+static void APIENTRY trace_glUniform2iv(GLint location, GLsizei count, const GLint *value) {
+    trace_command(TRACE_glUniform2iv);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_array(value, (size_t)((count)*2), sizeof(GLint));
+    trace_real.glUniform2iv(location, count, value);
+}
+
+static void trace_replay_glUniform2iv(struct trace_reader *reader) {
+    if (!__glUniform2iv) {
+        trace_missing(reader, TRACE_glUniform2iv);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLint *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glUniform2iv(location, count, value);
+}
+
+static void APIENTRY trace_glUniform3iv(GLint location, GLsizei count, const GLint *value) {
+    trace_command(TRACE_glUniform3iv);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_array(value, (size_t)((count)*3), sizeof(GLint));
+    trace_real.glUniform3iv(location, count, value);
+}
+
+static void trace_replay_glUniform3iv(struct trace_reader *reader) {
+    if (!__glUniform3iv) {
+        trace_missing(reader, TRACE_glUniform3iv);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLint *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glUniform3iv(location, count, value);
+}
+
+static void APIENTRY trace_glUniform4iv(GLint location, GLsizei count, const GLint *value) {
+    trace_command(TRACE_glUniform4iv);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_array(value, (size_t)((count)*4), sizeof(GLint));
+    trace_real.glUniform4iv(location, count, value);
+}
+
+static void trace_replay_glUniform4iv(struct trace_reader *reader) {
+    if (!__glUniform4iv) {
+        trace_missing(reader, TRACE_glUniform4iv);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLint *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glUniform4iv(location, count, value);
+}
+
+static void APIENTRY trace_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    trace_command(TRACE_glUniformMatrix2fv);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_uint(transpose);
+    trace_write_array(value, (size_t)((count)*4), sizeof(GLfloat));
+    trace_real.glUniformMatrix2fv(location, count, transpose, value);
+}
+
+static void trace_replay_glUniformMatrix2fv(struct trace_reader *reader) {
+    if (!__glUniformMatrix2fv) {
+        trace_missing(reader, TRACE_glUniformMatrix2fv);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLboolean transpose = (GLboolean)trace_read_uint(reader);
+    const GLfloat *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glUniformMatrix2fv(location, count, transpose, value);
+}
+
+static void APIENTRY trace_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    trace_command(TRACE_glUniformMatrix3fv);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_uint(transpose);
+    trace_write_array(value, (size_t)((count)*9), sizeof(GLfloat));
+    trace_real.glUniformMatrix3fv(location, count, transpose, value);
+}
+
+static void trace_replay_glUniformMatrix3fv(struct trace_reader *reader) {
+    if (!__glUniformMatrix3fv) {
+        trace_missing(reader, TRACE_glUniformMatrix3fv);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLboolean transpose = (GLboolean)trace_read_uint(reader);
+    const GLfloat *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glUniformMatrix3fv(location, count, transpose, value);
+}
+
+static void APIENTRY trace_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    trace_command(TRACE_glUniformMatrix4fv);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_uint(transpose);
+    trace_write_array(value, (size_t)((count)*16), sizeof(GLfloat));
+    trace_real.glUniformMatrix4fv(location, count, transpose, value);
+}
+
+static void trace_replay_glUniformMatrix4fv(struct trace_reader *reader) {
+    if (!__glUniformMatrix4fv) {
+        trace_missing(reader, TRACE_glUniformMatrix4fv);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLboolean transpose = (GLboolean)trace_read_uint(reader);
+    const GLfloat *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glUniformMatrix4fv(location, count, transpose, value);
+}
+
+static void APIENTRY trace_glValidateProgram(GLuint program) {
+    trace_command(TRACE_glValidateProgram);
+    trace_write_uint(program);
+    trace_real.glValidateProgram(program);
+}
+
+static void trace_replay_glValidateProgram(struct trace_reader *reader) {
+    if (!__glValidateProgram) {
+        trace_missing(reader, TRACE_glValidateProgram);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    if (reader->error)
+        return;
+    __glValidateProgram(program);
+}
+
+static void APIENTRY trace_glVertexAttrib1d(GLuint index, GLdouble x) {
+    trace_command(TRACE_glVertexAttrib1d);
+    trace_write_uint(index);
+    trace_write_double(x);
+    trace_real.glVertexAttrib1d(index, x);
+}
+
+static void trace_replay_glVertexAttrib1d(struct trace_reader *reader) {
+    if (!__glVertexAttrib1d) {
+        trace_missing(reader, TRACE_glVertexAttrib1d);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLdouble x = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glVertexAttrib1d(index, x);
+}
+
+static void APIENTRY trace_glVertexAttrib1dv(GLuint index, const GLdouble *v) {
+    trace_command(TRACE_glVertexAttrib1dv);
+    trace_write_uint(index);
+    trace_write_array(v, (size_t)(1), sizeof(GLdouble));
+    trace_real.glVertexAttrib1dv(index, v);
+}
+
+static void trace_replay_glVertexAttrib1dv(struct trace_reader *reader) {
+    if (!__glVertexAttrib1dv) {
+        trace_missing(reader, TRACE_glVertexAttrib1dv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLdouble *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttrib1dv(index, v);
+}
+
+static void APIENTRY trace_glVertexAttrib1f(GLuint index, GLfloat x) {
+    trace_command(TRACE_glVertexAttrib1f);
+    trace_write_uint(index);
+    trace_write_float(x);
+    trace_real.glVertexAttrib1f(index, x);
+}
+
+static void trace_replay_glVertexAttrib1f(struct trace_reader *reader) {
+    if (!__glVertexAttrib1f) {
+        trace_missing(reader, TRACE_glVertexAttrib1f);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLfloat x = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glVertexAttrib1f(index, x);
+}
+
+static void APIENTRY trace_glVertexAttrib1fv(GLuint index, const GLfloat *v) {
+    trace_command(TRACE_glVertexAttrib1fv);
+    trace_write_uint(index);
+    trace_write_array(v, (size_t)(1), sizeof(GLfloat));
+    trace_real.glVertexAttrib1fv(index, v);
+}
+
+static void trace_replay_glVertexAttrib1fv(struct trace_reader *reader) {
+    if (!__glVertexAttrib1fv) {
+        trace_missing(reader, TRACE_glVertexAttrib1fv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLfloat *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttrib1fv(index, v);
+}
+
+static void APIENTRY trace_glVertexAttrib1s(GLuint index, GLshort x) {
+    trace_command(TRACE_glVertexAttrib1s);
+    trace_write_uint(index);
+    trace_write_int(x);
+    trace_real.glVertexAttrib1s(index, x);
+}
+
+static void trace_replay_glVertexAttrib1s(struct trace_reader *reader) {
+    if (!__glVertexAttrib1s) {
+        trace_missing(reader, TRACE_glVertexAttrib1s);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLshort x = (GLshort)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glVertexAttrib1s(index, x);
+}
+
+static void APIENTRY trace_glVertexAttrib1sv(GLuint index, const GLshort *v) {
+    trace_command(TRACE_glVertexAttrib1sv);
+    trace_write_uint(index);
+    trace_write_array(v, (size_t)(1), sizeof(GLshort));
+    trace_real.glVertexAttrib1sv(index, v);
+}
+
+static void trace_replay_glVertexAttrib1sv(struct trace_reader *reader) {
+    if (!__glVertexAttrib1sv) {
+        trace_missing(reader, TRACE_glVertexAttrib1sv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLshort *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttrib1sv(index, v);
+}
+
+static void APIENTRY trace_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) {
+    trace_command(TRACE_glVertexAttrib2d);
+    trace_write_uint(index);
+    trace_write_double(x);
+    trace_write_double(y);
+    trace_real.glVertexAttrib2d(index, x, y);
+}
+
+static void trace_replay_glVertexAttrib2d(struct trace_reader *reader) {
+    if (!__glVertexAttrib2d) {
+        trace_missing(reader, TRACE_glVertexAttrib2d);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLdouble x = trace_read_double(reader);
+    GLdouble y = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glVertexAttrib2d(index, x, y);
+}
+
+static void APIENTRY trace_glVertexAttrib2dv(GLuint index, const GLdouble *v) {
+    trace_command(TRACE_glVertexAttrib2dv);
+    trace_write_uint(index);
+    trace_write_array(v, (size_t)(2), sizeof(GLdouble));
+    trace_real.glVertexAttrib2dv(index, v);
+}
+
+static void trace_replay_glVertexAttrib2dv(struct trace_reader *reader) {
+    if (!__glVertexAttrib2dv) {
+        trace_missing(reader, TRACE_glVertexAttrib2dv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLdouble *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttrib2dv(index, v);
+}
+
+static void APIENTRY trace_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) {
+    trace_command(TRACE_glVertexAttrib2f);
+    trace_write_uint(index);
+    trace_write_float(x);
+    trace_write_float(y);
+    trace_real.glVertexAttrib2f(index, x, y);
+}
+
+static void trace_replay_glVertexAttrib2f(struct trace_reader *reader) {
+    if (!__glVertexAttrib2f) {
+        trace_missing(reader, TRACE_glVertexAttrib2f);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLfloat x = trace_read_float(reader);
+    GLfloat y = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glVertexAttrib2f(index, x, y);
+}
+
+static void APIENTRY trace_glVertexAttrib2fv(GLuint index, const GLfloat *v) {
+    trace_command(TRACE_glVertexAttrib2fv);
+    trace_write_uint(index);
+    trace_write_array(v, (size_t)(2), sizeof(GLfloat));
+    trace_real.glVertexAttrib2fv(index, v);
+}
+
+static void trace_replay_glVertexAttrib2fv(struct trace_reader *reader) {
+    if (!__glVertexAttrib2fv) {
+        trace_missing(reader, TRACE_glVertexAttrib2fv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLfloat *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttrib2fv(index, v);
+}
+
+static void APIENTRY trace_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) {
+    trace_command(TRACE_glVertexAttrib2s);
+    trace_write_uint(index);
+    trace_write_int(x);
+    trace_write_int(y);
+    trace_real.glVertexAttrib2s(index, x, y);
+}
+
+static void trace_replay_glVertexAttrib2s(struct trace_reader *reader) {
+    if (!__glVertexAttrib2s) {
+        trace_missing(reader, TRACE_glVertexAttrib2s);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLshort x = (GLshort)trace_read_int(reader);
+    GLshort y = (GLshort)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glVertexAttrib2s(index, x, y);
+}
+
+static void APIENTRY trace_glVertexAttrib2sv(GLuint index, const GLshort *v) {
+    trace_command(TRACE_glVertexAttrib2sv);
+    trace_write_uint(index);
+    trace_write_array(v, (size_t)(2), sizeof(GLshort));
+    trace_real.glVertexAttrib2sv(index, v);
+}
+
+static void trace_replay_glVertexAttrib2sv(struct trace_reader *reader) {
+    if (!__glVertexAttrib2sv) {
+        trace_missing(reader, TRACE_glVertexAttrib2sv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLshort *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttrib2sv(index, v);
+}
+
+static void APIENTRY trace_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+    trace_command(TRACE_glVertexAttrib3d);
+    trace_write_uint(index);
+    trace_write_double(x);
+    trace_write_double(y);
+    trace_write_double(z);
+    trace_real.glVertexAttrib3d(index, x, y, z);
+}
+
+static void trace_replay_glVertexAttrib3d(struct trace_reader *reader) {
+    if (!__glVertexAttrib3d) {
+        trace_missing(reader, TRACE_glVertexAttrib3d);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLdouble x = trace_read_double(reader);
+    GLdouble y = trace_read_double(reader);
+    GLdouble z = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glVertexAttrib3d(index, x, y, z);
+}
+
+static void APIENTRY trace_glVertexAttrib3dv(GLuint index, const GLdouble *v) {
+    trace_command(TRACE_glVertexAttrib3dv);
+    trace_write_uint(index);
+    trace_write_array(v, (size_t)(3), sizeof(GLdouble));
+    trace_real.glVertexAttrib3dv(index, v);
+}
+
+static void trace_replay_glVertexAttrib3dv(struct trace_reader *reader) {
+    if (!__glVertexAttrib3dv) {
+        trace_missing(reader, TRACE_glVertexAttrib3dv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLdouble *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttrib3dv(index, v);
+}
+
+static void APIENTRY trace_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+    trace_command(TRACE_glVertexAttrib3f);
+    trace_write_uint(index);
+    trace_write_float(x);
+    trace_write_float(y);
+    trace_write_float(z);
+    trace_real.glVertexAttrib3f(index, x, y, z);
+}
+
+static void trace_replay_glVertexAttrib3f(struct trace_reader *reader) {
+    if (!__glVertexAttrib3f) {
+        trace_missing(reader, TRACE_glVertexAttrib3f);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLfloat x = trace_read_float(reader);
+    GLfloat y = trace_read_float(reader);
+    GLfloat z = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glVertexAttrib3f(index, x, y, z);
+}
+
+static void APIENTRY trace_glVertexAttrib3fv(GLuint index, const GLfloat *v) {
+    trace_command(TRACE_glVertexAttrib3fv);
+    trace_write_uint(index);
+    trace_write_array(v, (size_t)(3), sizeof(GLfloat));
+    trace_real.glVertexAttrib3fv(index, v);
+}
+
+static void trace_replay_glVertexAttrib3fv(struct trace_reader *reader) {
+    if (!__glVertexAttrib3fv) {
+        trace_missing(reader, TRACE_glVertexAttrib3fv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLfloat *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttrib3fv(index, v);
+}
+
+static void APIENTRY trace_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) {
+    trace_command(TRACE_glVertexAttrib3s);
+    trace_write_uint(index);
+    trace_write_int(x);
+    trace_write_int(y);
+    trace_write_int(z);
+    trace_real.glVertexAttrib3s(index, x, y, z);
+}
+
+static void trace_replay_glVertexAttrib3s(struct trace_reader *reader) {
+    if (!__glVertexAttrib3s) {
+        trace_missing(reader, TRACE_glVertexAttrib3s);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLshort x = (GLshort)trace_read_int(reader);
+    GLshort y = (GLshort)trace_read_int(reader);
+    GLshort z = (GLshort)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glVertexAttrib3s(index, x, y, z);
+}
+
+static void APIENTRY trace_glVertexAttrib3sv(GLuint index, const GLshort *v) {
+    trace_command(TRACE_glVertexAttrib3sv);
+    trace_write_uint(index);
+    trace_write_array(v, (size_t)(3), sizeof(GLshort));
+    trace_real.glVertexAttrib3sv(index, v);
+}
+
+static void trace_replay_glVertexAttrib3sv(struct trace_reader *reader) {
+    if (!__glVertexAttrib3sv) {
+        trace_missing(reader, TRACE_glVertexAttrib3sv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLshort *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttrib3sv(index, v);
+}
+
+static void APIENTRY trace_glVertexAttrib4Nbv(GLuint index, const GLbyte *v) {
+    trace_command(TRACE_glVertexAttrib4Nbv);
+    trace_write_uint(index);
+    trace_write_array(v, (size_t)(4), sizeof(GLbyte));
+    trace_real.glVertexAttrib4Nbv(index, v);
+}
+
+static void trace_replay_glVertexAttrib4Nbv(struct trace_reader *reader) {
+    if (!__glVertexAttrib4Nbv) {
+        trace_missing(reader, TRACE_glVertexAttrib4Nbv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLbyte *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttrib4Nbv(index, v);
+}
+
+static void APIENTRY trace_glVertexAttrib4Niv(GLuint index, const GLint *v) {
+    trace_command(TRACE_glVertexAttrib4Niv);
+    trace_write_uint(index);
+    trace_write_array(v, (size_t)(4), sizeof(GLint));
+    trace_real.glVertexAttrib4Niv(index, v);
+}
+
+static void trace_replay_glVertexAttrib4Niv(struct trace_reader *reader) {
+    if (!__glVertexAttrib4Niv) {
+        trace_missing(reader, TRACE_glVertexAttrib4Niv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLint *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttrib4Niv(index, v);
+}
+
+static void APIENTRY trace_glVertexAttrib4Nsv(GLuint index, const GLshort *v) {
+    trace_command(TRACE_glVertexAttrib4Nsv);
+    trace_write_uint(index);
+    trace_write_array(v, (size_t)(4), sizeof(GLshort));
+    trace_real.glVertexAttrib4Nsv(index, v);
+}
+
+static void trace_replay_glVertexAttrib4Nsv(struct trace_reader *reader) {
+    if (!__glVertexAttrib4Nsv) {
+        trace_missing(reader, TRACE_glVertexAttrib4Nsv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLshort *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttrib4Nsv(index, v);
+}
+
+static void APIENTRY trace_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+    trace_command(TRACE_glVertexAttrib4Nub);
+    trace_write_uint(index);
+    trace_write_uint(x);
+    trace_write_uint(y);
+    trace_write_uint(z);
+    trace_write_uint(w);
+    trace_real.glVertexAttrib4Nub(index, x, y, z, w);
+}
+
+static void trace_replay_glVertexAttrib4Nub(struct trace_reader *reader) {
+    if (!__glVertexAttrib4Nub) {
+        trace_missing(reader, TRACE_glVertexAttrib4Nub);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLubyte x = (GLubyte)trace_read_uint(reader);
+    GLubyte y = (GLubyte)trace_read_uint(reader);
+    GLubyte z = (GLubyte)trace_read_uint(reader);
+    GLubyte w = (GLubyte)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glVertexAttrib4Nub(index, x, y, z, w);
+}
+
+static void APIENTRY trace_glVertexAttrib4Nubv(GLuint index, const GLubyte *v) {
+    trace_command(TRACE_glVertexAttrib4Nubv);
+    trace_write_uint(index);
+    trace_write_array(v, (size_t)(4), sizeof(GLubyte));
+    trace_real.glVertexAttrib4Nubv(index, v);
+}
+
+static void trace_replay_glVertexAttrib4Nubv(struct trace_reader *reader) {
+    if (!__glVertexAttrib4Nubv) {
+        trace_missing(reader, TRACE_glVertexAttrib4Nubv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLubyte *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttrib4Nubv(index, v);
+}
+
+static void APIENTRY trace_glVertexAttrib4Nuiv(GLuint index, const GLuint *v) {
+    trace_command(TRACE_glVertexAttrib4Nuiv);
+    trace_write_uint(index);
+    trace_write_array(v, (size_t)(4), sizeof(GLuint));
+    trace_real.glVertexAttrib4Nuiv(index, v);
+}
+
+static void trace_replay_glVertexAttrib4Nuiv(struct trace_reader *reader) {
+    if (!__glVertexAttrib4Nuiv) {
+        trace_missing(reader, TRACE_glVertexAttrib4Nuiv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLuint *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttrib4Nuiv(index, v);
+}
+
+static void APIENTRY trace_glVertexAttrib4Nusv(GLuint index, const GLushort *v) {
+    trace_command(TRACE_glVertexAttrib4Nusv);
+    trace_write_uint(index);
+    trace_write_array(v, (size_t)(4), sizeof(GLushort));
+    trace_real.glVertexAttrib4Nusv(index, v);
+}
+
+static void trace_replay_glVertexAttrib4Nusv(struct trace_reader *reader) {
+    if (!__glVertexAttrib4Nusv) {
+        trace_missing(reader, TRACE_glVertexAttrib4Nusv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLushort *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttrib4Nusv(index, v);
+}
+
+static void APIENTRY trace_glVertexAttrib4bv(GLuint index, const GLbyte *v) {
+    trace_command(TRACE_glVertexAttrib4bv);
+    trace_write_uint(index);
+    trace_write_array(v, (size_t)(4), sizeof(GLbyte));
+    trace_real.glVertexAttrib4bv(index, v);
+}
+
+static void trace_replay_glVertexAttrib4bv(struct trace_reader *reader) {
+    if (!__glVertexAttrib4bv) {
+        trace_missing(reader, TRACE_glVertexAttrib4bv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLbyte *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttrib4bv(index, v);
+}
+
+static void APIENTRY trace_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    trace_command(TRACE_glVertexAttrib4d);
+    trace_write_uint(index);
+    trace_write_double(x);
+    trace_write_double(y);
+    trace_write_double(z);
+    trace_write_double(w);
+    trace_real.glVertexAttrib4d(index, x, y, z, w);
+}
+
+static void trace_replay_glVertexAttrib4d(struct trace_reader *reader) {
+    if (!__glVertexAttrib4d) {
+        trace_missing(reader, TRACE_glVertexAttrib4d);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLdouble x = trace_read_double(reader);
+    GLdouble y = trace_read_double(reader);
+    GLdouble z = trace_read_double(reader);
+    GLdouble w = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glVertexAttrib4d(index, x, y, z, w);
+}
+
+static void APIENTRY trace_glVertexAttrib4dv(GLuint index, const GLdouble *v) {
+    trace_command(TRACE_glVertexAttrib4dv);
+    trace_write_uint(index);
+    trace_write_array(v, (size_t)(4), sizeof(GLdouble));
+    trace_real.glVertexAttrib4dv(index, v);
+}
+
+static void trace_replay_glVertexAttrib4dv(struct trace_reader *reader) {
+    if (!__glVertexAttrib4dv) {
+        trace_missing(reader, TRACE_glVertexAttrib4dv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLdouble *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttrib4dv(index, v);
+}
+
+static void APIENTRY trace_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+    trace_command(TRACE_glVertexAttrib4f);
+    trace_write_uint(index);
+    trace_write_float(x);
+    trace_write_float(y);
+    trace_write_float(z);
+    trace_write_float(w);
+    trace_real.glVertexAttrib4f(index, x, y, z, w);
+}
+
+static void trace_replay_glVertexAttrib4f(struct trace_reader *reader) {
+    if (!__glVertexAttrib4f) {
+        trace_missing(reader, TRACE_glVertexAttrib4f);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLfloat x = trace_read_float(reader);
+    GLfloat y = trace_read_float(reader);
+    GLfloat z = trace_read_float(reader);
+    GLfloat w = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glVertexAttrib4f(index, x, y, z, w);
+}
+
+static void APIENTRY trace_glVertexAttrib4fv(GLuint index, const GLfloat *v) {
+    trace_command(TRACE_glVertexAttrib4fv);
+    trace_write_uint(index);
+    trace_write_array(v, (size_t)(4), sizeof(GLfloat));
+    trace_real.glVertexAttrib4fv(index, v);
+}
+
+static void trace_replay_glVertexAttrib4fv(struct trace_reader *reader) {
+    if (!__glVertexAttrib4fv) {
+        trace_missing(reader, TRACE_glVertexAttrib4fv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLfloat *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttrib4fv(index, v);
+}
+
+static void APIENTRY trace_glVertexAttrib4iv(GLuint index, const GLint *v) {
+    trace_command(TRACE_glVertexAttrib4iv);
+    trace_write_uint(index);
+    trace_write_array(v, (size_t)(4), sizeof(GLint));
+    trace_real.glVertexAttrib4iv(index, v);
+}
+
+static void trace_replay_glVertexAttrib4iv(struct trace_reader *reader) {
+    if (!__glVertexAttrib4iv) {
+        trace_missing(reader, TRACE_glVertexAttrib4iv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLint *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttrib4iv(index, v);
+}
+
+static void APIENTRY trace_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+    trace_command(TRACE_glVertexAttrib4s);
+    trace_write_uint(index);
+    trace_write_int(x);
+    trace_write_int(y);
+    trace_write_int(z);
+    trace_write_int(w);
+    trace_real.glVertexAttrib4s(index, x, y, z, w);
+}
+
+static void trace_replay_glVertexAttrib4s(struct trace_reader *reader) {
+    if (!__glVertexAttrib4s) {
+        trace_missing(reader, TRACE_glVertexAttrib4s);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLshort x = (GLshort)trace_read_int(reader);
+    GLshort y = (GLshort)trace_read_int(reader);
+    GLshort z = (GLshort)trace_read_int(reader);
+    GLshort w = (GLshort)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glVertexAttrib4s(index, x, y, z, w);
+}
+
+static void APIENTRY trace_glVertexAttrib4sv(GLuint index, const GLshort *v) {
+    trace_command(TRACE_glVertexAttrib4sv);
+    trace_write_uint(index);
+    trace_write_array(v, (size_t)(4), sizeof(GLshort));
+    trace_real.glVertexAttrib4sv(index, v);
+}
+
+static void trace_replay_glVertexAttrib4sv(struct trace_reader *reader) {
+    if (!__glVertexAttrib4sv) {
+        trace_missing(reader, TRACE_glVertexAttrib4sv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLshort *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttrib4sv(index, v);
+}
+
+static void APIENTRY trace_glVertexAttrib4ubv(GLuint index, const GLubyte *v) {
+    trace_command(TRACE_glVertexAttrib4ubv);
+    trace_write_uint(index);
+    trace_write_array(v, (size_t)(4), sizeof(GLubyte));
+    trace_real.glVertexAttrib4ubv(index, v);
+}
+
+static void trace_replay_glVertexAttrib4ubv(struct trace_reader *reader) {
+    if (!__glVertexAttrib4ubv) {
+        trace_missing(reader, TRACE_glVertexAttrib4ubv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLubyte *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttrib4ubv(index, v);
+}
+
+static void APIENTRY trace_glVertexAttrib4uiv(GLuint index, const GLuint *v) {
+    trace_command(TRACE_glVertexAttrib4uiv);
+    trace_write_uint(index);
+    trace_write_array(v, (size_t)(4), sizeof(GLuint));
+    trace_real.glVertexAttrib4uiv(index, v);
+}
+
+static void trace_replay_glVertexAttrib4uiv(struct trace_reader *reader) {
+    if (!__glVertexAttrib4uiv) {
+        trace_missing(reader, TRACE_glVertexAttrib4uiv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLuint *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttrib4uiv(index, v);
+}
+
+static void APIENTRY trace_glVertexAttrib4usv(GLuint index, const GLushort *v) {
+    trace_command(TRACE_glVertexAttrib4usv);
+    trace_write_uint(index);
+    trace_write_array(v, (size_t)(4), sizeof(GLushort));
+    trace_real.glVertexAttrib4usv(index, v);
+}
+
+static void trace_replay_glVertexAttrib4usv(struct trace_reader *reader) {
+    if (!__glVertexAttrib4usv) {
+        trace_missing(reader, TRACE_glVertexAttrib4usv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLushort *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttrib4usv(index, v);
+}
+
+static void APIENTRY trace_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) {
+    trace_command(TRACE_glVertexAttribPointer);
+    trace_write_uint(index);
+    trace_write_int(size);
+    trace_write_uint(type);
+    trace_write_uint(normalized);
+    trace_write_int(stride);
+    trace_write_offset(pointer);
+    trace_real.glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+}
+
+static void trace_replay_glVertexAttribPointer(struct trace_reader *reader) {
+    if (!__glVertexAttribPointer) {
+        trace_missing(reader, TRACE_glVertexAttribPointer);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLint size = (GLint)trace_read_int(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLboolean normalized = (GLboolean)trace_read_uint(reader);
+    GLsizei stride = (GLsizei)trace_read_int(reader);
+    const void *pointer = trace_read_offset(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+}
+
+#endif
+
+#if FUNGL_VERSION >= GL_VERSION_2_1
+static void APIENTRY trace_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    trace_command(TRACE_glUniformMatrix2x3fv);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_uint(transpose);
+    trace_write_array(value, (size_t)((count)*6), sizeof(GLfloat));
+    trace_real.glUniformMatrix2x3fv(location, count, transpose, value);
+}
+
+static void trace_replay_glUniformMatrix2x3fv(struct trace_reader *reader) {
+    if (!__glUniformMatrix2x3fv) {
+        trace_missing(reader, TRACE_glUniformMatrix2x3fv);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLboolean transpose = (GLboolean)trace_read_uint(reader);
+    const GLfloat *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glUniformMatrix2x3fv(location, count, transpose, value);
+}
+
+static void APIENTRY trace_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    trace_command(TRACE_glUniformMatrix3x2fv);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_uint(transpose);
+    trace_write_array(value, (size_t)((count)*6), sizeof(GLfloat));
+    trace_real.glUniformMatrix3x2fv(location, count, transpose, value);
+}
+
+static void trace_replay_glUniformMatrix3x2fv(struct trace_reader *reader) {
+    if (!__glUniformMatrix3x2fv) {
+        trace_missing(reader, TRACE_glUniformMatrix3x2fv);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLboolean transpose = (GLboolean)trace_read_uint(reader);
+    const GLfloat *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glUniformMatrix3x2fv(location, count, transpose, value);
+}
+
+static void APIENTRY trace_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    trace_command(TRACE_glUniformMatrix2x4fv);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_uint(transpose);
+    trace_write_array(value, (size_t)((count)*8), sizeof(GLfloat));
+    trace_real.glUniformMatrix2x4fv(location, count, transpose, value);
+}
+
+static void trace_replay_glUniformMatrix2x4fv(struct trace_reader *reader) {
+    if (!__glUniformMatrix2x4fv) {
+        trace_missing(reader, TRACE_glUniformMatrix2x4fv);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLboolean transpose = (GLboolean)trace_read_uint(reader);
+    const GLfloat *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glUniformMatrix2x4fv(location, count, transpose, value);
+}
+
+static void APIENTRY trace_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    trace_command(TRACE_glUniformMatrix4x2fv);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_uint(transpose);
+    trace_write_array(value, (size_t)((count)*8), sizeof(GLfloat));
+    trace_real.glUniformMatrix4x2fv(location, count, transpose, value);
+}
+
+static void trace_replay_glUniformMatrix4x2fv(struct trace_reader *reader) {
+    if (!__glUniformMatrix4x2fv) {
+        trace_missing(reader, TRACE_glUniformMatrix4x2fv);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLboolean transpose = (GLboolean)trace_read_uint(reader);
+    const GLfloat *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glUniformMatrix4x2fv(location, count, transpose, value);
+}
+
+static void APIENTRY trace_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    trace_command(TRACE_glUniformMatrix3x4fv);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_uint(transpose);
+    trace_write_array(value, (size_t)((count)*12), sizeof(GLfloat));
+    trace_real.glUniformMatrix3x4fv(location, count, transpose, value);
+}
+
+static void trace_replay_glUniformMatrix3x4fv(struct trace_reader *reader) {
+    if (!__glUniformMatrix3x4fv) {
+        trace_missing(reader, TRACE_glUniformMatrix3x4fv);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLboolean transpose = (GLboolean)trace_read_uint(reader);
+    const GLfloat *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glUniformMatrix3x4fv(location, count, transpose, value);
+}
+
+static void APIENTRY trace_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    trace_command(TRACE_glUniformMatrix4x3fv);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_uint(transpose);
+    trace_write_array(value, (size_t)((count)*12), sizeof(GLfloat));
+    trace_real.glUniformMatrix4x3fv(location, count, transpose, value);
+}
+
+static void trace_replay_glUniformMatrix4x3fv(struct trace_reader *reader) {
+    if (!__glUniformMatrix4x3fv) {
+        trace_missing(reader, TRACE_glUniformMatrix4x3fv);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLboolean transpose = (GLboolean)trace_read_uint(reader);
+    const GLfloat *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glUniformMatrix4x3fv(location, count, transpose, value);
+}
+
+#endif
+
+#if FUNGL_VERSION >= GL_VERSION_3_0
+static void APIENTRY trace_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+    trace_command(TRACE_glColorMaski);
+    trace_write_uint(index);
+    trace_write_uint(r);
+    trace_write_uint(g);
+    trace_write_uint(b);
+    trace_write_uint(a);
+    trace_real.glColorMaski(index, r, g, b, a);
+}
+
+static void trace_replay_glColorMaski(struct trace_reader *reader) {
+    if (!__glColorMaski) {
+        trace_missing(reader, TRACE_glColorMaski);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLboolean r = (GLboolean)trace_read_uint(reader);
+    GLboolean g = (GLboolean)trace_read_uint(reader);
+    GLboolean b = (GLboolean)trace_read_uint(reader);
+    GLboolean a = (GLboolean)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glColorMaski(index, r, g, b, a);
+}
+
+static void APIENTRY trace_glEnablei(GLenum target, GLuint index) {
+    trace_command(TRACE_glEnablei);
+    trace_write_uint(target);
+    trace_write_uint(index);
+    trace_real.glEnablei(target, index);
+}
+
+static void trace_replay_glEnablei(struct trace_reader *reader) {
+    if (!__glEnablei) {
+        trace_missing(reader, TRACE_glEnablei);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLuint index = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glEnablei(target, index);
+}
+
+static void APIENTRY trace_glDisablei(GLenum target, GLuint index) {
+    trace_command(TRACE_glDisablei);
+    trace_write_uint(target);
+    trace_write_uint(index);
+    trace_real.glDisablei(target, index);
+}
+
+static void trace_replay_glDisablei(struct trace_reader *reader) {
+    if (!__glDisablei) {
+        trace_missing(reader, TRACE_glDisablei);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLuint index = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glDisablei(target, index);
+}
+
+static void APIENTRY trace_glBeginTransformFeedback(GLenum primitiveMode) {
+    trace_command(TRACE_glBeginTransformFeedback);
+    trace_write_uint(primitiveMode);
+    trace_real.glBeginTransformFeedback(primitiveMode);
+}
+
+static void trace_replay_glBeginTransformFeedback(struct trace_reader *reader) {
+    if (!__glBeginTransformFeedback) {
+        trace_missing(reader, TRACE_glBeginTransformFeedback);
+        return;
+    }
+    GLenum primitiveMode = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glBeginTransformFeedback(primitiveMode);
+}
+
+static void APIENTRY trace_glEndTransformFeedback(void) {
+    trace_command(TRACE_glEndTransformFeedback);
+    trace_real.glEndTransformFeedback();
+}
+
+static void trace_replay_glEndTransformFeedback(struct trace_reader *reader) {
+    if (!__glEndTransformFeedback) {
+        trace_missing(reader, TRACE_glEndTransformFeedback);
+        return;
+    }
+    if (reader->error)
+        return;
+    __glEndTransformFeedback();
+}
+
+static void APIENTRY trace_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    trace_command(TRACE_glBindBufferRange);
+    trace_write_uint(target);
+    trace_write_uint(index);
+    trace_write_uint(buffer);
+    trace_write_int(offset);
+    trace_write_int(size);
+    trace_real.glBindBufferRange(target, index, buffer, offset, size);
+}
+
+static void trace_replay_glBindBufferRange(struct trace_reader *reader) {
+    if (!__glBindBufferRange) {
+        trace_missing(reader, TRACE_glBindBufferRange);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLuint buffer = trace_name(reader, TRACE_NAME_BUFFER, (GLuint)trace_read_uint(reader));
+    GLintptr offset = (GLintptr)trace_read_int(reader);
+    GLsizeiptr size = (GLsizeiptr)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glBindBufferRange(target, index, buffer, offset, size);
+}
+
+static void APIENTRY trace_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+    trace_command(TRACE_glBindBufferBase);
+    trace_write_uint(target);
+    trace_write_uint(index);
+    trace_write_uint(buffer);
+    trace_real.glBindBufferBase(target, index, buffer);
+}
+
+static void trace_replay_glBindBufferBase(struct trace_reader *reader) {
+    if (!__glBindBufferBase) {
+        trace_missing(reader, TRACE_glBindBufferBase);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLuint buffer = trace_name(reader, TRACE_NAME_BUFFER, (GLuint)trace_read_uint(reader));
+    if (reader->error)
+        return;
+    __glBindBufferBase(target, index, buffer);
+}
+
+static void APIENTRY trace_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) {
+    trace_command(TRACE_glTransformFeedbackVaryings);
+    trace_write_uint(program);
+    trace_write_int(count);
+    trace_write_strings(varyings, count, NULL);
+    trace_write_uint(bufferMode);
+    trace_real.glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+}
+
+static void trace_replay_glTransformFeedbackVaryings(struct trace_reader *reader) {
+    if (!__glTransformFeedbackVaryings) {
+        trace_missing(reader, TRACE_glTransformFeedbackVaryings);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLchar *const*varyings = trace_read_strings(reader);
+    GLenum bufferMode = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+}
+
+static void APIENTRY trace_glClampColor(GLenum target, GLenum clamp) {
+    trace_command(TRACE_glClampColor);
+    trace_write_uint(target);
+    trace_write_uint(clamp);
+    trace_real.glClampColor(target, clamp);
+}
+
+static void trace_replay_glClampColor(struct trace_reader *reader) {
+    if (!__glClampColor) {
+        trace_missing(reader, TRACE_glClampColor);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLenum clamp = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glClampColor(target, clamp);
+}
+
+static void APIENTRY trace_glBeginConditionalRender(GLuint id, GLenum mode) {
+    trace_command(TRACE_glBeginConditionalRender);
+    trace_write_uint(id);
+    trace_write_uint(mode);
+    trace_real.glBeginConditionalRender(id, mode);
+}
+
+static void trace_replay_glBeginConditionalRender(struct trace_reader *reader) {
+    if (!__glBeginConditionalRender) {
+        trace_missing(reader, TRACE_glBeginConditionalRender);
+        return;
+    }
+    GLuint id = (GLuint)trace_read_uint(reader);
+    GLenum mode = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glBeginConditionalRender(id, mode);
+}
+
+static void APIENTRY trace_glEndConditionalRender(void) {
+    trace_command(TRACE_glEndConditionalRender);
+    trace_real.glEndConditionalRender();
+}
+
+static void trace_replay_glEndConditionalRender(struct trace_reader *reader) {
+    if (!__glEndConditionalRender) {
+        trace_missing(reader, TRACE_glEndConditionalRender);
+        return;
+    }
+    if (reader->error)
+        return;
+    __glEndConditionalRender();
+}
+
+static void APIENTRY trace_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+    trace_command(TRACE_glVertexAttribIPointer);
+    trace_write_uint(index);
+    trace_write_int(size);
+    trace_write_uint(type);
+    trace_write_int(stride);
+    trace_write_offset(pointer);
+    trace_real.glVertexAttribIPointer(index, size, type, stride, pointer);
+}
+
+static void trace_replay_glVertexAttribIPointer(struct trace_reader *reader) {
+    if (!__glVertexAttribIPointer) {
+        trace_missing(reader, TRACE_glVertexAttribIPointer);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLint size = (GLint)trace_read_int(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLsizei stride = (GLsizei)trace_read_int(reader);
+    const void *pointer = trace_read_offset(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribIPointer(index, size, type, stride, pointer);
+}
+
+static void APIENTRY trace_glVertexAttribI1i(GLuint index, GLint x) {
+    trace_command(TRACE_glVertexAttribI1i);
+    trace_write_uint(index);
+    trace_write_int(x);
+    trace_real.glVertexAttribI1i(index, x);
+}
+
+static void trace_replay_glVertexAttribI1i(struct trace_reader *reader) {
+    if (!__glVertexAttribI1i) {
+        trace_missing(reader, TRACE_glVertexAttribI1i);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLint x = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribI1i(index, x);
+}
+
+static void APIENTRY trace_glVertexAttribI2i(GLuint index, GLint x, GLint y) {
+    trace_command(TRACE_glVertexAttribI2i);
+    trace_write_uint(index);
+    trace_write_int(x);
+    trace_write_int(y);
+    trace_real.glVertexAttribI2i(index, x, y);
+}
+
+static void trace_replay_glVertexAttribI2i(struct trace_reader *reader) {
+    if (!__glVertexAttribI2i) {
+        trace_missing(reader, TRACE_glVertexAttribI2i);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLint x = (GLint)trace_read_int(reader);
+    GLint y = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribI2i(index, x, y);
+}
+
+static void APIENTRY trace_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) {
+    trace_command(TRACE_glVertexAttribI3i);
+    trace_write_uint(index);
+    trace_write_int(x);
+    trace_write_int(y);
+    trace_write_int(z);
+    trace_real.glVertexAttribI3i(index, x, y, z);
+}
+
+static void trace_replay_glVertexAttribI3i(struct trace_reader *reader) {
+    if (!__glVertexAttribI3i) {
+        trace_missing(reader, TRACE_glVertexAttribI3i);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLint x = (GLint)trace_read_int(reader);
+    GLint y = (GLint)trace_read_int(reader);
+    GLint z = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribI3i(index, x, y, z);
+}
+
+static void APIENTRY trace_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+    trace_command(TRACE_glVertexAttribI4i);
+    trace_write_uint(index);
+    trace_write_int(x);
+    trace_write_int(y);
+    trace_write_int(z);
+    trace_write_int(w);
+    trace_real.glVertexAttribI4i(index, x, y, z, w);
+}
+
+static void trace_replay_glVertexAttribI4i(struct trace_reader *reader) {
+    if (!__glVertexAttribI4i) {
+        trace_missing(reader, TRACE_glVertexAttribI4i);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLint x = (GLint)trace_read_int(reader);
+    GLint y = (GLint)trace_read_int(reader);
+    GLint z = (GLint)trace_read_int(reader);
+    GLint w = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribI4i(index, x, y, z, w);
+}
+
+static void APIENTRY trace_glVertexAttribI1ui(GLuint index, GLuint x) {
+    trace_command(TRACE_glVertexAttribI1ui);
+    trace_write_uint(index);
+    trace_write_uint(x);
+    trace_real.glVertexAttribI1ui(index, x);
+}
+
+static void trace_replay_glVertexAttribI1ui(struct trace_reader *reader) {
+    if (!__glVertexAttribI1ui) {
+        trace_missing(reader, TRACE_glVertexAttribI1ui);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLuint x = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribI1ui(index, x);
+}
+
+static void APIENTRY trace_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) {
+    trace_command(TRACE_glVertexAttribI2ui);
+    trace_write_uint(index);
+    trace_write_uint(x);
+    trace_write_uint(y);
+    trace_real.glVertexAttribI2ui(index, x, y);
+}
+
+static void trace_replay_glVertexAttribI2ui(struct trace_reader *reader) {
+    if (!__glVertexAttribI2ui) {
+        trace_missing(reader, TRACE_glVertexAttribI2ui);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLuint x = (GLuint)trace_read_uint(reader);
+    GLuint y = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribI2ui(index, x, y);
+}
+
+static void APIENTRY trace_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) {
+    trace_command(TRACE_glVertexAttribI3ui);
+    trace_write_uint(index);
+    trace_write_uint(x);
+    trace_write_uint(y);
+    trace_write_uint(z);
+    trace_real.glVertexAttribI3ui(index, x, y, z);
+}
+
+static void trace_replay_glVertexAttribI3ui(struct trace_reader *reader) {
+    if (!__glVertexAttribI3ui) {
+        trace_missing(reader, TRACE_glVertexAttribI3ui);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLuint x = (GLuint)trace_read_uint(reader);
+    GLuint y = (GLuint)trace_read_uint(reader);
+    GLuint z = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribI3ui(index, x, y, z);
+}
+
+static void APIENTRY trace_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+    trace_command(TRACE_glVertexAttribI4ui);
+    trace_write_uint(index);
+    trace_write_uint(x);
+    trace_write_uint(y);
+    trace_write_uint(z);
+    trace_write_uint(w);
+    trace_real.glVertexAttribI4ui(index, x, y, z, w);
+}
+
+static void trace_replay_glVertexAttribI4ui(struct trace_reader *reader) {
+    if (!__glVertexAttribI4ui) {
+        trace_missing(reader, TRACE_glVertexAttribI4ui);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLuint x = (GLuint)trace_read_uint(reader);
+    GLuint y = (GLuint)trace_read_uint(reader);
+    GLuint z = (GLuint)trace_read_uint(reader);
+    GLuint w = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribI4ui(index, x, y, z, w);
+}
+
+static void APIENTRY trace_glVertexAttribI1iv(GLuint index, const GLint *v) {
+    trace_command(TRACE_glVertexAttribI1iv);
+    trace_write_uint(index);
+    trace_write_array(v, (size_t)(1), sizeof(GLint));
+    trace_real.glVertexAttribI1iv(index, v);
+}
+
+static void trace_replay_glVertexAttribI1iv(struct trace_reader *reader) {
+    if (!__glVertexAttribI1iv) {
+        trace_missing(reader, TRACE_glVertexAttribI1iv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLint *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribI1iv(index, v);
+}
+
+static void APIENTRY trace_glVertexAttribI2iv(GLuint index, const GLint *v) {
+    trace_command(TRACE_glVertexAttribI2iv);
+    trace_write_uint(index);
+    trace_write_array(v, (size_t)(2), sizeof(GLint));
+    trace_real.glVertexAttribI2iv(index, v);
+}
+
+static void trace_replay_glVertexAttribI2iv(struct trace_reader *reader) {
+    if (!__glVertexAttribI2iv) {
+        trace_missing(reader, TRACE_glVertexAttribI2iv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLint *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribI2iv(index, v);
+}
+
+static void APIENTRY trace_glVertexAttribI3iv(GLuint index, const GLint *v) {
+    trace_command(TRACE_glVertexAttribI3iv);
+    trace_write_uint(index);
+    trace_write_array(v, (size_t)(3), sizeof(GLint));
+    trace_real.glVertexAttribI3iv(index, v);
+}
+
+static void trace_replay_glVertexAttribI3iv(struct trace_reader *reader) {
+    if (!__glVertexAttribI3iv) {
+        trace_missing(reader, TRACE_glVertexAttribI3iv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLint *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribI3iv(index, v);
+}
+
+static void APIENTRY trace_glVertexAttribI4iv(GLuint index, const GLint *v) {
+    trace_command(TRACE_glVertexAttribI4iv);
+    trace_write_uint(index);
+    trace_write_array(v, (size_t)(4), sizeof(GLint));
+    trace_real.glVertexAttribI4iv(index, v);
+}
+
+static void trace_replay_glVertexAttribI4iv(struct trace_reader *reader) {
+    if (!__glVertexAttribI4iv) {
+        trace_missing(reader, TRACE_glVertexAttribI4iv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLint *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribI4iv(index, v);
+}
+
+static void APIENTRY trace_glVertexAttribI1uiv(GLuint index, const GLuint *v) {
+    trace_command(TRACE_glVertexAttribI1uiv);
+    trace_write_uint(index);
+    trace_write_array(v, (size_t)(1), sizeof(GLuint));
+    trace_real.glVertexAttribI1uiv(index, v);
+}
+
+static void trace_replay_glVertexAttribI1uiv(struct trace_reader *reader) {
+    if (!__glVertexAttribI1uiv) {
+        trace_missing(reader, TRACE_glVertexAttribI1uiv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLuint *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribI1uiv(index, v);
+}
+
+static void APIENTRY trace_glVertexAttribI2uiv(GLuint index, const GLuint *v) {
+    trace_command(TRACE_glVertexAttribI2uiv);
+    trace_write_uint(index);
+    trace_write_array(v, (size_t)(2), sizeof(GLuint));
+    trace_real.glVertexAttribI2uiv(index, v);
+}
+
+static void trace_replay_glVertexAttribI2uiv(struct trace_reader *reader) {
+    if (!__glVertexAttribI2uiv) {
+        trace_missing(reader, TRACE_glVertexAttribI2uiv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLuint *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribI2uiv(index, v);
+}
+
+static void APIENTRY trace_glVertexAttribI3uiv(GLuint index, const GLuint *v) {
+    trace_command(TRACE_glVertexAttribI3uiv);
+    trace_write_uint(index);
+    trace_write_array(v, (size_t)(3), sizeof(GLuint));
+    trace_real.glVertexAttribI3uiv(index, v);
+}
+
+static void trace_replay_glVertexAttribI3uiv(struct trace_reader *reader) {
+    if (!__glVertexAttribI3uiv) {
+        trace_missing(reader, TRACE_glVertexAttribI3uiv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLuint *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribI3uiv(index, v);
+}
+
+static void APIENTRY trace_glVertexAttribI4uiv(GLuint index, const GLuint *v) {
+    trace_command(TRACE_glVertexAttribI4uiv);
+    trace_write_uint(index);
+    trace_write_array(v, (size_t)(4), sizeof(GLuint));
+    trace_real.glVertexAttribI4uiv(index, v);
+}
+
+static void trace_replay_glVertexAttribI4uiv(struct trace_reader *reader) {
+    if (!__glVertexAttribI4uiv) {
+        trace_missing(reader, TRACE_glVertexAttribI4uiv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLuint *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribI4uiv(index, v);
+}
+
+static void APIENTRY trace_glVertexAttribI4bv(GLuint index, const GLbyte *v) {
+    trace_command(TRACE_glVertexAttribI4bv);
+    trace_write_uint(index);
+    trace_write_array(v, (size_t)(4), sizeof(GLbyte));
+    trace_real.glVertexAttribI4bv(index, v);
+}
+
+static void trace_replay_glVertexAttribI4bv(struct trace_reader *reader) {
+    if (!__glVertexAttribI4bv) {
+        trace_missing(reader, TRACE_glVertexAttribI4bv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLbyte *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribI4bv(index, v);
+}
+
+static void APIENTRY trace_glVertexAttribI4sv(GLuint index, const GLshort *v) {
+    trace_command(TRACE_glVertexAttribI4sv);
+    trace_write_uint(index);
+    trace_write_array(v, (size_t)(4), sizeof(GLshort));
+    trace_real.glVertexAttribI4sv(index, v);
+}
+
+static void trace_replay_glVertexAttribI4sv(struct trace_reader *reader) {
+    if (!__glVertexAttribI4sv) {
+        trace_missing(reader, TRACE_glVertexAttribI4sv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLshort *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribI4sv(index, v);
+}
+
+static void APIENTRY trace_glVertexAttribI4ubv(GLuint index, const GLubyte *v) {
+    trace_command(TRACE_glVertexAttribI4ubv);
+    trace_write_uint(index);
+    trace_write_array(v, (size_t)(4), sizeof(GLubyte));
+    trace_real.glVertexAttribI4ubv(index, v);
+}
+
+static void trace_replay_glVertexAttribI4ubv(struct trace_reader *reader) {
+    if (!__glVertexAttribI4ubv) {
+        trace_missing(reader, TRACE_glVertexAttribI4ubv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLubyte *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribI4ubv(index, v);
+}
+
+static void APIENTRY trace_glVertexAttribI4usv(GLuint index, const GLushort *v) {
+    trace_command(TRACE_glVertexAttribI4usv);
+    trace_write_uint(index);
+    trace_write_array(v, (size_t)(4), sizeof(GLushort));
+    trace_real.glVertexAttribI4usv(index, v);
+}
+
+static void trace_replay_glVertexAttribI4usv(struct trace_reader *reader) {
+    if (!__glVertexAttribI4usv) {
+        trace_missing(reader, TRACE_glVertexAttribI4usv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLushort *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribI4usv(index, v);
+}
+
+static void APIENTRY trace_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name) {
+    trace_command(TRACE_glBindFragDataLocation);
+    trace_write_uint(program);
+    trace_write_uint(color);
+    trace_write_string(name, -1);
+    trace_real.glBindFragDataLocation(program, color, name);
+}
+
+static void trace_replay_glBindFragDataLocation(struct trace_reader *reader) {
+    if (!__glBindFragDataLocation) {
+        trace_missing(reader, TRACE_glBindFragDataLocation);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLuint color = (GLuint)trace_read_uint(reader);
+    const GLchar *name = trace_read_string(reader);
+    if (reader->error)
+        return;
+    __glBindFragDataLocation(program, color, name);
+}
+
+static void APIENTRY trace_glUniform1ui(GLint location, GLuint v0) {
+    trace_command(TRACE_glUniform1ui);
+    trace_write_int(location);
+    trace_write_uint(v0);
+    trace_real.glUniform1ui(location, v0);
+}
+
+static void trace_replay_glUniform1ui(struct trace_reader *reader) {
+    if (!__glUniform1ui) {
+        trace_missing(reader, TRACE_glUniform1ui);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLuint v0 = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glUniform1ui(location, v0);
+}
+
+static void APIENTRY trace_glUniform2ui(GLint location, GLuint v0, GLuint v1) {
+    trace_command(TRACE_glUniform2ui);
+    trace_write_int(location);
+    trace_write_uint(v0);
+    trace_write_uint(v1);
+    trace_real.glUniform2ui(location, v0, v1);
+}
+
+static void trace_replay_glUniform2ui(struct trace_reader *reader) {
+    if (!__glUniform2ui) {
+        trace_missing(reader, TRACE_glUniform2ui);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLuint v0 = (GLuint)trace_read_uint(reader);
+    GLuint v1 = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glUniform2ui(location, v0, v1);
+}
+
+static void APIENTRY trace_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+    trace_command(TRACE_glUniform3ui);
+    trace_write_int(location);
+    trace_write_uint(v0);
+    trace_write_uint(v1);
+    trace_write_uint(v2);
+    trace_real.glUniform3ui(location, v0, v1, v2);
+}
+
+static void trace_replay_glUniform3ui(struct trace_reader *reader) {
+    if (!__glUniform3ui) {
+        trace_missing(reader, TRACE_glUniform3ui);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLuint v0 = (GLuint)trace_read_uint(reader);
+    GLuint v1 = (GLuint)trace_read_uint(reader);
+    GLuint v2 = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glUniform3ui(location, v0, v1, v2);
+}
+
+static void APIENTRY trace_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+    trace_command(TRACE_glUniform4ui);
+    trace_write_int(location);
+    trace_write_uint(v0);
+    trace_write_uint(v1);
+    trace_write_uint(v2);
+    trace_write_uint(v3);
+    trace_real.glUniform4ui(location, v0, v1, v2, v3);
+}
+
+static void trace_replay_glUniform4ui(struct trace_reader *reader) {
+    if (!__glUniform4ui) {
+        trace_missing(reader, TRACE_glUniform4ui);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLuint v0 = (GLuint)trace_read_uint(reader);
+    GLuint v1 = (GLuint)trace_read_uint(reader);
+    GLuint v2 = (GLuint)trace_read_uint(reader);
+    GLuint v3 = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glUniform4ui(location, v0, v1, v2, v3);
+}
+
+static void APIENTRY trace_glUniform1uiv(GLint location, GLsizei count, const GLuint *value) {
+    trace_command(TRACE_glUniform1uiv);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_array(value, (size_t)((count)*1), sizeof(GLuint));
+    trace_real.glUniform1uiv(location, count, value);
+}
+
+static void trace_replay_glUniform1uiv(struct trace_reader *reader) {
+    if (!__glUniform1uiv) {
+        trace_missing(reader, TRACE_glUniform1uiv);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLuint *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glUniform1uiv(location, count, value);
+}
+
+static void APIENTRY trace_glUniform2uiv(GLint location, GLsizei count, const GLuint *value) {
+    trace_command(TRACE_glUniform2uiv);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_array(value, (size_t)((count)*2), sizeof(GLuint));
+    trace_real.glUniform2uiv(location, count, value);
+}
+
+static void trace_replay_glUniform2uiv(struct trace_reader *reader) {
+    if (!__glUniform2uiv) {
+        trace_missing(reader, TRACE_glUniform2uiv);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLuint *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glUniform2uiv(location, count, value);
+}
+
+static void APIENTRY trace_glUniform3uiv(GLint location, GLsizei count, const GLuint *value) {
+    trace_command(TRACE_glUniform3uiv);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_array(value, (size_t)((count)*3), sizeof(GLuint));
+    trace_real.glUniform3uiv(location, count, value);
+}
+
+static void trace_replay_glUniform3uiv(struct trace_reader *reader) {
+    if (!__glUniform3uiv) {
+        trace_missing(reader, TRACE_glUniform3uiv);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLuint *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glUniform3uiv(location, count, value);
+}
+
+static void APIENTRY trace_glUniform4uiv(GLint location, GLsizei count, const GLuint *value) {
+    trace_command(TRACE_glUniform4uiv);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_array(value, (size_t)((count)*4), sizeof(GLuint));
+    trace_real.glUniform4uiv(location, count, value);
+}
+
+static void trace_replay_glUniform4uiv(struct trace_reader *reader) {
+    if (!__glUniform4uiv) {
+        trace_missing(reader, TRACE_glUniform4uiv);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLuint *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glUniform4uiv(location, count, value);
+}
+
+static void APIENTRY trace_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params) {
+    trace_command(TRACE_glTexParameterIiv);
+    trace_write_uint(target);
+    trace_write_uint(pname);
+    trace_write_array(params, (size_t)(trace_pname_count(pname)), sizeof(GLint));
+    trace_real.glTexParameterIiv(target, pname, params);
+}
+
+static void trace_replay_glTexParameterIiv(struct trace_reader *reader) {
+    if (!__glTexParameterIiv) {
+        trace_missing(reader, TRACE_glTexParameterIiv);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    const GLint *params = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glTexParameterIiv(target, pname, params);
+}
+
+static void APIENTRY trace_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) {
+    trace_command(TRACE_glTexParameterIuiv);
+    trace_write_uint(target);
+    trace_write_uint(pname);
+    trace_write_array(params, (size_t)(trace_pname_count(pname)), sizeof(GLuint));
+    trace_real.glTexParameterIuiv(target, pname, params);
+}
+
+static void trace_replay_glTexParameterIuiv(struct trace_reader *reader) {
+    if (!__glTexParameterIuiv) {
+        trace_missing(reader, TRACE_glTexParameterIuiv);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    const GLuint *params = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glTexParameterIuiv(target, pname, params);
+}
+
+static void APIENTRY trace_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) {
+    trace_command(TRACE_glClearBufferiv);
+    trace_write_uint(buffer);
+    trace_write_int(drawbuffer);
+    trace_write_array(value, (size_t)(trace_clear_count(buffer)), sizeof(GLint));
+    trace_real.glClearBufferiv(buffer, drawbuffer, value);
+}
+
+static void trace_replay_glClearBufferiv(struct trace_reader *reader) {
+    if (!__glClearBufferiv) {
+        trace_missing(reader, TRACE_glClearBufferiv);
+        return;
+    }
+    GLenum buffer = (GLenum)trace_read_uint(reader);
+    GLint drawbuffer = (GLint)trace_read_int(reader);
+    const GLint *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glClearBufferiv(buffer, drawbuffer, value);
+}
+
+static void APIENTRY trace_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) {
+    trace_command(TRACE_glClearBufferuiv);
+    trace_write_uint(buffer);
+    trace_write_int(drawbuffer);
+    trace_write_array(value, (size_t)(trace_clear_count(buffer)), sizeof(GLuint));
+    trace_real.glClearBufferuiv(buffer, drawbuffer, value);
+}
+
+static void trace_replay_glClearBufferuiv(struct trace_reader *reader) {
+    if (!__glClearBufferuiv) {
+        trace_missing(reader, TRACE_glClearBufferuiv);
+        return;
+    }
+    GLenum buffer = (GLenum)trace_read_uint(reader);
+    GLint drawbuffer = (GLint)trace_read_int(reader);
+    const GLuint *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glClearBufferuiv(buffer, drawbuffer, value);
+}
+
+static void APIENTRY trace_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+    trace_command(TRACE_glClearBufferfv);
+    trace_write_uint(buffer);
+    trace_write_int(drawbuffer);
+    trace_write_array(value, (size_t)(trace_clear_count(buffer)), sizeof(GLfloat));
+    trace_real.glClearBufferfv(buffer, drawbuffer, value);
+}
+
+static void trace_replay_glClearBufferfv(struct trace_reader *reader) {
+    if (!__glClearBufferfv) {
+        trace_missing(reader, TRACE_glClearBufferfv);
+        return;
+    }
+    GLenum buffer = (GLenum)trace_read_uint(reader);
+    GLint drawbuffer = (GLint)trace_read_int(reader);
+    const GLfloat *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glClearBufferfv(buffer, drawbuffer, value);
+}
+
+static void APIENTRY trace_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+    trace_command(TRACE_glClearBufferfi);
+    trace_write_uint(buffer);
+    trace_write_int(drawbuffer);
+    trace_write_float(depth);
+    trace_write_int(stencil);
+    trace_real.glClearBufferfi(buffer, drawbuffer, depth, stencil);
+}
+
+static void trace_replay_glClearBufferfi(struct trace_reader *reader) {
+    if (!__glClearBufferfi) {
+        trace_missing(reader, TRACE_glClearBufferfi);
+        return;
+    }
+    GLenum buffer = (GLenum)trace_read_uint(reader);
+    GLint drawbuffer = (GLint)trace_read_int(reader);
+    GLfloat depth = trace_read_float(reader);
+    GLint stencil = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glClearBufferfi(buffer, drawbuffer, depth, stencil);
+}
+
+static void APIENTRY trace_glBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+    trace_command(TRACE_glBindRenderbuffer);
+    trace_write_uint(target);
+    trace_write_uint(renderbuffer);
+    trace_real.glBindRenderbuffer(target, renderbuffer);
+}
+
+static void trace_replay_glBindRenderbuffer(struct trace_reader *reader) {
+    if (!__glBindRenderbuffer) {
+        trace_missing(reader, TRACE_glBindRenderbuffer);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLuint renderbuffer = trace_name(reader, TRACE_NAME_RENDERBUFFER, (GLuint)trace_read_uint(reader));
+    if (reader->error)
+        return;
+    __glBindRenderbuffer(target, renderbuffer);
+}
+
+static void APIENTRY trace_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) {
+    trace_command(TRACE_glDeleteRenderbuffers);
+    trace_write_int(n);
+    trace_write_array(renderbuffers, (size_t)(n), sizeof(GLuint));
+    trace_real.glDeleteRenderbuffers(n, renderbuffers);
+}
+
+static void trace_replay_glDeleteRenderbuffers(struct trace_reader *reader) {
+    if (!__glDeleteRenderbuffers) {
+        trace_missing(reader, TRACE_glDeleteRenderbuffers);
+        return;
+    }
+    GLsizei n = (GLsizei)trace_read_int(reader);
+    const GLuint *renderbuffers = trace_read_names(reader, TRACE_NAME_RENDERBUFFER);
+    if (reader->error)
+        return;
+    __glDeleteRenderbuffers(n, renderbuffers);
+}
+
+static void APIENTRY trace_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+    trace_command(TRACE_glGenRenderbuffers);
+    trace_write_int(n);
+    trace_real.glGenRenderbuffers(n, renderbuffers);
+    trace_write_array(renderbuffers, (size_t)(n), sizeof(GLuint));
+}
+
+static void trace_replay_glGenRenderbuffers(struct trace_reader *reader) {
+    if (!__glGenRenderbuffers) {
+        trace_missing(reader, TRACE_glGenRenderbuffers);
+        return;
+    }
+    GLsizei n = (GLsizei)trace_read_int(reader);
+    GLuint *renderbuffers = trace_scratch(reader, (size_t)(n) * sizeof(GLuint));
+    if (reader->error)
+        return;
+    __glGenRenderbuffers(n, renderbuffers);
+    trace_map_names(reader, TRACE_NAME_RENDERBUFFER, renderbuffers, (size_t)(n));
+}
+
+static void APIENTRY trace_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+    trace_command(TRACE_glRenderbufferStorage);
+    trace_write_uint(target);
+    trace_write_uint(internalformat);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_real.glRenderbufferStorage(target, internalformat, width, height);
+}
+
+static void trace_replay_glRenderbufferStorage(struct trace_reader *reader) {
+    if (!__glRenderbufferStorage) {
+        trace_missing(reader, TRACE_glRenderbufferStorage);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLenum internalformat = (GLenum)trace_read_uint(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glRenderbufferStorage(target, internalformat, width, height);
+}
+
+static void APIENTRY trace_glBindFramebuffer(GLenum target, GLuint framebuffer) {
+    trace_command(TRACE_glBindFramebuffer);
+    trace_write_uint(target);
+    trace_write_uint(framebuffer);
+    trace_real.glBindFramebuffer(target, framebuffer);
+}
+
+static void trace_replay_glBindFramebuffer(struct trace_reader *reader) {
+    if (!__glBindFramebuffer) {
+        trace_missing(reader, TRACE_glBindFramebuffer);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLuint framebuffer = trace_name(reader, TRACE_NAME_FRAMEBUFFER, (GLuint)trace_read_uint(reader));
+    if (reader->error)
+        return;
+    __glBindFramebuffer(target, framebuffer);
+}
+
+static void APIENTRY trace_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) {
+    trace_command(TRACE_glDeleteFramebuffers);
+    trace_write_int(n);
+    trace_write_array(framebuffers, (size_t)(n), sizeof(GLuint));
+    trace_real.glDeleteFramebuffers(n, framebuffers);
+}
+
+static void trace_replay_glDeleteFramebuffers(struct trace_reader *reader) {
+    if (!__glDeleteFramebuffers) {
+        trace_missing(reader, TRACE_glDeleteFramebuffers);
+        return;
+    }
+    GLsizei n = (GLsizei)trace_read_int(reader);
+    const GLuint *framebuffers = trace_read_names(reader, TRACE_NAME_FRAMEBUFFER);
+    if (reader->error)
+        return;
+    __glDeleteFramebuffers(n, framebuffers);
+}
+
+static void APIENTRY trace_glGenFramebuffers(GLsizei n, GLuint *framebuffers) {
+    trace_command(TRACE_glGenFramebuffers);
+    trace_write_int(n);
+    trace_real.glGenFramebuffers(n, framebuffers);
+    trace_write_array(framebuffers, (size_t)(n), sizeof(GLuint));
+}
+
+static void trace_replay_glGenFramebuffers(struct trace_reader *reader) {
+    if (!__glGenFramebuffers) {
+        trace_missing(reader, TRACE_glGenFramebuffers);
+        return;
+    }
+    GLsizei n = (GLsizei)trace_read_int(reader);
+    GLuint *framebuffers = trace_scratch(reader, (size_t)(n) * sizeof(GLuint));
+    if (reader->error)
+        return;
+    __glGenFramebuffers(n, framebuffers);
+    trace_map_names(reader, TRACE_NAME_FRAMEBUFFER, framebuffers, (size_t)(n));
+}
+
+static void APIENTRY trace_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+    trace_command(TRACE_glFramebufferTexture1D);
+    trace_write_uint(target);
+    trace_write_uint(attachment);
+    trace_write_uint(textarget);
+    trace_write_uint(texture);
+    trace_write_int(level);
+    trace_real.glFramebufferTexture1D(target, attachment, textarget, texture, level);
+}
+
+static void trace_replay_glFramebufferTexture1D(struct trace_reader *reader) {
+    if (!__glFramebufferTexture1D) {
+        trace_missing(reader, TRACE_glFramebufferTexture1D);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLenum attachment = (GLenum)trace_read_uint(reader);
+    GLenum textarget = (GLenum)trace_read_uint(reader);
+    GLuint texture = trace_name(reader, TRACE_NAME_TEXTURE, (GLuint)trace_read_uint(reader));
+    GLint level = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glFramebufferTexture1D(target, attachment, textarget, texture, level);
+}
+
+static void APIENTRY trace_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+    trace_command(TRACE_glFramebufferTexture2D);
+    trace_write_uint(target);
+    trace_write_uint(attachment);
+    trace_write_uint(textarget);
+    trace_write_uint(texture);
+    trace_write_int(level);
+    trace_real.glFramebufferTexture2D(target, attachment, textarget, texture, level);
+}
+
+static void trace_replay_glFramebufferTexture2D(struct trace_reader *reader) {
+    if (!__glFramebufferTexture2D) {
+        trace_missing(reader, TRACE_glFramebufferTexture2D);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLenum attachment = (GLenum)trace_read_uint(reader);
+    GLenum textarget = (GLenum)trace_read_uint(reader);
+    GLuint texture = trace_name(reader, TRACE_NAME_TEXTURE, (GLuint)trace_read_uint(reader));
+    GLint level = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glFramebufferTexture2D(target, attachment, textarget, texture, level);
+}
+
+static void APIENTRY trace_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+    trace_command(TRACE_glFramebufferTexture3D);
+    trace_write_uint(target);
+    trace_write_uint(attachment);
+    trace_write_uint(textarget);
+    trace_write_uint(texture);
+    trace_write_int(level);
+    trace_write_int(zoffset);
+    trace_real.glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+}
+
+static void trace_replay_glFramebufferTexture3D(struct trace_reader *reader) {
+    if (!__glFramebufferTexture3D) {
+        trace_missing(reader, TRACE_glFramebufferTexture3D);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLenum attachment = (GLenum)trace_read_uint(reader);
+    GLenum textarget = (GLenum)trace_read_uint(reader);
+    GLuint texture = trace_name(reader, TRACE_NAME_TEXTURE, (GLuint)trace_read_uint(reader));
+    GLint level = (GLint)trace_read_int(reader);
+    GLint zoffset = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+}
+
+static void APIENTRY trace_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+    trace_command(TRACE_glFramebufferRenderbuffer);
+    trace_write_uint(target);
+    trace_write_uint(attachment);
+    trace_write_uint(renderbuffertarget);
+    trace_write_uint(renderbuffer);
+    trace_real.glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+}
+
+static void trace_replay_glFramebufferRenderbuffer(struct trace_reader *reader) {
+    if (!__glFramebufferRenderbuffer) {
+        trace_missing(reader, TRACE_glFramebufferRenderbuffer);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLenum attachment = (GLenum)trace_read_uint(reader);
+    GLenum renderbuffertarget = (GLenum)trace_read_uint(reader);
+    GLuint renderbuffer = trace_name(reader, TRACE_NAME_RENDERBUFFER, (GLuint)trace_read_uint(reader));
+    if (reader->error)
+        return;
+    __glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+}
+
+static void APIENTRY trace_glGenerateMipmap(GLenum target) {
+    trace_command(TRACE_glGenerateMipmap);
+    trace_write_uint(target);
+    trace_real.glGenerateMipmap(target);
+}
+
+static void trace_replay_glGenerateMipmap(struct trace_reader *reader) {
+    if (!__glGenerateMipmap) {
+        trace_missing(reader, TRACE_glGenerateMipmap);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glGenerateMipmap(target);
+}
+
+static void APIENTRY trace_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+    trace_command(TRACE_glBlitFramebuffer);
+    trace_write_int(srcX0);
+    trace_write_int(srcY0);
+    trace_write_int(srcX1);
+    trace_write_int(srcY1);
+    trace_write_int(dstX0);
+    trace_write_int(dstY0);
+    trace_write_int(dstX1);
+    trace_write_int(dstY1);
+    trace_write_uint(mask);
+    trace_write_uint(filter);
+    trace_real.glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+
+static void trace_replay_glBlitFramebuffer(struct trace_reader *reader) {
+    if (!__glBlitFramebuffer) {
+        trace_missing(reader, TRACE_glBlitFramebuffer);
+        return;
+    }
+    GLint srcX0 = (GLint)trace_read_int(reader);
+    GLint srcY0 = (GLint)trace_read_int(reader);
+    GLint srcX1 = (GLint)trace_read_int(reader);
+    GLint srcY1 = (GLint)trace_read_int(reader);
+    GLint dstX0 = (GLint)trace_read_int(reader);
+    GLint dstY0 = (GLint)trace_read_int(reader);
+    GLint dstX1 = (GLint)trace_read_int(reader);
+    GLint dstY1 = (GLint)trace_read_int(reader);
+    GLbitfield mask = (GLbitfield)trace_read_uint(reader);
+    GLenum filter = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+
+static void APIENTRY trace_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+    trace_command(TRACE_glRenderbufferStorageMultisample);
+    trace_write_uint(target);
+    trace_write_int(samples);
+    trace_write_uint(internalformat);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_real.glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+}
+
+static void trace_replay_glRenderbufferStorageMultisample(struct trace_reader *reader) {
+    if (!__glRenderbufferStorageMultisample) {
+        trace_missing(reader, TRACE_glRenderbufferStorageMultisample);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLsizei samples = (GLsizei)trace_read_int(reader);
+    GLenum internalformat = (GLenum)trace_read_uint(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+}
+
+static void APIENTRY trace_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+    trace_command(TRACE_glFramebufferTextureLayer);
+    trace_write_uint(target);
+    trace_write_uint(attachment);
+    trace_write_uint(texture);
+    trace_write_int(level);
+    trace_write_int(layer);
+    trace_real.glFramebufferTextureLayer(target, attachment, texture, level, layer);
+}
+
+static void trace_replay_glFramebufferTextureLayer(struct trace_reader *reader) {
+    if (!__glFramebufferTextureLayer) {
+        trace_missing(reader, TRACE_glFramebufferTextureLayer);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLenum attachment = (GLenum)trace_read_uint(reader);
+    GLuint texture = trace_name(reader, TRACE_NAME_TEXTURE, (GLuint)trace_read_uint(reader));
+    GLint level = (GLint)trace_read_int(reader);
+    GLint layer = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glFramebufferTextureLayer(target, attachment, texture, level, layer);
+}
+
+static void *APIENTRY trace_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+    trace_command(TRACE_glMapBufferRange);
+    trace_write_uint(target);
+    trace_write_int(offset);
+    trace_write_int(length);
+    trace_write_uint(access);
+    void *result = trace_real.glMapBufferRange(target, offset, length, access);
+    trace_after_glMapBufferRange(target, offset, length, access, result);
+    return result;
+}
+
+static void trace_replay_glMapBufferRange(struct trace_reader *reader) {
+    if (!__glMapBufferRange) {
+        trace_missing(reader, TRACE_glMapBufferRange);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLintptr offset = (GLintptr)trace_read_int(reader);
+    GLsizeiptr length = (GLsizeiptr)trace_read_int(reader);
+    GLbitfield access = (GLbitfield)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    void *result = __glMapBufferRange(target, offset, length, access);
+    trace_replay_after_glMapBufferRange(reader, target, offset, length, access, result);
+}
+
+static void APIENTRY trace_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+    trace_before_glFlushMappedBufferRange(target, offset, length);
+    trace_command(TRACE_glFlushMappedBufferRange);
+    trace_write_uint(target);
+    trace_write_int(offset);
+    trace_write_int(length);
+    trace_real.glFlushMappedBufferRange(target, offset, length);
+}
+
+static void trace_replay_glFlushMappedBufferRange(struct trace_reader *reader) {
+    if (!__glFlushMappedBufferRange) {
+        trace_missing(reader, TRACE_glFlushMappedBufferRange);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLintptr offset = (GLintptr)trace_read_int(reader);
+    GLsizeiptr length = (GLsizeiptr)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glFlushMappedBufferRange(target, offset, length);
+}
+
+static void APIENTRY trace_glBindVertexArray(GLuint array) {
+    trace_command(TRACE_glBindVertexArray);
+    trace_write_uint(array);
+    trace_real.glBindVertexArray(array);
+}
+
+static void trace_replay_glBindVertexArray(struct trace_reader *reader) {
+    if (!__glBindVertexArray) {
+        trace_missing(reader, TRACE_glBindVertexArray);
+        return;
+    }
+    GLuint array = trace_name(reader, TRACE_NAME_VERTEX_ARRAY, (GLuint)trace_read_uint(reader));
+    if (reader->error)
+        return;
+    __glBindVertexArray(array);
+}
+
+static void APIENTRY trace_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) {
+    trace_command(TRACE_glDeleteVertexArrays);
+    trace_write_int(n);
+    trace_write_array(arrays, (size_t)(n), sizeof(GLuint));
+    trace_real.glDeleteVertexArrays(n, arrays);
+}
+
+static void trace_replay_glDeleteVertexArrays(struct trace_reader *reader) {
+    if (!__glDeleteVertexArrays) {
+        trace_missing(reader, TRACE_glDeleteVertexArrays);
+        return;
+    }
+    GLsizei n = (GLsizei)trace_read_int(reader);
+    const GLuint *arrays = trace_read_names(reader, TRACE_NAME_VERTEX_ARRAY);
+    if (reader->error)
+        return;
+    __glDeleteVertexArrays(n, arrays);
+}
+
+static void APIENTRY trace_glGenVertexArrays(GLsizei n, GLuint *arrays) {
+    trace_command(TRACE_glGenVertexArrays);
+    trace_write_int(n);
+    trace_real.glGenVertexArrays(n, arrays);
+    trace_write_array(arrays, (size_t)(n), sizeof(GLuint));
+}
+
+static void trace_replay_glGenVertexArrays(struct trace_reader *reader) {
+    if (!__glGenVertexArrays) {
+        trace_missing(reader, TRACE_glGenVertexArrays);
+        return;
+    }
+    GLsizei n = (GLsizei)trace_read_int(reader);
+    GLuint *arrays = trace_scratch(reader, (size_t)(n) * sizeof(GLuint));
+    if (reader->error)
+        return;
+    __glGenVertexArrays(n, arrays);
+    trace_map_names(reader, TRACE_NAME_VERTEX_ARRAY, arrays, (size_t)(n));
+}
+
+#endif
+
+#if FUNGL_VERSION >= GL_VERSION_3_1
+static void APIENTRY trace_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+    trace_command(TRACE_glDrawArraysInstanced);
+    trace_write_uint(mode);
+    trace_write_int(first);
+    trace_write_int(count);
+    trace_write_int(instancecount);
+    trace_real.glDrawArraysInstanced(mode, first, count, instancecount);
+}
+
+static void trace_replay_glDrawArraysInstanced(struct trace_reader *reader) {
+    if (!__glDrawArraysInstanced) {
+        trace_missing(reader, TRACE_glDrawArraysInstanced);
+        return;
+    }
+    GLenum mode = (GLenum)trace_read_uint(reader);
+    GLint first = (GLint)trace_read_int(reader);
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLsizei instancecount = (GLsizei)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glDrawArraysInstanced(mode, first, count, instancecount);
+}
+
+static void APIENTRY trace_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) {
+    trace_command(TRACE_glDrawElementsInstanced);
+    trace_write_uint(mode);
+    trace_write_int(count);
+    trace_write_uint(type);
+    trace_write_offset(indices);
+    trace_write_int(instancecount);
+    trace_real.glDrawElementsInstanced(mode, count, type, indices, instancecount);
+}
+
+static void trace_replay_glDrawElementsInstanced(struct trace_reader *reader) {
+    if (!__glDrawElementsInstanced) {
+        trace_missing(reader, TRACE_glDrawElementsInstanced);
+        return;
+    }
+    GLenum mode = (GLenum)trace_read_uint(reader);
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const void *indices = trace_read_offset(reader);
+    GLsizei instancecount = (GLsizei)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glDrawElementsInstanced(mode, count, type, indices, instancecount);
+}
+
+static void APIENTRY trace_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+    trace_command(TRACE_glTexBuffer);
+    trace_write_uint(target);
+    trace_write_uint(internalformat);
+    trace_write_uint(buffer);
+    trace_real.glTexBuffer(target, internalformat, buffer);
+}
+
+static void trace_replay_glTexBuffer(struct trace_reader *reader) {
+    if (!__glTexBuffer) {
+        trace_missing(reader, TRACE_glTexBuffer);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLenum internalformat = (GLenum)trace_read_uint(reader);
+    GLuint buffer = trace_name(reader, TRACE_NAME_BUFFER, (GLuint)trace_read_uint(reader));
+    if (reader->error)
+        return;
+    __glTexBuffer(target, internalformat, buffer);
+}
+
+static void APIENTRY trace_glPrimitiveRestartIndex(GLuint index) {
+    trace_command(TRACE_glPrimitiveRestartIndex);
+    trace_write_uint(index);
+    trace_real.glPrimitiveRestartIndex(index);
+}
+
+static void trace_replay_glPrimitiveRestartIndex(struct trace_reader *reader) {
+    if (!__glPrimitiveRestartIndex) {
+        trace_missing(reader, TRACE_glPrimitiveRestartIndex);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glPrimitiveRestartIndex(index);
+}
+
+static void APIENTRY trace_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+    trace_command(TRACE_glCopyBufferSubData);
+    trace_write_uint(readTarget);
+    trace_write_uint(writeTarget);
+    trace_write_int(readOffset);
+    trace_write_int(writeOffset);
+    trace_write_int(size);
+    trace_real.glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+}
+
+static void trace_replay_glCopyBufferSubData(struct trace_reader *reader) {
+    if (!__glCopyBufferSubData) {
+        trace_missing(reader, TRACE_glCopyBufferSubData);
+        return;
+    }
+    GLenum readTarget = (GLenum)trace_read_uint(reader);
+    GLenum writeTarget = (GLenum)trace_read_uint(reader);
+    GLintptr readOffset = (GLintptr)trace_read_int(reader);
+    GLintptr writeOffset = (GLintptr)trace_read_int(reader);
+    GLsizeiptr size = (GLsizeiptr)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+}
+
+static void APIENTRY trace_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+    trace_command(TRACE_glUniformBlockBinding);
+    trace_write_uint(program);
+    trace_write_uint(uniformBlockIndex);
+    trace_write_uint(uniformBlockBinding);
+    trace_real.glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+}
+
+static void trace_replay_glUniformBlockBinding(struct trace_reader *reader) {
+    if (!__glUniformBlockBinding) {
+        trace_missing(reader, TRACE_glUniformBlockBinding);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLuint uniformBlockIndex = (GLuint)trace_read_uint(reader);
+    GLuint uniformBlockBinding = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+}
+
+#endif
+
+#if FUNGL_VERSION >= GL_VERSION_3_2
+static void APIENTRY trace_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+    trace_command(TRACE_glDrawElementsBaseVertex);
+    trace_write_uint(mode);
+    trace_write_int(count);
+    trace_write_uint(type);
+    trace_write_offset(indices);
+    trace_write_int(basevertex);
+    trace_real.glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+}
+
+static void trace_replay_glDrawElementsBaseVertex(struct trace_reader *reader) {
+    if (!__glDrawElementsBaseVertex) {
+        trace_missing(reader, TRACE_glDrawElementsBaseVertex);
+        return;
+    }
+    GLenum mode = (GLenum)trace_read_uint(reader);
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const void *indices = trace_read_offset(reader);
+    GLint basevertex = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+}
+
+static void APIENTRY trace_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+    trace_command(TRACE_glDrawRangeElementsBaseVertex);
+    trace_write_uint(mode);
+    trace_write_uint(start);
+    trace_write_uint(end);
+    trace_write_int(count);
+    trace_write_uint(type);
+    trace_write_offset(indices);
+    trace_write_int(basevertex);
+    trace_real.glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+}
+
+static void trace_replay_glDrawRangeElementsBaseVertex(struct trace_reader *reader) {
+    if (!__glDrawRangeElementsBaseVertex) {
+        trace_missing(reader, TRACE_glDrawRangeElementsBaseVertex);
+        return;
+    }
+    GLenum mode = (GLenum)trace_read_uint(reader);
+    GLuint start = (GLuint)trace_read_uint(reader);
+    GLuint end = (GLuint)trace_read_uint(reader);
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const void *indices = trace_read_offset(reader);
+    GLint basevertex = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+}
+
+static void APIENTRY trace_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) {
+    trace_command(TRACE_glDrawElementsInstancedBaseVertex);
+    trace_write_uint(mode);
+    trace_write_int(count);
+    trace_write_uint(type);
+    trace_write_offset(indices);
+    trace_write_int(instancecount);
+    trace_write_int(basevertex);
+    trace_real.glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+}
+
+static void trace_replay_glDrawElementsInstancedBaseVertex(struct trace_reader *reader) {
+    if (!__glDrawElementsInstancedBaseVertex) {
+        trace_missing(reader, TRACE_glDrawElementsInstancedBaseVertex);
+        return;
+    }
+    GLenum mode = (GLenum)trace_read_uint(reader);
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const void *indices = trace_read_offset(reader);
+    GLsizei instancecount = (GLsizei)trace_read_int(reader);
+    GLint basevertex = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+}
+
+static void APIENTRY trace_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) {
+    trace_command(TRACE_glMultiDrawElementsBaseVertex);
+    trace_write_uint(mode);
+    trace_write_array(count, (size_t)(drawcount), sizeof(GLsizei));
+    trace_write_uint(type);
+    trace_write_offsets(indices, drawcount);
+    trace_write_int(drawcount);
+    trace_write_array(basevertex, (size_t)(drawcount), sizeof(GLint));
+    trace_real.glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+}
+
+static void trace_replay_glMultiDrawElementsBaseVertex(struct trace_reader *reader) {
+    if (!__glMultiDrawElementsBaseVertex) {
+        trace_missing(reader, TRACE_glMultiDrawElementsBaseVertex);
+        return;
+    }
+    GLenum mode = (GLenum)trace_read_uint(reader);
+    const GLsizei *count = trace_read_array(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const void *const*indices = trace_read_offsets(reader);
+    GLsizei drawcount = (GLsizei)trace_read_int(reader);
+    const GLint *basevertex = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+}
+
+static void APIENTRY trace_glProvokingVertex(GLenum mode) {
+    trace_command(TRACE_glProvokingVertex);
+    trace_write_uint(mode);
+    trace_real.glProvokingVertex(mode);
+}
+
+static void trace_replay_glProvokingVertex(struct trace_reader *reader) {
+    if (!__glProvokingVertex) {
+        trace_missing(reader, TRACE_glProvokingVertex);
+        return;
+    }
+    GLenum mode = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glProvokingVertex(mode);
+}
+
+static GLsync APIENTRY trace_glFenceSync(GLenum condition, GLbitfield flags) {
+    trace_command(TRACE_glFenceSync);
+    trace_write_uint(condition);
+    trace_write_uint(flags);
+    GLsync result = trace_real.glFenceSync(condition, flags);
+    trace_write_sync(result);
+    return result;
+}
+
+static void trace_replay_glFenceSync(struct trace_reader *reader) {
+    if (!__glFenceSync) {
+        trace_missing(reader, TRACE_glFenceSync);
+        return;
+    }
+    GLenum condition = (GLenum)trace_read_uint(reader);
+    GLbitfield flags = (GLbitfield)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    GLsync result = __glFenceSync(condition, flags);
+    trace_map_sync(reader, trace_read_uint(reader), result);
+}
+
+static void APIENTRY trace_glDeleteSync(GLsync sync) {
+    trace_command(TRACE_glDeleteSync);
+    trace_write_sync(sync);
+    trace_real.glDeleteSync(sync);
+}
+
+static void trace_replay_glDeleteSync(struct trace_reader *reader) {
+    if (!__glDeleteSync) {
+        trace_missing(reader, TRACE_glDeleteSync);
+        return;
+    }
+    GLsync sync = trace_read_sync(reader);
+    if (reader->error)
+        return;
+    __glDeleteSync(sync);
+}
+
+static GLenum APIENTRY trace_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+    trace_command(TRACE_glClientWaitSync);
+    trace_write_sync(sync);
+    trace_write_uint(flags);
+    trace_write_uint(timeout);
+    GLenum result = trace_real.glClientWaitSync(sync, flags, timeout);
+    return result;
+}
+
+static void trace_replay_glClientWaitSync(struct trace_reader *reader) {
+    if (!__glClientWaitSync) {
+        trace_missing(reader, TRACE_glClientWaitSync);
+        return;
+    }
+    GLsync sync = trace_read_sync(reader);
+    GLbitfield flags = (GLbitfield)trace_read_uint(reader);
+    GLuint64 timeout = (GLuint64)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    GLenum result = __glClientWaitSync(sync, flags, timeout);
+    (void)result;
+}
+
+static void APIENTRY trace_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+    trace_command(TRACE_glWaitSync);
+    trace_write_sync(sync);
+    trace_write_uint(flags);
+    trace_write_uint(timeout);
+    trace_real.glWaitSync(sync, flags, timeout);
+}
+
+static void trace_replay_glWaitSync(struct trace_reader *reader) {
+    if (!__glWaitSync) {
+        trace_missing(reader, TRACE_glWaitSync);
+        return;
+    }
+    GLsync sync = trace_read_sync(reader);
+    GLbitfield flags = (GLbitfield)trace_read_uint(reader);
+    GLuint64 timeout = (GLuint64)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glWaitSync(sync, flags, timeout);
+}
+
+static void APIENTRY trace_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+    trace_command(TRACE_glFramebufferTexture);
+    trace_write_uint(target);
+    trace_write_uint(attachment);
+    trace_write_uint(texture);
+    trace_write_int(level);
+    trace_real.glFramebufferTexture(target, attachment, texture, level);
+}
+
+static void trace_replay_glFramebufferTexture(struct trace_reader *reader) {
+    if (!__glFramebufferTexture) {
+        trace_missing(reader, TRACE_glFramebufferTexture);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLenum attachment = (GLenum)trace_read_uint(reader);
+    GLuint texture = trace_name(reader, TRACE_NAME_TEXTURE, (GLuint)trace_read_uint(reader));
+    GLint level = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glFramebufferTexture(target, attachment, texture, level);
+}
+
+static void APIENTRY trace_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+    trace_command(TRACE_glTexImage2DMultisample);
+    trace_write_uint(target);
+    trace_write_int(samples);
+    trace_write_uint(internalformat);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_write_uint(fixedsamplelocations);
+    trace_real.glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+
+static void trace_replay_glTexImage2DMultisample(struct trace_reader *reader) {
+    if (!__glTexImage2DMultisample) {
+        trace_missing(reader, TRACE_glTexImage2DMultisample);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLsizei samples = (GLsizei)trace_read_int(reader);
+    GLenum internalformat = (GLenum)trace_read_uint(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    GLboolean fixedsamplelocations = (GLboolean)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+
+static void APIENTRY trace_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+    trace_command(TRACE_glTexImage3DMultisample);
+    trace_write_uint(target);
+    trace_write_int(samples);
+    trace_write_uint(internalformat);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_write_int(depth);
+    trace_write_uint(fixedsamplelocations);
+    trace_real.glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+
+static void trace_replay_glTexImage3DMultisample(struct trace_reader *reader) {
+    if (!__glTexImage3DMultisample) {
+        trace_missing(reader, TRACE_glTexImage3DMultisample);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLsizei samples = (GLsizei)trace_read_int(reader);
+    GLenum internalformat = (GLenum)trace_read_uint(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    GLsizei depth = (GLsizei)trace_read_int(reader);
+    GLboolean fixedsamplelocations = (GLboolean)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+
+static void APIENTRY trace_glSampleMaski(GLuint maskNumber, GLbitfield mask) {
+    trace_command(TRACE_glSampleMaski);
+    trace_write_uint(maskNumber);
+    trace_write_uint(mask);
+    trace_real.glSampleMaski(maskNumber, mask);
+}
+
+static void trace_replay_glSampleMaski(struct trace_reader *reader) {
+    if (!__glSampleMaski) {
+        trace_missing(reader, TRACE_glSampleMaski);
+        return;
+    }
+    GLuint maskNumber = (GLuint)trace_read_uint(reader);
+    GLbitfield mask = (GLbitfield)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glSampleMaski(maskNumber, mask);
+}
+
+#endif
+
+#if FUNGL_VERSION >= GL_VERSION_3_3
+static void APIENTRY trace_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) {
+    trace_command(TRACE_glBindFragDataLocationIndexed);
+    trace_write_uint(program);
+    trace_write_uint(colorNumber);
+    trace_write_uint(index);
+    trace_write_string(name, -1);
+    trace_real.glBindFragDataLocationIndexed(program, colorNumber, index, name);
+}
+
+static void trace_replay_glBindFragDataLocationIndexed(struct trace_reader *reader) {
+    if (!__glBindFragDataLocationIndexed) {
+        trace_missing(reader, TRACE_glBindFragDataLocationIndexed);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLuint colorNumber = (GLuint)trace_read_uint(reader);
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLchar *name = trace_read_string(reader);
+    if (reader->error)
+        return;
+    __glBindFragDataLocationIndexed(program, colorNumber, index, name);
+}
+
+static void APIENTRY trace_glGenSamplers(GLsizei count, GLuint *samplers) {
+    trace_command(TRACE_glGenSamplers);
+    trace_write_int(count);
+    trace_real.glGenSamplers(count, samplers);
+    trace_write_array(samplers, (size_t)(count), sizeof(GLuint));
+}
+
+static void trace_replay_glGenSamplers(struct trace_reader *reader) {
+    if (!__glGenSamplers) {
+        trace_missing(reader, TRACE_glGenSamplers);
+        return;
+    }
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLuint *samplers = trace_scratch(reader, (size_t)(count) * sizeof(GLuint));
+    if (reader->error)
+        return;
+    __glGenSamplers(count, samplers);
+    trace_map_names(reader, TRACE_NAME_SAMPLER, samplers, (size_t)(count));
+}
+
+static void APIENTRY trace_glDeleteSamplers(GLsizei count, const GLuint *samplers) {
+    trace_command(TRACE_glDeleteSamplers);
+    trace_write_int(count);
+    trace_write_array(samplers, (size_t)(count), sizeof(GLuint));
+    trace_real.glDeleteSamplers(count, samplers);
+}
+
+static void trace_replay_glDeleteSamplers(struct trace_reader *reader) {
+    if (!__glDeleteSamplers) {
+        trace_missing(reader, TRACE_glDeleteSamplers);
+        return;
+    }
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLuint *samplers = trace_read_names(reader, TRACE_NAME_SAMPLER);
+    if (reader->error)
+        return;
+    __glDeleteSamplers(count, samplers);
+}
+
+static void APIENTRY trace_glBindSampler(GLuint unit, GLuint sampler) {
+    trace_command(TRACE_glBindSampler);
+    trace_write_uint(unit);
+    trace_write_uint(sampler);
+    trace_real.glBindSampler(unit, sampler);
+}
+
+static void trace_replay_glBindSampler(struct trace_reader *reader) {
+    if (!__glBindSampler) {
+        trace_missing(reader, TRACE_glBindSampler);
+        return;
+    }
+    GLuint unit = (GLuint)trace_read_uint(reader);
+    GLuint sampler = trace_name(reader, TRACE_NAME_SAMPLER, (GLuint)trace_read_uint(reader));
+    if (reader->error)
+        return;
+    __glBindSampler(unit, sampler);
+}
+
+static void APIENTRY trace_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) {
+    trace_command(TRACE_glSamplerParameteri);
+    trace_write_uint(sampler);
+    trace_write_uint(pname);
+    trace_write_int(param);
+    trace_real.glSamplerParameteri(sampler, pname, param);
+}
+
+static void trace_replay_glSamplerParameteri(struct trace_reader *reader) {
+    if (!__glSamplerParameteri) {
+        trace_missing(reader, TRACE_glSamplerParameteri);
+        return;
+    }
+    GLuint sampler = trace_name(reader, TRACE_NAME_SAMPLER, (GLuint)trace_read_uint(reader));
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    GLint param = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glSamplerParameteri(sampler, pname, param);
+}
+
+static void APIENTRY trace_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) {
+    trace_command(TRACE_glSamplerParameteriv);
+    trace_write_uint(sampler);
+    trace_write_uint(pname);
+    trace_write_array(param, (size_t)(trace_pname_count(pname)), sizeof(GLint));
+    trace_real.glSamplerParameteriv(sampler, pname, param);
+}
+
+static void trace_replay_glSamplerParameteriv(struct trace_reader *reader) {
+    if (!__glSamplerParameteriv) {
+        trace_missing(reader, TRACE_glSamplerParameteriv);
+        return;
+    }
+    GLuint sampler = trace_name(reader, TRACE_NAME_SAMPLER, (GLuint)trace_read_uint(reader));
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    const GLint *param = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glSamplerParameteriv(sampler, pname, param);
+}
+
+static void APIENTRY trace_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) {
+    trace_command(TRACE_glSamplerParameterf);
+    trace_write_uint(sampler);
+    trace_write_uint(pname);
+    trace_write_float(param);
+    trace_real.glSamplerParameterf(sampler, pname, param);
+}
+
+static void trace_replay_glSamplerParameterf(struct trace_reader *reader) {
+    if (!__glSamplerParameterf) {
+        trace_missing(reader, TRACE_glSamplerParameterf);
+        return;
+    }
+    GLuint sampler = trace_name(reader, TRACE_NAME_SAMPLER, (GLuint)trace_read_uint(reader));
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    GLfloat param = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glSamplerParameterf(sampler, pname, param);
+}
+
+static void APIENTRY trace_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) {
+    trace_command(TRACE_glSamplerParameterfv);
+    trace_write_uint(sampler);
+    trace_write_uint(pname);
+    trace_write_array(param, (size_t)(trace_pname_count(pname)), sizeof(GLfloat));
+    trace_real.glSamplerParameterfv(sampler, pname, param);
+}
+
+static void trace_replay_glSamplerParameterfv(struct trace_reader *reader) {
+    if (!__glSamplerParameterfv) {
+        trace_missing(reader, TRACE_glSamplerParameterfv);
+        return;
+    }
+    GLuint sampler = trace_name(reader, TRACE_NAME_SAMPLER, (GLuint)trace_read_uint(reader));
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    const GLfloat *param = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glSamplerParameterfv(sampler, pname, param);
+}
+
+static void APIENTRY trace_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) {
+    trace_command(TRACE_glSamplerParameterIiv);
+    trace_write_uint(sampler);
+    trace_write_uint(pname);
+    trace_write_array(param, (size_t)(trace_pname_count(pname)), sizeof(GLint));
+    trace_real.glSamplerParameterIiv(sampler, pname, param);
+}
+
+static void trace_replay_glSamplerParameterIiv(struct trace_reader *reader) {
+    if (!__glSamplerParameterIiv) {
+        trace_missing(reader, TRACE_glSamplerParameterIiv);
+        return;
+    }
+    GLuint sampler = trace_name(reader, TRACE_NAME_SAMPLER, (GLuint)trace_read_uint(reader));
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    const GLint *param = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glSamplerParameterIiv(sampler, pname, param);
+}
+
+static void APIENTRY trace_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) {
+    trace_command(TRACE_glSamplerParameterIuiv);
+    trace_write_uint(sampler);
+    trace_write_uint(pname);
+    trace_write_array(param, (size_t)(trace_pname_count(pname)), sizeof(GLuint));
+    trace_real.glSamplerParameterIuiv(sampler, pname, param);
+}
+
+static void trace_replay_glSamplerParameterIuiv(struct trace_reader *reader) {
+    if (!__glSamplerParameterIuiv) {
+        trace_missing(reader, TRACE_glSamplerParameterIuiv);
+        return;
+    }
+    GLuint sampler = trace_name(reader, TRACE_NAME_SAMPLER, (GLuint)trace_read_uint(reader));
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    const GLuint *param = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glSamplerParameterIuiv(sampler, pname, param);
+}
+
+static void APIENTRY trace_glQueryCounter(GLuint id, GLenum target) {
+    trace_command(TRACE_glQueryCounter);
+    trace_write_uint(id);
+    trace_write_uint(target);
+    trace_real.glQueryCounter(id, target);
+}
+
+static void trace_replay_glQueryCounter(struct trace_reader *reader) {
+    if (!__glQueryCounter) {
+        trace_missing(reader, TRACE_glQueryCounter);
+        return;
+    }
+    GLuint id = trace_name(reader, TRACE_NAME_QUERY, (GLuint)trace_read_uint(reader));
+    GLenum target = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glQueryCounter(id, target);
+}
+
+static void APIENTRY trace_glVertexAttribDivisor(GLuint index, GLuint divisor) {
+    trace_command(TRACE_glVertexAttribDivisor);
+    trace_write_uint(index);
+    trace_write_uint(divisor);
+    trace_real.glVertexAttribDivisor(index, divisor);
+}
+
+static void trace_replay_glVertexAttribDivisor(struct trace_reader *reader) {
+    if (!__glVertexAttribDivisor) {
+        trace_missing(reader, TRACE_glVertexAttribDivisor);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLuint divisor = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribDivisor(index, divisor);
+}
+
+static void APIENTRY trace_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    trace_command(TRACE_glVertexAttribP1ui);
+    trace_write_uint(index);
+    trace_write_uint(type);
+    trace_write_uint(normalized);
+    trace_write_uint(value);
+    trace_real.glVertexAttribP1ui(index, type, normalized, value);
+}
+
+static void trace_replay_glVertexAttribP1ui(struct trace_reader *reader) {
+    if (!__glVertexAttribP1ui) {
+        trace_missing(reader, TRACE_glVertexAttribP1ui);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLboolean normalized = (GLboolean)trace_read_uint(reader);
+    GLuint value = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribP1ui(index, type, normalized, value);
+}
+
+static void APIENTRY trace_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+    trace_command(TRACE_glVertexAttribP1uiv);
+    trace_write_uint(index);
+    trace_write_uint(type);
+    trace_write_uint(normalized);
+    trace_write_array(value, (size_t)(1), sizeof(GLuint));
+    trace_real.glVertexAttribP1uiv(index, type, normalized, value);
+}
+
+static void trace_replay_glVertexAttribP1uiv(struct trace_reader *reader) {
+    if (!__glVertexAttribP1uiv) {
+        trace_missing(reader, TRACE_glVertexAttribP1uiv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLboolean normalized = (GLboolean)trace_read_uint(reader);
+    const GLuint *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribP1uiv(index, type, normalized, value);
+}
+
+static void APIENTRY trace_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    trace_command(TRACE_glVertexAttribP2ui);
+    trace_write_uint(index);
+    trace_write_uint(type);
+    trace_write_uint(normalized);
+    trace_write_uint(value);
+    trace_real.glVertexAttribP2ui(index, type, normalized, value);
+}
+
+static void trace_replay_glVertexAttribP2ui(struct trace_reader *reader) {
+    if (!__glVertexAttribP2ui) {
+        trace_missing(reader, TRACE_glVertexAttribP2ui);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLboolean normalized = (GLboolean)trace_read_uint(reader);
+    GLuint value = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribP2ui(index, type, normalized, value);
+}
+
+static void APIENTRY trace_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+    trace_command(TRACE_glVertexAttribP2uiv);
+    trace_write_uint(index);
+    trace_write_uint(type);
+    trace_write_uint(normalized);
+    trace_write_array(value, (size_t)(1), sizeof(GLuint));
+    trace_real.glVertexAttribP2uiv(index, type, normalized, value);
+}
+
+static void trace_replay_glVertexAttribP2uiv(struct trace_reader *reader) {
+    if (!__glVertexAttribP2uiv) {
+        trace_missing(reader, TRACE_glVertexAttribP2uiv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLboolean normalized = (GLboolean)trace_read_uint(reader);
+    const GLuint *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribP2uiv(index, type, normalized, value);
+}
+
+static void APIENTRY trace_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    trace_command(TRACE_glVertexAttribP3ui);
+    trace_write_uint(index);
+    trace_write_uint(type);
+    trace_write_uint(normalized);
+    trace_write_uint(value);
+    trace_real.glVertexAttribP3ui(index, type, normalized, value);
+}
+
+static void trace_replay_glVertexAttribP3ui(struct trace_reader *reader) {
+    if (!__glVertexAttribP3ui) {
+        trace_missing(reader, TRACE_glVertexAttribP3ui);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLboolean normalized = (GLboolean)trace_read_uint(reader);
+    GLuint value = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribP3ui(index, type, normalized, value);
+}
+
+static void APIENTRY trace_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+    trace_command(TRACE_glVertexAttribP3uiv);
+    trace_write_uint(index);
+    trace_write_uint(type);
+    trace_write_uint(normalized);
+    trace_write_array(value, (size_t)(1), sizeof(GLuint));
+    trace_real.glVertexAttribP3uiv(index, type, normalized, value);
+}
+
+static void trace_replay_glVertexAttribP3uiv(struct trace_reader *reader) {
+    if (!__glVertexAttribP3uiv) {
+        trace_missing(reader, TRACE_glVertexAttribP3uiv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLboolean normalized = (GLboolean)trace_read_uint(reader);
+    const GLuint *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribP3uiv(index, type, normalized, value);
+}
+
+static void APIENTRY trace_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    trace_command(TRACE_glVertexAttribP4ui);
+    trace_write_uint(index);
+    trace_write_uint(type);
+    trace_write_uint(normalized);
+    trace_write_uint(value);
+    trace_real.glVertexAttribP4ui(index, type, normalized, value);
+}
+
+static void trace_replay_glVertexAttribP4ui(struct trace_reader *reader) {
+    if (!__glVertexAttribP4ui) {
+        trace_missing(reader, TRACE_glVertexAttribP4ui);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLboolean normalized = (GLboolean)trace_read_uint(reader);
+    GLuint value = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribP4ui(index, type, normalized, value);
+}
+
+static void APIENTRY trace_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+    trace_command(TRACE_glVertexAttribP4uiv);
+    trace_write_uint(index);
+    trace_write_uint(type);
+    trace_write_uint(normalized);
+    trace_write_array(value, (size_t)(1), sizeof(GLuint));
+    trace_real.glVertexAttribP4uiv(index, type, normalized, value);
+}
+
+static void trace_replay_glVertexAttribP4uiv(struct trace_reader *reader) {
+    if (!__glVertexAttribP4uiv) {
+        trace_missing(reader, TRACE_glVertexAttribP4uiv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLboolean normalized = (GLboolean)trace_read_uint(reader);
+    const GLuint *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribP4uiv(index, type, normalized, value);
+}
+
+static void APIENTRY trace_glVertexP2ui(GLenum type, GLuint value) {
+    trace_command(TRACE_glVertexP2ui);
+    trace_write_uint(type);
+    trace_write_uint(value);
+    trace_real.glVertexP2ui(type, value);
+}
+
+static void trace_replay_glVertexP2ui(struct trace_reader *reader) {
+    if (!__glVertexP2ui) {
+        trace_missing(reader, TRACE_glVertexP2ui);
+        return;
+    }
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLuint value = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glVertexP2ui(type, value);
+}
+
+static void APIENTRY trace_glVertexP2uiv(GLenum type, const GLuint *value) {
+    trace_command(TRACE_glVertexP2uiv);
+    trace_write_uint(type);
+    trace_write_array(value, (size_t)(1), sizeof(GLuint));
+    trace_real.glVertexP2uiv(type, value);
+}
+
+static void trace_replay_glVertexP2uiv(struct trace_reader *reader) {
+    if (!__glVertexP2uiv) {
+        trace_missing(reader, TRACE_glVertexP2uiv);
+        return;
+    }
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const GLuint *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexP2uiv(type, value);
+}
+
+static void APIENTRY trace_glVertexP3ui(GLenum type, GLuint value) {
+    trace_command(TRACE_glVertexP3ui);
+    trace_write_uint(type);
+    trace_write_uint(value);
+    trace_real.glVertexP3ui(type, value);
+}
+
+static void trace_replay_glVertexP3ui(struct trace_reader *reader) {
+    if (!__glVertexP3ui) {
+        trace_missing(reader, TRACE_glVertexP3ui);
+        return;
+    }
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLuint value = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glVertexP3ui(type, value);
+}
+
+static void APIENTRY trace_glVertexP3uiv(GLenum type, const GLuint *value) {
+    trace_command(TRACE_glVertexP3uiv);
+    trace_write_uint(type);
+    trace_write_array(value, (size_t)(1), sizeof(GLuint));
+    trace_real.glVertexP3uiv(type, value);
+}
+
+static void trace_replay_glVertexP3uiv(struct trace_reader *reader) {
+    if (!__glVertexP3uiv) {
+        trace_missing(reader, TRACE_glVertexP3uiv);
+        return;
+    }
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const GLuint *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexP3uiv(type, value);
+}
+
+static void APIENTRY trace_glVertexP4ui(GLenum type, GLuint value) {
+    trace_command(TRACE_glVertexP4ui);
+    trace_write_uint(type);
+    trace_write_uint(value);
+    trace_real.glVertexP4ui(type, value);
+}
+
+static void trace_replay_glVertexP4ui(struct trace_reader *reader) {
+    if (!__glVertexP4ui) {
+        trace_missing(reader, TRACE_glVertexP4ui);
+        return;
+    }
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLuint value = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glVertexP4ui(type, value);
+}
+
+static void APIENTRY trace_glVertexP4uiv(GLenum type, const GLuint *value) {
+    trace_command(TRACE_glVertexP4uiv);
+    trace_write_uint(type);
+    trace_write_array(value, (size_t)(1), sizeof(GLuint));
+    trace_real.glVertexP4uiv(type, value);
+}
+
+static void trace_replay_glVertexP4uiv(struct trace_reader *reader) {
+    if (!__glVertexP4uiv) {
+        trace_missing(reader, TRACE_glVertexP4uiv);
+        return;
+    }
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const GLuint *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexP4uiv(type, value);
+}
+
+static void APIENTRY trace_glTexCoordP1ui(GLenum type, GLuint coords) {
+    trace_command(TRACE_glTexCoordP1ui);
+    trace_write_uint(type);
+    trace_write_uint(coords);
+    trace_real.glTexCoordP1ui(type, coords);
+}
+
+static void trace_replay_glTexCoordP1ui(struct trace_reader *reader) {
+    if (!__glTexCoordP1ui) {
+        trace_missing(reader, TRACE_glTexCoordP1ui);
+        return;
+    }
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLuint coords = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glTexCoordP1ui(type, coords);
+}
+
+static void APIENTRY trace_glTexCoordP1uiv(GLenum type, const GLuint *coords) {
+    trace_command(TRACE_glTexCoordP1uiv);
+    trace_write_uint(type);
+    trace_write_array(coords, (size_t)(1), sizeof(GLuint));
+    trace_real.glTexCoordP1uiv(type, coords);
+}
+
+static void trace_replay_glTexCoordP1uiv(struct trace_reader *reader) {
+    if (!__glTexCoordP1uiv) {
+        trace_missing(reader, TRACE_glTexCoordP1uiv);
+        return;
+    }
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const GLuint *coords = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glTexCoordP1uiv(type, coords);
+}
+
+static void APIENTRY trace_glTexCoordP2ui(GLenum type, GLuint coords) {
+    trace_command(TRACE_glTexCoordP2ui);
+    trace_write_uint(type);
+    trace_write_uint(coords);
+    trace_real.glTexCoordP2ui(type, coords);
+}
+
+static void trace_replay_glTexCoordP2ui(struct trace_reader *reader) {
+    if (!__glTexCoordP2ui) {
+        trace_missing(reader, TRACE_glTexCoordP2ui);
+        return;
+    }
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLuint coords = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glTexCoordP2ui(type, coords);
+}
+
+static void APIENTRY trace_glTexCoordP2uiv(GLenum type, const GLuint *coords) {
+    trace_command(TRACE_glTexCoordP2uiv);
+    trace_write_uint(type);
+    trace_write_array(coords, (size_t)(1), sizeof(GLuint));
+    trace_real.glTexCoordP2uiv(type, coords);
+}
+
+static void trace_replay_glTexCoordP2uiv(struct trace_reader *reader) {
+    if (!__glTexCoordP2uiv) {
+        trace_missing(reader, TRACE_glTexCoordP2uiv);
+        return;
+    }
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const GLuint *coords = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glTexCoordP2uiv(type, coords);
+}
+
+static void APIENTRY trace_glTexCoordP3ui(GLenum type, GLuint coords) {
+    trace_command(TRACE_glTexCoordP3ui);
+    trace_write_uint(type);
+    trace_write_uint(coords);
+    trace_real.glTexCoordP3ui(type, coords);
+}
+
+static void trace_replay_glTexCoordP3ui(struct trace_reader *reader) {
+    if (!__glTexCoordP3ui) {
+        trace_missing(reader, TRACE_glTexCoordP3ui);
+        return;
+    }
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLuint coords = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glTexCoordP3ui(type, coords);
+}
+
+static void APIENTRY trace_glTexCoordP3uiv(GLenum type, const GLuint *coords) {
+    trace_command(TRACE_glTexCoordP3uiv);
+    trace_write_uint(type);
+    trace_write_array(coords, (size_t)(1), sizeof(GLuint));
+    trace_real.glTexCoordP3uiv(type, coords);
+}
+
+static void trace_replay_glTexCoordP3uiv(struct trace_reader *reader) {
+    if (!__glTexCoordP3uiv) {
+        trace_missing(reader, TRACE_glTexCoordP3uiv);
+        return;
+    }
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const GLuint *coords = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glTexCoordP3uiv(type, coords);
+}
+
+static void APIENTRY trace_glTexCoordP4ui(GLenum type, GLuint coords) {
+    trace_command(TRACE_glTexCoordP4ui);
+    trace_write_uint(type);
+    trace_write_uint(coords);
+    trace_real.glTexCoordP4ui(type, coords);
+}
+
+static void trace_replay_glTexCoordP4ui(struct trace_reader *reader) {
+    if (!__glTexCoordP4ui) {
+        trace_missing(reader, TRACE_glTexCoordP4ui);
+        return;
+    }
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLuint coords = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glTexCoordP4ui(type, coords);
+}
+
+static void APIENTRY trace_glTexCoordP4uiv(GLenum type, const GLuint *coords) {
+    trace_command(TRACE_glTexCoordP4uiv);
+    trace_write_uint(type);
+    trace_write_array(coords, (size_t)(1), sizeof(GLuint));
+    trace_real.glTexCoordP4uiv(type, coords);
+}
+
+static void trace_replay_glTexCoordP4uiv(struct trace_reader *reader) {
+    if (!__glTexCoordP4uiv) {
+        trace_missing(reader, TRACE_glTexCoordP4uiv);
+        return;
+    }
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const GLuint *coords = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glTexCoordP4uiv(type, coords);
+}
+
+static void APIENTRY trace_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords) {
+    trace_command(TRACE_glMultiTexCoordP1ui);
+    trace_write_uint(texture);
+    trace_write_uint(type);
+    trace_write_uint(coords);
+    trace_real.glMultiTexCoordP1ui(texture, type, coords);
+}
+
+static void trace_replay_glMultiTexCoordP1ui(struct trace_reader *reader) {
+    if (!__glMultiTexCoordP1ui) {
+        trace_missing(reader, TRACE_glMultiTexCoordP1ui);
+        return;
+    }
+    GLenum texture = (GLenum)trace_read_uint(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLuint coords = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glMultiTexCoordP1ui(texture, type, coords);
+}
+
+static void APIENTRY trace_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords) {
+    trace_command(TRACE_glMultiTexCoordP1uiv);
+    trace_write_uint(texture);
+    trace_write_uint(type);
+    trace_write_array(coords, (size_t)(1), sizeof(GLuint));
+    trace_real.glMultiTexCoordP1uiv(texture, type, coords);
+}
+
+static void trace_replay_glMultiTexCoordP1uiv(struct trace_reader *reader) {
+    if (!__glMultiTexCoordP1uiv) {
+        trace_missing(reader, TRACE_glMultiTexCoordP1uiv);
+        return;
+    }
+    GLenum texture = (GLenum)trace_read_uint(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const GLuint *coords = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glMultiTexCoordP1uiv(texture, type, coords);
+}
+
+static void APIENTRY trace_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords) {
+    trace_command(TRACE_glMultiTexCoordP2ui);
+    trace_write_uint(texture);
+    trace_write_uint(type);
+    trace_write_uint(coords);
+    trace_real.glMultiTexCoordP2ui(texture, type, coords);
+}
+
+static void trace_replay_glMultiTexCoordP2ui(struct trace_reader *reader) {
+    if (!__glMultiTexCoordP2ui) {
+        trace_missing(reader, TRACE_glMultiTexCoordP2ui);
+        return;
+    }
+    GLenum texture = (GLenum)trace_read_uint(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLuint coords = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glMultiTexCoordP2ui(texture, type, coords);
+}
+
+static void APIENTRY trace_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords) {
+    trace_command(TRACE_glMultiTexCoordP2uiv);
+    trace_write_uint(texture);
+    trace_write_uint(type);
+    trace_write_array(coords, (size_t)(1), sizeof(GLuint));
+    trace_real.glMultiTexCoordP2uiv(texture, type, coords);
+}
+
+static void trace_replay_glMultiTexCoordP2uiv(struct trace_reader *reader) {
+    if (!__glMultiTexCoordP2uiv) {
+        trace_missing(reader, TRACE_glMultiTexCoordP2uiv);
+        return;
+    }
+    GLenum texture = (GLenum)trace_read_uint(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const GLuint *coords = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glMultiTexCoordP2uiv(texture, type, coords);
+}
+
+static void APIENTRY trace_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords) {
+    trace_command(TRACE_glMultiTexCoordP3ui);
+    trace_write_uint(texture);
+    trace_write_uint(type);
+    trace_write_uint(coords);
+    trace_real.glMultiTexCoordP3ui(texture, type, coords);
+}
+
+static void trace_replay_glMultiTexCoordP3ui(struct trace_reader *reader) {
+    if (!__glMultiTexCoordP3ui) {
+        trace_missing(reader, TRACE_glMultiTexCoordP3ui);
+        return;
+    }
+    GLenum texture = (GLenum)trace_read_uint(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLuint coords = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glMultiTexCoordP3ui(texture, type, coords);
+}
+
+static void APIENTRY trace_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords) {
+    trace_command(TRACE_glMultiTexCoordP3uiv);
+    trace_write_uint(texture);
+    trace_write_uint(type);
+    trace_write_array(coords, (size_t)(1), sizeof(GLuint));
+    trace_real.glMultiTexCoordP3uiv(texture, type, coords);
+}
+
+static void trace_replay_glMultiTexCoordP3uiv(struct trace_reader *reader) {
+    if (!__glMultiTexCoordP3uiv) {
+        trace_missing(reader, TRACE_glMultiTexCoordP3uiv);
+        return;
+    }
+    GLenum texture = (GLenum)trace_read_uint(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const GLuint *coords = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glMultiTexCoordP3uiv(texture, type, coords);
+}
+
+static void APIENTRY trace_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords) {
+    trace_command(TRACE_glMultiTexCoordP4ui);
+    trace_write_uint(texture);
+    trace_write_uint(type);
+    trace_write_uint(coords);
+    trace_real.glMultiTexCoordP4ui(texture, type, coords);
+}
+
+static void trace_replay_glMultiTexCoordP4ui(struct trace_reader *reader) {
+    if (!__glMultiTexCoordP4ui) {
+        trace_missing(reader, TRACE_glMultiTexCoordP4ui);
+        return;
+    }
+    GLenum texture = (GLenum)trace_read_uint(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLuint coords = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glMultiTexCoordP4ui(texture, type, coords);
+}
+
+static void APIENTRY trace_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords) {
+    trace_command(TRACE_glMultiTexCoordP4uiv);
+    trace_write_uint(texture);
+    trace_write_uint(type);
+    trace_write_array(coords, (size_t)(1), sizeof(GLuint));
+    trace_real.glMultiTexCoordP4uiv(texture, type, coords);
+}
+
+static void trace_replay_glMultiTexCoordP4uiv(struct trace_reader *reader) {
+    if (!__glMultiTexCoordP4uiv) {
+        trace_missing(reader, TRACE_glMultiTexCoordP4uiv);
+        return;
+    }
+    GLenum texture = (GLenum)trace_read_uint(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const GLuint *coords = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glMultiTexCoordP4uiv(texture, type, coords);
+}
+
+static void APIENTRY trace_glNormalP3ui(GLenum type, GLuint coords) {
+    trace_command(TRACE_glNormalP3ui);
+    trace_write_uint(type);
+    trace_write_uint(coords);
+    trace_real.glNormalP3ui(type, coords);
+}
+
+static void trace_replay_glNormalP3ui(struct trace_reader *reader) {
+    if (!__glNormalP3ui) {
+        trace_missing(reader, TRACE_glNormalP3ui);
+        return;
+    }
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLuint coords = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glNormalP3ui(type, coords);
+}
+
+static void APIENTRY trace_glNormalP3uiv(GLenum type, const GLuint *coords) {
+    trace_command(TRACE_glNormalP3uiv);
+    trace_write_uint(type);
+    trace_write_array(coords, (size_t)(1), sizeof(GLuint));
+    trace_real.glNormalP3uiv(type, coords);
+}
+
+static void trace_replay_glNormalP3uiv(struct trace_reader *reader) {
+    if (!__glNormalP3uiv) {
+        trace_missing(reader, TRACE_glNormalP3uiv);
+        return;
+    }
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const GLuint *coords = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glNormalP3uiv(type, coords);
+}
+
+static void APIENTRY trace_glColorP3ui(GLenum type, GLuint color) {
+    trace_command(TRACE_glColorP3ui);
+    trace_write_uint(type);
+    trace_write_uint(color);
+    trace_real.glColorP3ui(type, color);
+}
+
+static void trace_replay_glColorP3ui(struct trace_reader *reader) {
+    if (!__glColorP3ui) {
+        trace_missing(reader, TRACE_glColorP3ui);
+        return;
+    }
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLuint color = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glColorP3ui(type, color);
+}
+
+static void APIENTRY trace_glColorP3uiv(GLenum type, const GLuint *color) {
+    trace_command(TRACE_glColorP3uiv);
+    trace_write_uint(type);
+    trace_write_array(color, (size_t)(1), sizeof(GLuint));
+    trace_real.glColorP3uiv(type, color);
+}
+
+static void trace_replay_glColorP3uiv(struct trace_reader *reader) {
+    if (!__glColorP3uiv) {
+        trace_missing(reader, TRACE_glColorP3uiv);
+        return;
+    }
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const GLuint *color = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glColorP3uiv(type, color);
+}
+
+static void APIENTRY trace_glColorP4ui(GLenum type, GLuint color) {
+    trace_command(TRACE_glColorP4ui);
+    trace_write_uint(type);
+    trace_write_uint(color);
+    trace_real.glColorP4ui(type, color);
+}
+
+static void trace_replay_glColorP4ui(struct trace_reader *reader) {
+    if (!__glColorP4ui) {
+        trace_missing(reader, TRACE_glColorP4ui);
+        return;
+    }
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLuint color = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glColorP4ui(type, color);
+}
+
+static void APIENTRY trace_glColorP4uiv(GLenum type, const GLuint *color) {
+    trace_command(TRACE_glColorP4uiv);
+    trace_write_uint(type);
+    trace_write_array(color, (size_t)(1), sizeof(GLuint));
+    trace_real.glColorP4uiv(type, color);
+}
+
+static void trace_replay_glColorP4uiv(struct trace_reader *reader) {
+    if (!__glColorP4uiv) {
+        trace_missing(reader, TRACE_glColorP4uiv);
+        return;
+    }
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const GLuint *color = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glColorP4uiv(type, color);
+}
+
+static void APIENTRY trace_glSecondaryColorP3ui(GLenum type, GLuint color) {
+    trace_command(TRACE_glSecondaryColorP3ui);
+    trace_write_uint(type);
+    trace_write_uint(color);
+    trace_real.glSecondaryColorP3ui(type, color);
+}
+
+static void trace_replay_glSecondaryColorP3ui(struct trace_reader *reader) {
+    if (!__glSecondaryColorP3ui) {
+        trace_missing(reader, TRACE_glSecondaryColorP3ui);
+        return;
+    }
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLuint color = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glSecondaryColorP3ui(type, color);
+}
+
+static void APIENTRY trace_glSecondaryColorP3uiv(GLenum type, const GLuint *color) {
+    trace_command(TRACE_glSecondaryColorP3uiv);
+    trace_write_uint(type);
+    trace_write_array(color, (size_t)(1), sizeof(GLuint));
+    trace_real.glSecondaryColorP3uiv(type, color);
+}
+
+static void trace_replay_glSecondaryColorP3uiv(struct trace_reader *reader) {
+    if (!__glSecondaryColorP3uiv) {
+        trace_missing(reader, TRACE_glSecondaryColorP3uiv);
+        return;
+    }
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const GLuint *color = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glSecondaryColorP3uiv(type, color);
+}
+
+#endif
+
+#if FUNGL_VERSION >= GL_VERSION_4_0
+static void APIENTRY trace_glMinSampleShading(GLfloat value) {
+    trace_command(TRACE_glMinSampleShading);
+    trace_write_float(value);
+    trace_real.glMinSampleShading(value);
+}
+
+static void trace_replay_glMinSampleShading(struct trace_reader *reader) {
+    if (!__glMinSampleShading) {
+        trace_missing(reader, TRACE_glMinSampleShading);
+        return;
+    }
+    GLfloat value = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glMinSampleShading(value);
+}
+
+static void APIENTRY trace_glBlendEquationi(GLuint buf, GLenum mode) {
+    trace_command(TRACE_glBlendEquationi);
+    trace_write_uint(buf);
+    trace_write_uint(mode);
+    trace_real.glBlendEquationi(buf, mode);
+}
+
+static void trace_replay_glBlendEquationi(struct trace_reader *reader) {
+    if (!__glBlendEquationi) {
+        trace_missing(reader, TRACE_glBlendEquationi);
+        return;
+    }
+    GLuint buf = (GLuint)trace_read_uint(reader);
+    GLenum mode = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glBlendEquationi(buf, mode);
+}
+
+static void APIENTRY trace_glBlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha) {
+    trace_command(TRACE_glBlendEquationSeparatei);
+    trace_write_uint(buf);
+    trace_write_uint(modeRGB);
+    trace_write_uint(modeAlpha);
+    trace_real.glBlendEquationSeparatei(buf, modeRGB, modeAlpha);
+}
+
+static void trace_replay_glBlendEquationSeparatei(struct trace_reader *reader) {
+    if (!__glBlendEquationSeparatei) {
+        trace_missing(reader, TRACE_glBlendEquationSeparatei);
+        return;
+    }
+    GLuint buf = (GLuint)trace_read_uint(reader);
+    GLenum modeRGB = (GLenum)trace_read_uint(reader);
+    GLenum modeAlpha = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glBlendEquationSeparatei(buf, modeRGB, modeAlpha);
+}
+
+static void APIENTRY trace_glBlendFunci(GLuint buf, GLenum src, GLenum dst) {
+    trace_command(TRACE_glBlendFunci);
+    trace_write_uint(buf);
+    trace_write_uint(src);
+    trace_write_uint(dst);
+    trace_real.glBlendFunci(buf, src, dst);
+}
+
+static void trace_replay_glBlendFunci(struct trace_reader *reader) {
+    if (!__glBlendFunci) {
+        trace_missing(reader, TRACE_glBlendFunci);
+        return;
+    }
+    GLuint buf = (GLuint)trace_read_uint(reader);
+    GLenum src = (GLenum)trace_read_uint(reader);
+    GLenum dst = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glBlendFunci(buf, src, dst);
+}
+
+static void APIENTRY trace_glBlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha) {
+    trace_command(TRACE_glBlendFuncSeparatei);
+    trace_write_uint(buf);
+    trace_write_uint(srcRGB);
+    trace_write_uint(dstRGB);
+    trace_write_uint(srcAlpha);
+    trace_write_uint(dstAlpha);
+    trace_real.glBlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+}
+
+static void trace_replay_glBlendFuncSeparatei(struct trace_reader *reader) {
+    if (!__glBlendFuncSeparatei) {
+        trace_missing(reader, TRACE_glBlendFuncSeparatei);
+        return;
+    }
+    GLuint buf = (GLuint)trace_read_uint(reader);
+    GLenum srcRGB = (GLenum)trace_read_uint(reader);
+    GLenum dstRGB = (GLenum)trace_read_uint(reader);
+    GLenum srcAlpha = (GLenum)trace_read_uint(reader);
+    GLenum dstAlpha = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glBlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+}
+
+static void APIENTRY trace_glDrawArraysIndirect(GLenum mode, const void *indirect) {
+    trace_command(TRACE_glDrawArraysIndirect);
+    trace_write_uint(mode);
+    trace_write_offset(indirect);
+    trace_real.glDrawArraysIndirect(mode, indirect);
+}
+
+static void trace_replay_glDrawArraysIndirect(struct trace_reader *reader) {
+    if (!__glDrawArraysIndirect) {
+        trace_missing(reader, TRACE_glDrawArraysIndirect);
+        return;
+    }
+    GLenum mode = (GLenum)trace_read_uint(reader);
+    const void *indirect = trace_read_offset(reader);
+    if (reader->error)
+        return;
+    __glDrawArraysIndirect(mode, indirect);
+}
+
+static void APIENTRY trace_glDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect) {
+    trace_command(TRACE_glDrawElementsIndirect);
+    trace_write_uint(mode);
+    trace_write_uint(type);
+    trace_write_offset(indirect);
+    trace_real.glDrawElementsIndirect(mode, type, indirect);
+}
+
+static void trace_replay_glDrawElementsIndirect(struct trace_reader *reader) {
+    if (!__glDrawElementsIndirect) {
+        trace_missing(reader, TRACE_glDrawElementsIndirect);
+        return;
+    }
+    GLenum mode = (GLenum)trace_read_uint(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const void *indirect = trace_read_offset(reader);
+    if (reader->error)
+        return;
+    __glDrawElementsIndirect(mode, type, indirect);
+}
+
+static void APIENTRY trace_glUniform1d(GLint location, GLdouble x) {
+    trace_command(TRACE_glUniform1d);
+    trace_write_int(location);
+    trace_write_double(x);
+    trace_real.glUniform1d(location, x);
+}
+
+static void trace_replay_glUniform1d(struct trace_reader *reader) {
+    if (!__glUniform1d) {
+        trace_missing(reader, TRACE_glUniform1d);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLdouble x = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glUniform1d(location, x);
+}
+
+static void APIENTRY trace_glUniform2d(GLint location, GLdouble x, GLdouble y) {
+    trace_command(TRACE_glUniform2d);
+    trace_write_int(location);
+    trace_write_double(x);
+    trace_write_double(y);
+    trace_real.glUniform2d(location, x, y);
+}
+
+static void trace_replay_glUniform2d(struct trace_reader *reader) {
+    if (!__glUniform2d) {
+        trace_missing(reader, TRACE_glUniform2d);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLdouble x = trace_read_double(reader);
+    GLdouble y = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glUniform2d(location, x, y);
+}
+
+static void APIENTRY trace_glUniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z) {
+    trace_command(TRACE_glUniform3d);
+    trace_write_int(location);
+    trace_write_double(x);
+    trace_write_double(y);
+    trace_write_double(z);
+    trace_real.glUniform3d(location, x, y, z);
+}
+
+static void trace_replay_glUniform3d(struct trace_reader *reader) {
+    if (!__glUniform3d) {
+        trace_missing(reader, TRACE_glUniform3d);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLdouble x = trace_read_double(reader);
+    GLdouble y = trace_read_double(reader);
+    GLdouble z = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glUniform3d(location, x, y, z);
+}
+
+static void APIENTRY trace_glUniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    trace_command(TRACE_glUniform4d);
+    trace_write_int(location);
+    trace_write_double(x);
+    trace_write_double(y);
+    trace_write_double(z);
+    trace_write_double(w);
+    trace_real.glUniform4d(location, x, y, z, w);
+}
+
+static void trace_replay_glUniform4d(struct trace_reader *reader) {
+    if (!__glUniform4d) {
+        trace_missing(reader, TRACE_glUniform4d);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLdouble x = trace_read_double(reader);
+    GLdouble y = trace_read_double(reader);
+    GLdouble z = trace_read_double(reader);
+    GLdouble w = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glUniform4d(location, x, y, z, w);
+}
+
+static void APIENTRY trace_glUniform1dv(GLint location, GLsizei count, const GLdouble *value) {
+    trace_command(TRACE_glUniform1dv);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_array(value, (size_t)((count)*1), sizeof(GLdouble));
+    trace_real.glUniform1dv(location, count, value);
+}
+
+static void trace_replay_glUniform1dv(struct trace_reader *reader) {
+    if (!__glUniform1dv) {
+        trace_missing(reader, TRACE_glUniform1dv);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLdouble *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glUniform1dv(location, count, value);
+}
+
+static void APIENTRY trace_glUniform2dv(GLint location, GLsizei count, const GLdouble *value) {
+    trace_command(TRACE_glUniform2dv);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_array(value, (size_t)((count)*2), sizeof(GLdouble));
+    trace_real.glUniform2dv(location, count, value);
+}
+
+static void trace_replay_glUniform2dv(struct trace_reader *reader) {
+    if (!__glUniform2dv) {
+        trace_missing(reader, TRACE_glUniform2dv);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLdouble *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glUniform2dv(location, count, value);
+}
+
+static void APIENTRY trace_glUniform3dv(GLint location, GLsizei count, const GLdouble *value) {
+    trace_command(TRACE_glUniform3dv);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_array(value, (size_t)((count)*3), sizeof(GLdouble));
+    trace_real.glUniform3dv(location, count, value);
+}
+
+static void trace_replay_glUniform3dv(struct trace_reader *reader) {
+    if (!__glUniform3dv) {
+        trace_missing(reader, TRACE_glUniform3dv);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLdouble *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glUniform3dv(location, count, value);
+}
+
+static void APIENTRY trace_glUniform4dv(GLint location, GLsizei count, const GLdouble *value) {
+    trace_command(TRACE_glUniform4dv);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_array(value, (size_t)((count)*4), sizeof(GLdouble));
+    trace_real.glUniform4dv(location, count, value);
+}
+
+static void trace_replay_glUniform4dv(struct trace_reader *reader) {
+    if (!__glUniform4dv) {
+        trace_missing(reader, TRACE_glUniform4dv);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLdouble *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glUniform4dv(location, count, value);
+}
+
+static void APIENTRY trace_glUniformMatrix2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    trace_command(TRACE_glUniformMatrix2dv);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_uint(transpose);
+    trace_write_array(value, (size_t)((count)*4), sizeof(GLdouble));
+    trace_real.glUniformMatrix2dv(location, count, transpose, value);
+}
+
+static void trace_replay_glUniformMatrix2dv(struct trace_reader *reader) {
+    if (!__glUniformMatrix2dv) {
+        trace_missing(reader, TRACE_glUniformMatrix2dv);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLboolean transpose = (GLboolean)trace_read_uint(reader);
+    const GLdouble *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glUniformMatrix2dv(location, count, transpose, value);
+}
+
+static void APIENTRY trace_glUniformMatrix3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    trace_command(TRACE_glUniformMatrix3dv);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_uint(transpose);
+    trace_write_array(value, (size_t)((count)*9), sizeof(GLdouble));
+    trace_real.glUniformMatrix3dv(location, count, transpose, value);
+}
+
+static void trace_replay_glUniformMatrix3dv(struct trace_reader *reader) {
+    if (!__glUniformMatrix3dv) {
+        trace_missing(reader, TRACE_glUniformMatrix3dv);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLboolean transpose = (GLboolean)trace_read_uint(reader);
+    const GLdouble *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glUniformMatrix3dv(location, count, transpose, value);
+}
+
+static void APIENTRY trace_glUniformMatrix4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    trace_command(TRACE_glUniformMatrix4dv);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_uint(transpose);
+    trace_write_array(value, (size_t)((count)*16), sizeof(GLdouble));
+    trace_real.glUniformMatrix4dv(location, count, transpose, value);
+}
+
+static void trace_replay_glUniformMatrix4dv(struct trace_reader *reader) {
+    if (!__glUniformMatrix4dv) {
+        trace_missing(reader, TRACE_glUniformMatrix4dv);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLboolean transpose = (GLboolean)trace_read_uint(reader);
+    const GLdouble *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glUniformMatrix4dv(location, count, transpose, value);
+}
+
+static void APIENTRY trace_glUniformMatrix2x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    trace_command(TRACE_glUniformMatrix2x3dv);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_uint(transpose);
+    trace_write_array(value, (size_t)((count)*6), sizeof(GLdouble));
+    trace_real.glUniformMatrix2x3dv(location, count, transpose, value);
+}
+
+static void trace_replay_glUniformMatrix2x3dv(struct trace_reader *reader) {
+    if (!__glUniformMatrix2x3dv) {
+        trace_missing(reader, TRACE_glUniformMatrix2x3dv);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLboolean transpose = (GLboolean)trace_read_uint(reader);
+    const GLdouble *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glUniformMatrix2x3dv(location, count, transpose, value);
+}
+
+static void APIENTRY trace_glUniformMatrix2x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    trace_command(TRACE_glUniformMatrix2x4dv);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_uint(transpose);
+    trace_write_array(value, (size_t)((count)*8), sizeof(GLdouble));
+    trace_real.glUniformMatrix2x4dv(location, count, transpose, value);
+}
+
+static void trace_replay_glUniformMatrix2x4dv(struct trace_reader *reader) {
+    if (!__glUniformMatrix2x4dv) {
+        trace_missing(reader, TRACE_glUniformMatrix2x4dv);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLboolean transpose = (GLboolean)trace_read_uint(reader);
+    const GLdouble *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glUniformMatrix2x4dv(location, count, transpose, value);
+}
+
+static void APIENTRY trace_glUniformMatrix3x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    trace_command(TRACE_glUniformMatrix3x2dv);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_uint(transpose);
+    trace_write_array(value, (size_t)((count)*6), sizeof(GLdouble));
+    trace_real.glUniformMatrix3x2dv(location, count, transpose, value);
+}
+
+static void trace_replay_glUniformMatrix3x2dv(struct trace_reader *reader) {
+    if (!__glUniformMatrix3x2dv) {
+        trace_missing(reader, TRACE_glUniformMatrix3x2dv);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLboolean transpose = (GLboolean)trace_read_uint(reader);
+    const GLdouble *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glUniformMatrix3x2dv(location, count, transpose, value);
+}
+
+static void APIENTRY trace_glUniformMatrix3x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    trace_command(TRACE_glUniformMatrix3x4dv);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_uint(transpose);
+    trace_write_array(value, (size_t)((count)*12), sizeof(GLdouble));
+    trace_real.glUniformMatrix3x4dv(location, count, transpose, value);
+}
+
+static void trace_replay_glUniformMatrix3x4dv(struct trace_reader *reader) {
+    if (!__glUniformMatrix3x4dv) {
+        trace_missing(reader, TRACE_glUniformMatrix3x4dv);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLboolean transpose = (GLboolean)trace_read_uint(reader);
+    const GLdouble *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glUniformMatrix3x4dv(location, count, transpose, value);
+}
+
+static void APIENTRY trace_glUniformMatrix4x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    trace_command(TRACE_glUniformMatrix4x2dv);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_uint(transpose);
+    trace_write_array(value, (size_t)((count)*8), sizeof(GLdouble));
+    trace_real.glUniformMatrix4x2dv(location, count, transpose, value);
+}
+
+static void trace_replay_glUniformMatrix4x2dv(struct trace_reader *reader) {
+    if (!__glUniformMatrix4x2dv) {
+        trace_missing(reader, TRACE_glUniformMatrix4x2dv);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLboolean transpose = (GLboolean)trace_read_uint(reader);
+    const GLdouble *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glUniformMatrix4x2dv(location, count, transpose, value);
+}
+
+static void APIENTRY trace_glUniformMatrix4x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    trace_command(TRACE_glUniformMatrix4x3dv);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_uint(transpose);
+    trace_write_array(value, (size_t)((count)*12), sizeof(GLdouble));
+    trace_real.glUniformMatrix4x3dv(location, count, transpose, value);
+}
+
+static void trace_replay_glUniformMatrix4x3dv(struct trace_reader *reader) {
+    if (!__glUniformMatrix4x3dv) {
+        trace_missing(reader, TRACE_glUniformMatrix4x3dv);
+        return;
+    }
+    GLint location = trace_location(reader, reader->program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLboolean transpose = (GLboolean)trace_read_uint(reader);
+    const GLdouble *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glUniformMatrix4x3dv(location, count, transpose, value);
+}
+
+static void APIENTRY trace_glUniformSubroutinesuiv(GLenum shadertype, GLsizei count, const GLuint *indices) {
+    trace_command(TRACE_glUniformSubroutinesuiv);
+    trace_write_uint(shadertype);
+    trace_write_int(count);
+    trace_write_array(indices, (size_t)(count), sizeof(GLuint));
+    trace_real.glUniformSubroutinesuiv(shadertype, count, indices);
+}
+
+static void trace_replay_glUniformSubroutinesuiv(struct trace_reader *reader) {
+    if (!__glUniformSubroutinesuiv) {
+        trace_missing(reader, TRACE_glUniformSubroutinesuiv);
+        return;
+    }
+    GLenum shadertype = (GLenum)trace_read_uint(reader);
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLuint *indices = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glUniformSubroutinesuiv(shadertype, count, indices);
+}
+
+static void APIENTRY trace_glPatchParameteri(GLenum pname, GLint value) {
+    trace_command(TRACE_glPatchParameteri);
+    trace_write_uint(pname);
+    trace_write_int(value);
+    trace_real.glPatchParameteri(pname, value);
+}
+
+static void trace_replay_glPatchParameteri(struct trace_reader *reader) {
+    if (!__glPatchParameteri) {
+        trace_missing(reader, TRACE_glPatchParameteri);
+        return;
+    }
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    GLint value = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glPatchParameteri(pname, value);
+}
+
+static void APIENTRY trace_glPatchParameterfv(GLenum pname, const GLfloat *values) {
+    trace_command(TRACE_glPatchParameterfv);
+    trace_write_uint(pname);
+    trace_write_array(values, (size_t)(trace_pname_count(pname)), sizeof(GLfloat));
+    trace_real.glPatchParameterfv(pname, values);
+}
+
+static void trace_replay_glPatchParameterfv(struct trace_reader *reader) {
+    if (!__glPatchParameterfv) {
+        trace_missing(reader, TRACE_glPatchParameterfv);
+        return;
+    }
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    const GLfloat *values = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glPatchParameterfv(pname, values);
+}
+
+static void APIENTRY trace_glBindTransformFeedback(GLenum target, GLuint id) {
+    trace_command(TRACE_glBindTransformFeedback);
+    trace_write_uint(target);
+    trace_write_uint(id);
+    trace_real.glBindTransformFeedback(target, id);
+}
+
+static void trace_replay_glBindTransformFeedback(struct trace_reader *reader) {
+    if (!__glBindTransformFeedback) {
+        trace_missing(reader, TRACE_glBindTransformFeedback);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLuint id = trace_name(reader, TRACE_NAME_TRANSFORM_FEEDBACK, (GLuint)trace_read_uint(reader));
+    if (reader->error)
+        return;
+    __glBindTransformFeedback(target, id);
+}
+
+static void APIENTRY trace_glDeleteTransformFeedbacks(GLsizei n, const GLuint *ids) {
+    trace_command(TRACE_glDeleteTransformFeedbacks);
+    trace_write_int(n);
+    trace_write_array(ids, (size_t)(n), sizeof(GLuint));
+    trace_real.glDeleteTransformFeedbacks(n, ids);
+}
+
+static void trace_replay_glDeleteTransformFeedbacks(struct trace_reader *reader) {
+    if (!__glDeleteTransformFeedbacks) {
+        trace_missing(reader, TRACE_glDeleteTransformFeedbacks);
+        return;
+    }
+    GLsizei n = (GLsizei)trace_read_int(reader);
+    const GLuint *ids = trace_read_names(reader, TRACE_NAME_TRANSFORM_FEEDBACK);
+    if (reader->error)
+        return;
+    __glDeleteTransformFeedbacks(n, ids);
+}
+
+static void APIENTRY trace_glGenTransformFeedbacks(GLsizei n, GLuint *ids) {
+    trace_command(TRACE_glGenTransformFeedbacks);
+    trace_write_int(n);
+    trace_real.glGenTransformFeedbacks(n, ids);
+    trace_write_array(ids, (size_t)(n), sizeof(GLuint));
+}
+
+static void trace_replay_glGenTransformFeedbacks(struct trace_reader *reader) {
+    if (!__glGenTransformFeedbacks) {
+        trace_missing(reader, TRACE_glGenTransformFeedbacks);
+        return;
+    }
+    GLsizei n = (GLsizei)trace_read_int(reader);
+    GLuint *ids = trace_scratch(reader, (size_t)(n) * sizeof(GLuint));
+    if (reader->error)
+        return;
+    __glGenTransformFeedbacks(n, ids);
+    trace_map_names(reader, TRACE_NAME_TRANSFORM_FEEDBACK, ids, (size_t)(n));
+}
+
+static void APIENTRY trace_glPauseTransformFeedback(void) {
+    trace_command(TRACE_glPauseTransformFeedback);
+    trace_real.glPauseTransformFeedback();
+}
+
+static void trace_replay_glPauseTransformFeedback(struct trace_reader *reader) {
+    if (!__glPauseTransformFeedback) {
+        trace_missing(reader, TRACE_glPauseTransformFeedback);
+        return;
+    }
+    if (reader->error)
+        return;
+    __glPauseTransformFeedback();
+}
+
+static void APIENTRY trace_glResumeTransformFeedback(void) {
+    trace_command(TRACE_glResumeTransformFeedback);
+    trace_real.glResumeTransformFeedback();
+}
+
+static void trace_replay_glResumeTransformFeedback(struct trace_reader *reader) {
+    if (!__glResumeTransformFeedback) {
+        trace_missing(reader, TRACE_glResumeTransformFeedback);
+        return;
+    }
+    if (reader->error)
+        return;
+    __glResumeTransformFeedback();
+}
+
+static void APIENTRY trace_glDrawTransformFeedback(GLenum mode, GLuint id) {
+    trace_command(TRACE_glDrawTransformFeedback);
+    trace_write_uint(mode);
+    trace_write_uint(id);
+    trace_real.glDrawTransformFeedback(mode, id);
+}
+
+static void trace_replay_glDrawTransformFeedback(struct trace_reader *reader) {
+    if (!__glDrawTransformFeedback) {
+        trace_missing(reader, TRACE_glDrawTransformFeedback);
+        return;
+    }
+    GLenum mode = (GLenum)trace_read_uint(reader);
+    GLuint id = trace_name(reader, TRACE_NAME_TRANSFORM_FEEDBACK, (GLuint)trace_read_uint(reader));
+    if (reader->error)
+        return;
+    __glDrawTransformFeedback(mode, id);
+}
+
+static void APIENTRY trace_glDrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream) {
+    trace_command(TRACE_glDrawTransformFeedbackStream);
+    trace_write_uint(mode);
+    trace_write_uint(id);
+    trace_write_uint(stream);
+    trace_real.glDrawTransformFeedbackStream(mode, id, stream);
+}
+
+static void trace_replay_glDrawTransformFeedbackStream(struct trace_reader *reader) {
+    if (!__glDrawTransformFeedbackStream) {
+        trace_missing(reader, TRACE_glDrawTransformFeedbackStream);
+        return;
+    }
+    GLenum mode = (GLenum)trace_read_uint(reader);
+    GLuint id = trace_name(reader, TRACE_NAME_TRANSFORM_FEEDBACK, (GLuint)trace_read_uint(reader));
+    GLuint stream = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glDrawTransformFeedbackStream(mode, id, stream);
+}
+
+static void APIENTRY trace_glBeginQueryIndexed(GLenum target, GLuint index, GLuint id) {
+    trace_command(TRACE_glBeginQueryIndexed);
+    trace_write_uint(target);
+    trace_write_uint(index);
+    trace_write_uint(id);
+    trace_real.glBeginQueryIndexed(target, index, id);
+}
+
+static void trace_replay_glBeginQueryIndexed(struct trace_reader *reader) {
+    if (!__glBeginQueryIndexed) {
+        trace_missing(reader, TRACE_glBeginQueryIndexed);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLuint id = trace_name(reader, TRACE_NAME_QUERY, (GLuint)trace_read_uint(reader));
+    if (reader->error)
+        return;
+    __glBeginQueryIndexed(target, index, id);
+}
+
+static void APIENTRY trace_glEndQueryIndexed(GLenum target, GLuint index) {
+    trace_command(TRACE_glEndQueryIndexed);
+    trace_write_uint(target);
+    trace_write_uint(index);
+    trace_real.glEndQueryIndexed(target, index);
+}
+
+static void trace_replay_glEndQueryIndexed(struct trace_reader *reader) {
+    if (!__glEndQueryIndexed) {
+        trace_missing(reader, TRACE_glEndQueryIndexed);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLuint index = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glEndQueryIndexed(target, index);
+}
+
+#endif
+
+#if FUNGL_VERSION >= GL_VERSION_4_1
+static void APIENTRY trace_glReleaseShaderCompiler(void) {
+    trace_command(TRACE_glReleaseShaderCompiler);
+    trace_real.glReleaseShaderCompiler();
+}
+
+static void trace_replay_glReleaseShaderCompiler(struct trace_reader *reader) {
+    if (!__glReleaseShaderCompiler) {
+        trace_missing(reader, TRACE_glReleaseShaderCompiler);
+        return;
+    }
+    if (reader->error)
+        return;
+    __glReleaseShaderCompiler();
+}
+
+static void APIENTRY trace_glShaderBinary(GLsizei count, const GLuint *shaders, GLenum binaryFormat, const void *binary, GLsizei length) {
+    trace_command(TRACE_glShaderBinary);
+    trace_write_int(count);
+    trace_write_array(shaders, (size_t)(count), sizeof(GLuint));
+    trace_write_uint(binaryFormat);
+    trace_write_array(binary, (size_t)(length), 1);
+    trace_write_int(length);
+    trace_real.glShaderBinary(count, shaders, binaryFormat, binary, length);
+}
+
+static void trace_replay_glShaderBinary(struct trace_reader *reader) {
+    if (!__glShaderBinary) {
+        trace_missing(reader, TRACE_glShaderBinary);
+        return;
+    }
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLuint *shaders = trace_read_names(reader, TRACE_NAME_PROGRAM);
+    GLenum binaryFormat = (GLenum)trace_read_uint(reader);
+    const void *binary = trace_read_array(reader);
+    GLsizei length = (GLsizei)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glShaderBinary(count, shaders, binaryFormat, binary, length);
+}
+
+static void APIENTRY trace_glDepthRangef(GLfloat n, GLfloat f) {
+    trace_command(TRACE_glDepthRangef);
+    trace_write_float(n);
+    trace_write_float(f);
+    trace_real.glDepthRangef(n, f);
+}
+
+static void trace_replay_glDepthRangef(struct trace_reader *reader) {
+    if (!__glDepthRangef) {
+        trace_missing(reader, TRACE_glDepthRangef);
+        return;
+    }
+    GLfloat n = trace_read_float(reader);
+    GLfloat f = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glDepthRangef(n, f);
+}
+
+static void APIENTRY trace_glClearDepthf(GLfloat d) {
+    trace_command(TRACE_glClearDepthf);
+    trace_write_float(d);
+    trace_real.glClearDepthf(d);
+}
+
+static void trace_replay_glClearDepthf(struct trace_reader *reader) {
+    if (!__glClearDepthf) {
+        trace_missing(reader, TRACE_glClearDepthf);
+        return;
+    }
+    GLfloat d = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glClearDepthf(d);
+}
+
+static void APIENTRY trace_glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length) {
+    trace_command(TRACE_glProgramBinary);
+    trace_write_uint(program);
+    trace_write_uint(binaryFormat);
+    trace_write_array(binary, (size_t)(length), 1);
+    trace_write_int(length);
+    trace_real.glProgramBinary(program, binaryFormat, binary, length);
+}
+
+static void trace_replay_glProgramBinary(struct trace_reader *reader) {
+    if (!__glProgramBinary) {
+        trace_missing(reader, TRACE_glProgramBinary);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLenum binaryFormat = (GLenum)trace_read_uint(reader);
+    const void *binary = trace_read_array(reader);
+    GLsizei length = (GLsizei)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glProgramBinary(program, binaryFormat, binary, length);
+}
+
+static void APIENTRY trace_glProgramParameteri(GLuint program, GLenum pname, GLint value) {
+    trace_command(TRACE_glProgramParameteri);
+    trace_write_uint(program);
+    trace_write_uint(pname);
+    trace_write_int(value);
+    trace_real.glProgramParameteri(program, pname, value);
+}
+
+static void trace_replay_glProgramParameteri(struct trace_reader *reader) {
+    if (!__glProgramParameteri) {
+        trace_missing(reader, TRACE_glProgramParameteri);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    GLint value = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glProgramParameteri(program, pname, value);
+}
+
+static void APIENTRY trace_glUseProgramStages(GLuint pipeline, GLbitfield stages, GLuint program) {
+    trace_command(TRACE_glUseProgramStages);
+    trace_write_uint(pipeline);
+    trace_write_uint(stages);
+    trace_write_uint(program);
+    trace_real.glUseProgramStages(pipeline, stages, program);
+}
+
+static void trace_replay_glUseProgramStages(struct trace_reader *reader) {
+    if (!__glUseProgramStages) {
+        trace_missing(reader, TRACE_glUseProgramStages);
+        return;
+    }
+    GLuint pipeline = trace_name(reader, TRACE_NAME_PROGRAM_PIPELINE, (GLuint)trace_read_uint(reader));
+    GLbitfield stages = (GLbitfield)trace_read_uint(reader);
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    if (reader->error)
+        return;
+    __glUseProgramStages(pipeline, stages, program);
+}
+
+static void APIENTRY trace_glActiveShaderProgram(GLuint pipeline, GLuint program) {
+    trace_command(TRACE_glActiveShaderProgram);
+    trace_write_uint(pipeline);
+    trace_write_uint(program);
+    trace_real.glActiveShaderProgram(pipeline, program);
+}
+
+static void trace_replay_glActiveShaderProgram(struct trace_reader *reader) {
+    if (!__glActiveShaderProgram) {
+        trace_missing(reader, TRACE_glActiveShaderProgram);
+        return;
+    }
+    GLuint pipeline = trace_name(reader, TRACE_NAME_PROGRAM_PIPELINE, (GLuint)trace_read_uint(reader));
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    if (reader->error)
+        return;
+    __glActiveShaderProgram(pipeline, program);
+}
+
+static GLuint APIENTRY trace_glCreateShaderProgramv(GLenum type, GLsizei count, const GLchar *const*strings) {
+    trace_command(TRACE_glCreateShaderProgramv);
+    trace_write_uint(type);
+    trace_write_int(count);
+    trace_write_strings(strings, count, NULL);
+    GLuint result = trace_real.glCreateShaderProgramv(type, count, strings);
+    trace_write_uint(result);
+    return result;
+}
+
+static void trace_replay_glCreateShaderProgramv(struct trace_reader *reader) {
+    if (!__glCreateShaderProgramv) {
+        trace_missing(reader, TRACE_glCreateShaderProgramv);
+        return;
+    }
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLchar *const*strings = trace_read_strings(reader);
+    if (reader->error)
+        return;
+    GLuint result = __glCreateShaderProgramv(type, count, strings);
+    trace_map_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader), result, 1);
+}
+
+static void APIENTRY trace_glBindProgramPipeline(GLuint pipeline) {
+    trace_command(TRACE_glBindProgramPipeline);
+    trace_write_uint(pipeline);
+    trace_real.glBindProgramPipeline(pipeline);
+}
+
+static void trace_replay_glBindProgramPipeline(struct trace_reader *reader) {
+    if (!__glBindProgramPipeline) {
+        trace_missing(reader, TRACE_glBindProgramPipeline);
+        return;
+    }
+    GLuint pipeline = trace_name(reader, TRACE_NAME_PROGRAM_PIPELINE, (GLuint)trace_read_uint(reader));
+    if (reader->error)
+        return;
+    __glBindProgramPipeline(pipeline);
+}
+
+static void APIENTRY trace_glDeleteProgramPipelines(GLsizei n, const GLuint *pipelines) {
+    trace_command(TRACE_glDeleteProgramPipelines);
+    trace_write_int(n);
+    trace_write_array(pipelines, (size_t)(n), sizeof(GLuint));
+    trace_real.glDeleteProgramPipelines(n, pipelines);
+}
+
+static void trace_replay_glDeleteProgramPipelines(struct trace_reader *reader) {
+    if (!__glDeleteProgramPipelines) {
+        trace_missing(reader, TRACE_glDeleteProgramPipelines);
+        return;
+    }
+    GLsizei n = (GLsizei)trace_read_int(reader);
+    const GLuint *pipelines = trace_read_names(reader, TRACE_NAME_PROGRAM_PIPELINE);
+    if (reader->error)
+        return;
+    __glDeleteProgramPipelines(n, pipelines);
+}
+
+static void APIENTRY trace_glGenProgramPipelines(GLsizei n, GLuint *pipelines) {
+    trace_command(TRACE_glGenProgramPipelines);
+    trace_write_int(n);
+    trace_real.glGenProgramPipelines(n, pipelines);
+    trace_write_array(pipelines, (size_t)(n), sizeof(GLuint));
+}
+
+static void trace_replay_glGenProgramPipelines(struct trace_reader *reader) {
+    if (!__glGenProgramPipelines) {
+        trace_missing(reader, TRACE_glGenProgramPipelines);
+        return;
+    }
+    GLsizei n = (GLsizei)trace_read_int(reader);
+    GLuint *pipelines = trace_scratch(reader, (size_t)(n) * sizeof(GLuint));
+    if (reader->error)
+        return;
+    __glGenProgramPipelines(n, pipelines);
+    trace_map_names(reader, TRACE_NAME_PROGRAM_PIPELINE, pipelines, (size_t)(n));
+}
+
+static void APIENTRY trace_glProgramUniform1i(GLuint program, GLint location, GLint v0) {
+    trace_command(TRACE_glProgramUniform1i);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_int(v0);
+    trace_real.glProgramUniform1i(program, location, v0);
+}
+
+static void trace_replay_glProgramUniform1i(struct trace_reader *reader) {
+    if (!__glProgramUniform1i) {
+        trace_missing(reader, TRACE_glProgramUniform1i);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLint v0 = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glProgramUniform1i(program, location, v0);
+}
+
+static void APIENTRY trace_glProgramUniform1iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+    trace_command(TRACE_glProgramUniform1iv);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_array(value, (size_t)(count), sizeof(GLint));
+    trace_real.glProgramUniform1iv(program, location, count, value);
+}
+
+static void trace_replay_glProgramUniform1iv(struct trace_reader *reader) {
+    if (!__glProgramUniform1iv) {
+        trace_missing(reader, TRACE_glProgramUniform1iv);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLint *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glProgramUniform1iv(program, location, count, value);
+}
+
+static void APIENTRY trace_glProgramUniform1f(GLuint program, GLint location, GLfloat v0) {
+    trace_command(TRACE_glProgramUniform1f);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_float(v0);
+    trace_real.glProgramUniform1f(program, location, v0);
+}
+
+static void trace_replay_glProgramUniform1f(struct trace_reader *reader) {
+    if (!__glProgramUniform1f) {
+        trace_missing(reader, TRACE_glProgramUniform1f);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLfloat v0 = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glProgramUniform1f(program, location, v0);
+}
+
+static void APIENTRY trace_glProgramUniform1fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+    trace_command(TRACE_glProgramUniform1fv);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_array(value, (size_t)(count), sizeof(GLfloat));
+    trace_real.glProgramUniform1fv(program, location, count, value);
+}
+
+static void trace_replay_glProgramUniform1fv(struct trace_reader *reader) {
+    if (!__glProgramUniform1fv) {
+        trace_missing(reader, TRACE_glProgramUniform1fv);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLfloat *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glProgramUniform1fv(program, location, count, value);
+}
+
+static void APIENTRY trace_glProgramUniform1d(GLuint program, GLint location, GLdouble v0) {
+    trace_command(TRACE_glProgramUniform1d);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_double(v0);
+    trace_real.glProgramUniform1d(program, location, v0);
+}
+
+static void trace_replay_glProgramUniform1d(struct trace_reader *reader) {
+    if (!__glProgramUniform1d) {
+        trace_missing(reader, TRACE_glProgramUniform1d);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLdouble v0 = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glProgramUniform1d(program, location, v0);
+}
+
+static void APIENTRY trace_glProgramUniform1dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+    trace_command(TRACE_glProgramUniform1dv);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_array(value, (size_t)(count), sizeof(GLdouble));
+    trace_real.glProgramUniform1dv(program, location, count, value);
+}
+
+static void trace_replay_glProgramUniform1dv(struct trace_reader *reader) {
+    if (!__glProgramUniform1dv) {
+        trace_missing(reader, TRACE_glProgramUniform1dv);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLdouble *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glProgramUniform1dv(program, location, count, value);
+}
+
+static void APIENTRY trace_glProgramUniform1ui(GLuint program, GLint location, GLuint v0) {
+    trace_command(TRACE_glProgramUniform1ui);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_uint(v0);
+    trace_real.glProgramUniform1ui(program, location, v0);
+}
+
+static void trace_replay_glProgramUniform1ui(struct trace_reader *reader) {
+    if (!__glProgramUniform1ui) {
+        trace_missing(reader, TRACE_glProgramUniform1ui);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLuint v0 = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glProgramUniform1ui(program, location, v0);
+}
+
+static void APIENTRY trace_glProgramUniform1uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+    trace_command(TRACE_glProgramUniform1uiv);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_array(value, (size_t)(count), sizeof(GLuint));
+    trace_real.glProgramUniform1uiv(program, location, count, value);
+}
+
+static void trace_replay_glProgramUniform1uiv(struct trace_reader *reader) {
+    if (!__glProgramUniform1uiv) {
+        trace_missing(reader, TRACE_glProgramUniform1uiv);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLuint *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glProgramUniform1uiv(program, location, count, value);
+}
+
+static void APIENTRY trace_glProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1) {
+    trace_command(TRACE_glProgramUniform2i);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_int(v0);
+    trace_write_int(v1);
+    trace_real.glProgramUniform2i(program, location, v0, v1);
+}
+
+static void trace_replay_glProgramUniform2i(struct trace_reader *reader) {
+    if (!__glProgramUniform2i) {
+        trace_missing(reader, TRACE_glProgramUniform2i);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLint v0 = (GLint)trace_read_int(reader);
+    GLint v1 = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glProgramUniform2i(program, location, v0, v1);
+}
+
+static void APIENTRY trace_glProgramUniform2iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+    trace_command(TRACE_glProgramUniform2iv);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_array(value, (size_t)((count)*2), sizeof(GLint));
+    trace_real.glProgramUniform2iv(program, location, count, value);
+}
+
+static void trace_replay_glProgramUniform2iv(struct trace_reader *reader) {
+    if (!__glProgramUniform2iv) {
+        trace_missing(reader, TRACE_glProgramUniform2iv);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLint *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glProgramUniform2iv(program, location, count, value);
+}
+
+static void APIENTRY trace_glProgramUniform2f(GLuint program, GLint location, GLfloat v0, GLfloat v1) {
+    trace_command(TRACE_glProgramUniform2f);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_float(v0);
+    trace_write_float(v1);
+    trace_real.glProgramUniform2f(program, location, v0, v1);
+}
+
+static void trace_replay_glProgramUniform2f(struct trace_reader *reader) {
+    if (!__glProgramUniform2f) {
+        trace_missing(reader, TRACE_glProgramUniform2f);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLfloat v0 = trace_read_float(reader);
+    GLfloat v1 = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glProgramUniform2f(program, location, v0, v1);
+}
+
+static void APIENTRY trace_glProgramUniform2fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+    trace_command(TRACE_glProgramUniform2fv);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_array(value, (size_t)((count)*2), sizeof(GLfloat));
+    trace_real.glProgramUniform2fv(program, location, count, value);
+}
+
+static void trace_replay_glProgramUniform2fv(struct trace_reader *reader) {
+    if (!__glProgramUniform2fv) {
+        trace_missing(reader, TRACE_glProgramUniform2fv);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLfloat *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glProgramUniform2fv(program, location, count, value);
+}
+
+static void APIENTRY trace_glProgramUniform2d(GLuint program, GLint location, GLdouble v0, GLdouble v1) {
+    trace_command(TRACE_glProgramUniform2d);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_double(v0);
+    trace_write_double(v1);
+    trace_real.glProgramUniform2d(program, location, v0, v1);
+}
+
+static void trace_replay_glProgramUniform2d(struct trace_reader *reader) {
+    if (!__glProgramUniform2d) {
+        trace_missing(reader, TRACE_glProgramUniform2d);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLdouble v0 = trace_read_double(reader);
+    GLdouble v1 = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glProgramUniform2d(program, location, v0, v1);
+}
+
+static void APIENTRY trace_glProgramUniform2dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+    trace_command(TRACE_glProgramUniform2dv);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_array(value, (size_t)((count)*2), sizeof(GLdouble));
+    trace_real.glProgramUniform2dv(program, location, count, value);
+}
+
+static void trace_replay_glProgramUniform2dv(struct trace_reader *reader) {
+    if (!__glProgramUniform2dv) {
+        trace_missing(reader, TRACE_glProgramUniform2dv);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLdouble *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glProgramUniform2dv(program, location, count, value);
+}
+
+static void APIENTRY trace_glProgramUniform2ui(GLuint program, GLint location, GLuint v0, GLuint v1) {
+    trace_command(TRACE_glProgramUniform2ui);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_uint(v0);
+    trace_write_uint(v1);
+    trace_real.glProgramUniform2ui(program, location, v0, v1);
+}
+
+static void trace_replay_glProgramUniform2ui(struct trace_reader *reader) {
+    if (!__glProgramUniform2ui) {
+        trace_missing(reader, TRACE_glProgramUniform2ui);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLuint v0 = (GLuint)trace_read_uint(reader);
+    GLuint v1 = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glProgramUniform2ui(program, location, v0, v1);
+}
+
+static void APIENTRY trace_glProgramUniform2uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+    trace_command(TRACE_glProgramUniform2uiv);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_array(value, (size_t)((count)*2), sizeof(GLuint));
+    trace_real.glProgramUniform2uiv(program, location, count, value);
+}
+
+static void trace_replay_glProgramUniform2uiv(struct trace_reader *reader) {
+    if (!__glProgramUniform2uiv) {
+        trace_missing(reader, TRACE_glProgramUniform2uiv);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLuint *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glProgramUniform2uiv(program, location, count, value);
+}
+
+static void APIENTRY trace_glProgramUniform3i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2) {
+    trace_command(TRACE_glProgramUniform3i);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_int(v0);
+    trace_write_int(v1);
+    trace_write_int(v2);
+    trace_real.glProgramUniform3i(program, location, v0, v1, v2);
+}
+
+static void trace_replay_glProgramUniform3i(struct trace_reader *reader) {
+    if (!__glProgramUniform3i) {
+        trace_missing(reader, TRACE_glProgramUniform3i);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLint v0 = (GLint)trace_read_int(reader);
+    GLint v1 = (GLint)trace_read_int(reader);
+    GLint v2 = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glProgramUniform3i(program, location, v0, v1, v2);
+}
+
+static void APIENTRY trace_glProgramUniform3iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+    trace_command(TRACE_glProgramUniform3iv);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_array(value, (size_t)((count)*3), sizeof(GLint));
+    trace_real.glProgramUniform3iv(program, location, count, value);
+}
+
+static void trace_replay_glProgramUniform3iv(struct trace_reader *reader) {
+    if (!__glProgramUniform3iv) {
+        trace_missing(reader, TRACE_glProgramUniform3iv);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLint *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glProgramUniform3iv(program, location, count, value);
+}
+
+static void APIENTRY trace_glProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+    trace_command(TRACE_glProgramUniform3f);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_float(v0);
+    trace_write_float(v1);
+    trace_write_float(v2);
+    trace_real.glProgramUniform3f(program, location, v0, v1, v2);
+}
+
+static void trace_replay_glProgramUniform3f(struct trace_reader *reader) {
+    if (!__glProgramUniform3f) {
+        trace_missing(reader, TRACE_glProgramUniform3f);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLfloat v0 = trace_read_float(reader);
+    GLfloat v1 = trace_read_float(reader);
+    GLfloat v2 = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glProgramUniform3f(program, location, v0, v1, v2);
+}
+
+static void APIENTRY trace_glProgramUniform3fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+    trace_command(TRACE_glProgramUniform3fv);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_array(value, (size_t)((count)*3), sizeof(GLfloat));
+    trace_real.glProgramUniform3fv(program, location, count, value);
+}
+
+static void trace_replay_glProgramUniform3fv(struct trace_reader *reader) {
+    if (!__glProgramUniform3fv) {
+        trace_missing(reader, TRACE_glProgramUniform3fv);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLfloat *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glProgramUniform3fv(program, location, count, value);
+}
+
+static void APIENTRY trace_glProgramUniform3d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2) {
+    trace_command(TRACE_glProgramUniform3d);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_double(v0);
+    trace_write_double(v1);
+    trace_write_double(v2);
+    trace_real.glProgramUniform3d(program, location, v0, v1, v2);
+}
+
+static void trace_replay_glProgramUniform3d(struct trace_reader *reader) {
+    if (!__glProgramUniform3d) {
+        trace_missing(reader, TRACE_glProgramUniform3d);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLdouble v0 = trace_read_double(reader);
+    GLdouble v1 = trace_read_double(reader);
+    GLdouble v2 = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glProgramUniform3d(program, location, v0, v1, v2);
+}
+
+static void APIENTRY trace_glProgramUniform3dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+    trace_command(TRACE_glProgramUniform3dv);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_array(value, (size_t)((count)*3), sizeof(GLdouble));
+    trace_real.glProgramUniform3dv(program, location, count, value);
+}
+
+static void trace_replay_glProgramUniform3dv(struct trace_reader *reader) {
+    if (!__glProgramUniform3dv) {
+        trace_missing(reader, TRACE_glProgramUniform3dv);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLdouble *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glProgramUniform3dv(program, location, count, value);
+}
+
+static void APIENTRY trace_glProgramUniform3ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2) {
+    trace_command(TRACE_glProgramUniform3ui);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_uint(v0);
+    trace_write_uint(v1);
+    trace_write_uint(v2);
+    trace_real.glProgramUniform3ui(program, location, v0, v1, v2);
+}
+
+static void trace_replay_glProgramUniform3ui(struct trace_reader *reader) {
+    if (!__glProgramUniform3ui) {
+        trace_missing(reader, TRACE_glProgramUniform3ui);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLuint v0 = (GLuint)trace_read_uint(reader);
+    GLuint v1 = (GLuint)trace_read_uint(reader);
+    GLuint v2 = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glProgramUniform3ui(program, location, v0, v1, v2);
+}
+
+static void APIENTRY trace_glProgramUniform3uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+    trace_command(TRACE_glProgramUniform3uiv);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_array(value, (size_t)((count)*3), sizeof(GLuint));
+    trace_real.glProgramUniform3uiv(program, location, count, value);
+}
+
+static void trace_replay_glProgramUniform3uiv(struct trace_reader *reader) {
+    if (!__glProgramUniform3uiv) {
+        trace_missing(reader, TRACE_glProgramUniform3uiv);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLuint *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glProgramUniform3uiv(program, location, count, value);
+}
+
+static void APIENTRY trace_glProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+    trace_command(TRACE_glProgramUniform4i);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_int(v0);
+    trace_write_int(v1);
+    trace_write_int(v2);
+    trace_write_int(v3);
+    trace_real.glProgramUniform4i(program, location, v0, v1, v2, v3);
+}
+
+static void trace_replay_glProgramUniform4i(struct trace_reader *reader) {
+    if (!__glProgramUniform4i) {
+        trace_missing(reader, TRACE_glProgramUniform4i);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLint v0 = (GLint)trace_read_int(reader);
+    GLint v1 = (GLint)trace_read_int(reader);
+    GLint v2 = (GLint)trace_read_int(reader);
+    GLint v3 = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glProgramUniform4i(program, location, v0, v1, v2, v3);
+}
+
+static void APIENTRY trace_glProgramUniform4iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+    trace_command(TRACE_glProgramUniform4iv);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_array(value, (size_t)((count)*4), sizeof(GLint));
+    trace_real.glProgramUniform4iv(program, location, count, value);
+}
+
+static void trace_replay_glProgramUniform4iv(struct trace_reader *reader) {
+    if (!__glProgramUniform4iv) {
+        trace_missing(reader, TRACE_glProgramUniform4iv);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLint *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glProgramUniform4iv(program, location, count, value);
+}
+
+static void APIENTRY trace_glProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+    trace_command(TRACE_glProgramUniform4f);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_float(v0);
+    trace_write_float(v1);
+    trace_write_float(v2);
+    trace_write_float(v3);
+    trace_real.glProgramUniform4f(program, location, v0, v1, v2, v3);
+}
+
+static void trace_replay_glProgramUniform4f(struct trace_reader *reader) {
+    if (!__glProgramUniform4f) {
+        trace_missing(reader, TRACE_glProgramUniform4f);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLfloat v0 = trace_read_float(reader);
+    GLfloat v1 = trace_read_float(reader);
+    GLfloat v2 = trace_read_float(reader);
+    GLfloat v3 = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glProgramUniform4f(program, location, v0, v1, v2, v3);
+}
+
+static void APIENTRY trace_glProgramUniform4fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+    trace_command(TRACE_glProgramUniform4fv);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_array(value, (size_t)((count)*4), sizeof(GLfloat));
+    trace_real.glProgramUniform4fv(program, location, count, value);
+}
+
+static void trace_replay_glProgramUniform4fv(struct trace_reader *reader) {
+    if (!__glProgramUniform4fv) {
+        trace_missing(reader, TRACE_glProgramUniform4fv);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLfloat *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glProgramUniform4fv(program, location, count, value);
+}
+
+static void APIENTRY trace_glProgramUniform4d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3) {
+    trace_command(TRACE_glProgramUniform4d);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_double(v0);
+    trace_write_double(v1);
+    trace_write_double(v2);
+    trace_write_double(v3);
+    trace_real.glProgramUniform4d(program, location, v0, v1, v2, v3);
+}
+
+static void trace_replay_glProgramUniform4d(struct trace_reader *reader) {
+    if (!__glProgramUniform4d) {
+        trace_missing(reader, TRACE_glProgramUniform4d);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLdouble v0 = trace_read_double(reader);
+    GLdouble v1 = trace_read_double(reader);
+    GLdouble v2 = trace_read_double(reader);
+    GLdouble v3 = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glProgramUniform4d(program, location, v0, v1, v2, v3);
+}
+
+static void APIENTRY trace_glProgramUniform4dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+    trace_command(TRACE_glProgramUniform4dv);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_array(value, (size_t)((count)*4), sizeof(GLdouble));
+    trace_real.glProgramUniform4dv(program, location, count, value);
+}
+
+static void trace_replay_glProgramUniform4dv(struct trace_reader *reader) {
+    if (!__glProgramUniform4dv) {
+        trace_missing(reader, TRACE_glProgramUniform4dv);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLdouble *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glProgramUniform4dv(program, location, count, value);
+}
+
+static void APIENTRY trace_glProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+    trace_command(TRACE_glProgramUniform4ui);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_uint(v0);
+    trace_write_uint(v1);
+    trace_write_uint(v2);
+    trace_write_uint(v3);
+    trace_real.glProgramUniform4ui(program, location, v0, v1, v2, v3);
+}
+
+static void trace_replay_glProgramUniform4ui(struct trace_reader *reader) {
+    if (!__glProgramUniform4ui) {
+        trace_missing(reader, TRACE_glProgramUniform4ui);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLuint v0 = (GLuint)trace_read_uint(reader);
+    GLuint v1 = (GLuint)trace_read_uint(reader);
+    GLuint v2 = (GLuint)trace_read_uint(reader);
+    GLuint v3 = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glProgramUniform4ui(program, location, v0, v1, v2, v3);
+}
+
+static void APIENTRY trace_glProgramUniform4uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+    trace_command(TRACE_glProgramUniform4uiv);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_array(value, (size_t)((count)*4), sizeof(GLuint));
+    trace_real.glProgramUniform4uiv(program, location, count, value);
+}
+
+static void trace_replay_glProgramUniform4uiv(struct trace_reader *reader) {
+    if (!__glProgramUniform4uiv) {
+        trace_missing(reader, TRACE_glProgramUniform4uiv);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLuint *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glProgramUniform4uiv(program, location, count, value);
+}
+
+static void APIENTRY trace_glProgramUniformMatrix2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    trace_command(TRACE_glProgramUniformMatrix2fv);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_uint(transpose);
+    trace_write_array(value, (size_t)((count)*4), sizeof(GLfloat));
+    trace_real.glProgramUniformMatrix2fv(program, location, count, transpose, value);
+}
+
+static void trace_replay_glProgramUniformMatrix2fv(struct trace_reader *reader) {
+    if (!__glProgramUniformMatrix2fv) {
+        trace_missing(reader, TRACE_glProgramUniformMatrix2fv);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLboolean transpose = (GLboolean)trace_read_uint(reader);
+    const GLfloat *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glProgramUniformMatrix2fv(program, location, count, transpose, value);
+}
+
+static void APIENTRY trace_glProgramUniformMatrix3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    trace_command(TRACE_glProgramUniformMatrix3fv);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_uint(transpose);
+    trace_write_array(value, (size_t)((count)*9), sizeof(GLfloat));
+    trace_real.glProgramUniformMatrix3fv(program, location, count, transpose, value);
+}
+
+static void trace_replay_glProgramUniformMatrix3fv(struct trace_reader *reader) {
+    if (!__glProgramUniformMatrix3fv) {
+        trace_missing(reader, TRACE_glProgramUniformMatrix3fv);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLboolean transpose = (GLboolean)trace_read_uint(reader);
+    const GLfloat *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glProgramUniformMatrix3fv(program, location, count, transpose, value);
+}
+
+static void APIENTRY trace_glProgramUniformMatrix4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    trace_command(TRACE_glProgramUniformMatrix4fv);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_uint(transpose);
+    trace_write_array(value, (size_t)((count)*16), sizeof(GLfloat));
+    trace_real.glProgramUniformMatrix4fv(program, location, count, transpose, value);
+}
+
+static void trace_replay_glProgramUniformMatrix4fv(struct trace_reader *reader) {
+    if (!__glProgramUniformMatrix4fv) {
+        trace_missing(reader, TRACE_glProgramUniformMatrix4fv);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLboolean transpose = (GLboolean)trace_read_uint(reader);
+    const GLfloat *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glProgramUniformMatrix4fv(program, location, count, transpose, value);
+}
+
+static void APIENTRY trace_glProgramUniformMatrix2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    trace_command(TRACE_glProgramUniformMatrix2dv);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_uint(transpose);
+    trace_write_array(value, (size_t)((count)*4), sizeof(GLdouble));
+    trace_real.glProgramUniformMatrix2dv(program, location, count, transpose, value);
+}
+
+static void trace_replay_glProgramUniformMatrix2dv(struct trace_reader *reader) {
+    if (!__glProgramUniformMatrix2dv) {
+        trace_missing(reader, TRACE_glProgramUniformMatrix2dv);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLboolean transpose = (GLboolean)trace_read_uint(reader);
+    const GLdouble *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glProgramUniformMatrix2dv(program, location, count, transpose, value);
+}
+
+static void APIENTRY trace_glProgramUniformMatrix3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    trace_command(TRACE_glProgramUniformMatrix3dv);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_uint(transpose);
+    trace_write_array(value, (size_t)((count)*9), sizeof(GLdouble));
+    trace_real.glProgramUniformMatrix3dv(program, location, count, transpose, value);
+}
+
+static void trace_replay_glProgramUniformMatrix3dv(struct trace_reader *reader) {
+    if (!__glProgramUniformMatrix3dv) {
+        trace_missing(reader, TRACE_glProgramUniformMatrix3dv);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLboolean transpose = (GLboolean)trace_read_uint(reader);
+    const GLdouble *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glProgramUniformMatrix3dv(program, location, count, transpose, value);
+}
+
+static void APIENTRY trace_glProgramUniformMatrix4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    trace_command(TRACE_glProgramUniformMatrix4dv);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_uint(transpose);
+    trace_write_array(value, (size_t)((count)*16), sizeof(GLdouble));
+    trace_real.glProgramUniformMatrix4dv(program, location, count, transpose, value);
+}
+
+static void trace_replay_glProgramUniformMatrix4dv(struct trace_reader *reader) {
+    if (!__glProgramUniformMatrix4dv) {
+        trace_missing(reader, TRACE_glProgramUniformMatrix4dv);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLboolean transpose = (GLboolean)trace_read_uint(reader);
+    const GLdouble *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glProgramUniformMatrix4dv(program, location, count, transpose, value);
+}
+
+static void APIENTRY trace_glProgramUniformMatrix2x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    trace_command(TRACE_glProgramUniformMatrix2x3fv);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_uint(transpose);
+    trace_write_array(value, (size_t)((count)*6), sizeof(GLfloat));
+    trace_real.glProgramUniformMatrix2x3fv(program, location, count, transpose, value);
+}
+
+static void trace_replay_glProgramUniformMatrix2x3fv(struct trace_reader *reader) {
+    if (!__glProgramUniformMatrix2x3fv) {
+        trace_missing(reader, TRACE_glProgramUniformMatrix2x3fv);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLboolean transpose = (GLboolean)trace_read_uint(reader);
+    const GLfloat *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glProgramUniformMatrix2x3fv(program, location, count, transpose, value);
+}
+
+static void APIENTRY trace_glProgramUniformMatrix3x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    trace_command(TRACE_glProgramUniformMatrix3x2fv);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_uint(transpose);
+    trace_write_array(value, (size_t)((count)*6), sizeof(GLfloat));
+    trace_real.glProgramUniformMatrix3x2fv(program, location, count, transpose, value);
+}
+
+static void trace_replay_glProgramUniformMatrix3x2fv(struct trace_reader *reader) {
+    if (!__glProgramUniformMatrix3x2fv) {
+        trace_missing(reader, TRACE_glProgramUniformMatrix3x2fv);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLboolean transpose = (GLboolean)trace_read_uint(reader);
+    const GLfloat *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glProgramUniformMatrix3x2fv(program, location, count, transpose, value);
+}
+
+static void APIENTRY trace_glProgramUniformMatrix2x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    trace_command(TRACE_glProgramUniformMatrix2x4fv);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_uint(transpose);
+    trace_write_array(value, (size_t)((count)*8), sizeof(GLfloat));
+    trace_real.glProgramUniformMatrix2x4fv(program, location, count, transpose, value);
+}
+
+static void trace_replay_glProgramUniformMatrix2x4fv(struct trace_reader *reader) {
+    if (!__glProgramUniformMatrix2x4fv) {
+        trace_missing(reader, TRACE_glProgramUniformMatrix2x4fv);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLboolean transpose = (GLboolean)trace_read_uint(reader);
+    const GLfloat *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glProgramUniformMatrix2x4fv(program, location, count, transpose, value);
+}
+
+static void APIENTRY trace_glProgramUniformMatrix4x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    trace_command(TRACE_glProgramUniformMatrix4x2fv);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_uint(transpose);
+    trace_write_array(value, (size_t)((count)*8), sizeof(GLfloat));
+    trace_real.glProgramUniformMatrix4x2fv(program, location, count, transpose, value);
+}
+
+static void trace_replay_glProgramUniformMatrix4x2fv(struct trace_reader *reader) {
+    if (!__glProgramUniformMatrix4x2fv) {
+        trace_missing(reader, TRACE_glProgramUniformMatrix4x2fv);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLboolean transpose = (GLboolean)trace_read_uint(reader);
+    const GLfloat *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glProgramUniformMatrix4x2fv(program, location, count, transpose, value);
+}
+
+static void APIENTRY trace_glProgramUniformMatrix3x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    trace_command(TRACE_glProgramUniformMatrix3x4fv);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_uint(transpose);
+    trace_write_array(value, (size_t)((count)*12), sizeof(GLfloat));
+    trace_real.glProgramUniformMatrix3x4fv(program, location, count, transpose, value);
+}
+
+static void trace_replay_glProgramUniformMatrix3x4fv(struct trace_reader *reader) {
+    if (!__glProgramUniformMatrix3x4fv) {
+        trace_missing(reader, TRACE_glProgramUniformMatrix3x4fv);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLboolean transpose = (GLboolean)trace_read_uint(reader);
+    const GLfloat *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glProgramUniformMatrix3x4fv(program, location, count, transpose, value);
+}
+
+static void APIENTRY trace_glProgramUniformMatrix4x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    trace_command(TRACE_glProgramUniformMatrix4x3fv);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_uint(transpose);
+    trace_write_array(value, (size_t)((count)*12), sizeof(GLfloat));
+    trace_real.glProgramUniformMatrix4x3fv(program, location, count, transpose, value);
+}
+
+static void trace_replay_glProgramUniformMatrix4x3fv(struct trace_reader *reader) {
+    if (!__glProgramUniformMatrix4x3fv) {
+        trace_missing(reader, TRACE_glProgramUniformMatrix4x3fv);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLboolean transpose = (GLboolean)trace_read_uint(reader);
+    const GLfloat *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glProgramUniformMatrix4x3fv(program, location, count, transpose, value);
+}
+
+static void APIENTRY trace_glProgramUniformMatrix2x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    trace_command(TRACE_glProgramUniformMatrix2x3dv);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_uint(transpose);
+    trace_write_array(value, (size_t)((count)*6), sizeof(GLdouble));
+    trace_real.glProgramUniformMatrix2x3dv(program, location, count, transpose, value);
+}
+
+static void trace_replay_glProgramUniformMatrix2x3dv(struct trace_reader *reader) {
+    if (!__glProgramUniformMatrix2x3dv) {
+        trace_missing(reader, TRACE_glProgramUniformMatrix2x3dv);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLboolean transpose = (GLboolean)trace_read_uint(reader);
+    const GLdouble *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glProgramUniformMatrix2x3dv(program, location, count, transpose, value);
+}
+
+static void APIENTRY trace_glProgramUniformMatrix3x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    trace_command(TRACE_glProgramUniformMatrix3x2dv);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_uint(transpose);
+    trace_write_array(value, (size_t)((count)*6), sizeof(GLdouble));
+    trace_real.glProgramUniformMatrix3x2dv(program, location, count, transpose, value);
+}
+
+static void trace_replay_glProgramUniformMatrix3x2dv(struct trace_reader *reader) {
+    if (!__glProgramUniformMatrix3x2dv) {
+        trace_missing(reader, TRACE_glProgramUniformMatrix3x2dv);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLboolean transpose = (GLboolean)trace_read_uint(reader);
+    const GLdouble *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glProgramUniformMatrix3x2dv(program, location, count, transpose, value);
+}
+
+static void APIENTRY trace_glProgramUniformMatrix2x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    trace_command(TRACE_glProgramUniformMatrix2x4dv);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_uint(transpose);
+    trace_write_array(value, (size_t)((count)*8), sizeof(GLdouble));
+    trace_real.glProgramUniformMatrix2x4dv(program, location, count, transpose, value);
+}
+
+static void trace_replay_glProgramUniformMatrix2x4dv(struct trace_reader *reader) {
+    if (!__glProgramUniformMatrix2x4dv) {
+        trace_missing(reader, TRACE_glProgramUniformMatrix2x4dv);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLboolean transpose = (GLboolean)trace_read_uint(reader);
+    const GLdouble *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glProgramUniformMatrix2x4dv(program, location, count, transpose, value);
+}
+
+static void APIENTRY trace_glProgramUniformMatrix4x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    trace_command(TRACE_glProgramUniformMatrix4x2dv);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_uint(transpose);
+    trace_write_array(value, (size_t)((count)*8), sizeof(GLdouble));
+    trace_real.glProgramUniformMatrix4x2dv(program, location, count, transpose, value);
+}
+
+static void trace_replay_glProgramUniformMatrix4x2dv(struct trace_reader *reader) {
+    if (!__glProgramUniformMatrix4x2dv) {
+        trace_missing(reader, TRACE_glProgramUniformMatrix4x2dv);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLboolean transpose = (GLboolean)trace_read_uint(reader);
+    const GLdouble *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glProgramUniformMatrix4x2dv(program, location, count, transpose, value);
+}
+
+static void APIENTRY trace_glProgramUniformMatrix3x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    trace_command(TRACE_glProgramUniformMatrix3x4dv);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_uint(transpose);
+    trace_write_array(value, (size_t)((count)*12), sizeof(GLdouble));
+    trace_real.glProgramUniformMatrix3x4dv(program, location, count, transpose, value);
+}
+
+static void trace_replay_glProgramUniformMatrix3x4dv(struct trace_reader *reader) {
+    if (!__glProgramUniformMatrix3x4dv) {
+        trace_missing(reader, TRACE_glProgramUniformMatrix3x4dv);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLboolean transpose = (GLboolean)trace_read_uint(reader);
+    const GLdouble *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glProgramUniformMatrix3x4dv(program, location, count, transpose, value);
+}
+
+static void APIENTRY trace_glProgramUniformMatrix4x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    trace_command(TRACE_glProgramUniformMatrix4x3dv);
+    trace_write_uint(program);
+    trace_write_int(location);
+    trace_write_int(count);
+    trace_write_uint(transpose);
+    trace_write_array(value, (size_t)((count)*12), sizeof(GLdouble));
+    trace_real.glProgramUniformMatrix4x3dv(program, location, count, transpose, value);
+}
+
+static void trace_replay_glProgramUniformMatrix4x3dv(struct trace_reader *reader) {
+    if (!__glProgramUniformMatrix4x3dv) {
+        trace_missing(reader, TRACE_glProgramUniformMatrix4x3dv);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLint location = trace_location(reader, program, (GLint)trace_read_int(reader));
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLboolean transpose = (GLboolean)trace_read_uint(reader);
+    const GLdouble *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glProgramUniformMatrix4x3dv(program, location, count, transpose, value);
+}
+
+static void APIENTRY trace_glValidateProgramPipeline(GLuint pipeline) {
+    trace_command(TRACE_glValidateProgramPipeline);
+    trace_write_uint(pipeline);
+    trace_real.glValidateProgramPipeline(pipeline);
+}
+
+static void trace_replay_glValidateProgramPipeline(struct trace_reader *reader) {
+    if (!__glValidateProgramPipeline) {
+        trace_missing(reader, TRACE_glValidateProgramPipeline);
+        return;
+    }
+    GLuint pipeline = trace_name(reader, TRACE_NAME_PROGRAM_PIPELINE, (GLuint)trace_read_uint(reader));
+    if (reader->error)
+        return;
+    __glValidateProgramPipeline(pipeline);
+}
+
+static void APIENTRY trace_glVertexAttribL1d(GLuint index, GLdouble x) {
+    trace_command(TRACE_glVertexAttribL1d);
+    trace_write_uint(index);
+    trace_write_double(x);
+    trace_real.glVertexAttribL1d(index, x);
+}
+
+static void trace_replay_glVertexAttribL1d(struct trace_reader *reader) {
+    if (!__glVertexAttribL1d) {
+        trace_missing(reader, TRACE_glVertexAttribL1d);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLdouble x = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribL1d(index, x);
+}
+
+static void APIENTRY trace_glVertexAttribL2d(GLuint index, GLdouble x, GLdouble y) {
+    trace_command(TRACE_glVertexAttribL2d);
+    trace_write_uint(index);
+    trace_write_double(x);
+    trace_write_double(y);
+    trace_real.glVertexAttribL2d(index, x, y);
+}
+
+static void trace_replay_glVertexAttribL2d(struct trace_reader *reader) {
+    if (!__glVertexAttribL2d) {
+        trace_missing(reader, TRACE_glVertexAttribL2d);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLdouble x = trace_read_double(reader);
+    GLdouble y = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribL2d(index, x, y);
+}
+
+static void APIENTRY trace_glVertexAttribL3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+    trace_command(TRACE_glVertexAttribL3d);
+    trace_write_uint(index);
+    trace_write_double(x);
+    trace_write_double(y);
+    trace_write_double(z);
+    trace_real.glVertexAttribL3d(index, x, y, z);
+}
+
+static void trace_replay_glVertexAttribL3d(struct trace_reader *reader) {
+    if (!__glVertexAttribL3d) {
+        trace_missing(reader, TRACE_glVertexAttribL3d);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLdouble x = trace_read_double(reader);
+    GLdouble y = trace_read_double(reader);
+    GLdouble z = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribL3d(index, x, y, z);
+}
+
+static void APIENTRY trace_glVertexAttribL4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    trace_command(TRACE_glVertexAttribL4d);
+    trace_write_uint(index);
+    trace_write_double(x);
+    trace_write_double(y);
+    trace_write_double(z);
+    trace_write_double(w);
+    trace_real.glVertexAttribL4d(index, x, y, z, w);
+}
+
+static void trace_replay_glVertexAttribL4d(struct trace_reader *reader) {
+    if (!__glVertexAttribL4d) {
+        trace_missing(reader, TRACE_glVertexAttribL4d);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLdouble x = trace_read_double(reader);
+    GLdouble y = trace_read_double(reader);
+    GLdouble z = trace_read_double(reader);
+    GLdouble w = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribL4d(index, x, y, z, w);
+}
+
+static void APIENTRY trace_glVertexAttribL1dv(GLuint index, const GLdouble *v) {
+    trace_command(TRACE_glVertexAttribL1dv);
+    trace_write_uint(index);
+    trace_write_array(v, (size_t)(1), sizeof(GLdouble));
+    trace_real.glVertexAttribL1dv(index, v);
+}
+
+static void trace_replay_glVertexAttribL1dv(struct trace_reader *reader) {
+    if (!__glVertexAttribL1dv) {
+        trace_missing(reader, TRACE_glVertexAttribL1dv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLdouble *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribL1dv(index, v);
+}
+
+static void APIENTRY trace_glVertexAttribL2dv(GLuint index, const GLdouble *v) {
+    trace_command(TRACE_glVertexAttribL2dv);
+    trace_write_uint(index);
+    trace_write_array(v, (size_t)(2), sizeof(GLdouble));
+    trace_real.glVertexAttribL2dv(index, v);
+}
+
+static void trace_replay_glVertexAttribL2dv(struct trace_reader *reader) {
+    if (!__glVertexAttribL2dv) {
+        trace_missing(reader, TRACE_glVertexAttribL2dv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLdouble *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribL2dv(index, v);
+}
+
+static void APIENTRY trace_glVertexAttribL3dv(GLuint index, const GLdouble *v) {
+    trace_command(TRACE_glVertexAttribL3dv);
+    trace_write_uint(index);
+    trace_write_array(v, (size_t)(3), sizeof(GLdouble));
+    trace_real.glVertexAttribL3dv(index, v);
+}
+
+static void trace_replay_glVertexAttribL3dv(struct trace_reader *reader) {
+    if (!__glVertexAttribL3dv) {
+        trace_missing(reader, TRACE_glVertexAttribL3dv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLdouble *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribL3dv(index, v);
+}
+
+static void APIENTRY trace_glVertexAttribL4dv(GLuint index, const GLdouble *v) {
+    trace_command(TRACE_glVertexAttribL4dv);
+    trace_write_uint(index);
+    trace_write_array(v, (size_t)(4), sizeof(GLdouble));
+    trace_real.glVertexAttribL4dv(index, v);
+}
+
+static void trace_replay_glVertexAttribL4dv(struct trace_reader *reader) {
+    if (!__glVertexAttribL4dv) {
+        trace_missing(reader, TRACE_glVertexAttribL4dv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLdouble *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribL4dv(index, v);
+}
+
+static void APIENTRY trace_glVertexAttribLPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+    trace_command(TRACE_glVertexAttribLPointer);
+    trace_write_uint(index);
+    trace_write_int(size);
+    trace_write_uint(type);
+    trace_write_int(stride);
+    trace_write_offset(pointer);
+    trace_real.glVertexAttribLPointer(index, size, type, stride, pointer);
+}
+
+static void trace_replay_glVertexAttribLPointer(struct trace_reader *reader) {
+    if (!__glVertexAttribLPointer) {
+        trace_missing(reader, TRACE_glVertexAttribLPointer);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLint size = (GLint)trace_read_int(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLsizei stride = (GLsizei)trace_read_int(reader);
+    const void *pointer = trace_read_offset(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribLPointer(index, size, type, stride, pointer);
+}
+
+static void APIENTRY trace_glViewportArrayv(GLuint first, GLsizei count, const GLfloat *v) {
+    trace_command(TRACE_glViewportArrayv);
+    trace_write_uint(first);
+    trace_write_int(count);
+    trace_write_array(v, (size_t)((count)*4), sizeof(GLfloat));
+    trace_real.glViewportArrayv(first, count, v);
+}
+
+static void trace_replay_glViewportArrayv(struct trace_reader *reader) {
+    if (!__glViewportArrayv) {
+        trace_missing(reader, TRACE_glViewportArrayv);
+        return;
+    }
+    GLuint first = (GLuint)trace_read_uint(reader);
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLfloat *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glViewportArrayv(first, count, v);
+}
+
+static void APIENTRY trace_glViewportIndexedf(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h) {
+    trace_command(TRACE_glViewportIndexedf);
+    trace_write_uint(index);
+    trace_write_float(x);
+    trace_write_float(y);
+    trace_write_float(w);
+    trace_write_float(h);
+    trace_real.glViewportIndexedf(index, x, y, w, h);
+}
+
+static void trace_replay_glViewportIndexedf(struct trace_reader *reader) {
+    if (!__glViewportIndexedf) {
+        trace_missing(reader, TRACE_glViewportIndexedf);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLfloat x = trace_read_float(reader);
+    GLfloat y = trace_read_float(reader);
+    GLfloat w = trace_read_float(reader);
+    GLfloat h = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glViewportIndexedf(index, x, y, w, h);
+}
+
+static void APIENTRY trace_glViewportIndexedfv(GLuint index, const GLfloat *v) {
+    trace_command(TRACE_glViewportIndexedfv);
+    trace_write_uint(index);
+    trace_write_array(v, (size_t)(4), sizeof(GLfloat));
+    trace_real.glViewportIndexedfv(index, v);
+}
+
+static void trace_replay_glViewportIndexedfv(struct trace_reader *reader) {
+    if (!__glViewportIndexedfv) {
+        trace_missing(reader, TRACE_glViewportIndexedfv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLfloat *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glViewportIndexedfv(index, v);
+}
+
+static void APIENTRY trace_glScissorArrayv(GLuint first, GLsizei count, const GLint *v) {
+    trace_command(TRACE_glScissorArrayv);
+    trace_write_uint(first);
+    trace_write_int(count);
+    trace_write_array(v, (size_t)((count)*4), sizeof(GLint));
+    trace_real.glScissorArrayv(first, count, v);
+}
+
+static void trace_replay_glScissorArrayv(struct trace_reader *reader) {
+    if (!__glScissorArrayv) {
+        trace_missing(reader, TRACE_glScissorArrayv);
+        return;
+    }
+    GLuint first = (GLuint)trace_read_uint(reader);
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLint *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glScissorArrayv(first, count, v);
+}
+
+static void APIENTRY trace_glScissorIndexed(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height) {
+    trace_command(TRACE_glScissorIndexed);
+    trace_write_uint(index);
+    trace_write_int(left);
+    trace_write_int(bottom);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_real.glScissorIndexed(index, left, bottom, width, height);
+}
+
+static void trace_replay_glScissorIndexed(struct trace_reader *reader) {
+    if (!__glScissorIndexed) {
+        trace_missing(reader, TRACE_glScissorIndexed);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLint left = (GLint)trace_read_int(reader);
+    GLint bottom = (GLint)trace_read_int(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glScissorIndexed(index, left, bottom, width, height);
+}
+
+static void APIENTRY trace_glScissorIndexedv(GLuint index, const GLint *v) {
+    trace_command(TRACE_glScissorIndexedv);
+    trace_write_uint(index);
+    trace_write_array(v, (size_t)(4), sizeof(GLint));
+    trace_real.glScissorIndexedv(index, v);
+}
+
+static void trace_replay_glScissorIndexedv(struct trace_reader *reader) {
+    if (!__glScissorIndexedv) {
+        trace_missing(reader, TRACE_glScissorIndexedv);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    const GLint *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glScissorIndexedv(index, v);
+}
+
+static void APIENTRY trace_glDepthRangeArrayv(GLuint first, GLsizei count, const GLdouble *v) {
+    trace_command(TRACE_glDepthRangeArrayv);
+    trace_write_uint(first);
+    trace_write_int(count);
+    trace_write_array(v, (size_t)((count)*2), sizeof(GLdouble));
+    trace_real.glDepthRangeArrayv(first, count, v);
+}
+
+static void trace_replay_glDepthRangeArrayv(struct trace_reader *reader) {
+    if (!__glDepthRangeArrayv) {
+        trace_missing(reader, TRACE_glDepthRangeArrayv);
+        return;
+    }
+    GLuint first = (GLuint)trace_read_uint(reader);
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLdouble *v = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glDepthRangeArrayv(first, count, v);
+}
+
+static void APIENTRY trace_glDepthRangeIndexed(GLuint index, GLdouble n, GLdouble f) {
+    trace_command(TRACE_glDepthRangeIndexed);
+    trace_write_uint(index);
+    trace_write_double(n);
+    trace_write_double(f);
+    trace_real.glDepthRangeIndexed(index, n, f);
+}
+
+static void trace_replay_glDepthRangeIndexed(struct trace_reader *reader) {
+    if (!__glDepthRangeIndexed) {
+        trace_missing(reader, TRACE_glDepthRangeIndexed);
+        return;
+    }
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLdouble n = trace_read_double(reader);
+    GLdouble f = trace_read_double(reader);
+    if (reader->error)
+        return;
+    __glDepthRangeIndexed(index, n, f);
+}
+
+#endif
+
+#if FUNGL_VERSION >= GL_VERSION_4_2
+static void APIENTRY trace_glDrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance) {
+    trace_command(TRACE_glDrawArraysInstancedBaseInstance);
+    trace_write_uint(mode);
+    trace_write_int(first);
+    trace_write_int(count);
+    trace_write_int(instancecount);
+    trace_write_uint(baseinstance);
+    trace_real.glDrawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
+}
+
+static void trace_replay_glDrawArraysInstancedBaseInstance(struct trace_reader *reader) {
+    if (!__glDrawArraysInstancedBaseInstance) {
+        trace_missing(reader, TRACE_glDrawArraysInstancedBaseInstance);
+        return;
+    }
+    GLenum mode = (GLenum)trace_read_uint(reader);
+    GLint first = (GLint)trace_read_int(reader);
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLsizei instancecount = (GLsizei)trace_read_int(reader);
+    GLuint baseinstance = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glDrawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
+}
+
+static void APIENTRY trace_glDrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance) {
+    trace_command(TRACE_glDrawElementsInstancedBaseInstance);
+    trace_write_uint(mode);
+    trace_write_int(count);
+    trace_write_uint(type);
+    trace_write_array(indices, (size_t)(count), 1);
+    trace_write_int(instancecount);
+    trace_write_uint(baseinstance);
+    trace_real.glDrawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance);
+}
+
+static void trace_replay_glDrawElementsInstancedBaseInstance(struct trace_reader *reader) {
+    if (!__glDrawElementsInstancedBaseInstance) {
+        trace_missing(reader, TRACE_glDrawElementsInstancedBaseInstance);
+        return;
+    }
+    GLenum mode = (GLenum)trace_read_uint(reader);
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const void *indices = trace_read_array(reader);
+    GLsizei instancecount = (GLsizei)trace_read_int(reader);
+    GLuint baseinstance = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glDrawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance);
+}
+
+static void APIENTRY trace_glDrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance) {
+    trace_command(TRACE_glDrawElementsInstancedBaseVertexBaseInstance);
+    trace_write_uint(mode);
+    trace_write_int(count);
+    trace_write_uint(type);
+    trace_write_array(indices, (size_t)(count), 1);
+    trace_write_int(instancecount);
+    trace_write_int(basevertex);
+    trace_write_uint(baseinstance);
+    trace_real.glDrawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance);
+}
+
+static void trace_replay_glDrawElementsInstancedBaseVertexBaseInstance(struct trace_reader *reader) {
+    if (!__glDrawElementsInstancedBaseVertexBaseInstance) {
+        trace_missing(reader, TRACE_glDrawElementsInstancedBaseVertexBaseInstance);
+        return;
+    }
+    GLenum mode = (GLenum)trace_read_uint(reader);
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const void *indices = trace_read_array(reader);
+    GLsizei instancecount = (GLsizei)trace_read_int(reader);
+    GLint basevertex = (GLint)trace_read_int(reader);
+    GLuint baseinstance = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glDrawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance);
+}
+
+static void APIENTRY trace_glBindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format) {
+    trace_command(TRACE_glBindImageTexture);
+    trace_write_uint(unit);
+    trace_write_uint(texture);
+    trace_write_int(level);
+    trace_write_uint(layered);
+    trace_write_int(layer);
+    trace_write_uint(access);
+    trace_write_uint(format);
+    trace_real.glBindImageTexture(unit, texture, level, layered, layer, access, format);
+}
+
+static void trace_replay_glBindImageTexture(struct trace_reader *reader) {
+    if (!__glBindImageTexture) {
+        trace_missing(reader, TRACE_glBindImageTexture);
+        return;
+    }
+    GLuint unit = (GLuint)trace_read_uint(reader);
+    GLuint texture = trace_name(reader, TRACE_NAME_TEXTURE, (GLuint)trace_read_uint(reader));
+    GLint level = (GLint)trace_read_int(reader);
+    GLboolean layered = (GLboolean)trace_read_uint(reader);
+    GLint layer = (GLint)trace_read_int(reader);
+    GLenum access = (GLenum)trace_read_uint(reader);
+    GLenum format = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glBindImageTexture(unit, texture, level, layered, layer, access, format);
+}
+
+static void APIENTRY trace_glMemoryBarrier(GLbitfield barriers) {
+    trace_command(TRACE_glMemoryBarrier);
+    trace_write_uint(barriers);
+    trace_real.glMemoryBarrier(barriers);
+}
+
+static void trace_replay_glMemoryBarrier(struct trace_reader *reader) {
+    if (!__glMemoryBarrier) {
+        trace_missing(reader, TRACE_glMemoryBarrier);
+        return;
+    }
+    GLbitfield barriers = (GLbitfield)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glMemoryBarrier(barriers);
+}
+
+static void APIENTRY trace_glTexStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width) {
+    trace_command(TRACE_glTexStorage1D);
+    trace_write_uint(target);
+    trace_write_int(levels);
+    trace_write_uint(internalformat);
+    trace_write_int(width);
+    trace_real.glTexStorage1D(target, levels, internalformat, width);
+}
+
+static void trace_replay_glTexStorage1D(struct trace_reader *reader) {
+    if (!__glTexStorage1D) {
+        trace_missing(reader, TRACE_glTexStorage1D);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLsizei levels = (GLsizei)trace_read_int(reader);
+    GLenum internalformat = (GLenum)trace_read_uint(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glTexStorage1D(target, levels, internalformat, width);
+}
+
+static void APIENTRY trace_glTexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+    trace_command(TRACE_glTexStorage2D);
+    trace_write_uint(target);
+    trace_write_int(levels);
+    trace_write_uint(internalformat);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_real.glTexStorage2D(target, levels, internalformat, width, height);
+}
+
+static void trace_replay_glTexStorage2D(struct trace_reader *reader) {
+    if (!__glTexStorage2D) {
+        trace_missing(reader, TRACE_glTexStorage2D);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLsizei levels = (GLsizei)trace_read_int(reader);
+    GLenum internalformat = (GLenum)trace_read_uint(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glTexStorage2D(target, levels, internalformat, width, height);
+}
+
+static void APIENTRY trace_glTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+    trace_command(TRACE_glTexStorage3D);
+    trace_write_uint(target);
+    trace_write_int(levels);
+    trace_write_uint(internalformat);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_write_int(depth);
+    trace_real.glTexStorage3D(target, levels, internalformat, width, height, depth);
+}
+
+static void trace_replay_glTexStorage3D(struct trace_reader *reader) {
+    if (!__glTexStorage3D) {
+        trace_missing(reader, TRACE_glTexStorage3D);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLsizei levels = (GLsizei)trace_read_int(reader);
+    GLenum internalformat = (GLenum)trace_read_uint(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    GLsizei depth = (GLsizei)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glTexStorage3D(target, levels, internalformat, width, height, depth);
+}
+
+static void APIENTRY trace_glDrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsizei instancecount) {
+    trace_command(TRACE_glDrawTransformFeedbackInstanced);
+    trace_write_uint(mode);
+    trace_write_uint(id);
+    trace_write_int(instancecount);
+    trace_real.glDrawTransformFeedbackInstanced(mode, id, instancecount);
+}
+
+static void trace_replay_glDrawTransformFeedbackInstanced(struct trace_reader *reader) {
+    if (!__glDrawTransformFeedbackInstanced) {
+        trace_missing(reader, TRACE_glDrawTransformFeedbackInstanced);
+        return;
+    }
+    GLenum mode = (GLenum)trace_read_uint(reader);
+    GLuint id = trace_name(reader, TRACE_NAME_TRANSFORM_FEEDBACK, (GLuint)trace_read_uint(reader));
+    GLsizei instancecount = (GLsizei)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glDrawTransformFeedbackInstanced(mode, id, instancecount);
+}
+
+static void APIENTRY trace_glDrawTransformFeedbackStreamInstanced(GLenum mode, GLuint id, GLuint stream, GLsizei instancecount) {
+    trace_command(TRACE_glDrawTransformFeedbackStreamInstanced);
+    trace_write_uint(mode);
+    trace_write_uint(id);
+    trace_write_uint(stream);
+    trace_write_int(instancecount);
+    trace_real.glDrawTransformFeedbackStreamInstanced(mode, id, stream, instancecount);
+}
+
+static void trace_replay_glDrawTransformFeedbackStreamInstanced(struct trace_reader *reader) {
+    if (!__glDrawTransformFeedbackStreamInstanced) {
+        trace_missing(reader, TRACE_glDrawTransformFeedbackStreamInstanced);
+        return;
+    }
+    GLenum mode = (GLenum)trace_read_uint(reader);
+    GLuint id = trace_name(reader, TRACE_NAME_TRANSFORM_FEEDBACK, (GLuint)trace_read_uint(reader));
+    GLuint stream = (GLuint)trace_read_uint(reader);
+    GLsizei instancecount = (GLsizei)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glDrawTransformFeedbackStreamInstanced(mode, id, stream, instancecount);
+}
+
+#endif
+
+#if FUNGL_VERSION >= GL_VERSION_4_3
+static void APIENTRY trace_glClearBufferData(GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data) {
+    trace_command(TRACE_glClearBufferData);
+    trace_write_uint(target);
+    trace_write_uint(internalformat);
+    trace_write_uint(format);
+    trace_write_uint(type);
+    trace_write_array(data, (size_t)(trace_pixel_size(format, type)), 1);
+    trace_real.glClearBufferData(target, internalformat, format, type, data);
+}
+
+static void trace_replay_glClearBufferData(struct trace_reader *reader) {
+    if (!__glClearBufferData) {
+        trace_missing(reader, TRACE_glClearBufferData);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLenum internalformat = (GLenum)trace_read_uint(reader);
+    GLenum format = (GLenum)trace_read_uint(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const void *data = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glClearBufferData(target, internalformat, format, type, data);
+}
+
+static void APIENTRY trace_glClearBufferSubData(GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data) {
+    trace_command(TRACE_glClearBufferSubData);
+    trace_write_uint(target);
+    trace_write_uint(internalformat);
+    trace_write_int(offset);
+    trace_write_int(size);
+    trace_write_uint(format);
+    trace_write_uint(type);
+    trace_write_array(data, (size_t)(trace_pixel_size(format, type)), 1);
+    trace_real.glClearBufferSubData(target, internalformat, offset, size, format, type, data);
+}
+
+static void trace_replay_glClearBufferSubData(struct trace_reader *reader) {
+    if (!__glClearBufferSubData) {
+        trace_missing(reader, TRACE_glClearBufferSubData);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLenum internalformat = (GLenum)trace_read_uint(reader);
+    GLintptr offset = (GLintptr)trace_read_int(reader);
+    GLsizeiptr size = (GLsizeiptr)trace_read_int(reader);
+    GLenum format = (GLenum)trace_read_uint(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const void *data = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glClearBufferSubData(target, internalformat, offset, size, format, type, data);
+}
+
+static void APIENTRY trace_glDispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z) {
+    trace_command(TRACE_glDispatchCompute);
+    trace_write_uint(num_groups_x);
+    trace_write_uint(num_groups_y);
+    trace_write_uint(num_groups_z);
+    trace_real.glDispatchCompute(num_groups_x, num_groups_y, num_groups_z);
+}
+
+static void trace_replay_glDispatchCompute(struct trace_reader *reader) {
+    if (!__glDispatchCompute) {
+        trace_missing(reader, TRACE_glDispatchCompute);
+        return;
+    }
+    GLuint num_groups_x = (GLuint)trace_read_uint(reader);
+    GLuint num_groups_y = (GLuint)trace_read_uint(reader);
+    GLuint num_groups_z = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glDispatchCompute(num_groups_x, num_groups_y, num_groups_z);
+}
+
+static void APIENTRY trace_glDispatchComputeIndirect(GLintptr indirect) {
+    trace_command(TRACE_glDispatchComputeIndirect);
+    trace_write_int(indirect);
+    trace_real.glDispatchComputeIndirect(indirect);
+}
+
+static void trace_replay_glDispatchComputeIndirect(struct trace_reader *reader) {
+    if (!__glDispatchComputeIndirect) {
+        trace_missing(reader, TRACE_glDispatchComputeIndirect);
+        return;
+    }
+    GLintptr indirect = (GLintptr)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glDispatchComputeIndirect(indirect);
+}
+
+static void APIENTRY trace_glCopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth) {
+    trace_command(TRACE_glCopyImageSubData);
+    trace_write_uint(srcName);
+    trace_write_uint(srcTarget);
+    trace_write_int(srcLevel);
+    trace_write_int(srcX);
+    trace_write_int(srcY);
+    trace_write_int(srcZ);
+    trace_write_uint(dstName);
+    trace_write_uint(dstTarget);
+    trace_write_int(dstLevel);
+    trace_write_int(dstX);
+    trace_write_int(dstY);
+    trace_write_int(dstZ);
+    trace_write_int(srcWidth);
+    trace_write_int(srcHeight);
+    trace_write_int(srcDepth);
+    trace_real.glCopyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+}
+
+static void trace_replay_glCopyImageSubData(struct trace_reader *reader) {
+    if (!__glCopyImageSubData) {
+        trace_missing(reader, TRACE_glCopyImageSubData);
+        return;
+    }
+    GLuint srcName = (GLuint)trace_read_uint(reader);
+    GLenum srcTarget = (GLenum)trace_read_uint(reader);
+    GLint srcLevel = (GLint)trace_read_int(reader);
+    GLint srcX = (GLint)trace_read_int(reader);
+    GLint srcY = (GLint)trace_read_int(reader);
+    GLint srcZ = (GLint)trace_read_int(reader);
+    GLuint dstName = (GLuint)trace_read_uint(reader);
+    GLenum dstTarget = (GLenum)trace_read_uint(reader);
+    GLint dstLevel = (GLint)trace_read_int(reader);
+    GLint dstX = (GLint)trace_read_int(reader);
+    GLint dstY = (GLint)trace_read_int(reader);
+    GLint dstZ = (GLint)trace_read_int(reader);
+    GLsizei srcWidth = (GLsizei)trace_read_int(reader);
+    GLsizei srcHeight = (GLsizei)trace_read_int(reader);
+    GLsizei srcDepth = (GLsizei)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glCopyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+}
+
+static void APIENTRY trace_glFramebufferParameteri(GLenum target, GLenum pname, GLint param) {
+    trace_command(TRACE_glFramebufferParameteri);
+    trace_write_uint(target);
+    trace_write_uint(pname);
+    trace_write_int(param);
+    trace_real.glFramebufferParameteri(target, pname, param);
+}
+
+static void trace_replay_glFramebufferParameteri(struct trace_reader *reader) {
+    if (!__glFramebufferParameteri) {
+        trace_missing(reader, TRACE_glFramebufferParameteri);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    GLint param = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glFramebufferParameteri(target, pname, param);
+}
+
+static void APIENTRY trace_glInvalidateTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth) {
+    trace_command(TRACE_glInvalidateTexSubImage);
+    trace_write_uint(texture);
+    trace_write_int(level);
+    trace_write_int(xoffset);
+    trace_write_int(yoffset);
+    trace_write_int(zoffset);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_write_int(depth);
+    trace_real.glInvalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth);
+}
+
+static void trace_replay_glInvalidateTexSubImage(struct trace_reader *reader) {
+    if (!__glInvalidateTexSubImage) {
+        trace_missing(reader, TRACE_glInvalidateTexSubImage);
+        return;
+    }
+    GLuint texture = trace_name(reader, TRACE_NAME_TEXTURE, (GLuint)trace_read_uint(reader));
+    GLint level = (GLint)trace_read_int(reader);
+    GLint xoffset = (GLint)trace_read_int(reader);
+    GLint yoffset = (GLint)trace_read_int(reader);
+    GLint zoffset = (GLint)trace_read_int(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    GLsizei depth = (GLsizei)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glInvalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth);
+}
+
+static void APIENTRY trace_glInvalidateTexImage(GLuint texture, GLint level) {
+    trace_command(TRACE_glInvalidateTexImage);
+    trace_write_uint(texture);
+    trace_write_int(level);
+    trace_real.glInvalidateTexImage(texture, level);
+}
+
+static void trace_replay_glInvalidateTexImage(struct trace_reader *reader) {
+    if (!__glInvalidateTexImage) {
+        trace_missing(reader, TRACE_glInvalidateTexImage);
+        return;
+    }
+    GLuint texture = trace_name(reader, TRACE_NAME_TEXTURE, (GLuint)trace_read_uint(reader));
+    GLint level = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glInvalidateTexImage(texture, level);
+}
+
+static void APIENTRY trace_glInvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+    trace_command(TRACE_glInvalidateBufferSubData);
+    trace_write_uint(buffer);
+    trace_write_int(offset);
+    trace_write_int(length);
+    trace_real.glInvalidateBufferSubData(buffer, offset, length);
+}
+
+static void trace_replay_glInvalidateBufferSubData(struct trace_reader *reader) {
+    if (!__glInvalidateBufferSubData) {
+        trace_missing(reader, TRACE_glInvalidateBufferSubData);
+        return;
+    }
+    GLuint buffer = trace_name(reader, TRACE_NAME_BUFFER, (GLuint)trace_read_uint(reader));
+    GLintptr offset = (GLintptr)trace_read_int(reader);
+    GLsizeiptr length = (GLsizeiptr)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glInvalidateBufferSubData(buffer, offset, length);
+}
+
+static void APIENTRY trace_glInvalidateBufferData(GLuint buffer) {
+    trace_command(TRACE_glInvalidateBufferData);
+    trace_write_uint(buffer);
+    trace_real.glInvalidateBufferData(buffer);
+}
+
+static void trace_replay_glInvalidateBufferData(struct trace_reader *reader) {
+    if (!__glInvalidateBufferData) {
+        trace_missing(reader, TRACE_glInvalidateBufferData);
+        return;
+    }
+    GLuint buffer = trace_name(reader, TRACE_NAME_BUFFER, (GLuint)trace_read_uint(reader));
+    if (reader->error)
+        return;
+    __glInvalidateBufferData(buffer);
+}
+
+static void APIENTRY trace_glInvalidateFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments) {
+    trace_command(TRACE_glInvalidateFramebuffer);
+    trace_write_uint(target);
+    trace_write_int(numAttachments);
+    trace_write_array(attachments, (size_t)(numAttachments), sizeof(GLenum));
+    trace_real.glInvalidateFramebuffer(target, numAttachments, attachments);
+}
+
+static void trace_replay_glInvalidateFramebuffer(struct trace_reader *reader) {
+    if (!__glInvalidateFramebuffer) {
+        trace_missing(reader, TRACE_glInvalidateFramebuffer);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLsizei numAttachments = (GLsizei)trace_read_int(reader);
+    const GLenum *attachments = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glInvalidateFramebuffer(target, numAttachments, attachments);
+}
+
+static void APIENTRY trace_glInvalidateSubFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height) {
+    trace_command(TRACE_glInvalidateSubFramebuffer);
+    trace_write_uint(target);
+    trace_write_int(numAttachments);
+    trace_write_array(attachments, (size_t)(numAttachments), sizeof(GLenum));
+    trace_write_int(x);
+    trace_write_int(y);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_real.glInvalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height);
+}
+
+static void trace_replay_glInvalidateSubFramebuffer(struct trace_reader *reader) {
+    if (!__glInvalidateSubFramebuffer) {
+        trace_missing(reader, TRACE_glInvalidateSubFramebuffer);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLsizei numAttachments = (GLsizei)trace_read_int(reader);
+    const GLenum *attachments = trace_read_array(reader);
+    GLint x = (GLint)trace_read_int(reader);
+    GLint y = (GLint)trace_read_int(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glInvalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height);
+}
+
+static void APIENTRY trace_glMultiDrawArraysIndirect(GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride) {
+    trace_command(TRACE_glMultiDrawArraysIndirect);
+    trace_write_uint(mode);
+    trace_write_offset(indirect);
+    trace_write_int(drawcount);
+    trace_write_int(stride);
+    trace_real.glMultiDrawArraysIndirect(mode, indirect, drawcount, stride);
+}
+
+static void trace_replay_glMultiDrawArraysIndirect(struct trace_reader *reader) {
+    if (!__glMultiDrawArraysIndirect) {
+        trace_missing(reader, TRACE_glMultiDrawArraysIndirect);
+        return;
+    }
+    GLenum mode = (GLenum)trace_read_uint(reader);
+    const void *indirect = trace_read_offset(reader);
+    GLsizei drawcount = (GLsizei)trace_read_int(reader);
+    GLsizei stride = (GLsizei)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glMultiDrawArraysIndirect(mode, indirect, drawcount, stride);
+}
+
+static void APIENTRY trace_glMultiDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride) {
+    trace_command(TRACE_glMultiDrawElementsIndirect);
+    trace_write_uint(mode);
+    trace_write_uint(type);
+    trace_write_offset(indirect);
+    trace_write_int(drawcount);
+    trace_write_int(stride);
+    trace_real.glMultiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
+}
+
+static void trace_replay_glMultiDrawElementsIndirect(struct trace_reader *reader) {
+    if (!__glMultiDrawElementsIndirect) {
+        trace_missing(reader, TRACE_glMultiDrawElementsIndirect);
+        return;
+    }
+    GLenum mode = (GLenum)trace_read_uint(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const void *indirect = trace_read_offset(reader);
+    GLsizei drawcount = (GLsizei)trace_read_int(reader);
+    GLsizei stride = (GLsizei)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glMultiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
+}
+
+static void APIENTRY trace_glShaderStorageBlockBinding(GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding) {
+    trace_command(TRACE_glShaderStorageBlockBinding);
+    trace_write_uint(program);
+    trace_write_uint(storageBlockIndex);
+    trace_write_uint(storageBlockBinding);
+    trace_real.glShaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding);
+}
+
+static void trace_replay_glShaderStorageBlockBinding(struct trace_reader *reader) {
+    if (!__glShaderStorageBlockBinding) {
+        trace_missing(reader, TRACE_glShaderStorageBlockBinding);
+        return;
+    }
+    GLuint program = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    GLuint storageBlockIndex = (GLuint)trace_read_uint(reader);
+    GLuint storageBlockBinding = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glShaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding);
+}
+
+static void APIENTRY trace_glTexBufferRange(GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    trace_command(TRACE_glTexBufferRange);
+    trace_write_uint(target);
+    trace_write_uint(internalformat);
+    trace_write_uint(buffer);
+    trace_write_int(offset);
+    trace_write_int(size);
+    trace_real.glTexBufferRange(target, internalformat, buffer, offset, size);
+}
+
+static void trace_replay_glTexBufferRange(struct trace_reader *reader) {
+    if (!__glTexBufferRange) {
+        trace_missing(reader, TRACE_glTexBufferRange);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLenum internalformat = (GLenum)trace_read_uint(reader);
+    GLuint buffer = trace_name(reader, TRACE_NAME_BUFFER, (GLuint)trace_read_uint(reader));
+    GLintptr offset = (GLintptr)trace_read_int(reader);
+    GLsizeiptr size = (GLsizeiptr)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glTexBufferRange(target, internalformat, buffer, offset, size);
+}
+
+static void APIENTRY trace_glTexStorage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+    trace_command(TRACE_glTexStorage2DMultisample);
+    trace_write_uint(target);
+    trace_write_int(samples);
+    trace_write_uint(internalformat);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_write_uint(fixedsamplelocations);
+    trace_real.glTexStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+
+static void trace_replay_glTexStorage2DMultisample(struct trace_reader *reader) {
+    if (!__glTexStorage2DMultisample) {
+        trace_missing(reader, TRACE_glTexStorage2DMultisample);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLsizei samples = (GLsizei)trace_read_int(reader);
+    GLenum internalformat = (GLenum)trace_read_uint(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    GLboolean fixedsamplelocations = (GLboolean)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glTexStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+
+static void APIENTRY trace_glTexStorage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+    trace_command(TRACE_glTexStorage3DMultisample);
+    trace_write_uint(target);
+    trace_write_int(samples);
+    trace_write_uint(internalformat);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_write_int(depth);
+    trace_write_uint(fixedsamplelocations);
+    trace_real.glTexStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+
+static void trace_replay_glTexStorage3DMultisample(struct trace_reader *reader) {
+    if (!__glTexStorage3DMultisample) {
+        trace_missing(reader, TRACE_glTexStorage3DMultisample);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLsizei samples = (GLsizei)trace_read_int(reader);
+    GLenum internalformat = (GLenum)trace_read_uint(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    GLsizei depth = (GLsizei)trace_read_int(reader);
+    GLboolean fixedsamplelocations = (GLboolean)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glTexStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+
+static void APIENTRY trace_glTextureView(GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers) {
+    trace_command(TRACE_glTextureView);
+    trace_write_uint(texture);
+    trace_write_uint(target);
+    trace_write_uint(origtexture);
+    trace_write_uint(internalformat);
+    trace_write_uint(minlevel);
+    trace_write_uint(numlevels);
+    trace_write_uint(minlayer);
+    trace_write_uint(numlayers);
+    trace_real.glTextureView(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+}
+
+static void trace_replay_glTextureView(struct trace_reader *reader) {
+    if (!__glTextureView) {
+        trace_missing(reader, TRACE_glTextureView);
+        return;
+    }
+    GLuint texture = trace_name(reader, TRACE_NAME_TEXTURE, (GLuint)trace_read_uint(reader));
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLuint origtexture = trace_name(reader, TRACE_NAME_TEXTURE, (GLuint)trace_read_uint(reader));
+    GLenum internalformat = (GLenum)trace_read_uint(reader);
+    GLuint minlevel = (GLuint)trace_read_uint(reader);
+    GLuint numlevels = (GLuint)trace_read_uint(reader);
+    GLuint minlayer = (GLuint)trace_read_uint(reader);
+    GLuint numlayers = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glTextureView(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+}
+
+static void APIENTRY trace_glBindVertexBuffer(GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
+    trace_command(TRACE_glBindVertexBuffer);
+    trace_write_uint(bindingindex);
+    trace_write_uint(buffer);
+    trace_write_int(offset);
+    trace_write_int(stride);
+    trace_real.glBindVertexBuffer(bindingindex, buffer, offset, stride);
+}
+
+static void trace_replay_glBindVertexBuffer(struct trace_reader *reader) {
+    if (!__glBindVertexBuffer) {
+        trace_missing(reader, TRACE_glBindVertexBuffer);
+        return;
+    }
+    GLuint bindingindex = (GLuint)trace_read_uint(reader);
+    GLuint buffer = trace_name(reader, TRACE_NAME_BUFFER, (GLuint)trace_read_uint(reader));
+    GLintptr offset = (GLintptr)trace_read_int(reader);
+    GLsizei stride = (GLsizei)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glBindVertexBuffer(bindingindex, buffer, offset, stride);
+}
+
+static void APIENTRY trace_glVertexAttribFormat(GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
+    trace_command(TRACE_glVertexAttribFormat);
+    trace_write_uint(attribindex);
+    trace_write_int(size);
+    trace_write_uint(type);
+    trace_write_uint(normalized);
+    trace_write_uint(relativeoffset);
+    trace_real.glVertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
+}
+
+static void trace_replay_glVertexAttribFormat(struct trace_reader *reader) {
+    if (!__glVertexAttribFormat) {
+        trace_missing(reader, TRACE_glVertexAttribFormat);
+        return;
+    }
+    GLuint attribindex = (GLuint)trace_read_uint(reader);
+    GLint size = (GLint)trace_read_int(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLboolean normalized = (GLboolean)trace_read_uint(reader);
+    GLuint relativeoffset = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
+}
+
+static void APIENTRY trace_glVertexAttribIFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+    trace_command(TRACE_glVertexAttribIFormat);
+    trace_write_uint(attribindex);
+    trace_write_int(size);
+    trace_write_uint(type);
+    trace_write_uint(relativeoffset);
+    trace_real.glVertexAttribIFormat(attribindex, size, type, relativeoffset);
+}
+
+static void trace_replay_glVertexAttribIFormat(struct trace_reader *reader) {
+    if (!__glVertexAttribIFormat) {
+        trace_missing(reader, TRACE_glVertexAttribIFormat);
+        return;
+    }
+    GLuint attribindex = (GLuint)trace_read_uint(reader);
+    GLint size = (GLint)trace_read_int(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLuint relativeoffset = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribIFormat(attribindex, size, type, relativeoffset);
+}
+
+static void APIENTRY trace_glVertexAttribLFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+    trace_command(TRACE_glVertexAttribLFormat);
+    trace_write_uint(attribindex);
+    trace_write_int(size);
+    trace_write_uint(type);
+    trace_write_uint(relativeoffset);
+    trace_real.glVertexAttribLFormat(attribindex, size, type, relativeoffset);
+}
+
+static void trace_replay_glVertexAttribLFormat(struct trace_reader *reader) {
+    if (!__glVertexAttribLFormat) {
+        trace_missing(reader, TRACE_glVertexAttribLFormat);
+        return;
+    }
+    GLuint attribindex = (GLuint)trace_read_uint(reader);
+    GLint size = (GLint)trace_read_int(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLuint relativeoffset = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribLFormat(attribindex, size, type, relativeoffset);
+}
+
+static void APIENTRY trace_glVertexAttribBinding(GLuint attribindex, GLuint bindingindex) {
+    trace_command(TRACE_glVertexAttribBinding);
+    trace_write_uint(attribindex);
+    trace_write_uint(bindingindex);
+    trace_real.glVertexAttribBinding(attribindex, bindingindex);
+}
+
+static void trace_replay_glVertexAttribBinding(struct trace_reader *reader) {
+    if (!__glVertexAttribBinding) {
+        trace_missing(reader, TRACE_glVertexAttribBinding);
+        return;
+    }
+    GLuint attribindex = (GLuint)trace_read_uint(reader);
+    GLuint bindingindex = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glVertexAttribBinding(attribindex, bindingindex);
+}
+
+static void APIENTRY trace_glVertexBindingDivisor(GLuint bindingindex, GLuint divisor) {
+    trace_command(TRACE_glVertexBindingDivisor);
+    trace_write_uint(bindingindex);
+    trace_write_uint(divisor);
+    trace_real.glVertexBindingDivisor(bindingindex, divisor);
+}
+
+static void trace_replay_glVertexBindingDivisor(struct trace_reader *reader) {
+    if (!__glVertexBindingDivisor) {
+        trace_missing(reader, TRACE_glVertexBindingDivisor);
+        return;
+    }
+    GLuint bindingindex = (GLuint)trace_read_uint(reader);
+    GLuint divisor = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glVertexBindingDivisor(bindingindex, divisor);
+}
+
+static void APIENTRY trace_glDebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled) {
+    trace_command(TRACE_glDebugMessageControl);
+    trace_write_uint(source);
+    trace_write_uint(type);
+    trace_write_uint(severity);
+    trace_write_int(count);
+    trace_write_array(ids, (size_t)(count), sizeof(GLuint));
+    trace_write_uint(enabled);
+    trace_real.glDebugMessageControl(source, type, severity, count, ids, enabled);
+}
+
+static void trace_replay_glDebugMessageControl(struct trace_reader *reader) {
+    if (!__glDebugMessageControl) {
+        trace_missing(reader, TRACE_glDebugMessageControl);
+        return;
+    }
+    GLenum source = (GLenum)trace_read_uint(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLenum severity = (GLenum)trace_read_uint(reader);
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLuint *ids = trace_read_array(reader);
+    GLboolean enabled = (GLboolean)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glDebugMessageControl(source, type, severity, count, ids, enabled);
+}
+
+static void APIENTRY trace_glDebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf) {
+    trace_command(TRACE_glDebugMessageInsert);
+    trace_write_uint(source);
+    trace_write_uint(type);
+    trace_write_uint(id);
+    trace_write_uint(severity);
+    trace_write_int(length);
+    trace_write_string(buf, length);
+    trace_real.glDebugMessageInsert(source, type, id, severity, length, buf);
+}
+
+static void trace_replay_glDebugMessageInsert(struct trace_reader *reader) {
+    if (!__glDebugMessageInsert) {
+        trace_missing(reader, TRACE_glDebugMessageInsert);
+        return;
+    }
+    GLenum source = (GLenum)trace_read_uint(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLuint id = (GLuint)trace_read_uint(reader);
+    GLenum severity = (GLenum)trace_read_uint(reader);
+    GLsizei length = (GLsizei)trace_read_int(reader);
+    const GLchar *buf = trace_read_string(reader);
+    if (reader->error)
+        return;
+    __glDebugMessageInsert(source, type, id, severity, length, buf);
+}
+
+static void APIENTRY trace_glPushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar *message) {
+    trace_command(TRACE_glPushDebugGroup);
+    trace_write_uint(source);
+    trace_write_uint(id);
+    trace_write_int(length);
+    trace_write_string(message, length);
+    trace_real.glPushDebugGroup(source, id, length, message);
+}
+
+static void trace_replay_glPushDebugGroup(struct trace_reader *reader) {
+    if (!__glPushDebugGroup) {
+        trace_missing(reader, TRACE_glPushDebugGroup);
+        return;
+    }
+    GLenum source = (GLenum)trace_read_uint(reader);
+    GLuint id = (GLuint)trace_read_uint(reader);
+    GLsizei length = (GLsizei)trace_read_int(reader);
+    const GLchar *message = trace_read_string(reader);
+    if (reader->error)
+        return;
+    __glPushDebugGroup(source, id, length, message);
+}
+
+static void APIENTRY trace_glPopDebugGroup(void) {
+    trace_command(TRACE_glPopDebugGroup);
+    trace_real.glPopDebugGroup();
+}
+
+static void trace_replay_glPopDebugGroup(struct trace_reader *reader) {
+    if (!__glPopDebugGroup) {
+        trace_missing(reader, TRACE_glPopDebugGroup);
+        return;
+    }
+    if (reader->error)
+        return;
+    __glPopDebugGroup();
+}
+
+static void APIENTRY trace_glObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar *label) {
+    trace_command(TRACE_glObjectLabel);
+    trace_write_uint(identifier);
+    trace_write_uint(name);
+    trace_write_int(length);
+    trace_write_string(label, length);
+    trace_real.glObjectLabel(identifier, name, length, label);
+}
+
+static void trace_replay_glObjectLabel(struct trace_reader *reader) {
+    if (!__glObjectLabel) {
+        trace_missing(reader, TRACE_glObjectLabel);
+        return;
+    }
+    GLenum identifier = (GLenum)trace_read_uint(reader);
+    GLuint name = (GLuint)trace_read_uint(reader);
+    GLsizei length = (GLsizei)trace_read_int(reader);
+    const GLchar *label = trace_read_string(reader);
+    if (reader->error)
+        return;
+    __glObjectLabel(identifier, name, length, label);
+}
+
+static void APIENTRY trace_glObjectPtrLabel(const void *ptr, GLsizei length, const GLchar *label) {
+    trace_command(TRACE_glObjectPtrLabel);
+    trace_write_sync((GLsync)ptr);
+    trace_write_int(length);
+    trace_write_string(label, length);
+    trace_real.glObjectPtrLabel(ptr, length, label);
+}
+
+static void trace_replay_glObjectPtrLabel(struct trace_reader *reader) {
+    if (!__glObjectPtrLabel) {
+        trace_missing(reader, TRACE_glObjectPtrLabel);
+        return;
+    }
+    const void *ptr = (const void*)trace_read_sync(reader);
+    GLsizei length = (GLsizei)trace_read_int(reader);
+    const GLchar *label = trace_read_string(reader);
+    if (reader->error)
+        return;
+    __glObjectPtrLabel(ptr, length, label);
+}
+
+#endif
+
+#if FUNGL_VERSION >= GL_VERSION_4_4
+static void APIENTRY trace_glBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags) {
+    trace_command(TRACE_glBufferStorage);
+    trace_write_uint(target);
+    trace_write_int(size);
+    trace_write_array(data, (size_t)(size), 1);
+    trace_write_uint(flags);
+    trace_real.glBufferStorage(target, size, data, flags);
+}
+
+static void trace_replay_glBufferStorage(struct trace_reader *reader) {
+    if (!__glBufferStorage) {
+        trace_missing(reader, TRACE_glBufferStorage);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLsizeiptr size = (GLsizeiptr)trace_read_int(reader);
+    const void *data = trace_read_array(reader);
+    GLbitfield flags = (GLbitfield)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glBufferStorage(target, size, data, flags);
+}
+
+static void APIENTRY trace_glClearTexImage(GLuint texture, GLint level, GLenum format, GLenum type, const void *data) {
+    trace_command(TRACE_glClearTexImage);
+    trace_write_uint(texture);
+    trace_write_int(level);
+    trace_write_uint(format);
+    trace_write_uint(type);
+    trace_write_array(data, (size_t)(trace_pixel_size(format, type)), 1);
+    trace_real.glClearTexImage(texture, level, format, type, data);
+}
+
+static void trace_replay_glClearTexImage(struct trace_reader *reader) {
+    if (!__glClearTexImage) {
+        trace_missing(reader, TRACE_glClearTexImage);
+        return;
+    }
+    GLuint texture = trace_name(reader, TRACE_NAME_TEXTURE, (GLuint)trace_read_uint(reader));
+    GLint level = (GLint)trace_read_int(reader);
+    GLenum format = (GLenum)trace_read_uint(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const void *data = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glClearTexImage(texture, level, format, type, data);
+}
+
+static void APIENTRY trace_glClearTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *data) {
+    trace_command(TRACE_glClearTexSubImage);
+    trace_write_uint(texture);
+    trace_write_int(level);
+    trace_write_int(xoffset);
+    trace_write_int(yoffset);
+    trace_write_int(zoffset);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_write_int(depth);
+    trace_write_uint(format);
+    trace_write_uint(type);
+    trace_write_array(data, (size_t)(trace_pixel_size(format, type)), 1);
+    trace_real.glClearTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
+}
+
+static void trace_replay_glClearTexSubImage(struct trace_reader *reader) {
+    if (!__glClearTexSubImage) {
+        trace_missing(reader, TRACE_glClearTexSubImage);
+        return;
+    }
+    GLuint texture = trace_name(reader, TRACE_NAME_TEXTURE, (GLuint)trace_read_uint(reader));
+    GLint level = (GLint)trace_read_int(reader);
+    GLint xoffset = (GLint)trace_read_int(reader);
+    GLint yoffset = (GLint)trace_read_int(reader);
+    GLint zoffset = (GLint)trace_read_int(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    GLsizei depth = (GLsizei)trace_read_int(reader);
+    GLenum format = (GLenum)trace_read_uint(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const void *data = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glClearTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
+}
+
+static void APIENTRY trace_glBindBuffersBase(GLenum target, GLuint first, GLsizei count, const GLuint *buffers) {
+    trace_command(TRACE_glBindBuffersBase);
+    trace_write_uint(target);
+    trace_write_uint(first);
+    trace_write_int(count);
+    trace_write_array(buffers, (size_t)(count), sizeof(GLuint));
+    trace_real.glBindBuffersBase(target, first, count, buffers);
+}
+
+static void trace_replay_glBindBuffersBase(struct trace_reader *reader) {
+    if (!__glBindBuffersBase) {
+        trace_missing(reader, TRACE_glBindBuffersBase);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLuint first = (GLuint)trace_read_uint(reader);
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLuint *buffers = trace_read_names(reader, TRACE_NAME_BUFFER);
+    if (reader->error)
+        return;
+    __glBindBuffersBase(target, first, count, buffers);
+}
+
+static void APIENTRY trace_glBindBuffersRange(GLenum target, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizeiptr *sizes) {
+    trace_command(TRACE_glBindBuffersRange);
+    trace_write_uint(target);
+    trace_write_uint(first);
+    trace_write_int(count);
+    trace_write_array(buffers, (size_t)(count), sizeof(GLuint));
+    trace_write_array(offsets, (size_t)(count), sizeof(GLintptr));
+    trace_write_array(sizes, (size_t)(count), sizeof(GLsizeiptr));
+    trace_real.glBindBuffersRange(target, first, count, buffers, offsets, sizes);
+}
+
+static void trace_replay_glBindBuffersRange(struct trace_reader *reader) {
+    if (!__glBindBuffersRange) {
+        trace_missing(reader, TRACE_glBindBuffersRange);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLuint first = (GLuint)trace_read_uint(reader);
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLuint *buffers = trace_read_names(reader, TRACE_NAME_BUFFER);
+    const GLintptr *offsets = trace_read_array(reader);
+    const GLsizeiptr *sizes = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glBindBuffersRange(target, first, count, buffers, offsets, sizes);
+}
+
+static void APIENTRY trace_glBindTextures(GLuint first, GLsizei count, const GLuint *textures) {
+    trace_command(TRACE_glBindTextures);
+    trace_write_uint(first);
+    trace_write_int(count);
+    trace_write_array(textures, (size_t)(count), sizeof(GLuint));
+    trace_real.glBindTextures(first, count, textures);
+}
+
+static void trace_replay_glBindTextures(struct trace_reader *reader) {
+    if (!__glBindTextures) {
+        trace_missing(reader, TRACE_glBindTextures);
+        return;
+    }
+    GLuint first = (GLuint)trace_read_uint(reader);
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLuint *textures = trace_read_names(reader, TRACE_NAME_TEXTURE);
+    if (reader->error)
+        return;
+    __glBindTextures(first, count, textures);
+}
+
+static void APIENTRY trace_glBindSamplers(GLuint first, GLsizei count, const GLuint *samplers) {
+    trace_command(TRACE_glBindSamplers);
+    trace_write_uint(first);
+    trace_write_int(count);
+    trace_write_array(samplers, (size_t)(count), sizeof(GLuint));
+    trace_real.glBindSamplers(first, count, samplers);
+}
+
+static void trace_replay_glBindSamplers(struct trace_reader *reader) {
+    if (!__glBindSamplers) {
+        trace_missing(reader, TRACE_glBindSamplers);
+        return;
+    }
+    GLuint first = (GLuint)trace_read_uint(reader);
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLuint *samplers = trace_read_names(reader, TRACE_NAME_SAMPLER);
+    if (reader->error)
+        return;
+    __glBindSamplers(first, count, samplers);
+}
+
+static void APIENTRY trace_glBindImageTextures(GLuint first, GLsizei count, const GLuint *textures) {
+    trace_command(TRACE_glBindImageTextures);
+    trace_write_uint(first);
+    trace_write_int(count);
+    trace_write_array(textures, (size_t)(count), sizeof(GLuint));
+    trace_real.glBindImageTextures(first, count, textures);
+}
+
+static void trace_replay_glBindImageTextures(struct trace_reader *reader) {
+    if (!__glBindImageTextures) {
+        trace_missing(reader, TRACE_glBindImageTextures);
+        return;
+    }
+    GLuint first = (GLuint)trace_read_uint(reader);
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLuint *textures = trace_read_names(reader, TRACE_NAME_TEXTURE);
+    if (reader->error)
+        return;
+    __glBindImageTextures(first, count, textures);
+}
+
+static void APIENTRY trace_glBindVertexBuffers(GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides) {
+    trace_command(TRACE_glBindVertexBuffers);
+    trace_write_uint(first);
+    trace_write_int(count);
+    trace_write_array(buffers, (size_t)(count), sizeof(GLuint));
+    trace_write_array(offsets, (size_t)(count), sizeof(GLintptr));
+    trace_write_array(strides, (size_t)(count), sizeof(GLsizei));
+    trace_real.glBindVertexBuffers(first, count, buffers, offsets, strides);
+}
+
+static void trace_replay_glBindVertexBuffers(struct trace_reader *reader) {
+    if (!__glBindVertexBuffers) {
+        trace_missing(reader, TRACE_glBindVertexBuffers);
+        return;
+    }
+    GLuint first = (GLuint)trace_read_uint(reader);
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLuint *buffers = trace_read_names(reader, TRACE_NAME_BUFFER);
+    const GLintptr *offsets = trace_read_array(reader);
+    const GLsizei *strides = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glBindVertexBuffers(first, count, buffers, offsets, strides);
+}
+
+#endif
+
+#if FUNGL_VERSION >= GL_VERSION_4_5
+static void APIENTRY trace_glClipControl(GLenum origin, GLenum depth) {
+    trace_command(TRACE_glClipControl);
+    trace_write_uint(origin);
+    trace_write_uint(depth);
+    trace_real.glClipControl(origin, depth);
+}
+
+static void trace_replay_glClipControl(struct trace_reader *reader) {
+    if (!__glClipControl) {
+        trace_missing(reader, TRACE_glClipControl);
+        return;
+    }
+    GLenum origin = (GLenum)trace_read_uint(reader);
+    GLenum depth = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glClipControl(origin, depth);
+}
+
+static void APIENTRY trace_glCreateTransformFeedbacks(GLsizei n, GLuint *ids) {
+    trace_command(TRACE_glCreateTransformFeedbacks);
+    trace_write_int(n);
+    trace_real.glCreateTransformFeedbacks(n, ids);
+    trace_write_array(ids, (size_t)(n), sizeof(GLuint));
+}
+
+static void trace_replay_glCreateTransformFeedbacks(struct trace_reader *reader) {
+    if (!__glCreateTransformFeedbacks) {
+        trace_missing(reader, TRACE_glCreateTransformFeedbacks);
+        return;
+    }
+    GLsizei n = (GLsizei)trace_read_int(reader);
+    GLuint *ids = trace_scratch(reader, (size_t)(n) * sizeof(GLuint));
+    if (reader->error)
+        return;
+    __glCreateTransformFeedbacks(n, ids);
+    trace_map_names(reader, TRACE_NAME_TRANSFORM_FEEDBACK, ids, (size_t)(n));
+}
+
+static void APIENTRY trace_glTransformFeedbackBufferBase(GLuint xfb, GLuint index, GLuint buffer) {
+    trace_command(TRACE_glTransformFeedbackBufferBase);
+    trace_write_uint(xfb);
+    trace_write_uint(index);
+    trace_write_uint(buffer);
+    trace_real.glTransformFeedbackBufferBase(xfb, index, buffer);
+}
+
+static void trace_replay_glTransformFeedbackBufferBase(struct trace_reader *reader) {
+    if (!__glTransformFeedbackBufferBase) {
+        trace_missing(reader, TRACE_glTransformFeedbackBufferBase);
+        return;
+    }
+    GLuint xfb = trace_name(reader, TRACE_NAME_TRANSFORM_FEEDBACK, (GLuint)trace_read_uint(reader));
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLuint buffer = trace_name(reader, TRACE_NAME_BUFFER, (GLuint)trace_read_uint(reader));
+    if (reader->error)
+        return;
+    __glTransformFeedbackBufferBase(xfb, index, buffer);
+}
+
+static void APIENTRY trace_glTransformFeedbackBufferRange(GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    trace_command(TRACE_glTransformFeedbackBufferRange);
+    trace_write_uint(xfb);
+    trace_write_uint(index);
+    trace_write_uint(buffer);
+    trace_write_int(offset);
+    trace_write_int(size);
+    trace_real.glTransformFeedbackBufferRange(xfb, index, buffer, offset, size);
+}
+
+static void trace_replay_glTransformFeedbackBufferRange(struct trace_reader *reader) {
+    if (!__glTransformFeedbackBufferRange) {
+        trace_missing(reader, TRACE_glTransformFeedbackBufferRange);
+        return;
+    }
+    GLuint xfb = trace_name(reader, TRACE_NAME_TRANSFORM_FEEDBACK, (GLuint)trace_read_uint(reader));
+    GLuint index = (GLuint)trace_read_uint(reader);
+    GLuint buffer = trace_name(reader, TRACE_NAME_BUFFER, (GLuint)trace_read_uint(reader));
+    GLintptr offset = (GLintptr)trace_read_int(reader);
+    GLsizeiptr size = (GLsizeiptr)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glTransformFeedbackBufferRange(xfb, index, buffer, offset, size);
+}
+
+static void APIENTRY trace_glCreateBuffers(GLsizei n, GLuint *buffers) {
+    trace_command(TRACE_glCreateBuffers);
+    trace_write_int(n);
+    trace_real.glCreateBuffers(n, buffers);
+    trace_write_array(buffers, (size_t)(n), sizeof(GLuint));
+}
+
+static void trace_replay_glCreateBuffers(struct trace_reader *reader) {
+    if (!__glCreateBuffers) {
+        trace_missing(reader, TRACE_glCreateBuffers);
+        return;
+    }
+    GLsizei n = (GLsizei)trace_read_int(reader);
+    GLuint *buffers = trace_scratch(reader, (size_t)(n) * sizeof(GLuint));
+    if (reader->error)
+        return;
+    __glCreateBuffers(n, buffers);
+    trace_map_names(reader, TRACE_NAME_BUFFER, buffers, (size_t)(n));
+}
+
+static void APIENTRY trace_glNamedBufferStorage(GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags) {
+    trace_command(TRACE_glNamedBufferStorage);
+    trace_write_uint(buffer);
+    trace_write_int(size);
+    trace_write_array(data, (size_t)(size), 1);
+    trace_write_uint(flags);
+    trace_real.glNamedBufferStorage(buffer, size, data, flags);
+}
+
+static void trace_replay_glNamedBufferStorage(struct trace_reader *reader) {
+    if (!__glNamedBufferStorage) {
+        trace_missing(reader, TRACE_glNamedBufferStorage);
+        return;
+    }
+    GLuint buffer = trace_name(reader, TRACE_NAME_BUFFER, (GLuint)trace_read_uint(reader));
+    GLsizeiptr size = (GLsizeiptr)trace_read_int(reader);
+    const void *data = trace_read_array(reader);
+    GLbitfield flags = (GLbitfield)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glNamedBufferStorage(buffer, size, data, flags);
+}
+
+static void APIENTRY trace_glNamedBufferData(GLuint buffer, GLsizeiptr size, const void *data, GLenum usage) {
+    trace_command(TRACE_glNamedBufferData);
+    trace_write_uint(buffer);
+    trace_write_int(size);
+    trace_write_array(data, (size_t)(size), 1);
+    trace_write_uint(usage);
+    trace_real.glNamedBufferData(buffer, size, data, usage);
+}
+
+static void trace_replay_glNamedBufferData(struct trace_reader *reader) {
+    if (!__glNamedBufferData) {
+        trace_missing(reader, TRACE_glNamedBufferData);
+        return;
+    }
+    GLuint buffer = trace_name(reader, TRACE_NAME_BUFFER, (GLuint)trace_read_uint(reader));
+    GLsizeiptr size = (GLsizeiptr)trace_read_int(reader);
+    const void *data = trace_read_array(reader);
+    GLenum usage = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glNamedBufferData(buffer, size, data, usage);
+}
+
+static void APIENTRY trace_glNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data) {
+    trace_command(TRACE_glNamedBufferSubData);
+    trace_write_uint(buffer);
+    trace_write_int(offset);
+    trace_write_int(size);
+    trace_write_array(data, (size_t)(size), 1);
+    trace_real.glNamedBufferSubData(buffer, offset, size, data);
+}
+
+static void trace_replay_glNamedBufferSubData(struct trace_reader *reader) {
+    if (!__glNamedBufferSubData) {
+        trace_missing(reader, TRACE_glNamedBufferSubData);
+        return;
+    }
+    GLuint buffer = trace_name(reader, TRACE_NAME_BUFFER, (GLuint)trace_read_uint(reader));
+    GLintptr offset = (GLintptr)trace_read_int(reader);
+    GLsizeiptr size = (GLsizeiptr)trace_read_int(reader);
+    const void *data = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glNamedBufferSubData(buffer, offset, size, data);
+}
+
+static void APIENTRY trace_glCopyNamedBufferSubData(GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+    trace_command(TRACE_glCopyNamedBufferSubData);
+    trace_write_uint(readBuffer);
+    trace_write_uint(writeBuffer);
+    trace_write_int(readOffset);
+    trace_write_int(writeOffset);
+    trace_write_int(size);
+    trace_real.glCopyNamedBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size);
+}
+
+static void trace_replay_glCopyNamedBufferSubData(struct trace_reader *reader) {
+    if (!__glCopyNamedBufferSubData) {
+        trace_missing(reader, TRACE_glCopyNamedBufferSubData);
+        return;
+    }
+    GLuint readBuffer = trace_name(reader, TRACE_NAME_BUFFER, (GLuint)trace_read_uint(reader));
+    GLuint writeBuffer = trace_name(reader, TRACE_NAME_BUFFER, (GLuint)trace_read_uint(reader));
+    GLintptr readOffset = (GLintptr)trace_read_int(reader);
+    GLintptr writeOffset = (GLintptr)trace_read_int(reader);
+    GLsizeiptr size = (GLsizeiptr)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glCopyNamedBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size);
+}
+
+static void APIENTRY trace_glClearNamedBufferData(GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data) {
+    trace_command(TRACE_glClearNamedBufferData);
+    trace_write_uint(buffer);
+    trace_write_uint(internalformat);
+    trace_write_uint(format);
+    trace_write_uint(type);
+    trace_write_array(data, (size_t)(trace_pixel_size(format, type)), 1);
+    trace_real.glClearNamedBufferData(buffer, internalformat, format, type, data);
+}
+
+static void trace_replay_glClearNamedBufferData(struct trace_reader *reader) {
+    if (!__glClearNamedBufferData) {
+        trace_missing(reader, TRACE_glClearNamedBufferData);
+        return;
+    }
+    GLuint buffer = trace_name(reader, TRACE_NAME_BUFFER, (GLuint)trace_read_uint(reader));
+    GLenum internalformat = (GLenum)trace_read_uint(reader);
+    GLenum format = (GLenum)trace_read_uint(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const void *data = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glClearNamedBufferData(buffer, internalformat, format, type, data);
+}
+
+static void APIENTRY trace_glClearNamedBufferSubData(GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data) {
+    trace_command(TRACE_glClearNamedBufferSubData);
+    trace_write_uint(buffer);
+    trace_write_uint(internalformat);
+    trace_write_int(offset);
+    trace_write_int(size);
+    trace_write_uint(format);
+    trace_write_uint(type);
+    trace_write_array(data, (size_t)(trace_pixel_size(format, type)), 1);
+    trace_real.glClearNamedBufferSubData(buffer, internalformat, offset, size, format, type, data);
+}
+
+static void trace_replay_glClearNamedBufferSubData(struct trace_reader *reader) {
+    if (!__glClearNamedBufferSubData) {
+        trace_missing(reader, TRACE_glClearNamedBufferSubData);
+        return;
+    }
+    GLuint buffer = trace_name(reader, TRACE_NAME_BUFFER, (GLuint)trace_read_uint(reader));
+    GLenum internalformat = (GLenum)trace_read_uint(reader);
+    GLintptr offset = (GLintptr)trace_read_int(reader);
+    GLsizeiptr size = (GLsizeiptr)trace_read_int(reader);
+    GLenum format = (GLenum)trace_read_uint(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const void *data = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glClearNamedBufferSubData(buffer, internalformat, offset, size, format, type, data);
+}
+
+static void *APIENTRY trace_glMapNamedBuffer(GLuint buffer, GLenum access) {
+    trace_command(TRACE_glMapNamedBuffer);
+    trace_write_uint(buffer);
+    trace_write_uint(access);
+    void *result = trace_real.glMapNamedBuffer(buffer, access);
+    trace_after_glMapNamedBuffer(buffer, access, result);
+    return result;
+}
+
+static void trace_replay_glMapNamedBuffer(struct trace_reader *reader) {
+    if (!__glMapNamedBuffer) {
+        trace_missing(reader, TRACE_glMapNamedBuffer);
+        return;
+    }
+    GLuint buffer = trace_name(reader, TRACE_NAME_BUFFER, (GLuint)trace_read_uint(reader));
+    GLenum access = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    void *result = __glMapNamedBuffer(buffer, access);
+    trace_replay_after_glMapNamedBuffer(reader, buffer, access, result);
+}
+
+static void *APIENTRY trace_glMapNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+    trace_command(TRACE_glMapNamedBufferRange);
+    trace_write_uint(buffer);
+    trace_write_int(offset);
+    trace_write_int(length);
+    trace_write_uint(access);
+    void *result = trace_real.glMapNamedBufferRange(buffer, offset, length, access);
+    trace_after_glMapNamedBufferRange(buffer, offset, length, access, result);
+    return result;
+}
+
+static void trace_replay_glMapNamedBufferRange(struct trace_reader *reader) {
+    if (!__glMapNamedBufferRange) {
+        trace_missing(reader, TRACE_glMapNamedBufferRange);
+        return;
+    }
+    GLuint buffer = trace_name(reader, TRACE_NAME_BUFFER, (GLuint)trace_read_uint(reader));
+    GLintptr offset = (GLintptr)trace_read_int(reader);
+    GLsizeiptr length = (GLsizeiptr)trace_read_int(reader);
+    GLbitfield access = (GLbitfield)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    void *result = __glMapNamedBufferRange(buffer, offset, length, access);
+    trace_replay_after_glMapNamedBufferRange(reader, buffer, offset, length, access, result);
+}
+
+static GLboolean APIENTRY trace_glUnmapNamedBuffer(GLuint buffer) {
+    trace_before_glUnmapNamedBuffer(buffer);
+    trace_command(TRACE_glUnmapNamedBuffer);
+    trace_write_uint(buffer);
+    GLboolean result = trace_real.glUnmapNamedBuffer(buffer);
+    return result;
+}
+
+static void trace_replay_glUnmapNamedBuffer(struct trace_reader *reader) {
+    if (!__glUnmapNamedBuffer) {
+        trace_missing(reader, TRACE_glUnmapNamedBuffer);
+        return;
+    }
+    GLuint buffer = trace_name(reader, TRACE_NAME_BUFFER, (GLuint)trace_read_uint(reader));
+    if (reader->error)
+        return;
+    trace_replay_before_glUnmapNamedBuffer(reader, buffer);
+    GLboolean result = __glUnmapNamedBuffer(buffer);
+    (void)result;
+}
+
+static void APIENTRY trace_glFlushMappedNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+    trace_before_glFlushMappedNamedBufferRange(buffer, offset, length);
+    trace_command(TRACE_glFlushMappedNamedBufferRange);
+    trace_write_uint(buffer);
+    trace_write_int(offset);
+    trace_write_int(length);
+    trace_real.glFlushMappedNamedBufferRange(buffer, offset, length);
+}
+
+static void trace_replay_glFlushMappedNamedBufferRange(struct trace_reader *reader) {
+    if (!__glFlushMappedNamedBufferRange) {
+        trace_missing(reader, TRACE_glFlushMappedNamedBufferRange);
+        return;
+    }
+    GLuint buffer = trace_name(reader, TRACE_NAME_BUFFER, (GLuint)trace_read_uint(reader));
+    GLintptr offset = (GLintptr)trace_read_int(reader);
+    GLsizeiptr length = (GLsizeiptr)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glFlushMappedNamedBufferRange(buffer, offset, length);
+}
+
+static void APIENTRY trace_glCreateFramebuffers(GLsizei n, GLuint *framebuffers) {
+    trace_command(TRACE_glCreateFramebuffers);
+    trace_write_int(n);
+    trace_real.glCreateFramebuffers(n, framebuffers);
+    trace_write_array(framebuffers, (size_t)(n), sizeof(GLuint));
+}
+
+static void trace_replay_glCreateFramebuffers(struct trace_reader *reader) {
+    if (!__glCreateFramebuffers) {
+        trace_missing(reader, TRACE_glCreateFramebuffers);
+        return;
+    }
+    GLsizei n = (GLsizei)trace_read_int(reader);
+    GLuint *framebuffers = trace_scratch(reader, (size_t)(n) * sizeof(GLuint));
+    if (reader->error)
+        return;
+    __glCreateFramebuffers(n, framebuffers);
+    trace_map_names(reader, TRACE_NAME_FRAMEBUFFER, framebuffers, (size_t)(n));
+}
+
+static void APIENTRY trace_glNamedFramebufferRenderbuffer(GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+    trace_command(TRACE_glNamedFramebufferRenderbuffer);
+    trace_write_uint(framebuffer);
+    trace_write_uint(attachment);
+    trace_write_uint(renderbuffertarget);
+    trace_write_uint(renderbuffer);
+    trace_real.glNamedFramebufferRenderbuffer(framebuffer, attachment, renderbuffertarget, renderbuffer);
+}
+
+static void trace_replay_glNamedFramebufferRenderbuffer(struct trace_reader *reader) {
+    if (!__glNamedFramebufferRenderbuffer) {
+        trace_missing(reader, TRACE_glNamedFramebufferRenderbuffer);
+        return;
+    }
+    GLuint framebuffer = trace_name(reader, TRACE_NAME_FRAMEBUFFER, (GLuint)trace_read_uint(reader));
+    GLenum attachment = (GLenum)trace_read_uint(reader);
+    GLenum renderbuffertarget = (GLenum)trace_read_uint(reader);
+    GLuint renderbuffer = trace_name(reader, TRACE_NAME_RENDERBUFFER, (GLuint)trace_read_uint(reader));
+    if (reader->error)
+        return;
+    __glNamedFramebufferRenderbuffer(framebuffer, attachment, renderbuffertarget, renderbuffer);
+}
+
+static void APIENTRY trace_glNamedFramebufferParameteri(GLuint framebuffer, GLenum pname, GLint param) {
+    trace_command(TRACE_glNamedFramebufferParameteri);
+    trace_write_uint(framebuffer);
+    trace_write_uint(pname);
+    trace_write_int(param);
+    trace_real.glNamedFramebufferParameteri(framebuffer, pname, param);
+}
+
+static void trace_replay_glNamedFramebufferParameteri(struct trace_reader *reader) {
+    if (!__glNamedFramebufferParameteri) {
+        trace_missing(reader, TRACE_glNamedFramebufferParameteri);
+        return;
+    }
+    GLuint framebuffer = trace_name(reader, TRACE_NAME_FRAMEBUFFER, (GLuint)trace_read_uint(reader));
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    GLint param = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glNamedFramebufferParameteri(framebuffer, pname, param);
+}
+
+static void APIENTRY trace_glNamedFramebufferTexture(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level) {
+    trace_command(TRACE_glNamedFramebufferTexture);
+    trace_write_uint(framebuffer);
+    trace_write_uint(attachment);
+    trace_write_uint(texture);
+    trace_write_int(level);
+    trace_real.glNamedFramebufferTexture(framebuffer, attachment, texture, level);
+}
+
+static void trace_replay_glNamedFramebufferTexture(struct trace_reader *reader) {
+    if (!__glNamedFramebufferTexture) {
+        trace_missing(reader, TRACE_glNamedFramebufferTexture);
+        return;
+    }
+    GLuint framebuffer = trace_name(reader, TRACE_NAME_FRAMEBUFFER, (GLuint)trace_read_uint(reader));
+    GLenum attachment = (GLenum)trace_read_uint(reader);
+    GLuint texture = trace_name(reader, TRACE_NAME_TEXTURE, (GLuint)trace_read_uint(reader));
+    GLint level = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glNamedFramebufferTexture(framebuffer, attachment, texture, level);
+}
+
+static void APIENTRY trace_glNamedFramebufferTextureLayer(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+    trace_command(TRACE_glNamedFramebufferTextureLayer);
+    trace_write_uint(framebuffer);
+    trace_write_uint(attachment);
+    trace_write_uint(texture);
+    trace_write_int(level);
+    trace_write_int(layer);
+    trace_real.glNamedFramebufferTextureLayer(framebuffer, attachment, texture, level, layer);
+}
+
+static void trace_replay_glNamedFramebufferTextureLayer(struct trace_reader *reader) {
+    if (!__glNamedFramebufferTextureLayer) {
+        trace_missing(reader, TRACE_glNamedFramebufferTextureLayer);
+        return;
+    }
+    GLuint framebuffer = trace_name(reader, TRACE_NAME_FRAMEBUFFER, (GLuint)trace_read_uint(reader));
+    GLenum attachment = (GLenum)trace_read_uint(reader);
+    GLuint texture = trace_name(reader, TRACE_NAME_TEXTURE, (GLuint)trace_read_uint(reader));
+    GLint level = (GLint)trace_read_int(reader);
+    GLint layer = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glNamedFramebufferTextureLayer(framebuffer, attachment, texture, level, layer);
+}
+
+static void APIENTRY trace_glNamedFramebufferDrawBuffer(GLuint framebuffer, GLenum buf) {
+    trace_command(TRACE_glNamedFramebufferDrawBuffer);
+    trace_write_uint(framebuffer);
+    trace_write_uint(buf);
+    trace_real.glNamedFramebufferDrawBuffer(framebuffer, buf);
+}
+
+static void trace_replay_glNamedFramebufferDrawBuffer(struct trace_reader *reader) {
+    if (!__glNamedFramebufferDrawBuffer) {
+        trace_missing(reader, TRACE_glNamedFramebufferDrawBuffer);
+        return;
+    }
+    GLuint framebuffer = trace_name(reader, TRACE_NAME_FRAMEBUFFER, (GLuint)trace_read_uint(reader));
+    GLenum buf = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glNamedFramebufferDrawBuffer(framebuffer, buf);
+}
+
+static void APIENTRY trace_glNamedFramebufferDrawBuffers(GLuint framebuffer, GLsizei n, const GLenum *bufs) {
+    trace_command(TRACE_glNamedFramebufferDrawBuffers);
+    trace_write_uint(framebuffer);
+    trace_write_int(n);
+    trace_write_array(bufs, (size_t)(n), sizeof(GLenum));
+    trace_real.glNamedFramebufferDrawBuffers(framebuffer, n, bufs);
+}
+
+static void trace_replay_glNamedFramebufferDrawBuffers(struct trace_reader *reader) {
+    if (!__glNamedFramebufferDrawBuffers) {
+        trace_missing(reader, TRACE_glNamedFramebufferDrawBuffers);
+        return;
+    }
+    GLuint framebuffer = trace_name(reader, TRACE_NAME_FRAMEBUFFER, (GLuint)trace_read_uint(reader));
+    GLsizei n = (GLsizei)trace_read_int(reader);
+    const GLenum *bufs = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glNamedFramebufferDrawBuffers(framebuffer, n, bufs);
+}
+
+static void APIENTRY trace_glNamedFramebufferReadBuffer(GLuint framebuffer, GLenum src) {
+    trace_command(TRACE_glNamedFramebufferReadBuffer);
+    trace_write_uint(framebuffer);
+    trace_write_uint(src);
+    trace_real.glNamedFramebufferReadBuffer(framebuffer, src);
+}
+
+static void trace_replay_glNamedFramebufferReadBuffer(struct trace_reader *reader) {
+    if (!__glNamedFramebufferReadBuffer) {
+        trace_missing(reader, TRACE_glNamedFramebufferReadBuffer);
+        return;
+    }
+    GLuint framebuffer = trace_name(reader, TRACE_NAME_FRAMEBUFFER, (GLuint)trace_read_uint(reader));
+    GLenum src = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glNamedFramebufferReadBuffer(framebuffer, src);
+}
+
+static void APIENTRY trace_glInvalidateNamedFramebufferData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments) {
+    trace_command(TRACE_glInvalidateNamedFramebufferData);
+    trace_write_uint(framebuffer);
+    trace_write_int(numAttachments);
+    trace_write_array(attachments, (size_t)(numAttachments), sizeof(GLenum));
+    trace_real.glInvalidateNamedFramebufferData(framebuffer, numAttachments, attachments);
+}
+
+static void trace_replay_glInvalidateNamedFramebufferData(struct trace_reader *reader) {
+    if (!__glInvalidateNamedFramebufferData) {
+        trace_missing(reader, TRACE_glInvalidateNamedFramebufferData);
+        return;
+    }
+    GLuint framebuffer = trace_name(reader, TRACE_NAME_FRAMEBUFFER, (GLuint)trace_read_uint(reader));
+    GLsizei numAttachments = (GLsizei)trace_read_int(reader);
+    const GLenum *attachments = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glInvalidateNamedFramebufferData(framebuffer, numAttachments, attachments);
+}
+
+static void APIENTRY trace_glInvalidateNamedFramebufferSubData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height) {
+    trace_command(TRACE_glInvalidateNamedFramebufferSubData);
+    trace_write_uint(framebuffer);
+    trace_write_int(numAttachments);
+    trace_write_array(attachments, (size_t)(numAttachments), sizeof(GLenum));
+    trace_write_int(x);
+    trace_write_int(y);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_real.glInvalidateNamedFramebufferSubData(framebuffer, numAttachments, attachments, x, y, width, height);
+}
+
+static void trace_replay_glInvalidateNamedFramebufferSubData(struct trace_reader *reader) {
+    if (!__glInvalidateNamedFramebufferSubData) {
+        trace_missing(reader, TRACE_glInvalidateNamedFramebufferSubData);
+        return;
+    }
+    GLuint framebuffer = trace_name(reader, TRACE_NAME_FRAMEBUFFER, (GLuint)trace_read_uint(reader));
+    GLsizei numAttachments = (GLsizei)trace_read_int(reader);
+    const GLenum *attachments = trace_read_array(reader);
+    GLint x = (GLint)trace_read_int(reader);
+    GLint y = (GLint)trace_read_int(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glInvalidateNamedFramebufferSubData(framebuffer, numAttachments, attachments, x, y, width, height);
+}
+
+static void APIENTRY trace_glClearNamedFramebufferiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint *value) {
+    trace_command(TRACE_glClearNamedFramebufferiv);
+    trace_write_uint(framebuffer);
+    trace_write_uint(buffer);
+    trace_write_int(drawbuffer);
+    trace_write_array(value, (size_t)(trace_clear_count(buffer)), sizeof(GLint));
+    trace_real.glClearNamedFramebufferiv(framebuffer, buffer, drawbuffer, value);
+}
+
+static void trace_replay_glClearNamedFramebufferiv(struct trace_reader *reader) {
+    if (!__glClearNamedFramebufferiv) {
+        trace_missing(reader, TRACE_glClearNamedFramebufferiv);
+        return;
+    }
+    GLuint framebuffer = trace_name(reader, TRACE_NAME_FRAMEBUFFER, (GLuint)trace_read_uint(reader));
+    GLenum buffer = (GLenum)trace_read_uint(reader);
+    GLint drawbuffer = (GLint)trace_read_int(reader);
+    const GLint *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glClearNamedFramebufferiv(framebuffer, buffer, drawbuffer, value);
+}
+
+static void APIENTRY trace_glClearNamedFramebufferuiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint *value) {
+    trace_command(TRACE_glClearNamedFramebufferuiv);
+    trace_write_uint(framebuffer);
+    trace_write_uint(buffer);
+    trace_write_int(drawbuffer);
+    trace_write_array(value, (size_t)(trace_clear_count(buffer)), sizeof(GLuint));
+    trace_real.glClearNamedFramebufferuiv(framebuffer, buffer, drawbuffer, value);
+}
+
+static void trace_replay_glClearNamedFramebufferuiv(struct trace_reader *reader) {
+    if (!__glClearNamedFramebufferuiv) {
+        trace_missing(reader, TRACE_glClearNamedFramebufferuiv);
+        return;
+    }
+    GLuint framebuffer = trace_name(reader, TRACE_NAME_FRAMEBUFFER, (GLuint)trace_read_uint(reader));
+    GLenum buffer = (GLenum)trace_read_uint(reader);
+    GLint drawbuffer = (GLint)trace_read_int(reader);
+    const GLuint *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glClearNamedFramebufferuiv(framebuffer, buffer, drawbuffer, value);
+}
+
+static void APIENTRY trace_glClearNamedFramebufferfv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+    trace_command(TRACE_glClearNamedFramebufferfv);
+    trace_write_uint(framebuffer);
+    trace_write_uint(buffer);
+    trace_write_int(drawbuffer);
+    trace_write_array(value, (size_t)(trace_clear_count(buffer)), sizeof(GLfloat));
+    trace_real.glClearNamedFramebufferfv(framebuffer, buffer, drawbuffer, value);
+}
+
+static void trace_replay_glClearNamedFramebufferfv(struct trace_reader *reader) {
+    if (!__glClearNamedFramebufferfv) {
+        trace_missing(reader, TRACE_glClearNamedFramebufferfv);
+        return;
+    }
+    GLuint framebuffer = trace_name(reader, TRACE_NAME_FRAMEBUFFER, (GLuint)trace_read_uint(reader));
+    GLenum buffer = (GLenum)trace_read_uint(reader);
+    GLint drawbuffer = (GLint)trace_read_int(reader);
+    const GLfloat *value = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glClearNamedFramebufferfv(framebuffer, buffer, drawbuffer, value);
+}
+
+static void APIENTRY trace_glClearNamedFramebufferfi(GLuint framebuffer, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+    trace_command(TRACE_glClearNamedFramebufferfi);
+    trace_write_uint(framebuffer);
+    trace_write_uint(buffer);
+    trace_write_int(drawbuffer);
+    trace_write_float(depth);
+    trace_write_int(stencil);
+    trace_real.glClearNamedFramebufferfi(framebuffer, buffer, drawbuffer, depth, stencil);
+}
+
+static void trace_replay_glClearNamedFramebufferfi(struct trace_reader *reader) {
+    if (!__glClearNamedFramebufferfi) {
+        trace_missing(reader, TRACE_glClearNamedFramebufferfi);
+        return;
+    }
+    GLuint framebuffer = trace_name(reader, TRACE_NAME_FRAMEBUFFER, (GLuint)trace_read_uint(reader));
+    GLenum buffer = (GLenum)trace_read_uint(reader);
+    GLint drawbuffer = (GLint)trace_read_int(reader);
+    GLfloat depth = trace_read_float(reader);
+    GLint stencil = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glClearNamedFramebufferfi(framebuffer, buffer, drawbuffer, depth, stencil);
+}
+
+static void APIENTRY trace_glBlitNamedFramebuffer(GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+    trace_command(TRACE_glBlitNamedFramebuffer);
+    trace_write_uint(readFramebuffer);
+    trace_write_uint(drawFramebuffer);
+    trace_write_int(srcX0);
+    trace_write_int(srcY0);
+    trace_write_int(srcX1);
+    trace_write_int(srcY1);
+    trace_write_int(dstX0);
+    trace_write_int(dstY0);
+    trace_write_int(dstX1);
+    trace_write_int(dstY1);
+    trace_write_uint(mask);
+    trace_write_uint(filter);
+    trace_real.glBlitNamedFramebuffer(readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+
+static void trace_replay_glBlitNamedFramebuffer(struct trace_reader *reader) {
+    if (!__glBlitNamedFramebuffer) {
+        trace_missing(reader, TRACE_glBlitNamedFramebuffer);
+        return;
+    }
+    GLuint readFramebuffer = trace_name(reader, TRACE_NAME_FRAMEBUFFER, (GLuint)trace_read_uint(reader));
+    GLuint drawFramebuffer = trace_name(reader, TRACE_NAME_FRAMEBUFFER, (GLuint)trace_read_uint(reader));
+    GLint srcX0 = (GLint)trace_read_int(reader);
+    GLint srcY0 = (GLint)trace_read_int(reader);
+    GLint srcX1 = (GLint)trace_read_int(reader);
+    GLint srcY1 = (GLint)trace_read_int(reader);
+    GLint dstX0 = (GLint)trace_read_int(reader);
+    GLint dstY0 = (GLint)trace_read_int(reader);
+    GLint dstX1 = (GLint)trace_read_int(reader);
+    GLint dstY1 = (GLint)trace_read_int(reader);
+    GLbitfield mask = (GLbitfield)trace_read_uint(reader);
+    GLenum filter = (GLenum)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glBlitNamedFramebuffer(readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+
+static void APIENTRY trace_glCreateRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+    trace_command(TRACE_glCreateRenderbuffers);
+    trace_write_int(n);
+    trace_real.glCreateRenderbuffers(n, renderbuffers);
+    trace_write_array(renderbuffers, (size_t)(n), sizeof(GLuint));
+}
+
+static void trace_replay_glCreateRenderbuffers(struct trace_reader *reader) {
+    if (!__glCreateRenderbuffers) {
+        trace_missing(reader, TRACE_glCreateRenderbuffers);
+        return;
+    }
+    GLsizei n = (GLsizei)trace_read_int(reader);
+    GLuint *renderbuffers = trace_scratch(reader, (size_t)(n) * sizeof(GLuint));
+    if (reader->error)
+        return;
+    __glCreateRenderbuffers(n, renderbuffers);
+    trace_map_names(reader, TRACE_NAME_RENDERBUFFER, renderbuffers, (size_t)(n));
+}
+
+static void APIENTRY trace_glNamedRenderbufferStorage(GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height) {
+    trace_command(TRACE_glNamedRenderbufferStorage);
+    trace_write_uint(renderbuffer);
+    trace_write_uint(internalformat);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_real.glNamedRenderbufferStorage(renderbuffer, internalformat, width, height);
+}
+
+static void trace_replay_glNamedRenderbufferStorage(struct trace_reader *reader) {
+    if (!__glNamedRenderbufferStorage) {
+        trace_missing(reader, TRACE_glNamedRenderbufferStorage);
+        return;
+    }
+    GLuint renderbuffer = trace_name(reader, TRACE_NAME_RENDERBUFFER, (GLuint)trace_read_uint(reader));
+    GLenum internalformat = (GLenum)trace_read_uint(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glNamedRenderbufferStorage(renderbuffer, internalformat, width, height);
+}
+
+static void APIENTRY trace_glNamedRenderbufferStorageMultisample(GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+    trace_command(TRACE_glNamedRenderbufferStorageMultisample);
+    trace_write_uint(renderbuffer);
+    trace_write_int(samples);
+    trace_write_uint(internalformat);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_real.glNamedRenderbufferStorageMultisample(renderbuffer, samples, internalformat, width, height);
+}
+
+static void trace_replay_glNamedRenderbufferStorageMultisample(struct trace_reader *reader) {
+    if (!__glNamedRenderbufferStorageMultisample) {
+        trace_missing(reader, TRACE_glNamedRenderbufferStorageMultisample);
+        return;
+    }
+    GLuint renderbuffer = trace_name(reader, TRACE_NAME_RENDERBUFFER, (GLuint)trace_read_uint(reader));
+    GLsizei samples = (GLsizei)trace_read_int(reader);
+    GLenum internalformat = (GLenum)trace_read_uint(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glNamedRenderbufferStorageMultisample(renderbuffer, samples, internalformat, width, height);
+}
+
+static void APIENTRY trace_glCreateTextures(GLenum target, GLsizei n, GLuint *textures) {
+    trace_command(TRACE_glCreateTextures);
+    trace_write_uint(target);
+    trace_write_int(n);
+    trace_real.glCreateTextures(target, n, textures);
+    trace_write_array(textures, (size_t)(n), sizeof(GLuint));
+}
+
+static void trace_replay_glCreateTextures(struct trace_reader *reader) {
+    if (!__glCreateTextures) {
+        trace_missing(reader, TRACE_glCreateTextures);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLsizei n = (GLsizei)trace_read_int(reader);
+    GLuint *textures = trace_scratch(reader, (size_t)(n) * sizeof(GLuint));
+    if (reader->error)
+        return;
+    __glCreateTextures(target, n, textures);
+    trace_map_names(reader, TRACE_NAME_TEXTURE, textures, (size_t)(n));
+}
+
+static void APIENTRY trace_glTextureBuffer(GLuint texture, GLenum internalformat, GLuint buffer) {
+    trace_command(TRACE_glTextureBuffer);
+    trace_write_uint(texture);
+    trace_write_uint(internalformat);
+    trace_write_uint(buffer);
+    trace_real.glTextureBuffer(texture, internalformat, buffer);
+}
+
+static void trace_replay_glTextureBuffer(struct trace_reader *reader) {
+    if (!__glTextureBuffer) {
+        trace_missing(reader, TRACE_glTextureBuffer);
+        return;
+    }
+    GLuint texture = trace_name(reader, TRACE_NAME_TEXTURE, (GLuint)trace_read_uint(reader));
+    GLenum internalformat = (GLenum)trace_read_uint(reader);
+    GLuint buffer = trace_name(reader, TRACE_NAME_BUFFER, (GLuint)trace_read_uint(reader));
+    if (reader->error)
+        return;
+    __glTextureBuffer(texture, internalformat, buffer);
+}
+
+static void APIENTRY trace_glTextureBufferRange(GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    trace_command(TRACE_glTextureBufferRange);
+    trace_write_uint(texture);
+    trace_write_uint(internalformat);
+    trace_write_uint(buffer);
+    trace_write_int(offset);
+    trace_write_int(size);
+    trace_real.glTextureBufferRange(texture, internalformat, buffer, offset, size);
+}
+
+static void trace_replay_glTextureBufferRange(struct trace_reader *reader) {
+    if (!__glTextureBufferRange) {
+        trace_missing(reader, TRACE_glTextureBufferRange);
+        return;
+    }
+    GLuint texture = trace_name(reader, TRACE_NAME_TEXTURE, (GLuint)trace_read_uint(reader));
+    GLenum internalformat = (GLenum)trace_read_uint(reader);
+    GLuint buffer = trace_name(reader, TRACE_NAME_BUFFER, (GLuint)trace_read_uint(reader));
+    GLintptr offset = (GLintptr)trace_read_int(reader);
+    GLsizeiptr size = (GLsizeiptr)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glTextureBufferRange(texture, internalformat, buffer, offset, size);
+}
+
+static void APIENTRY trace_glTextureStorage1D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width) {
+    trace_command(TRACE_glTextureStorage1D);
+    trace_write_uint(texture);
+    trace_write_int(levels);
+    trace_write_uint(internalformat);
+    trace_write_int(width);
+    trace_real.glTextureStorage1D(texture, levels, internalformat, width);
+}
+
+static void trace_replay_glTextureStorage1D(struct trace_reader *reader) {
+    if (!__glTextureStorage1D) {
+        trace_missing(reader, TRACE_glTextureStorage1D);
+        return;
+    }
+    GLuint texture = trace_name(reader, TRACE_NAME_TEXTURE, (GLuint)trace_read_uint(reader));
+    GLsizei levels = (GLsizei)trace_read_int(reader);
+    GLenum internalformat = (GLenum)trace_read_uint(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glTextureStorage1D(texture, levels, internalformat, width);
+}
+
+static void APIENTRY trace_glTextureStorage2D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+    trace_command(TRACE_glTextureStorage2D);
+    trace_write_uint(texture);
+    trace_write_int(levels);
+    trace_write_uint(internalformat);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_real.glTextureStorage2D(texture, levels, internalformat, width, height);
+}
+
+static void trace_replay_glTextureStorage2D(struct trace_reader *reader) {
+    if (!__glTextureStorage2D) {
+        trace_missing(reader, TRACE_glTextureStorage2D);
+        return;
+    }
+    GLuint texture = trace_name(reader, TRACE_NAME_TEXTURE, (GLuint)trace_read_uint(reader));
+    GLsizei levels = (GLsizei)trace_read_int(reader);
+    GLenum internalformat = (GLenum)trace_read_uint(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glTextureStorage2D(texture, levels, internalformat, width, height);
+}
+
+static void APIENTRY trace_glTextureStorage3D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+    trace_command(TRACE_glTextureStorage3D);
+    trace_write_uint(texture);
+    trace_write_int(levels);
+    trace_write_uint(internalformat);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_write_int(depth);
+    trace_real.glTextureStorage3D(texture, levels, internalformat, width, height, depth);
+}
+
+static void trace_replay_glTextureStorage3D(struct trace_reader *reader) {
+    if (!__glTextureStorage3D) {
+        trace_missing(reader, TRACE_glTextureStorage3D);
+        return;
+    }
+    GLuint texture = trace_name(reader, TRACE_NAME_TEXTURE, (GLuint)trace_read_uint(reader));
+    GLsizei levels = (GLsizei)trace_read_int(reader);
+    GLenum internalformat = (GLenum)trace_read_uint(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    GLsizei depth = (GLsizei)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glTextureStorage3D(texture, levels, internalformat, width, height, depth);
+}
+
+static void APIENTRY trace_glTextureStorage2DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+    trace_command(TRACE_glTextureStorage2DMultisample);
+    trace_write_uint(texture);
+    trace_write_int(samples);
+    trace_write_uint(internalformat);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_write_uint(fixedsamplelocations);
+    trace_real.glTextureStorage2DMultisample(texture, samples, internalformat, width, height, fixedsamplelocations);
+}
+
+static void trace_replay_glTextureStorage2DMultisample(struct trace_reader *reader) {
+    if (!__glTextureStorage2DMultisample) {
+        trace_missing(reader, TRACE_glTextureStorage2DMultisample);
+        return;
+    }
+    GLuint texture = trace_name(reader, TRACE_NAME_TEXTURE, (GLuint)trace_read_uint(reader));
+    GLsizei samples = (GLsizei)trace_read_int(reader);
+    GLenum internalformat = (GLenum)trace_read_uint(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    GLboolean fixedsamplelocations = (GLboolean)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glTextureStorage2DMultisample(texture, samples, internalformat, width, height, fixedsamplelocations);
+}
+
+static void APIENTRY trace_glTextureStorage3DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+    trace_command(TRACE_glTextureStorage3DMultisample);
+    trace_write_uint(texture);
+    trace_write_int(samples);
+    trace_write_uint(internalformat);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_write_int(depth);
+    trace_write_uint(fixedsamplelocations);
+    trace_real.glTextureStorage3DMultisample(texture, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+
+static void trace_replay_glTextureStorage3DMultisample(struct trace_reader *reader) {
+    if (!__glTextureStorage3DMultisample) {
+        trace_missing(reader, TRACE_glTextureStorage3DMultisample);
+        return;
+    }
+    GLuint texture = trace_name(reader, TRACE_NAME_TEXTURE, (GLuint)trace_read_uint(reader));
+    GLsizei samples = (GLsizei)trace_read_int(reader);
+    GLenum internalformat = (GLenum)trace_read_uint(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    GLsizei depth = (GLsizei)trace_read_int(reader);
+    GLboolean fixedsamplelocations = (GLboolean)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glTextureStorage3DMultisample(texture, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+
+static void APIENTRY trace_glTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+    trace_command(TRACE_glTextureSubImage1D);
+    trace_write_uint(texture);
+    trace_write_int(level);
+    trace_write_int(xoffset);
+    trace_write_int(width);
+    trace_write_uint(format);
+    trace_write_uint(type);
+    trace_write_unpack(pixels, trace_pixels_span(format, type, width, 1, 1, false));
+    trace_real.glTextureSubImage1D(texture, level, xoffset, width, format, type, pixels);
+}
+
+static void trace_replay_glTextureSubImage1D(struct trace_reader *reader) {
+    if (!__glTextureSubImage1D) {
+        trace_missing(reader, TRACE_glTextureSubImage1D);
+        return;
+    }
+    GLuint texture = trace_name(reader, TRACE_NAME_TEXTURE, (GLuint)trace_read_uint(reader));
+    GLint level = (GLint)trace_read_int(reader);
+    GLint xoffset = (GLint)trace_read_int(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLenum format = (GLenum)trace_read_uint(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const void *pixels = trace_read_unpack(reader);
+    if (reader->error)
+        return;
+    __glTextureSubImage1D(texture, level, xoffset, width, format, type, pixels);
+}
+
+static void APIENTRY trace_glTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+    trace_command(TRACE_glTextureSubImage2D);
+    trace_write_uint(texture);
+    trace_write_int(level);
+    trace_write_int(xoffset);
+    trace_write_int(yoffset);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_write_uint(format);
+    trace_write_uint(type);
+    trace_write_unpack(pixels, trace_pixels_span(format, type, width, height, 1, false));
+    trace_real.glTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+
+static void trace_replay_glTextureSubImage2D(struct trace_reader *reader) {
+    if (!__glTextureSubImage2D) {
+        trace_missing(reader, TRACE_glTextureSubImage2D);
+        return;
+    }
+    GLuint texture = trace_name(reader, TRACE_NAME_TEXTURE, (GLuint)trace_read_uint(reader));
+    GLint level = (GLint)trace_read_int(reader);
+    GLint xoffset = (GLint)trace_read_int(reader);
+    GLint yoffset = (GLint)trace_read_int(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    GLenum format = (GLenum)trace_read_uint(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const void *pixels = trace_read_unpack(reader);
+    if (reader->error)
+        return;
+    __glTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+
+static void APIENTRY trace_glTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+    trace_command(TRACE_glTextureSubImage3D);
+    trace_write_uint(texture);
+    trace_write_int(level);
+    trace_write_int(xoffset);
+    trace_write_int(yoffset);
+    trace_write_int(zoffset);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_write_int(depth);
+    trace_write_uint(format);
+    trace_write_uint(type);
+    trace_write_unpack(pixels, trace_pixels_span(format, type, width, height, depth, false));
+    trace_real.glTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+
+static void trace_replay_glTextureSubImage3D(struct trace_reader *reader) {
+    if (!__glTextureSubImage3D) {
+        trace_missing(reader, TRACE_glTextureSubImage3D);
+        return;
+    }
+    GLuint texture = trace_name(reader, TRACE_NAME_TEXTURE, (GLuint)trace_read_uint(reader));
+    GLint level = (GLint)trace_read_int(reader);
+    GLint xoffset = (GLint)trace_read_int(reader);
+    GLint yoffset = (GLint)trace_read_int(reader);
+    GLint zoffset = (GLint)trace_read_int(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    GLsizei depth = (GLsizei)trace_read_int(reader);
+    GLenum format = (GLenum)trace_read_uint(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const void *pixels = trace_read_unpack(reader);
+    if (reader->error)
+        return;
+    __glTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+
+static void APIENTRY trace_glCompressedTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+    trace_command(TRACE_glCompressedTextureSubImage1D);
+    trace_write_uint(texture);
+    trace_write_int(level);
+    trace_write_int(xoffset);
+    trace_write_int(width);
+    trace_write_uint(format);
+    trace_write_int(imageSize);
+    trace_write_unpack(data, (size_t)imageSize);
+    trace_real.glCompressedTextureSubImage1D(texture, level, xoffset, width, format, imageSize, data);
+}
+
+static void trace_replay_glCompressedTextureSubImage1D(struct trace_reader *reader) {
+    if (!__glCompressedTextureSubImage1D) {
+        trace_missing(reader, TRACE_glCompressedTextureSubImage1D);
+        return;
+    }
+    GLuint texture = trace_name(reader, TRACE_NAME_TEXTURE, (GLuint)trace_read_uint(reader));
+    GLint level = (GLint)trace_read_int(reader);
+    GLint xoffset = (GLint)trace_read_int(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLenum format = (GLenum)trace_read_uint(reader);
+    GLsizei imageSize = (GLsizei)trace_read_int(reader);
+    const void *data = trace_read_unpack(reader);
+    if (reader->error)
+        return;
+    __glCompressedTextureSubImage1D(texture, level, xoffset, width, format, imageSize, data);
+}
+
+static void APIENTRY trace_glCompressedTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+    trace_command(TRACE_glCompressedTextureSubImage2D);
+    trace_write_uint(texture);
+    trace_write_int(level);
+    trace_write_int(xoffset);
+    trace_write_int(yoffset);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_write_uint(format);
+    trace_write_int(imageSize);
+    trace_write_unpack(data, (size_t)imageSize);
+    trace_real.glCompressedTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+
+static void trace_replay_glCompressedTextureSubImage2D(struct trace_reader *reader) {
+    if (!__glCompressedTextureSubImage2D) {
+        trace_missing(reader, TRACE_glCompressedTextureSubImage2D);
+        return;
+    }
+    GLuint texture = trace_name(reader, TRACE_NAME_TEXTURE, (GLuint)trace_read_uint(reader));
+    GLint level = (GLint)trace_read_int(reader);
+    GLint xoffset = (GLint)trace_read_int(reader);
+    GLint yoffset = (GLint)trace_read_int(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    GLenum format = (GLenum)trace_read_uint(reader);
+    GLsizei imageSize = (GLsizei)trace_read_int(reader);
+    const void *data = trace_read_unpack(reader);
+    if (reader->error)
+        return;
+    __glCompressedTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+
+static void APIENTRY trace_glCompressedTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+    trace_command(TRACE_glCompressedTextureSubImage3D);
+    trace_write_uint(texture);
+    trace_write_int(level);
+    trace_write_int(xoffset);
+    trace_write_int(yoffset);
+    trace_write_int(zoffset);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_write_int(depth);
+    trace_write_uint(format);
+    trace_write_int(imageSize);
+    trace_write_unpack(data, (size_t)imageSize);
+    trace_real.glCompressedTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+
+static void trace_replay_glCompressedTextureSubImage3D(struct trace_reader *reader) {
+    if (!__glCompressedTextureSubImage3D) {
+        trace_missing(reader, TRACE_glCompressedTextureSubImage3D);
+        return;
+    }
+    GLuint texture = trace_name(reader, TRACE_NAME_TEXTURE, (GLuint)trace_read_uint(reader));
+    GLint level = (GLint)trace_read_int(reader);
+    GLint xoffset = (GLint)trace_read_int(reader);
+    GLint yoffset = (GLint)trace_read_int(reader);
+    GLint zoffset = (GLint)trace_read_int(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    GLsizei depth = (GLsizei)trace_read_int(reader);
+    GLenum format = (GLenum)trace_read_uint(reader);
+    GLsizei imageSize = (GLsizei)trace_read_int(reader);
+    const void *data = trace_read_unpack(reader);
+    if (reader->error)
+        return;
+    __glCompressedTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+
+static void APIENTRY trace_glCopyTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+    trace_command(TRACE_glCopyTextureSubImage1D);
+    trace_write_uint(texture);
+    trace_write_int(level);
+    trace_write_int(xoffset);
+    trace_write_int(x);
+    trace_write_int(y);
+    trace_write_int(width);
+    trace_real.glCopyTextureSubImage1D(texture, level, xoffset, x, y, width);
+}
+
+static void trace_replay_glCopyTextureSubImage1D(struct trace_reader *reader) {
+    if (!__glCopyTextureSubImage1D) {
+        trace_missing(reader, TRACE_glCopyTextureSubImage1D);
+        return;
+    }
+    GLuint texture = trace_name(reader, TRACE_NAME_TEXTURE, (GLuint)trace_read_uint(reader));
+    GLint level = (GLint)trace_read_int(reader);
+    GLint xoffset = (GLint)trace_read_int(reader);
+    GLint x = (GLint)trace_read_int(reader);
+    GLint y = (GLint)trace_read_int(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glCopyTextureSubImage1D(texture, level, xoffset, x, y, width);
+}
+
+static void APIENTRY trace_glCopyTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    trace_command(TRACE_glCopyTextureSubImage2D);
+    trace_write_uint(texture);
+    trace_write_int(level);
+    trace_write_int(xoffset);
+    trace_write_int(yoffset);
+    trace_write_int(x);
+    trace_write_int(y);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_real.glCopyTextureSubImage2D(texture, level, xoffset, yoffset, x, y, width, height);
+}
+
+static void trace_replay_glCopyTextureSubImage2D(struct trace_reader *reader) {
+    if (!__glCopyTextureSubImage2D) {
+        trace_missing(reader, TRACE_glCopyTextureSubImage2D);
+        return;
+    }
+    GLuint texture = trace_name(reader, TRACE_NAME_TEXTURE, (GLuint)trace_read_uint(reader));
+    GLint level = (GLint)trace_read_int(reader);
+    GLint xoffset = (GLint)trace_read_int(reader);
+    GLint yoffset = (GLint)trace_read_int(reader);
+    GLint x = (GLint)trace_read_int(reader);
+    GLint y = (GLint)trace_read_int(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glCopyTextureSubImage2D(texture, level, xoffset, yoffset, x, y, width, height);
+}
+
+static void APIENTRY trace_glCopyTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    trace_command(TRACE_glCopyTextureSubImage3D);
+    trace_write_uint(texture);
+    trace_write_int(level);
+    trace_write_int(xoffset);
+    trace_write_int(yoffset);
+    trace_write_int(zoffset);
+    trace_write_int(x);
+    trace_write_int(y);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_real.glCopyTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+
+static void trace_replay_glCopyTextureSubImage3D(struct trace_reader *reader) {
+    if (!__glCopyTextureSubImage3D) {
+        trace_missing(reader, TRACE_glCopyTextureSubImage3D);
+        return;
+    }
+    GLuint texture = trace_name(reader, TRACE_NAME_TEXTURE, (GLuint)trace_read_uint(reader));
+    GLint level = (GLint)trace_read_int(reader);
+    GLint xoffset = (GLint)trace_read_int(reader);
+    GLint yoffset = (GLint)trace_read_int(reader);
+    GLint zoffset = (GLint)trace_read_int(reader);
+    GLint x = (GLint)trace_read_int(reader);
+    GLint y = (GLint)trace_read_int(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glCopyTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+
+static void APIENTRY trace_glTextureParameterf(GLuint texture, GLenum pname, GLfloat param) {
+    trace_command(TRACE_glTextureParameterf);
+    trace_write_uint(texture);
+    trace_write_uint(pname);
+    trace_write_float(param);
+    trace_real.glTextureParameterf(texture, pname, param);
+}
+
+static void trace_replay_glTextureParameterf(struct trace_reader *reader) {
+    if (!__glTextureParameterf) {
+        trace_missing(reader, TRACE_glTextureParameterf);
+        return;
+    }
+    GLuint texture = trace_name(reader, TRACE_NAME_TEXTURE, (GLuint)trace_read_uint(reader));
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    GLfloat param = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glTextureParameterf(texture, pname, param);
+}
+
+static void APIENTRY trace_glTextureParameterfv(GLuint texture, GLenum pname, const GLfloat *param) {
+    trace_command(TRACE_glTextureParameterfv);
+    trace_write_uint(texture);
+    trace_write_uint(pname);
+    trace_write_array(param, (size_t)(trace_pname_count(pname)), sizeof(GLfloat));
+    trace_real.glTextureParameterfv(texture, pname, param);
+}
+
+static void trace_replay_glTextureParameterfv(struct trace_reader *reader) {
+    if (!__glTextureParameterfv) {
+        trace_missing(reader, TRACE_glTextureParameterfv);
+        return;
+    }
+    GLuint texture = trace_name(reader, TRACE_NAME_TEXTURE, (GLuint)trace_read_uint(reader));
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    const GLfloat *param = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glTextureParameterfv(texture, pname, param);
+}
+
+static void APIENTRY trace_glTextureParameteri(GLuint texture, GLenum pname, GLint param) {
+    trace_command(TRACE_glTextureParameteri);
+    trace_write_uint(texture);
+    trace_write_uint(pname);
+    trace_write_int(param);
+    trace_real.glTextureParameteri(texture, pname, param);
+}
+
+static void trace_replay_glTextureParameteri(struct trace_reader *reader) {
+    if (!__glTextureParameteri) {
+        trace_missing(reader, TRACE_glTextureParameteri);
+        return;
+    }
+    GLuint texture = trace_name(reader, TRACE_NAME_TEXTURE, (GLuint)trace_read_uint(reader));
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    GLint param = (GLint)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glTextureParameteri(texture, pname, param);
+}
+
+static void APIENTRY trace_glTextureParameterIiv(GLuint texture, GLenum pname, const GLint *params) {
+    trace_command(TRACE_glTextureParameterIiv);
+    trace_write_uint(texture);
+    trace_write_uint(pname);
+    trace_write_array(params, (size_t)(trace_pname_count(pname)), sizeof(GLint));
+    trace_real.glTextureParameterIiv(texture, pname, params);
+}
+
+static void trace_replay_glTextureParameterIiv(struct trace_reader *reader) {
+    if (!__glTextureParameterIiv) {
+        trace_missing(reader, TRACE_glTextureParameterIiv);
+        return;
+    }
+    GLuint texture = trace_name(reader, TRACE_NAME_TEXTURE, (GLuint)trace_read_uint(reader));
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    const GLint *params = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glTextureParameterIiv(texture, pname, params);
+}
+
+static void APIENTRY trace_glTextureParameterIuiv(GLuint texture, GLenum pname, const GLuint *params) {
+    trace_command(TRACE_glTextureParameterIuiv);
+    trace_write_uint(texture);
+    trace_write_uint(pname);
+    trace_write_array(params, (size_t)(trace_pname_count(pname)), sizeof(GLuint));
+    trace_real.glTextureParameterIuiv(texture, pname, params);
+}
+
+static void trace_replay_glTextureParameterIuiv(struct trace_reader *reader) {
+    if (!__glTextureParameterIuiv) {
+        trace_missing(reader, TRACE_glTextureParameterIuiv);
+        return;
+    }
+    GLuint texture = trace_name(reader, TRACE_NAME_TEXTURE, (GLuint)trace_read_uint(reader));
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    const GLuint *params = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glTextureParameterIuiv(texture, pname, params);
+}
+
+static void APIENTRY trace_glTextureParameteriv(GLuint texture, GLenum pname, const GLint *param) {
+    trace_command(TRACE_glTextureParameteriv);
+    trace_write_uint(texture);
+    trace_write_uint(pname);
+    trace_write_array(param, (size_t)(trace_pname_count(pname)), sizeof(GLint));
+    trace_real.glTextureParameteriv(texture, pname, param);
+}
+
+static void trace_replay_glTextureParameteriv(struct trace_reader *reader) {
+    if (!__glTextureParameteriv) {
+        trace_missing(reader, TRACE_glTextureParameteriv);
+        return;
+    }
+    GLuint texture = trace_name(reader, TRACE_NAME_TEXTURE, (GLuint)trace_read_uint(reader));
+    GLenum pname = (GLenum)trace_read_uint(reader);
+    const GLint *param = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glTextureParameteriv(texture, pname, param);
+}
+
+static void APIENTRY trace_glGenerateTextureMipmap(GLuint texture) {
+    trace_command(TRACE_glGenerateTextureMipmap);
+    trace_write_uint(texture);
+    trace_real.glGenerateTextureMipmap(texture);
+}
+
+static void trace_replay_glGenerateTextureMipmap(struct trace_reader *reader) {
+    if (!__glGenerateTextureMipmap) {
+        trace_missing(reader, TRACE_glGenerateTextureMipmap);
+        return;
+    }
+    GLuint texture = trace_name(reader, TRACE_NAME_TEXTURE, (GLuint)trace_read_uint(reader));
+    if (reader->error)
+        return;
+    __glGenerateTextureMipmap(texture);
+}
+
+static void APIENTRY trace_glBindTextureUnit(GLuint unit, GLuint texture) {
+    trace_command(TRACE_glBindTextureUnit);
+    trace_write_uint(unit);
+    trace_write_uint(texture);
+    trace_real.glBindTextureUnit(unit, texture);
+}
+
+static void trace_replay_glBindTextureUnit(struct trace_reader *reader) {
+    if (!__glBindTextureUnit) {
+        trace_missing(reader, TRACE_glBindTextureUnit);
+        return;
+    }
+    GLuint unit = (GLuint)trace_read_uint(reader);
+    GLuint texture = trace_name(reader, TRACE_NAME_TEXTURE, (GLuint)trace_read_uint(reader));
+    if (reader->error)
+        return;
+    __glBindTextureUnit(unit, texture);
+}
+
+static void APIENTRY trace_glCreateVertexArrays(GLsizei n, GLuint *arrays) {
+    trace_command(TRACE_glCreateVertexArrays);
+    trace_write_int(n);
+    trace_real.glCreateVertexArrays(n, arrays);
+    trace_write_array(arrays, (size_t)(n), sizeof(GLuint));
+}
+
+static void trace_replay_glCreateVertexArrays(struct trace_reader *reader) {
+    if (!__glCreateVertexArrays) {
+        trace_missing(reader, TRACE_glCreateVertexArrays);
+        return;
+    }
+    GLsizei n = (GLsizei)trace_read_int(reader);
+    GLuint *arrays = trace_scratch(reader, (size_t)(n) * sizeof(GLuint));
+    if (reader->error)
+        return;
+    __glCreateVertexArrays(n, arrays);
+    trace_map_names(reader, TRACE_NAME_VERTEX_ARRAY, arrays, (size_t)(n));
+}
+
+static void APIENTRY trace_glDisableVertexArrayAttrib(GLuint vaobj, GLuint index) {
+    trace_command(TRACE_glDisableVertexArrayAttrib);
+    trace_write_uint(vaobj);
+    trace_write_uint(index);
+    trace_real.glDisableVertexArrayAttrib(vaobj, index);
+}
+
+static void trace_replay_glDisableVertexArrayAttrib(struct trace_reader *reader) {
+    if (!__glDisableVertexArrayAttrib) {
+        trace_missing(reader, TRACE_glDisableVertexArrayAttrib);
+        return;
+    }
+    GLuint vaobj = trace_name(reader, TRACE_NAME_VERTEX_ARRAY, (GLuint)trace_read_uint(reader));
+    GLuint index = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glDisableVertexArrayAttrib(vaobj, index);
+}
+
+static void APIENTRY trace_glEnableVertexArrayAttrib(GLuint vaobj, GLuint index) {
+    trace_command(TRACE_glEnableVertexArrayAttrib);
+    trace_write_uint(vaobj);
+    trace_write_uint(index);
+    trace_real.glEnableVertexArrayAttrib(vaobj, index);
+}
+
+static void trace_replay_glEnableVertexArrayAttrib(struct trace_reader *reader) {
+    if (!__glEnableVertexArrayAttrib) {
+        trace_missing(reader, TRACE_glEnableVertexArrayAttrib);
+        return;
+    }
+    GLuint vaobj = trace_name(reader, TRACE_NAME_VERTEX_ARRAY, (GLuint)trace_read_uint(reader));
+    GLuint index = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glEnableVertexArrayAttrib(vaobj, index);
+}
+
+static void APIENTRY trace_glVertexArrayElementBuffer(GLuint vaobj, GLuint buffer) {
+    trace_command(TRACE_glVertexArrayElementBuffer);
+    trace_write_uint(vaobj);
+    trace_write_uint(buffer);
+    trace_real.glVertexArrayElementBuffer(vaobj, buffer);
+}
+
+static void trace_replay_glVertexArrayElementBuffer(struct trace_reader *reader) {
+    if (!__glVertexArrayElementBuffer) {
+        trace_missing(reader, TRACE_glVertexArrayElementBuffer);
+        return;
+    }
+    GLuint vaobj = trace_name(reader, TRACE_NAME_VERTEX_ARRAY, (GLuint)trace_read_uint(reader));
+    GLuint buffer = trace_name(reader, TRACE_NAME_BUFFER, (GLuint)trace_read_uint(reader));
+    if (reader->error)
+        return;
+    __glVertexArrayElementBuffer(vaobj, buffer);
+}
+
+static void APIENTRY trace_glVertexArrayVertexBuffer(GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
+    trace_command(TRACE_glVertexArrayVertexBuffer);
+    trace_write_uint(vaobj);
+    trace_write_uint(bindingindex);
+    trace_write_uint(buffer);
+    trace_write_int(offset);
+    trace_write_int(stride);
+    trace_real.glVertexArrayVertexBuffer(vaobj, bindingindex, buffer, offset, stride);
+}
+
+static void trace_replay_glVertexArrayVertexBuffer(struct trace_reader *reader) {
+    if (!__glVertexArrayVertexBuffer) {
+        trace_missing(reader, TRACE_glVertexArrayVertexBuffer);
+        return;
+    }
+    GLuint vaobj = trace_name(reader, TRACE_NAME_VERTEX_ARRAY, (GLuint)trace_read_uint(reader));
+    GLuint bindingindex = (GLuint)trace_read_uint(reader);
+    GLuint buffer = trace_name(reader, TRACE_NAME_BUFFER, (GLuint)trace_read_uint(reader));
+    GLintptr offset = (GLintptr)trace_read_int(reader);
+    GLsizei stride = (GLsizei)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glVertexArrayVertexBuffer(vaobj, bindingindex, buffer, offset, stride);
+}
+
+static void APIENTRY trace_glVertexArrayVertexBuffers(GLuint vaobj, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides) {
+    trace_command(TRACE_glVertexArrayVertexBuffers);
+    trace_write_uint(vaobj);
+    trace_write_uint(first);
+    trace_write_int(count);
+    trace_write_array(buffers, (size_t)(count), sizeof(GLuint));
+    trace_write_array(offsets, (size_t)(count), sizeof(GLintptr));
+    trace_write_array(strides, (size_t)(count), sizeof(GLsizei));
+    trace_real.glVertexArrayVertexBuffers(vaobj, first, count, buffers, offsets, strides);
+}
+
+static void trace_replay_glVertexArrayVertexBuffers(struct trace_reader *reader) {
+    if (!__glVertexArrayVertexBuffers) {
+        trace_missing(reader, TRACE_glVertexArrayVertexBuffers);
+        return;
+    }
+    GLuint vaobj = trace_name(reader, TRACE_NAME_VERTEX_ARRAY, (GLuint)trace_read_uint(reader));
+    GLuint first = (GLuint)trace_read_uint(reader);
+    GLsizei count = (GLsizei)trace_read_int(reader);
+    const GLuint *buffers = trace_read_names(reader, TRACE_NAME_BUFFER);
+    const GLintptr *offsets = trace_read_array(reader);
+    const GLsizei *strides = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glVertexArrayVertexBuffers(vaobj, first, count, buffers, offsets, strides);
+}
+
+static void APIENTRY trace_glVertexArrayAttribBinding(GLuint vaobj, GLuint attribindex, GLuint bindingindex) {
+    trace_command(TRACE_glVertexArrayAttribBinding);
+    trace_write_uint(vaobj);
+    trace_write_uint(attribindex);
+    trace_write_uint(bindingindex);
+    trace_real.glVertexArrayAttribBinding(vaobj, attribindex, bindingindex);
+}
+
+static void trace_replay_glVertexArrayAttribBinding(struct trace_reader *reader) {
+    if (!__glVertexArrayAttribBinding) {
+        trace_missing(reader, TRACE_glVertexArrayAttribBinding);
+        return;
+    }
+    GLuint vaobj = trace_name(reader, TRACE_NAME_VERTEX_ARRAY, (GLuint)trace_read_uint(reader));
+    GLuint attribindex = (GLuint)trace_read_uint(reader);
+    GLuint bindingindex = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glVertexArrayAttribBinding(vaobj, attribindex, bindingindex);
+}
+
+static void APIENTRY trace_glVertexArrayAttribFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
+    trace_command(TRACE_glVertexArrayAttribFormat);
+    trace_write_uint(vaobj);
+    trace_write_uint(attribindex);
+    trace_write_int(size);
+    trace_write_uint(type);
+    trace_write_uint(normalized);
+    trace_write_uint(relativeoffset);
+    trace_real.glVertexArrayAttribFormat(vaobj, attribindex, size, type, normalized, relativeoffset);
+}
+
+static void trace_replay_glVertexArrayAttribFormat(struct trace_reader *reader) {
+    if (!__glVertexArrayAttribFormat) {
+        trace_missing(reader, TRACE_glVertexArrayAttribFormat);
+        return;
+    }
+    GLuint vaobj = trace_name(reader, TRACE_NAME_VERTEX_ARRAY, (GLuint)trace_read_uint(reader));
+    GLuint attribindex = (GLuint)trace_read_uint(reader);
+    GLint size = (GLint)trace_read_int(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLboolean normalized = (GLboolean)trace_read_uint(reader);
+    GLuint relativeoffset = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glVertexArrayAttribFormat(vaobj, attribindex, size, type, normalized, relativeoffset);
+}
+
+static void APIENTRY trace_glVertexArrayAttribIFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+    trace_command(TRACE_glVertexArrayAttribIFormat);
+    trace_write_uint(vaobj);
+    trace_write_uint(attribindex);
+    trace_write_int(size);
+    trace_write_uint(type);
+    trace_write_uint(relativeoffset);
+    trace_real.glVertexArrayAttribIFormat(vaobj, attribindex, size, type, relativeoffset);
+}
+
+static void trace_replay_glVertexArrayAttribIFormat(struct trace_reader *reader) {
+    if (!__glVertexArrayAttribIFormat) {
+        trace_missing(reader, TRACE_glVertexArrayAttribIFormat);
+        return;
+    }
+    GLuint vaobj = trace_name(reader, TRACE_NAME_VERTEX_ARRAY, (GLuint)trace_read_uint(reader));
+    GLuint attribindex = (GLuint)trace_read_uint(reader);
+    GLint size = (GLint)trace_read_int(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLuint relativeoffset = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glVertexArrayAttribIFormat(vaobj, attribindex, size, type, relativeoffset);
+}
+
+static void APIENTRY trace_glVertexArrayAttribLFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+    trace_command(TRACE_glVertexArrayAttribLFormat);
+    trace_write_uint(vaobj);
+    trace_write_uint(attribindex);
+    trace_write_int(size);
+    trace_write_uint(type);
+    trace_write_uint(relativeoffset);
+    trace_real.glVertexArrayAttribLFormat(vaobj, attribindex, size, type, relativeoffset);
+}
+
+static void trace_replay_glVertexArrayAttribLFormat(struct trace_reader *reader) {
+    if (!__glVertexArrayAttribLFormat) {
+        trace_missing(reader, TRACE_glVertexArrayAttribLFormat);
+        return;
+    }
+    GLuint vaobj = trace_name(reader, TRACE_NAME_VERTEX_ARRAY, (GLuint)trace_read_uint(reader));
+    GLuint attribindex = (GLuint)trace_read_uint(reader);
+    GLint size = (GLint)trace_read_int(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLuint relativeoffset = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glVertexArrayAttribLFormat(vaobj, attribindex, size, type, relativeoffset);
+}
+
+static void APIENTRY trace_glVertexArrayBindingDivisor(GLuint vaobj, GLuint bindingindex, GLuint divisor) {
+    trace_command(TRACE_glVertexArrayBindingDivisor);
+    trace_write_uint(vaobj);
+    trace_write_uint(bindingindex);
+    trace_write_uint(divisor);
+    trace_real.glVertexArrayBindingDivisor(vaobj, bindingindex, divisor);
+}
+
+static void trace_replay_glVertexArrayBindingDivisor(struct trace_reader *reader) {
+    if (!__glVertexArrayBindingDivisor) {
+        trace_missing(reader, TRACE_glVertexArrayBindingDivisor);
+        return;
+    }
+    GLuint vaobj = trace_name(reader, TRACE_NAME_VERTEX_ARRAY, (GLuint)trace_read_uint(reader));
+    GLuint bindingindex = (GLuint)trace_read_uint(reader);
+    GLuint divisor = (GLuint)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glVertexArrayBindingDivisor(vaobj, bindingindex, divisor);
+}
+
+static void APIENTRY trace_glCreateSamplers(GLsizei n, GLuint *samplers) {
+    trace_command(TRACE_glCreateSamplers);
+    trace_write_int(n);
+    trace_real.glCreateSamplers(n, samplers);
+    trace_write_array(samplers, (size_t)(n), sizeof(GLuint));
+}
+
+static void trace_replay_glCreateSamplers(struct trace_reader *reader) {
+    if (!__glCreateSamplers) {
+        trace_missing(reader, TRACE_glCreateSamplers);
+        return;
+    }
+    GLsizei n = (GLsizei)trace_read_int(reader);
+    GLuint *samplers = trace_scratch(reader, (size_t)(n) * sizeof(GLuint));
+    if (reader->error)
+        return;
+    __glCreateSamplers(n, samplers);
+    trace_map_names(reader, TRACE_NAME_SAMPLER, samplers, (size_t)(n));
+}
+
+static void APIENTRY trace_glCreateProgramPipelines(GLsizei n, GLuint *pipelines) {
+    trace_command(TRACE_glCreateProgramPipelines);
+    trace_write_int(n);
+    trace_real.glCreateProgramPipelines(n, pipelines);
+    trace_write_array(pipelines, (size_t)(n), sizeof(GLuint));
+}
+
+static void trace_replay_glCreateProgramPipelines(struct trace_reader *reader) {
+    if (!__glCreateProgramPipelines) {
+        trace_missing(reader, TRACE_glCreateProgramPipelines);
+        return;
+    }
+    GLsizei n = (GLsizei)trace_read_int(reader);
+    GLuint *pipelines = trace_scratch(reader, (size_t)(n) * sizeof(GLuint));
+    if (reader->error)
+        return;
+    __glCreateProgramPipelines(n, pipelines);
+    trace_map_names(reader, TRACE_NAME_PROGRAM_PIPELINE, pipelines, (size_t)(n));
+}
+
+static void APIENTRY trace_glCreateQueries(GLenum target, GLsizei n, GLuint *ids) {
+    trace_command(TRACE_glCreateQueries);
+    trace_write_uint(target);
+    trace_write_int(n);
+    trace_real.glCreateQueries(target, n, ids);
+    trace_write_array(ids, (size_t)(n), sizeof(GLuint));
+}
+
+static void trace_replay_glCreateQueries(struct trace_reader *reader) {
+    if (!__glCreateQueries) {
+        trace_missing(reader, TRACE_glCreateQueries);
+        return;
+    }
+    GLenum target = (GLenum)trace_read_uint(reader);
+    GLsizei n = (GLsizei)trace_read_int(reader);
+    GLuint *ids = trace_scratch(reader, (size_t)(n) * sizeof(GLuint));
+    if (reader->error)
+        return;
+    __glCreateQueries(target, n, ids);
+    trace_map_names(reader, TRACE_NAME_QUERY, ids, (size_t)(n));
+}
+
+static void APIENTRY trace_glMemoryBarrierByRegion(GLbitfield barriers) {
+    trace_command(TRACE_glMemoryBarrierByRegion);
+    trace_write_uint(barriers);
+    trace_real.glMemoryBarrierByRegion(barriers);
+}
+
+static void trace_replay_glMemoryBarrierByRegion(struct trace_reader *reader) {
+    if (!__glMemoryBarrierByRegion) {
+        trace_missing(reader, TRACE_glMemoryBarrierByRegion);
+        return;
+    }
+    GLbitfield barriers = (GLbitfield)trace_read_uint(reader);
+    if (reader->error)
+        return;
+    __glMemoryBarrierByRegion(barriers);
+}
+
+static void APIENTRY trace_glReadnPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data) {
+    trace_command(TRACE_glReadnPixels);
+    trace_write_int(x);
+    trace_write_int(y);
+    trace_write_int(width);
+    trace_write_int(height);
+    trace_write_uint(format);
+    trace_write_uint(type);
+    trace_write_int(bufSize);
+    trace_write_pack(data, (size_t)bufSize);
+    trace_real.glReadnPixels(x, y, width, height, format, type, bufSize, data);
+}
+
+static void trace_replay_glReadnPixels(struct trace_reader *reader) {
+    if (!__glReadnPixels) {
+        trace_missing(reader, TRACE_glReadnPixels);
+        return;
+    }
+    GLint x = (GLint)trace_read_int(reader);
+    GLint y = (GLint)trace_read_int(reader);
+    GLsizei width = (GLsizei)trace_read_int(reader);
+    GLsizei height = (GLsizei)trace_read_int(reader);
+    GLenum format = (GLenum)trace_read_uint(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    GLsizei bufSize = (GLsizei)trace_read_int(reader);
+    void *data = trace_read_pack(reader);
+    if (reader->error)
+        return;
+    __glReadnPixels(x, y, width, height, format, type, bufSize, data);
+}
+
+static void APIENTRY trace_glTextureBarrier(void) {
+    trace_command(TRACE_glTextureBarrier);
+    trace_real.glTextureBarrier();
+}
+
+static void trace_replay_glTextureBarrier(struct trace_reader *reader) {
+    if (!__glTextureBarrier) {
+        trace_missing(reader, TRACE_glTextureBarrier);
+        return;
+    }
+    if (reader->error)
+        return;
+    __glTextureBarrier();
+}
+
+#endif
+
+#if FUNGL_VERSION >= GL_VERSION_4_6
+static void APIENTRY trace_glSpecializeShader(GLuint shader, const GLchar *pEntryPoint, GLuint numSpecializationConstants, const GLuint *pConstantIndex, const GLuint *pConstantValue) {
+    trace_command(TRACE_glSpecializeShader);
+    trace_write_uint(shader);
+    trace_write_string(pEntryPoint, -1);
+    trace_write_uint(numSpecializationConstants);
+    trace_write_array(pConstantIndex, (size_t)(numSpecializationConstants), sizeof(GLuint));
+    trace_write_array(pConstantValue, (size_t)(numSpecializationConstants), sizeof(GLuint));
+    trace_real.glSpecializeShader(shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue);
+}
+
+static void trace_replay_glSpecializeShader(struct trace_reader *reader) {
+    if (!__glSpecializeShader) {
+        trace_missing(reader, TRACE_glSpecializeShader);
+        return;
+    }
+    GLuint shader = trace_name(reader, TRACE_NAME_PROGRAM, (GLuint)trace_read_uint(reader));
+    const GLchar *pEntryPoint = trace_read_string(reader);
+    GLuint numSpecializationConstants = (GLuint)trace_read_uint(reader);
+    const GLuint *pConstantIndex = trace_read_array(reader);
+    const GLuint *pConstantValue = trace_read_array(reader);
+    if (reader->error)
+        return;
+    __glSpecializeShader(shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue);
+}
+
+static void APIENTRY trace_glMultiDrawArraysIndirectCount(GLenum mode, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride) {
+    trace_command(TRACE_glMultiDrawArraysIndirectCount);
+    trace_write_uint(mode);
+    trace_write_offset(indirect);
+    trace_write_int(drawcount);
+    trace_write_int(maxdrawcount);
+    trace_write_int(stride);
+    trace_real.glMultiDrawArraysIndirectCount(mode, indirect, drawcount, maxdrawcount, stride);
+}
+
+static void trace_replay_glMultiDrawArraysIndirectCount(struct trace_reader *reader) {
+    if (!__glMultiDrawArraysIndirectCount) {
+        trace_missing(reader, TRACE_glMultiDrawArraysIndirectCount);
+        return;
+    }
+    GLenum mode = (GLenum)trace_read_uint(reader);
+    const void *indirect = trace_read_offset(reader);
+    GLintptr drawcount = (GLintptr)trace_read_int(reader);
+    GLsizei maxdrawcount = (GLsizei)trace_read_int(reader);
+    GLsizei stride = (GLsizei)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glMultiDrawArraysIndirectCount(mode, indirect, drawcount, maxdrawcount, stride);
+}
+
+static void APIENTRY trace_glMultiDrawElementsIndirectCount(GLenum mode, GLenum type, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride) {
+    trace_command(TRACE_glMultiDrawElementsIndirectCount);
+    trace_write_uint(mode);
+    trace_write_uint(type);
+    trace_write_offset(indirect);
+    trace_write_int(drawcount);
+    trace_write_int(maxdrawcount);
+    trace_write_int(stride);
+    trace_real.glMultiDrawElementsIndirectCount(mode, type, indirect, drawcount, maxdrawcount, stride);
+}
+
+static void trace_replay_glMultiDrawElementsIndirectCount(struct trace_reader *reader) {
+    if (!__glMultiDrawElementsIndirectCount) {
+        trace_missing(reader, TRACE_glMultiDrawElementsIndirectCount);
+        return;
+    }
+    GLenum mode = (GLenum)trace_read_uint(reader);
+    GLenum type = (GLenum)trace_read_uint(reader);
+    const void *indirect = trace_read_offset(reader);
+    GLintptr drawcount = (GLintptr)trace_read_int(reader);
+    GLsizei maxdrawcount = (GLsizei)trace_read_int(reader);
+    GLsizei stride = (GLsizei)trace_read_int(reader);
+    if (reader->error)
+        return;
+    __glMultiDrawElementsIndirectCount(mode, type, indirect, drawcount, maxdrawcount, stride);
+}
+
+static void APIENTRY trace_glPolygonOffsetClamp(GLfloat factor, GLfloat units, GLfloat clamp) {
+    trace_command(TRACE_glPolygonOffsetClamp);
+    trace_write_float(factor);
+    trace_write_float(units);
+    trace_write_float(clamp);
+    trace_real.glPolygonOffsetClamp(factor, units, clamp);
+}
+
+static void trace_replay_glPolygonOffsetClamp(struct trace_reader *reader) {
+    if (!__glPolygonOffsetClamp) {
+        trace_missing(reader, TRACE_glPolygonOffsetClamp);
+        return;
+    }
+    GLfloat factor = trace_read_float(reader);
+    GLfloat units = trace_read_float(reader);
+    GLfloat clamp = trace_read_float(reader);
+    if (reader->error)
+        return;
+    __glPolygonOffsetClamp(factor, units, clamp);
+}
+
+#endif
+
+static void (*trace_replay_commands[TRACE_COMMAND_END - TRACE_FIRST_COMMAND])(struct trace_reader*) = {
+#if FUNGL_VERSION >= GL_VERSION_1_0
+    [TRACE_glCullFace - TRACE_FIRST_COMMAND] = trace_replay_glCullFace,
+    [TRACE_glFrontFace - TRACE_FIRST_COMMAND] = trace_replay_glFrontFace,
+    [TRACE_glHint - TRACE_FIRST_COMMAND] = trace_replay_glHint,
+    [TRACE_glLineWidth - TRACE_FIRST_COMMAND] = trace_replay_glLineWidth,
+    [TRACE_glPointSize - TRACE_FIRST_COMMAND] = trace_replay_glPointSize,
+    [TRACE_glPolygonMode - TRACE_FIRST_COMMAND] = trace_replay_glPolygonMode,
+    [TRACE_glScissor - TRACE_FIRST_COMMAND] = trace_replay_glScissor,
+    [TRACE_glTexParameterf - TRACE_FIRST_COMMAND] = trace_replay_glTexParameterf,
+    [TRACE_glTexParameterfv - TRACE_FIRST_COMMAND] = trace_replay_glTexParameterfv,
+    [TRACE_glTexParameteri - TRACE_FIRST_COMMAND] = trace_replay_glTexParameteri,
+    [TRACE_glTexParameteriv - TRACE_FIRST_COMMAND] = trace_replay_glTexParameteriv,
+    [TRACE_glTexImage1D - TRACE_FIRST_COMMAND] = trace_replay_glTexImage1D,
+    [TRACE_glTexImage2D - TRACE_FIRST_COMMAND] = trace_replay_glTexImage2D,
+    [TRACE_glDrawBuffer - TRACE_FIRST_COMMAND] = trace_replay_glDrawBuffer,
+    [TRACE_glClear - TRACE_FIRST_COMMAND] = trace_replay_glClear,
+    [TRACE_glClearColor - TRACE_FIRST_COMMAND] = trace_replay_glClearColor,
+    [TRACE_glClearStencil - TRACE_FIRST_COMMAND] = trace_replay_glClearStencil,
+    [TRACE_glClearDepth - TRACE_FIRST_COMMAND] = trace_replay_glClearDepth,
+    [TRACE_glStencilMask - TRACE_FIRST_COMMAND] = trace_replay_glStencilMask,
+    [TRACE_glColorMask - TRACE_FIRST_COMMAND] = trace_replay_glColorMask,
+    [TRACE_glDepthMask - TRACE_FIRST_COMMAND] = trace_replay_glDepthMask,
+    [TRACE_glDisable - TRACE_FIRST_COMMAND] = trace_replay_glDisable,
+    [TRACE_glEnable - TRACE_FIRST_COMMAND] = trace_replay_glEnable,
+    [TRACE_glFinish - TRACE_FIRST_COMMAND] = trace_replay_glFinish,
+    [TRACE_glFlush - TRACE_FIRST_COMMAND] = trace_replay_glFlush,
+    [TRACE_glBlendFunc - TRACE_FIRST_COMMAND] = trace_replay_glBlendFunc,
+    [TRACE_glLogicOp - TRACE_FIRST_COMMAND] = trace_replay_glLogicOp,
+    [TRACE_glStencilFunc - TRACE_FIRST_COMMAND] = trace_replay_glStencilFunc,
+    [TRACE_glStencilOp - TRACE_FIRST_COMMAND] = trace_replay_glStencilOp,
+    [TRACE_glDepthFunc - TRACE_FIRST_COMMAND] = trace_replay_glDepthFunc,
+    [TRACE_glPixelStoref - TRACE_FIRST_COMMAND] = trace_replay_glPixelStoref,
+    [TRACE_glPixelStorei - TRACE_FIRST_COMMAND] = trace_replay_glPixelStorei,
+    [TRACE_glReadBuffer - TRACE_FIRST_COMMAND] = trace_replay_glReadBuffer,
+    [TRACE_glReadPixels - TRACE_FIRST_COMMAND] = trace_replay_glReadPixels,
+    [TRACE_glDepthRange - TRACE_FIRST_COMMAND] = trace_replay_glDepthRange,
+    [TRACE_glViewport - TRACE_FIRST_COMMAND] = trace_replay_glViewport,
+    [TRACE_glNewList - TRACE_FIRST_COMMAND] = trace_replay_glNewList,
+    [TRACE_glEndList - TRACE_FIRST_COMMAND] = trace_replay_glEndList,
+    [TRACE_glCallList - TRACE_FIRST_COMMAND] = trace_replay_glCallList,
+    [TRACE_glCallLists - TRACE_FIRST_COMMAND] = trace_replay_glCallLists,
+    [TRACE_glDeleteLists - TRACE_FIRST_COMMAND] = trace_replay_glDeleteLists,
+    [TRACE_glGenLists - TRACE_FIRST_COMMAND] = trace_replay_glGenLists,
+    [TRACE_glListBase - TRACE_FIRST_COMMAND] = trace_replay_glListBase,
+    [TRACE_glBegin - TRACE_FIRST_COMMAND] = trace_replay_glBegin,
+    [TRACE_glBitmap - TRACE_FIRST_COMMAND] = trace_replay_glBitmap,
+    [TRACE_glColor3b - TRACE_FIRST_COMMAND] = trace_replay_glColor3b,
+    [TRACE_glColor3bv - TRACE_FIRST_COMMAND] = trace_replay_glColor3bv,
+    [TRACE_glColor3d - TRACE_FIRST_COMMAND] = trace_replay_glColor3d,
+    [TRACE_glColor3dv - TRACE_FIRST_COMMAND] = trace_replay_glColor3dv,
+    [TRACE_glColor3f - TRACE_FIRST_COMMAND] = trace_replay_glColor3f,
+    [TRACE_glColor3fv - TRACE_FIRST_COMMAND] = trace_replay_glColor3fv,
+    [TRACE_glColor3i - TRACE_FIRST_COMMAND] = trace_replay_glColor3i,
+    [TRACE_glColor3iv - TRACE_FIRST_COMMAND] = trace_replay_glColor3iv,
+    [TRACE_glColor3s - TRACE_FIRST_COMMAND] = trace_replay_glColor3s,
+    [TRACE_glColor3sv - TRACE_FIRST_COMMAND] = trace_replay_glColor3sv,
+    [TRACE_glColor3ub - TRACE_FIRST_COMMAND] = trace_replay_glColor3ub,
+    [TRACE_glColor3ubv - TRACE_FIRST_COMMAND] = trace_replay_glColor3ubv,
+    [TRACE_glColor3ui - TRACE_FIRST_COMMAND] = trace_replay_glColor3ui,
+    [TRACE_glColor3uiv - TRACE_FIRST_COMMAND] = trace_replay_glColor3uiv,
+    [TRACE_glColor3us - TRACE_FIRST_COMMAND] = trace_replay_glColor3us,
+    [TRACE_glColor3usv - TRACE_FIRST_COMMAND] = trace_replay_glColor3usv,
+    [TRACE_glColor4b - TRACE_FIRST_COMMAND] = trace_replay_glColor4b,
+    [TRACE_glColor4bv - TRACE_FIRST_COMMAND] = trace_replay_glColor4bv,
+    [TRACE_glColor4d - TRACE_FIRST_COMMAND] = trace_replay_glColor4d,
+    [TRACE_glColor4dv - TRACE_FIRST_COMMAND] = trace_replay_glColor4dv,
+    [TRACE_glColor4f - TRACE_FIRST_COMMAND] = trace_replay_glColor4f,
+    [TRACE_glColor4fv - TRACE_FIRST_COMMAND] = trace_replay_glColor4fv,
+    [TRACE_glColor4i - TRACE_FIRST_COMMAND] = trace_replay_glColor4i,
+    [TRACE_glColor4iv - TRACE_FIRST_COMMAND] = trace_replay_glColor4iv,
+    [TRACE_glColor4s - TRACE_FIRST_COMMAND] = trace_replay_glColor4s,
+    [TRACE_glColor4sv - TRACE_FIRST_COMMAND] = trace_replay_glColor4sv,
+    [TRACE_glColor4ub - TRACE_FIRST_COMMAND] = trace_replay_glColor4ub,
+    [TRACE_glColor4ubv - TRACE_FIRST_COMMAND] = trace_replay_glColor4ubv,
+    [TRACE_glColor4ui - TRACE_FIRST_COMMAND] = trace_replay_glColor4ui,
+    [TRACE_glColor4uiv - TRACE_FIRST_COMMAND] = trace_replay_glColor4uiv,
+    [TRACE_glColor4us - TRACE_FIRST_COMMAND] = trace_replay_glColor4us,
+    [TRACE_glColor4usv - TRACE_FIRST_COMMAND] = trace_replay_glColor4usv,
+    [TRACE_glEdgeFlag - TRACE_FIRST_COMMAND] = trace_replay_glEdgeFlag,
+    [TRACE_glEdgeFlagv - TRACE_FIRST_COMMAND] = trace_replay_glEdgeFlagv,
+    [TRACE_glEnd - TRACE_FIRST_COMMAND] = trace_replay_glEnd,
+    [TRACE_glIndexd - TRACE_FIRST_COMMAND] = trace_replay_glIndexd,
+    [TRACE_glIndexdv - TRACE_FIRST_COMMAND] = trace_replay_glIndexdv,
+    [TRACE_glIndexf - TRACE_FIRST_COMMAND] = trace_replay_glIndexf,
+    [TRACE_glIndexfv - TRACE_FIRST_COMMAND] = trace_replay_glIndexfv,
+    [TRACE_glIndexi - TRACE_FIRST_COMMAND] = trace_replay_glIndexi,
+    [TRACE_glIndexiv - TRACE_FIRST_COMMAND] = trace_replay_glIndexiv,
+    [TRACE_glIndexs - TRACE_FIRST_COMMAND] = trace_replay_glIndexs,
+    [TRACE_glIndexsv - TRACE_FIRST_COMMAND] = trace_replay_glIndexsv,
+    [TRACE_glNormal3b - TRACE_FIRST_COMMAND] = trace_replay_glNormal3b,
+    [TRACE_glNormal3bv - TRACE_FIRST_COMMAND] = trace_replay_glNormal3bv,
+    [TRACE_glNormal3d - TRACE_FIRST_COMMAND] = trace_replay_glNormal3d,
+    [TRACE_glNormal3dv - TRACE_FIRST_COMMAND] = trace_replay_glNormal3dv,
+    [TRACE_glNormal3f - TRACE_FIRST_COMMAND] = trace_replay_glNormal3f,
+    [TRACE_glNormal3fv - TRACE_FIRST_COMMAND] = trace_replay_glNormal3fv,
+    [TRACE_glNormal3i - TRACE_FIRST_COMMAND] = trace_replay_glNormal3i,
+    [TRACE_glNormal3iv - TRACE_FIRST_COMMAND] = trace_replay_glNormal3iv,
+    [TRACE_glNormal3s - TRACE_FIRST_COMMAND] = trace_replay_glNormal3s,
+    [TRACE_glNormal3sv - TRACE_FIRST_COMMAND] = trace_replay_glNormal3sv,
+    [TRACE_glRasterPos2d - TRACE_FIRST_COMMAND] = trace_replay_glRasterPos2d,
+    [TRACE_glRasterPos2dv - TRACE_FIRST_COMMAND] = trace_replay_glRasterPos2dv,
+    [TRACE_glRasterPos2f - TRACE_FIRST_COMMAND] = trace_replay_glRasterPos2f,
+    [TRACE_glRasterPos2fv - TRACE_FIRST_COMMAND] = trace_replay_glRasterPos2fv,
+    [TRACE_glRasterPos2i - TRACE_FIRST_COMMAND] = trace_replay_glRasterPos2i,
+    [TRACE_glRasterPos2iv - TRACE_FIRST_COMMAND] = trace_replay_glRasterPos2iv,
+    [TRACE_glRasterPos2s - TRACE_FIRST_COMMAND] = trace_replay_glRasterPos2s,
+    [TRACE_glRasterPos2sv - TRACE_FIRST_COMMAND] = trace_replay_glRasterPos2sv,
+    [TRACE_glRasterPos3d - TRACE_FIRST_COMMAND] = trace_replay_glRasterPos3d,
+    [TRACE_glRasterPos3dv - TRACE_FIRST_COMMAND] = trace_replay_glRasterPos3dv,
+    [TRACE_glRasterPos3f - TRACE_FIRST_COMMAND] = trace_replay_glRasterPos3f,
+    [TRACE_glRasterPos3fv - TRACE_FIRST_COMMAND] = trace_replay_glRasterPos3fv,
+    [TRACE_glRasterPos3i - TRACE_FIRST_COMMAND] = trace_replay_glRasterPos3i,
+    [TRACE_glRasterPos3iv - TRACE_FIRST_COMMAND] = trace_replay_glRasterPos3iv,
+    [TRACE_glRasterPos3s - TRACE_FIRST_COMMAND] = trace_replay_glRasterPos3s,
+    [TRACE_glRasterPos3sv - TRACE_FIRST_COMMAND] = trace_replay_glRasterPos3sv,
+    [TRACE_glRasterPos4d - TRACE_FIRST_COMMAND] = trace_replay_glRasterPos4d,
+    [TRACE_glRasterPos4dv - TRACE_FIRST_COMMAND] = trace_replay_glRasterPos4dv,
+    [TRACE_glRasterPos4f - TRACE_FIRST_COMMAND] = trace_replay_glRasterPos4f,
+    [TRACE_glRasterPos4fv - TRACE_FIRST_COMMAND] = trace_replay_glRasterPos4fv,
+    [TRACE_glRasterPos4i - TRACE_FIRST_COMMAND] = trace_replay_glRasterPos4i,
+    [TRACE_glRasterPos4iv - TRACE_FIRST_COMMAND] = trace_replay_glRasterPos4iv,
+    [TRACE_glRasterPos4s - TRACE_FIRST_COMMAND] = trace_replay_glRasterPos4s,
+    [TRACE_glRasterPos4sv - TRACE_FIRST_COMMAND] = trace_replay_glRasterPos4sv,
+    [TRACE_glRectd - TRACE_FIRST_COMMAND] = trace_replay_glRectd,
+    [TRACE_glRectdv - TRACE_FIRST_COMMAND] = trace_replay_glRectdv,
+    [TRACE_glRectf - TRACE_FIRST_COMMAND] = trace_replay_glRectf,
+    [TRACE_glRectfv - TRACE_FIRST_COMMAND] = trace_replay_glRectfv,
+    [TRACE_glRecti - TRACE_FIRST_COMMAND] = trace_replay_glRecti,
+    [TRACE_glRectiv - TRACE_FIRST_COMMAND] = trace_replay_glRectiv,
+    [TRACE_glRects - TRACE_FIRST_COMMAND] = trace_replay_glRects,
+    [TRACE_glRectsv - TRACE_FIRST_COMMAND] = trace_replay_glRectsv,
+    [TRACE_glTexCoord1d - TRACE_FIRST_COMMAND] = trace_replay_glTexCoord1d,
+    [TRACE_glTexCoord1dv - TRACE_FIRST_COMMAND] = trace_replay_glTexCoord1dv,
+    [TRACE_glTexCoord1f - TRACE_FIRST_COMMAND] = trace_replay_glTexCoord1f,
+    [TRACE_glTexCoord1fv - TRACE_FIRST_COMMAND] = trace_replay_glTexCoord1fv,
+    [TRACE_glTexCoord1i - TRACE_FIRST_COMMAND] = trace_replay_glTexCoord1i,
+    [TRACE_glTexCoord1iv - TRACE_FIRST_COMMAND] = trace_replay_glTexCoord1iv,
+    [TRACE_glTexCoord1s - TRACE_FIRST_COMMAND] = trace_replay_glTexCoord1s,
+    [TRACE_glTexCoord1sv - TRACE_FIRST_COMMAND] = trace_replay_glTexCoord1sv,
+    [TRACE_glTexCoord2d - TRACE_FIRST_COMMAND] = trace_replay_glTexCoord2d,
+    [TRACE_glTexCoord2dv - TRACE_FIRST_COMMAND] = trace_replay_glTexCoord2dv,
+    [TRACE_glTexCoord2f - TRACE_FIRST_COMMAND] = trace_replay_glTexCoord2f,
+    [TRACE_glTexCoord2fv - TRACE_FIRST_COMMAND] = trace_replay_glTexCoord2fv,
+    [TRACE_glTexCoord2i - TRACE_FIRST_COMMAND] = trace_replay_glTexCoord2i,
+    [TRACE_glTexCoord2iv - TRACE_FIRST_COMMAND] = trace_replay_glTexCoord2iv,
+    [TRACE_glTexCoord2s - TRACE_FIRST_COMMAND] = trace_replay_glTexCoord2s,
+    [TRACE_glTexCoord2sv - TRACE_FIRST_COMMAND] = trace_replay_glTexCoord2sv,
+    [TRACE_glTexCoord3d - TRACE_FIRST_COMMAND] = trace_replay_glTexCoord3d,
+    [TRACE_glTexCoord3dv - TRACE_FIRST_COMMAND] = trace_replay_glTexCoord3dv,
+    [TRACE_glTexCoord3f - TRACE_FIRST_COMMAND] = trace_replay_glTexCoord3f,
+    [TRACE_glTexCoord3fv - TRACE_FIRST_COMMAND] = trace_replay_glTexCoord3fv,
+    [TRACE_glTexCoord3i - TRACE_FIRST_COMMAND] = trace_replay_glTexCoord3i,
+    [TRACE_glTexCoord3iv - TRACE_FIRST_COMMAND] = trace_replay_glTexCoord3iv,
+    [TRACE_glTexCoord3s - TRACE_FIRST_COMMAND] = trace_replay_glTexCoord3s,
+    [TRACE_glTexCoord3sv - TRACE_FIRST_COMMAND] = trace_replay_glTexCoord3sv,
+    [TRACE_glTexCoord4d - TRACE_FIRST_COMMAND] = trace_replay_glTexCoord4d,
+    [TRACE_glTexCoord4dv - TRACE_FIRST_COMMAND] = trace_replay_glTexCoord4dv,
+    [TRACE_glTexCoord4f - TRACE_FIRST_COMMAND] = trace_replay_glTexCoord4f,
+    [TRACE_glTexCoord4fv - TRACE_FIRST_COMMAND] = trace_replay_glTexCoord4fv,
+    [TRACE_glTexCoord4i - TRACE_FIRST_COMMAND] = trace_replay_glTexCoord4i,
+    [TRACE_glTexCoord4iv - TRACE_FIRST_COMMAND] = trace_replay_glTexCoord4iv,
+    [TRACE_glTexCoord4s - TRACE_FIRST_COMMAND] = trace_replay_glTexCoord4s,
+    [TRACE_glTexCoord4sv - TRACE_FIRST_COMMAND] = trace_replay_glTexCoord4sv,
+    [TRACE_glVertex2d - TRACE_FIRST_COMMAND] = trace_replay_glVertex2d,
+    [TRACE_glVertex2dv - TRACE_FIRST_COMMAND] = trace_replay_glVertex2dv,
+    [TRACE_glVertex2f - TRACE_FIRST_COMMAND] = trace_replay_glVertex2f,
+    [TRACE_glVertex2fv - TRACE_FIRST_COMMAND] = trace_replay_glVertex2fv,
+    [TRACE_glVertex2i - TRACE_FIRST_COMMAND] = trace_replay_glVertex2i,
+    [TRACE_glVertex2iv - TRACE_FIRST_COMMAND] = trace_replay_glVertex2iv,
+    [TRACE_glVertex2s - TRACE_FIRST_COMMAND] = trace_replay_glVertex2s,
+    [TRACE_glVertex2sv - TRACE_FIRST_COMMAND] = trace_replay_glVertex2sv,
+    [TRACE_glVertex3d - TRACE_FIRST_COMMAND] = trace_replay_glVertex3d,
+    [TRACE_glVertex3dv - TRACE_FIRST_COMMAND] = trace_replay_glVertex3dv,
+    [TRACE_glVertex3f - TRACE_FIRST_COMMAND] = trace_replay_glVertex3f,
+    [TRACE_glVertex3fv - TRACE_FIRST_COMMAND] = trace_replay_glVertex3fv,
+    [TRACE_glVertex3i - TRACE_FIRST_COMMAND] = trace_replay_glVertex3i,
+    [TRACE_glVertex3iv - TRACE_FIRST_COMMAND] = trace_replay_glVertex3iv,
+    [TRACE_glVertex3s - TRACE_FIRST_COMMAND] = trace_replay_glVertex3s,
+    [TRACE_glVertex3sv - TRACE_FIRST_COMMAND] = trace_replay_glVertex3sv,
+    [TRACE_glVertex4d - TRACE_FIRST_COMMAND] = trace_replay_glVertex4d,
+    [TRACE_glVertex4dv - TRACE_FIRST_COMMAND] = trace_replay_glVertex4dv,
+    [TRACE_glVertex4f - TRACE_FIRST_COMMAND] = trace_replay_glVertex4f,
+    [TRACE_glVertex4fv - TRACE_FIRST_COMMAND] = trace_replay_glVertex4fv,
+    [TRACE_glVertex4i - TRACE_FIRST_COMMAND] = trace_replay_glVertex4i,
+    [TRACE_glVertex4iv - TRACE_FIRST_COMMAND] = trace_replay_glVertex4iv,
+    [TRACE_glVertex4s - TRACE_FIRST_COMMAND] = trace_replay_glVertex4s,
+    [TRACE_glVertex4sv - TRACE_FIRST_COMMAND] = trace_replay_glVertex4sv,
+    [TRACE_glClipPlane - TRACE_FIRST_COMMAND] = trace_replay_glClipPlane,
+    [TRACE_glColorMaterial - TRACE_FIRST_COMMAND] = trace_replay_glColorMaterial,
+    [TRACE_glFogf - TRACE_FIRST_COMMAND] = trace_replay_glFogf,
+    [TRACE_glFogfv - TRACE_FIRST_COMMAND] = trace_replay_glFogfv,
+    [TRACE_glFogi - TRACE_FIRST_COMMAND] = trace_replay_glFogi,
+    [TRACE_glFogiv - TRACE_FIRST_COMMAND] = trace_replay_glFogiv,
+    [TRACE_glLightf - TRACE_FIRST_COMMAND] = trace_replay_glLightf,
+    [TRACE_glLightfv - TRACE_FIRST_COMMAND] = trace_replay_glLightfv,
+    [TRACE_glLighti - TRACE_FIRST_COMMAND] = trace_replay_glLighti,
+    [TRACE_glLightiv - TRACE_FIRST_COMMAND] = trace_replay_glLightiv,
+    [TRACE_glLightModelf - TRACE_FIRST_COMMAND] = trace_replay_glLightModelf,
+    [TRACE_glLightModelfv - TRACE_FIRST_COMMAND] = trace_replay_glLightModelfv,
+    [TRACE_glLightModeli - TRACE_FIRST_COMMAND] = trace_replay_glLightModeli,
+    [TRACE_glLightModeliv - TRACE_FIRST_COMMAND] = trace_replay_glLightModeliv,
+    [TRACE_glLineStipple - TRACE_FIRST_COMMAND] = trace_replay_glLineStipple,
+    [TRACE_glMaterialf - TRACE_FIRST_COMMAND] = trace_replay_glMaterialf,
+    [TRACE_glMaterialfv - TRACE_FIRST_COMMAND] = trace_replay_glMaterialfv,
+    [TRACE_glMateriali - TRACE_FIRST_COMMAND] = trace_replay_glMateriali,
+    [TRACE_glMaterialiv - TRACE_FIRST_COMMAND] = trace_replay_glMaterialiv,
+    [TRACE_glPolygonStipple - TRACE_FIRST_COMMAND] = trace_replay_glPolygonStipple,
+    [TRACE_glShadeModel - TRACE_FIRST_COMMAND] = trace_replay_glShadeModel,
+    [TRACE_glTexEnvf - TRACE_FIRST_COMMAND] = trace_replay_glTexEnvf,
+    [TRACE_glTexEnvfv - TRACE_FIRST_COMMAND] = trace_replay_glTexEnvfv,
+    [TRACE_glTexEnvi - TRACE_FIRST_COMMAND] = trace_replay_glTexEnvi,
+    [TRACE_glTexEnviv - TRACE_FIRST_COMMAND] = trace_replay_glTexEnviv,
+    [TRACE_glTexGend - TRACE_FIRST_COMMAND] = trace_replay_glTexGend,
+    [TRACE_glTexGendv - TRACE_FIRST_COMMAND] = trace_replay_glTexGendv,
+    [TRACE_glTexGenf - TRACE_FIRST_COMMAND] = trace_replay_glTexGenf,
+    [TRACE_glTexGenfv - TRACE_FIRST_COMMAND] = trace_replay_glTexGenfv,
+    [TRACE_glTexGeni - TRACE_FIRST_COMMAND] = trace_replay_glTexGeni,
+    [TRACE_glTexGeniv - TRACE_FIRST_COMMAND] = trace_replay_glTexGeniv,
+    [TRACE_glInitNames - TRACE_FIRST_COMMAND] = trace_replay_glInitNames,
+    [TRACE_glLoadName - TRACE_FIRST_COMMAND] = trace_replay_glLoadName,
+    [TRACE_glPassThrough - TRACE_FIRST_COMMAND] = trace_replay_glPassThrough,
+    [TRACE_glPopName - TRACE_FIRST_COMMAND] = trace_replay_glPopName,
+    [TRACE_glPushName - TRACE_FIRST_COMMAND] = trace_replay_glPushName,
+    [TRACE_glClearAccum - TRACE_FIRST_COMMAND] = trace_replay_glClearAccum,
+    [TRACE_glClearIndex - TRACE_FIRST_COMMAND] = trace_replay_glClearIndex,
+    [TRACE_glIndexMask - TRACE_FIRST_COMMAND] = trace_replay_glIndexMask,
+    [TRACE_glAccum - TRACE_FIRST_COMMAND] = trace_replay_glAccum,
+    [TRACE_glPopAttrib - TRACE_FIRST_COMMAND] = trace_replay_glPopAttrib,
+    [TRACE_glPushAttrib - TRACE_FIRST_COMMAND] = trace_replay_glPushAttrib,
+    [TRACE_glMap1d - TRACE_FIRST_COMMAND] = trace_replay_glMap1d,
+    [TRACE_glMap1f - TRACE_FIRST_COMMAND] = trace_replay_glMap1f,
+    [TRACE_glMap2d - TRACE_FIRST_COMMAND] = trace_replay_glMap2d,
+    [TRACE_glMap2f - TRACE_FIRST_COMMAND] = trace_replay_glMap2f,
+    [TRACE_glMapGrid1d - TRACE_FIRST_COMMAND] = trace_replay_glMapGrid1d,
+    [TRACE_glMapGrid1f - TRACE_FIRST_COMMAND] = trace_replay_glMapGrid1f,
+    [TRACE_glMapGrid2d - TRACE_FIRST_COMMAND] = trace_replay_glMapGrid2d,
+    [TRACE_glMapGrid2f - TRACE_FIRST_COMMAND] = trace_replay_glMapGrid2f,
+    [TRACE_glEvalCoord1d - TRACE_FIRST_COMMAND] = trace_replay_glEvalCoord1d,
+    [TRACE_glEvalCoord1dv - TRACE_FIRST_COMMAND] = trace_replay_glEvalCoord1dv,
+    [TRACE_glEvalCoord1f - TRACE_FIRST_COMMAND] = trace_replay_glEvalCoord1f,
+    [TRACE_glEvalCoord1fv - TRACE_FIRST_COMMAND] = trace_replay_glEvalCoord1fv,
+    [TRACE_glEvalCoord2d - TRACE_FIRST_COMMAND] = trace_replay_glEvalCoord2d,
+    [TRACE_glEvalCoord2dv - TRACE_FIRST_COMMAND] = trace_replay_glEvalCoord2dv,
+    [TRACE_glEvalCoord2f - TRACE_FIRST_COMMAND] = trace_replay_glEvalCoord2f,
+    [TRACE_glEvalCoord2fv - TRACE_FIRST_COMMAND] = trace_replay_glEvalCoord2fv,
+    [TRACE_glEvalMesh1 - TRACE_FIRST_COMMAND] = trace_replay_glEvalMesh1,
+    [TRACE_glEvalPoint1 - TRACE_FIRST_COMMAND] = trace_replay_glEvalPoint1,
+    [TRACE_glEvalMesh2 - TRACE_FIRST_COMMAND] = trace_replay_glEvalMesh2,
+    [TRACE_glEvalPoint2 - TRACE_FIRST_COMMAND] = trace_replay_glEvalPoint2,
+    [TRACE_glAlphaFunc - TRACE_FIRST_COMMAND] = trace_replay_glAlphaFunc,
+    [TRACE_glPixelZoom - TRACE_FIRST_COMMAND] = trace_replay_glPixelZoom,
+    [TRACE_glPixelTransferf - TRACE_FIRST_COMMAND] = trace_replay_glPixelTransferf,
+    [TRACE_glPixelTransferi - TRACE_FIRST_COMMAND] = trace_replay_glPixelTransferi,
+    [TRACE_glPixelMapfv - TRACE_FIRST_COMMAND] = trace_replay_glPixelMapfv,
+    [TRACE_glPixelMapuiv - TRACE_FIRST_COMMAND] = trace_replay_glPixelMapuiv,
+    [TRACE_glPixelMapusv - TRACE_FIRST_COMMAND] = trace_replay_glPixelMapusv,
+    [TRACE_glCopyPixels - TRACE_FIRST_COMMAND] = trace_replay_glCopyPixels,
+    [TRACE_glDrawPixels - TRACE_FIRST_COMMAND] = trace_replay_glDrawPixels,
+    [TRACE_glFrustum - TRACE_FIRST_COMMAND] = trace_replay_glFrustum,
+    [TRACE_glLoadIdentity - TRACE_FIRST_COMMAND] = trace_replay_glLoadIdentity,
+    [TRACE_glLoadMatrixf - TRACE_FIRST_COMMAND] = trace_replay_glLoadMatrixf,
+    [TRACE_glLoadMatrixd - TRACE_FIRST_COMMAND] = trace_replay_glLoadMatrixd,
+    [TRACE_glMatrixMode - TRACE_FIRST_COMMAND] = trace_replay_glMatrixMode,
+    [TRACE_glMultMatrixf - TRACE_FIRST_COMMAND] = trace_replay_glMultMatrixf,
+    [TRACE_glMultMatrixd - TRACE_FIRST_COMMAND] = trace_replay_glMultMatrixd,
+    [TRACE_glOrtho - TRACE_FIRST_COMMAND] = trace_replay_glOrtho,
+    [TRACE_glPopMatrix - TRACE_FIRST_COMMAND] = trace_replay_glPopMatrix,
+    [TRACE_glPushMatrix - TRACE_FIRST_COMMAND] = trace_replay_glPushMatrix,
+    [TRACE_glRotated - TRACE_FIRST_COMMAND] = trace_replay_glRotated,
+    [TRACE_glRotatef - TRACE_FIRST_COMMAND] = trace_replay_glRotatef,
+    [TRACE_glScaled - TRACE_FIRST_COMMAND] = trace_replay_glScaled,
+    [TRACE_glScalef - TRACE_FIRST_COMMAND] = trace_replay_glScalef,
+    [TRACE_glTranslated - TRACE_FIRST_COMMAND] = trace_replay_glTranslated,
+    [TRACE_glTranslatef - TRACE_FIRST_COMMAND] = trace_replay_glTranslatef,
+#endif
+#if FUNGL_VERSION >= GL_VERSION_1_1
+    [TRACE_glDrawArrays - TRACE_FIRST_COMMAND] = trace_replay_glDrawArrays,
+    [TRACE_glDrawElements - TRACE_FIRST_COMMAND] = trace_replay_glDrawElements,
+    [TRACE_glPolygonOffset - TRACE_FIRST_COMMAND] = trace_replay_glPolygonOffset,
+    [TRACE_glCopyTexImage1D - TRACE_FIRST_COMMAND] = trace_replay_glCopyTexImage1D,
+    [TRACE_glCopyTexImage2D - TRACE_FIRST_COMMAND] = trace_replay_glCopyTexImage2D,
+    [TRACE_glCopyTexSubImage1D - TRACE_FIRST_COMMAND] = trace_replay_glCopyTexSubImage1D,
+    [TRACE_glCopyTexSubImage2D - TRACE_FIRST_COMMAND] = trace_replay_glCopyTexSubImage2D,
+    [TRACE_glTexSubImage1D - TRACE_FIRST_COMMAND] = trace_replay_glTexSubImage1D,
+    [TRACE_glTexSubImage2D - TRACE_FIRST_COMMAND] = trace_replay_glTexSubImage2D,
+    [TRACE_glBindTexture - TRACE_FIRST_COMMAND] = trace_replay_glBindTexture,
+    [TRACE_glDeleteTextures - TRACE_FIRST_COMMAND] = trace_replay_glDeleteTextures,
+    [TRACE_glGenTextures - TRACE_FIRST_COMMAND] = trace_replay_glGenTextures,
+    [TRACE_glArrayElement - TRACE_FIRST_COMMAND] = trace_replay_glArrayElement,
+    [TRACE_glColorPointer - TRACE_FIRST_COMMAND] = trace_replay_glColorPointer,
+    [TRACE_glDisableClientState - TRACE_FIRST_COMMAND] = trace_replay_glDisableClientState,
+    [TRACE_glEdgeFlagPointer - TRACE_FIRST_COMMAND] = trace_replay_glEdgeFlagPointer,
+    [TRACE_glEnableClientState - TRACE_FIRST_COMMAND] = trace_replay_glEnableClientState,
+    [TRACE_glIndexPointer - TRACE_FIRST_COMMAND] = trace_replay_glIndexPointer,
+    [TRACE_glInterleavedArrays - TRACE_FIRST_COMMAND] = trace_replay_glInterleavedArrays,
+    [TRACE_glNormalPointer - TRACE_FIRST_COMMAND] = trace_replay_glNormalPointer,
+    [TRACE_glTexCoordPointer - TRACE_FIRST_COMMAND] = trace_replay_glTexCoordPointer,
+    [TRACE_glVertexPointer - TRACE_FIRST_COMMAND] = trace_replay_glVertexPointer,
+    [TRACE_glPrioritizeTextures - TRACE_FIRST_COMMAND] = trace_replay_glPrioritizeTextures,
+    [TRACE_glIndexub - TRACE_FIRST_COMMAND] = trace_replay_glIndexub,
+    [TRACE_glIndexubv - TRACE_FIRST_COMMAND] = trace_replay_glIndexubv,
+    [TRACE_glPopClientAttrib - TRACE_FIRST_COMMAND] = trace_replay_glPopClientAttrib,
+    [TRACE_glPushClientAttrib - TRACE_FIRST_COMMAND] = trace_replay_glPushClientAttrib,
+#endif
+#if FUNGL_VERSION >= GL_VERSION_1_2
+    [TRACE_glDrawRangeElements - TRACE_FIRST_COMMAND] = trace_replay_glDrawRangeElements,
+    [TRACE_glTexImage3D - TRACE_FIRST_COMMAND] = trace_replay_glTexImage3D,
+    [TRACE_glTexSubImage3D - TRACE_FIRST_COMMAND] = trace_replay_glTexSubImage3D,
+    [TRACE_glCopyTexSubImage3D - TRACE_FIRST_COMMAND] = trace_replay_glCopyTexSubImage3D,
+#endif
+#if FUNGL_VERSION >= GL_VERSION_1_3
+    [TRACE_glActiveTexture - TRACE_FIRST_COMMAND] = trace_replay_glActiveTexture,
+    [TRACE_glSampleCoverage - TRACE_FIRST_COMMAND] = trace_replay_glSampleCoverage,
+    [TRACE_glCompressedTexImage3D - TRACE_FIRST_COMMAND] = trace_replay_glCompressedTexImage3D,
+    [TRACE_glCompressedTexImage2D - TRACE_FIRST_COMMAND] = trace_replay_glCompressedTexImage2D,
+    [TRACE_glCompressedTexImage1D - TRACE_FIRST_COMMAND] = trace_replay_glCompressedTexImage1D,
+    [TRACE_glCompressedTexSubImage3D - TRACE_FIRST_COMMAND] = trace_replay_glCompressedTexSubImage3D,
+    [TRACE_glCompressedTexSubImage2D - TRACE_FIRST_COMMAND] = trace_replay_glCompressedTexSubImage2D,
+    [TRACE_glCompressedTexSubImage1D - TRACE_FIRST_COMMAND] = trace_replay_glCompressedTexSubImage1D,
+    [TRACE_glClientActiveTexture - TRACE_FIRST_COMMAND] = trace_replay_glClientActiveTexture,
+    [TRACE_glMultiTexCoord1d - TRACE_FIRST_COMMAND] = trace_replay_glMultiTexCoord1d,
+    [TRACE_glMultiTexCoord1dv - TRACE_FIRST_COMMAND] = trace_replay_glMultiTexCoord1dv,
+    [TRACE_glMultiTexCoord1f - TRACE_FIRST_COMMAND] = trace_replay_glMultiTexCoord1f,
+    [TRACE_glMultiTexCoord1fv - TRACE_FIRST_COMMAND] = trace_replay_glMultiTexCoord1fv,
+    [TRACE_glMultiTexCoord1i - TRACE_FIRST_COMMAND] = trace_replay_glMultiTexCoord1i,
+    [TRACE_glMultiTexCoord1iv - TRACE_FIRST_COMMAND] = trace_replay_glMultiTexCoord1iv,
+    [TRACE_glMultiTexCoord1s - TRACE_FIRST_COMMAND] = trace_replay_glMultiTexCoord1s,
+    [TRACE_glMultiTexCoord1sv - TRACE_FIRST_COMMAND] = trace_replay_glMultiTexCoord1sv,
+    [TRACE_glMultiTexCoord2d - TRACE_FIRST_COMMAND] = trace_replay_glMultiTexCoord2d,
+    [TRACE_glMultiTexCoord2dv - TRACE_FIRST_COMMAND] = trace_replay_glMultiTexCoord2dv,
+    [TRACE_glMultiTexCoord2f - TRACE_FIRST_COMMAND] = trace_replay_glMultiTexCoord2f,
+    [TRACE_glMultiTexCoord2fv - TRACE_FIRST_COMMAND] = trace_replay_glMultiTexCoord2fv,
+    [TRACE_glMultiTexCoord2i - TRACE_FIRST_COMMAND] = trace_replay_glMultiTexCoord2i,
+    [TRACE_glMultiTexCoord2iv - TRACE_FIRST_COMMAND] = trace_replay_glMultiTexCoord2iv,
+    [TRACE_glMultiTexCoord2s - TRACE_FIRST_COMMAND] = trace_replay_glMultiTexCoord2s,
+    [TRACE_glMultiTexCoord2sv - TRACE_FIRST_COMMAND] = trace_replay_glMultiTexCoord2sv,
+    [TRACE_glMultiTexCoord3d - TRACE_FIRST_COMMAND] = trace_replay_glMultiTexCoord3d,
+    [TRACE_glMultiTexCoord3dv - TRACE_FIRST_COMMAND] = trace_replay_glMultiTexCoord3dv,
+    [TRACE_glMultiTexCoord3f - TRACE_FIRST_COMMAND] = trace_replay_glMultiTexCoord3f,
+    [TRACE_glMultiTexCoord3fv - TRACE_FIRST_COMMAND] = trace_replay_glMultiTexCoord3fv,
+    [TRACE_glMultiTexCoord3i - TRACE_FIRST_COMMAND] = trace_replay_glMultiTexCoord3i,
+    [TRACE_glMultiTexCoord3iv - TRACE_FIRST_COMMAND] = trace_replay_glMultiTexCoord3iv,
+    [TRACE_glMultiTexCoord3s - TRACE_FIRST_COMMAND] = trace_replay_glMultiTexCoord3s,
+    [TRACE_glMultiTexCoord3sv - TRACE_FIRST_COMMAND] = trace_replay_glMultiTexCoord3sv,
+    [TRACE_glMultiTexCoord4d - TRACE_FIRST_COMMAND] = trace_replay_glMultiTexCoord4d,
+    [TRACE_glMultiTexCoord4dv - TRACE_FIRST_COMMAND] = trace_replay_glMultiTexCoord4dv,
+    [TRACE_glMultiTexCoord4f - TRACE_FIRST_COMMAND] = trace_replay_glMultiTexCoord4f,
+    [TRACE_glMultiTexCoord4fv - TRACE_FIRST_COMMAND] = trace_replay_glMultiTexCoord4fv,
+    [TRACE_glMultiTexCoord4i - TRACE_FIRST_COMMAND] = trace_replay_glMultiTexCoord4i,
+    [TRACE_glMultiTexCoord4iv - TRACE_FIRST_COMMAND] = trace_replay_glMultiTexCoord4iv,
+    [TRACE_glMultiTexCoord4s - TRACE_FIRST_COMMAND] = trace_replay_glMultiTexCoord4s,
+    [TRACE_glMultiTexCoord4sv - TRACE_FIRST_COMMAND] = trace_replay_glMultiTexCoord4sv,
+    [TRACE_glLoadTransposeMatrixf - TRACE_FIRST_COMMAND] = trace_replay_glLoadTransposeMatrixf,
+    [TRACE_glLoadTransposeMatrixd - TRACE_FIRST_COMMAND] = trace_replay_glLoadTransposeMatrixd,
+    [TRACE_glMultTransposeMatrixf - TRACE_FIRST_COMMAND] = trace_replay_glMultTransposeMatrixf,
+    [TRACE_glMultTransposeMatrixd - TRACE_FIRST_COMMAND] = trace_replay_glMultTransposeMatrixd,
+#endif
+#if FUNGL_VERSION >= GL_VERSION_1_4
+    [TRACE_glBlendFuncSeparate - TRACE_FIRST_COMMAND] = trace_replay_glBlendFuncSeparate,
+    [TRACE_glMultiDrawArrays - TRACE_FIRST_COMMAND] = trace_replay_glMultiDrawArrays,
+    [TRACE_glMultiDrawElements - TRACE_FIRST_COMMAND] = trace_replay_glMultiDrawElements,
+    [TRACE_glPointParameterf - TRACE_FIRST_COMMAND] = trace_replay_glPointParameterf,
+    [TRACE_glPointParameterfv - TRACE_FIRST_COMMAND] = trace_replay_glPointParameterfv,
+    [TRACE_glPointParameteri - TRACE_FIRST_COMMAND] = trace_replay_glPointParameteri,
+    [TRACE_glPointParameteriv - TRACE_FIRST_COMMAND] = trace_replay_glPointParameteriv,
+    [TRACE_glFogCoordf - TRACE_FIRST_COMMAND] = trace_replay_glFogCoordf,
+    [TRACE_glFogCoordfv - TRACE_FIRST_COMMAND] = trace_replay_glFogCoordfv,
+    [TRACE_glFogCoordd - TRACE_FIRST_COMMAND] = trace_replay_glFogCoordd,
+    [TRACE_glFogCoorddv - TRACE_FIRST_COMMAND] = trace_replay_glFogCoorddv,
+    [TRACE_glFogCoordPointer - TRACE_FIRST_COMMAND] = trace_replay_glFogCoordPointer,
+    [TRACE_glSecondaryColor3b - TRACE_FIRST_COMMAND] = trace_replay_glSecondaryColor3b,
+    [TRACE_glSecondaryColor3bv - TRACE_FIRST_COMMAND] = trace_replay_glSecondaryColor3bv,
+    [TRACE_glSecondaryColor3d - TRACE_FIRST_COMMAND] = trace_replay_glSecondaryColor3d,
+    [TRACE_glSecondaryColor3dv - TRACE_FIRST_COMMAND] = trace_replay_glSecondaryColor3dv,
+    [TRACE_glSecondaryColor3f - TRACE_FIRST_COMMAND] = trace_replay_glSecondaryColor3f,
+    [TRACE_glSecondaryColor3fv - TRACE_FIRST_COMMAND] = trace_replay_glSecondaryColor3fv,
+    [TRACE_glSecondaryColor3i - TRACE_FIRST_COMMAND] = trace_replay_glSecondaryColor3i,
+    [TRACE_glSecondaryColor3iv - TRACE_FIRST_COMMAND] = trace_replay_glSecondaryColor3iv,
+    [TRACE_glSecondaryColor3s - TRACE_FIRST_COMMAND] = trace_replay_glSecondaryColor3s,
+    [TRACE_glSecondaryColor3sv - TRACE_FIRST_COMMAND] = trace_replay_glSecondaryColor3sv,
+    [TRACE_glSecondaryColor3ub - TRACE_FIRST_COMMAND] = trace_replay_glSecondaryColor3ub,
+    [TRACE_glSecondaryColor3ubv - TRACE_FIRST_COMMAND] = trace_replay_glSecondaryColor3ubv,
+    [TRACE_glSecondaryColor3ui - TRACE_FIRST_COMMAND] = trace_replay_glSecondaryColor3ui,
+    [TRACE_glSecondaryColor3uiv - TRACE_FIRST_COMMAND] = trace_replay_glSecondaryColor3uiv,
+    [TRACE_glSecondaryColor3us - TRACE_FIRST_COMMAND] = trace_replay_glSecondaryColor3us,
+    [TRACE_glSecondaryColor3usv - TRACE_FIRST_COMMAND] = trace_replay_glSecondaryColor3usv,
+    [TRACE_glSecondaryColorPointer - TRACE_FIRST_COMMAND] = trace_replay_glSecondaryColorPointer,
+    [TRACE_glWindowPos2d - TRACE_FIRST_COMMAND] = trace_replay_glWindowPos2d,
+    [TRACE_glWindowPos2dv - TRACE_FIRST_COMMAND] = trace_replay_glWindowPos2dv,
+    [TRACE_glWindowPos2f - TRACE_FIRST_COMMAND] = trace_replay_glWindowPos2f,
+    [TRACE_glWindowPos2fv - TRACE_FIRST_COMMAND] = trace_replay_glWindowPos2fv,
+    [TRACE_glWindowPos2i - TRACE_FIRST_COMMAND] = trace_replay_glWindowPos2i,
+    [TRACE_glWindowPos2iv - TRACE_FIRST_COMMAND] = trace_replay_glWindowPos2iv,
+    [TRACE_glWindowPos2s - TRACE_FIRST_COMMAND] = trace_replay_glWindowPos2s,
+    [TRACE_glWindowPos2sv - TRACE_FIRST_COMMAND] = trace_replay_glWindowPos2sv,
+    [TRACE_glWindowPos3d - TRACE_FIRST_COMMAND] = trace_replay_glWindowPos3d,
+    [TRACE_glWindowPos3dv - TRACE_FIRST_COMMAND] = trace_replay_glWindowPos3dv,
+    [TRACE_glWindowPos3f - TRACE_FIRST_COMMAND] = trace_replay_glWindowPos3f,
+    [TRACE_glWindowPos3fv - TRACE_FIRST_COMMAND] = trace_replay_glWindowPos3fv,
+    [TRACE_glWindowPos3i - TRACE_FIRST_COMMAND] = trace_replay_glWindowPos3i,
+    [TRACE_glWindowPos3iv - TRACE_FIRST_COMMAND] = trace_replay_glWindowPos3iv,
+    [TRACE_glWindowPos3s - TRACE_FIRST_COMMAND] = trace_replay_glWindowPos3s,
+    [TRACE_glWindowPos3sv - TRACE_FIRST_COMMAND] = trace_replay_glWindowPos3sv,
+    [TRACE_glBlendColor - TRACE_FIRST_COMMAND] = trace_replay_glBlendColor,
+    [TRACE_glBlendEquation - TRACE_FIRST_COMMAND] = trace_replay_glBlendEquation,
+#endif
+#if FUNGL_VERSION >= GL_VERSION_1_5
+    [TRACE_glGenQueries - TRACE_FIRST_COMMAND] = trace_replay_glGenQueries,
+    [TRACE_glDeleteQueries - TRACE_FIRST_COMMAND] = trace_replay_glDeleteQueries,
+    [TRACE_glBeginQuery - TRACE_FIRST_COMMAND] = trace_replay_glBeginQuery,
+    [TRACE_glEndQuery - TRACE_FIRST_COMMAND] = trace_replay_glEndQuery,
+    [TRACE_glBindBuffer - TRACE_FIRST_COMMAND] = trace_replay_glBindBuffer,
+    [TRACE_glDeleteBuffers - TRACE_FIRST_COMMAND] = trace_replay_glDeleteBuffers,
+    [TRACE_glGenBuffers - TRACE_FIRST_COMMAND] = trace_replay_glGenBuffers,
+    [TRACE_glBufferData - TRACE_FIRST_COMMAND] = trace_replay_glBufferData,
+    [TRACE_glBufferSubData - TRACE_FIRST_COMMAND] = trace_replay_glBufferSubData,
+    [TRACE_glMapBuffer - TRACE_FIRST_COMMAND] = trace_replay_glMapBuffer,
+    [TRACE_glUnmapBuffer - TRACE_FIRST_COMMAND] = trace_replay_glUnmapBuffer,
+#endif
+#if FUNGL_VERSION >= GL_VERSION_2_0
+    [TRACE_glBlendEquationSeparate - TRACE_FIRST_COMMAND] = trace_replay_glBlendEquationSeparate,
+    [TRACE_glDrawBuffers - TRACE_FIRST_COMMAND] = trace_replay_glDrawBuffers,
+    [TRACE_glStencilOpSeparate - TRACE_FIRST_COMMAND] = trace_replay_glStencilOpSeparate,
+    [TRACE_glStencilFuncSeparate - TRACE_FIRST_COMMAND] = trace_replay_glStencilFuncSeparate,
+    [TRACE_glStencilMaskSeparate - TRACE_FIRST_COMMAND] = trace_replay_glStencilMaskSeparate,
+    [TRACE_glAttachShader - TRACE_FIRST_COMMAND] = trace_replay_glAttachShader,
+    [TRACE_glBindAttribLocation - TRACE_FIRST_COMMAND] = trace_replay_glBindAttribLocation,
+    [TRACE_glCompileShader - TRACE_FIRST_COMMAND] = trace_replay_glCompileShader,
+    [TRACE_glCreateProgram - TRACE_FIRST_COMMAND] = trace_replay_glCreateProgram,
+    [TRACE_glCreateShader - TRACE_FIRST_COMMAND] = trace_replay_glCreateShader,
+    [TRACE_glDeleteProgram - TRACE_FIRST_COMMAND] = trace_replay_glDeleteProgram,
+    [TRACE_glDeleteShader - TRACE_FIRST_COMMAND] = trace_replay_glDeleteShader,
+    [TRACE_glDetachShader - TRACE_FIRST_COMMAND] = trace_replay_glDetachShader,
+    [TRACE_glDisableVertexAttribArray - TRACE_FIRST_COMMAND] = trace_replay_glDisableVertexAttribArray,
+    [TRACE_glEnableVertexAttribArray - TRACE_FIRST_COMMAND] = trace_replay_glEnableVertexAttribArray,
+    [TRACE_glGetUniformLocation - TRACE_FIRST_COMMAND] = trace_replay_glGetUniformLocation,
+    [TRACE_glLinkProgram - TRACE_FIRST_COMMAND] = trace_replay_glLinkProgram,
+    [TRACE_glShaderSource - TRACE_FIRST_COMMAND] = trace_replay_glShaderSource,
+    [TRACE_glUseProgram - TRACE_FIRST_COMMAND] = trace_replay_glUseProgram,
+    [TRACE_glUniform1f - TRACE_FIRST_COMMAND] = trace_replay_glUniform1f,
+    [TRACE_glUniform2f - TRACE_FIRST_COMMAND] = trace_replay_glUniform2f,
+    [TRACE_glUniform3f - TRACE_FIRST_COMMAND] = trace_replay_glUniform3f,
+    [TRACE_glUniform4f - TRACE_FIRST_COMMAND] = trace_replay_glUniform4f,
+    [TRACE_glUniform1i - TRACE_FIRST_COMMAND] = trace_replay_glUniform1i,
+    [TRACE_glUniform2i - TRACE_FIRST_COMMAND] = trace_replay_glUniform2i,
+    [TRACE_glUniform3i - TRACE_FIRST_COMMAND] = trace_replay_glUniform3i,
+    [TRACE_glUniform4i - TRACE_FIRST_COMMAND] = trace_replay_glUniform4i,
+    [TRACE_glUniform1fv - TRACE_FIRST_COMMAND] = trace_replay_glUniform1fv,
+    [TRACE_glUniform2fv - TRACE_FIRST_COMMAND] = trace_replay_glUniform2fv,
+    [TRACE_glUniform3fv - TRACE_FIRST_COMMAND] = trace_replay_glUniform3fv,
+    [TRACE_glUniform4fv - TRACE_FIRST_COMMAND] = trace_replay_glUniform4fv,
+    [TRACE_glUniform1iv - TRACE_FIRST_COMMAND] = trace_replay_glUniform1iv,
+    [TRACE_glUniform2iv - TRACE_FIRST_COMMAND] = trace_replay_glUniform2iv,
+    [TRACE_glUniform3iv - TRACE_FIRST_COMMAND] = trace_replay_glUniform3iv,
+    [TRACE_glUniform4iv - TRACE_FIRST_COMMAND] = trace_replay_glUniform4iv,
+    [TRACE_glUniformMatrix2fv - TRACE_FIRST_COMMAND] = trace_replay_glUniformMatrix2fv,
+    [TRACE_glUniformMatrix3fv - TRACE_FIRST_COMMAND] = trace_replay_glUniformMatrix3fv,
+    [TRACE_glUniformMatrix4fv - TRACE_FIRST_COMMAND] = trace_replay_glUniformMatrix4fv,
+    [TRACE_glValidateProgram - TRACE_FIRST_COMMAND] = trace_replay_glValidateProgram,
+    [TRACE_glVertexAttrib1d - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttrib1d,
+    [TRACE_glVertexAttrib1dv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttrib1dv,
+    [TRACE_glVertexAttrib1f - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttrib1f,
+    [TRACE_glVertexAttrib1fv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttrib1fv,
+    [TRACE_glVertexAttrib1s - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttrib1s,
+    [TRACE_glVertexAttrib1sv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttrib1sv,
+    [TRACE_glVertexAttrib2d - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttrib2d,
+    [TRACE_glVertexAttrib2dv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttrib2dv,
+    [TRACE_glVertexAttrib2f - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttrib2f,
+    [TRACE_glVertexAttrib2fv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttrib2fv,
+    [TRACE_glVertexAttrib2s - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttrib2s,
+    [TRACE_glVertexAttrib2sv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttrib2sv,
+    [TRACE_glVertexAttrib3d - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttrib3d,
+    [TRACE_glVertexAttrib3dv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttrib3dv,
+    [TRACE_glVertexAttrib3f - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttrib3f,
+    [TRACE_glVertexAttrib3fv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttrib3fv,
+    [TRACE_glVertexAttrib3s - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttrib3s,
+    [TRACE_glVertexAttrib3sv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttrib3sv,
+    [TRACE_glVertexAttrib4Nbv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttrib4Nbv,
+    [TRACE_glVertexAttrib4Niv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttrib4Niv,
+    [TRACE_glVertexAttrib4Nsv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttrib4Nsv,
+    [TRACE_glVertexAttrib4Nub - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttrib4Nub,
+    [TRACE_glVertexAttrib4Nubv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttrib4Nubv,
+    [TRACE_glVertexAttrib4Nuiv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttrib4Nuiv,
+    [TRACE_glVertexAttrib4Nusv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttrib4Nusv,
+    [TRACE_glVertexAttrib4bv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttrib4bv,
+    [TRACE_glVertexAttrib4d - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttrib4d,
+    [TRACE_glVertexAttrib4dv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttrib4dv,
+    [TRACE_glVertexAttrib4f - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttrib4f,
+    [TRACE_glVertexAttrib4fv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttrib4fv,
+    [TRACE_glVertexAttrib4iv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttrib4iv,
+    [TRACE_glVertexAttrib4s - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttrib4s,
+    [TRACE_glVertexAttrib4sv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttrib4sv,
+    [TRACE_glVertexAttrib4ubv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttrib4ubv,
+    [TRACE_glVertexAttrib4uiv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttrib4uiv,
+    [TRACE_glVertexAttrib4usv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttrib4usv,
+    [TRACE_glVertexAttribPointer - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribPointer,
+#endif
+#if FUNGL_VERSION >= GL_VERSION_2_1
+    [TRACE_glUniformMatrix2x3fv - TRACE_FIRST_COMMAND] = trace_replay_glUniformMatrix2x3fv,
+    [TRACE_glUniformMatrix3x2fv - TRACE_FIRST_COMMAND] = trace_replay_glUniformMatrix3x2fv,
+    [TRACE_glUniformMatrix2x4fv - TRACE_FIRST_COMMAND] = trace_replay_glUniformMatrix2x4fv,
+    [TRACE_glUniformMatrix4x2fv - TRACE_FIRST_COMMAND] = trace_replay_glUniformMatrix4x2fv,
+    [TRACE_glUniformMatrix3x4fv - TRACE_FIRST_COMMAND] = trace_replay_glUniformMatrix3x4fv,
+    [TRACE_glUniformMatrix4x3fv - TRACE_FIRST_COMMAND] = trace_replay_glUniformMatrix4x3fv,
+#endif
+#if FUNGL_VERSION >= GL_VERSION_3_0
+    [TRACE_glColorMaski - TRACE_FIRST_COMMAND] = trace_replay_glColorMaski,
+    [TRACE_glEnablei - TRACE_FIRST_COMMAND] = trace_replay_glEnablei,
+    [TRACE_glDisablei - TRACE_FIRST_COMMAND] = trace_replay_glDisablei,
+    [TRACE_glBeginTransformFeedback - TRACE_FIRST_COMMAND] = trace_replay_glBeginTransformFeedback,
+    [TRACE_glEndTransformFeedback - TRACE_FIRST_COMMAND] = trace_replay_glEndTransformFeedback,
+    [TRACE_glBindBufferRange - TRACE_FIRST_COMMAND] = trace_replay_glBindBufferRange,
+    [TRACE_glBindBufferBase - TRACE_FIRST_COMMAND] = trace_replay_glBindBufferBase,
+    [TRACE_glTransformFeedbackVaryings - TRACE_FIRST_COMMAND] = trace_replay_glTransformFeedbackVaryings,
+    [TRACE_glClampColor - TRACE_FIRST_COMMAND] = trace_replay_glClampColor,
+    [TRACE_glBeginConditionalRender - TRACE_FIRST_COMMAND] = trace_replay_glBeginConditionalRender,
+    [TRACE_glEndConditionalRender - TRACE_FIRST_COMMAND] = trace_replay_glEndConditionalRender,
+    [TRACE_glVertexAttribIPointer - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribIPointer,
+    [TRACE_glVertexAttribI1i - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribI1i,
+    [TRACE_glVertexAttribI2i - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribI2i,
+    [TRACE_glVertexAttribI3i - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribI3i,
+    [TRACE_glVertexAttribI4i - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribI4i,
+    [TRACE_glVertexAttribI1ui - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribI1ui,
+    [TRACE_glVertexAttribI2ui - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribI2ui,
+    [TRACE_glVertexAttribI3ui - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribI3ui,
+    [TRACE_glVertexAttribI4ui - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribI4ui,
+    [TRACE_glVertexAttribI1iv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribI1iv,
+    [TRACE_glVertexAttribI2iv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribI2iv,
+    [TRACE_glVertexAttribI3iv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribI3iv,
+    [TRACE_glVertexAttribI4iv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribI4iv,
+    [TRACE_glVertexAttribI1uiv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribI1uiv,
+    [TRACE_glVertexAttribI2uiv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribI2uiv,
+    [TRACE_glVertexAttribI3uiv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribI3uiv,
+    [TRACE_glVertexAttribI4uiv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribI4uiv,
+    [TRACE_glVertexAttribI4bv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribI4bv,
+    [TRACE_glVertexAttribI4sv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribI4sv,
+    [TRACE_glVertexAttribI4ubv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribI4ubv,
+    [TRACE_glVertexAttribI4usv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribI4usv,
+    [TRACE_glBindFragDataLocation - TRACE_FIRST_COMMAND] = trace_replay_glBindFragDataLocation,
+    [TRACE_glUniform1ui - TRACE_FIRST_COMMAND] = trace_replay_glUniform1ui,
+    [TRACE_glUniform2ui - TRACE_FIRST_COMMAND] = trace_replay_glUniform2ui,
+    [TRACE_glUniform3ui - TRACE_FIRST_COMMAND] = trace_replay_glUniform3ui,
+    [TRACE_glUniform4ui - TRACE_FIRST_COMMAND] = trace_replay_glUniform4ui,
+    [TRACE_glUniform1uiv - TRACE_FIRST_COMMAND] = trace_replay_glUniform1uiv,
+    [TRACE_glUniform2uiv - TRACE_FIRST_COMMAND] = trace_replay_glUniform2uiv,
+    [TRACE_glUniform3uiv - TRACE_FIRST_COMMAND] = trace_replay_glUniform3uiv,
+    [TRACE_glUniform4uiv - TRACE_FIRST_COMMAND] = trace_replay_glUniform4uiv,
+    [TRACE_glTexParameterIiv - TRACE_FIRST_COMMAND] = trace_replay_glTexParameterIiv,
+    [TRACE_glTexParameterIuiv - TRACE_FIRST_COMMAND] = trace_replay_glTexParameterIuiv,
+    [TRACE_glClearBufferiv - TRACE_FIRST_COMMAND] = trace_replay_glClearBufferiv,
+    [TRACE_glClearBufferuiv - TRACE_FIRST_COMMAND] = trace_replay_glClearBufferuiv,
+    [TRACE_glClearBufferfv - TRACE_FIRST_COMMAND] = trace_replay_glClearBufferfv,
+    [TRACE_glClearBufferfi - TRACE_FIRST_COMMAND] = trace_replay_glClearBufferfi,
+    [TRACE_glBindRenderbuffer - TRACE_FIRST_COMMAND] = trace_replay_glBindRenderbuffer,
+    [TRACE_glDeleteRenderbuffers - TRACE_FIRST_COMMAND] = trace_replay_glDeleteRenderbuffers,
+    [TRACE_glGenRenderbuffers - TRACE_FIRST_COMMAND] = trace_replay_glGenRenderbuffers,
+    [TRACE_glRenderbufferStorage - TRACE_FIRST_COMMAND] = trace_replay_glRenderbufferStorage,
+    [TRACE_glBindFramebuffer - TRACE_FIRST_COMMAND] = trace_replay_glBindFramebuffer,
+    [TRACE_glDeleteFramebuffers - TRACE_FIRST_COMMAND] = trace_replay_glDeleteFramebuffers,
+    [TRACE_glGenFramebuffers - TRACE_FIRST_COMMAND] = trace_replay_glGenFramebuffers,
+    [TRACE_glFramebufferTexture1D - TRACE_FIRST_COMMAND] = trace_replay_glFramebufferTexture1D,
+    [TRACE_glFramebufferTexture2D - TRACE_FIRST_COMMAND] = trace_replay_glFramebufferTexture2D,
+    [TRACE_glFramebufferTexture3D - TRACE_FIRST_COMMAND] = trace_replay_glFramebufferTexture3D,
+    [TRACE_glFramebufferRenderbuffer - TRACE_FIRST_COMMAND] = trace_replay_glFramebufferRenderbuffer,
+    [TRACE_glGenerateMipmap - TRACE_FIRST_COMMAND] = trace_replay_glGenerateMipmap,
+    [TRACE_glBlitFramebuffer - TRACE_FIRST_COMMAND] = trace_replay_glBlitFramebuffer,
+    [TRACE_glRenderbufferStorageMultisample - TRACE_FIRST_COMMAND] = trace_replay_glRenderbufferStorageMultisample,
+    [TRACE_glFramebufferTextureLayer - TRACE_FIRST_COMMAND] = trace_replay_glFramebufferTextureLayer,
+    [TRACE_glMapBufferRange - TRACE_FIRST_COMMAND] = trace_replay_glMapBufferRange,
+    [TRACE_glFlushMappedBufferRange - TRACE_FIRST_COMMAND] = trace_replay_glFlushMappedBufferRange,
+    [TRACE_glBindVertexArray - TRACE_FIRST_COMMAND] = trace_replay_glBindVertexArray,
+    [TRACE_glDeleteVertexArrays - TRACE_FIRST_COMMAND] = trace_replay_glDeleteVertexArrays,
+    [TRACE_glGenVertexArrays - TRACE_FIRST_COMMAND] = trace_replay_glGenVertexArrays,
+#endif
+#if FUNGL_VERSION >= GL_VERSION_3_1
+    [TRACE_glDrawArraysInstanced - TRACE_FIRST_COMMAND] = trace_replay_glDrawArraysInstanced,
+    [TRACE_glDrawElementsInstanced - TRACE_FIRST_COMMAND] = trace_replay_glDrawElementsInstanced,
+    [TRACE_glTexBuffer - TRACE_FIRST_COMMAND] = trace_replay_glTexBuffer,
+    [TRACE_glPrimitiveRestartIndex - TRACE_FIRST_COMMAND] = trace_replay_glPrimitiveRestartIndex,
+    [TRACE_glCopyBufferSubData - TRACE_FIRST_COMMAND] = trace_replay_glCopyBufferSubData,
+    [TRACE_glUniformBlockBinding - TRACE_FIRST_COMMAND] = trace_replay_glUniformBlockBinding,
+#endif
+#if FUNGL_VERSION >= GL_VERSION_3_2
+    [TRACE_glDrawElementsBaseVertex - TRACE_FIRST_COMMAND] = trace_replay_glDrawElementsBaseVertex,
+    [TRACE_glDrawRangeElementsBaseVertex - TRACE_FIRST_COMMAND] = trace_replay_glDrawRangeElementsBaseVertex,
+    [TRACE_glDrawElementsInstancedBaseVertex - TRACE_FIRST_COMMAND] = trace_replay_glDrawElementsInstancedBaseVertex,
+    [TRACE_glMultiDrawElementsBaseVertex - TRACE_FIRST_COMMAND] = trace_replay_glMultiDrawElementsBaseVertex,
+    [TRACE_glProvokingVertex - TRACE_FIRST_COMMAND] = trace_replay_glProvokingVertex,
+    [TRACE_glFenceSync - TRACE_FIRST_COMMAND] = trace_replay_glFenceSync,
+    [TRACE_glDeleteSync - TRACE_FIRST_COMMAND] = trace_replay_glDeleteSync,
+    [TRACE_glClientWaitSync - TRACE_FIRST_COMMAND] = trace_replay_glClientWaitSync,
+    [TRACE_glWaitSync - TRACE_FIRST_COMMAND] = trace_replay_glWaitSync,
+    [TRACE_glFramebufferTexture - TRACE_FIRST_COMMAND] = trace_replay_glFramebufferTexture,
+    [TRACE_glTexImage2DMultisample - TRACE_FIRST_COMMAND] = trace_replay_glTexImage2DMultisample,
+    [TRACE_glTexImage3DMultisample - TRACE_FIRST_COMMAND] = trace_replay_glTexImage3DMultisample,
+    [TRACE_glSampleMaski - TRACE_FIRST_COMMAND] = trace_replay_glSampleMaski,
+#endif
+#if FUNGL_VERSION >= GL_VERSION_3_3
+    [TRACE_glBindFragDataLocationIndexed - TRACE_FIRST_COMMAND] = trace_replay_glBindFragDataLocationIndexed,
+    [TRACE_glGenSamplers - TRACE_FIRST_COMMAND] = trace_replay_glGenSamplers,
+    [TRACE_glDeleteSamplers - TRACE_FIRST_COMMAND] = trace_replay_glDeleteSamplers,
+    [TRACE_glBindSampler - TRACE_FIRST_COMMAND] = trace_replay_glBindSampler,
+    [TRACE_glSamplerParameteri - TRACE_FIRST_COMMAND] = trace_replay_glSamplerParameteri,
+    [TRACE_glSamplerParameteriv - TRACE_FIRST_COMMAND] = trace_replay_glSamplerParameteriv,
+    [TRACE_glSamplerParameterf - TRACE_FIRST_COMMAND] = trace_replay_glSamplerParameterf,
+    [TRACE_glSamplerParameterfv - TRACE_FIRST_COMMAND] = trace_replay_glSamplerParameterfv,
+    [TRACE_glSamplerParameterIiv - TRACE_FIRST_COMMAND] = trace_replay_glSamplerParameterIiv,
+    [TRACE_glSamplerParameterIuiv - TRACE_FIRST_COMMAND] = trace_replay_glSamplerParameterIuiv,
+    [TRACE_glQueryCounter - TRACE_FIRST_COMMAND] = trace_replay_glQueryCounter,
+    [TRACE_glVertexAttribDivisor - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribDivisor,
+    [TRACE_glVertexAttribP1ui - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribP1ui,
+    [TRACE_glVertexAttribP1uiv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribP1uiv,
+    [TRACE_glVertexAttribP2ui - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribP2ui,
+    [TRACE_glVertexAttribP2uiv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribP2uiv,
+    [TRACE_glVertexAttribP3ui - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribP3ui,
+    [TRACE_glVertexAttribP3uiv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribP3uiv,
+    [TRACE_glVertexAttribP4ui - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribP4ui,
+    [TRACE_glVertexAttribP4uiv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribP4uiv,
+    [TRACE_glVertexP2ui - TRACE_FIRST_COMMAND] = trace_replay_glVertexP2ui,
+    [TRACE_glVertexP2uiv - TRACE_FIRST_COMMAND] = trace_replay_glVertexP2uiv,
+    [TRACE_glVertexP3ui - TRACE_FIRST_COMMAND] = trace_replay_glVertexP3ui,
+    [TRACE_glVertexP3uiv - TRACE_FIRST_COMMAND] = trace_replay_glVertexP3uiv,
+    [TRACE_glVertexP4ui - TRACE_FIRST_COMMAND] = trace_replay_glVertexP4ui,
+    [TRACE_glVertexP4uiv - TRACE_FIRST_COMMAND] = trace_replay_glVertexP4uiv,
+    [TRACE_glTexCoordP1ui - TRACE_FIRST_COMMAND] = trace_replay_glTexCoordP1ui,
+    [TRACE_glTexCoordP1uiv - TRACE_FIRST_COMMAND] = trace_replay_glTexCoordP1uiv,
+    [TRACE_glTexCoordP2ui - TRACE_FIRST_COMMAND] = trace_replay_glTexCoordP2ui,
+    [TRACE_glTexCoordP2uiv - TRACE_FIRST_COMMAND] = trace_replay_glTexCoordP2uiv,
+    [TRACE_glTexCoordP3ui - TRACE_FIRST_COMMAND] = trace_replay_glTexCoordP3ui,
+    [TRACE_glTexCoordP3uiv - TRACE_FIRST_COMMAND] = trace_replay_glTexCoordP3uiv,
+    [TRACE_glTexCoordP4ui - TRACE_FIRST_COMMAND] = trace_replay_glTexCoordP4ui,
+    [TRACE_glTexCoordP4uiv - TRACE_FIRST_COMMAND] = trace_replay_glTexCoordP4uiv,
+    [TRACE_glMultiTexCoordP1ui - TRACE_FIRST_COMMAND] = trace_replay_glMultiTexCoordP1ui,
+    [TRACE_glMultiTexCoordP1uiv - TRACE_FIRST_COMMAND] = trace_replay_glMultiTexCoordP1uiv,
+    [TRACE_glMultiTexCoordP2ui - TRACE_FIRST_COMMAND] = trace_replay_glMultiTexCoordP2ui,
+    [TRACE_glMultiTexCoordP2uiv - TRACE_FIRST_COMMAND] = trace_replay_glMultiTexCoordP2uiv,
+    [TRACE_glMultiTexCoordP3ui - TRACE_FIRST_COMMAND] = trace_replay_glMultiTexCoordP3ui,
+    [TRACE_glMultiTexCoordP3uiv - TRACE_FIRST_COMMAND] = trace_replay_glMultiTexCoordP3uiv,
+    [TRACE_glMultiTexCoordP4ui - TRACE_FIRST_COMMAND] = trace_replay_glMultiTexCoordP4ui,
+    [TRACE_glMultiTexCoordP4uiv - TRACE_FIRST_COMMAND] = trace_replay_glMultiTexCoordP4uiv,
+    [TRACE_glNormalP3ui - TRACE_FIRST_COMMAND] = trace_replay_glNormalP3ui,
+    [TRACE_glNormalP3uiv - TRACE_FIRST_COMMAND] = trace_replay_glNormalP3uiv,
+    [TRACE_glColorP3ui - TRACE_FIRST_COMMAND] = trace_replay_glColorP3ui,
+    [TRACE_glColorP3uiv - TRACE_FIRST_COMMAND] = trace_replay_glColorP3uiv,
+    [TRACE_glColorP4ui - TRACE_FIRST_COMMAND] = trace_replay_glColorP4ui,
+    [TRACE_glColorP4uiv - TRACE_FIRST_COMMAND] = trace_replay_glColorP4uiv,
+    [TRACE_glSecondaryColorP3ui - TRACE_FIRST_COMMAND] = trace_replay_glSecondaryColorP3ui,
+    [TRACE_glSecondaryColorP3uiv - TRACE_FIRST_COMMAND] = trace_replay_glSecondaryColorP3uiv,
+#endif
+#if FUNGL_VERSION >= GL_VERSION_4_0
+    [TRACE_glMinSampleShading - TRACE_FIRST_COMMAND] = trace_replay_glMinSampleShading,
+    [TRACE_glBlendEquationi - TRACE_FIRST_COMMAND] = trace_replay_glBlendEquationi,
+    [TRACE_glBlendEquationSeparatei - TRACE_FIRST_COMMAND] = trace_replay_glBlendEquationSeparatei,
+    [TRACE_glBlendFunci - TRACE_FIRST_COMMAND] = trace_replay_glBlendFunci,
+    [TRACE_glBlendFuncSeparatei - TRACE_FIRST_COMMAND] = trace_replay_glBlendFuncSeparatei,
+    [TRACE_glDrawArraysIndirect - TRACE_FIRST_COMMAND] = trace_replay_glDrawArraysIndirect,
+    [TRACE_glDrawElementsIndirect - TRACE_FIRST_COMMAND] = trace_replay_glDrawElementsIndirect,
+    [TRACE_glUniform1d - TRACE_FIRST_COMMAND] = trace_replay_glUniform1d,
+    [TRACE_glUniform2d - TRACE_FIRST_COMMAND] = trace_replay_glUniform2d,
+    [TRACE_glUniform3d - TRACE_FIRST_COMMAND] = trace_replay_glUniform3d,
+    [TRACE_glUniform4d - TRACE_FIRST_COMMAND] = trace_replay_glUniform4d,
+    [TRACE_glUniform1dv - TRACE_FIRST_COMMAND] = trace_replay_glUniform1dv,
+    [TRACE_glUniform2dv - TRACE_FIRST_COMMAND] = trace_replay_glUniform2dv,
+    [TRACE_glUniform3dv - TRACE_FIRST_COMMAND] = trace_replay_glUniform3dv,
+    [TRACE_glUniform4dv - TRACE_FIRST_COMMAND] = trace_replay_glUniform4dv,
+    [TRACE_glUniformMatrix2dv - TRACE_FIRST_COMMAND] = trace_replay_glUniformMatrix2dv,
+    [TRACE_glUniformMatrix3dv - TRACE_FIRST_COMMAND] = trace_replay_glUniformMatrix3dv,
+    [TRACE_glUniformMatrix4dv - TRACE_FIRST_COMMAND] = trace_replay_glUniformMatrix4dv,
+    [TRACE_glUniformMatrix2x3dv - TRACE_FIRST_COMMAND] = trace_replay_glUniformMatrix2x3dv,
+    [TRACE_glUniformMatrix2x4dv - TRACE_FIRST_COMMAND] = trace_replay_glUniformMatrix2x4dv,
+    [TRACE_glUniformMatrix3x2dv - TRACE_FIRST_COMMAND] = trace_replay_glUniformMatrix3x2dv,
+    [TRACE_glUniformMatrix3x4dv - TRACE_FIRST_COMMAND] = trace_replay_glUniformMatrix3x4dv,
+    [TRACE_glUniformMatrix4x2dv - TRACE_FIRST_COMMAND] = trace_replay_glUniformMatrix4x2dv,
+    [TRACE_glUniformMatrix4x3dv - TRACE_FIRST_COMMAND] = trace_replay_glUniformMatrix4x3dv,
+    [TRACE_glUniformSubroutinesuiv - TRACE_FIRST_COMMAND] = trace_replay_glUniformSubroutinesuiv,
+    [TRACE_glPatchParameteri - TRACE_FIRST_COMMAND] = trace_replay_glPatchParameteri,
+    [TRACE_glPatchParameterfv - TRACE_FIRST_COMMAND] = trace_replay_glPatchParameterfv,
+    [TRACE_glBindTransformFeedback - TRACE_FIRST_COMMAND] = trace_replay_glBindTransformFeedback,
+    [TRACE_glDeleteTransformFeedbacks - TRACE_FIRST_COMMAND] = trace_replay_glDeleteTransformFeedbacks,
+    [TRACE_glGenTransformFeedbacks - TRACE_FIRST_COMMAND] = trace_replay_glGenTransformFeedbacks,
+    [TRACE_glPauseTransformFeedback - TRACE_FIRST_COMMAND] = trace_replay_glPauseTransformFeedback,
+    [TRACE_glResumeTransformFeedback - TRACE_FIRST_COMMAND] = trace_replay_glResumeTransformFeedback,
+    [TRACE_glDrawTransformFeedback - TRACE_FIRST_COMMAND] = trace_replay_glDrawTransformFeedback,
+    [TRACE_glDrawTransformFeedbackStream - TRACE_FIRST_COMMAND] = trace_replay_glDrawTransformFeedbackStream,
+    [TRACE_glBeginQueryIndexed - TRACE_FIRST_COMMAND] = trace_replay_glBeginQueryIndexed,
+    [TRACE_glEndQueryIndexed - TRACE_FIRST_COMMAND] = trace_replay_glEndQueryIndexed,
+#endif
+#if FUNGL_VERSION >= GL_VERSION_4_1
+    [TRACE_glReleaseShaderCompiler - TRACE_FIRST_COMMAND] = trace_replay_glReleaseShaderCompiler,
+    [TRACE_glShaderBinary - TRACE_FIRST_COMMAND] = trace_replay_glShaderBinary,
+    [TRACE_glDepthRangef - TRACE_FIRST_COMMAND] = trace_replay_glDepthRangef,
+    [TRACE_glClearDepthf - TRACE_FIRST_COMMAND] = trace_replay_glClearDepthf,
+    [TRACE_glProgramBinary - TRACE_FIRST_COMMAND] = trace_replay_glProgramBinary,
+    [TRACE_glProgramParameteri - TRACE_FIRST_COMMAND] = trace_replay_glProgramParameteri,
+    [TRACE_glUseProgramStages - TRACE_FIRST_COMMAND] = trace_replay_glUseProgramStages,
+    [TRACE_glActiveShaderProgram - TRACE_FIRST_COMMAND] = trace_replay_glActiveShaderProgram,
+    [TRACE_glCreateShaderProgramv - TRACE_FIRST_COMMAND] = trace_replay_glCreateShaderProgramv,
+    [TRACE_glBindProgramPipeline - TRACE_FIRST_COMMAND] = trace_replay_glBindProgramPipeline,
+    [TRACE_glDeleteProgramPipelines - TRACE_FIRST_COMMAND] = trace_replay_glDeleteProgramPipelines,
+    [TRACE_glGenProgramPipelines - TRACE_FIRST_COMMAND] = trace_replay_glGenProgramPipelines,
+    [TRACE_glProgramUniform1i - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniform1i,
+    [TRACE_glProgramUniform1iv - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniform1iv,
+    [TRACE_glProgramUniform1f - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniform1f,
+    [TRACE_glProgramUniform1fv - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniform1fv,
+    [TRACE_glProgramUniform1d - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniform1d,
+    [TRACE_glProgramUniform1dv - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniform1dv,
+    [TRACE_glProgramUniform1ui - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniform1ui,
+    [TRACE_glProgramUniform1uiv - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniform1uiv,
+    [TRACE_glProgramUniform2i - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniform2i,
+    [TRACE_glProgramUniform2iv - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniform2iv,
+    [TRACE_glProgramUniform2f - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniform2f,
+    [TRACE_glProgramUniform2fv - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniform2fv,
+    [TRACE_glProgramUniform2d - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniform2d,
+    [TRACE_glProgramUniform2dv - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniform2dv,
+    [TRACE_glProgramUniform2ui - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniform2ui,
+    [TRACE_glProgramUniform2uiv - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniform2uiv,
+    [TRACE_glProgramUniform3i - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniform3i,
+    [TRACE_glProgramUniform3iv - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniform3iv,
+    [TRACE_glProgramUniform3f - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniform3f,
+    [TRACE_glProgramUniform3fv - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniform3fv,
+    [TRACE_glProgramUniform3d - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniform3d,
+    [TRACE_glProgramUniform3dv - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniform3dv,
+    [TRACE_glProgramUniform3ui - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniform3ui,
+    [TRACE_glProgramUniform3uiv - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniform3uiv,
+    [TRACE_glProgramUniform4i - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniform4i,
+    [TRACE_glProgramUniform4iv - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniform4iv,
+    [TRACE_glProgramUniform4f - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniform4f,
+    [TRACE_glProgramUniform4fv - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniform4fv,
+    [TRACE_glProgramUniform4d - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniform4d,
+    [TRACE_glProgramUniform4dv - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniform4dv,
+    [TRACE_glProgramUniform4ui - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniform4ui,
+    [TRACE_glProgramUniform4uiv - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniform4uiv,
+    [TRACE_glProgramUniformMatrix2fv - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniformMatrix2fv,
+    [TRACE_glProgramUniformMatrix3fv - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniformMatrix3fv,
+    [TRACE_glProgramUniformMatrix4fv - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniformMatrix4fv,
+    [TRACE_glProgramUniformMatrix2dv - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniformMatrix2dv,
+    [TRACE_glProgramUniformMatrix3dv - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniformMatrix3dv,
+    [TRACE_glProgramUniformMatrix4dv - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniformMatrix4dv,
+    [TRACE_glProgramUniformMatrix2x3fv - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniformMatrix2x3fv,
+    [TRACE_glProgramUniformMatrix3x2fv - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniformMatrix3x2fv,
+    [TRACE_glProgramUniformMatrix2x4fv - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniformMatrix2x4fv,
+    [TRACE_glProgramUniformMatrix4x2fv - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniformMatrix4x2fv,
+    [TRACE_glProgramUniformMatrix3x4fv - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniformMatrix3x4fv,
+    [TRACE_glProgramUniformMatrix4x3fv - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniformMatrix4x3fv,
+    [TRACE_glProgramUniformMatrix2x3dv - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniformMatrix2x3dv,
+    [TRACE_glProgramUniformMatrix3x2dv - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniformMatrix3x2dv,
+    [TRACE_glProgramUniformMatrix2x4dv - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniformMatrix2x4dv,
+    [TRACE_glProgramUniformMatrix4x2dv - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniformMatrix4x2dv,
+    [TRACE_glProgramUniformMatrix3x4dv - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniformMatrix3x4dv,
+    [TRACE_glProgramUniformMatrix4x3dv - TRACE_FIRST_COMMAND] = trace_replay_glProgramUniformMatrix4x3dv,
+    [TRACE_glValidateProgramPipeline - TRACE_FIRST_COMMAND] = trace_replay_glValidateProgramPipeline,
+    [TRACE_glVertexAttribL1d - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribL1d,
+    [TRACE_glVertexAttribL2d - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribL2d,
+    [TRACE_glVertexAttribL3d - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribL3d,
+    [TRACE_glVertexAttribL4d - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribL4d,
+    [TRACE_glVertexAttribL1dv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribL1dv,
+    [TRACE_glVertexAttribL2dv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribL2dv,
+    [TRACE_glVertexAttribL3dv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribL3dv,
+    [TRACE_glVertexAttribL4dv - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribL4dv,
+    [TRACE_glVertexAttribLPointer - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribLPointer,
+    [TRACE_glViewportArrayv - TRACE_FIRST_COMMAND] = trace_replay_glViewportArrayv,
+    [TRACE_glViewportIndexedf - TRACE_FIRST_COMMAND] = trace_replay_glViewportIndexedf,
+    [TRACE_glViewportIndexedfv - TRACE_FIRST_COMMAND] = trace_replay_glViewportIndexedfv,
+    [TRACE_glScissorArrayv - TRACE_FIRST_COMMAND] = trace_replay_glScissorArrayv,
+    [TRACE_glScissorIndexed - TRACE_FIRST_COMMAND] = trace_replay_glScissorIndexed,
+    [TRACE_glScissorIndexedv - TRACE_FIRST_COMMAND] = trace_replay_glScissorIndexedv,
+    [TRACE_glDepthRangeArrayv - TRACE_FIRST_COMMAND] = trace_replay_glDepthRangeArrayv,
+    [TRACE_glDepthRangeIndexed - TRACE_FIRST_COMMAND] = trace_replay_glDepthRangeIndexed,
+#endif
+#if FUNGL_VERSION >= GL_VERSION_4_2
+    [TRACE_glDrawArraysInstancedBaseInstance - TRACE_FIRST_COMMAND] = trace_replay_glDrawArraysInstancedBaseInstance,
+    [TRACE_glDrawElementsInstancedBaseInstance - TRACE_FIRST_COMMAND] = trace_replay_glDrawElementsInstancedBaseInstance,
+    [TRACE_glDrawElementsInstancedBaseVertexBaseInstance - TRACE_FIRST_COMMAND] = trace_replay_glDrawElementsInstancedBaseVertexBaseInstance,
+    [TRACE_glBindImageTexture - TRACE_FIRST_COMMAND] = trace_replay_glBindImageTexture,
+    [TRACE_glMemoryBarrier - TRACE_FIRST_COMMAND] = trace_replay_glMemoryBarrier,
+    [TRACE_glTexStorage1D - TRACE_FIRST_COMMAND] = trace_replay_glTexStorage1D,
+    [TRACE_glTexStorage2D - TRACE_FIRST_COMMAND] = trace_replay_glTexStorage2D,
+    [TRACE_glTexStorage3D - TRACE_FIRST_COMMAND] = trace_replay_glTexStorage3D,
+    [TRACE_glDrawTransformFeedbackInstanced - TRACE_FIRST_COMMAND] = trace_replay_glDrawTransformFeedbackInstanced,
+    [TRACE_glDrawTransformFeedbackStreamInstanced - TRACE_FIRST_COMMAND] = trace_replay_glDrawTransformFeedbackStreamInstanced,
+#endif
+#if FUNGL_VERSION >= GL_VERSION_4_3
+    [TRACE_glClearBufferData - TRACE_FIRST_COMMAND] = trace_replay_glClearBufferData,
+    [TRACE_glClearBufferSubData - TRACE_FIRST_COMMAND] = trace_replay_glClearBufferSubData,
+    [TRACE_glDispatchCompute - TRACE_FIRST_COMMAND] = trace_replay_glDispatchCompute,
+    [TRACE_glDispatchComputeIndirect - TRACE_FIRST_COMMAND] = trace_replay_glDispatchComputeIndirect,
+    [TRACE_glCopyImageSubData - TRACE_FIRST_COMMAND] = trace_replay_glCopyImageSubData,
+    [TRACE_glFramebufferParameteri - TRACE_FIRST_COMMAND] = trace_replay_glFramebufferParameteri,
+    [TRACE_glInvalidateTexSubImage - TRACE_FIRST_COMMAND] = trace_replay_glInvalidateTexSubImage,
+    [TRACE_glInvalidateTexImage - TRACE_FIRST_COMMAND] = trace_replay_glInvalidateTexImage,
+    [TRACE_glInvalidateBufferSubData - TRACE_FIRST_COMMAND] = trace_replay_glInvalidateBufferSubData,
+    [TRACE_glInvalidateBufferData - TRACE_FIRST_COMMAND] = trace_replay_glInvalidateBufferData,
+    [TRACE_glInvalidateFramebuffer - TRACE_FIRST_COMMAND] = trace_replay_glInvalidateFramebuffer,
+    [TRACE_glInvalidateSubFramebuffer - TRACE_FIRST_COMMAND] = trace_replay_glInvalidateSubFramebuffer,
+    [TRACE_glMultiDrawArraysIndirect - TRACE_FIRST_COMMAND] = trace_replay_glMultiDrawArraysIndirect,
+    [TRACE_glMultiDrawElementsIndirect - TRACE_FIRST_COMMAND] = trace_replay_glMultiDrawElementsIndirect,
+    [TRACE_glShaderStorageBlockBinding - TRACE_FIRST_COMMAND] = trace_replay_glShaderStorageBlockBinding,
+    [TRACE_glTexBufferRange - TRACE_FIRST_COMMAND] = trace_replay_glTexBufferRange,
+    [TRACE_glTexStorage2DMultisample - TRACE_FIRST_COMMAND] = trace_replay_glTexStorage2DMultisample,
+    [TRACE_glTexStorage3DMultisample - TRACE_FIRST_COMMAND] = trace_replay_glTexStorage3DMultisample,
+    [TRACE_glTextureView - TRACE_FIRST_COMMAND] = trace_replay_glTextureView,
+    [TRACE_glBindVertexBuffer - TRACE_FIRST_COMMAND] = trace_replay_glBindVertexBuffer,
+    [TRACE_glVertexAttribFormat - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribFormat,
+    [TRACE_glVertexAttribIFormat - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribIFormat,
+    [TRACE_glVertexAttribLFormat - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribLFormat,
+    [TRACE_glVertexAttribBinding - TRACE_FIRST_COMMAND] = trace_replay_glVertexAttribBinding,
+    [TRACE_glVertexBindingDivisor - TRACE_FIRST_COMMAND] = trace_replay_glVertexBindingDivisor,
+    [TRACE_glDebugMessageControl - TRACE_FIRST_COMMAND] = trace_replay_glDebugMessageControl,
+    [TRACE_glDebugMessageInsert - TRACE_FIRST_COMMAND] = trace_replay_glDebugMessageInsert,
+    [TRACE_glPushDebugGroup - TRACE_FIRST_COMMAND] = trace_replay_glPushDebugGroup,
+    [TRACE_glPopDebugGroup - TRACE_FIRST_COMMAND] = trace_replay_glPopDebugGroup,
+    [TRACE_glObjectLabel - TRACE_FIRST_COMMAND] = trace_replay_glObjectLabel,
+    [TRACE_glObjectPtrLabel - TRACE_FIRST_COMMAND] = trace_replay_glObjectPtrLabel,
+#endif
+#if FUNGL_VERSION >= GL_VERSION_4_4
+    [TRACE_glBufferStorage - TRACE_FIRST_COMMAND] = trace_replay_glBufferStorage,
+    [TRACE_glClearTexImage - TRACE_FIRST_COMMAND] = trace_replay_glClearTexImage,
+    [TRACE_glClearTexSubImage - TRACE_FIRST_COMMAND] = trace_replay_glClearTexSubImage,
+    [TRACE_glBindBuffersBase - TRACE_FIRST_COMMAND] = trace_replay_glBindBuffersBase,
+    [TRACE_glBindBuffersRange - TRACE_FIRST_COMMAND] = trace_replay_glBindBuffersRange,
+    [TRACE_glBindTextures - TRACE_FIRST_COMMAND] = trace_replay_glBindTextures,
+    [TRACE_glBindSamplers - TRACE_FIRST_COMMAND] = trace_replay_glBindSamplers,
+    [TRACE_glBindImageTextures - TRACE_FIRST_COMMAND] = trace_replay_glBindImageTextures,
+    [TRACE_glBindVertexBuffers - TRACE_FIRST_COMMAND] = trace_replay_glBindVertexBuffers,
+#endif
+#if FUNGL_VERSION >= GL_VERSION_4_5
+    [TRACE_glClipControl - TRACE_FIRST_COMMAND] = trace_replay_glClipControl,
+    [TRACE_glCreateTransformFeedbacks - TRACE_FIRST_COMMAND] = trace_replay_glCreateTransformFeedbacks,
+    [TRACE_glTransformFeedbackBufferBase - TRACE_FIRST_COMMAND] = trace_replay_glTransformFeedbackBufferBase,
+    [TRACE_glTransformFeedbackBufferRange - TRACE_FIRST_COMMAND] = trace_replay_glTransformFeedbackBufferRange,
+    [TRACE_glCreateBuffers - TRACE_FIRST_COMMAND] = trace_replay_glCreateBuffers,
+    [TRACE_glNamedBufferStorage - TRACE_FIRST_COMMAND] = trace_replay_glNamedBufferStorage,
+    [TRACE_glNamedBufferData - TRACE_FIRST_COMMAND] = trace_replay_glNamedBufferData,
+    [TRACE_glNamedBufferSubData - TRACE_FIRST_COMMAND] = trace_replay_glNamedBufferSubData,
+    [TRACE_glCopyNamedBufferSubData - TRACE_FIRST_COMMAND] = trace_replay_glCopyNamedBufferSubData,
+    [TRACE_glClearNamedBufferData - TRACE_FIRST_COMMAND] = trace_replay_glClearNamedBufferData,
+    [TRACE_glClearNamedBufferSubData - TRACE_FIRST_COMMAND] = trace_replay_glClearNamedBufferSubData,
+    [TRACE_glMapNamedBuffer - TRACE_FIRST_COMMAND] = trace_replay_glMapNamedBuffer,
+    [TRACE_glMapNamedBufferRange - TRACE_FIRST_COMMAND] = trace_replay_glMapNamedBufferRange,
+    [TRACE_glUnmapNamedBuffer - TRACE_FIRST_COMMAND] = trace_replay_glUnmapNamedBuffer,
+    [TRACE_glFlushMappedNamedBufferRange - TRACE_FIRST_COMMAND] = trace_replay_glFlushMappedNamedBufferRange,
+    [TRACE_glCreateFramebuffers - TRACE_FIRST_COMMAND] = trace_replay_glCreateFramebuffers,
+    [TRACE_glNamedFramebufferRenderbuffer - TRACE_FIRST_COMMAND] = trace_replay_glNamedFramebufferRenderbuffer,
+    [TRACE_glNamedFramebufferParameteri - TRACE_FIRST_COMMAND] = trace_replay_glNamedFramebufferParameteri,
+    [TRACE_glNamedFramebufferTexture - TRACE_FIRST_COMMAND] = trace_replay_glNamedFramebufferTexture,
+    [TRACE_glNamedFramebufferTextureLayer - TRACE_FIRST_COMMAND] = trace_replay_glNamedFramebufferTextureLayer,
+    [TRACE_glNamedFramebufferDrawBuffer - TRACE_FIRST_COMMAND] = trace_replay_glNamedFramebufferDrawBuffer,
+    [TRACE_glNamedFramebufferDrawBuffers - TRACE_FIRST_COMMAND] = trace_replay_glNamedFramebufferDrawBuffers,
+    [TRACE_glNamedFramebufferReadBuffer - TRACE_FIRST_COMMAND] = trace_replay_glNamedFramebufferReadBuffer,
+    [TRACE_glInvalidateNamedFramebufferData - TRACE_FIRST_COMMAND] = trace_replay_glInvalidateNamedFramebufferData,
+    [TRACE_glInvalidateNamedFramebufferSubData - TRACE_FIRST_COMMAND] = trace_replay_glInvalidateNamedFramebufferSubData,
+    [TRACE_glClearNamedFramebufferiv - TRACE_FIRST_COMMAND] = trace_replay_glClearNamedFramebufferiv,
+    [TRACE_glClearNamedFramebufferuiv - TRACE_FIRST_COMMAND] = trace_replay_glClearNamedFramebufferuiv,
+    [TRACE_glClearNamedFramebufferfv - TRACE_FIRST_COMMAND] = trace_replay_glClearNamedFramebufferfv,
+    [TRACE_glClearNamedFramebufferfi - TRACE_FIRST_COMMAND] = trace_replay_glClearNamedFramebufferfi,
+    [TRACE_glBlitNamedFramebuffer - TRACE_FIRST_COMMAND] = trace_replay_glBlitNamedFramebuffer,
+    [TRACE_glCreateRenderbuffers - TRACE_FIRST_COMMAND] = trace_replay_glCreateRenderbuffers,
+    [TRACE_glNamedRenderbufferStorage - TRACE_FIRST_COMMAND] = trace_replay_glNamedRenderbufferStorage,
+    [TRACE_glNamedRenderbufferStorageMultisample - TRACE_FIRST_COMMAND] = trace_replay_glNamedRenderbufferStorageMultisample,
+    [TRACE_glCreateTextures - TRACE_FIRST_COMMAND] = trace_replay_glCreateTextures,
+    [TRACE_glTextureBuffer - TRACE_FIRST_COMMAND] = trace_replay_glTextureBuffer,
+    [TRACE_glTextureBufferRange - TRACE_FIRST_COMMAND] = trace_replay_glTextureBufferRange,
+    [TRACE_glTextureStorage1D - TRACE_FIRST_COMMAND] = trace_replay_glTextureStorage1D,
+    [TRACE_glTextureStorage2D - TRACE_FIRST_COMMAND] = trace_replay_glTextureStorage2D,
+    [TRACE_glTextureStorage3D - TRACE_FIRST_COMMAND] = trace_replay_glTextureStorage3D,
+    [TRACE_glTextureStorage2DMultisample - TRACE_FIRST_COMMAND] = trace_replay_glTextureStorage2DMultisample,
+    [TRACE_glTextureStorage3DMultisample - TRACE_FIRST_COMMAND] = trace_replay_glTextureStorage3DMultisample,
+    [TRACE_glTextureSubImage1D - TRACE_FIRST_COMMAND] = trace_replay_glTextureSubImage1D,
+    [TRACE_glTextureSubImage2D - TRACE_FIRST_COMMAND] = trace_replay_glTextureSubImage2D,
+    [TRACE_glTextureSubImage3D - TRACE_FIRST_COMMAND] = trace_replay_glTextureSubImage3D,
+    [TRACE_glCompressedTextureSubImage1D - TRACE_FIRST_COMMAND] = trace_replay_glCompressedTextureSubImage1D,
+    [TRACE_glCompressedTextureSubImage2D - TRACE_FIRST_COMMAND] = trace_replay_glCompressedTextureSubImage2D,
+    [TRACE_glCompressedTextureSubImage3D - TRACE_FIRST_COMMAND] = trace_replay_glCompressedTextureSubImage3D,
+    [TRACE_glCopyTextureSubImage1D - TRACE_FIRST_COMMAND] = trace_replay_glCopyTextureSubImage1D,
+    [TRACE_glCopyTextureSubImage2D - TRACE_FIRST_COMMAND] = trace_replay_glCopyTextureSubImage2D,
+    [TRACE_glCopyTextureSubImage3D - TRACE_FIRST_COMMAND] = trace_replay_glCopyTextureSubImage3D,
+    [TRACE_glTextureParameterf - TRACE_FIRST_COMMAND] = trace_replay_glTextureParameterf,
+    [TRACE_glTextureParameterfv - TRACE_FIRST_COMMAND] = trace_replay_glTextureParameterfv,
+    [TRACE_glTextureParameteri - TRACE_FIRST_COMMAND] = trace_replay_glTextureParameteri,
+    [TRACE_glTextureParameterIiv - TRACE_FIRST_COMMAND] = trace_replay_glTextureParameterIiv,
+    [TRACE_glTextureParameterIuiv - TRACE_FIRST_COMMAND] = trace_replay_glTextureParameterIuiv,
+    [TRACE_glTextureParameteriv - TRACE_FIRST_COMMAND] = trace_replay_glTextureParameteriv,
+    [TRACE_glGenerateTextureMipmap - TRACE_FIRST_COMMAND] = trace_replay_glGenerateTextureMipmap,
+    [TRACE_glBindTextureUnit - TRACE_FIRST_COMMAND] = trace_replay_glBindTextureUnit,
+    [TRACE_glCreateVertexArrays - TRACE_FIRST_COMMAND] = trace_replay_glCreateVertexArrays,
+    [TRACE_glDisableVertexArrayAttrib - TRACE_FIRST_COMMAND] = trace_replay_glDisableVertexArrayAttrib,
+    [TRACE_glEnableVertexArrayAttrib - TRACE_FIRST_COMMAND] = trace_replay_glEnableVertexArrayAttrib,
+    [TRACE_glVertexArrayElementBuffer - TRACE_FIRST_COMMAND] = trace_replay_glVertexArrayElementBuffer,
+    [TRACE_glVertexArrayVertexBuffer - TRACE_FIRST_COMMAND] = trace_replay_glVertexArrayVertexBuffer,
+    [TRACE_glVertexArrayVertexBuffers - TRACE_FIRST_COMMAND] = trace_replay_glVertexArrayVertexBuffers,
+    [TRACE_glVertexArrayAttribBinding - TRACE_FIRST_COMMAND] = trace_replay_glVertexArrayAttribBinding,
+    [TRACE_glVertexArrayAttribFormat - TRACE_FIRST_COMMAND] = trace_replay_glVertexArrayAttribFormat,
+    [TRACE_glVertexArrayAttribIFormat - TRACE_FIRST_COMMAND] = trace_replay_glVertexArrayAttribIFormat,
+    [TRACE_glVertexArrayAttribLFormat - TRACE_FIRST_COMMAND] = trace_replay_glVertexArrayAttribLFormat,
+    [TRACE_glVertexArrayBindingDivisor - TRACE_FIRST_COMMAND] = trace_replay_glVertexArrayBindingDivisor,
+    [TRACE_glCreateSamplers - TRACE_FIRST_COMMAND] = trace_replay_glCreateSamplers,
+    [TRACE_glCreateProgramPipelines - TRACE_FIRST_COMMAND] = trace_replay_glCreateProgramPipelines,
+    [TRACE_glCreateQueries - TRACE_FIRST_COMMAND] = trace_replay_glCreateQueries,
+    [TRACE_glMemoryBarrierByRegion - TRACE_FIRST_COMMAND] = trace_replay_glMemoryBarrierByRegion,
+    [TRACE_glReadnPixels - TRACE_FIRST_COMMAND] = trace_replay_glReadnPixels,
+    [TRACE_glTextureBarrier - TRACE_FIRST_COMMAND] = trace_replay_glTextureBarrier,
+#endif
+#if FUNGL_VERSION >= GL_VERSION_4_6
+    [TRACE_glSpecializeShader - TRACE_FIRST_COMMAND] = trace_replay_glSpecializeShader,
+    [TRACE_glMultiDrawArraysIndirectCount - TRACE_FIRST_COMMAND] = trace_replay_glMultiDrawArraysIndirectCount,
+    [TRACE_glMultiDrawElementsIndirectCount - TRACE_FIRST_COMMAND] = trace_replay_glMultiDrawElementsIndirectCount,
+    [TRACE_glPolygonOffsetClamp - TRACE_FIRST_COMMAND] = trace_replay_glPolygonOffsetClamp,
+#endif
+};
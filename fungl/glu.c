@@ -18,3 +18,2616 @@
  along with this program.  If not, see <https://www.gnu.org/licenses/>. */
 
 #include "glu.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <setjmp.h>
+#include <stddef.h>
+#if !defined(_WIN32) && !defined(GLU_NO_THREADS)
+#include <pthread.h>
+#include <unistd.h>
+#define GLU_THREADS
+#endif
+#if !defined(GLU_NO_SIMD)
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define GLU_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define GLU_NEON
+#endif
+#if defined(__F16C__)
+#include <immintrin.h>
+#define GLU_F16C
+#endif
+#endif
+
+#ifndef GLU_MAX_THREADS
+#define GLU_MAX_THREADS 16
+#endif
+// Roughly the number of pixels below which spawning threads isn't worth it
+#define GLU_PARALLEL_MIN_WORK (1 << 16)
+
+typedef float f32x4 __attribute__((vector_size(16)));
+typedef int32_t i32x4 __attribute__((vector_size(16)));
+// { A[X], A[Y], B[Z], B[W] }
+#if defined(__clang__)
+#define GLU_SHUFFLE(A, B, X, Y, Z, W) __builtin_shufflevector((A), (B), (X), (Y), (Z) + 4, (W) + 4)
+#else
+#define GLU_SHUFFLE(A, B, X, Y, Z, W) __builtin_shuffle((A), (B), (i32x4){(X), (Y), (Z) + 4, (W) + 4})
+#endif
+
+typedef void(*glu_rows_func)(void*, int, int);
+
+struct glu_job {
+    glu_rows_func func;
+    void *ctx;
+    int begin, end;
+};
+
+#ifdef GLU_THREADS
+static void* glu_job_thread(void *arg) {
+    struct glu_job *job = arg;
+    job->func(job->ctx, job->begin, job->end);
+    return NULL;
+}
+
+static int glu_thread_count(void) {
+    static int count = 0;
+    if (!count) {
+        long n = sysconf(_SC_NPROCESSORS_ONLN);
+        count = n < 1 ? 1 : n > GLU_MAX_THREADS ? GLU_MAX_THREADS : (int)n;
+    }
+    return count;
+}
+#endif
+
+// Splits `rows` across threads, `work` is an estimate of the total pixels touched
+static void glu_parallel_rows(int rows, long work, glu_rows_func func, void *ctx) {
+#ifdef GLU_THREADS
+    int threads = glu_thread_count();
+    if (threads > rows)
+        threads = rows;
+    if (threads > 1 && work >= GLU_PARALLEL_MIN_WORK) {
+        pthread_t handles[GLU_MAX_THREADS];
+        struct glu_job jobs[GLU_MAX_THREADS];
+        bool started[GLU_MAX_THREADS];
+        int per = (rows + threads - 1) / threads;
+        for (int i = 0; i < threads; i++) {
+            jobs[i] = (struct glu_job){func, ctx, MIN(i * per, rows), MIN((i + 1) * per, rows)};
+            // The calling thread takes the first slice itself
+            started[i] = i > 0 && !pthread_create(&handles[i], NULL, glu_job_thread, &jobs[i]);
+        }
+        for (int i = 0; i < threads; i++)
+            if (!started[i])
+                func(ctx, jobs[i].begin, jobs[i].end);
+        for (int i = 1; i < threads; i++)
+            if (started[i])
+                pthread_join(handles[i], NULL);
+        return;
+    }
+#endif
+    func(ctx, 0, rows);
+}
+
+static int glu_components(GLenum format) {
+    switch (format) {
+        case GL_RED:
+        case GL_ALPHA:
+        case GL_LUMINANCE:
+            return 1;
+        case GL_RG:
+        case GL_LUMINANCE_ALPHA:
+            return 2;
+        case GL_RGB:
+        case GL_BGR:
+            return 3;
+        case GL_RGBA:
+        case GL_BGRA:
+            return 4;
+        default:
+            return 0;
+    }
+}
+
+static int glu_type_size(GLenum type) {
+    switch (type) {
+        case GL_UNSIGNED_BYTE:
+            return 1;
+        case GL_UNSIGNED_SHORT:
+        case GL_HALF_FLOAT:
+            return 2;
+        case GL_FLOAT:
+            return 4;
+        default:
+            return 0;
+    }
+}
+
+static bool glu_is_srgb(GLint internalFormat) {
+    switch (internalFormat) {
+        case GL_SRGB:
+        case GL_SRGB8:
+        case GL_SRGB_ALPHA:
+        case GL_SRGB8_ALPHA8:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Alpha is always stored linearly, even in sRGB formats
+static int glu_alpha_channel(GLenum format) {
+    switch (format) {
+        case GL_ALPHA:
+            return 0;
+        case GL_LUMINANCE_ALPHA:
+            return 1;
+        case GL_RGBA:
+        case GL_BGRA:
+            return 3;
+        default:
+            return -1;
+    }
+}
+
+static float glu_half_to_float(uint16_t h) {
+    uint32_t sign = (uint32_t)(h & 0x8000) << 16;
+    uint32_t exponent = (h >> 10) & 0x1F;
+    uint32_t mantissa = h & 0x3FF;
+    uint32_t bits;
+    if (exponent == 0x1F)
+        bits = sign | 0x7F800000 | (mantissa << 13);
+    else if (exponent)
+        bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+    else if (mantissa) {
+        // Denormal, renormalize
+        exponent = 113;
+        while (!(mantissa & 0x400)) {
+            mantissa <<= 1;
+            exponent--;
+        }
+        bits = sign | (exponent << 23) | ((mantissa & 0x3FF) << 13);
+    } else
+        bits = sign;
+    float result;
+    memcpy(&result, &bits, sizeof(float));
+    return result;
+}
+
+static uint16_t glu_float_to_half(float f) {
+    uint32_t bits;
+    memcpy(&bits, &f, sizeof(float));
+    uint16_t sign = (bits >> 16) & 0x8000;
+    int32_t exponent = (int32_t)((bits >> 23) & 0xFF) - 112;
+    uint32_t mantissa = bits & 0x7FFFFF;
+    if (exponent >= 0x1F)
+        return sign | 0x7C00 | (((bits & 0x7F800000) == 0x7F800000 && mantissa) ? 0x200 : 0);
+    if (exponent <= 0) {
+        if (exponent < -10)
+            return sign;
+        mantissa = (mantissa | 0x800000) >> (1 - exponent);
+        return sign | (uint16_t)((mantissa + 0x1000) >> 13);
+    }
+    // Round to nearest, a carry into the exponent is still correct
+    return sign | (uint16_t)(((exponent << 10) | (mantissa >> 13)) + ((mantissa >> 12) & 1));
+}
+
+static float glu_srgb_to_linear_lut[256];
+static uint8_t glu_linear_to_srgb_lut[4096];
+
+static void glu_init_srgb(void) {
+    static bool initialised = false;
+    if (initialised)
+        return;
+    for (int i = 0; i < 256; i++) {
+        float c = i / 255.f;
+        glu_srgb_to_linear_lut[i] = c <= .04045f ? c / 12.92f : powf((c + .055f) / 1.055f, 2.4f);
+    }
+    for (int i = 0; i < 4096; i++) {
+        float c = i / 4095.f;
+        c = c <= .0031308f ? c * 12.92f : 1.055f * powf(c, 1.f / 2.4f) - .055f;
+        glu_linear_to_srgb_lut[i] = (uint8_t)(CLAMP(c, 0.f, 1.f) * 255.f + .5f);
+    }
+    initialised = true;
+}
+
+struct glu_format {
+    GLenum type;
+    int components;
+    int alpha;
+    bool srgb;
+};
+
+static void glu_decode_row(const struct glu_format *fmt, const void *src, f32x4 *dst, int width) {
+    int n = fmt->components;
+    switch (fmt->type) {
+        case GL_UNSIGNED_BYTE: {
+            const uint8_t *p = src;
+            for (int x = 0; x < width; x++, p += n) {
+                f32x4 px = {0.f, 0.f, 0.f, 0.f};
+                for (int c = 0; c < n; c++)
+                    px[c] = fmt->srgb && c != fmt->alpha ? glu_srgb_to_linear_lut[p[c]] : p[c] * (1.f / 255.f);
+                dst[x] = px;
+            }
+            break;
+        }
+        case GL_UNSIGNED_SHORT: {
+            const uint16_t *p = src;
+            for (int x = 0; x < width; x++, p += n) {
+                f32x4 px = {0.f, 0.f, 0.f, 0.f};
+                for (int c = 0; c < n; c++)
+                    px[c] = p[c] * (1.f / 65535.f);
+                dst[x] = px;
+            }
+            break;
+        }
+        case GL_HALF_FLOAT: {
+            const uint16_t *p = src;
+            int x = 0;
+#ifdef GLU_F16C
+            if (n == 4)
+                for (; x < width; x++, p += 4)
+                    dst[x] = (f32x4)_mm_cvtph_ps(_mm_loadl_epi64((const __m128i*)p));
+#endif
+            for (; x < width; x++, p += n) {
+                f32x4 px = {0.f, 0.f, 0.f, 0.f};
+                for (int c = 0; c < n; c++)
+                    px[c] = glu_half_to_float(p[c]);
+                dst[x] = px;
+            }
+            break;
+        }
+        case GL_FLOAT: {
+            const float *p = src;
+            for (int x = 0; x < width; x++, p += n) {
+                f32x4 px = {0.f, 0.f, 0.f, 0.f};
+                memcpy(&px, p, sizeof(float) * n);
+                dst[x] = px;
+            }
+            break;
+        }
+    }
+}
+
+static void glu_encode_row(const struct glu_format *fmt, const f32x4 *src, void *dst, int width) {
+    int n = fmt->components;
+    switch (fmt->type) {
+        case GL_UNSIGNED_BYTE: {
+            uint8_t *p = dst;
+            for (int x = 0; x < width; x++, p += n)
+                for (int c = 0; c < n; c++) {
+                    float v = CLAMP(src[x][c], 0.f, 1.f);
+                    p[c] = fmt->srgb && c != fmt->alpha ?
+                        glu_linear_to_srgb_lut[(int)(v * 4095.f + .5f)] : (uint8_t)(v * 255.f + .5f);
+                }
+            break;
+        }
+        case GL_UNSIGNED_SHORT: {
+            uint16_t *p = dst;
+            for (int x = 0; x < width; x++, p += n)
+                for (int c = 0; c < n; c++)
+                    p[c] = (uint16_t)(CLAMP(src[x][c], 0.f, 1.f) * 65535.f + .5f);
+            break;
+        }
+        case GL_HALF_FLOAT: {
+            uint16_t *p = dst;
+            int x = 0;
+#ifdef GLU_F16C
+            if (n == 4)
+                for (; x < width; x++, p += 4)
+                    _mm_storel_epi64((__m128i*)p, _mm_cvtps_ph((__m128)src[x], 0));
+#endif
+            for (; x < width; x++, p += n)
+                for (int c = 0; c < n; c++)
+                    p[c] = glu_float_to_half(src[x][c]);
+            break;
+        }
+        case GL_FLOAT: {
+            float *p = dst;
+            for (int x = 0; x < width; x++, p += n)
+                memcpy(p, &src[x], sizeof(float) * n);
+            break;
+        }
+    }
+}
+
+static float glu_filter_box(float x) {
+    return x > -.5f && x <= .5f ? 1.f : 0.f;
+}
+
+static float glu_filter_triangle(float x) {
+    x = fabsf(x);
+    return x < 1.f ? 1.f - x : 0.f;
+}
+
+static float glu_bessel_i0(float x) {
+    float sum = 1.f, term = 1.f, q = x * x * .25f;
+    for (int k = 1; k < 16; k++) {
+        term *= q / (float)(k * k);
+        sum += term;
+    }
+    return sum;
+}
+
+#define GLU_KAISER_RADIUS 3.f
+#define GLU_KAISER_ALPHA 4.f
+
+static float glu_filter_kaiser(float x) {
+    if (fabsf(x) >= GLU_KAISER_RADIUS)
+        return 0.f;
+    float t = x / GLU_KAISER_RADIUS;
+    float window = glu_bessel_i0(GLU_KAISER_ALPHA * sqrtf(1.f - t * t)) / glu_bessel_i0(GLU_KAISER_ALPHA);
+    float sinc = x == 0.f ? 1.f : sinf((float)PI * x) / ((float)PI * x);
+    return sinc * window;
+}
+
+// Precomputed taps for one axis, `taps` entries per destination sample
+struct glu_weights {
+    int taps;
+    int *first;
+    float *weights;
+};
+
+static bool glu_weights_init(struct glu_weights *w, int src, int dst, GLenum filter) {
+    float scale = (float)src / (float)dst;
+    float fscale = MAX(scale, 1.f);
+    float(*func)(float) = filter == GLU_FILTER_KAISER ? glu_filter_kaiser : scale > 1.f ? glu_filter_box : glu_filter_triangle;
+    float radius = filter == GLU_FILTER_KAISER ? GLU_KAISER_RADIUS : scale > 1.f ? .5f : 1.f;
+    float support = radius * fscale;
+    w->taps = (int)ceilf(support * 2.f) + 1;
+    w->first = malloc(sizeof(int) * dst);
+    w->weights = calloc((size_t)dst * w->taps, sizeof(float));
+    if (!w->first || !w->weights) {
+        free(w->first);
+        free(w->weights);
+        return false;
+    }
+    for (int i = 0; i < dst; i++) {
+        float center = (i + .5f) * scale - .5f;
+        int lo = (int)ceilf(center - support);
+        float *weights = &w->weights[(size_t)i * w->taps];
+        float total = 0.f;
+        // Taps falling outside the image are folded onto the edge pixels,
+        // so `first` is clamped and weights accumulate at the borders
+        int first = CLAMP(lo, 0, MAX(src - w->taps, 0));
+        w->first[i] = first;
+        for (int j = lo; j < lo + w->taps; j++) {
+            float weight = func((j - center) / fscale);
+            if (weight == 0.f)
+                continue;
+            int k = CLAMP(j, 0, src - 1) - first;
+            if (k >= 0 && k < w->taps) {
+                weights[k] += weight;
+                total += weight;
+            }
+        }
+        if (total == 0.f) {
+            int nearest = CLAMP((int)(center + .5f), 0, src - 1) - first;
+            weights[CLAMP(nearest, 0, w->taps - 1)] = 1.f;
+        } else
+            for (int k = 0; k < w->taps; k++)
+                weights[k] /= total;
+    }
+    return true;
+}
+
+static void glu_weights_free(struct glu_weights *w) {
+    free(w->first);
+    free(w->weights);
+}
+
+struct glu_resample_job {
+    const f32x4 *src;
+    f32x4 *tmp, *dst;
+    int sw, sh, dw, dh;
+    struct glu_weights wx, wy;
+};
+
+static void glu_resample_rows_x(void *arg, int begin, int end) {
+    struct glu_resample_job *job = arg;
+    int taps = MIN(job->wx.taps, job->sw);
+    for (int y = begin; y < end; y++) {
+        const f32x4 *in = &job->src[(size_t)y * job->sw];
+        f32x4 *out = &job->tmp[(size_t)y * job->dw];
+        for (int x = 0; x < job->dw; x++) {
+            const f32x4 *p = &in[job->wx.first[x]];
+            const float *w = &job->wx.weights[(size_t)x * job->wx.taps];
+            f32x4 sum = {0.f, 0.f, 0.f, 0.f};
+            for (int k = 0; k < taps; k++)
+                sum += p[k] * w[k];
+            out[x] = sum;
+        }
+    }
+}
+
+static void glu_resample_rows_y(void *arg, int begin, int end) {
+    struct glu_resample_job *job = arg;
+    int taps = MIN(job->wy.taps, job->sh);
+    for (int y = begin; y < end; y++) {
+        const f32x4 *in = &job->tmp[(size_t)job->wy.first[y] * job->dw];
+        const float *w = &job->wy.weights[(size_t)y * job->wy.taps];
+        f32x4 *out = &job->dst[(size_t)y * job->dw];
+        for (int x = 0; x < job->dw; x++)
+            out[x] = in[x] * w[0];
+        for (int k = 1; k < taps; k++) {
+            const f32x4 *row = &in[(size_t)k * job->dw];
+            for (int x = 0; x < job->dw; x++)
+                out[x] += row[x] * w[k];
+        }
+    }
+}
+
+// Separable resample of RGBA float images, horizontal pass first
+static GLint glu_resample(const f32x4 *src, int sw, int sh, f32x4 *dst, int dw, int dh, GLenum filter) {
+    struct glu_resample_job job = {
+        .src = src, .dst = dst,
+        .sw = sw, .sh = sh, .dw = dw, .dh = dh
+    };
+    if (!(job.tmp = malloc(sizeof(f32x4) * (size_t)dw * sh)))
+        return GLU_OUT_OF_MEMORY;
+    if (!glu_weights_init(&job.wx, sw, dw, filter)) {
+        free(job.tmp);
+        return GLU_OUT_OF_MEMORY;
+    }
+    if (!glu_weights_init(&job.wy, sh, dh, filter)) {
+        glu_weights_free(&job.wx);
+        free(job.tmp);
+        return GLU_OUT_OF_MEMORY;
+    }
+    glu_parallel_rows(sh, (long)dw * sh * job.wx.taps, glu_resample_rows_x, &job);
+    glu_parallel_rows(dh, (long)dw * dh * job.wy.taps, glu_resample_rows_y, &job);
+    glu_weights_free(&job.wx);
+    glu_weights_free(&job.wy);
+    free(job.tmp);
+    return 0;
+}
+
+struct glu_convert_job {
+    const struct glu_format *fmt;
+    const uint8_t *packed;
+    f32x4 *image;
+    int width;
+    size_t stride;
+};
+
+static void glu_decode_rows(void *arg, int begin, int end) {
+    struct glu_convert_job *job = arg;
+    for (int y = begin; y < end; y++)
+        glu_decode_row(job->fmt, job->packed + y * job->stride, &job->image[(size_t)y * job->width], job->width);
+}
+
+static void glu_encode_rows(void *arg, int begin, int end) {
+    struct glu_convert_job *job = arg;
+    for (int y = begin; y < end; y++)
+        glu_encode_row(job->fmt, &job->image[(size_t)y * job->width], (uint8_t*)job->packed + y * job->stride, job->width);
+}
+
+static GLint glu_scale(const struct glu_format *in_fmt, const void *in, int sw, int sh,
+                       const struct glu_format *out_fmt, void *out, int dw, int dh, GLenum filter) {
+    f32x4 *src = malloc(sizeof(f32x4) * (size_t)sw * sh);
+    f32x4 *dst = malloc(sizeof(f32x4) * (size_t)dw * dh);
+    if (!src || !dst) {
+        free(src);
+        free(dst);
+        return GLU_OUT_OF_MEMORY;
+    }
+    if (in_fmt->srgb || out_fmt->srgb)
+        glu_init_srgb();
+    struct glu_convert_job decode = {in_fmt, in, src, sw, (size_t)sw * in_fmt->components * glu_type_size(in_fmt->type)};
+    glu_parallel_rows(sh, (long)sw * sh, glu_decode_rows, &decode);
+    GLint result = glu_resample(src, sw, sh, dst, dw, dh, filter);
+    if (!result) {
+        struct glu_convert_job encode = {out_fmt, out, dst, dw, (size_t)dw * out_fmt->components * glu_type_size(out_fmt->type)};
+        glu_parallel_rows(dh, (long)dw * dh, glu_encode_rows, &encode);
+    }
+    free(src);
+    free(dst);
+    return result;
+}
+
+struct glu_box_job {
+    const uint8_t *src;
+    uint8_t *dst;
+    int sw, dw;
+};
+
+// 2x2 box filter for RGBA8 with even source dimensions, rounds to nearest
+static void glu_box_rgba8_rows(void *arg, int begin, int end) {
+    struct glu_box_job *job = arg;
+    for (int y = begin; y < end; y++) {
+        const uint8_t *r0 = job->src + (size_t)(y * 2) * job->sw * 4;
+        const uint8_t *r1 = r0 + (size_t)job->sw * 4;
+        uint8_t *out = job->dst + (size_t)y * job->dw * 4;
+        int x = 0;
+#if defined(GLU_SSE2)
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i two = _mm_set1_epi16(2);
+        for (; x + 4 <= job->dw; x += 4) {
+            __m128i a0 = _mm_loadu_si128((const __m128i*)(r0 + x * 8));
+            __m128i b0 = _mm_loadu_si128((const __m128i*)(r0 + x * 8 + 16));
+            __m128i a1 = _mm_loadu_si128((const __m128i*)(r1 + x * 8));
+            __m128i b1 = _mm_loadu_si128((const __m128i*)(r1 + x * 8 + 16));
+            // Vertical sums, two source pixels per register in 16 bits
+            __m128i p01 = _mm_add_epi16(_mm_unpacklo_epi8(a0, zero), _mm_unpacklo_epi8(a1, zero));
+            __m128i p23 = _mm_add_epi16(_mm_unpackhi_epi8(a0, zero), _mm_unpackhi_epi8(a1, zero));
+            __m128i p45 = _mm_add_epi16(_mm_unpacklo_epi8(b0, zero), _mm_unpacklo_epi8(b1, zero));
+            __m128i p67 = _mm_add_epi16(_mm_unpackhi_epi8(b0, zero), _mm_unpackhi_epi8(b1, zero));
+            // Horizontal sums of even + odd pixels
+            __m128i o01 = _mm_add_epi16(_mm_unpacklo_epi64(p01, p23), _mm_unpackhi_epi64(p01, p23));
+            __m128i o23 = _mm_add_epi16(_mm_unpacklo_epi64(p45, p67), _mm_unpackhi_epi64(p45, p67));
+            o01 = _mm_srli_epi16(_mm_add_epi16(o01, two), 2);
+            o23 = _mm_srli_epi16(_mm_add_epi16(o23, two), 2);
+            _mm_storeu_si128((__m128i*)(out + x * 4), _mm_packus_epi16(o01, o23));
+        }
+#elif defined(GLU_NEON)
+        for (; x + 4 <= job->dw; x += 4) {
+            // vld2 splits even and odd pixels
+            uint32x4x2_t a = vld2q_u32((const uint32_t*)(r0 + x * 8));
+            uint32x4x2_t b = vld2q_u32((const uint32_t*)(r1 + x * 8));
+            uint8x16_t e0 = vreinterpretq_u8_u32(a.val[0]), o0 = vreinterpretq_u8_u32(a.val[1]);
+            uint8x16_t e1 = vreinterpretq_u8_u32(b.val[0]), o1 = vreinterpretq_u8_u32(b.val[1]);
+            uint16x8_t lo = vaddl_u8(vget_low_u8(e0), vget_low_u8(o0));
+            lo = vaddw_u8(vaddw_u8(lo, vget_low_u8(e1)), vget_low_u8(o1));
+            uint16x8_t hi = vaddl_u8(vget_high_u8(e0), vget_high_u8(o0));
+            hi = vaddw_u8(vaddw_u8(hi, vget_high_u8(e1)), vget_high_u8(o1));
+            vst1q_u8(out + x * 4, vcombine_u8(vrshrn_n_u16(lo, 2), vrshrn_n_u16(hi, 2)));
+        }
+#endif
+        for (; x < job->dw; x++)
+            for (int c = 0; c < 4; c++)
+                out[x * 4 + c] = (uint8_t)((r0[x * 8 + c] + r0[x * 8 + 4 + c] +
+                                            r1[x * 8 + c] + r1[x * 8 + 4 + c] + 2) >> 2);
+    }
+}
+
+static GLint glu_check_image(GLenum format, GLenum type, GLsizei width, GLsizei height, const void *data) {
+    if (!glu_components(format) || !glu_type_size(type))
+        return GLU_INVALID_ENUM;
+    if (width <= 0 || height <= 0 || !data)
+        return GLU_INVALID_VALUE;
+    return 0;
+}
+
+GLint gluScaleImageFiltered(GLenum format, GLsizei wIn, GLsizei hIn, GLenum typeIn, const void *dataIn, GLsizei wOut, GLsizei hOut, GLenum typeOut, GLvoid *dataOut, GLenum filter, GLboolean srgb) {
+    GLint err;
+    if ((err = glu_check_image(format, typeIn, wIn, hIn, dataIn)) ||
+        (err = glu_check_image(format, typeOut, wOut, hOut, dataOut)))
+        return err;
+    if (filter != GLU_FILTER_BOX && filter != GLU_FILTER_KAISER)
+        return GLU_INVALID_ENUM;
+    struct glu_format in_fmt = {typeIn, glu_components(format), glu_alpha_channel(format), srgb && typeIn == GL_UNSIGNED_BYTE};
+    struct glu_format out_fmt = {typeOut, glu_components(format), glu_alpha_channel(format), srgb && typeOut == GL_UNSIGNED_BYTE};
+    return glu_scale(&in_fmt, dataIn, wIn, hIn, &out_fmt, dataOut, wOut, hOut, filter);
+}
+
+GLint gluScaleImage(GLenum format, GLsizei wIn, GLsizei hIn, GLenum typeIn, const void *dataIn, GLsizei wOut, GLsizei hOut, GLenum typeOut, GLvoid *dataOut) {
+    return gluScaleImageFiltered(format, wIn, hIn, typeIn, dataIn, wOut, hOut, typeOut, dataOut, GLU_FILTER_BOX, GL_FALSE);
+}
+
+GLint gluBuild2DMipmapsFiltered(GLenum target, GLint internalFormat, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *data, GLenum filter) {
+    GLint err;
+    if ((err = glu_check_image(format, type, width, height, data)))
+        return err;
+    if (filter != GLU_FILTER_BOX && filter != GLU_FILTER_KAISER)
+        return GLU_INVALID_ENUM;
+    struct glu_format fmt = {type, glu_components(format), glu_alpha_channel(format), glu_is_srgb(internalFormat) && type == GL_UNSIGNED_BYTE};
+    size_t pixel = (size_t)fmt.components * glu_type_size(type);
+    size_t level_size = (size_t)MAX(width / 2, 1) * MAX(height / 2, 1) * pixel;
+    uint8_t *buffers[2] = {malloc(level_size), malloc(level_size)};
+    if (!buffers[0] || !buffers[1]) {
+        free(buffers[0]);
+        free(buffers[1]);
+        return GLU_OUT_OF_MEMORY;
+    }
+
+    GLint alignment;
+    glGetIntegerv(GL_UNPACK_ALIGNMENT, &alignment);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(target, 0, internalFormat, width, height, 0, format, type, data);
+    const uint8_t *src = data;
+    int w = width, h = height;
+    for (int level = 1; w > 1 || h > 1; level++) {
+        int nw = MAX(w / 2, 1), nh = MAX(h / 2, 1);
+        uint8_t *dst = buffers[level & 1];
+        if (filter == GLU_FILTER_BOX && !fmt.srgb && type == GL_UNSIGNED_BYTE &&
+            fmt.components == 4 && !(w & 1) && !(h & 1)) {
+            struct glu_box_job job = {src, dst, w, nw};
+            glu_parallel_rows(nh, (long)nw * nh * 4, glu_box_rgba8_rows, &job);
+        } else if ((err = glu_scale(&fmt, src, w, h, &fmt, dst, nw, nh, filter)))
+            break;
+        glTexImage2D(target, level, internalFormat, nw, nh, 0, format, type, dst);
+        src = dst;
+        w = nw;
+        h = nh;
+    }
+    glPixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+    free(buffers[0]);
+    free(buffers[1]);
+    return err;
+}
+
+GLint gluBuild2DMipmaps(GLenum target, GLint internalFormat, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *data) {
+    return gluBuild2DMipmapsFiltered(target, internalFormat, width, height, format, type, data, GLU_FILTER_BOX);
+}
+
+/* Tessellation
+   Ear clipping with hole bridging and z-order hashed ear tests, following
+   the approach of mapbox/earcut. All scratch memory comes from an arena
+   owned by the tesselator, it's rewound (not freed) after every polygon so
+   steady-state tessellation doesn't touch malloc at all. */
+
+#ifndef GLU_ARENA_BLOCK
+#define GLU_ARENA_BLOCK (256 * 1024)
+#endif
+// Polygons with more vertices than this use the z-order hash for ear tests
+#define GLU_TESS_HASH_MIN 80
+// Contours with more vertices than this get a y-band index for containment tests
+#define GLU_TESS_BANDS_MIN 64
+// Polygons with at least this many holes index the ring for hole bridging
+#define GLU_TESS_BRIDGE_INDEX_MIN 8
+
+struct glu_arena_block {
+    struct glu_arena_block *next;
+    size_t size, used;
+};
+
+#define GLU_ARENA_HEADER ((sizeof(struct glu_arena_block) + 15) & ~(size_t)15)
+
+struct glu_arena {
+    struct glu_arena_block *head, *current;
+};
+
+static void* glu_arena_alloc(struct glu_arena *arena, size_t size) {
+    size = (size + 15) & ~(size_t)15;
+    struct glu_arena_block *block = arena->current;
+    while (block && block->used + size > block->size)
+        block = block->next;
+    if (!block) {
+        size_t capacity = MAX(size, (size_t)GLU_ARENA_BLOCK);
+        if (!(block = malloc(GLU_ARENA_HEADER + capacity)))
+            return NULL;
+        block->size = capacity;
+        block->used = 0;
+        if (arena->current) {
+            block->next = arena->current->next;
+            arena->current->next = block;
+        } else {
+            block->next = NULL;
+            arena->head = block;
+        }
+    }
+    arena->current = block;
+    void *result = (uint8_t*)block + GLU_ARENA_HEADER + block->used;
+    block->used += size;
+    return result;
+}
+
+static void glu_arena_reset(struct glu_arena *arena) {
+    for (struct glu_arena_block *block = arena->head; block; block = block->next)
+        block->used = 0;
+    arena->current = arena->head;
+}
+
+static void glu_arena_free(struct glu_arena *arena) {
+    struct glu_arena_block *block = arena->head;
+    while (block) {
+        struct glu_arena_block *next = block->next;
+        free(block);
+        block = next;
+    }
+    arena->head = arena->current = NULL;
+}
+
+struct glu_tess_node {
+    double x, y;
+    GLuint i;
+    int32_t z;
+    bool steiner, removed;
+    struct glu_tess_node *prev, *next, *prev_z, *next_z;
+};
+
+enum {
+    GLU_TESS_CONTOUR_DROPPED = 0,
+    GLU_TESS_CONTOUR_OUTER,
+    GLU_TESS_CONTOUR_HOLE
+};
+
+struct glu_tess_contour {
+    GLsizei begin, end;
+    double area, min_x, min_y, max_x, max_y;
+    int kind, parent, first_hole, next_hole;
+    // Lazily built y-band edge index, see glu_tess_contains
+    GLsizei *band_offsets, *band_edges;
+    int band_count;
+    double band_scale;
+};
+
+struct glu_tess_band_entry {
+    struct glu_tess_node *node;
+    struct glu_tess_band_entry *next;
+};
+
+struct glu_tess_ctx {
+    struct glu_arena *arena;
+    jmp_buf oom;
+    // Projected 2D positions
+    const double *xy;
+    struct glu_tess_contour *contours;
+    GLsizei contour_count;
+    // z-order hash transform, inv_size is 0 when hashing is off
+    double min_x, min_y, inv_size;
+    // Ring edges bucketed by y while bridging holes, NULL when not indexed
+    struct glu_tess_band_entry **bands;
+    int band_count;
+    double band_min, band_scale;
+    GLuint *out;
+    GLsizei capacity, written;
+};
+
+static void* glu_tess_alloc(struct glu_tess_ctx *ctx, size_t size) {
+    void *result = glu_arena_alloc(ctx->arena, size);
+    if (!result)
+        longjmp(ctx->oom, 1);
+    return result;
+}
+
+static void glu_tess_triangle(struct glu_tess_ctx *ctx, GLuint a, GLuint b, GLuint c) {
+    if (ctx->written + 3 <= ctx->capacity) {
+        ctx->out[ctx->written] = a;
+        ctx->out[ctx->written + 1] = b;
+        ctx->out[ctx->written + 2] = c;
+    }
+    ctx->written += 3;
+}
+
+static struct glu_tess_node* glu_tess_insert(struct glu_tess_ctx *ctx, GLuint i, struct glu_tess_node *last) {
+    struct glu_tess_node *p = glu_tess_alloc(ctx, sizeof(struct glu_tess_node));
+    *p = (struct glu_tess_node) {
+        .x = ctx->xy[i * 2],
+        .y = ctx->xy[i * 2 + 1],
+        .i = i
+    };
+    if (last) {
+        p->next = last->next;
+        p->prev = last;
+        last->next->prev = p;
+        last->next = p;
+    } else
+        p->prev = p->next = p;
+    return p;
+}
+
+static void glu_tess_remove(struct glu_tess_node *p) {
+    p->removed = true;
+    p->next->prev = p->prev;
+    p->prev->next = p->next;
+    if (p->prev_z)
+        p->prev_z->next_z = p->next_z;
+    if (p->next_z)
+        p->next_z->prev_z = p->prev_z;
+}
+
+static int glu_tess_band(const struct glu_tess_ctx *ctx, double y) {
+    return MIN(MAX((int)((y - ctx->band_min) * ctx->band_scale), 0), ctx->band_count - 1);
+}
+
+// Registers `node` in every band overlapping [y0, y1], the edge that is
+// tested is always the node's current one (node -> node->next)
+static void glu_tess_band_add(struct glu_tess_ctx *ctx, struct glu_tess_node *node, double y0, double y1) {
+    int b0 = glu_tess_band(ctx, MIN(y0, y1)), b1 = glu_tess_band(ctx, MAX(y0, y1));
+    for (int b = b0; b <= b1; b++) {
+        struct glu_tess_band_entry *entry = glu_tess_alloc(ctx, sizeof(struct glu_tess_band_entry));
+        entry->node = node;
+        entry->next = ctx->bands[b];
+        ctx->bands[b] = entry;
+    }
+}
+
+// Twice the signed area, negative when p -> q -> r turns left
+static inline double glu_tess_area(const struct glu_tess_node *p, const struct glu_tess_node *q, const struct glu_tess_node *r) {
+    return (q->y - p->y) * (r->x - q->x) - (q->x - p->x) * (r->y - q->y);
+}
+
+static inline bool glu_tess_equals(const struct glu_tess_node *a, const struct glu_tess_node *b) {
+    return a->x == b->x && a->y == b->y;
+}
+
+static inline bool glu_tess_in_triangle(double ax, double ay, double bx, double by, double cx, double cy, double px, double py) {
+    return (cx - px) * (ay - py) >= (ax - px) * (cy - py) &&
+           (ax - px) * (by - py) >= (bx - px) * (ay - py) &&
+           (bx - px) * (cy - py) >= (cx - px) * (by - py);
+}
+
+static inline int glu_tess_sign(double v) {
+    return (v > 0.) - (v < 0.);
+}
+
+static inline bool glu_tess_on_segment(const struct glu_tess_node *p, const struct glu_tess_node *q, const struct glu_tess_node *r) {
+    return q->x <= MAX(p->x, r->x) && q->x >= MIN(p->x, r->x) &&
+           q->y <= MAX(p->y, r->y) && q->y >= MIN(p->y, r->y);
+}
+
+static bool glu_tess_intersects(const struct glu_tess_node *p1, const struct glu_tess_node *q1,
+                                const struct glu_tess_node *p2, const struct glu_tess_node *q2) {
+    int o1 = glu_tess_sign(glu_tess_area(p1, q1, p2));
+    int o2 = glu_tess_sign(glu_tess_area(p1, q1, q2));
+    int o3 = glu_tess_sign(glu_tess_area(p2, q2, p1));
+    int o4 = glu_tess_sign(glu_tess_area(p2, q2, q1));
+    return (o1 != o2 && o3 != o4) ||
+           (!o1 && glu_tess_on_segment(p1, p2, q1)) ||
+           (!o2 && glu_tess_on_segment(p1, q2, q1)) ||
+           (!o3 && glu_tess_on_segment(p2, p1, q2)) ||
+           (!o4 && glu_tess_on_segment(p2, q1, q2));
+}
+
+static bool glu_tess_intersects_polygon(const struct glu_tess_node *a, const struct glu_tess_node *b) {
+    const struct glu_tess_node *p = a;
+    do {
+        if (p->i != a->i && p->next->i != a->i && p->i != b->i && p->next->i != b->i &&
+            glu_tess_intersects(p, p->next, a, b))
+            return true;
+        p = p->next;
+    } while (p != a);
+    return false;
+}
+
+static bool glu_tess_locally_inside(const struct glu_tess_node *a, const struct glu_tess_node *b) {
+    return glu_tess_area(a->prev, a, a->next) < 0. ?
+        glu_tess_area(a, b, a->next) >= 0. && glu_tess_area(a, a->prev, b) >= 0. :
+        glu_tess_area(a, b, a->prev) < 0. || glu_tess_area(a, a->next, b) < 0.;
+}
+
+static bool glu_tess_middle_inside(const struct glu_tess_node *a, const struct glu_tess_node *b) {
+    const struct glu_tess_node *p = a;
+    bool inside = false;
+    double px = (a->x + b->x) / 2., py = (a->y + b->y) / 2.;
+    do {
+        if ((p->y > py) != (p->next->y > py) && p->next->y != p->y &&
+            px < (p->next->x - p->x) * (py - p->y) / (p->next->y - p->y) + p->x)
+            inside = !inside;
+        p = p->next;
+    } while (p != a);
+    return inside;
+}
+
+static bool glu_tess_valid_diagonal(const struct glu_tess_node *a, const struct glu_tess_node *b) {
+    return a->next->i != b->i && a->prev->i != b->i && !glu_tess_intersects_polygon(a, b) &&
+           ((glu_tess_locally_inside(a, b) && glu_tess_locally_inside(b, a) && glu_tess_middle_inside(a, b) &&
+             (glu_tess_area(a->prev, a, b->prev) != 0. || glu_tess_area(a, b->prev, b) != 0.)) ||
+            (glu_tess_equals(a, b) && glu_tess_area(a->prev, a, a->next) > 0. && glu_tess_area(b->prev, b, b->next) > 0.));
+}
+
+// Links a and b with a bridge, duplicating both so the polygon splits in
+// two (or a hole merges into its outer ring). Returns the copy of b.
+static struct glu_tess_node* glu_tess_split(struct glu_tess_ctx *ctx, struct glu_tess_node *a, struct glu_tess_node *b) {
+    struct glu_tess_node *a2 = glu_tess_insert(ctx, a->i, NULL);
+    struct glu_tess_node *b2 = glu_tess_insert(ctx, b->i, NULL);
+    struct glu_tess_node *an = a->next, *bp = b->prev;
+    a->next = b;
+    b->prev = a;
+    a2->next = an;
+    an->prev = a2;
+    b2->next = a2;
+    a2->prev = b2;
+    bp->next = b2;
+    b2->prev = bp;
+    return b2;
+}
+
+// Removes duplicate and collinear points
+static struct glu_tess_node* glu_tess_filter(struct glu_tess_ctx *ctx, struct glu_tess_node *start, struct glu_tess_node *end) {
+    if (!start)
+        return start;
+    if (!end)
+        end = start;
+    struct glu_tess_node *p = start;
+    bool again;
+    do {
+        again = false;
+        if (!p->steiner && (glu_tess_equals(p, p->next) || glu_tess_area(p->prev, p, p->next) == 0.)) {
+            // The previous edge now also spans the removed one
+            if (ctx->bands)
+                glu_tess_band_add(ctx, p->prev, p->y, p->next->y);
+            glu_tess_remove(p);
+            p = end = p->prev;
+            if (p == p->next)
+                break;
+            again = true;
+        } else
+            p = p->next;
+    } while (again || p != end);
+    return end;
+}
+
+static int32_t glu_tess_z_order(const struct glu_tess_ctx *ctx, double fx, double fy) {
+    uint32_t x = (uint32_t)(int32_t)((fx - ctx->min_x) * ctx->inv_size);
+    uint32_t y = (uint32_t)(int32_t)((fy - ctx->min_y) * ctx->inv_size);
+    x = (x | (x << 8)) & 0x00FF00FF;
+    x = (x | (x << 4)) & 0x0F0F0F0F;
+    x = (x | (x << 2)) & 0x33333333;
+    x = (x | (x << 1)) & 0x55555555;
+    y = (y | (y << 8)) & 0x00FF00FF;
+    y = (y | (y << 4)) & 0x0F0F0F0F;
+    y = (y | (y << 2)) & 0x33333333;
+    y = (y | (y << 1)) & 0x55555555;
+    return (int32_t)(x | (y << 1));
+}
+
+// Bottom-up merge sort of the z-order list
+static void glu_tess_sort_z(struct glu_tess_node *list) {
+    int in_size = 1, merges;
+    do {
+        struct glu_tess_node *p = list, *tail = NULL;
+        list = NULL;
+        merges = 0;
+        while (p) {
+            merges++;
+            struct glu_tess_node *q = p;
+            int p_size = 0, q_size = in_size;
+            for (int i = 0; i < in_size && q; i++, p_size++)
+                q = q->next_z;
+            while (p_size > 0 || (q_size > 0 && q)) {
+                struct glu_tess_node *e;
+                if (p_size && (!q_size || !q || p->z <= q->z)) {
+                    e = p;
+                    p = p->next_z;
+                    p_size--;
+                } else {
+                    e = q;
+                    q = q->next_z;
+                    q_size--;
+                }
+                if (tail)
+                    tail->next_z = e;
+                else
+                    list = e;
+                e->prev_z = tail;
+                tail = e;
+            }
+            p = q;
+        }
+        tail->next_z = NULL;
+        in_size *= 2;
+    } while (merges > 1);
+}
+
+static void glu_tess_index_curve(struct glu_tess_ctx *ctx, struct glu_tess_node *start) {
+    struct glu_tess_node *p = start;
+    do {
+        if (!p->z)
+            p->z = glu_tess_z_order(ctx, p->x, p->y);
+        p->prev_z = p->prev;
+        p->next_z = p->next;
+        p = p->next;
+    } while (p != start);
+    p->prev_z->next_z = NULL;
+    p->prev_z = NULL;
+    glu_tess_sort_z(p);
+}
+
+static bool glu_tess_is_ear(const struct glu_tess_node *ear) {
+    const struct glu_tess_node *a = ear->prev, *b = ear, *c = ear->next;
+    if (glu_tess_area(a, b, c) >= 0.)
+        return false;
+    double x0 = MIN(a->x, MIN(b->x, c->x)), y0 = MIN(a->y, MIN(b->y, c->y));
+    double x1 = MAX(a->x, MAX(b->x, c->x)), y1 = MAX(a->y, MAX(b->y, c->y));
+    for (const struct glu_tess_node *p = c->next; p != a; p = p->next)
+        if (p->x >= x0 && p->x <= x1 && p->y >= y0 && p->y <= y1 &&
+            glu_tess_in_triangle(a->x, a->y, b->x, b->y, c->x, c->y, p->x, p->y) &&
+            glu_tess_area(p->prev, p, p->next) >= 0.)
+            return false;
+    return true;
+}
+
+static bool glu_tess_is_ear_hashed(const struct glu_tess_ctx *ctx, const struct glu_tess_node *ear) {
+    const struct glu_tess_node *a = ear->prev, *b = ear, *c = ear->next;
+    if (glu_tess_area(a, b, c) >= 0.)
+        return false;
+    double x0 = MIN(a->x, MIN(b->x, c->x)), y0 = MIN(a->y, MIN(b->y, c->y));
+    double x1 = MAX(a->x, MAX(b->x, c->x)), y1 = MAX(a->y, MAX(b->y, c->y));
+    int32_t min_z = glu_tess_z_order(ctx, x0, y0), max_z = glu_tess_z_order(ctx, x1, y1);
+#define BLOCKS(P)                                                                   \
+    ((P)->x >= x0 && (P)->x <= x1 && (P)->y >= y0 && (P)->y <= y1 &&                \
+     (P) != a && (P) != c &&                                                        \
+     glu_tess_in_triangle(a->x, a->y, b->x, b->y, c->x, c->y, (P)->x, (P)->y) &&    \
+     glu_tess_area((P)->prev, (P), (P)->next) >= 0.)
+    // Walk both directions of the z-order list inside the triangle's range
+    const struct glu_tess_node *p = ear->prev_z, *n = ear->next_z;
+    while (p && p->z >= min_z && n && n->z <= max_z) {
+        if (BLOCKS(p) || BLOCKS(n))
+            return false;
+        p = p->prev_z;
+        n = n->next_z;
+    }
+    for (; p && p->z >= min_z; p = p->prev_z)
+        if (BLOCKS(p))
+            return false;
+    for (; n && n->z <= max_z; n = n->next_z)
+        if (BLOCKS(n))
+            return false;
+#undef BLOCKS
+    return true;
+}
+
+static struct glu_tess_node* glu_tess_cure_intersections(struct glu_tess_ctx *ctx, struct glu_tess_node *start) {
+    struct glu_tess_node *p = start;
+    do {
+        struct glu_tess_node *a = p->prev, *b = p->next->next;
+        if (!glu_tess_equals(a, b) && glu_tess_intersects(a, p, p->next, b) &&
+            glu_tess_locally_inside(a, b) && glu_tess_locally_inside(b, a)) {
+            glu_tess_triangle(ctx, a->i, p->i, b->i);
+            glu_tess_remove(p);
+            glu_tess_remove(p->next);
+            p = start = b;
+        }
+        p = p->next;
+    } while (p != start);
+    return glu_tess_filter(ctx, p, NULL);
+}
+
+static void glu_tess_earcut(struct glu_tess_ctx *ctx, struct glu_tess_node *ear, int pass);
+
+// Last resort, split the polygon along any valid diagonal and try again
+static void glu_tess_split_earcut(struct glu_tess_ctx *ctx, struct glu_tess_node *start) {
+    struct glu_tess_node *a = start;
+    do {
+        for (struct glu_tess_node *b = a->next->next; b != a->prev; b = b->next)
+            if (a->i != b->i && glu_tess_valid_diagonal(a, b)) {
+                struct glu_tess_node *c = glu_tess_split(ctx, a, b);
+                a = glu_tess_filter(ctx, a, a->next);
+                c = glu_tess_filter(ctx, c, c->next);
+                glu_tess_earcut(ctx, a, 0);
+                glu_tess_earcut(ctx, c, 0);
+                return;
+            }
+        a = a->next;
+    } while (a != start);
+}
+
+static void glu_tess_earcut(struct glu_tess_ctx *ctx, struct glu_tess_node *ear, int pass) {
+    if (!ear)
+        return;
+    if (!pass && ctx->inv_size != 0.)
+        glu_tess_index_curve(ctx, ear);
+    struct glu_tess_node *stop = ear;
+    while (ear->prev != ear->next) {
+        struct glu_tess_node *prev = ear->prev, *next = ear->next;
+        if (ctx->inv_size != 0. ? glu_tess_is_ear_hashed(ctx, ear) : glu_tess_is_ear(ear)) {
+            glu_tess_triangle(ctx, prev->i, ear->i, next->i);
+            glu_tess_remove(ear);
+            // Skipping the next vertex leads to fewer sliver triangles
+            ear = stop = next->next;
+            continue;
+        }
+        ear = next;
+        if (ear == stop) {
+            // No ears left, clean up and progressively try harder
+            switch (pass) {
+                case 0:
+                    glu_tess_earcut(ctx, glu_tess_filter(ctx, ear, NULL), 1);
+                    break;
+                case 1:
+                    glu_tess_earcut(ctx, glu_tess_cure_intersections(ctx, glu_tess_filter(ctx, ear, NULL)), 2);
+                    break;
+                case 2:
+                    glu_tess_split_earcut(ctx, ear);
+                    break;
+            }
+            break;
+        }
+    }
+}
+
+static double glu_tess_signed_area(const double *xy, GLsizei begin, GLsizei end) {
+    double sum = 0.;
+    for (GLsizei i = begin, j = end - 1; i < end; j = i++)
+        sum += (xy[j * 2] - xy[i * 2]) * (xy[i * 2 + 1] + xy[j * 2 + 1]);
+    return sum * .5;
+}
+
+// Builds a circular list from a contour, wound counter-clockwise for outer
+// rings and clockwise for holes
+static struct glu_tess_node* glu_tess_list(struct glu_tess_ctx *ctx, const struct glu_tess_contour *contour, bool ccw) {
+    struct glu_tess_node *last = NULL;
+    if (ccw == (contour->area > 0.))
+        for (GLsizei i = contour->begin; i < contour->end; i++)
+            last = glu_tess_insert(ctx, (GLuint)i, last);
+    else
+        for (GLsizei i = contour->end - 1; i >= contour->begin; i--)
+            last = glu_tess_insert(ctx, (GLuint)i, last);
+    if (last && glu_tess_equals(last, last->next)) {
+        glu_tess_remove(last);
+        last = last->next;
+    }
+    return last;
+}
+
+static struct glu_tess_node* glu_tess_leftmost(struct glu_tess_node *start) {
+    struct glu_tess_node *p = start, *leftmost = start;
+    do {
+        if (p->x < leftmost->x || (p->x == leftmost->x && p->y < leftmost->y))
+            leftmost = p;
+        p = p->next;
+    } while (p != start);
+    return leftmost;
+}
+
+static bool glu_tess_sector_contains(const struct glu_tess_node *m, const struct glu_tess_node *p) {
+    return glu_tess_area(m->prev, m, p->prev) < 0. && glu_tess_area(p->next, m, m->next) < 0.;
+}
+
+// Casts a ray left from the hole's leftmost point against the edge p -> next,
+// returns true if it hits a vertex exactly
+static inline bool glu_tess_bridge_ray(struct glu_tess_node *p, double hx, double hy, double *qx, struct glu_tess_node **m) {
+    if (hy <= p->y && hy >= p->next->y && p->next->y != p->y) {
+        double x = p->x + (hy - p->y) * (p->next->x - p->x) / (p->next->y - p->y);
+        if (x <= hx && x > *qx) {
+            *qx = x;
+            *m = p->x < p->next->x ? p : p->next;
+            return x == hx;
+        }
+    }
+    return false;
+}
+
+static inline void glu_tess_bridge_pick(struct glu_tess_node *p, struct glu_tess_node *hole, double qx,
+                                        double mx, double my, struct glu_tess_node **m, double *tan_min) {
+    double hx = hole->x, hy = hole->y;
+    if (hx >= p->x && p->x >= mx && hx != p->x &&
+        glu_tess_in_triangle(hy < my ? hx : qx, hy, mx, my, hy < my ? qx : hx, hy, p->x, p->y)) {
+        double tan = fabs(hy - p->y) / (hx - p->x);
+        if (glu_tess_locally_inside(p, hole) &&
+            (tan < *tan_min || (tan == *tan_min && (p->x > (*m)->x || (p->x == (*m)->x && glu_tess_sector_contains(*m, p)))))) {
+            *m = p;
+            *tan_min = tan;
+        }
+    }
+}
+
+// David Eberly's algorithm for finding a bridge between a hole and the outer
+// ring. Walks the whole ring unless the ring is indexed, then only the bands
+// the ray and the candidate triangle cross are visited.
+static struct glu_tess_node* glu_tess_hole_bridge(struct glu_tess_ctx *ctx, struct glu_tess_node *hole, struct glu_tess_node *outer) {
+    struct glu_tess_node *p = outer, *m = NULL;
+    double hx = hole->x, hy = hole->y, qx = -INFINITY;
+    // Find the segment left of the hole's leftmost point, closest to it
+    if (ctx->bands) {
+        for (struct glu_tess_band_entry *e = ctx->bands[glu_tess_band(ctx, hy)]; e; e = e->next)
+            if (!e->node->removed && glu_tess_bridge_ray(e->node, hx, hy, &qx, &m))
+                return m;
+    } else
+        do {
+            if (glu_tess_bridge_ray(p, hx, hy, &qx, &m))
+                return m;
+            p = p->next;
+        } while (p != outer);
+    if (!m)
+        return NULL;
+
+    // Any vertex inside the triangle (hole point, segment intersection,
+    // endpoint) would block the bridge, pick the one with the smallest angle
+    double mx = m->x, my = m->y, tan_min = INFINITY;
+    if (ctx->bands) {
+        int b0 = glu_tess_band(ctx, MIN(hy, my)), b1 = glu_tess_band(ctx, MAX(hy, my));
+        for (int b = b0; b <= b1; b++)
+            for (struct glu_tess_band_entry *e = ctx->bands[b]; e; e = e->next)
+                if (!e->node->removed)
+                    glu_tess_bridge_pick(e->node, hole, qx, mx, my, &m, &tan_min);
+    } else {
+        struct glu_tess_node *stop = m;
+        p = m;
+        do {
+            glu_tess_bridge_pick(p, hole, qx, mx, my, &m, &tan_min);
+            p = p->next;
+        } while (p != stop);
+    }
+    return m;
+}
+
+static int glu_tess_compare_x(const void *a, const void *b) {
+    const struct glu_tess_node *na = *(struct glu_tess_node* const*)a, *nb = *(struct glu_tess_node* const*)b;
+    return na->x < nb->x ? -1 : na->x > nb->x ? 1 : (na->y > nb->y) - (na->y < nb->y);
+}
+
+static void glu_tess_group(struct glu_tess_ctx *ctx, int outer_index) {
+    struct glu_tess_contour *outer = &ctx->contours[outer_index];
+    struct glu_tess_node *node = glu_tess_list(ctx, outer, true);
+    if (!node || node->next == node->prev)
+        return;
+
+    GLsizei vertices = outer->end - outer->begin, holes = 0;
+    for (int h = outer->first_hole; h >= 0; h = ctx->contours[h].next_hole) {
+        vertices += ctx->contours[h].end - ctx->contours[h].begin;
+        holes++;
+    }
+    if (holes) {
+        struct glu_tess_node **queue = glu_tess_alloc(ctx, sizeof(struct glu_tess_node*) * holes);
+        GLsizei n = 0;
+        for (int h = outer->first_hole; h >= 0; h = ctx->contours[h].next_hole) {
+            struct glu_tess_node *list = glu_tess_list(ctx, &ctx->contours[h], false);
+            if (!list)
+                continue;
+            if (list == list->next)
+                list->steiner = true;
+            queue[n++] = glu_tess_leftmost(list);
+        }
+        // Bridging left to right keeps bridges from crossing each other
+        qsort(queue, n, sizeof(struct glu_tess_node*), glu_tess_compare_x);
+        if (holes >= GLU_TESS_BRIDGE_INDEX_MIN) {
+            double height = outer->max_y - outer->min_y;
+            ctx->band_count = height > 0. ? MIN(MAX(vertices / 8, 1), 1 << 16) : 1;
+            ctx->band_min = outer->min_y;
+            ctx->band_scale = height > 0. ? ctx->band_count / height : 0.;
+            ctx->bands = glu_tess_alloc(ctx, sizeof(struct glu_tess_band_entry*) * ctx->band_count);
+            memset(ctx->bands, 0, sizeof(struct glu_tess_band_entry*) * ctx->band_count);
+            struct glu_tess_node *p = node;
+            do {
+                glu_tess_band_add(ctx, p, p->y, p->next->y);
+                p = p->next;
+            } while (p != node);
+        }
+        for (GLsizei i = 0; i < n; i++) {
+            struct glu_tess_node *bridge = glu_tess_hole_bridge(ctx, queue[i], node);
+            if (!bridge)
+                continue;
+            struct glu_tess_node *reverse = glu_tess_split(ctx, bridge, queue[i]);
+            if (ctx->bands)
+                // The hole's edges and both sides of the bridge join the ring,
+                // from the bridge around the hole and back to the bridge's copy
+                for (struct glu_tess_node *p = bridge; ; p = p->next) {
+                    glu_tess_band_add(ctx, p, p->y, p->next->y);
+                    if (p == reverse->next)
+                        break;
+                }
+            glu_tess_filter(ctx, reverse, reverse->next);
+            node = glu_tess_filter(ctx, bridge, bridge->next);
+        }
+        ctx->bands = NULL;
+    }
+
+    ctx->inv_size = 0.;
+    if (vertices > GLU_TESS_HASH_MIN) {
+        double size = MAX(outer->max_x - outer->min_x, outer->max_y - outer->min_y);
+        ctx->min_x = outer->min_x;
+        ctx->min_y = outer->min_y;
+        ctx->inv_size = size != 0. ? 32767. / size : 0.;
+    }
+    glu_tess_earcut(ctx, node, 0);
+}
+
+static void glu_tess_build_bands(struct glu_tess_ctx *ctx, struct glu_tess_contour *c) {
+    GLsizei n = c->end - c->begin;
+    double height = c->max_y - c->min_y;
+    c->band_count = height > 0. ? MIN(MAX((int)sqrt((double)n), 1), 4096) : 1;
+    c->band_scale = height > 0. ? c->band_count / height : 0.;
+    c->band_offsets = glu_tess_alloc(ctx, sizeof(GLsizei) * (c->band_count + 1));
+    memset(c->band_offsets, 0, sizeof(GLsizei) * (c->band_count + 1));
+#define BAND(Y) MIN(MAX((int)(((Y) - c->min_y) * c->band_scale), 0), c->band_count - 1)
+    // Counting sort of edges into every band their y-range overlaps
+    for (int pass = 0; pass < 2; pass++) {
+        for (GLsizei i = c->begin, j = c->end - 1; i < c->end; j = i++) {
+            double ya = ctx->xy[j * 2 + 1], yb = ctx->xy[i * 2 + 1];
+            int b0 = BAND(MIN(ya, yb)), b1 = BAND(MAX(ya, yb));
+            for (int b = b0; b <= b1; b++)
+                if (pass)
+                    c->band_edges[c->band_offsets[b]++] = i;
+                else
+                    c->band_offsets[b + 1]++;
+        }
+        if (!pass) {
+            for (int b = 0; b < c->band_count; b++)
+                c->band_offsets[b + 1] += c->band_offsets[b];
+            c->band_edges = glu_tess_alloc(ctx, sizeof(GLsizei) * MAX(c->band_offsets[c->band_count], 1));
+        } else {
+            // The fill pass shifted every offset up by one band
+            memmove(c->band_offsets + 1, c->band_offsets, sizeof(GLsizei) * c->band_count);
+            c->band_offsets[0] = 0;
+        }
+    }
+}
+
+// Even-odd point in contour test
+static bool glu_tess_contains(struct glu_tess_ctx *ctx, struct glu_tess_contour *c, double px, double py) {
+    const double *xy = ctx->xy;
+    bool inside = false;
+#define CROSSES(J, I)                                                             \
+    ((xy[(I) * 2 + 1] > py) != (xy[(J) * 2 + 1] > py) &&                          \
+     px < (xy[(J) * 2] - xy[(I) * 2]) * (py - xy[(I) * 2 + 1]) /                  \
+          (xy[(J) * 2 + 1] - xy[(I) * 2 + 1]) + xy[(I) * 2])
+    if (c->end - c->begin <= GLU_TESS_BANDS_MIN) {
+        for (GLsizei i = c->begin, j = c->end - 1; i < c->end; j = i++)
+            if (CROSSES(j, i))
+                inside = !inside;
+        return inside;
+    }
+    if (!c->band_offsets)
+        glu_tess_build_bands(ctx, c);
+    int band = BAND(py);
+    for (GLsizei k = c->band_offsets[band]; k < c->band_offsets[band + 1]; k++) {
+        GLsizei i = c->band_edges[k], j = i == c->begin ? c->end - 1 : i - 1;
+        if (CROSSES(j, i))
+            inside = !inside;
+    }
+#undef CROSSES
+#undef BAND
+    return inside;
+}
+
+static bool glu_tess_filled(GLenum rule, int winding) {
+    switch (rule) {
+        case GLU_TESS_WINDING_ODD:
+            return winding & 1;
+        case GLU_TESS_WINDING_NONZERO:
+            return winding != 0;
+        case GLU_TESS_WINDING_POSITIVE:
+            return winding > 0;
+        case GLU_TESS_WINDING_NEGATIVE:
+            return winding < 0;
+        case GLU_TESS_WINDING_ABS_GEQ_TWO:
+            return winding >= 2 || winding <= -2;
+    }
+    return false;
+}
+
+static int glu_tess_compare_area(const void *a, const void *b) {
+    double da = fabs((*(struct glu_tess_contour* const*)a)->area);
+    double db = fabs((*(struct glu_tess_contour* const*)b)->area);
+    return (da < db) - (da > db);
+}
+
+// Decides which contours bound filled regions. The winding number just
+// outside a contour is the sum of the orientations of every contour that
+// encloses it, just inside adds its own orientation. Contours where the
+// rule gives the same answer on both sides don't bound anything.
+static void glu_tess_classify(struct glu_tess_ctx *ctx, GLenum rule) {
+    struct glu_tess_contour **sorted = glu_tess_alloc(ctx, sizeof(struct glu_tess_contour*) * MAX(ctx->contour_count, 1));
+    GLsizei n = 0;
+    for (GLsizei i = 0; i < ctx->contour_count; i++) {
+        struct glu_tess_contour *c = &ctx->contours[i];
+        c->kind = GLU_TESS_CONTOUR_DROPPED;
+        c->parent = c->first_hole = c->next_hole = -1;
+        c->band_offsets = c->band_edges = NULL;
+        if (c->end - c->begin < 3)
+            continue;
+        c->min_x = c->min_y = INFINITY;
+        c->max_x = c->max_y = -INFINITY;
+        for (GLsizei j = c->begin; j < c->end; j++) {
+            c->min_x = MIN(c->min_x, ctx->xy[j * 2]);
+            c->max_x = MAX(c->max_x, ctx->xy[j * 2]);
+            c->min_y = MIN(c->min_y, ctx->xy[j * 2 + 1]);
+            c->max_y = MAX(c->max_y, ctx->xy[j * 2 + 1]);
+        }
+        if ((c->area = glu_tess_signed_area(ctx->xy, c->begin, c->end)) != 0.)
+            sorted[n++] = c;
+    }
+    // Only a larger contour can enclose a smaller one
+    qsort(sorted, n, sizeof(struct glu_tess_contour*), glu_tess_compare_area);
+    for (GLsizei i = 0; i < n; i++) {
+        struct glu_tess_contour *c = sorted[i];
+        double px = ctx->xy[c->begin * 2], py = ctx->xy[c->begin * 2 + 1];
+        int winding = 0, parent = -1;
+        for (GLsizei j = 0; j < i; j++) {
+            struct glu_tess_contour *d = sorted[j];
+            if (c->min_x < d->min_x || c->max_x > d->max_x || c->min_y < d->min_y || c->max_y > d->max_y ||
+                !glu_tess_contains(ctx, d, px, py))
+                continue;
+            winding += d->area > 0. ? 1 : -1;
+            if (d->kind == GLU_TESS_CONTOUR_OUTER)
+                parent = (int)(d - ctx->contours);
+        }
+        bool outside = glu_tess_filled(rule, winding);
+        bool inside = glu_tess_filled(rule, winding + (c->area > 0. ? 1 : -1));
+        if (inside && !outside)
+            c->kind = GLU_TESS_CONTOUR_OUTER;
+        else if (outside && !inside && parent >= 0) {
+            c->kind = GLU_TESS_CONTOUR_HOLE;
+            c->parent = parent;
+            c->next_hole = ctx->contours[parent].first_hole;
+            ctx->contours[parent].first_hole = (int)(c - ctx->contours);
+        }
+    }
+}
+
+// Returns the number of indices the polygon needs (which may be more than
+// `capacity`) or -1 when out of memory
+static GLsizei glu_tess_run(struct glu_arena *arena, const double *xy,
+                            struct glu_tess_contour *contours, GLsizei contour_count,
+                            GLenum rule, bool triangulate, GLuint *out, GLsizei capacity) {
+    struct glu_tess_ctx ctx = {
+        .arena = arena,
+        .xy = xy,
+        .contours = contours,
+        .contour_count = contour_count,
+        .out = out,
+        .capacity = capacity
+    };
+    if (setjmp(ctx.oom))
+        return -1;
+    glu_tess_classify(&ctx, rule);
+    if (triangulate)
+        for (GLsizei i = 0; i < contour_count; i++)
+            if (contours[i].kind == GLU_TESS_CONTOUR_OUTER)
+                glu_tess_group(&ctx, (int)i);
+    return ctx.written;
+}
+
+enum {
+    GLU_TESS_STATE_IDLE = 0,
+    GLU_TESS_STATE_POLYGON,
+    GLU_TESS_STATE_CONTOUR
+};
+
+struct glu_tess_input {
+    GLdouble location[3];
+    void *data;
+};
+
+struct GLUtesselator {
+    int state;
+    void *polygon_data;
+    GLenum winding_rule;
+    GLboolean boundary_only;
+    GLdouble tolerance;
+    GLdouble normal[3];
+
+    void(*begin)(GLenum);
+    void(*begin_data)(GLenum, void*);
+    void(*vertex)(void*);
+    void(*vertex_data)(void*, void*);
+    void(*end)(void);
+    void(*end_data)(void*);
+    void(*error)(GLenum);
+    void(*error_data)(GLenum, void*);
+    void(*edge_flag)(GLboolean);
+    void(*edge_flag_data)(GLboolean, void*);
+
+    // Current polygon, storage is kept between polygons
+    struct glu_tess_input *inputs;
+    size_t input_count, input_capacity;
+    struct glu_tess_contour *contours;
+    size_t contour_count, contour_capacity;
+
+    GLuint *indices;
+    GLsizei index_capacity, index_count;
+    struct glu_arena arena;
+};
+
+static bool glu_tess_reserve(void **buffer, size_t *capacity, size_t needed, size_t size) {
+    if (needed <= *capacity)
+        return true;
+    size_t grown = MAX(needed, MAX(*capacity * 2, (size_t)64));
+    void *result = realloc(*buffer, grown * size);
+    if (!result)
+        return false;
+    *buffer = result;
+    *capacity = grown;
+    return true;
+}
+
+static void glu_tess_error(GLUtesselator *tess, GLenum err) {
+    if (tess->error_data)
+        tess->error_data(err, tess->polygon_data);
+    else if (tess->error)
+        tess->error(err);
+}
+
+static void glu_tess_begin(GLUtesselator *tess, GLenum type) {
+    if (tess->begin_data)
+        tess->begin_data(type, tess->polygon_data);
+    else if (tess->begin)
+        tess->begin(type);
+}
+
+static void glu_tess_vertex(GLUtesselator *tess, void *data) {
+    if (tess->vertex_data)
+        tess->vertex_data(data, tess->polygon_data);
+    else if (tess->vertex)
+        tess->vertex(data);
+}
+
+static void glu_tess_end(GLUtesselator *tess) {
+    if (tess->end_data)
+        tess->end_data(tess->polygon_data);
+    else if (tess->end)
+        tess->end();
+}
+
+static void glu_tess_edge_flag(GLUtesselator *tess, GLboolean flag) {
+    if (tess->edge_flag_data)
+        tess->edge_flag_data(flag, tess->polygon_data);
+    else if (tess->edge_flag)
+        tess->edge_flag(flag);
+}
+
+GLUtesselator* gluNewTess(void) {
+    GLUtesselator *tess = calloc(1, sizeof(GLUtesselator));
+    if (tess) {
+        tess->winding_rule = GLU_TESS_WINDING_ODD;
+        tess->boundary_only = GL_FALSE;
+    }
+    return tess;
+}
+
+void gluDeleteTess(GLUtesselator *tess) {
+    if (!tess)
+        return;
+    free(tess->inputs);
+    free(tess->contours);
+    glu_arena_free(&tess->arena);
+    free(tess);
+}
+
+void gluTessProperty(GLUtesselator *tess, GLenum which, GLdouble data) {
+    switch (which) {
+        case GLU_TESS_WINDING_RULE:
+            if (data != GLU_TESS_WINDING_ODD && data != GLU_TESS_WINDING_NONZERO &&
+                data != GLU_TESS_WINDING_POSITIVE && data != GLU_TESS_WINDING_NEGATIVE &&
+                data != GLU_TESS_WINDING_ABS_GEQ_TWO)
+                break;
+            tess->winding_rule = (GLenum)data;
+            return;
+        case GLU_TESS_BOUNDARY_ONLY:
+            tess->boundary_only = data != 0.;
+            return;
+        case GLU_TESS_TOLERANCE:
+            // No vertices are ever merged, accepted for compatibility
+            if (data < 0. || data > 1.)
+                break;
+            tess->tolerance = data;
+            return;
+    }
+    glu_tess_error(tess, GLU_INVALID_ENUM);
+}
+
+void gluGetTessProperty(GLUtesselator *tess, GLenum which, GLdouble *data) {
+    switch (which) {
+        case GLU_TESS_WINDING_RULE:
+            *data = tess->winding_rule;
+            break;
+        case GLU_TESS_BOUNDARY_ONLY:
+            *data = tess->boundary_only;
+            break;
+        case GLU_TESS_TOLERANCE:
+            *data = tess->tolerance;
+            break;
+        default:
+            *data = 0.;
+            glu_tess_error(tess, GLU_INVALID_ENUM);
+    }
+}
+
+void gluTessNormal(GLUtesselator *tess, GLdouble valueX, GLdouble valueY, GLdouble valueZ) {
+    tess->normal[0] = valueX;
+    tess->normal[1] = valueY;
+    tess->normal[2] = valueZ;
+}
+
+void gluTessCallback(GLUtesselator *tess, GLenum which, _GLUfuncptr CallBackFunc) {
+    switch (which) {
+#define X(ENUM, FIELD)                                     \
+        case ENUM:                                         \
+            tess->FIELD = (__typeof__(tess->FIELD))CallBackFunc; \
+            break;
+        X(GLU_TESS_BEGIN, begin)
+        X(GLU_TESS_BEGIN_DATA, begin_data)
+        X(GLU_TESS_VERTEX, vertex)
+        X(GLU_TESS_VERTEX_DATA, vertex_data)
+        X(GLU_TESS_END, end)
+        X(GLU_TESS_END_DATA, end_data)
+        X(GLU_TESS_ERROR, error)
+        X(GLU_TESS_ERROR_DATA, error_data)
+        X(GLU_TESS_EDGE_FLAG, edge_flag)
+        X(GLU_TESS_EDGE_FLAG_DATA, edge_flag_data)
+#undef X
+        case GLU_TESS_COMBINE:
+        case GLU_TESS_COMBINE_DATA:
+            // Never called, no vertices are created
+            break;
+        default:
+            glu_tess_error(tess, GLU_INVALID_ENUM);
+    }
+}
+
+void gluTessIndexBuffer(GLUtesselator *tess, GLuint *indices, GLsizei capacity) {
+    tess->indices = indices;
+    tess->index_capacity = indices ? MAX(capacity, 0) : 0;
+}
+
+GLsizei gluTessIndexCount(GLUtesselator *tess) {
+    return tess->index_count;
+}
+
+void gluTessBeginPolygon(GLUtesselator *tess, GLvoid *data) {
+    if (tess->state != GLU_TESS_STATE_IDLE)
+        glu_tess_error(tess, GLU_TESS_MISSING_END_POLYGON);
+    tess->state = GLU_TESS_STATE_POLYGON;
+    tess->polygon_data = data;
+    tess->input_count = tess->contour_count = 0;
+}
+
+void gluTessBeginContour(GLUtesselator *tess) {
+    if (tess->state == GLU_TESS_STATE_IDLE) {
+        glu_tess_error(tess, GLU_TESS_MISSING_BEGIN_POLYGON);
+        gluTessBeginPolygon(tess, NULL);
+    } else if (tess->state == GLU_TESS_STATE_CONTOUR) {
+        glu_tess_error(tess, GLU_TESS_MISSING_END_CONTOUR);
+        gluTessEndContour(tess);
+    }
+    if (!glu_tess_reserve((void**)&tess->contours, &tess->contour_capacity,
+                          tess->contour_count + 1, sizeof(struct glu_tess_contour))) {
+        glu_tess_error(tess, GLU_OUT_OF_MEMORY);
+        return;
+    }
+    tess->contours[tess->contour_count++] = (struct glu_tess_contour) {
+        .begin = (GLsizei)tess->input_count,
+        .end = (GLsizei)tess->input_count
+    };
+    tess->state = GLU_TESS_STATE_CONTOUR;
+}
+
+void gluTessVertex(GLUtesselator *tess, GLdouble *location, GLvoid *data) {
+    if (tess->state != GLU_TESS_STATE_CONTOUR) {
+        glu_tess_error(tess, GLU_TESS_MISSING_BEGIN_CONTOUR);
+        gluTessBeginContour(tess);
+        if (tess->state != GLU_TESS_STATE_CONTOUR)
+            return;
+    }
+    if (!glu_tess_reserve((void**)&tess->inputs, &tess->input_capacity,
+                          tess->input_count + 1, sizeof(struct glu_tess_input))) {
+        glu_tess_error(tess, GLU_OUT_OF_MEMORY);
+        return;
+    }
+    struct glu_tess_input *input = &tess->inputs[tess->input_count++];
+    bool clamped = false;
+    for (int i = 0; i < 3; i++) {
+        input->location[i] = location[i];
+        if (fabs(location[i]) > GLU_TESS_MAX_COORD) {
+            input->location[i] = location[i] < 0. ? -GLU_TESS_MAX_COORD : GLU_TESS_MAX_COORD;
+            clamped = true;
+        }
+    }
+    input->data = data;
+    tess->contours[tess->contour_count - 1].end = (GLsizei)tess->input_count;
+    if (clamped)
+        glu_tess_error(tess, GLU_TESS_COORD_TOO_LARGE);
+}
+
+void gluTessEndContour(GLUtesselator *tess) {
+    if (tess->state != GLU_TESS_STATE_CONTOUR) {
+        glu_tess_error(tess, tess->state == GLU_TESS_STATE_IDLE ? GLU_TESS_MISSING_BEGIN_POLYGON : GLU_TESS_MISSING_BEGIN_CONTOUR);
+        return;
+    }
+    tess->state = GLU_TESS_STATE_POLYGON;
+}
+
+// Projects onto the plane perpendicular to the dominant axis of the normal,
+// keeping the handedness so counter-clockwise around the normal stays
+// counter-clockwise in 2D
+static void glu_tess_project(GLUtesselator *tess, double *xy) {
+    double n[3] = {tess->normal[0], tess->normal[1], tess->normal[2]};
+    if (n[0] == 0. && n[1] == 0. && n[2] == 0.) {
+        // Newell's method over every contour
+        for (size_t c = 0; c < tess->contour_count; c++)
+            for (GLsizei i = tess->contours[c].begin, j = tess->contours[c].end - 1; i < tess->contours[c].end; j = i++) {
+                const GLdouble *a = tess->inputs[j].location, *b = tess->inputs[i].location;
+                n[0] += (a[1] - b[1]) * (a[2] + b[2]);
+                n[1] += (a[2] - b[2]) * (a[0] + b[0]);
+                n[2] += (a[0] - b[0]) * (a[1] + b[1]);
+            }
+        if (n[0] == 0. && n[1] == 0. && n[2] == 0.)
+            n[2] = 1.;
+    }
+    int axis = fabs(n[0]) > fabs(n[1]) ? (fabs(n[0]) > fabs(n[2]) ? 0 : 2) : (fabs(n[1]) > fabs(n[2]) ? 1 : 2);
+    int u = (axis + 1) % 3, v = (axis + 2) % 3;
+    if (n[axis] < 0.) {
+        int t = u;
+        u = v;
+        v = t;
+    }
+    for (size_t i = 0; i < tess->input_count; i++) {
+        xy[i * 2] = tess->inputs[i].location[u];
+        xy[i * 2 + 1] = tess->inputs[i].location[v];
+    }
+}
+
+static GLsizei glu_tess_index_bound(GLsizei vertices, GLsizei contours) {
+    // Every hole bridge adds two vertices, a polygon of n vertices has n - 2 triangles
+    return (vertices + contours * 2) * 3;
+}
+
+void gluTessEndPolygon(GLUtesselator *tess) {
+    if (tess->state == GLU_TESS_STATE_IDLE) {
+        glu_tess_error(tess, GLU_TESS_MISSING_BEGIN_POLYGON);
+        return;
+    }
+    if (tess->state == GLU_TESS_STATE_CONTOUR) {
+        glu_tess_error(tess, GLU_TESS_MISSING_END_CONTOUR);
+        gluTessEndContour(tess);
+    }
+    tess->state = GLU_TESS_STATE_IDLE;
+    tess->index_count = 0;
+    if (!tess->input_count)
+        return;
+
+    GLsizei count = (GLsizei)tess->input_count, contours = (GLsizei)tess->contour_count;
+    bool callbacks = tess->begin || tess->begin_data || tess->vertex || tess->vertex_data;
+    GLuint *out = tess->indices;
+    GLsizei capacity = tess->index_capacity;
+    double *xy = glu_arena_alloc(&tess->arena, sizeof(double) * 2 * count);
+    if (xy && callbacks && !tess->boundary_only) {
+        // Callbacks need the whole list, even when the index buffer is too small
+        capacity = glu_tess_index_bound(count, contours);
+        out = glu_arena_alloc(&tess->arena, sizeof(GLuint) * capacity);
+    }
+    GLsizei written = -1;
+    if (xy && (out || !capacity)) {
+        glu_tess_project(tess, xy);
+        written = glu_tess_run(&tess->arena, xy, tess->contours, contours,
+                               tess->winding_rule, !tess->boundary_only, out, capacity);
+    }
+    if (written < 0) {
+        glu_arena_reset(&tess->arena);
+        glu_tess_error(tess, GLU_OUT_OF_MEMORY);
+        return;
+    }
+
+    if (tess->boundary_only) {
+        for (GLsizei i = 0; i < contours; i++) {
+            struct glu_tess_contour *c = &tess->contours[i];
+            if (c->kind == GLU_TESS_CONTOUR_DROPPED)
+                continue;
+            glu_tess_begin(tess, GL_LINE_LOOP);
+            for (GLsizei j = c->begin; j < c->end; j++)
+                glu_tess_vertex(tess, tess->inputs[j].data);
+            glu_tess_end(tess);
+        }
+    } else {
+        tess->index_count = written;
+        if (out != tess->indices && tess->indices)
+            memcpy(tess->indices, out, sizeof(GLuint) * MIN(written, tess->index_capacity));
+        if (callbacks && written) {
+            bool edges = tess->edge_flag || tess->edge_flag_data;
+            GLuint *next = edges ? glu_arena_alloc(&tess->arena, sizeof(GLuint) * count) : NULL;
+            if (next)
+                for (GLsizei i = 0; i < contours; i++)
+                    for (GLsizei j = tess->contours[i].begin; j < tess->contours[i].end; j++)
+                        next[j] = j + 1 < tess->contours[i].end ? j + 1 : tess->contours[i].begin;
+            int flag = -1;
+            glu_tess_begin(tess, GL_TRIANGLES);
+            for (GLsizei i = 0; i < written; i += 3)
+                for (int k = 0; k < 3; k++) {
+                    GLuint a = out[i + k], b = out[i + (k + 1) % 3];
+                    if (next) {
+                        // The edge starting at this vertex lies on the boundary if the
+                        // two vertices were neighbours in their contour
+                        int boundary = next[a] == b || next[b] == a;
+                        if (boundary != flag)
+                            glu_tess_edge_flag(tess, (GLboolean)(flag = boundary));
+                    }
+                    glu_tess_vertex(tess, tess->inputs[a].data);
+                }
+            glu_tess_end(tess);
+        }
+    }
+    glu_arena_reset(&tess->arena);
+}
+
+GLsizei gluTessPolygon2f(GLUtesselator *tess, const GLfloat *xy, const GLsizei *ends, GLsizei contours, GLuint *indices, GLsizei capacity) {
+    if (tess->state != GLU_TESS_STATE_IDLE) {
+        glu_tess_error(tess, GLU_TESS_MISSING_END_POLYGON);
+        tess->state = GLU_TESS_STATE_IDLE;
+    }
+    tess->index_count = 0;
+    if (!xy || !ends || contours <= 0 || ends[contours - 1] <= 0)
+        return 0;
+    GLsizei count = ends[contours - 1];
+    double *points = glu_arena_alloc(&tess->arena, sizeof(double) * 2 * count);
+    struct glu_tess_contour *list = glu_arena_alloc(&tess->arena, sizeof(struct glu_tess_contour) * contours);
+    GLsizei written = -1;
+    if (points && list) {
+        for (GLsizei i = 0; i < count * 2; i++)
+            points[i] = xy[i];
+        for (GLsizei i = 0; i < contours; i++)
+            list[i] = (struct glu_tess_contour) {
+                .begin = i ? MIN(ends[i - 1], count) : 0,
+                .end = MIN(MAX(ends[i], i ? ends[i - 1] : 0), count)
+            };
+        written = glu_tess_run(&tess->arena, points, list, contours,
+                               tess->winding_rule, true, indices, indices ? MAX(capacity, 0) : 0);
+    }
+    glu_arena_reset(&tess->arena);
+    if (written < 0) {
+        glu_tess_error(tess, GLU_OUT_OF_MEMORY);
+        return 0;
+    }
+    return tess->index_count = written;
+}
+
+/* Projection and picking */
+
+// Column-major 4x4 helpers, done in double like the reference GLU
+static void glu_mul_matrixd(const double *a, const double *b, double *result) {
+    for (int c = 0; c < 4; c++)
+        for (int r = 0; r < 4; r++)
+            result[c * 4 + r] = a[r] * b[c * 4] + a[4 + r] * b[c * 4 + 1] +
+                                a[8 + r] * b[c * 4 + 2] + a[12 + r] * b[c * 4 + 3];
+}
+
+// Gauss-Jordan elimination with partial pivoting
+static bool glu_invert_matrixd(const double *m, double *result) {
+    double a[4][8];
+    for (int r = 0; r < 4; r++)
+        for (int c = 0; c < 4; c++) {
+            a[r][c] = m[c * 4 + r];
+            a[r][c + 4] = r == c ? 1. : 0.;
+        }
+    for (int c = 0; c < 4; c++) {
+        int pivot = c;
+        for (int r = c + 1; r < 4; r++)
+            if (fabs(a[r][c]) > fabs(a[pivot][c]))
+                pivot = r;
+        if (a[pivot][c] == 0.)
+            return false;
+        if (pivot != c)
+            for (int k = 0; k < 8; k++) {
+                double t = a[c][k];
+                a[c][k] = a[pivot][k];
+                a[pivot][k] = t;
+            }
+        double scale = 1. / a[c][c];
+        for (int k = 0; k < 8; k++)
+            a[c][k] *= scale;
+        for (int r = 0; r < 4; r++)
+            if (r != c && a[r][c] != 0.) {
+                double f = a[r][c];
+                for (int k = 0; k < 8; k++)
+                    a[r][k] -= f * a[c][k];
+            }
+    }
+    for (int r = 0; r < 4; r++)
+        for (int c = 0; c < 4; c++)
+            result[c * 4 + r] = a[r][c + 4];
+    return true;
+}
+
+// window * projection * model, the viewport transform is folded in so a
+// point only needs one matrix multiply and one divide
+static void glu_window_matrixd(const double *model, const double *proj, const GLint *view, double *result) {
+    double window[16] = {
+        view[2] * .5, 0., 0., 0.,
+        0., view[3] * .5, 0., 0.,
+        0., 0., .5, 0.,
+        view[0] + view[2] * .5, view[1] + view[3] * .5, .5, 1.
+    };
+    double mvp[16];
+    glu_mul_matrixd(proj, model, mvp);
+    glu_mul_matrixd(window, mvp, result);
+}
+
+static void glu_load_matrixf(const GLfloat *m, double *result) {
+    for (int i = 0; i < 16; i++)
+        result[i] = m[i];
+}
+
+static GLint glu_transformd(const double *m, const double *in, double *out) {
+    double v[4];
+    for (int r = 0; r < 4; r++)
+        v[r] = m[r] * in[0] + m[4 + r] * in[1] + m[8 + r] * in[2] + m[12 + r];
+    if (v[3] == 0.)
+        return GL_FALSE;
+    for (int r = 0; r < 3; r++)
+        out[r] = v[r] / v[3];
+    return GL_TRUE;
+}
+
+GLint gluProject(GLdouble objX, GLdouble objY, GLdouble objZ, const GLdouble *model, const GLdouble *proj, const GLint *view, GLdouble *winX, GLdouble *winY, GLdouble *winZ) {
+    double m[16], in[3] = {objX, objY, objZ}, out[3];
+    glu_window_matrixd(model, proj, view, m);
+    if (!glu_transformd(m, in, out))
+        return GL_FALSE;
+    *winX = out[0];
+    *winY = out[1];
+    *winZ = out[2];
+    return GL_TRUE;
+}
+
+GLint gluUnProject(GLdouble winX, GLdouble winY, GLdouble winZ, const GLdouble *model, const GLdouble *proj, const GLint *view, GLdouble *objX, GLdouble *objY, GLdouble *objZ) {
+    double m[16], inv[16], in[3] = {winX, winY, winZ}, out[3];
+    glu_window_matrixd(model, proj, view, m);
+    if (!glu_invert_matrixd(m, inv) || !glu_transformd(inv, in, out))
+        return GL_FALSE;
+    *objX = out[0];
+    *objY = out[1];
+    *objZ = out[2];
+    return GL_TRUE;
+}
+
+struct glu_transform_job {
+    f32x4 columns[4];
+    const GLfloat *in;
+    GLfloat *out;
+};
+
+static void glu_transform_rows(void *arg, int begin, int end) {
+    struct glu_transform_job *job = arg;
+    f32x4 c0 = job->columns[0], c1 = job->columns[1], c2 = job->columns[2], c3 = job->columns[3];
+    for (int i = begin; i < end; i++) {
+        const GLfloat *p = job->in + (size_t)i * 3;
+        f32x4 v = c0 * p[0] + c1 * p[1] + c2 * p[2] + c3;
+        v *= 1.f / v[3];
+        // Scalar stores, a 16 byte store would clobber the next point
+        GLfloat *o = job->out + (size_t)i * 3;
+        o[0] = v[0];
+        o[1] = v[1];
+        o[2] = v[2];
+    }
+}
+
+static GLint glu_transform_array(const double *m, const GLfloat *in, GLsizei count, GLfloat *out) {
+    if (count <= 0)
+        return GL_TRUE;
+    struct glu_transform_job job = {.in = in, .out = out};
+    for (int c = 0; c < 4; c++)
+        job.columns[c] = (f32x4){(float)m[c * 4], (float)m[c * 4 + 1], (float)m[c * 4 + 2], (float)m[c * 4 + 3]};
+    glu_parallel_rows(count, count, glu_transform_rows, &job);
+    return GL_TRUE;
+}
+
+GLint gluProjectArray(const GLfloat *objects, GLsizei count, const GLfloat *model, const GLfloat *proj, const GLint *view, GLfloat *windows) {
+    double md[16], pd[16], m[16];
+    glu_load_matrixf(model, md);
+    glu_load_matrixf(proj, pd);
+    glu_window_matrixd(md, pd, view, m);
+    return glu_transform_array(m, objects, count, windows);
+}
+
+GLint gluUnProjectArray(const GLfloat *windows, GLsizei count, const GLfloat *model, const GLfloat *proj, const GLint *view, GLfloat *objects) {
+    double md[16], pd[16], m[16], inv[16];
+    glu_load_matrixf(model, md);
+    glu_load_matrixf(proj, pd);
+    glu_window_matrixd(md, pd, view, m);
+    if (!glu_invert_matrixd(m, inv))
+        return GL_FALSE;
+    return glu_transform_array(inv, windows, count, objects);
+}
+
+GLint gluPickRay(GLfloat winX, GLfloat winY, const GLfloat *model, const GLfloat *proj, const GLint *view, GLfloat *origin, GLfloat *direction) {
+    double md[16], pd[16], m[16], inv[16], near[3], far[3];
+    glu_load_matrixf(model, md);
+    glu_load_matrixf(proj, pd);
+    glu_window_matrixd(md, pd, view, m);
+    if (!glu_invert_matrixd(m, inv) ||
+        !glu_transformd(inv, (double[3]){winX, winY, 0.}, near) ||
+        !glu_transformd(inv, (double[3]){winX, winY, 1.}, far))
+        return GL_FALSE;
+    double d[3] = {far[0] - near[0], far[1] - near[1], far[2] - near[2]};
+    double length = sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+    if (length == 0.)
+        return GL_FALSE;
+    for (int i = 0; i < 3; i++) {
+        origin[i] = (GLfloat)near[i];
+        direction[i] = (GLfloat)(d[i] / length);
+    }
+    return GL_TRUE;
+}
+
+// Picking splits the input into at most this many chunks, each chunk
+// records its closest hit and the results are reduced afterwards
+#define GLU_PICK_CHUNKS 256
+#define GLU_PICK_CHUNK_MIN 4096
+
+struct glu_pick_job {
+    float origin[3], direction[3];
+    const GLfloat *data;
+    const GLuint *indices;
+    GLsizei count, chunk;
+    struct {
+        float t;
+        GLint index;
+    } hits[GLU_PICK_CHUNKS];
+};
+
+static inline f32x4 glu_min4(f32x4 a, f32x4 b) {
+#if defined(GLU_SSE2)
+    return (f32x4)_mm_min_ps((__m128)a, (__m128)b);
+#elif defined(GLU_NEON)
+    return (f32x4)vminq_f32((float32x4_t)a, (float32x4_t)b);
+#else
+    return (f32x4){MIN(a[0], b[0]), MIN(a[1], b[1]), MIN(a[2], b[2]), MIN(a[3], b[3])};
+#endif
+}
+
+static inline f32x4 glu_max4(f32x4 a, f32x4 b) {
+#if defined(GLU_SSE2)
+    return (f32x4)_mm_max_ps((__m128)a, (__m128)b);
+#elif defined(GLU_NEON)
+    return (f32x4)vmaxq_f32((float32x4_t)a, (float32x4_t)b);
+#else
+    return (f32x4){MAX(a[0], b[0]), MAX(a[1], b[1]), MAX(a[2], b[2]), MAX(a[3], b[3])};
+#endif
+}
+
+// Slab test, four boxes at a time
+static void glu_pick_aabb_rows(void *arg, int begin, int end) {
+    struct glu_pick_job *job = arg;
+    float inv[3];
+    for (int i = 0; i < 3; i++)
+        inv[i] = 1.f / job->direction[i];
+    f32x4 ox = {job->origin[0], job->origin[0], job->origin[0], job->origin[0]};
+    f32x4 oy = {job->origin[1], job->origin[1], job->origin[1], job->origin[1]};
+    f32x4 oz = {job->origin[2], job->origin[2], job->origin[2], job->origin[2]};
+    f32x4 ix = {inv[0], inv[0], inv[0], inv[0]};
+    f32x4 iy = {inv[1], inv[1], inv[1], inv[1]};
+    f32x4 iz = {inv[2], inv[2], inv[2], inv[2]};
+    f32x4 zero = {0.f, 0.f, 0.f, 0.f};
+    for (int r = begin; r < end; r++) {
+        GLsizei i = r * job->chunk, last = MIN(i + job->chunk, job->count);
+        float best = INFINITY;
+        GLint index = -1;
+        for (; i + 4 <= last; i += 4) {
+            // Four boxes are exactly six vectors, transpose them to one
+            // vector per coordinate
+            f32x4 v[6];
+            memcpy(v, job->data + (size_t)i * 6, sizeof(v));
+            f32x4 a = GLU_SHUFFLE(v[0], v[1], 0, 1, 2, 3), b = GLU_SHUFFLE(v[3], v[4], 0, 1, 2, 3);
+            f32x4 c = GLU_SHUFFLE(v[0], v[2], 2, 3, 0, 1), d = GLU_SHUFFLE(v[3], v[5], 2, 3, 0, 1);
+            f32x4 e = GLU_SHUFFLE(v[1], v[2], 0, 1, 2, 3), f = GLU_SHUFFLE(v[4], v[5], 0, 1, 2, 3);
+            f32x4 tx0 = (GLU_SHUFFLE(a, b, 0, 2, 0, 2) - ox) * ix;
+            f32x4 ty0 = (GLU_SHUFFLE(a, b, 1, 3, 1, 3) - oy) * iy;
+            f32x4 tz0 = (GLU_SHUFFLE(c, d, 0, 2, 0, 2) - oz) * iz;
+            f32x4 tx1 = (GLU_SHUFFLE(c, d, 1, 3, 1, 3) - ox) * ix;
+            f32x4 ty1 = (GLU_SHUFFLE(e, f, 0, 2, 0, 2) - oy) * iy;
+            f32x4 tz1 = (GLU_SHUFFLE(e, f, 1, 3, 1, 3) - oz) * iz;
+            f32x4 near = glu_max4(glu_max4(glu_min4(tx0, tx1), glu_min4(ty0, ty1)), glu_min4(tz0, tz1));
+            f32x4 far = glu_min4(glu_min4(glu_max4(tx0, tx1), glu_max4(ty0, ty1)), glu_max4(tz0, tz1));
+            near = glu_max4(near, zero);
+            for (int k = 0; k < 4; k++)
+                if (near[k] <= far[k] && near[k] < best) {
+                    best = near[k];
+                    index = i + k;
+                }
+        }
+        for (; i < last; i++) {
+            const GLfloat *b = job->data + (size_t)i * 6;
+            float near = 0.f, far = INFINITY;
+            for (int a = 0; a < 3; a++) {
+                float t0 = (b[a] - job->origin[a]) * inv[a], t1 = (b[a + 3] - job->origin[a]) * inv[a];
+                near = MAX(near, MIN(t0, t1));
+                far = MIN(far, MAX(t0, t1));
+            }
+            if (near <= far && near < best) {
+                best = near;
+                index = i;
+            }
+        }
+        job->hits[r].t = best;
+        job->hits[r].index = index;
+    }
+}
+
+// Möller-Trumbore, double sided
+static void glu_pick_triangle_rows(void *arg, int begin, int end) {
+    struct glu_pick_job *job = arg;
+    const float *o = job->origin, *d = job->direction;
+    for (int r = begin; r < end; r++) {
+        GLsizei i = r * job->chunk, last = MIN(i + job->chunk, job->count);
+        float best = INFINITY;
+        GLint index = -1;
+        for (; i < last; i++) {
+            const GLfloat *v0, *v1, *v2;
+            if (job->indices) {
+                const GLuint *tri = job->indices + (size_t)i * 3;
+                v0 = job->data + (size_t)tri[0] * 3;
+                v1 = job->data + (size_t)tri[1] * 3;
+                v2 = job->data + (size_t)tri[2] * 3;
+            } else {
+                v0 = job->data + (size_t)i * 9;
+                v1 = v0 + 3;
+                v2 = v0 + 6;
+            }
+            float e1[3] = {v1[0] - v0[0], v1[1] - v0[1], v1[2] - v0[2]};
+            float e2[3] = {v2[0] - v0[0], v2[1] - v0[1], v2[2] - v0[2]};
+            float p[3] = {d[1] * e2[2] - d[2] * e2[1], d[2] * e2[0] - d[0] * e2[2], d[0] * e2[1] - d[1] * e2[0]};
+            float det = e1[0] * p[0] + e1[1] * p[1] + e1[2] * p[2];
+            if (fabsf(det) < 1e-12f)
+                continue;
+            float inv = 1.f / det;
+            float s[3] = {o[0] - v0[0], o[1] - v0[1], o[2] - v0[2]};
+            float u = (s[0] * p[0] + s[1] * p[1] + s[2] * p[2]) * inv;
+            if (u < 0.f || u > 1.f)
+                continue;
+            float q[3] = {s[1] * e1[2] - s[2] * e1[1], s[2] * e1[0] - s[0] * e1[2], s[0] * e1[1] - s[1] * e1[0]};
+            float v = (d[0] * q[0] + d[1] * q[1] + d[2] * q[2]) * inv;
+            if (v < 0.f || u + v > 1.f)
+                continue;
+            float t = (e2[0] * q[0] + e2[1] * q[1] + e2[2] * q[2]) * inv;
+            if (t >= 0.f && t < best) {
+                best = t;
+                index = i;
+            }
+        }
+        job->hits[r].t = best;
+        job->hits[r].index = index;
+    }
+}
+
+static GLint glu_pick(struct glu_pick_job *job, const GLfloat *origin, const GLfloat *direction, glu_rows_func func, GLfloat *distance) {
+    if (job->count <= 0)
+        return -1;
+    for (int i = 0; i < 3; i++) {
+        job->origin[i] = origin[i];
+        job->direction[i] = direction[i];
+    }
+    // Multiple of 4 so only the very last chunk has a scalar tail
+    job->chunk = MAX(GLU_PICK_CHUNK_MIN, ((job->count + GLU_PICK_CHUNKS - 1) / GLU_PICK_CHUNKS + 3) & ~3);
+    int chunks = (job->count + job->chunk - 1) / job->chunk;
+    glu_parallel_rows(chunks, job->count, func, job);
+    GLint index = -1;
+    float best = INFINITY;
+    for (int i = 0; i < chunks; i++)
+        if (job->hits[i].index >= 0 && job->hits[i].t < best) {
+            best = job->hits[i].t;
+            index = job->hits[i].index;
+        }
+    if (index >= 0 && distance)
+        *distance = best;
+    return index;
+}
+
+GLint gluPickAABB(const GLfloat *origin, const GLfloat *direction, const GLfloat *boxes, GLsizei count, GLfloat *distance) {
+    struct glu_pick_job job = {.data = boxes, .count = count};
+    return glu_pick(&job, origin, direction, glu_pick_aabb_rows, distance);
+}
+
+GLint gluPickTriangles(const GLfloat *origin, const GLfloat *direction, const GLfloat *vertices, const GLuint *indices, GLsizei count, GLfloat *distance) {
+    struct glu_pick_job job = {.data = vertices, .indices = indices, .count = count};
+    return glu_pick(&job, origin, direction, glu_pick_triangle_rows, distance);
+}
+
+/* Quadrics
+   Every shape is a grid of (rows + 1) x (cols + 1) vertices, sphere
+   stacks, cylinder stacks or disk loops by slices. Closed shapes repeat
+   the first column at the end so texture coordinates wrap cleanly. */
+
+enum {
+    GLU_QUADRIC_SPHERE = 0,
+    GLU_QUADRIC_CYLINDER,
+    GLU_QUADRIC_DISK
+};
+
+struct glu_quadric_key {
+    int shape;
+    GLint rows, cols;
+    float params[4];
+    GLenum style, normals, orientation, primitive;
+    GLboolean texture, restart;
+};
+
+struct glu_quadric_mesh {
+    struct glu_quadric_key key;
+    GLuint vao, buffers[2];
+    GLenum mode;
+    GLsizei count;
+    uint64_t used;
+};
+
+struct GLUquadric {
+    GLenum style, normals, orientation, primitive;
+    GLboolean texture, restart;
+    void(*error)(GLenum);
+    struct glu_quadric_mesh cache[GLU_QUADRIC_CACHE_SIZE];
+    int cached;
+    uint64_t clock;
+    struct glu_quadric_mesh *last;
+};
+
+struct glu_quadric_vertex {
+    GLfloat position[3], normal[3], texcoord[2];
+};
+
+static void glu_quadric_error(GLUquadric *quad, GLenum err) {
+    if (quad->error)
+        quad->error(err);
+}
+
+static bool glu_quadric_closed(const struct glu_quadric_key *key) {
+    return key->shape != GLU_QUADRIC_DISK || fabsf(key->params[3]) >= 2.f * (float)PI;
+}
+
+static void glu_quadric_vertex(const struct glu_quadric_key *key, int row, int col, struct glu_quadric_vertex *v) {
+    float fr = (float)row / key->rows, fc = (float)col / key->cols;
+    // Exact seam, sin/cos of 2pi aren't quite 0/1
+    float theta = glu_quadric_closed(key) && col == key->cols ? 0.f : 2.f * (float)PI * fc;
+    float n[3] = {0.f, 0.f, 1.f};
+    switch (key->shape) {
+        case GLU_QUADRIC_SPHERE: {
+            float rho = (float)PI * fr, radius = key->params[0];
+            // Exact poles so their slivers are recognised as degenerate
+            float sin_rho = row == 0 || row == key->rows ? 0.f : sinf(rho);
+            n[0] = sinf(theta) * sin_rho;
+            n[1] = cosf(theta) * sin_rho;
+            n[2] = row == 0 ? 1.f : row == key->rows ? -1.f : cosf(rho);
+            for (int i = 0; i < 3; i++)
+                v->position[i] = n[i] * radius;
+            v->texcoord[0] = fc;
+            v->texcoord[1] = 1.f - fr;
+            break;
+        }
+        case GLU_QUADRIC_CYLINDER: {
+            float base = key->params[0], top = key->params[1], height = key->params[2];
+            float radius = base + (top - base) * fr;
+            v->position[0] = radius * sinf(theta);
+            v->position[1] = radius * cosf(theta);
+            v->position[2] = height * fr;
+            n[0] = sinf(theta) * height;
+            n[1] = cosf(theta) * height;
+            n[2] = base - top;
+            float length = sqrtf(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+            for (int i = 0; i < 3 && length > 0.f; i++)
+                n[i] /= length;
+            v->texcoord[0] = fc;
+            v->texcoord[1] = fr;
+            break;
+        }
+        case GLU_QUADRIC_DISK: {
+            float inner = key->params[0], outer = key->params[1];
+            float radius = inner + (outer - inner) * fr;
+            if (!glu_quadric_closed(key) || col != key->cols)
+                theta = key->params[2] + key->params[3] * fc;
+            else
+                theta = key->params[2];
+            v->position[0] = radius * sinf(theta);
+            v->position[1] = radius * cosf(theta);
+            v->position[2] = 0.f;
+            v->texcoord[0] = .5f + v->position[0] / (2.f * outer);
+            v->texcoord[1] = .5f + v->position[1] / (2.f * outer);
+            break;
+        }
+    }
+    float sign = key->orientation == GLU_INSIDE ? -1.f : 1.f;
+    for (int i = 0; i < 3; i++)
+        v->normal[i] = n[i] * sign;
+}
+
+static bool glu_quadric_same(const struct glu_quadric_vertex *a, const struct glu_quadric_vertex *b) {
+    return a->position[0] == b->position[0] && a->position[1] == b->position[1] && a->position[2] == b->position[2];
+}
+
+// True when triangle a, b, c winds clockwise around its normals
+static int glu_quadric_facing(const struct glu_quadric_vertex *a, const struct glu_quadric_vertex *b, const struct glu_quadric_vertex *c) {
+    float u[3], w[3], n[3];
+    for (int i = 0; i < 3; i++) {
+        u[i] = b->position[i] - a->position[i];
+        w[i] = c->position[i] - a->position[i];
+        n[i] = a->normal[i] + b->normal[i] + c->normal[i];
+    }
+    float d = (u[1] * w[2] - u[2] * w[1]) * n[0] + (u[2] * w[0] - u[0] * w[2]) * n[1] + (u[0] * w[1] - u[1] * w[0]) * n[2];
+    return (d > 0.f) - (d < 0.f);
+}
+
+static GLsizei glu_quadric_indices(const struct glu_quadric_key *key, const struct glu_quadric_vertex *v, GLushort *out) {
+    int rows = key->rows, cols = key->cols, stride = cols + 1;
+    GLsizei n = 0;
+#define V(R, C) ((R) * stride + (C))
+    switch (key->style) {
+        case GLU_FILL: {
+            // Triangles are emitted as (i, j), (i + 1, j), (i, j + 1), flipped
+            // when that faces away from the normals
+            bool flip = false;
+            for (int i = 0, found = 0; i < rows && !found; i++)
+                for (int j = 0; j < cols && !found; j++) {
+                    int facing = glu_quadric_facing(&v[V(i, j)], &v[V(i + 1, j)], &v[V(i, j + 1)]);
+                    if ((found = facing != 0))
+                        flip = facing < 0;
+                }
+            if (key->primitive == GL_TRIANGLE_STRIP) {
+                for (int i = 0; i < rows; i++) {
+                    if (i > 0) {
+                        if (key->restart)
+                            out[n++] = GLU_QUADRIC_RESTART_INDEX;
+                        else {
+                            // Rows have an even length so winding survives the join
+                            out[n] = out[n - 1];
+                            n++;
+                            out[n++] = flip ? V(i + 1, 0) : V(i, 0);
+                        }
+                    }
+                    for (int j = 0; j <= cols; j++) {
+                        out[n++] = flip ? V(i + 1, j) : V(i, j);
+                        out[n++] = flip ? V(i, j) : V(i + 1, j);
+                    }
+                }
+            } else
+                for (int i = 0; i < rows; i++)
+                    for (int j = 0; j < cols; j++) {
+                        GLushort a = V(i, j), b = V(i + 1, j), c = V(i, j + 1), d = V(i + 1, j + 1);
+                        // Skip the slivers at poles and cone tips
+                        if (!glu_quadric_same(&v[a], &v[b]) && !glu_quadric_same(&v[a], &v[c])) {
+                            out[n++] = a;
+                            out[n++] = flip ? c : b;
+                            out[n++] = flip ? b : c;
+                        }
+                        if (!glu_quadric_same(&v[d], &v[b]) && !glu_quadric_same(&v[d], &v[c])) {
+                            out[n++] = c;
+                            out[n++] = flip ? d : b;
+                            out[n++] = flip ? b : d;
+                        }
+                    }
+            break;
+        }
+        case GLU_LINE:
+        case GLU_SILHOUETTE: {
+            bool outline = key->style == GLU_SILHOUETTE && key->shape != GLU_QUADRIC_SPHERE;
+            bool closed = glu_quadric_closed(key);
+            for (int i = 0; i <= rows; i++) {
+                if (outline && i != 0 && i != rows)
+                    continue;
+                for (int j = 0; j < cols; j++)
+                    if (!glu_quadric_same(&v[V(i, j)], &v[V(i, j + 1)])) {
+                        out[n++] = V(i, j);
+                        out[n++] = V(i, j + 1);
+                    }
+            }
+            // The seam column duplicates the first one on closed shapes
+            for (int j = 0; j < (closed ? cols : cols + 1); j++) {
+                if (outline && (closed || (j != 0 && j != cols)))
+                    continue;
+                for (int i = 0; i < rows; i++)
+                    if (!glu_quadric_same(&v[V(i, j)], &v[V(i + 1, j)])) {
+                        out[n++] = V(i, j);
+                        out[n++] = V(i + 1, j);
+                    }
+            }
+            break;
+        }
+        case GLU_POINT:
+            for (int i = 0; i < (rows + 1) * stride; i++)
+                out[n++] = (GLushort)i;
+            break;
+    }
+#undef V
+    return n;
+}
+
+static struct glu_quadric_mesh* glu_quadric_mesh(GLUquadric *quad, const struct glu_quadric_key *key) {
+    quad->clock++;
+    struct glu_quadric_mesh *mesh = NULL;
+    for (int i = 0; i < quad->cached; i++)
+        if (!memcmp(&quad->cache[i].key, key, sizeof(*key))) {
+            mesh = &quad->cache[i];
+            mesh->used = quad->clock;
+            return mesh;
+        }
+
+    size_t vertices = (size_t)(key->rows + 1) * (key->cols + 1);
+    // Index 0xFFFF is reserved for primitive restart
+    if (vertices > GLU_QUADRIC_RESTART_INDEX) {
+        glu_quadric_error(quad, GLU_INVALID_VALUE);
+        return NULL;
+    }
+    size_t max_indices = vertices * 6 + (size_t)key->rows * 2;
+    struct glu_quadric_vertex *v = malloc(sizeof(struct glu_quadric_vertex) * vertices);
+    GLushort *indices = malloc(sizeof(GLushort) * max_indices);
+    if (!v || !indices) {
+        free(v);
+        free(indices);
+        glu_quadric_error(quad, GLU_OUT_OF_MEMORY);
+        return NULL;
+    }
+    for (int i = 0; i <= key->rows; i++)
+        for (int j = 0; j <= key->cols; j++)
+            glu_quadric_vertex(key, i, j, &v[i * (key->cols + 1) + j]);
+    GLsizei count = glu_quadric_indices(key, v, indices);
+
+    if (quad->cached < GLU_QUADRIC_CACHE_SIZE)
+        mesh = &quad->cache[quad->cached++];
+    else {
+        mesh = &quad->cache[0];
+        for (int i = 1; i < quad->cached; i++)
+            if (quad->cache[i].used < mesh->used)
+                mesh = &quad->cache[i];
+        glDeleteVertexArrays(1, &mesh->vao);
+        glDeleteBuffers(2, mesh->buffers);
+        if (quad->last == mesh)
+            quad->last = NULL;
+    }
+    mesh->key = *key;
+    mesh->count = count;
+    mesh->used = quad->clock;
+    switch (key->style) {
+        case GLU_FILL:
+            mesh->mode = key->primitive;
+            break;
+        case GLU_POINT:
+            mesh->mode = GL_POINTS;
+            break;
+        default:
+            mesh->mode = GL_LINES;
+    }
+
+    glGenVertexArrays(1, &mesh->vao);
+    glGenBuffers(2, mesh->buffers);
+    glBindVertexArray(mesh->vao);
+    glBindBuffer(GL_ARRAY_BUFFER, mesh->buffers[0]);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(struct glu_quadric_vertex) * vertices, v, GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh->buffers[1]);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLushort) * count, indices, GL_STATIC_DRAW);
+    glVertexAttribPointer(GLU_QUADRIC_POSITION, 3, GL_FLOAT, GL_FALSE, sizeof(struct glu_quadric_vertex),
+                          (void*)offsetof(struct glu_quadric_vertex, position));
+    glEnableVertexAttribArray(GLU_QUADRIC_POSITION);
+    if (key->normals != GLU_NONE) {
+        glVertexAttribPointer(GLU_QUADRIC_NORMAL, 3, GL_FLOAT, GL_FALSE, sizeof(struct glu_quadric_vertex),
+                              (void*)offsetof(struct glu_quadric_vertex, normal));
+        glEnableVertexAttribArray(GLU_QUADRIC_NORMAL);
+    }
+    if (key->texture) {
+        glVertexAttribPointer(GLU_QUADRIC_TEXCOORD, 2, GL_FLOAT, GL_FALSE, sizeof(struct glu_quadric_vertex),
+                              (void*)offsetof(struct glu_quadric_vertex, texcoord));
+        glEnableVertexAttribArray(GLU_QUADRIC_TEXCOORD);
+    }
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    free(v);
+    free(indices);
+    return mesh;
+}
+
+static void glu_quadric_draw(GLUquadric *quad, struct glu_quadric_key *key) {
+    key->style = quad->style;
+    key->normals = quad->normals;
+    key->orientation = quad->orientation;
+    key->texture = quad->texture;
+    key->primitive = quad->style == GLU_FILL ? quad->primitive : GL_TRIANGLES;
+    key->restart = key->primitive == GL_TRIANGLE_STRIP && quad->restart;
+    struct glu_quadric_mesh *mesh = glu_quadric_mesh(quad, key);
+    if (!(quad->last = mesh) || !mesh->count)
+        return;
+
+    glBindVertexArray(mesh->vao);
+    if (key->restart) {
+        GLboolean enabled = glIsEnabled(GL_PRIMITIVE_RESTART);
+        if (!enabled)
+            glEnable(GL_PRIMITIVE_RESTART);
+        glPrimitiveRestartIndex(GLU_QUADRIC_RESTART_INDEX);
+        glDrawElements(mesh->mode, mesh->count, GL_UNSIGNED_SHORT, NULL);
+        if (!enabled)
+            glDisable(GL_PRIMITIVE_RESTART);
+    } else
+        glDrawElements(mesh->mode, mesh->count, GL_UNSIGNED_SHORT, NULL);
+    glBindVertexArray(0);
+}
+
+GLUquadric* gluNewQuadric(void) {
+    GLUquadric *quad = calloc(1, sizeof(GLUquadric));
+    if (quad) {
+        quad->style = GLU_FILL;
+        quad->normals = GLU_SMOOTH;
+        quad->orientation = GLU_OUTSIDE;
+        quad->primitive = GL_TRIANGLES;
+        quad->texture = GL_FALSE;
+        quad->restart = GL_FALSE;
+    }
+    return quad;
+}
+
+void gluDeleteQuadric(GLUquadric *quad) {
+    if (!quad)
+        return;
+    for (int i = 0; i < quad->cached; i++) {
+        glDeleteVertexArrays(1, &quad->cache[i].vao);
+        glDeleteBuffers(2, quad->cache[i].buffers);
+    }
+    free(quad);
+}
+
+void gluQuadricCallback(GLUquadric *quad, GLenum which, _GLUfuncptr CallBackFunc) {
+    if (which == GLU_ERROR)
+        quad->error = (void(*)(GLenum))CallBackFunc;
+    else
+        glu_quadric_error(quad, GLU_INVALID_ENUM);
+}
+
+void gluQuadricDrawStyle(GLUquadric *quad, GLenum draw) {
+    if (draw == GLU_POINT || draw == GLU_LINE || draw == GLU_FILL || draw == GLU_SILHOUETTE)
+        quad->style = draw;
+    else
+        glu_quadric_error(quad, GLU_INVALID_ENUM);
+}
+
+void gluQuadricNormals(GLUquadric *quad, GLenum normal) {
+    if (normal == GLU_SMOOTH || normal == GLU_FLAT || normal == GLU_NONE)
+        // Flat and smooth share the same mesh
+        quad->normals = normal == GLU_NONE ? GLU_NONE : GLU_SMOOTH;
+    else
+        glu_quadric_error(quad, GLU_INVALID_ENUM);
+}
+
+void gluQuadricOrientation(GLUquadric *quad, GLenum orientation) {
+    if (orientation == GLU_OUTSIDE || orientation == GLU_INSIDE)
+        quad->orientation = orientation;
+    else
+        glu_quadric_error(quad, GLU_INVALID_ENUM);
+}
+
+void gluQuadricTexture(GLUquadric *quad, GLboolean texture) {
+    quad->texture = texture ? GL_TRUE : GL_FALSE;
+}
+
+void gluQuadricPrimitive(GLUquadric *quad, GLenum mode) {
+    if (mode == GL_TRIANGLES || mode == GL_TRIANGLE_STRIP)
+        quad->primitive = mode;
+    else
+        glu_quadric_error(quad, GLU_INVALID_ENUM);
+}
+
+void gluQuadricPrimitiveRestart(GLUquadric *quad, GLboolean restart) {
+    quad->restart = restart ? GL_TRUE : GL_FALSE;
+}
+
+void gluQuadricGetMesh(GLUquadric *quad, GLuint *vao, GLenum *mode, GLsizei *count) {
+    *vao = quad->last ? quad->last->vao : 0;
+    *mode = quad->last ? quad->last->mode : GL_TRIANGLES;
+    *count = quad->last ? quad->last->count : 0;
+}
+
+void gluSphere(GLUquadric *quad, GLdouble radius, GLint slices, GLint stacks) {
+    if (radius < 0. || slices < 2 || stacks < 1) {
+        glu_quadric_error(quad, GLU_INVALID_VALUE);
+        return;
+    }
+    // Zeroed so padding doesn't break the memcmp lookup
+    struct glu_quadric_key key;
+    memset(&key, 0, sizeof(key));
+    key.shape = GLU_QUADRIC_SPHERE;
+    key.rows = stacks;
+    key.cols = slices;
+    key.params[0] = (float)radius;
+    glu_quadric_draw(quad, &key);
+}
+
+void gluCylinder(GLUquadric *quad, GLdouble base, GLdouble top, GLdouble height, GLint slices, GLint stacks) {
+    if (base < 0. || top < 0. || height < 0. || slices < 2 || stacks < 1) {
+        glu_quadric_error(quad, GLU_INVALID_VALUE);
+        return;
+    }
+    struct glu_quadric_key key;
+    memset(&key, 0, sizeof(key));
+    key.shape = GLU_QUADRIC_CYLINDER;
+    key.rows = stacks;
+    key.cols = slices;
+    key.params[0] = (float)base;
+    key.params[1] = (float)top;
+    key.params[2] = (float)height;
+    glu_quadric_draw(quad, &key);
+}
+
+void gluPartialDisk(GLUquadric *quad, GLdouble inner, GLdouble outer, GLint slices, GLint loops, GLdouble start, GLdouble sweep) {
+    if (inner < 0. || outer <= 0. || outer < inner || slices < 2 || loops < 1) {
+        glu_quadric_error(quad, GLU_INVALID_VALUE);
+        return;
+    }
+    // Angles are in degrees, clockwise from +y
+    if (sweep < -360.)
+        sweep = 360.;
+    else if (sweep > 360.)
+        sweep = 360.;
+    else if (sweep < 0.) {
+        start += sweep;
+        sweep = -sweep;
+    }
+    struct glu_quadric_key key;
+    memset(&key, 0, sizeof(key));
+    key.shape = GLU_QUADRIC_DISK;
+    key.rows = loops;
+    key.cols = slices;
+    key.params[0] = (float)inner;
+    key.params[1] = (float)outer;
+    key.params[2] = (float)TO_RADIANS(start);
+    key.params[3] = sweep == 360. ? 2.f * (float)PI : (float)TO_RADIANS(sweep);
+    glu_quadric_draw(quad, &key);
+}
+
+void gluDisk(GLUquadric *quad, GLdouble inner, GLdouble outer, GLint slices, GLint loops) {
+    gluPartialDisk(quad, inner, outer, slices, loops, 0., 360.);
+}
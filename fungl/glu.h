@@ -22,11 +22,199 @@
 #if defined(__cplusplus)
 extern "C" {
 #endif
+#include "gl.h"
+#include "glm.h"
 #if FUNGL_VERSION < GL_VERSION_3_2
 #error "glu.h requires FUNGL_VERSION >= GL_VERSION_3_2"
 #endif
-#include "gl.h"
-#include "glm.h"
+
+/* Errors */
+#define GLU_INVALID_ENUM                   100900
+#define GLU_INVALID_VALUE                  100901
+#define GLU_OUT_OF_MEMORY                  100902
+#define GLU_INVALID_OPERATION              100904
+
+/* Image filters (fungl extension) */
+#define GLU_FILTER_BOX                     0
+#define GLU_FILTER_KAISER                  1
+
+/* Mipmapping
+   Supported formats are GL_RED, GL_RG, GL_RGB, GL_BGR, GL_RGBA, GL_BGRA,
+   GL_ALPHA, GL_LUMINANCE and GL_LUMINANCE_ALPHA with GL_UNSIGNED_BYTE,
+   GL_UNSIGNED_SHORT, GL_HALF_FLOAT or GL_FLOAT data, tightly packed.
+   Filtering is done in linear space for sRGB internal formats. Unlike the
+   reference GLU, NPOT images are not rescaled to a power of two. */
+GLint gluScaleImage(GLenum format, GLsizei wIn, GLsizei hIn, GLenum typeIn, const void *dataIn, GLsizei wOut, GLsizei hOut, GLenum typeOut, GLvoid *dataOut);
+GLint gluBuild2DMipmaps(GLenum target, GLint internalFormat, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *data);
+GLint gluScaleImageFiltered(GLenum format, GLsizei wIn, GLsizei hIn, GLenum typeIn, const void *dataIn, GLsizei wOut, GLsizei hOut, GLenum typeOut, GLvoid *dataOut, GLenum filter, GLboolean srgb);
+GLint gluBuild2DMipmapsFiltered(GLenum target, GLint internalFormat, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *data, GLenum filter);
+
+/* Tessellation
+   Polygons are triangulated by ear clipping with hole bridging (no new
+   vertices are created, so the combine callback is never called). Holes
+   and the winding rule are resolved from how contours nest, contours are
+   expected not to intersect each other. Triangles are emitted as
+   GL_TRIANGLES through the usual callbacks and/or written as indices into
+   a buffer given to gluTessIndexBuffer. */
+typedef struct GLUtesselator GLUtesselator;
+typedef GLUtesselator GLUtesselatorObj;
+typedef GLUtesselator GLUtriangulatorObj;
+typedef void (*_GLUfuncptr)(void);
+
+#define GLU_TESS_MAX_COORD                 1.0e150
+
+/* TessCallback */
+#define GLU_TESS_BEGIN                     100100
+#define GLU_BEGIN                          100100
+#define GLU_TESS_VERTEX                    100101
+#define GLU_VERTEX                         100101
+#define GLU_TESS_END                       100102
+#define GLU_END                            100102
+#define GLU_TESS_ERROR                     100103
+#define GLU_TESS_EDGE_FLAG                 100104
+#define GLU_EDGE_FLAG                      100104
+#define GLU_TESS_COMBINE                   100105
+#define GLU_TESS_BEGIN_DATA                100106
+#define GLU_TESS_VERTEX_DATA               100107
+#define GLU_TESS_END_DATA                  100108
+#define GLU_TESS_ERROR_DATA                100109
+#define GLU_TESS_EDGE_FLAG_DATA            100110
+#define GLU_TESS_COMBINE_DATA              100111
+
+/* TessContour */
+#define GLU_CW                             100120
+#define GLU_CCW                            100121
+#define GLU_INTERIOR                       100122
+#define GLU_EXTERIOR                       100123
+#define GLU_UNKNOWN                        100124
+
+/* TessProperty */
+#define GLU_TESS_WINDING_RULE              100140
+#define GLU_TESS_BOUNDARY_ONLY             100141
+#define GLU_TESS_TOLERANCE                 100142
+
+/* TessError */
+#define GLU_TESS_MISSING_BEGIN_POLYGON     100151
+#define GLU_TESS_MISSING_BEGIN_CONTOUR     100152
+#define GLU_TESS_MISSING_END_POLYGON       100153
+#define GLU_TESS_MISSING_END_CONTOUR       100154
+#define GLU_TESS_COORD_TOO_LARGE           100155
+#define GLU_TESS_NEED_COMBINE_CALLBACK     100156
+
+/* TessWinding */
+#define GLU_TESS_WINDING_ODD               100130
+#define GLU_TESS_WINDING_NONZERO           100131
+#define GLU_TESS_WINDING_POSITIVE          100132
+#define GLU_TESS_WINDING_NEGATIVE          100133
+#define GLU_TESS_WINDING_ABS_GEQ_TWO       100134
+
+GLUtesselator* gluNewTess(void);
+void gluDeleteTess(GLUtesselator *tess);
+void gluTessBeginPolygon(GLUtesselator *tess, GLvoid *data);
+void gluTessBeginContour(GLUtesselator *tess);
+void gluTessVertex(GLUtesselator *tess, GLdouble *location, GLvoid *data);
+void gluTessEndContour(GLUtesselator *tess);
+void gluTessEndPolygon(GLUtesselator *tess);
+void gluTessProperty(GLUtesselator *tess, GLenum which, GLdouble data);
+void gluGetTessProperty(GLUtesselator *tess, GLenum which, GLdouble *data);
+void gluTessNormal(GLUtesselator *tess, GLdouble valueX, GLdouble valueY, GLdouble valueZ);
+void gluTessCallback(GLUtesselator *tess, GLenum which, _GLUfuncptr CallBackFunc);
+/* fungl extensions
+   gluTessIndexBuffer: every following polygon writes its triangles as
+   indices (in gluTessVertex order) into `indices`, pass NULL to stop.
+   gluTessIndexCount: indices produced by the last polygon, if this is
+   greater than the buffer's capacity the output was truncated.
+   gluTessPolygon2f: triangulates a 2D polygon in one call, contour `i`
+   ends (exclusive) at vertex `ends[i]`. Returns the index count. */
+void gluTessIndexBuffer(GLUtesselator *tess, GLuint *indices, GLsizei capacity);
+GLsizei gluTessIndexCount(GLUtesselator *tess);
+GLsizei gluTessPolygon2f(GLUtesselator *tess, const GLfloat *xy, const GLsizei *ends, GLsizei contours, GLuint *indices, GLsizei capacity);
+
+/* Projection
+   Matrices are column-major (as glLoadMatrix), viewports are {x, y, width,
+   height}. The array versions combine (and for unprojecting invert) the
+   matrices once, then transform `count` tightly packed xyz points. Every
+   function returns GL_FALSE if the combined matrix can't be inverted or a
+   single point ends up with w == 0. */
+GLint gluProject(GLdouble objX, GLdouble objY, GLdouble objZ, const GLdouble *model, const GLdouble *proj, const GLint *view, GLdouble *winX, GLdouble *winY, GLdouble *winZ);
+GLint gluUnProject(GLdouble winX, GLdouble winY, GLdouble winZ, const GLdouble *model, const GLdouble *proj, const GLint *view, GLdouble *objX, GLdouble *objY, GLdouble *objZ);
+GLint gluProjectArray(const GLfloat *objects, GLsizei count, const GLfloat *model, const GLfloat *proj, const GLint *view, GLfloat *windows);
+GLint gluUnProjectArray(const GLfloat *windows, GLsizei count, const GLfloat *model, const GLfloat *proj, const GLint *view, GLfloat *objects);
+
+/* Picking (fungl extension)
+   gluPickRay: ray from the near to the far plane through a window position,
+   `direction` is normalised so hit distances are in object space units.
+   gluPickAABB: boxes are packed {minX, minY, minZ, maxX, maxY, maxZ}.
+   gluPickTriangles: `count` triangles, three indices each or, when
+   `indices` is NULL, three consecutive xyz vertices each.
+   Both return the index of the closest hit in front of the origin (or -1)
+   and optionally its distance along `direction`. */
+GLint gluPickRay(GLfloat winX, GLfloat winY, const GLfloat *model, const GLfloat *proj, const GLint *view, GLfloat *origin, GLfloat *direction);
+GLint gluPickAABB(const GLfloat *origin, const GLfloat *direction, const GLfloat *boxes, GLsizei count, GLfloat *distance);
+GLint gluPickTriangles(const GLfloat *origin, const GLfloat *direction, const GLfloat *vertices, const GLuint *indices, GLsizei count, GLfloat *distance);
+
+/* Quadrics
+   Shapes are generated once into an interleaved vertex buffer (position,
+   normal, texcoord as 8 floats) with 16-bit indices, uploaded into a VAO
+   and cached on the quadric by their parameters, later calls only draw.
+   Attributes are bound to GLU_QUADRIC_POSITION/NORMAL/TEXCOORD, the caller
+   provides the program. GLU_FLAT normals are treated as GLU_SMOOTH as
+   vertices are shared between faces. */
+typedef struct GLUquadric GLUquadric;
+typedef GLUquadric GLUquadricObj;
+
+#ifndef GLU_QUADRIC_POSITION
+#define GLU_QUADRIC_POSITION               0
+#endif
+#ifndef GLU_QUADRIC_NORMAL
+#define GLU_QUADRIC_NORMAL                 1
+#endif
+#ifndef GLU_QUADRIC_TEXCOORD
+#define GLU_QUADRIC_TEXCOORD               2
+#endif
+#ifndef GLU_QUADRIC_CACHE_SIZE
+#define GLU_QUADRIC_CACHE_SIZE             32
+#endif
+#define GLU_QUADRIC_RESTART_INDEX          0xFFFF
+
+/* QuadricNormal */
+#define GLU_SMOOTH                         100000
+#define GLU_FLAT                           100001
+#define GLU_NONE                           100002
+
+/* QuadricDrawStyle */
+#define GLU_POINT                          100010
+#define GLU_LINE                           100011
+#define GLU_FILL                           100012
+#define GLU_SILHOUETTE                     100013
+
+/* QuadricOrientation */
+#define GLU_OUTSIDE                        100020
+#define GLU_INSIDE                         100021
+
+/* QuadricCallback */
+#define GLU_ERROR                          100103
+
+GLUquadric* gluNewQuadric(void);
+void gluDeleteQuadric(GLUquadric *quad);
+void gluQuadricCallback(GLUquadric *quad, GLenum which, _GLUfuncptr CallBackFunc);
+void gluQuadricDrawStyle(GLUquadric *quad, GLenum draw);
+void gluQuadricNormals(GLUquadric *quad, GLenum normal);
+void gluQuadricOrientation(GLUquadric *quad, GLenum orientation);
+void gluQuadricTexture(GLUquadric *quad, GLboolean texture);
+void gluSphere(GLUquadric *quad, GLdouble radius, GLint slices, GLint stacks);
+void gluCylinder(GLUquadric *quad, GLdouble base, GLdouble top, GLdouble height, GLint slices, GLint stacks);
+void gluDisk(GLUquadric *quad, GLdouble inner, GLdouble outer, GLint slices, GLint loops);
+void gluPartialDisk(GLUquadric *quad, GLdouble inner, GLdouble outer, GLint slices, GLint loops, GLdouble start, GLdouble sweep);
+/* fungl extensions
+   gluQuadricPrimitive: GL_TRIANGLES (default) or GL_TRIANGLE_STRIP for
+   GLU_FILL, strips are joined with degenerate triangles unless primitive
+   restart is enabled, then they're split by GLU_QUADRIC_RESTART_INDEX.
+   gluQuadricGetMesh: the cached VAO, primitive and index count of the
+   last shape, to draw it again (e.g. instanced) without the lookup. */
+void gluQuadricPrimitive(GLUquadric *quad, GLenum mode);
+void gluQuadricPrimitiveRestart(GLUquadric *quad, GLboolean restart);
+void gluQuadricGetMesh(GLUquadric *quad, GLuint *vao, GLenum *mode, GLsizei *count);
 
 #if defined(__cplusplus)
 }
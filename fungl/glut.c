@@ -24,6 +24,7 @@
 #endif
 #include <GLFW/glfw3.h>
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
 #ifdef _WIN32
 #include <windows.h>
@@ -39,6 +40,7 @@ typedef void(*glut_special_callback)(int, int, int);
 typedef void(*glut_mouse_callback)(int, int, int, int);
 typedef void(*glut_motion_callback)(int, int);
 typedef void(*glut_passive_motion_callback)(int, int);
+typedef void(*glut_frame_callback)(void*);
 
 static struct {
     glut_display_callback display_callback;
@@ -48,6 +50,12 @@ static struct {
     glut_mouse_callback mouse_callback;
     glut_motion_callback motion_callback;
     glut_passive_motion_callback passive_motion_callback;
+    struct glut_func {
+        glut_frame_callback func;
+        void *userdata;
+    } frame_funcs[GLUT_MAX_FRAME_FUNCS], swap_funcs[GLUT_MAX_SWAP_FUNCS];
+    int frame_func_count;
+    int swap_func_count;
     GLFWwindow *window;
     int initialised;
     unsigned int mode;
@@ -70,7 +78,9 @@ static struct {
     .cursor_x = 0,
     .cursor_y = 0,
     .mouse_is_down = 0,
-    .modifier = 0
+    .modifier = 0,
+    .frame_func_count = 0,
+    .swap_func_count = 0
 };
 
 void glutInit(int *argcp, char **argv) {
@@ -123,6 +133,24 @@ void glutInitWindowSize(int width, int height) {
     }
 }
 
+static int glut_func_registered(const struct glut_func *funcs, const int *count, struct glut_func entry) {
+    for (int i = 0; i < *count; i++)
+        if (funcs[i].func == entry.func && funcs[i].userdata == entry.userdata)
+            return 1;
+    return 0;
+}
+
+// Runs over a copy of the list as it stood on entry, so funcs added by a
+// callback wait for the next run and funcs removed by one are skipped
+static void glut_run_funcs(const struct glut_func *funcs, const int *count) {
+    struct glut_func snapshot[GLUT_MAX_FRAME_FUNCS > GLUT_MAX_SWAP_FUNCS ? GLUT_MAX_FRAME_FUNCS : GLUT_MAX_SWAP_FUNCS];
+    int n = *count;
+    memcpy(snapshot, funcs, n * sizeof(snapshot[0]));
+    for (int i = 0; i < n; i++)
+        if (glut_func_registered(funcs, count, snapshot[i]))
+            snapshot[i].func(snapshot[i].userdata);
+}
+
 void glutMainLoop(void) {
     int width_window, height_window;
     glfwGetWindowSize(glfw.window, &width_window, &height_window);
@@ -130,12 +158,50 @@ void glutMainLoop(void) {
     
     // TODO: Properly mimic glut's loop
     while (!glfwWindowShouldClose(glfw.window)) {
+        glut_run_funcs(glfw.frame_funcs, &glfw.frame_func_count);
         glfw.display_callback();
-        glfwSwapBuffers(glfw.window);
+        glutSwapBuffers();
         glfwPollEvents();
     }
 }
 
+int glutAddFrameFunc(void (*func)(void *userdata), void *userdata) {
+    if (!func || glfw.frame_func_count >= GLUT_MAX_FRAME_FUNCS)
+        return 0;
+    glfw.frame_funcs[glfw.frame_func_count].func = func;
+    glfw.frame_funcs[glfw.frame_func_count].userdata = userdata;
+    glfw.frame_func_count++;
+    return 1;
+}
+
+void glutRemoveFrameFunc(void (*func)(void *userdata), void *userdata) {
+    for (int i = 0; i < glfw.frame_func_count; i++)
+        if (glfw.frame_funcs[i].func == func && glfw.frame_funcs[i].userdata == userdata) {
+            memmove(&glfw.frame_funcs[i], &glfw.frame_funcs[i + 1],
+                    (glfw.frame_func_count - i - 1) * sizeof(glfw.frame_funcs[0]));
+            glfw.frame_func_count--;
+            return;
+        }
+}
+
+int glutAddSwapFunc(void (*func)(void *userdata), void *userdata) {
+    if (!func || glfw.swap_func_count >= GLUT_MAX_SWAP_FUNCS)
+        return 0;
+    glfw.swap_funcs[glfw.swap_func_count].func = func;
+    glfw.swap_funcs[glfw.swap_func_count].userdata = userdata;
+    glfw.swap_func_count++;
+    return 1;
+}
+
+void glutRemoveSwapFunc(void (*func)(void *userdata), void *userdata) {
+    for (int i = 0; i < glfw.swap_func_count; i++)
+        if (glfw.swap_funcs[i].func == func && glfw.swap_funcs[i].userdata == userdata) {
+            memmove(&glfw.swap_funcs[i], &glfw.swap_funcs[i + 1],
+                    (glfw.swap_func_count - i - 1) * sizeof(glfw.swap_funcs[0]));
+            glfw.swap_func_count--;
+            return;
+        }
+}
 
 static void glutMouseButtonCallback(GLFWwindow *window, int button, int action, int mod) {
     glfw.modifier = mod;
@@ -322,6 +388,7 @@ void glutPostRedisplay(void) {
 }
 
 void glutSwapBuffers(void) {
+    glut_run_funcs(glfw.swap_funcs, &glfw.swap_func_count);
     glfwSwapBuffers(glfw.window);
 }
 
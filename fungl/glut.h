@@ -273,6 +273,26 @@ int glutEnterGameMode(void);
 void glutLeaveGameMode(void);
 int glutGameModeGet(GLenum mode);
 
+/* fungl extension: frame functions run on the render thread at the start of
+   every glutMainLoop iteration, before the display callback, in the order
+   they were added. Used by the asynchronous subsystems to deliver their
+   completions. */
+#ifndef GLUT_MAX_FRAME_FUNCS
+#define GLUT_MAX_FRAME_FUNCS 16
+#endif
+// Returns 0 if GLUT_MAX_FRAME_FUNCS are already registered
+int glutAddFrameFunc(void (*func)(void *userdata), void *userdata);
+void glutRemoveFrameFunc(void (*func)(void *userdata), void *userdata);
+/* fungl extension: swap functions run right before every buffer swap, from
+   glutMainLoop or glutSwapBuffers, in the order they were added. Used to
+   finish work batched during the frame. */
+#ifndef GLUT_MAX_SWAP_FUNCS
+#define GLUT_MAX_SWAP_FUNCS 16
+#endif
+// Returns 0 if GLUT_MAX_SWAP_FUNCS are already registered
+int glutAddSwapFunc(void (*func)(void *userdata), void *userdata);
+void glutRemoveSwapFunc(void (*func)(void *userdata), void *userdata);
+
 #if defined(__cplusplus)
 }
 #endif
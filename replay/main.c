@@ -0,0 +1,220 @@
+/* main.c -- https://github.com/takeiteasy/fungl
+
+ fungl puts the fun back into OpenGL
+
+ Copyright (C) 2024  George Watson
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+ usage: fungl-replay [-w warmup] [-o results.json] [-p profile.json] trace
+
+ Replays a trace written by trace_capture_begin/trace_capture_end one frame
+ per glutMainLoop iteration and reports how long the calls took to issue on
+ the CPU and, where timer queries are available, to execute on the GPU.
+ The first `warmup` frames (default 1, the frame that created everything)
+ are left out of the statistics. Results are written as JSON (stdout by
+ default), -p also writes the frames as a Chrome trace (see glprofile.h).
+ A trace only replays once per process, its objects are created by the
+ frames themselves. */
+
+#include "fungl.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+struct replay_stats {
+    int count;
+    double min, mean, median, p95, max;
+};
+
+static struct {
+    struct trace_replay *replay;
+    const char *path, *out_path, *profile_path;
+    int warmup, frame;
+    double *cpu, *gpu;
+    int cpu_count, gpu_count, capacity;
+} state;
+
+static int compare_double(const void *a, const void *b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+static void replay_stats(double *samples, int count, struct replay_stats *out) {
+    memset(out, 0, sizeof(*out));
+    if (!count)
+        return;
+    qsort(samples, count, sizeof(double), compare_double);
+    double sum = 0.;
+    for (int i = 0; i < count; i++)
+        sum += samples[i];
+    out->count = count;
+    out->min = samples[0];
+    out->max = samples[count - 1];
+    out->mean = sum / (double)count;
+    out->median = count % 2 ? samples[count / 2] : (samples[count / 2 - 1] + samples[count / 2]) * .5;
+    out->p95 = samples[(int)((double)(count - 1) * .95 + .5)];
+}
+
+static void write_stats(FILE *fh, const char *name, const struct replay_stats *stats, bool last) {
+    fprintf(fh, "    {\"name\": \"%s\", \"frames\": %d, \"min_ms\": %.4f, \"mean_ms\": %.4f, "
+            "\"median_ms\": %.4f, \"p95_ms\": %.4f, \"max_ms\": %.4f}%s\n",
+            name, stats->count, stats->min, stats->mean, stats->median, stats->p95, stats->max, last ? "" : ",");
+}
+
+static void print_stats(const char *name, const struct replay_stats *stats) {
+    if (stats->count)
+        fprintf(stderr, "%-4s %6d frames  min %9.3f  mean %9.3f  median %9.3f  p95 %9.3f  max %9.3f ms\n",
+                name, stats->count, stats->min, stats->mean, stats->median, stats->p95, stats->max);
+}
+
+static void finish(void) {
+    const char *error = trace_replay_error(state.replay);
+    if (error) {
+        fprintf(stderr, "ERROR: replay stopped in frame %d: %s\n", state.frame, error);
+        exit(EXIT_FAILURE);
+    }
+    if (state.profile_path && !profile_write_trace(state.profile_path))
+        fprintf(stderr, "ERROR: failed to write \"%s\"\n", state.profile_path);
+    struct replay_stats cpu, gpu;
+    replay_stats(state.cpu, state.cpu_count, &cpu);
+    replay_stats(state.gpu, state.gpu_count, &gpu);
+    fprintf(stderr, "%s: %d frames, %zu calls, %zu bytes\n", state.path, state.frame,
+            trace_replay_calls(state.replay), trace_replay_position(state.replay));
+    print_stats("cpu", &cpu);
+    print_stats("gpu", &gpu);
+
+    FILE *out = state.out_path ? fopen(state.out_path, "w") : stdout;
+    if (!out) {
+        fprintf(stderr, "ERROR: failed to open \"%s\"\n", state.out_path);
+        exit(EXIT_FAILURE);
+    }
+    fprintf(out, "{\n  \"trace\": \"%s\",\n  \"frames\": %d,\n  \"calls\": %zu,\n  \"replay\": [\n",
+            state.path, state.frame, trace_replay_calls(state.replay));
+    write_stats(out, "cpu", &cpu, !gpu.count);
+    if (gpu.count)
+        write_stats(out, "gpu", &gpu, true);
+    fprintf(out, "  ]\n}\n");
+    if (out != stdout)
+        fclose(out);
+    trace_replay_close(state.replay);
+    free(state.cpu);
+    free(state.gpu);
+    exit(EXIT_SUCCESS);
+}
+
+static void replay_reserve(void) {
+    if (state.cpu_count < state.capacity && state.gpu_count < state.capacity)
+        return;
+    state.capacity *= 2;
+    double *cpu = realloc(state.cpu, state.capacity * sizeof(double));
+    double *gpu = realloc(state.gpu, state.capacity * sizeof(double));
+    if (!cpu || !gpu)
+        abort();
+    state.cpu = cpu;
+    state.gpu = gpu;
+}
+
+static void display_func(void) {
+    replay_reserve();
+    // Frames read back by the profiler lag a few behind, they are sampled
+    // as they arrive
+    double cpu, gpu;
+    if (profile_frame_time(&cpu, &gpu) && gpu >= 0. && state.frame > state.warmup + PROFILE_FRAMES)
+        state.gpu[state.gpu_count++] = gpu;
+
+    uint64_t start = profile_now();
+    bool more = false;
+    PROFILE_SCOPE("replay")
+        more = trace_replay_frame(state.replay);
+    double elapsed = (double)(profile_now() - start) / 1e6;
+    if (!more)
+        finish();
+    if (state.frame++ >= state.warmup)
+        state.cpu[state.cpu_count++] = elapsed;
+}
+
+// The trace sets its own viewport
+static void reshape_func(int w, int h) {
+    (void)w;
+    (void)h;
+}
+
+static void usage(const char *name) {
+    fprintf(stderr, "usage: %s [-w warmup] [-o results.json] [-p profile.json] trace\n", name);
+}
+
+int main(int argc, char *argv[]) {
+    state.warmup = 1;
+    for (int i = 1; i < argc; i++) {
+        if (argv[i][0] != '-') {
+            if (state.path) {
+                usage(argv[0]);
+                return EXIT_FAILURE;
+            }
+            state.path = argv[i];
+            continue;
+        }
+        if (i + 1 >= argc || strlen(argv[i]) != 2) {
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        char flag = argv[i][1];
+        const char *value = argv[++i];
+        switch (flag) {
+            case 'w':
+                state.warmup = atoi(value);
+                break;
+            case 'o':
+                state.out_path = value;
+                break;
+            case 'p':
+                state.profile_path = value;
+                break;
+            default:
+                usage(argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+    if (!state.path) {
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    glutInit(&argc, argv);
+    // Timer queries need a 3.3 context, a core profile gets the newest one
+    glutInitDisplayMode(GLUT_3_2_CORE_PROFILE | GLUT_RGBA | GLUT_DOUBLE | GLUT_DEPTH | GLUT_STENCIL);
+    glutDisplayFunc(display_func);
+    glutReshapeFunc(reshape_func);
+    glutCreateWindow("fungl-replay");
+    if (glInit())
+        abort();
+    if (!(state.replay = trace_replay_open(state.path))) {
+        fprintf(stderr, "ERROR: failed to open \"%s\", or it was captured by a different build\n", state.path);
+        return EXIT_FAILURE;
+    }
+    int frames = trace_replay_frames(state.replay);
+    if (frames < 0)
+        fprintf(stderr, "WARNING: \"%s\" wasn't closed by trace_capture_end, replaying what is there\n", state.path);
+    // Grows if the frame count is missing or wrong
+    state.capacity = frames > 0 ? frames : 1024;
+    if (!(state.cpu = malloc(state.capacity * sizeof(double))) ||
+        !(state.gpu = malloc(state.capacity * sizeof(double))))
+        abort();
+    profile_init();
+    if (state.profile_path)
+        profile_capture(true);
+    glutMainLoop();
+    return 0;
+}
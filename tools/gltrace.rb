@@ -0,0 +1,335 @@
+#!/usr/bin/env ruby
+=begin
+ gltrace.rb -- https://github.com/takeiteasy/fungl
+
+ fungl puts the fun back into OpenGL
+ 
+ Copyright (C) 2024  George Watson
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+=end
+
+# Generates fungl/gltrace_calls.h, the capture wrappers and replay decoders
+# used by gltrace.c. Every command of the GL_VERSION_x_y features gets a
+# wrapper that encodes its arguments (and whatever they point to) and a
+# decoder that reads them back and calls the real function. The helpers
+# they call (trace_write_*, trace_read_*, the hooks) live in gltrace.c.
+
+require "nokogiri"
+
+abort "ERROR: tools/gl.xml is missing, run tools/gl.rb first" unless File.exist? "tools/gl.xml"
+doc = Nokogiri::XML File.open("tools/gl.xml") do |config|
+  config.options = Nokogiri::XML::ParseOptions::STRICT | Nokogiri::XML::ParseOptions::NOBLANKS
+end
+
+# Queries aren't recorded, the replay has no use for their results. The
+# exception are the ones whose results the trace refers to later.
+REPLAYED_GETS = %w[glGetUniformLocation]
+IGNORED = %w[glAreTexturesResident glCheckFramebufferStatus glCheckNamedFramebufferStatus
+             glRenderMode glDebugMessageCallback glSelectBuffer glFeedbackBuffer]
+# Hand written hooks in gltrace.c, called around the real function
+CAPTURE_BEFORE = %w[glUnmapBuffer glUnmapNamedBuffer glFlushMappedBufferRange
+                    glFlushMappedNamedBufferRange glDeleteBuffers]
+CAPTURE_AFTER = %w[glMapBuffer glMapBufferRange glMapNamedBuffer glMapNamedBufferRange]
+REPLAY_BEFORE = %w[glUnmapBuffer glUnmapNamedBuffer glDeleteBuffers]
+REPLAY_AFTER = %w[glMapBuffer glMapBufferRange glMapNamedBuffer glMapNamedBufferRange glUseProgram]
+# Object classes whose names are remapped on replay, shaders and programs
+# share one namespace
+NAME_CLASSES = {
+  "buffer" => "TRACE_NAME_BUFFER", "texture" => "TRACE_NAME_TEXTURE",
+  "framebuffer" => "TRACE_NAME_FRAMEBUFFER", "renderbuffer" => "TRACE_NAME_RENDERBUFFER",
+  "program" => "TRACE_NAME_PROGRAM", "shader" => "TRACE_NAME_PROGRAM",
+  "query" => "TRACE_NAME_QUERY", "sampler" => "TRACE_NAME_SAMPLER",
+  "vertex array" => "TRACE_NAME_VERTEX_ARRAY", "transform feedback" => "TRACE_NAME_TRANSFORM_FEEDBACK",
+  "program pipeline" => "TRACE_NAME_PROGRAM_PIPELINE", "display list" => "TRACE_NAME_DISPLAY_LIST"
+}
+UNSIGNED = %w[GLenum GLbitfield GLuint GLboolean GLubyte GLushort GLuint64]
+SIGNED = %w[GLint GLsizei GLbyte GLshort GLsizeiptr GLintptr GLint64 GLfixed]
+FLOATS = %w[GLfloat GLclampf]
+DOUBLES = %w[GLdouble GLclampd]
+# Element counts of COMPSIZE(count) arrays
+ARRAY_COUNTS = {"glViewportArrayv" => 4, "glScissorArrayv" => 4, "glDepthRangeArrayv" => 2}
+
+Param = Struct.new(:name, :type, :base, :len, :klass) do
+  def pointer?; type.include? "*"; end
+  def const?; type.start_with? "const"; end
+end
+
+def parse_param(node)
+  type = node.children.reject { |c| c.name == "name" }.map(&:text).join.gsub(/\s+/, " ").strip
+  ptype = node.at_xpath("ptype")
+  Param.new(node.at_xpath("name").text, type, ptype ? ptype.text : type.sub("const", "").delete("*").strip,
+            node.attr("len"), node.attr("class"))
+end
+
+commands = {}
+doc.xpath("//commands/command").each do |c|
+  proto = c.at_xpath("proto")
+  name = proto.at_xpath("name").text
+  result = proto.children.reject { |x| x.name == "name" }.map(&:text).join.strip.gsub(/\s+/, " ")
+  commands[name] = {:result => result, :class => proto.attr("class"), :params => c.xpath("param").map { |p| parse_param p }}
+end
+
+features = doc.xpath("//feature").select { |f| f.attr('name') =~ /^GL_VERSION_\d_\d$/ }
+versions = []
+seen = {}
+features.each do |f|
+  names = f.xpath("require/command").map { |c| c.attr("name") }.uniq.reject { |n| seen[n] }
+  names.each { |n| seen[n] = true }
+  versions << [f.attr("number").tr(".", "_"), names]
+end
+
+def ignored?(name)
+  return false if REPLAYED_GETS.include? name
+  name =~ /^glGet/ || name =~ /^glIs[A-Z]/ || IGNORED.include?(name)
+end
+
+def proc_type(name)
+  "PFN#{name.upcase}PROC"
+end
+
+def len_expr(len)
+  return len if len =~ /^\d+$/ || len =~ /^[a-zA-Z_]\w*$/
+  return "(#{$1})*#{$2}" if len =~ /^(\w+)\*(\d+)$/
+  nil
+end
+
+def base_size(p)
+  p.base == "void" ? "1" : "sizeof(#{p.base})"
+end
+
+# Count of elements for arrays sized by COMPSIZE(...)
+def compsize(command, p, params)
+  args = p.len[/COMPSIZE\((.*)\)/, 1].to_s.split(",").map(&:strip)
+  case
+  when args == ["pname"] then "trace_pname_count(pname)"
+  when args == ["buffer"] then "trace_clear_count(buffer)"
+  when args == ["count"] && ARRAY_COUNTS[command] then "(count)*#{ARRAY_COUNTS[command]}"
+  when args == ["width", "height"] then "((width) + 7) / 8 * (height)"
+  when args.empty? then "128"
+  when args == ["n", "type"] then "(n)*trace_type_size(type)"
+  when args == ["format", "type"] then "trace_pixel_size(format, type)"
+  when args == ["target", "stride", "order"] then "((order) - 1) * (stride) + trace_map_components(target)"
+  when args == ["target", "ustride", "uorder", "vstride", "vorder"]
+    "((uorder) - 1) * (ustride) + ((vorder) - 1) * (vstride) + trace_map_components(target)"
+  else abort "ERROR: #{command}.#{p.name} has an unknown size #{p.len}"
+  end
+end
+
+# Returns [capture code, replay code] for one argument. The replay code
+# declares a local with the argument's name holding the value to pass.
+def param_code(command, p, params)
+  n = p.name
+  cls = NAME_CLASSES[p.klass]
+  unless p.pointer?
+    return ["", "    #{p.type} #{n} = NULL;"] if p.base == "GLDEBUGPROC"
+    return ["    trace_write_sync(#{n});", "    GLsync #{n} = trace_read_sync(reader);"] if p.base == "GLsync"
+    if cls
+      return ["    trace_write_uint(#{n});",
+              "    GLuint #{n} = trace_name(reader, #{cls}, (GLuint)trace_read_uint(reader));"]
+    end
+    if n == "location" && command =~ /^gl(Program)?Uniform/
+      program = command.start_with?("glProgram") ? "program" : "reader->program"
+      return ["    trace_write_int(#{n});",
+              "    GLint #{n} = trace_location(reader, #{program}, (GLint)trace_read_int(reader));"]
+    end
+    return ["    trace_write_uint(#{n});", "    #{p.base} #{n} = (#{p.base})trace_read_uint(reader);"] if UNSIGNED.include? p.base
+    return ["    trace_write_int(#{n});", "    #{p.base} #{n} = (#{p.base})trace_read_int(reader);"] if SIGNED.include? p.base
+    return ["    trace_write_float(#{n});", "    #{p.base} #{n} = trace_read_float(reader);"] if FLOATS.include? p.base
+    return ["    trace_write_double(#{n});", "    #{p.base} #{n} = trace_read_double(reader);"] if DOUBLES.include? p.base
+    abort "ERROR: #{command}.#{n} has an unknown type #{p.type}"
+  end
+
+  unless p.const?
+    if cls && p.len
+      # Names written by the call, recorded after it (see output_code)
+      return ["", "    GLuint *#{n} = trace_scratch(reader, (size_t)(#{p.len}) * sizeof(GLuint));"]
+    end
+    if n == "pixels" || n == "data"
+      return ["    trace_write_pack(#{n}, #{params.any? { |q| q.name == "bufSize" } ? "(size_t)bufSize" : "trace_pixels_span(format, type, width, height, 1, true)"});",
+              "    void *#{n} = trace_read_pack(reader);"]
+    end
+    abort "ERROR: #{command}.#{n} is an unknown output #{p.type}"
+  end
+
+  if p.base == "GLchar" && p.type.include?("*const*")
+    lengths = params.find { |q| q.name == "length" && q.pointer? } ? "length" : "NULL"
+    return ["    trace_write_strings(#{n}, #{len_expr p.len}, #{lengths});",
+            "    const GLchar *const*#{n} = trace_read_strings(reader);"]
+  end
+  if p.base == "GLchar"
+    length = p.len.to_s =~ /,\s*length\)/ ? "length" : "-1"
+    return ["    trace_write_string(#{n}, #{length});", "    const GLchar *#{n} = trace_read_string(reader);"]
+  end
+  if p.type.include? "*const*"
+    return ["    trace_write_offsets(#{n}, #{len_expr p.len});", "    const void *const*#{n} = trace_read_offsets(reader);"]
+  end
+  if p.base == "void"
+    if n == "pixels"
+      dims = %w[width height depth].map { |d| params.any? { |q| q.name == d } ? d : "1" }
+      return ["    trace_write_unpack(#{n}, trace_pixels_span(format, type, #{dims.join ', '}, false));",
+              "    const void *#{n} = trace_read_unpack(reader);"]
+    end
+    if command =~ /^glCompressedTex/
+      return ["    trace_write_unpack(#{n}, (size_t)imageSize);", "    const void *#{n} = trace_read_unpack(reader);"]
+    end
+    return ["    trace_write_sync((GLsync)#{n});", "    const void *#{n} = (const void*)trace_read_sync(reader);"] if command == "glObjectPtrLabel"
+    count = p.len.to_s.include?("COMPSIZE") ? nil : len_expr(p.len.to_s)
+    count = compsize(command, p, params) if p.len.to_s =~ /COMPSIZE\((n,type|format,type)\)/
+    if count
+      return ["    trace_write_array(#{n}, (size_t)(#{count}), 1);", "    const void *#{n} = trace_read_array(reader);"]
+    end
+    # Vertex and index pointers and indirect commands are buffer offsets in
+    # the core profile
+    return ["    trace_write_offset(#{n});", "    const void *#{n} = trace_read_offset(reader);"]
+  end
+
+  count = p.len.to_s.include?("COMPSIZE") ? compsize(command, p, params) : len_expr(p.len.to_s)
+  abort "ERROR: #{command}.#{n} has an unknown size #{p.len}" unless count
+  if cls
+    return ["    trace_write_array(#{n}, (size_t)(#{count}), sizeof(GLuint));",
+            "    const GLuint *#{n} = trace_read_names(reader, #{cls});"]
+  end
+  ["    trace_write_array(#{n}, (size_t)(#{count}), #{base_size p});",
+   "    const #{p.base} *#{n} = trace_read_array(reader);"]
+end
+
+# Results the replay needs: names written by the call and returned names,
+# syncs and uniform locations
+def output_code(command, info)
+  capture, replay = [], []
+  info[:params].each do |p|
+    next unless p.pointer? && !p.const? && NAME_CLASSES[p.klass] && p.len
+    capture << "    trace_write_array(#{p.name}, (size_t)(#{p.len}), sizeof(GLuint));"
+    replay << "    trace_map_names(reader, #{NAME_CLASSES[p.klass]}, #{p.name}, (size_t)(#{p.len}));"
+  end
+  if NAME_CLASSES[info[:class]]
+    range = info[:params].any? { |q| q.name == "range" } ? "range" : "1"
+    capture << "    trace_write_uint(result);"
+    replay << "    trace_map_name(reader, #{NAME_CLASSES[info[:class]]}, (GLuint)trace_read_uint(reader), result, #{range});"
+  elsif info[:result] == "GLsync"
+    capture << "    trace_write_sync(result);"
+    replay << "    trace_map_sync(reader, trace_read_uint(reader), result);"
+  elsif command == "glGetUniformLocation"
+    capture << "    trace_write_int(result);"
+    replay << "    trace_map_location(reader, program, (GLint)trace_read_int(reader), result);"
+  end
+  [capture, replay]
+end
+
+$> = File.open("fungl/gltrace_calls.h", "w")
+
+wrapped = versions.map { |v, names| [v, names.reject { |n| ignored? n }] }
+all = wrapped.flat_map { |_, names| names }
+hash = 0x811c9dc5
+all.join("\n").each_byte { |b| hash = ((hash ^ b) * 0x01000193) & 0xffffffff }
+
+puts <<HEADER
+/* gltrace_calls.h -- https://github.com/takeiteasy/fungl
+
+  This file was generated by https://github.com/takeiteasy/fungl/blob/master/tools/gltrace.rb
+
+  fungl puts the fun back into OpenGL
+
+  Copyright (C) 2024  George Watson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+// Included by gltrace.c only, after the helpers the wrappers use
+
+// Traces are only replayed by builds generated from the same command list
+#define TRACE_COMMANDS_HASH 0x#{hash.to_s(16)}u
+
+enum trace_command {
+HEADER
+all.each_with_index { |n, i| puts "    TRACE_#{n}#{i.zero? ? " = TRACE_FIRST_COMMAND" : ""}," }
+puts "    TRACE_COMMAND_END", "};", ""
+puts "static const char *trace_command_names[TRACE_COMMAND_END - TRACE_FIRST_COMMAND] = {"
+all.each_slice(4) { |s| puts "    #{s.map { |n| "\"#{n}\"" }.join(", ")}," }
+puts "};"
+
+wrapped.each do |v, names|
+  puts "", "#define TRACE_COMMANDS_#{v} \\"
+  names.each { |n| puts "\tX(#{proc_type n}, #{n}) \\" }
+end
+puts
+prev = nil
+wrapped.each do |v, _|
+  maj, min = v.split "_"
+  puts "#if FUNGL_VERSION >= GL_VERSION_#{maj}_#{min}"
+  puts "#define TRACE_COMMANDS_UPTO_#{v} #{prev ? "TRACE_COMMANDS_UPTO_#{prev} " : ""}TRACE_COMMANDS_#{v}"
+  puts "#else"
+  puts "#define TRACE_COMMANDS_UPTO_#{v}#{prev ? " TRACE_COMMANDS_UPTO_#{prev}" : ""}"
+  puts "#endif"
+  prev = v
+end
+puts "#define TRACE_COMMANDS TRACE_COMMANDS_UPTO_#{prev}", ""
+puts "#define X(T, N) T N;", "static struct {", "    TRACE_COMMANDS", "} trace_real;", "#undef X"
+
+wrapped.each do |v, names|
+  maj, min = v.split "_"
+  puts "", "#if FUNGL_VERSION >= GL_VERSION_#{maj}_#{min}"
+  names.each do |n|
+    info = commands[n]
+    params = info[:params]
+    codes = params.map { |p| param_code n, p, params }
+    capture_out, replay_out = output_code n, info
+    decl = params.empty? ? "void" : params.map { |p| "#{p.type}#{p.type.end_with?("*") ? "" : " "}#{p.name}" }.join(", ")
+    args = params.map(&:name).join(", ")
+    returns = info[:result] != "void"
+    result = "#{info[:result]}#{info[:result].end_with?("*") ? "" : " "}result = "
+    puts "static #{info[:result]}#{info[:result].end_with?("*") ? "" : " "}APIENTRY trace_#{n}(#{decl}) {"
+    puts "    trace_before_#{n}(#{args});" if CAPTURE_BEFORE.include? n
+    puts "    trace_command(TRACE_#{n});"
+    codes.each { |c, _| puts c unless c.empty? }
+    puts "    #{returns ? result : ""}trace_real.#{n}(#{args});"
+    capture_out.each { |c| puts c }
+    puts "    trace_after_#{n}(#{args}#{returns ? ", result" : ""});" if CAPTURE_AFTER.include? n
+    puts "    return result;" if returns
+    puts "}", ""
+    puts "static void trace_replay_#{n}(struct trace_reader *reader) {"
+    puts "    if (!__#{n}) {", "        trace_missing(reader, TRACE_#{n});", "        return;", "    }"
+    codes.each { |_, r| puts r }
+    puts "    if (reader->error)", "        return;"
+    puts "    trace_replay_before_#{n}(reader#{args.empty? ? "" : ", " + args});" if REPLAY_BEFORE.include? n
+    puts "    #{returns ? result : ""}__#{n}(#{args});"
+    replay_out.each { |r| puts r }
+    puts "    trace_replay_after_#{n}(reader#{args.empty? ? "" : ", " + args}#{returns ? ", result" : ""});" if REPLAY_AFTER.include? n
+    puts "    (void)result;" if returns && replay_out.empty? && !REPLAY_AFTER.include?(n)
+    puts "}", ""
+  end
+  puts "#endif"
+end
+
+puts "", "static void (*trace_replay_commands[TRACE_COMMAND_END - TRACE_FIRST_COMMAND])(struct trace_reader*) = {"
+wrapped.each do |v, names|
+  maj, min = v.split "_"
+  puts "#if FUNGL_VERSION >= GL_VERSION_#{maj}_#{min}"
+  names.each { |n| puts "    [TRACE_#{n} - TRACE_FIRST_COMMAND] = trace_replay_#{n}," }
+  puts "#endif"
+end
+puts "};"
+
+$>.close